@@ -0,0 +1,220 @@
+/*
+    Checksum.cpp - CRC32, CRC16-CCITT, byte and Internet sums using the DMA sniffer
+    Copyright (c) 2024 Earle F. Philhower, III.  All rights reserved.
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include "Checksum.h"
+#include <hardware/dma.h>
+#include <pico/mutex.h>
+#include <algorithm>
+
+// Below this the table lookups finish before a DMA channel could be set up
+#define CHECKSUM_DMA_MIN 64
+
+// The CPU loop does about 1.4 bytes per clock, the DMA up to 2, so it takes a
+// full size packet to win back the channel setup
+#define CHECKSUM_INET_DMA_MIN 1024
+
+// There's only one sniffer, shared by all the channels
+auto_init_mutex(_sniffMutex);
+
+struct ChecksumTables {
+    uint32_t crc32[256];
+    uint16_t crc16[256];
+    constexpr ChecksumTables() : crc32(), crc16() {
+        for (uint32_t i = 0; i < 256; i++) {
+            uint32_t c = i;
+            uint16_t d = i << 8;
+            for (int j = 0; j < 8; j++) {
+                c = (c >> 1) ^ ((c & 1) ? 0xedb88320 : 0);
+                d = (d << 1) ^ ((d & 0x8000) ? 0x1021 : 0);
+            }
+            crc32[i] = c;
+            crc16[i] = d;
+        }
+    }
+};
+static constexpr ChecksumTables _tables;
+
+static uint32_t _bitReverse(uint32_t x) {
+    x = ((x >> 1) & 0x55555555) | ((x & 0x55555555) << 1);
+    x = ((x >> 2) & 0x33333333) | ((x & 0x33333333) << 2);
+    x = ((x >> 4) & 0x0f0f0f0f) | ((x & 0x0f0f0f0f) << 4);
+    return __builtin_bswap32(x);
+}
+
+// Copies count bytes or halfwords into a dummy on a spare DMA channel, with
+// the sniffer accumulating the checksum starting from the raw value in *acc.
+// Returns false without touching *acc if the sniffer or a channel is not
+// available.  Reflected (CRC32) results are bit reversed and inverted on the
+// way out of the sniffer.
+static bool _sniff(uint mode, enum dma_channel_transfer_size size, bool reflected, uint32_t *acc, const void *data, size_t count) {
+    static uint16_t dummy;
+    if (!mutex_try_enter(&_sniffMutex, nullptr)) {
+        return false;
+    }
+    int ch = dma_claim_unused_channel(false);
+    if (ch < 0) {
+        mutex_exit(&_sniffMutex);
+        return false;
+    }
+    dma_channel_config c = dma_channel_get_default_config(ch);
+    channel_config_set_transfer_data_size(&c, size);
+    channel_config_set_read_increment(&c, true);
+    channel_config_set_write_increment(&c, false);
+    channel_config_set_sniff_enable(&c, true);
+    dma_sniffer_enable(ch, mode, false);
+    dma_sniffer_set_output_reverse_enabled(reflected);
+    dma_sniffer_set_output_invert_enabled(reflected);
+    dma_hw->sniff_data = *acc;
+    dma_channel_configure(ch, &c, &dummy, data, count, true);
+    dma_channel_wait_for_finish_blocking(ch);
+    *acc = dma_hw->sniff_data;
+    dma_sniffer_disable();
+    dma_channel_unclaim(ch);
+    mutex_exit(&_sniffMutex);
+    return true;
+}
+
+extern "C" uint32_t checksumCRC32(uint32_t crc, const void *data, size_t len) {
+    // The sniffer runs the CRC unreflected over bit reversed data, so its
+    // register holds the reflected CRC backwards
+    uint32_t acc = _bitReverse(~crc);
+    if ((len >= CHECKSUM_DMA_MIN) && _sniff(DMA_SNIFF_CTRL_CALC_VALUE_CRC32R, DMA_SIZE_8, true, &acc, data, len)) {
+        return acc;
+    }
+    const uint8_t *p = (const uint8_t *)data;
+    crc = ~crc;
+    while (len--) {
+        crc = (crc >> 8) ^ _tables.crc32[(crc ^ *p++) & 0xff];
+    }
+    return ~crc;
+}
+
+extern "C" uint16_t checksumCRC16(uint16_t crc, const void *data, size_t len) {
+    uint32_t acc = crc;
+    if ((len >= CHECKSUM_DMA_MIN) && _sniff(DMA_SNIFF_CTRL_CALC_VALUE_CRC16, DMA_SIZE_8, false, &acc, data, len)) {
+        return acc & 0xffff;
+    }
+    const uint8_t *p = (const uint8_t *)data;
+    while (len--) {
+        crc = (crc << 8) ^ _tables.crc16[(crc >> 8) ^ *p++];
+    }
+    return crc;
+}
+
+extern "C" uint32_t checksumSum(uint32_t sum, const void *data, size_t len) {
+    if ((len >= CHECKSUM_DMA_MIN) && _sniff(DMA_SNIFF_CTRL_CALC_VALUE_SUM, DMA_SIZE_8, false, &sum, data, len)) {
+        return sum;
+    }
+    const uint8_t *p = (const uint8_t *)data;
+    while (len--) {
+        sum += *p++;
+    }
+    return sum;
+}
+
+static uint32_t _fold(uint32_t sum) {
+    sum = (sum & 0xffff) + (sum >> 16);
+    return (sum & 0xffff) + (sum >> 16);
+}
+
+// Ones' complement sum of the 32 byte blocks at word aligned p
+static uint32_t _inetBlocks(uint32_t sum, const uint32_t *p, size_t blocks) {
+#if defined(__arm__)
+    // Two LDMs and an ADCS chain, with the carry out of each block added
+    // back in.  MOVS leaves C alone, so the zero can reuse a data register.
+    // The data registers are fixed to keep the LDM lists in order.
+    register uint32_t a asm("r2");
+    register uint32_t b asm("r3");
+    register uint32_t c asm("r4");
+    register uint32_t d asm("r5");
+    asm volatile(
+        "1:\n"
+        "ldmia %[p]!, {%[a], %[b], %[c], %[d]}\n"
+        "adds %[sum], %[sum], %[a]\n"
+        "adcs %[sum], %[sum], %[b]\n"
+        "adcs %[sum], %[sum], %[c]\n"
+        "adcs %[sum], %[sum], %[d]\n"
+        "ldmia %[p]!, {%[a], %[b], %[c], %[d]}\n"
+        "adcs %[sum], %[sum], %[a]\n"
+        "adcs %[sum], %[sum], %[b]\n"
+        "adcs %[sum], %[sum], %[c]\n"
+        "adcs %[sum], %[sum], %[d]\n"
+        "movs %[a], #0\n"
+        "adcs %[sum], %[sum], %[a]\n"
+        "subs %[n], %[n], #1\n"
+        "bne 1b\n"
+        : [sum] "+l"(sum), [p] "+l"(p), [n] "+l"(blocks), [a] "=&l"(a), [b] "=&l"(b), [c] "=&l"(c), [d] "=&l"(d)
+        :
+        : "cc", "memory");
+    return sum;
+#else
+    uint64_t acc = sum;
+    for (size_t i = 0; i < blocks * 8; i++) {
+        acc += p[i];
+    }
+    acc = (acc & 0xffffffff) + (acc >> 32);
+    return (acc & 0xffffffff) + (acc >> 32);
+#endif
+}
+
+extern "C" uint16_t checksumInternet(uint16_t sum, const void *data, size_t len) {
+    const uint8_t *p = (const uint8_t *)data;
+    uint32_t acc = 0;
+    // Summing from an odd address pairs up the bytes the wrong way round, which
+    // just swaps the bytes of the result
+    bool odd = (uintptr_t)p & 1;
+    if (odd && len) {
+        acc = *p++ << 8;
+        len--;
+    }
+    if (((uintptr_t)p & 2) && (len >= 2)) {
+        acc += *(const uint16_t *)p;
+        p += 2;
+        len -= 2;
+    }
+    // The sniffer's sum doesn't carry around, so fold before it can overflow
+    while (len >= CHECKSUM_INET_DMA_MIN) {
+        size_t n = std::min(len & ~1, (size_t)65536);
+        if (!_sniff(DMA_SNIFF_CTRL_CALC_VALUE_SUM, DMA_SIZE_16, false, &acc, p, n / 2)) {
+            break;
+        }
+        acc = _fold(acc);
+        p += n;
+        len -= n;
+    }
+    if (len >= 32) {
+        acc = _inetBlocks(acc, (const uint32_t *)p, len / 32);
+        p += len & ~31;
+        len &= 31;
+    }
+    acc = _fold(acc);
+    while (len >= 2) {
+        acc += *(const uint16_t *)p;
+        p += 2;
+        len -= 2;
+    }
+    if (len) {
+        acc += *p;
+    }
+    acc = _fold(acc);
+    if (odd) {
+        acc = ((acc & 0xff) << 8) | (acc >> 8);
+    }
+    return _fold(acc + sum);
+}
@@ -0,0 +1,53 @@
+/*
+    Checksum.h - CRC32, CRC16-CCITT, byte and Internet sums using the DMA sniffer
+    Copyright (c) 2024 Earle F. Philhower, III.  All rights reserved.
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Longer buffers are run through a spare DMA channel and its sniffer, which
+// checksums them at up to a byte per system clock.  Short buffers, or calls
+// made while the sniffer is busy (from the other core or an interrupt) or no
+// DMA channel is free, use lookup tables instead.  The results are the same
+// either way, and each call can continue from the result of the last one.
+
+// zlib/IEEE 802.3 CRC32, start with crc = 0
+uint32_t checksumCRC32(uint32_t crc, const void *data, size_t len);
+
+// CRC16-CCITT (polynomial 0x1021, not reflected).  Start with crc = 0 for
+// XMODEM, or 0xffff for CCITT-FALSE
+uint16_t checksumCRC16(uint16_t crc, const void *data, size_t len);
+
+// Sum of all the bytes, start with sum = 0
+uint32_t checksumSum(uint32_t sum, const void *data, size_t len);
+
+// RFC 1071 Internet checksum (IP, TCP, UDP, ICMP), the ones' complement sum of
+// the data as 16-bit words in host order, not inverted.  lwIP uses this for
+// all its checksums.  Start with sum = 0, every piece but the last must be an
+// even length.  Buffers under 1K use an unrolled CPU loop instead of the DMA
+uint16_t checksumInternet(uint16_t sum, const void *data, size_t len);
+
+#ifdef __cplusplus
+}
+#endif
@@ -141,6 +141,14 @@ bool File::truncate(uint32_t size) {
     return _p->truncate(size);
 }
 
+const uint8_t *File::mmap() {
+    if (!_p) {
+        return nullptr;
+    }
+
+    return _p->mmap();
+}
+
 const char* File::name() const {
     if (!_p) {
         return nullptr;
@@ -83,6 +83,9 @@ public:
     const char* fullName() const; // Includes path
     bool truncate(uint32_t size);
 
+    // Direct pointer to the file contents, if the underlying FS supports it (nullptr otherwise)
+    const uint8_t *mmap();
+
     bool isFile() const;
     bool isDirectory() const;
 
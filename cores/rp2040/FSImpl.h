@@ -45,6 +45,13 @@ public:
     virtual bool isFile() const = 0;
     virtual bool isDirectory() const = 0;
 
+    // Filesystems whose data lives contiguously in memory-mapped flash (or RAM) may
+    // return a pointer to the start of the file contents.  Callers can then read
+    // the data directly without copying it.  Returns nullptr when not supported.
+    virtual const uint8_t *mmap() {
+        return nullptr;
+    }
+
     // Filesystems *may* support a timestamp per-file, so allow the user to override with
     // their own callback for *this specific* file (as opposed to the FSImpl call of the
     // same name.  The default implementation simply returns time(null)
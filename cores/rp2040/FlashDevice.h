@@ -0,0 +1,61 @@
+/*
+    FlashDevice.h - Raw NOR flash block device interface for filesystems
+    Copyright (c) 2024 Earle F. Philhower, III.  All rights reserved.
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace fs {
+
+// Storage that LittleFS and FatFS can use in place of the onboard flash region,
+// such as an external SPI NOR chip.  Addresses are byte offsets from the start
+// of the device and, like any NOR flash, bytes must be erased before they are
+// programmed.
+class FlashDevice {
+public:
+    virtual ~FlashDevice() { }
+
+    // Total usable bytes, 0 if the device is not present
+    virtual uint32_t size() = 0;
+    // Smallest erasable unit, a power of 2
+    virtual uint32_t eraseSize() {
+        return 4096;
+    }
+    // Program granularity the filesystems should use
+    virtual uint32_t pageSize() {
+        return 256;
+    }
+
+    virtual bool read(uint32_t addr, void *dst, size_t len) = 0;
+    // Programs erased bytes, len may cross page boundaries
+    virtual bool program(uint32_t addr, const void *src, size_t len) = 0;
+    // addr and len are multiples of eraseSize()
+    virtual bool erase(uint32_t addr, size_t len) = 0;
+    // Completes any buffered writes
+    virtual bool sync() {
+        return true;
+    }
+};
+
+}; // namespace fs
+
+#ifndef FS_NO_GLOBALS
+using fs::FlashDevice;
+#endif
@@ -0,0 +1,58 @@
+/*
+    FlashProgram.cpp - Program and erase the onboard flash from a running sketch
+    Copyright (c) 2024 Earle F. Philhower, III.  All rights reserved.
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include <Arduino.h>
+#include "FlashProgram.h"
+#include <hardware/flash.h>
+#include <hardware/sync.h>
+#include <algorithm>
+
+void flashProgram(const void *dest, const void *src, size_t len, bool erase) {
+    uint32_t off = (intptr_t)dest - (intptr_t)XIP_BASE;
+    uint32_t first = off & ~(FLASH_PAGE_SIZE - 1);
+    uint32_t last = (off + len + FLASH_PAGE_SIZE - 1) & ~(FLASH_PAGE_SIZE - 1);
+    const uint8_t *s = (const uint8_t *)src;
+    uint8_t page[FLASH_PAGE_SIZE];
+
+    noInterrupts();
+    rp2040.idleOtherCore();
+    if (erase) {
+        uint32_t start = off & ~(FLASH_SECTOR_SIZE - 1);
+        flash_range_erase(start, ((last - start + FLASH_SECTOR_SIZE - 1) & ~(FLASH_SECTOR_SIZE - 1)));
+    }
+    // flash_range_program() leaves XIP running again, so each page can be
+    // staged from src, flash or not, without a whole padded copy on the heap
+    for (uint32_t p = first; p < last; p += FLASH_PAGE_SIZE) {
+        uint32_t lo = std::max(p, off);
+        uint32_t hi = std::min(p + FLASH_PAGE_SIZE, (uint32_t)(off + len));
+        memset(page, 0xff, sizeof(page));
+        memcpy(page + (lo - p), s + (lo - off), hi - lo);
+        flash_range_program(p, page, sizeof(page));
+    }
+    rp2040.resumeOtherCore();
+    interrupts();
+}
+
+void flashErase(const void *dest, size_t len) {
+    noInterrupts();
+    rp2040.idleOtherCore();
+    flash_range_erase((intptr_t)dest - (intptr_t)XIP_BASE, len);
+    rp2040.resumeOtherCore();
+    interrupts();
+}
@@ -0,0 +1,37 @@
+/*
+    FlashProgram.h - Program and erase the onboard flash from a running sketch
+    Copyright (c) 2024 Earle F. Philhower, III.  All rights reserved.
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Both take addresses in the XIP window (as read through a pointer into the
+// flash) and run with interrupts off and the other core idled, since neither
+// can execute from flash while it is being changed.
+
+// Programs len bytes at dest, which need not be page aligned.  Each partial
+// page is padded with 0xff, which leaves the bytes around it untouched, so
+// the area must already be erased.  src may be anywhere, flash included.
+// With erase set, the sectors the area covers are erased first in the same
+// critical section, so nothing can run in between.
+void flashProgram(const void *dest, const void *src, size_t len, bool erase = false);
+
+// Erases the sectors in [dest, dest + len), which must be sector aligned
+void flashErase(const void *dest, size_t len);
@@ -0,0 +1,33 @@
+/*
+    LWIPMutex - Batches access to lwIP under a single lock acquisition
+
+    Copyright (c) 2024 Earle F. Philhower, III <earlephilhower@yahoo.com>
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#pragma once
+
+// Masks the Ethernet GPIO IRQs and holds the lwIP lock for as long as it
+// exists.  Every wrapped lwIP call takes one, so code making several calls in
+// a row can hold one around them all.  The nested ones on the same core then
+// just count up and down instead of doing the masking and locking again.
+// Don't wait on the network while holding one, the background processing
+// needs the lock to make progress.
+class LWIPMutex {
+public:
+    LWIPMutex();
+    ~LWIPMutex();
+};
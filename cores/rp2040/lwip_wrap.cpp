@@ -30,6 +30,7 @@
 #include <pico/mutex.h>
 #include <sys/lock.h>
 #include "_xoshiro.h"
+#include "LWIPMutex.h"
 
 extern void ethernet_arch_lwip_begin() __attribute__((weak));
 extern void ethernet_arch_lwip_end() __attribute__((weak));
@@ -38,44 +39,56 @@ extern void ethernet_arch_lwip_gpio_unmask() __attribute__((weak));
 
 auto_init_recursive_mutex(__lwipMutex); // Only for case with no Ethernet or PicoW, but still doing LWIP (PPP?)
 
-class LWIPMutex {
-public:
-    LWIPMutex() {
-        if (ethernet_arch_lwip_gpio_mask)  {
-            ethernet_arch_lwip_gpio_mask();
-        }
+// How many LWIPMutex are live on each core, only the outermost does any work
+static uint8_t __lwipDepth[NUM_CORES];
+
+LWIPMutex::LWIPMutex() {
+    uint core = get_core_num();
+    if (__lwipDepth[core]) {
+        __lwipDepth[core]++;
+        return;
+    }
+    if (ethernet_arch_lwip_gpio_mask)  {
+        ethernet_arch_lwip_gpio_mask();
+    }
 #if defined(ARDUINO_RASPBERRY_PI_PICO_W)
-        if (rp2040.isPicoW()) {
-            cyw43_arch_lwip_begin();
-            return;
-        }
+    if (rp2040.isPicoW()) {
+        cyw43_arch_lwip_begin();
+    } else {
 #endif
         if (ethernet_arch_lwip_begin) {
             ethernet_arch_lwip_begin();
         } else {
             recursive_mutex_enter_blocking(&__lwipMutex);
         }
+#if defined(ARDUINO_RASPBERRY_PI_PICO_W)
     }
+#endif
+    // Only count once the lock's held, so an IRQ in between still takes it
+    __lwipDepth[core]++;
+}
 
-    ~LWIPMutex() {
+LWIPMutex::~LWIPMutex() {
+    if (--__lwipDepth[get_core_num()]) {
+        return;
+    }
 #if defined(ARDUINO_RASPBERRY_PI_PICO_W)
-        if (rp2040.isPicoW()) {
-            cyw43_arch_lwip_end();
-        } else {
+    if (rp2040.isPicoW()) {
+        cyw43_arch_lwip_end();
+    } else {
 #endif
-            if (ethernet_arch_lwip_end) {
-                ethernet_arch_lwip_end();
-            } else {
-                recursive_mutex_exit(&__lwipMutex);
-            }
-#if defined(ARDUINO_RASPBERRY_PI_PICO_W)
+        if (ethernet_arch_lwip_end) {
+            ethernet_arch_lwip_end();
+        } else {
+            recursive_mutex_exit(&__lwipMutex);
         }
+#if defined(ARDUINO_RASPBERRY_PI_PICO_W)
+    }
 #endif
-        if (ethernet_arch_lwip_gpio_unmask) {
-            ethernet_arch_lwip_gpio_unmask();
-        }
+    if (ethernet_arch_lwip_gpio_unmask) {
+        ethernet_arch_lwip_gpio_unmask();
     }
-};
+}
 
 extern "C" {
 
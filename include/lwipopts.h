@@ -17,22 +17,63 @@ extern unsigned long __lwip_rand(void);
 // Common settings used in most of the pico_w examples
 // (see https://www.nongnu.org/lwip/2_1_x/group__lwip__opts.html for details)
 
+// Memory/throughput profiles.  The shipped libpicow archives are built with the
+// balanced one.  tools/libpico builds the others as separate archives, and a
+// sketch using one must be compiled with the same LWIP_PROFILE.  The RAM sizes
+// below are estimates from the pool sizes, see docs/iperf.rst.
+#define LWIP_PROFILE_BALANCED       0
+#define LWIP_PROFILE_LOWRAM         1
+#define LWIP_PROFILE_THROUGHPUT     2
+#define LWIP_PROFILE_CONNECTIONS    3
+
+#ifndef LWIP_PROFILE
+#define LWIP_PROFILE                LWIP_PROFILE_BALANCED
+#endif
+
+#if LWIP_PROFILE == LWIP_PROFILE_LOWRAM
+// A single connection or two with a small window, about 20KB
+#define MEM_SIZE                    6144
+#define PBUF_POOL_SIZE              8
+#define MEMP_NUM_TCP_SEG            16
+#define MEMP_NUM_TCP_PCB            4
+#define TCP_WND                     (2 * TCP_MSS)
+#define TCP_SND_BUF                 (2 * TCP_MSS)
+#elif LWIP_PROFILE == LWIP_PROFILE_THROUGHPUT
+// Twice the window of the balanced profile for bulk transfers, about 80KB
+#define MEM_SIZE                    32768
+#define PBUF_POOL_SIZE              32
+#define MEMP_NUM_TCP_SEG            64
+#define MEMP_NUM_TCP_PCB            5
+#define TCP_WND                     (16 * TCP_MSS)
+#define TCP_SND_BUF                 (16 * TCP_MSS)
+#elif LWIP_PROFILE == LWIP_PROFILE_CONNECTIONS
+// Servers with many small clients, smaller windows but more PCBs, about 65KB
+#define MEM_SIZE                    24576
+#define PBUF_POOL_SIZE              24
+#define MEMP_NUM_TCP_SEG            64
+#define MEMP_NUM_TCP_PCB            16
+#define TCP_WND                     (4 * TCP_MSS)
+#define TCP_SND_BUF                 (4 * TCP_MSS)
+#else
+#define MEM_SIZE                    16384
+#define PBUF_POOL_SIZE              24
+#define MEMP_NUM_TCP_SEG            32
+#define MEMP_NUM_TCP_PCB            5
+#define TCP_WND                     (8 * TCP_MSS)
+#define TCP_SND_BUF                 (8 * TCP_MSS)
+#endif
+
 #define NO_SYS                      1
 #define LWIP_SOCKET                 0
 #define MEM_LIBC_MALLOC             0
 
 #define MEM_ALIGNMENT               4
-#define MEM_SIZE                    16384
-#define MEMP_NUM_TCP_SEG            32
 #define MEMP_NUM_ARP_QUEUE          10
-#define PBUF_POOL_SIZE              24
 #define LWIP_ARP                    2
 #define LWIP_ETHERNET               1
 #define LWIP_ICMP                   1
 #define LWIP_RAW                    1
-#define TCP_WND                     (8 * TCP_MSS)
 #define TCP_MSS                     1460
-#define TCP_SND_BUF                 (8 * TCP_MSS)
 #define TCP_SND_QUEUELEN            ((4 * (TCP_SND_BUF) + (TCP_MSS - 1)) / (TCP_MSS))
 #define LWIP_NETIF_STATUS_CALLBACK  1
 #define LWIP_NETIF_LINK_CALLBACK    1
@@ -55,7 +96,11 @@ extern unsigned long __lwip_rand(void);
 #define LWIP_DHCP_DOES_ACD_CHECK    0
 
 // See #1285
+#if LWIP_PROFILE == LWIP_PROFILE_CONNECTIONS
+#define MEMP_NUM_UDP_PCB            12
+#else
 #define MEMP_NUM_UDP_PCB            6
+#endif
 
 #if LWIP_IPV6
 #define LWIP_IPV6_DHCP6             1
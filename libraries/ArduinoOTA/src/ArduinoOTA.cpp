@@ -40,6 +40,9 @@
 //#endif
 #define OTA_DEBUG Serial
 
+// Size of each of the two receive buffers
+#define OTA_CHUNK 4096
+
 ArduinoOTAClass::ArduinoOTAClass() {
 }
 
@@ -202,6 +205,9 @@ void ArduinoOTAClass::_onRx() {
         if (_md5.length() != 32) {
             return;
         }
+        // Newer uploaders add a second line, which older firmware never reads.  They
+        // stream without waiting for acknowledgements and can continue a broken upload
+        _resume = _udp_ota->getSize() && (readStringUntil('\n') == "resume");
 
         ota_ip = _ota_ip;
 
@@ -277,7 +283,7 @@ void ArduinoOTAClass::_runUpdate() {
         return;
     }
 
-    if (!Update.begin(_size, _cmd)) {
+    if (!(_resume ? Update.resume(_size, _md5.c_str(), _cmd) : Update.begin(_size, _cmd))) {
 #ifdef OTA_DEBUG
         OTA_DEBUG.println("Update Begin Error");
 #endif
@@ -296,7 +302,14 @@ void ArduinoOTAClass::_runUpdate() {
         return;
     }
 
-    _udp_ota->append("OK", 2);
+    uint32_t total = Update.progress();
+    if (_resume) {
+        char ok[16];
+        sprintf(ok, "OK %lu", total);
+        _udp_ota->append(ok, strlen(ok));
+    } else {
+        _udp_ota->append("OK", 2);
+    }
     _udp_ota->send(ota_ip, _ota_udp_port);
     delay(100);
 
@@ -306,7 +319,7 @@ void ArduinoOTAClass::_runUpdate() {
         _start_callback();
     }
     if (_progress_callback) {
-        _progress_callback(0, _size);
+        _progress_callback(total, _size);
     }
 
     WiFiClient client;
@@ -318,36 +331,77 @@ void ArduinoOTAClass::_runUpdate() {
         if (_error_callback) {
             _error_callback(OTA_CONNECT_ERROR);
         }
+        Update.end();
         _state = OTA_IDLE;
+        return;
     }
     // OTA sends little packets
     client.setNoDelay(true);
 
-    uint32_t written, total = 0;
-    while (!Update.isFinished() && (client.connected() || client.available())) {
-        int waited = 1000;
-        while (!client.available() && waited--) {
-            delay(1);
-        }
-        if (!waited) {
+    // Everything lwIP has queued is copied out before each chunk is programmed,
+    // first into the chunk being filled and, once that is full, into the spare.
+    // That reopens the TCP window so the host keeps sending while the flash is busy
+    uint8_t *rx = new uint8_t[2 * OTA_CHUNK];
+    if (!rx) {
 #ifdef OTA_DEBUG
-            OTA_DEBUG.printf("Receive Failed\n");
+        OTA_DEBUG.printf("Out of memory\n");
 #endif
-            _udp_ota->listen(IP_ADDR_ANY, _port);
-            if (_error_callback) {
-                _error_callback(OTA_RECEIVE_ERROR);
+        client.stop();
+        _udp_ota->listen(IP_ADDR_ANY, _port);
+        if (_error_callback) {
+            _error_callback(OTA_RECEIVE_ERROR);
+        }
+        Update.end();
+        _state = OTA_IDLE;
+        return;
+    }
+    size_t fill[2] = { 0, 0 };
+    int cur = 0;
+    size_t toRecv = _size - total;
+    uint32_t lastRx = millis();
+    while (toRecv || fill[cur]) {
+        for (int b : { cur, cur ^ 1 }) {
+            if ((b != cur) && (fill[cur] != OTA_CHUNK)) {
+                // Bytes must land in order, so the spare only fills behind a full chunk
+                break;
+            }
+            size_t n = std::min({ (size_t)client.available(), OTA_CHUNK - fill[b], toRecv });
+            if (n) {
+                n = client.read(rx + b * OTA_CHUNK + fill[b], n);
+                fill[b] += n;
+                toRecv -= n;
+                lastRx = millis();
+                if (!_resume) {
+                    // Older uploaders wait for a reply to every packet
+                    client.print(n, DEC);
+                }
             }
-            _state = OTA_IDLE;
         }
-        written = Update.write(client);
-        if (written > 0) {
-            client.print(written, DEC);
-            total += written;
+        if ((fill[cur] == OTA_CHUNK) || (fill[cur] && !toRecv)) {
+            if (Update.write(rx + cur * OTA_CHUNK, fill[cur]) != fill[cur]) {
+                break;
+            }
+            total += fill[cur];
+            fill[cur] = 0;
+            cur ^= 1;
             if (_progress_callback) {
                 _progress_callback(total, _size);
             }
+        } else if (!client.connected() && !client.available()) {
+            break;
+        } else if (millis() - lastRx > 1000) {
+#ifdef OTA_DEBUG
+            OTA_DEBUG.printf("Receive Failed\n");
+#endif
+            if (_error_callback) {
+                _error_callback(OTA_RECEIVE_ERROR);
+            }
+            break;
+        } else {
+            delay(1);
         }
     }
+    delete[] rx;
 
 
     if (Update.end()) {
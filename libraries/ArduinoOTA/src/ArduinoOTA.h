@@ -112,6 +112,7 @@ private:
     uint16_t _ota_udp_port = 0;
     IPAddress _ota_ip;
     String _md5;
+    bool _resume = false;
 
     THandlerFunction _start_callback = nullptr;
     THandlerFunction _end_callback = nullptr;
@@ -22,8 +22,9 @@
 
 #include <Arduino.h>
 #include "EEPROM.h"
-#include <hardware/flash.h>
-#include <hardware/sync.h>
+#include <Checksum.h>
+#include <FlashProgram.h>
+#include <algorithm>
 
 #ifdef USE_TINYUSB
 // For Serial when selecting TinyUSB.  Can't include in the core because Arduino IDE
@@ -35,12 +36,60 @@
 #endif
 
 extern "C" uint8_t _EEPROM_start;
+extern "C" uint8_t _FS_start;
+extern "C" uint8_t _FS_end;
+
+// Change log layout.  The log area is the EEPROM sector plus any sectors borrowed
+// from the top of the filesystem, used as a ring.  Every sector in use starts with
+// an EEPROMLogSector header.  A BASE sector holds the full image right after its
+// header, and following sectors of the same chain (seq+1, seq+2, ...) only hold
+// records.  commit() appends one record per changed range plus a commit marker, so
+// only the changed bytes get programmed.  When the chain needs the last free sector
+// a fresh BASE is written there instead, leaving the old chain behind as garbage
+// until it is reused.  With a single sector the BASE rewrite has to erase the live
+// sector, just like the plain whole-sector commit.
+#define EEPROM_SECTOR_SIZE 4096
+#define EEPROM_LOG_MAGIC   0x4c504545 // "EEPL"
+#define EEPROM_LOG_BASE    0x0001
+
+typedef struct {
+    uint32_t magic;
+    uint32_t seq;
+    uint16_t size;     // EEPROM size this chain was written with
+    uint16_t flags;
+    uint32_t crc;      // Over the header with crc = 0, plus the image in BASE sectors
+} EEPROMLogSector;
+
+typedef struct {
+    uint16_t offset;
+    uint16_t len;      // 0 marks the end of one commit()
+    uint32_t crc;      // Over offset, len, and data
+} EEPROMLogRecord;
+
+static_assert(sizeof(EEPROMLogSector) == 16, "EEPROMLogSector must be 16 bytes");
+static_assert(sizeof(EEPROMLogRecord) == 8, "EEPROMLogRecord must be 8 bytes");
+
+static inline uint32_t _align4(uint32_t x) {
+    return (x + 3) & ~3;
+}
+
+static uint32_t _headerCRC(const EEPROMLogSector *h, const uint8_t *image) {
+    EEPROMLogSector t = *h;
+    t.crc = 0;
+    uint32_t crc = checksumCRC32(0, &t, sizeof(t));
+    return image ? checksumCRC32(crc, image, h->size) : crc;
+}
+
+static uint32_t _recordCRC(const EEPROMLogRecord *r, const uint8_t *data) {
+    uint32_t crc = checksumCRC32(0, r, 4);
+    return checksumCRC32(crc, data, r->len);
+}
 
 EEPROMClass::EEPROMClass(void)
     : _sector(&_EEPROM_start) {
 }
 
-void EEPROMClass::begin(size_t size) {
+void EEPROMClass::begin(size_t size, size_t sectors) {
     if ((size <= 0) || (size > 4096)) {
         size = 4096;
     }
@@ -50,18 +99,122 @@ void EEPROMClass::begin(size_t size) {
     // In case begin() is called a 2nd+ time, don't reallocate if size is the same
     if (_data && size != _size) {
         delete[] _data;
+        delete[] _shadow;
         _data = new uint8_t[size];
+        _shadow = new uint8_t[size];
     } else if (!_data) {
         _data = new uint8_t[size];
+        _shadow = new uint8_t[size];
     }
 
     _size = size;
 
-    memcpy(_data, _sector, _size);
+    // Extra sectors come from the top of the filesystem, which must not be in use there
+    size_t avail = (&_FS_end == _sector) ? (&_FS_end - &_FS_start) / EEPROM_SECTOR_SIZE : 0;
+    if (sectors < 1) {
+        sectors = 1;
+    } else if (sectors - 1 > avail) {
+        DEBUGV("EEPROM: only %d sectors available for the log\n", avail + 1);
+        sectors = avail + 1;
+    }
+    _sectors = sectors;
+    _area = _sector - (_sectors - 1) * EEPROM_SECTOR_SIZE;
+
+    // Leave at least a page free for changes after the header and full image, or
+    // fall back to rewriting the whole sector on every commit
+    _log = sizeof(EEPROMLogSector) + _size + 256 <= EEPROM_SECTOR_SIZE;
+    if (_log) {
+        _scan();
+    } else {
+        memcpy(_data, _sector, _size);
+    }
+    memcpy(_shadow, _data, _size);
 
     _dirty = false; //make sure dirty is cleared in case begin() is called 2nd+ time
 }
 
+// Rebuild the image from the newest valid BASE sector and its chain of records
+void EEPROMClass::_scan() {
+    int base = -1;
+    for (int i = 0; i < _sectors; i++) {
+        const EEPROMLogSector *h = (const EEPROMLogSector *)_sectorAddr(i);
+        if ((h->magic != EEPROM_LOG_MAGIC) || !(h->flags & EEPROM_LOG_BASE) || (h->size > 4096) ||
+                (sizeof(EEPROMLogSector) + h->size > EEPROM_SECTOR_SIZE)) {
+            continue;
+        }
+        if ((base >= 0) && ((int32_t)(h->seq - _seq) <= 0)) {
+            continue;
+        }
+        if (h->crc == _headerCRC(h, (const uint8_t *)(h + 1))) {
+            base = i;
+            _seq = h->seq;
+        }
+    }
+    if (base < 0) {
+        // Never written in log format, so start from the plain EEPROM sector.  It stays
+        // intact until the first commit() has written a BASE elsewhere (if there is room).
+        memcpy(_data, _sector, _size);
+        _base = _tail = _sectors - 1;
+        _pos = EEPROM_SECTOR_SIZE;
+        _seq = 0;
+        _compact = true;
+        return;
+    }
+
+    const EEPROMLogSector *bh = (const EEPROMLogSector *)_sectorAddr(base);
+    const uint16_t chainSize = bh->size;
+    memset(_data, 0xff, _size);
+    memcpy(_data, bh + 1, std::min((size_t)chainSize, _size));
+    _compact = chainSize != _size;
+    _base = base;
+
+    int s = base;
+    uint32_t pos = _align4(sizeof(EEPROMLogSector) + chainSize);
+    while (true) {
+        const uint8_t *sec = _sectorAddr(s);
+        uint32_t group = pos;
+        while (pos + sizeof(EEPROMLogRecord) <= EEPROM_SECTOR_SIZE) {
+            const EEPROMLogRecord *r = (const EEPROMLogRecord *)(sec + pos);
+            if ((r->offset == 0xffff) && (r->len == 0xffff) && (r->crc == 0xffffffff)) {
+                break; // Erased, end of this sector's log
+            }
+            if ((r->offset + r->len > chainSize) || (pos + sizeof(EEPROMLogRecord) + _align4(r->len) > EEPROM_SECTOR_SIZE) ||
+                    (r->crc != _recordCRC(r, (const uint8_t *)(r + 1)))) {
+                DEBUGV("EEPROM: corrupt record at sector %d offset %lu\n", s, pos);
+                _compact = true;
+                break;
+            }
+            pos += sizeof(EEPROMLogRecord) + _align4(r->len);
+            if (!r->len) {
+                // Complete commit, apply it
+                for (uint32_t p = group; p < pos - sizeof(EEPROMLogRecord);) {
+                    const EEPROMLogRecord *a = (const EEPROMLogRecord *)(sec + p);
+                    if (a->offset < _size) {
+                        memcpy(_data + a->offset, a + 1, std::min((size_t)a->len, _size - a->offset));
+                    }
+                    p += sizeof(EEPROMLogRecord) + _align4(a->len);
+                }
+                group = pos;
+            }
+        }
+        if (group != pos) {
+            // Interrupted commit().  Its records are ignored, and can't be appended after.
+            _compact = true;
+        }
+        _tail = s;
+        _pos = pos;
+        int next = (s + 1) % _sectors;
+        const EEPROMLogSector *h = (const EEPROMLogSector *)_sectorAddr(next);
+        if (_compact || (next == base) || (h->magic != EEPROM_LOG_MAGIC) || (h->flags & EEPROM_LOG_BASE) ||
+                (h->seq != _seq + 1) || (h->size != chainSize) || (h->crc != _headerCRC(h, nullptr))) {
+            break;
+        }
+        s = next;
+        _seq++;
+        pos = sizeof(EEPROMLogSector);
+    }
+}
+
 bool EEPROMClass::end() {
     bool retval;
 
@@ -72,8 +225,10 @@ bool EEPROMClass::end() {
     retval = commit();
     if (_data) {
         delete[] _data;
+        delete[] _shadow;
     }
     _data = 0;
+    _shadow = 0;
     _size = 0;
     _dirty = false;
 
@@ -118,17 +273,109 @@ bool EEPROMClass::commit() {
         return false;
     }
 
-    noInterrupts();
-    rp2040.idleOtherCore();
-    flash_range_erase((intptr_t)_sector - (intptr_t)XIP_BASE, 4096);
-    flash_range_program((intptr_t)_sector - (intptr_t)XIP_BASE, _data, _size);
-    rp2040.resumeOtherCore();
-    interrupts();
+    if (_log) {
+        if (!_commitLog()) {
+            return false;
+        }
+    } else if (!_program(_sector, _data, _size, true)) {
+        return false;
+    }
+    memcpy(_shadow, _data, _size);
     _dirty = false;
 
     return true;
 }
 
+// Program len bytes at dest (in flash), optionally erasing its sector first.  Writes
+// that don't cover whole pages are padded with 0xff, which leaves existing bits alone.
+// Fails if the flash doesn't read back as written, as a worn out sector might.
+bool EEPROMClass::_program(const uint8_t *dest, const uint8_t *src, size_t len, bool erase) {
+    flashProgram(dest, src, len, erase);
+    return !memcmp(dest, src, len);
+}
+
+bool EEPROMClass::_commitLog() {
+    // Collect changed ranges, merging ones closer than a record header
+    uint8_t *buff = new uint8_t[EEPROM_SECTOR_SIZE];
+    if (!buff) {
+        return false;
+    }
+    uint32_t len = 0;
+    const uint32_t room = EEPROM_SECTOR_SIZE - sizeof(EEPROMLogSector) - sizeof(EEPROMLogRecord);
+    bool fits = true;
+    size_t i = 0;
+    while (fits && (i < _size)) {
+        if (_data[i] == _shadow[i]) {
+            i++;
+            continue;
+        }
+        size_t end = i + 1;
+        for (size_t j = end; (j < _size) && (j - end < sizeof(EEPROMLogRecord)); j++) {
+            if (_data[j] != _shadow[j]) {
+                end = j + 1;
+            }
+        }
+        EEPROMLogRecord r = { (uint16_t)i, (uint16_t)(end - i), 0 };
+        if (len + sizeof(r) + _align4(r.len) > room) {
+            fits = false;
+            break;
+        }
+        r.crc = _recordCRC(&r, _data + i);
+        memcpy(buff + len, &r, sizeof(r));
+        memset(buff + len + sizeof(r), 0xff, _align4(r.len));
+        memcpy(buff + len + sizeof(r), _data + i, r.len);
+        len += sizeof(r) + _align4(r.len);
+        i = end;
+    }
+    if (!len && fits) {
+        delete[] buff;
+        return true; // Dirty, but nothing actually changed
+    }
+    EEPROMLogRecord marker = { 0, 0, 0 };
+    marker.crc = _recordCRC(&marker, nullptr);
+    memcpy(buff + len, &marker, sizeof(marker));
+    len += sizeof(marker);
+
+    int chain = (_tail - _base + _sectors) % _sectors + 1;
+    int next = (_tail + 1) % _sectors;
+    bool ok;
+    if (fits && !_compact && (_pos + len <= EEPROM_SECTOR_SIZE)) {
+        ok = _program(_sectorAddr(_tail) + _pos, buff, len, false);
+        _pos += len;
+    } else if (fits && !_compact && (chain < _sectors - 1)) {
+        // Continue the chain in a freshly erased sector
+        EEPROMLogSector h = { EEPROM_LOG_MAGIC, _seq + 1, (uint16_t)_size, 0, 0 };
+        h.crc = _headerCRC(&h, nullptr);
+        memmove(buff + sizeof(h), buff, len);
+        memcpy(buff, &h, sizeof(h));
+        len += sizeof(h);
+        ok = _program(_sectorAddr(next), buff, len, true);
+        _tail = next;
+        _pos = len;
+        _seq++;
+    } else {
+        // Compact into a new BASE.  With more than one sector the old chain stays
+        // valid until this one is completely written.
+        EEPROMLogSector h = { EEPROM_LOG_MAGIC, _seq + 1, (uint16_t)_size, EEPROM_LOG_BASE, 0 };
+        h.crc = _headerCRC(&h, _data);
+        memcpy(buff, &h, sizeof(h));
+        memcpy(buff + sizeof(h), _data, _size);
+        len = _align4(sizeof(h) + _size);
+        ok = _program(_sectorAddr(next), buff, len, true);
+        _base = _tail = next;
+        _pos = len;
+        _seq++;
+        _compact = false;
+    }
+    if (!ok) {
+        // Mounting stops at the bad record, so anything after it would be lost.
+        // Start over with a new BASE next time.
+        _compact = true;
+    }
+    delete[] buff;
+    return ok;
+}
+
 uint8_t * EEPROMClass::getDataPtr() {
     _dirty = true;
     return &_data[0];
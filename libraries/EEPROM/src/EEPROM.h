@@ -29,7 +29,8 @@ class EEPROMClass {
 public:
     EEPROMClass(void);
 
-    void begin(size_t size);
+    // sectors > 1 extends the change log down into the top of the filesystem region
+    void begin(size_t size, size_t sectors = 1);
     uint8_t read(int const address);
     void write(int const address, uint8_t const val);
     bool commit();
@@ -77,10 +78,28 @@ public:
     }
 
 protected:
+    void _scan();
+    bool _commitLog();
+    bool _program(const uint8_t *dest, const uint8_t *src, size_t len, bool erase);
+    const uint8_t *_sectorAddr(int idx) const {
+        return _area + idx * 4096;
+    }
+
     uint8_t* _sector;
     uint8_t* _data = nullptr;
     size_t _size = 0;
     bool _dirty = false;
+
+    // Change log state, see EEPROM.cpp
+    uint8_t* _shadow = nullptr;  // Image as currently persisted in flash
+    const uint8_t* _area = nullptr;
+    int _sectors = 1;
+    int _base = 0;               // Sector holding the latest full image
+    int _tail = 0;               // Sector receiving new records
+    uint32_t _pos = 0;           // Next free byte in _tail
+    uint32_t _seq = 0;           // Sequence number of _tail
+    bool _log = false;           // False when the image is too large for a log, use whole-sector rewrites
+    bool _compact = false;       // Next commit must write a fresh full image
 };
 
 extern EEPROMClass EEPROM;
@@ -0,0 +1,109 @@
+// Sequential and random I/O benchmark for FatFS on the onboard flash
+// Compares the FTL with and without the write-back sector cache, and raw mode
+// Released to the public domain
+//
+// WARNING:  The filesystem will be formatted for each test!
+
+#include <FatFS.h>
+
+// How large of a file to test
+#define TESTSIZEKB 256
+// Number of random 512-byte operations
+#define RANDOMOPS 256
+
+static uint8_t data[4096];
+
+const char *rate(unsigned long start, unsigned long stop, unsigned long bytes) {
+  static char buff[64];
+  if (stop == start) {
+    strcpy_P(buff, PSTR("Inf b/s"));
+  } else {
+    unsigned long delta = stop - start;
+    float r = 1000.0 * (float)bytes / (float)delta;
+    if (r >= 1000000.0) {
+      sprintf_P(buff, PSTR("%0.2f MB/s"), r / 1000000.0);
+    } else if (r >= 1000.0) {
+      sprintf_P(buff, PSTR("%0.2f KB/s"), r / 1000.0);
+    } else {
+      sprintf_P(buff, PSTR("%d bytes/s"), (int)r);
+    }
+  }
+  return buff;
+}
+
+void DoTest(const char *label, FatFSConfig cfg) {
+  Serial.printf("\n=== %s ===\n", label);
+  FatFS.end();
+  FatFS.setConfig(cfg);
+  if (!FatFS.format() || !FatFS.begin()) {
+    Serial.printf("Unable to format/begin, skipping\n");
+    return;
+  }
+
+  unsigned long start = millis();
+  File f = FatFS.open("/seq.bin", "w");
+  for (int i = 0; i < TESTSIZEKB / 4; i++) {
+    f.write(data, sizeof(data));
+  }
+  f.close();
+  unsigned long stop = millis();
+  Serial.printf("Sequential write, 4K blocks:  %s\n", rate(start, stop, TESTSIZEKB * 1024));
+
+  start = millis();
+  f = FatFS.open("/seq.bin", "r");
+  for (int i = 0; i < TESTSIZEKB / 4; i++) {
+    f.read(data, sizeof(data));
+  }
+  f.close();
+  stop = millis();
+  Serial.printf("Sequential read, 4K blocks:   %s\n", rate(start, stop, TESTSIZEKB * 1024));
+
+  randomSeed(1);
+  start = millis();
+  f = FatFS.open("/seq.bin", "r+");
+  for (int i = 0; i < RANDOMOPS; i++) {
+    f.seek(random(TESTSIZEKB * 2) * 512);
+    f.write(data, 512);
+  }
+  f.close();
+  stop = millis();
+  Serial.printf("Random write, 512B:           %s\n", rate(start, stop, RANDOMOPS * 512));
+
+  start = millis();
+  f = FatFS.open("/seq.bin", "r");
+  for (int i = 0; i < RANDOMOPS; i++) {
+    f.seek(random(TESTSIZEKB * 2) * 512);
+    f.read(data, 512);
+  }
+  f.close();
+  stop = millis();
+  Serial.printf("Random read, 512B:            %s\n", rate(start, stop, RANDOMOPS * 512));
+
+  // Many small files hammer the FAT and directory sectors, which is where the cache helps
+  start = millis();
+  for (int i = 0; i < 32; i++) {
+    char name[16];
+    sprintf(name, "/small%d.txt", i);
+    f = FatFS.open(name, "w");
+    f.write(data, 100);
+    f.close();
+  }
+  stop = millis();
+  Serial.printf("Create 32 small files:        %lu ms\n", stop - start);
+  FatFS.end();
+}
+
+void setup() {
+  Serial.begin(115200);
+  delay(5000);
+  for (size_t i = 0; i < sizeof(data); i++) {
+    data[i] = (uint8_t)i;
+  }
+  DoTest("FTL, no cache", FatFSConfig().setUseFTL(true).setCacheSectors(0));
+  DoTest("FTL, 8 sector cache", FatFSConfig().setUseFTL(true).setCacheSectors(8));
+  DoTest("Raw, no cache", FatFSConfig().setUseFTL(false).setCacheSectors(0));
+  DoTest("Raw, 4 sector cache", FatFSConfig().setUseFTL(false).setCacheSectors(4));
+}
+
+void loop() {
+}
@@ -24,6 +24,9 @@
 */
 #include "FatFS.h"
 #include <FS.h>
+#include <FlashProgram.h>
+#include <algorithm>
+#include <hardware/flash.h>
 //#define FTL_DEBUG 1
 #include "../lib/SPIFTL/FlashInterfaceRP2040.h"
 #include "../lib/SPIFTL/SPIFTL.h"
@@ -38,18 +41,22 @@ extern uint8_t _FS_end;
 FS FatFS = FS(FSImplPtr(new fatfs::FatFSImpl()));
 static FlashInterfaceRP2040 *_fi = new FlashInterfaceRP2040(&_FS_start, &_FS_end);
 static SPIFTL *_ftl = nullptr;
+static FlashDevice *_dev = nullptr;
 uint16_t _sectorSize = 512;
 #endif
 
 namespace fatfs {
 
 
-bool FatFSImpl::begin() {
-    if (_mounted) {
-        return true;
+bool FatFSImpl::_setupStorage() {
+    // Write back anything cached with the old sector size/FTL mode before switching
+    disk_cache_setup(0);
+    _dev = _cfg._dev;
+    if (_dev && (_dev->eraseSize() > 4096)) {
+        DEBUGV("FatFS: flash device erase size %lu unsupported\n", _dev->eraseSize());
+        return false;
     }
-
-    if (_cfg._useFTL) {
+    if (_cfg._useFTL && !_dev) {
         if (!_ftl) {
             _ftl = new SPIFTL(_fi);
         }
@@ -61,6 +68,17 @@ bool FatFSImpl::begin() {
             _ftl = nullptr;
         }
     }
+    disk_cache_setup(_cfg._cacheSectors < 0 ? (_cfg._useFTL && !_dev ? 4 : 2) : _cfg._cacheSectors);
+    return true;
+}
+
+bool FatFSImpl::begin() {
+    if (_mounted) {
+        return true;
+    }
+    if (!_setupStorage()) {
+        return false;
+    }
 
     _mounted = (FR_OK == f_mount(&_fatfs, "", 1));
     if (!_mounted && _cfg._autoFormat) {
@@ -184,7 +202,7 @@ DirImplPtr FatFSImpl::openDir(const char* path) {
 }
 
 bool FatFSImpl::format() {
-    if (_mounted) {
+    if (_mounted || !_setupStorage()) {
         return false;
     }
     BYTE *work = new BYTE[4096]; /* Work area (larger is better for processing time) */
@@ -219,27 +237,193 @@ DSTATUS disk_initialize(BYTE p) {
     return 0;
 }
 
+// Raw (non-FTL) writes erase and program this many 4K sectors per interrupt
+// disabled window.  A whole run is still handled in one pass, but each sector
+// in a window adds an erase and 16 page programs (around 55ms) with the other
+// core stopped, so only raise it if that latency is acceptable.
+#ifndef FATFS_RAW_BATCH_SECTORS
+#define FATFS_RAW_BATCH_SECTORS 1
+#endif
+
+static bool _flashRead(LBA_t sect, BYTE *buff, UINT count) {
+    if (_dev) {
+        return _dev->read(sect * _sectorSize, buff, count * _sectorSize);
+    } else if (_ftl) {
+        // SPIFTL maps every LBA independently, so there's no contiguous run to exploit
+        for (unsigned int i = 0; i < count; i++) {
+            _ftl->read(sect + i, buff + i * _sectorSize);
+        }
+    } else {
+        // Raw mode is a 1:1 map of XIP flash, so any run is one memcpy
+        memcpy(buff, &_FS_start + sect * _sectorSize, count * _sectorSize);
+    }
+    return true;
+}
+
+static bool _flashWrite(LBA_t sect, const BYTE *buff, UINT count) {
+    if (_dev) {
+        // External flash doesn't share the XIP bus, so the whole run goes out without stopping the other core
+        return _dev->erase(sect * _sectorSize, count * _sectorSize) && _dev->program(sect * _sectorSize, buff, count * _sectorSize);
+    } else if (_ftl) {
+        for (unsigned int i = 0; i < count; i++) {
+            _ftl->write(sect + i, buff + i * _sectorSize);
+        }
+        return true;
+    }
+    while (count) {
+        uint32_t off = (uint32_t)(&_FS_start - (uint8_t *)XIP_BASE) + sect * _sectorSize;
+        // Stop each window at a FATFS_RAW_BATCH_SECTORS boundary
+        UINT n = (FATFS_RAW_BATCH_SECTORS * 4096 - (off % (FATFS_RAW_BATCH_SECTORS * 4096))) / _sectorSize;
+        n = std::min(n, count);
+        // Stages buff a page at a time, so it may be in flash itself
+        flashProgram(&_FS_start + sect * _sectorSize, buff, n * _sectorSize, true);
+        sect += n;
+        buff += n * _sectorSize;
+        count -= n;
+    }
+    return true;
+}
+
+// Small LRU write-back cache between FatFS and the flash.  FAT and directory
+// sectors are rewritten many times during a single file operation, so holding
+// them in RAM until the next CTRL_SYNC (or eviction) coalesces the updates into
+// a single flash write.
+typedef struct {
+    LBA_t    lba;
+    uint32_t lastUse;
+    bool     valid;
+    bool     dirty;
+} FatFSCacheEntry;
+
+static FatFSCacheEntry *_cache = nullptr;
+static uint8_t *_cacheData = nullptr;
+static unsigned int _cacheCount = 0;
+static uint32_t _cacheClock = 0;
+
+static uint8_t *_cacheBuff(unsigned int idx) {
+    return _cacheData + idx * _sectorSize;
+}
+
+static int _cacheFind(LBA_t lba) {
+    for (unsigned int i = 0; i < _cacheCount; i++) {
+        if (_cache[i].valid && (_cache[i].lba == lba)) {
+            _cache[i].lastUse = ++_cacheClock;
+            return i;
+        }
+    }
+    return -1;
+}
+
+// Write back all dirty entries in ascending LBA order
+static void _cacheFlush() {
+    while (true) {
+        int first = -1;
+        for (unsigned int i = 0; i < _cacheCount; i++) {
+            if (_cache[i].dirty && ((first < 0) || (_cache[i].lba < _cache[first].lba))) {
+                first = i;
+            }
+        }
+        if (first < 0) {
+            return;
+        }
+        _flashWrite(_cache[first].lba, _cacheBuff(first), 1);
+        _cache[first].dirty = false;
+    }
+}
+
+// Get an entry for the LBA, evicting (and writing back) the least recently used one if needed
+static int _cacheAlloc(LBA_t lba) {
+    int victim = 0;
+    for (unsigned int i = 0; i < _cacheCount; i++) {
+        if (!_cache[i].valid) {
+            victim = i;
+            break;
+        }
+        if (_cache[i].lastUse < _cache[victim].lastUse) {
+            victim = i;
+        }
+    }
+    if (_cache[victim].valid && _cache[victim].dirty) {
+        _flashWrite(_cache[victim].lba, _cacheBuff(victim), 1);
+    }
+    _cache[victim].lba = lba;
+    _cache[victim].valid = true;
+    _cache[victim].dirty = false;
+    _cache[victim].lastUse = ++_cacheClock;
+    return victim;
+}
+
+static void _cacheInvalidate(LBA_t sect, UINT count) {
+    for (unsigned int i = 0; i < _cacheCount; i++) {
+        if (_cache[i].valid && (_cache[i].lba >= sect) && (_cache[i].lba < sect + count)) {
+            _cache[i].valid = false;
+            _cache[i].dirty = false;
+        }
+    }
+}
+
+void disk_cache_setup(unsigned int sectors) {
+    if (_cache) {
+        _cacheFlush();
+        free(_cache);
+        free(_cacheData);
+        _cache = nullptr;
+        _cacheData = nullptr;
+    }
+    _cacheCount = 0;
+    if (sectors) {
+        _cache = (FatFSCacheEntry *)calloc(sectors, sizeof(FatFSCacheEntry));
+        _cacheData = (uint8_t *)malloc(sectors * _sectorSize);
+        if (!_cache || !_cacheData) {
+            DEBUGV("FatFS: unable to allocate %u sector cache\n", sectors);
+            free(_cache);
+            free(_cacheData);
+            _cache = nullptr;
+            _cacheData = nullptr;
+            return;
+        }
+        _cacheCount = sectors;
+    }
+}
+
 DRESULT disk_read(BYTE p, BYTE *buff, LBA_t sect, UINT count) {
     (void) p;
-    for (unsigned int i = 0; i < count; i++) {
-        if (_ftl) {
-            _ftl->read(sect + i, buff + i * _sectorSize);
-        } else {
-            _fi->read(sect + i, 0, buff, _sectorSize);
+    // Serve hits from the cache, and read each run of misses from flash in one go
+    UINT i = 0;
+    while (i < count) {
+        int idx = _cacheFind(sect + i);
+        if (idx >= 0) {
+            memcpy(buff + i * _sectorSize, _cacheBuff(idx), _sectorSize);
+            i++;
+            continue;
+        }
+        UINT run = 1;
+        while ((i + run < count) && (_cacheFind(sect + i + run) < 0)) {
+            run++;
         }
+        if (!_flashRead(sect + i, buff + i * _sectorSize, run)) {
+            return RES_ERROR;
+        }
+        i += run;
     }
     return RES_OK;
 }
 
 DRESULT disk_write(BYTE pdrv, const BYTE* buff, LBA_t sector, UINT count) {
     (void) pdrv;
+    if (!_cacheCount || (count > std::max(1U, _cacheCount / 2))) {
+        // Bulk data (or no cache), send it straight to flash and don't flush the hot FAT/dir sectors out of cache.
+        // Single sectors, which is how FatFS updates the FAT and directories, are always cached.
+        _cacheInvalidate(sector, count);
+        return _flashWrite(sector, buff, count) ? RES_OK : RES_ERROR;
+    }
     for (unsigned int i = 0; i < count; i++) {
-        if (_ftl) {
-            _ftl->write(sector + i, buff + i * _sectorSize);
-        } else {
-            _fi->eraseBlock(sector + i);
-            _fi->program(sector + i, 0, buff + i * _sectorSize, _sectorSize);
+        int idx = _cacheFind(sector + i);
+        if (idx < 0) {
+            idx = _cacheAlloc(sector + i);
         }
+        memcpy(_cacheBuff(idx), buff + i * _sectorSize, _sectorSize);
+        _cache[idx].dirty = true;
     }
     return RES_OK;
 }
@@ -248,13 +432,19 @@ DRESULT disk_ioctl(BYTE pdrv, BYTE cmd, void* buff) {
     (void) pdrv;
     switch (cmd) {
     case CTRL_SYNC:
+        _cacheFlush();
         if (_ftl) {
             _ftl->persist();
         }
+        if (_dev && !_dev->sync()) {
+            return RES_ERROR;
+        }
         return RES_OK;
     case GET_SECTOR_COUNT: {
         LBA_t *p = (LBA_t *)buff;
-        if (_ftl) {
+        if (_dev) {
+            *p = _dev->size() / _sectorSize;
+        } else if (_ftl) {
             *p = _ftl->lbaCount();
         } else {
             *p = _fi->size() / 4096;
@@ -273,8 +463,11 @@ DRESULT disk_ioctl(BYTE pdrv, BYTE cmd, void* buff) {
     }
     case CTRL_TRIM: {
         LBA_t *lba = (LBA_t *)buff;
+        _cacheInvalidate(lba[0], lba[1] - lba[0]);
         for (unsigned int i = lba[0]; i < lba[1]; i++) {
-            if (_ftl) {
+            if (_dev) {
+                _dev->erase(i * _sectorSize, _sectorSize);
+            } else if (_ftl) {
                 _ftl->trim(i);
             } else {
                 _fi->eraseBlock(i);
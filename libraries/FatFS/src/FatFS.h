@@ -29,6 +29,7 @@
 #include <assert.h>
 #include "FS.h"
 #include "FSImpl.h"
+#include <FlashDevice.h>
 #include "./ff.h"
 #include "./diskio.h"
 #include <FS.h>
@@ -60,9 +61,24 @@ public:
         return *this;
     }
 
+    // Number of sectors held in the LRU write-back cache, -1 for the default (4 with FTL, 2 otherwise)
+    FatFSConfig setCacheSectors(int sectors) {
+        _cacheSectors = sectors;
+        return *this;
+    }
+
+    // Store the filesystem on an external flash device instead of the onboard region.
+    // The FTL only covers onboard flash, so the device is used with raw 4K sectors.
+    FatFSConfig setFlashDevice(FlashDevice *dev) {
+        _dev = dev;
+        return *this;
+    }
+
     bool _useFTL;
     uint16_t _dirEntries;
     uint8_t _fatCopies;
+    int16_t _cacheSectors = -1;
+    FlashDevice *_dev = nullptr;
 };
 
 class FatFSImpl : public FSImpl {
@@ -175,16 +191,17 @@ protected:
         return &_fatfs;
     }
 
+    // Selects the FTL, raw, or device backend and sector size from the config
+    bool _setupStorage();
+
     static int _getFlags(OpenMode openMode, AccessMode accessMode) {
         int mode = 0;
-        if (openMode & OM_CREATE) {
-            mode |= FA_CREATE_ALWAYS;
-        }
         if (openMode & OM_APPEND) {
             mode |= FA_OPEN_APPEND;
-        }
-        if (openMode & OM_TRUNCATE) {
-            mode |= 0; // TODO - no truncate?
+        } else if ((openMode & OM_CREATE) && (openMode & OM_TRUNCATE)) {
+            mode |= FA_CREATE_ALWAYS;
+        } else if (openMode & OM_CREATE) {
+            mode |= FA_OPEN_ALWAYS;
         }
         if ((accessMode & (AM_READ | AM_WRITE)) == (AM_READ | AM_WRITE)) {
             mode |= FA_READ | FA_WRITE;
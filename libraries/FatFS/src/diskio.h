@@ -33,6 +33,7 @@ DSTATUS disk_status(BYTE pdrv);
 DRESULT disk_read(BYTE pdrv, BYTE* buff, LBA_t sector, UINT count);
 DRESULT disk_write(BYTE pdrv, const BYTE* buff, LBA_t sector, UINT count);
 DRESULT disk_ioctl(BYTE pdrv, BYTE cmd, void* buff);
+void disk_cache_setup(unsigned int sectors); /* (Re)size the write-back sector cache, 0 to disable */
 
 
 /* Disk Status Bits (DSTATUS) */
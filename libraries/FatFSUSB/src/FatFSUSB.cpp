@@ -20,6 +20,7 @@
 #include "FatFSUSB.h"
 #include <FatFS.h>
 #include <class/msc/msc.h>
+#include <algorithm>
 
 FatFSUSBClass FatFSUSB;
 
@@ -59,15 +60,57 @@ bool FatFSUSBClass::begin() {
     fatfs::WORD ss;
     fatfs::disk_ioctl(0, GET_SECTOR_SIZE, &ss);
     _sectSize = ss;
-    _sectBuff = new uint8_t[_sectSize];
-    _sectNum = -1;
+    _bufSects = std::max(1, std::min(32, FATFSUSB_BUFFER_SIZE / (int)_sectSize));
+    _buff = new uint8_t[_bufSects * _sectSize];
+    _bufBase = -1;
+    _valid = 0;
+    _dirty = 0;
+    _nextRead = 0;
     return true;
 }
 
 void FatFSUSBClass::end() {
     if (_started) {
+        _flush();
         _started = false;
-        delete[] _sectBuff;
+        delete[] _buff;
+        _buff = nullptr;
+    }
+}
+
+// Write back each run of dirty sectors in the window with a single disk_write
+void FatFSUSBClass::_flush() {
+    int i = 0;
+    while (_dirty && (i < _bufSects)) {
+        if (!(_dirty & (1UL << i))) {
+            i++;
+            continue;
+        }
+        int n = 1;
+        while ((i + n < _bufSects) && (_dirty & (1UL << (i + n)))) {
+            n++;
+        }
+        fatfs::disk_write(0, _buff + i * _sectSize, _bufBase + i, n);
+        _dirty &= ~(((1ULL << n) - 1) << i);
+        i += n;
+    }
+}
+
+// Move the window over the LBA (writing back the old one if needed), returns the index in the window
+int FatFSUSBClass::_window(uint32_t lba) {
+    int32_t base = lba - (lba % _bufSects);
+    if (base != _bufBase) {
+        _flush();
+        _bufBase = base;
+        _valid = 0;
+    }
+    return lba - base;
+}
+
+void FatFSUSBClass::sync() {
+    if (_started && _dirty) {
+        _flush();
+        fatfs::disk_ioctl(0, CTRL_SYNC, nullptr);
     }
 }
 
@@ -91,6 +134,8 @@ extern "C" void tud_msc_inquiry_cb(uint8_t lun, uint8_t vendor_id[8], uint8_t pr
 }
 
 bool FatFSUSBClass::testUnitReady() {
+    // Hosts poll this when idle, so it's a good time to push out deferred writes
+    sync();
     bool ret = _started;
     if (_driveReady) {
         ret &= _driveReady(_driveReadyData);
@@ -136,13 +181,22 @@ int32_t FatFSUSBClass::read10(uint32_t lba, uint32_t offset, void* buffer, uint3
 
     assert(offset + bufsize <= _sectSize);
 
-    if (_sectNum >= 0) {
-        // Flush the temp data out, we need to use the space
-        fatfs::disk_write(0, _sectBuff, _sectNum, 1);
-        _sectNum = -1;
+    int idx = _window(lba);
+    if (!(_valid & (1UL << idx))) {
+        int n = 1;
+        if (lba == _nextRead) {
+            // Sequential access, so read ahead to the end of the window in one go
+            while ((idx + n < _bufSects) && !(_valid & (1UL << (idx + n))) && (lba + n < _hddsects)) {
+                n++;
+            }
+        }
+        fatfs::disk_read(0, _buff + idx * _sectSize, lba, n);
+        _valid |= ((1ULL << n) - 1) << idx;
+    }
+    memcpy(buffer, _buff + idx * _sectSize + offset, bufsize);
+    if (offset + bufsize >= _sectSize) {
+        _nextRead = lba + 1;
     }
-    fatfs::disk_read(0, _sectBuff, lba, 1);
-    memcpy(buffer, _sectBuff + offset, bufsize);
     return bufsize;
 }
 
@@ -169,27 +223,19 @@ int32_t FatFSUSBClass::write10(uint32_t lba, uint32_t offset, uint8_t* buffer, u
 
     assert(offset + bufsize <= _sectSize);
 
-    if ((offset == 0) && (bufsize == _sectSize)) {
-        fatfs::disk_write(0, buffer, lba, 1);
-        return _sectSize;
+    int idx = _window(lba);
+    uint8_t *sect = _buff + idx * _sectSize;
+    if (!(_valid & (1UL << idx)) && ((offset != 0) || (bufsize != _sectSize))) {
+        // Partial update of a sector we don't have yet
+        fatfs::disk_read(0, sect, lba, 1);
     }
+    memcpy(sect + offset, buffer, bufsize);
+    _valid |= 1UL << idx;
+    _dirty |= 1UL << idx;
 
-    if ((int)_sectNum == (int)lba) {
-        memcpy(_sectBuff + offset, buffer, bufsize);
-    } else {
-        if (_sectNum >= 0) {
-            // Need to flush old sector out
-            fatfs::disk_write(0, _sectBuff, _sectNum, 1);
-        }
-        fatfs::disk_read(0, _sectBuff, lba, 1);
-        memcpy(_sectBuff + offset, buffer, bufsize);
-        _sectNum = lba;
-    }
-
-    if (offset + bufsize >= _sectSize) {
-        // We've filled up a sector, write it out!
-        fatfs::disk_write(0, _sectBuff, lba, 1);
-        _sectNum = -1;
+    if (_dirty == (uint32_t)((1ULL << _bufSects) - 1)) {
+        // The whole window has been rewritten, send it to flash as one block
+        _flush();
     }
     return bufsize;
 }
@@ -202,6 +248,7 @@ extern "C" bool tud_msc_set_sense(uint8_t lun, uint8_t sense_key, uint8_t add_se
 extern "C" int32_t tud_msc_scsi_cb(uint8_t lun, uint8_t const scsi_cmd[16], void* buffer, uint16_t bufsize) {
     const int SCSI_CMD_PREVENT_ALLOW_MEDIUM_REMOVAL = 0x1E;
     const int SCSI_CMD_START_STOP_UNIT              = 0x1B;
+    const int SCSI_CMD_SYNCHRONIZE_CACHE10          = 0x35;
     const int SCSI_SENSE_ILLEGAL_REQUEST = 0x05;
 
     void const* response = NULL;
@@ -227,6 +274,11 @@ extern "C" int32_t tud_msc_scsi_cb(uint8_t lun, uint8_t const scsi_cmd[16], void
         }
         resplen = 0;
         break;
+    case SCSI_CMD_SYNCHRONIZE_CACHE10:
+        // Host wants everything written so far on stable storage
+        FatFSUSB.sync();
+        resplen = 0;
+        break;
     default:
         // Set Sense = Invalid Command Operation
         tud_msc_set_sense(lun, SCSI_SENSE_ILLEGAL_REQUEST, 0x20, 0x00);
@@ -251,19 +303,26 @@ extern "C" int32_t tud_msc_scsi_cb(uint8_t lun, uint8_t const scsi_cmd[16], void
     return resplen;
 }
 
+// Write back and forget the window, the sketch may change the FS while it's unplugged
+void FatFSUSBClass::_discard() {
+    _flush();
+    _valid = 0;
+    _bufBase = -1;
+    _nextRead = -1;
+}
+
 void FatFSUSBClass::plug() {
-    if (_started && _cbPlug) {
-        _cbPlug(_cbPlugData);
+    if (_started) {
+        _discard();
+        if (_cbPlug) {
+            _cbPlug(_cbPlugData);
+        }
     }
 }
 
 void FatFSUSBClass::unplug() {
     if (_started) {
-        if (_sectNum >= 0) {
-            // Flush the temp data out
-            fatfs::disk_write(0, _sectBuff, _sectNum, 1);
-            _sectNum = -1;
-        }
+        _discard();
         fatfs::disk_ioctl(0, CTRL_SYNC, nullptr);
         if (_cbUnplug) {
             _cbUnplug(_cbUnplugData);
@@ -21,6 +21,13 @@
 
 #include <Arduino.h>
 
+// Size of the RAM window used for read-ahead and write-back of sectors.  Rounded
+// to whole sectors, at most 32 of them.  A multiple of the 4K flash erase size
+// lets sequential host writes reach the flash as whole erase blocks.
+#ifndef FATFSUSB_BUFFER_SIZE
+#define FATFSUSB_BUFFER_SIZE 8192
+#endif
+
 class FatFSUSBClass {
 public:
     FatFSUSBClass();
@@ -39,13 +46,22 @@ public:
     int32_t write10(uint32_t lba, uint32_t offset, uint8_t* buffer, uint32_t bufsize);
     void plug();;
     void unplug();
+    void sync();
 
 private:
     bool _started = false;
 
-    int32_t _sectNum = -1;
-    uint8_t *_sectBuff = nullptr;
+    // Window of _bufSects consecutive sectors starting at _bufBase, with per-sector valid/dirty bits
+    int _window(uint32_t lba);
+    void _flush();
+    void _discard();
+    uint8_t *_buff = nullptr;
     uint16_t _sectSize = 0;
+    uint8_t _bufSects = 0;
+    int32_t _bufBase = -1;
+    uint32_t _valid = 0;
+    uint32_t _dirty = 0;
+    uint32_t _nextRead = 0; // LBA following the last fully read sector, to detect sequential reads
 
     void (*_cbPlug)(uint32_t) = nullptr;
     uint32_t _cbPlugData = 0;
@@ -0,0 +1,73 @@
+// Released to the public domain
+//
+// Core 1 samples the ADC at 1kHz into a FlashLog, while core 0 moves the
+// buffered records into flash and every few seconds prints the samples taken
+// during the last 100 milliseconds.
+//
+// Select Tools->Flash Size->(some size with a FS/filesystem).  The filesystem
+// region is used as the log, so any LittleFS contents will be lost!
+
+#include <FlashLog.h>
+
+FlashLog flog;
+
+typedef struct {
+  uint16_t adc;
+  uint16_t seq;
+} Sample;
+
+volatile bool ready = false;
+
+void setup() {
+  Serial.begin(115200);
+  delay(5000);
+  if (!flog.begin()) {
+    Serial.println("Unable to start the log, is there a filesystem region?");
+    while (true) {
+      delay(1000);
+    }
+  }
+  Serial.printf("Log holds %lu records from earlier runs\n", flog.records());
+  ready = true;
+}
+
+void loop() {
+  static uint32_t last = 0;
+  // Only whole pages are programmed, so this is cheap to call often
+  flog.service();
+  if (millis() - last > 5000) {
+    last = millis();
+    flog.flush();
+    uint64_t now = time_us_64();
+    uint32_t sum = 0;
+    size_t n = flog.query(now - 100000, now, [&sum](uint64_t time, uint32_t record, const uint8_t *data, size_t len) {
+      (void) time;
+      (void) record;
+      Sample s;
+      if (len == sizeof(s)) {
+        memcpy(&s, data, sizeof(s));
+        sum += s.adc;
+      }
+      return true;
+    });
+    Serial.printf("%lu records, %lu dropped, last 100ms: %u samples averaging %lu\n", flog.records(), flog.dropped(), n, n ? sum / n : 0);
+  }
+}
+
+void setup1() {
+  while (!ready) {
+    delay(1);
+  }
+}
+
+void loop1() {
+  static uint16_t seq = 0;
+  static uint32_t next = micros();
+  Sample s = { (uint16_t)analogRead(A0), seq++ };
+  // Returns immediately, a full FIFO only counts a dropped record
+  flog.append(&s, sizeof(s));
+  next += 1000;
+  while ((int32_t)(micros() - next) < 0) {
+    /* Wait for the next sample time */
+  }
+}
@@ -0,0 +1,505 @@
+/*
+    FlashLog.cpp - Append-only circular record log in flash
+    Copyright (c) 2024 Earle F. Philhower, III.  All rights reserved.
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include "FlashLog.h"
+#include <Checksum.h>
+#include <FlashProgram.h>
+#include <CoreMutex.h>
+#include <hardware/flash.h>
+#include <hardware/sync.h>
+#include <algorithm>
+
+#ifdef USE_TINYUSB
+// For Serial when selecting TinyUSB.  Can't include in the core because Arduino IDE
+// will not link in libraries called from the core.  Instead, add the header to all
+// the standard libraries in the hope it will still catch some user cases where they
+// use these libraries.
+// See https://github.com/earlephilhower/arduino-pico/issues/167#issuecomment-848622174
+#include <Adafruit_TinyUSB.h>
+#endif
+
+extern "C" uint8_t _FS_start;
+extern "C" uint8_t _FS_end;
+
+// Log layout.  Sectors are written in ring order and each starts with a
+// FlashLogSector header whose sequence number is one more than the previous
+// sector's.  Records follow back to back, 4-byte aligned, and a record that does
+// not fit in the rest of a sector starts the next one instead, leaving 0xff behind
+// it.  A record length of 0xffff (erased flash) or a bad CRC ends a sector.
+// Records only store the low 32 bits of their time, the full time is rebuilt
+// from the sector header's time of the first record.  A record more than 2^32us
+// after the one before it always starts a new sector.
+#define FLASHLOG_SECTOR_SIZE 4096
+#define FLASHLOG_MAGIC       0x474f4c46 // "FLOG"
+
+typedef struct {
+    uint32_t magic;
+    uint32_t seq;
+    uint64_t time;     // Time of the first record
+    uint32_t record;   // Record number of the first record
+    uint32_t crc;      // Over the preceding 20 bytes
+} FlashLogSector;
+
+typedef struct {
+    uint16_t len;
+    uint16_t crc;      // Low half of the CRC32 of len, time, and the data
+    uint32_t time;
+} FlashLogRecord;
+
+static_assert(sizeof(FlashLogSector) == 24, "FlashLogSector must be 24 bytes");
+static_assert(sizeof(FlashLogRecord) == 8, "FlashLogRecord must be 8 bytes");
+
+static inline uint32_t _align4(uint32_t x) {
+    return (x + 3) & ~3;
+}
+
+static uint16_t _recordCRC(const FlashLogRecord *r, const void *data) {
+    uint32_t crc = checksumCRC32(0, &r->len, sizeof(r->len));
+    crc = checksumCRC32(crc, &r->time, sizeof(r->time));
+    return checksumCRC32(crc, data, r->len) & 0xffff;
+}
+
+static bool _blank(const uint8_t *p, size_t len) {
+    const uint32_t *w = (const uint32_t *)p;
+    for (size_t i = 0; i < len / 4; i++) {
+        if (w[i] != 0xffffffff) {
+            return false;
+        }
+    }
+    return true;
+}
+
+
+FlashLog::FlashLog() {
+    _start = nullptr;
+    _sectors = 0;
+    _fifo = nullptr;
+    _fifoSize = 0;
+    _fifoHead = 0;
+    _fifoTail = 0;
+    _dropped = 0;
+    mutex_init(&_mutex);
+}
+
+FlashLog::~FlashLog() {
+    end();
+}
+
+bool FlashLog::begin(size_t fifoSize, int eraseAhead) {
+    return begin(&_FS_start, &_FS_end - &_FS_start, fifoSize, eraseAhead);
+}
+
+bool FlashLog::begin(const uint8_t *start, size_t size, size_t fifoSize, int eraseAhead) {
+    end();
+    if (((intptr_t)start & (FLASHLOG_SECTOR_SIZE - 1)) || (size / FLASHLOG_SECTOR_SIZE < 3)) {
+        DEBUGV("FlashLog: Region must be 4K aligned and at least 3 sectors\n");
+        return false;
+    }
+    _start = start;
+    _sectors = size / FLASHLOG_SECTOR_SIZE;
+    _eraseAhead = std::max(0, std::min(eraseAhead, _sectors - 2));
+    // Room for the largest record plus the padding and header it could drag along,
+    // which after a long gap between records is most of a sector
+    for (_fifoSize = 8192; _fifoSize < fifoSize; _fifoSize <<= 1) {
+        /* Round up to a power of 2 */
+    }
+    _fifo = (uint8_t *)malloc(_fifoSize);
+    if (!_fifo) {
+        return false;
+    }
+    return _mount();
+}
+
+void FlashLog::end() {
+    if (!_fifo) {
+        return;
+    }
+    flush();
+    free(_fifo);
+    _fifo = nullptr;
+}
+
+bool FlashLog::format() {
+    if (!_fifo) {
+        return false;
+    }
+    {
+        CoreMutex m(&_mutex);
+        if (!m) {
+            return false;
+        }
+        for (int i = 0; i < _sectors; i++) {
+            if (!_erase(i)) {
+                return false;
+            }
+        }
+    }
+    return _mount();
+}
+
+bool FlashLog::_validSector(int sector, uint32_t *seq) const {
+    FlashLogSector h;
+    memcpy(&h, _sector(sector), sizeof(h));
+    if ((h.magic != FLASHLOG_MAGIC) || (h.crc != checksumCRC32(0, &h, 20))) {
+        return false;
+    }
+    *seq = h.seq;
+    return true;
+}
+
+bool FlashLog::_mount() {
+    _fifoHead = 0;
+    _fifoTail = 0;
+    _dropped = 0;
+    _erased = 0;
+    _wSector = 0;
+    _wOff = 0;
+    _wSeq = 0;
+    _wRecord = 0;
+    _wTime = 0;
+
+    // Newest sector has the highest sequence number
+    int newest = -1;
+    uint32_t seq;
+    for (int i = 0; i < _sectors; i++) {
+        if (_validSector(i, &seq) && ((newest < 0) || ((int32_t)(seq - _wSeq) > 0))) {
+            newest = i;
+            _wSeq = seq;
+        }
+    }
+    if (newest >= 0) {
+        // Find the end of its records
+        const uint8_t *p = _sector(newest);
+        FlashLogSector h;
+        memcpy(&h, p, sizeof(h));
+        _wTime = h.time;
+        _wRecord = h.record;
+        uint32_t pos = sizeof(h);
+        bool torn = false;
+        while (pos + sizeof(FlashLogRecord) <= FLASHLOG_SECTOR_SIZE) {
+            FlashLogRecord r;
+            memcpy(&r, p + pos, sizeof(r));
+            if (r.len == 0xffff) {
+                break;
+            }
+            uint32_t n = sizeof(r) + _align4(r.len);
+            if ((r.len > FLASHLOG_MAX_RECORD) || (pos + n > FLASHLOG_SECTOR_SIZE) || (r.crc != _recordCRC(&r, p + pos + sizeof(r)))) {
+                // Interrupted write, continue in a fresh sector
+                DEBUGV("FlashLog: Bad record at %d:%d\n", newest, (int)pos);
+                torn = true;
+                break;
+            }
+            _wTime += (uint32_t)(r.time - (uint32_t)_wTime);
+            _wRecord++;
+            pos += n;
+        }
+        if (torn) {
+            _wSector = (newest + 1) % _sectors;
+            _wSeq++;
+        } else {
+            _wSector = newest;
+            _wOff = pos;
+        }
+    }
+    _pSector = _wSector;
+    _pOff = _wOff;
+    if (_pOff == FLASHLOG_SECTOR_SIZE) {
+        // Exactly full, append() will start the next sector
+        _pSector = (_pSector + 1) % _sectors;
+        _pOff = 0;
+    }
+    return true;
+}
+
+bool FlashLog::_erase(int sector) {
+    // Skip sectors that are already blank to save erase cycles and time
+    if (_blank(_sector(sector), FLASHLOG_SECTOR_SIZE)) {
+        return true;
+    }
+    flashErase(_sector(sector), FLASHLOG_SECTOR_SIZE);
+    return true;
+}
+
+bool FlashLog::_program(uint32_t addr, const uint8_t *src, size_t len) {
+    flashProgram(_start + addr, src, len);
+    return true;
+}
+
+bool FlashLog::_enterSector() {
+    // The sector about to be written, then the erase-ahead window
+    if (_erased > 0) {
+        _erased--;
+    } else if (!_erase(_pSector)) {
+        return false;
+    }
+    while (_erased < _eraseAhead) {
+        if (!_erase((_pSector + 1 + _erased) % _sectors)) {
+            return false;
+        }
+        _erased++;
+    }
+    return true;
+}
+
+void FlashLog::_fifoWrite(uint32_t pos, const void *src, size_t len) {
+    if (!len) {
+        return;
+    }
+    uint32_t idx = pos & (_fifoSize - 1);
+    size_t n = std::min(len, (size_t)(_fifoSize - idx));
+    memcpy(_fifo + idx, src, n);
+    memcpy(_fifo, (const uint8_t *)src + n, len - n);
+}
+
+bool FlashLog::append(const void *data, size_t len, uint64_t time) {
+    if (!_fifo || (len > FLASHLOG_MAX_RECORD)) {
+        return false;
+    }
+    if (time < _wTime) {
+        time = _wTime; // Queries depend on time never going backwards
+    }
+    uint32_t rec = sizeof(FlashLogRecord) + _align4(len);
+    uint32_t off = _wOff;
+    int sector = _wSector;
+    uint32_t seq = _wSeq;
+    uint32_t pad = 0;
+    // Records keep 32 bits of time, so a longer gap needs a new sector header
+    if (off && ((off + rec > FLASHLOG_SECTOR_SIZE) || (time - _wTime > 0xffffffffULL))) {
+        pad = FLASHLOG_SECTOR_SIZE - off;
+        off = 0;
+        sector = (sector + 1) % _sectors;
+        seq++;
+    }
+    uint32_t head = _fifoHead;
+    uint32_t total = pad + (off ? 0 : sizeof(FlashLogSector)) + rec;
+    if (total > _fifoSize - (head - _fifoTail)) {
+        _dropped = _dropped + 1;
+        return false;
+    }
+
+    static const uint32_t ff[8] = { 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff };
+    while (pad) {
+        uint32_t n = std::min(pad, (uint32_t)sizeof(ff));
+        _fifoWrite(head, ff, n);
+        head += n;
+        pad -= n;
+    }
+    if (!off) {
+        FlashLogSector h = { FLASHLOG_MAGIC, seq, time, _wRecord, 0 };
+        h.crc = checksumCRC32(0, &h, 20);
+        _fifoWrite(head, &h, sizeof(h));
+        head += sizeof(h);
+        off = sizeof(h);
+    }
+    FlashLogRecord r = { (uint16_t)len, 0, (uint32_t)time };
+    r.crc = _recordCRC(&r, data);
+    _fifoWrite(head, &r, sizeof(r));
+    _fifoWrite(head + sizeof(r), data, len);
+    _fifoWrite(head + sizeof(r) + len, ff, _align4(len) - len);
+    head += rec;
+
+    // Data must be visible to the other core before the new head
+    __dmb();
+    _fifoHead = head;
+    _wSector = sector;
+    _wOff = off + rec;
+    _wSeq = seq;
+    _wRecord++;
+    _wTime = time;
+    return true;
+}
+
+bool FlashLog::service() {
+    return _drain(false);
+}
+
+bool FlashLog::flush() {
+    return _drain(true);
+}
+
+bool FlashLog::_drain(bool all) {
+    if (!_fifo) {
+        return false;
+    }
+    CoreMutex m(&_mutex);
+    if (!m) {
+        return false;
+    }
+    uint32_t buff[FLASH_PAGE_SIZE / 4];
+    uint8_t *page = (uint8_t *)buff;
+    uint32_t head = _fifoHead;
+    __dmb();
+    while (_fifoTail != head) {
+        // Never program past the end of the current page
+        uint32_t n = FLASH_PAGE_SIZE - (_pOff & (FLASH_PAGE_SIZE - 1));
+        uint32_t avail = head - _fifoTail;
+        if (avail < n) {
+            if (!all) {
+                break;
+            }
+            n = avail;
+        }
+        if ((_pOff == 0) && !_enterSector()) {
+            return false;
+        }
+        uint32_t idx = _fifoTail & (_fifoSize - 1);
+        uint32_t first = std::min(n, _fifoSize - idx);
+        memcpy(page, _fifo + idx, first);
+        memcpy(page + first, _fifo, n - first);
+        // Sector padding is already erased
+        if (!_blank(page, n) && !_program(_pSector * FLASHLOG_SECTOR_SIZE + _pOff, page, n)) {
+            return false;
+        }
+        _pOff += n;
+        if (_pOff == FLASHLOG_SECTOR_SIZE) {
+            _pOff = 0;
+            _pSector = (_pSector + 1) % _sectors;
+        }
+        __dmb();
+        _fifoTail = _fifoTail + n;
+    }
+    return true;
+}
+
+size_t FlashLog::query(uint64_t from, uint64_t to, Callback cb) {
+    if (!_fifo || (from > to)) {
+        return 0;
+    }
+    int oldest, count, lo;
+    uint32_t oldestSeq;
+    {
+        CoreMutex m(&_mutex);
+        if (!m) {
+            return 0;
+        }
+        // Walk back from the newest programmed sector while the sequence is unbroken
+        int newest = _pOff ? _pSector : (_pSector + _sectors - 1) % _sectors;
+        uint32_t seq, s;
+        if (!_validSector(newest, &seq)) {
+            return 0;
+        }
+        oldest = newest;
+        count = 1;
+        while (count < _sectors) {
+            int prev = (oldest + _sectors - 1) % _sectors;
+            if (!_validSector(prev, &s) || (s != seq - count)) {
+                break;
+            }
+            oldest = prev;
+            count++;
+        }
+        oldestSeq = seq - count + 1;
+
+        // Binary search for the last sector whose first record is not after from
+        lo = 0;
+        int hi = count - 1;
+        while (lo < hi) {
+            int mid = (lo + hi + 1) / 2;
+            FlashLogSector h;
+            memcpy(&h, _sector((oldest + mid) % _sectors), sizeof(h));
+            if (h.time <= from) {
+                lo = mid;
+            } else {
+                hi = mid - 1;
+            }
+        }
+    }
+
+    // Each match is copied out under the lock and cb runs without it, so a slow
+    // cb never holds up service().  A sector recycled in between is skipped.
+    uint8_t *data = new uint8_t[FLASHLOG_MAX_RECORD];
+    if (!data) {
+        return 0;
+    }
+    size_t found = 0;
+    bool done = false;
+    for (int i = lo; (i < count) && !done; i++) {
+        int sector = (oldest + i) % _sectors;
+        uint32_t pos = 0;
+        uint64_t t = 0;
+        uint32_t record = 0;
+        while (!done) {
+            size_t len = 0;
+            bool match = false;
+            {
+                CoreMutex m(&_mutex);
+                if (!m) {
+                    done = true;
+                    break;
+                }
+                uint32_t s;
+                if (!_validSector(sector, &s) || (s != oldestSeq + i)) {
+                    break;
+                }
+                const uint8_t *p = _sector(sector);
+                if (!pos) {
+                    FlashLogSector h;
+                    memcpy(&h, p, sizeof(h));
+                    if (h.time > to) {
+                        done = true;
+                        break;
+                    }
+                    t = h.time;
+                    record = h.record;
+                    pos = sizeof(h);
+                }
+                uint32_t end = ((sector == _pSector) && _pOff) ? _pOff : FLASHLOG_SECTOR_SIZE;
+                while (!match && (pos + sizeof(FlashLogRecord) <= end)) {
+                    FlashLogRecord r;
+                    memcpy(&r, p + pos, sizeof(r));
+                    uint32_t n = sizeof(r) + _align4(r.len);
+                    if ((r.len > FLASHLOG_MAX_RECORD) || (pos + n > end) || (r.crc != _recordCRC(&r, p + pos + sizeof(r)))) {
+                        break;
+                    }
+                    t += (uint32_t)(r.time - (uint32_t)t);
+                    if (t > to) {
+                        done = true;
+                        break;
+                    }
+                    if (t >= from) {
+                        memcpy(data, p + pos + sizeof(r), r.len);
+                        len = r.len;
+                        match = true;
+                    }
+                    record++;
+                    pos += n;
+                }
+            }
+            if (!match) {
+                break;
+            }
+            found++;
+            if (!cb(t, record - 1, data, len)) {
+                done = true;
+            }
+        }
+    }
+    delete[] data;
+    return found;
+}
+
+size_t FlashLog::exportTo(Print &out, uint64_t from, uint64_t to) {
+    return query(from, to, [&out](uint64_t time, uint32_t record, const uint8_t *data, size_t len) {
+        uint16_t l = len;
+        out.write((const uint8_t *)&time, sizeof(time));
+        out.write((const uint8_t *)&record, sizeof(record));
+        out.write((const uint8_t *)&l, sizeof(l));
+        return out.write(data, len) == len;
+    });
+}
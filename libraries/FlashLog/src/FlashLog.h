@@ -0,0 +1,122 @@
+/*
+    FlashLog.h - Append-only circular record log in flash
+    Copyright (c) 2024 Earle F. Philhower, III.  All rights reserved.
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#pragma once
+
+#include <Arduino.h>
+#include <pico/mutex.h>
+#include <functional>
+
+// Largest payload accepted by append()
+#define FLASHLOG_MAX_RECORD 1024
+
+// Timestamped records are formatted by append() into a RAM FIFO laid out exactly
+// like the flash, and service() programs that FIFO out a page at a time.  append()
+// never touches flash, so a producer (on either core) is only held up while the
+// flash itself is busy, once per page and once per sector erase, and never waits
+// on a filesystem.  Sectors are erased ahead of the write position, and when the
+// log wraps the oldest sectors are overwritten.
+class FlashLog {
+public:
+    FlashLog();
+    ~FlashLog();
+
+    // Use the filesystem flash region, which must then not be used by LittleFS or FatFS
+    bool begin(size_t fifoSize = 8192, int eraseAhead = 1);
+    // Use a 4K-aligned flash region of at least 3 sectors
+    bool begin(const uint8_t *start, size_t size, size_t fifoSize = 8192, int eraseAhead = 1);
+    // Flushes and frees the FIFO
+    void end();
+
+    // Erases every record
+    bool format();
+
+    // Queues a record, stamped with time_us_64() or a caller supplied, non-decreasing
+    // time.  Never blocks, returns false and counts a drop when the FIFO is full.
+    bool append(const void *data, size_t len) {
+        return append(data, len, time_us_64());
+    }
+    bool append(const void *data, size_t len, uint64_t time);
+
+    // Programs all completely filled pages from the FIFO, erasing ahead as needed.
+    // Call often, from the core that should take the flash stalls.
+    bool service();
+    // Also programs a trailing partial page, so everything appended is in flash
+    bool flush();
+
+    // Calls cb for every record in flash with from <= time <= to, oldest first,
+    // until cb returns false.  data is a copy that is only valid during the call,
+    // and cb runs without the log locked so it may append() or service().
+    // Returns the number of records passed to cb.
+    typedef std::function<bool(uint64_t time, uint32_t record, const uint8_t *data, size_t len)> Callback;
+    size_t query(uint64_t from, uint64_t to, Callback cb);
+    // Writes the same records as binary frames of uint64_t time, uint32_t record,
+    // uint16_t len (little endian) followed by the data
+    size_t exportTo(Print &out, uint64_t from, uint64_t to);
+
+    // Records lost to a full FIFO since begin()
+    uint32_t dropped() const {
+        return _dropped;
+    }
+    // Bytes waiting in the FIFO
+    size_t pending() const {
+        return _fifoHead - _fifoTail;
+    }
+    // Next record number to be assigned
+    uint32_t records() const {
+        return _wRecord;
+    }
+
+protected:
+    bool _mount();
+    bool _drain(bool all);
+    bool _enterSector();
+    bool _erase(int sector);
+    bool _program(uint32_t addr, const uint8_t *src, size_t len);
+    void _fifoWrite(uint32_t pos, const void *src, size_t len);
+    int _newest();
+    bool _validSector(int sector, uint32_t *seq) const;
+    const uint8_t *_sector(int sector) const {
+        return _start + sector * 4096;
+    }
+
+    const uint8_t *_start;
+    int       _sectors;
+    int       _eraseAhead;
+
+    // Producer side, the position append() formats the next record for
+    int       _wSector;
+    uint32_t  _wOff;
+    uint32_t  _wSeq;       // Sequence number of _wSector
+    uint32_t  _wRecord;
+    uint64_t  _wTime;
+
+    // Flash side, the position service() programs next
+    int       _pSector;
+    uint32_t  _pOff;
+    int       _erased;     // Sectors after _pSector known to be erased
+
+    uint8_t  *_fifo;
+    uint32_t  _fifoSize;   // Power of 2
+    volatile uint32_t _fifoHead;
+    volatile uint32_t _fifoTail;
+    volatile uint32_t _dropped;
+
+    mutex_t   _mutex;
+};
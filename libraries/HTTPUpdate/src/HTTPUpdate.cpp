@@ -152,20 +152,12 @@ String HTTPUpdate::getLastErrorString(void) {
 
 
 /**
-
+    add the headers a server side script can choose the image by,
+    sent again with every request
     @param http HTTPClient
     @param currentVersion const char
-    @return HTTPUpdateResult
 */
-HTTPUpdateResult HTTPUpdate::handleUpdate(HTTPClient& http, const String& currentVersion, bool spiffs) {
-
-    HTTPUpdateResult ret = HTTP_UPDATE_FAILED;
-
-    // use HTTP/1.0 for update since the update handler not support any transfer Encoding
-    http.useHTTP10(true);
-    http.setTimeout(_httpClientTimeout);
-    http.setFollowRedirects(_followRedirects);
-    http.setUserAgent(F("Pico-HTTP-Update"));
+void HTTPUpdate::addPicoHeaders(HTTPClient& http, const String& currentVersion, bool spiffs) {
     http.addHeader(F("x-Pico-Chip-ID"), String(rp2040.getChipID()));
     http.addHeader(F("x-Pico-STA-MAC"), WiFi.macAddress());
     http.addHeader(F("x-Pico-AP-MAC"), WiFi.softAPmacAddress());
@@ -179,6 +171,24 @@ HTTPUpdateResult HTTPUpdate::handleUpdate(HTTPClient& http, const String& curren
     if (currentVersion && currentVersion[0] != 0x00) {
         http.addHeader(F("x-Pico-Version"), currentVersion);
     }
+}
+
+/**
+
+    @param http HTTPClient
+    @param currentVersion const char
+    @return HTTPUpdateResult
+*/
+HTTPUpdateResult HTTPUpdate::handleUpdate(HTTPClient& http, const String& currentVersion, bool spiffs) {
+
+    HTTPUpdateResult ret = HTTP_UPDATE_FAILED;
+
+    // use HTTP/1.0 for update since the update handler not support any transfer Encoding
+    http.useHTTP10(true);
+    http.setTimeout(_httpClientTimeout);
+    http.setFollowRedirects(_followRedirects);
+    http.setUserAgent(F("Pico-HTTP-Update"));
+    addPicoHeaders(http, currentVersion, spiffs);
 
     if (_user != "" && _password != "") {
         http.setAuthorization(_user.c_str(), _password.c_str());
@@ -188,7 +198,7 @@ HTTPUpdateResult HTTPUpdate::handleUpdate(HTTPClient& http, const String& curren
         http.setAuthorization(_auth.c_str());
     }
 
-    const char * headerkeys[] = { "x-MD5" };
+    const char * headerkeys[] = { "x-MD5", "Content-Range" };
     size_t headerkeyssize = sizeof(headerkeys) / sizeof(char*);
 
     // track these headers
@@ -273,7 +283,14 @@ HTTPUpdateResult HTTPUpdate::handleUpdate(HTTPClient& http, const String& curren
                     DEBUG_HTTP_UPDATE("[httpUpdate] runUpdate flash...\n");
                 }
 
-                if (runUpdate(*tcp, len, md5, command)) {
+                bool ok;
+                if (!spiffs && _resumeRetries && (md5.length() == 32)) {
+                    ok = runResumableUpdate(http, len, md5, currentVersion);
+                } else {
+                    ok = runUpdate(*tcp, len, md5, command);
+                }
+
+                if (ok) {
                     ret = HTTP_UPDATE_OK;
                     DEBUG_HTTP_UPDATE("[httpUpdate] Update ok\n");
                     http.end();
@@ -383,6 +400,100 @@ bool HTTPUpdate::runUpdate(Stream& in, uint32_t size, const String& md5, int com
     return true;
 }
 
+/**
+    write Update to flash, keeping what's already there from an interrupted
+    download of the same image and fetching the rest with Range requests
+    @param http HTTPClient holding the response to the full GET
+    @param size uint32_t
+    @param md5 String
+    @param currentVersion const char
+    @return true if Update ok
+*/
+bool HTTPUpdate::runResumableUpdate(HTTPClient& http, uint32_t size, const String& md5, const String& currentVersion) {
+
+    StreamString error;
+
+    if (_cbProgress) {
+        Update.onProgress(_cbProgress);
+    }
+
+    WiFiClient * tcp = http.getStreamPtr();
+    for (int attempt = 0; ; attempt++) {
+        if (!Update.resume(size, md5.c_str())) {
+            _setLastError(Update.getError());
+            Update.printError(error);
+            error.trim(); // remove line ending
+            DEBUG_HTTP_UPDATE("[httpUpdate] Update.resume failed! (%s)\n", error.c_str());
+            return false;
+        }
+
+        uint32_t offset = Update.progress();
+        if (_cbProgress) {
+            _cbProgress(offset, size);
+        }
+        if (offset == size) {
+            break;
+        }
+
+        bool streaming = true;
+        if (attempt || offset) {
+            // The first response starts at 0, or has gone away
+            DEBUG_HTTP_UPDATE("[httpUpdate] requesting from %lu\n", offset);
+            if (tcp) {
+                tcp->stop();
+            }
+            addPicoHeaders(http, currentVersion, false);
+            http.addHeader(F("Range"), String(F("bytes=")) + String(offset) + "-");
+            int code = http.GET();
+            tcp = http.getStreamPtr();
+            if (code == HTTP_CODE_OK && tcp) {
+                if (offset) {
+                    // No Range support on the server, so start again
+                    DEBUG_HTTP_UPDATE("[httpUpdate] server ignored Range\n");
+                    Update.end();
+                    return runUpdate(*tcp, size, md5);
+                }
+            } else if (code != HTTP_CODE_PARTIAL_CONTENT || !tcp ||
+                       !http.header("Content-Range").startsWith(String(F("bytes ")) + String(offset) + "-")) {
+                _setLastError(code <= 0 ? code : HTTP_UE_SERVER_WRONG_HTTP_CODE);
+                DEBUG_HTTP_UPDATE("[httpUpdate] Range request failed (%d)\n", code);
+                streaming = false;
+            }
+        }
+
+        if (streaming) {
+            if (Update.writeStream(*tcp, _httpClientTimeout) == size - offset) {
+                break;
+            }
+            _setLastError(Update.getError());
+            Update.printError(error);
+            error.trim(); // remove line ending
+            DEBUG_HTTP_UPDATE("[httpUpdate] Update.writeStream failed! (%s)\n", error.c_str());
+        }
+
+        // Saves whatever made it to the filesystem, if writeStream() didn't already
+        Update.end();
+        if (attempt >= _resumeRetries) {
+            return false;
+        }
+        delay(1000);
+    }
+
+    if (_cbProgress) {
+        _cbProgress(size, size);
+    }
+
+    if (!Update.end()) {
+        _setLastError(Update.getError());
+        Update.printError(error);
+        error.trim(); // remove line ending
+        DEBUG_HTTP_UPDATE("[httpUpdate] Update.end failed! (%s)\n", error.c_str());
+        return false;
+    }
+
+    return true;
+}
+
 #if !defined(NO_GLOBAL_INSTANCES) && !defined(NO_GLOBAL_HTTPUPDATE)
 HTTPUpdate httpUpdate;
 #endif
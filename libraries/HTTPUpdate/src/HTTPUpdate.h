@@ -100,6 +100,16 @@ public:
         _md5Sum = md5Sum;
     }
 
+    /**
+        Sketch updates with a known MD5 keep what was downloaded when the connection
+        drops, and fetch the rest with an HTTP Range request up to this many times.
+        A later update() of the same image also continues where the last one stopped.
+        @param retries int, 0 to always download the whole image (default 3)
+    */
+    void setResumeRetries(int retries) {
+        _resumeRetries = retries;
+    }
+
     void setAuthorization(const String& user, const String& password);
     void setAuthorization(const String& auth);
 
@@ -132,6 +142,8 @@ public:
 protected:
     t_httpUpdate_return handleUpdate(HTTPClient& http, const String& currentVersion, bool spiffs = false);
     bool runUpdate(Stream& in, uint32_t size, const String& md5, int command = U_FLASH);
+    bool runResumableUpdate(HTTPClient& http, uint32_t size, const String& md5, const String& currentVersion);
+    void addPicoHeaders(HTTPClient& http, const String& currentVersion, bool spiffs);
 
     // Set the error and potentially use a CB to notify the application
     void _setLastError(int err) {
@@ -143,6 +155,7 @@ protected:
     int _lastError;
     bool _rebootOnUpdate = true;
     bool _closeConnectionsOnUpdate = true;
+    int _resumeRetries = 3;
     String _user;
     String _password;
     String _auth;
@@ -0,0 +1,46 @@
+/*
+    Sends a 10 second TCP test and then a 10 second, 20 Mbit/s UDP test to an
+    iperf2 server on a host, and prints the results on Serial.
+
+    On the host run:
+        iperf -s -i 1          (for the TCP test)
+        iperf -s -u -i 1       (for the UDP test, in another window)
+
+    Released to the public domain
+*/
+
+#include <WiFi.h>
+#include <Iperf.h>
+
+#ifndef STASSID
+#define STASSID "your-ssid"
+#define STAPSK "your-password"
+#endif
+
+const char* ssid = STASSID;
+const char* password = STAPSK;
+
+// The host running "iperf -s"
+IPAddress server(192, 168, 1, 10);
+
+Iperf iperf;
+
+void setup() {
+  Serial.begin(115200);
+  WiFi.mode(WIFI_STA);
+  WiFi.begin(ssid, password);
+  while (WiFi.status() != WL_CONNECTED) {
+    delay(500);
+    Serial.print(".");
+  }
+  Serial.println();
+}
+
+void loop() {
+  iperf.client(server, 10);
+  Serial.println();
+  delay(2000);
+  iperf.clientUDP(server, 20000000, 10);
+  Serial.println();
+  delay(10000);
+}
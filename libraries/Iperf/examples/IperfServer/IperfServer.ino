@@ -0,0 +1,47 @@
+/*
+    Waits for iperf2 tests from a host and prints the results on Serial.
+    Sending "u" switches to UDP tests and "t" back to TCP.
+
+    On the host run:
+        iperf -c <this board's IP> -i 1 -t 10              (TCP)
+        iperf -c <this board's IP> -u -b 10M -i 1 -t 10    (UDP)
+
+    Released to the public domain
+*/
+
+#include <WiFi.h>
+#include <Iperf.h>
+
+#ifndef STASSID
+#define STASSID "your-ssid"
+#define STAPSK "your-password"
+#endif
+
+const char* ssid = STASSID;
+const char* password = STAPSK;
+
+Iperf iperf;
+
+void setup() {
+  Serial.begin(115200);
+  WiFi.mode(WIFI_STA);
+  WiFi.begin(ssid, password);
+  while (WiFi.status() != WL_CONNECTED) {
+    delay(500);
+    Serial.print(".");
+  }
+  Serial.printf("\nConnected, IP address %s\n", WiFi.localIP().toString().c_str());
+  iperf.server();
+}
+
+void loop() {
+  iperf.handle();
+  if (Serial.available()) {
+    char c = Serial.read();
+    if (c == 'u') {
+      iperf.serverUDP();
+    } else if (c == 't') {
+      iperf.server();
+    }
+  }
+}
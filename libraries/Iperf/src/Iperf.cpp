@@ -0,0 +1,711 @@
+/*
+    Iperf - iperf2 compatible TCP and UDP throughput tests on the lwIP raw API
+    Copyright (c) 2024 Earle F. Philhower, III <earlephilhower@yahoo.com>
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include "Iperf.h"
+#include <LWIPMutex.h>
+#include <lwip/tcp.h>
+#include <lwip/udp.h>
+#include <lwip/netif.h>
+#include <lwip/def.h>
+#include <pico/time.h>
+#include <algorithm>
+
+// iperf2 puts this at the start of every UDP datagram, and the server echoes
+// it back followed by its report when the client sends a negative id to say
+// it's done.  Everything is in network order.  id2 holds the top of 64-bit
+// sequence numbers, which only iperf 2.0.10 and later send
+struct IperfUDPHeader {
+    int32_t id;
+    uint32_t sec;
+    uint32_t usec;
+    uint32_t id2;
+};
+
+struct IperfServerReport {
+    int32_t flags;
+    int32_t totalLen1;
+    int32_t totalLen2;
+    int32_t stopSec;
+    int32_t stopUsec;
+    int32_t errorCnt;
+    int32_t outOfOrderCnt;
+    int32_t datagrams;
+    int32_t jitterSec;
+    int32_t jitterUsec;
+};
+
+#define IPERF_HEADER_VERSION1 0x80000000
+
+// An iperf2 TCP client starts with a 24 byte header asking for extras like a
+// reverse test.  All zeros asks for none
+#define IPERF_CLIENT_HEADER 24
+
+// How long the idle loop is timed for with no test running
+#define IPERF_CALIBRATE_MS 100
+
+// The TCP client sends everything from this, and never changes it
+static uint8_t _pattern[TCP_MSS];
+
+// Only one test sends at a time, so the netif hook can find it
+static Iperf *_active = nullptr;
+static struct {
+    netif *nif;
+    netif_output_fn output;
+} _hooked[4];
+
+Iperf::Iperf() {
+    memset(&_res, 0, sizeof(_res));
+    _res.cpu = -1;
+}
+
+Iperf::~Iperf() {
+    stop();
+}
+
+// The same loop as _spin(), with nothing else going on
+void Iperf::_calibrate() {
+    _idle = 0;
+    _spin(time_us_64() + IPERF_CALIBRATE_MS * 1000);
+    _idlePerMs = _idle / IPERF_CALIBRATE_MS;
+    _idle = 0;
+}
+
+// Anything the network code does on this core in the background shows up as
+// fewer trips round this loop than when calibrated
+void Iperf::_spin(uint64_t untilUs) {
+    uint32_t n = 0;
+    while ((time_us_64() < untilUs) && (_state != FINISHED)) {
+        n++;
+    }
+    _idle += n;
+}
+
+void Iperf::_start() {
+    LWIPMutex m;
+    memset(&_res, 0, sizeof(_res));
+    _res.cpu = -1;
+    _startMs = millis();
+    _lastReportMs = _startMs;
+    _lastRxMs = _startMs;
+    _lastBytes = 0;
+    _lastRetransmits = 0;
+    _idle = 0;
+    _lastIdle = 0;
+    _lastId = -1;
+    _lastTransit = 0;
+    _jitterUs = 0;
+    _stopping = false;
+    _announced = false;
+}
+
+void Iperf::_report(bool final) {
+    uint32_t now = (_state == RUNNING) ? millis() : _startMs + _res.ms;
+    uint64_t bytes;
+    uint32_t retransmits;
+    {
+        LWIPMutex m;
+        bytes = _res.bytes;
+        retransmits = _res.retransmits;
+    }
+    uint32_t from = final ? _startMs : _lastReportMs;
+    uint32_t ms = now - from;
+    uint64_t b = bytes - (final ? 0 : _lastBytes);
+    uint64_t idle = _idle - (final ? 0 : _lastIdle);
+    uint32_t retr = retransmits - (final ? 0 : _lastRetransmits);
+    int cpu = -1;
+    if (_idlePerMs && ms) {
+        cpu = 100 - (int)(100 * idle / ((uint64_t)_idlePerMs * ms));
+        cpu = std::max(0, std::min(100, cpu));
+    }
+    if (!final) {
+        _lastReportMs = now;
+        _lastBytes = bytes;
+        _lastIdle = _idle;
+        _lastRetransmits = retransmits;
+    } else {
+        _res.cpu = cpu;
+    }
+    if (!_out || (!ms && !final)) {
+        return;
+    }
+    _out->printf("[  1] %5.2f-%5.2f sec  %7.2f MBytes  %7.2f Mbits/sec", (from - _startMs) / 1000.0, (now - _startMs) / 1000.0,
+                 b / 1048576.0, ms ? b * 8.0 / ms / 1000.0 : 0.0);
+    if (_mode == TCP_CLIENT) {
+        _out->printf("  %4lu retr", retr);
+    }
+    if (final && (_mode == UDP_SERVER)) {
+        uint32_t total = _res.packets + _res.lost;
+        _out->printf("  %6.3f ms %lu/%lu (%.2g%%)", _res.jitterMs, _res.lost, total, total ? 100.0 * _res.lost / total : 0.0);
+    }
+    if (cpu >= 0) {
+        _out->printf("  CPU %3d%%", cpu);
+    }
+    _out->printf("\n");
+}
+
+void Iperf::stop() {
+    LWIPMutex m;
+    _hook(false);
+    _closeTCP();
+    if (_listen) {
+        tcp_arg(_listen, nullptr);
+        tcp_accept(_listen, nullptr);
+        tcp_close(_listen);
+        _listen = nullptr;
+    }
+    if (_udp) {
+        udp_recv(_udp, nullptr, nullptr);
+        udp_remove(_udp);
+        _udp = nullptr;
+    }
+    if (_tx) {
+        pbuf_free(_tx);
+        _tx = nullptr;
+    }
+    _state = IDLE;
+    _mode = NONE;
+}
+
+void Iperf::handle() {
+    if ((_mode != TCP_SERVER) && (_mode != UDP_SERVER)) {
+        return;
+    }
+    if (_state == RUNNING) {
+        if (!_announced && _out) {
+            _out->printf("[  1] connected with %s\n", _peer.toString().c_str());
+            _announced = true;
+        }
+        // Return often enough for a UDP test that stops without saying so
+        uint32_t wait = _intervalMs ? _intervalMs - std::min(_intervalMs, (uint32_t)(millis() - _lastReportMs)) : 100;
+        _spin(time_us_64() + std::min(wait, (uint32_t)100) * 1000);
+        if ((_state == RUNNING) && _intervalMs && (millis() - _lastReportMs >= _intervalMs)) {
+            _report(false);
+        }
+        if ((_state == RUNNING) && (_mode == UDP_SERVER) && (millis() - _lastRxMs > 2000)) {
+            LWIPMutex m;
+            _res.ms = _lastRxMs - _startMs;
+            _state = FINISHED;
+        }
+    }
+    if (_state == FINISHED) {
+        if (_intervalMs) {
+            _report(false);
+        }
+        _report(true);
+        _state = LISTENING;
+    }
+}
+
+
+// ---- TCP ----
+
+bool Iperf::server(uint16_t port) {
+    stop();
+    _calibrate();
+    LWIPMutex m;
+    tcp_pcb *pcb = tcp_new();
+    if (!pcb) {
+        return false;
+    }
+    if (tcp_bind(pcb, IP_ANY_TYPE, port) != ERR_OK) {
+        tcp_close(pcb);
+        return false;
+    }
+    _listen = tcp_listen(pcb);
+    if (!_listen) {
+        tcp_close(pcb);
+        return false;
+    }
+    tcp_arg(_listen, this);
+    tcp_accept(_listen, &Iperf::_sAccept);
+    _mode = TCP_SERVER;
+    _state = LISTENING;
+    if (_out) {
+        _out->printf("Server listening on TCP port %u\n", port);
+    }
+    return true;
+}
+
+bool Iperf::client(IPAddress host, uint32_t seconds, uint16_t port) {
+    stop();
+    _calibrate();
+    if (!_pattern[0]) {
+        for (size_t i = 0; i < sizeof(_pattern); i++) {
+            _pattern[i] = '0' + (i % 10);
+        }
+    }
+    if (_out) {
+        _out->printf("Connecting to %s, TCP port %u\n", host.toString().c_str(), port);
+    }
+    _mode = TCP_CLIENT;
+    _connected = false;
+    {
+        LWIPMutex m;
+        _pcb = tcp_new();
+        if (!_pcb) {
+            return false;
+        }
+        tcp_arg(_pcb, this);
+        tcp_err(_pcb, &Iperf::_sErr);
+        tcp_recv(_pcb, &Iperf::_sRecv);
+        tcp_sent(_pcb, &Iperf::_sSent);
+        if (tcp_connect(_pcb, host, port, &Iperf::_sConnected) != ERR_OK) {
+            tcp_abort(_pcb);
+            _pcb = nullptr;
+            return false;
+        }
+    }
+    uint32_t t0 = millis();
+    while (!_connected && _pcb && (millis() - t0 < 5000)) {
+        delay(1);
+    }
+    if (!_connected) {
+        if (_out) {
+            _out->printf("Connect failed\n");
+        }
+        stop();
+        return false;
+    }
+
+    _start();
+    _peer = host;
+    _state = RUNNING;
+    {
+        LWIPMutex m;
+        _hook(true);
+        static const uint8_t header[IPERF_CLIENT_HEADER] = { 0 };
+        tcp_write(_pcb, header, sizeof(header), TCP_WRITE_FLAG_MORE);
+        _fill();
+    }
+    uint32_t end = _startMs + seconds * 1000;
+    while (_pcb && ((int32_t)(millis() - end) < 0)) {
+        uint32_t next = _intervalMs ? _lastReportMs + _intervalMs : end;
+        if ((int32_t)(next - end) > 0) {
+            next = end;
+        }
+        _spin(time_us_64() + (uint64_t)std::max((int32_t)(next - millis()), (int32_t)0) * 1000);
+        if (_intervalMs && ((int32_t)(millis() - end) < 0)) {
+            _report(false);
+        }
+    }
+    bool ok = _pcb != nullptr;
+    {
+        LWIPMutex m;
+        _stopping = true;
+        _res.ms = millis() - _startMs;
+        _hook(false);
+        _closeTCP();
+    }
+    _state = FINISHED;
+    if (_intervalMs) {
+        _report(false);
+    }
+    _report(true);
+    stop();
+    return ok;
+}
+
+// Keeps lwIP's send buffer full.  The same buffer is queued every time without
+// TCP_WRITE_FLAG_COPY, so lwIP only copies it when built to send each packet
+// from a single pbuf
+void Iperf::_fill() {
+    while (_pcb && !_stopping && (tcp_sndbuf(_pcb) >= TCP_MSS) && (tcp_sndqueuelen(_pcb) + 2 < TCP_SND_QUEUELEN)) {
+        if (tcp_write(_pcb, _pattern, TCP_MSS, TCP_WRITE_FLAG_MORE) != ERR_OK) {
+            break;
+        }
+    }
+    if (_pcb) {
+        tcp_output(_pcb);
+    }
+}
+
+// Returns ERR_ABRT if the pcb had to be aborted, for the lwIP callbacks
+err_t Iperf::_closeTCP() {
+    err_t err = ERR_OK;
+    if (_pcb) {
+        tcp_arg(_pcb, nullptr);
+        tcp_sent(_pcb, nullptr);
+        tcp_recv(_pcb, nullptr);
+        tcp_err(_pcb, nullptr);
+        if (tcp_close(_pcb) != ERR_OK) {
+            tcp_abort(_pcb);
+            err = ERR_ABRT;
+        }
+        _pcb = nullptr;
+    }
+    return err;
+}
+
+err_t Iperf::_sAccept(void *arg, tcp_pcb *pcb, err_t err) {
+    Iperf *me = (Iperf *)arg;
+    if (!me || !pcb || (err != ERR_OK)) {
+        return ERR_VAL;
+    }
+    // Until the last result's been reported
+    if (me->_state != LISTENING) {
+        tcp_abort(pcb);
+        return ERR_ABRT;
+    }
+    me->_start();
+    me->_pcb = pcb;
+    me->_peer = IPAddress(&pcb->remote_ip);
+    tcp_arg(pcb, me);
+    tcp_recv(pcb, &Iperf::_sRecv);
+    tcp_err(pcb, &Iperf::_sErr);
+    me->_state = RUNNING;
+    return ERR_OK;
+}
+
+err_t Iperf::_sConnected(void *arg, tcp_pcb *pcb, err_t err) {
+    Iperf *me = (Iperf *)arg;
+    if (me && (err == ERR_OK)) {
+        me->_maxSeq = pcb->snd_nxt;
+        me->_connected = true;
+    }
+    return ERR_OK;
+}
+
+err_t Iperf::_sRecv(void *arg, tcp_pcb *pcb, pbuf *p, err_t err) {
+    (void) err;
+    Iperf *me = (Iperf *)arg;
+    if (!p) {
+        // The other side is done, which ends the test early for the client
+        if (me) {
+            me->_res.ms = millis() - me->_startMs;
+            me->_state = FINISHED;
+            return me->_closeTCP();
+        }
+        return ERR_OK;
+    }
+    if (me && (me->_mode == TCP_SERVER)) {
+        me->_res.bytes += p->tot_len;
+    }
+    tcp_recved(pcb, p->tot_len);
+    pbuf_free(p);
+    return ERR_OK;
+}
+
+err_t Iperf::_sSent(void *arg, tcp_pcb *pcb, uint16_t len) {
+    (void) pcb;
+    Iperf *me = (Iperf *)arg;
+    if (me) {
+        me->_res.bytes += len;
+        me->_fill();
+    }
+    return ERR_OK;
+}
+
+// lwIP has already freed the pcb
+void Iperf::_sErr(void *arg, err_t err) {
+    (void) err;
+    Iperf *me = (Iperf *)arg;
+    if (me) {
+        me->_pcb = nullptr;
+        if (me->_state == RUNNING) {
+            me->_res.ms = millis() - me->_startMs;
+            me->_state = FINISHED;
+        }
+    }
+}
+
+// lwIP doesn't count retransmissions in this build, so every IPv4 packet goes
+// through here while a TCP client test runs, and any of the test's segments
+// starting before the highest sequence already sent is a repeat
+void Iperf::_hook(bool install) {
+    if (install && (_mode == TCP_CLIENT)) {
+        _active = this;
+        size_t i = 0;
+        netif *nif;
+        NETIF_FOREACH(nif) {
+            if (nif->output && (i < sizeof(_hooked) / sizeof(_hooked[0]))) {
+                _hooked[i].nif = nif;
+                _hooked[i].output = nif->output;
+                nif->output = &Iperf::_sOutput;
+                i++;
+            }
+        }
+    } else if (!install && (_active == this)) {
+        for (auto &h : _hooked) {
+            if (h.nif) {
+                h.nif->output = h.output;
+                h.nif = nullptr;
+            }
+        }
+        _active = nullptr;
+    }
+}
+
+err_t Iperf::_sOutput(netif *nif, pbuf *p, const ip4_addr_t *ipaddr) {
+    Iperf *me = _active;
+    const uint8_t *ip = (const uint8_t *)p->payload;
+    if (me && me->_pcb && (p->len >= 20) && ((ip[0] >> 4) == 4) && (ip[9] == IP_PROTO_TCP)) {
+        size_t ihl = (ip[0] & 15) * 4;
+        const uint8_t *tcp = ip + ihl;
+        if ((p->len >= ihl + 20) && (((tcp[0] << 8) | tcp[1]) == me->_pcb->local_port) &&
+                (((tcp[2] << 8) | tcp[3]) == me->_pcb->remote_port)) {
+            uint32_t seq = (tcp[4] << 24) | (tcp[5] << 16) | (tcp[6] << 8) | tcp[7];
+            size_t len = ((ip[2] << 8) | ip[3]) - ihl - (tcp[12] >> 4) * 4;
+            if (len) {
+                if ((int32_t)(seq - me->_maxSeq) < 0) {
+                    me->_res.retransmits++;
+                } else {
+                    me->_maxSeq = seq + len;
+                }
+            }
+        }
+    }
+    for (auto &h : _hooked) {
+        if (h.nif == nif) {
+            return h.output(nif, p, ipaddr);
+        }
+    }
+    return ERR_IF;
+}
+
+
+// ---- UDP ----
+
+bool Iperf::serverUDP(uint16_t port) {
+    stop();
+    _calibrate();
+    LWIPMutex m;
+    _udp = udp_new();
+    if (!_udp) {
+        return false;
+    }
+    if (udp_bind(_udp, IP_ANY_TYPE, port) != ERR_OK) {
+        udp_remove(_udp);
+        _udp = nullptr;
+        return false;
+    }
+    udp_recv(_udp, &Iperf::_sUdpRecv, this);
+    _mode = UDP_SERVER;
+    _state = LISTENING;
+    if (_out) {
+        _out->printf("Server listening on UDP port %u\n", port);
+    }
+    return true;
+}
+
+bool Iperf::clientUDP(IPAddress host, uint32_t bitsPerSec, uint32_t seconds, uint16_t port, size_t len) {
+    stop();
+    _calibrate();
+    len = std::max(len, sizeof(IperfUDPHeader) + IPERF_CLIENT_HEADER);
+    {
+        LWIPMutex m;
+        _udp = udp_new();
+        if (!_udp) {
+            return false;
+        }
+        udp_recv(_udp, &Iperf::_sUdpRecv, this);
+        if (udp_connect(_udp, host, port) != ERR_OK) {
+            stop();
+            return false;
+        }
+    }
+    if (_out) {
+        _out->printf("Sending %u byte datagrams to %s, UDP port %u, at %lu bits/sec\n", len, host.toString().c_str(), port, bitsPerSec);
+    }
+    _mode = UDP_CLIENT;
+    _peer = host;
+    _gotReport = false;
+    _start();
+    _state = RUNNING;
+
+    uint64_t gap = (uint64_t)len * 8 * 1000000 / std::max(bitsPerSec, (uint32_t)1);
+    uint64_t next = time_us_64();
+    uint32_t end = _startMs + seconds * 1000;
+    int32_t id = 0;
+    while ((int32_t)(millis() - end) < 0) {
+        if (time_us_64() >= next) {
+            if (_sendDatagram(id, len)) {
+                id++;
+                next += gap;
+            }
+        } else {
+            _spin(next);
+        }
+        if (_intervalMs && (millis() - _lastReportMs >= _intervalMs)) {
+            _report(false);
+        }
+    }
+    _res.ms = millis() - _startMs;
+    _state = FINISHED;
+    if (_intervalMs) {
+        _report(false);
+    }
+    _report(true);
+
+    // The server replies to the final datagram with its side of the story,
+    // which iperf tries 10 times to get
+    for (int i = 0; (i < 10) && !_gotReport; i++) {
+        _sendDatagram(-std::max(id, (int32_t)1), len);
+        uint32_t t0 = millis();
+        while (!_gotReport && (millis() - t0 < 250)) {
+            delay(1);
+        }
+    }
+    if (_out && _gotReport) {
+        _out->printf("Server report: %5.2f sec  %7.2f MBytes  %7.2f Mbits/sec  %6.3f ms %lu/%lu (%.2g%%)  %lu out of order\n",
+                     _reportMs / 1000.0, _reportBytes / 1048576.0, _reportMs ? _reportBytes * 8.0 / _reportMs / 1000.0 : 0.0,
+                     _res.jitterMs, _res.lost, _reportDatagrams, _reportDatagrams ? 100.0 * _res.lost / _reportDatagrams : 0.0,
+                     _res.outOfOrder);
+    } else if (_out) {
+        _out->printf("No report from the server for the last datagram\n");
+    }
+    stop();
+    return _gotReport;
+}
+
+// udp_send() only borrows the pbuf, so it's used again unless lwIP is still
+// holding it (waiting on ARP, say).  Only the header changes between sends
+bool Iperf::_sendDatagram(int32_t id, size_t len) {
+    LWIPMutex m;
+    if (!_tx) {
+        _tx = pbuf_alloc(PBUF_TRANSPORT, len, PBUF_RAM);
+        if (!_tx) {
+            return false;
+        }
+        memset(_tx->payload, 0, len);
+    }
+    uint64_t now = time_us_64();
+    IperfUDPHeader *h = (IperfUDPHeader *)_tx->payload;
+    h->id = lwip_htonl(id);
+    h->sec = lwip_htonl(now / 1000000);
+    h->usec = lwip_htonl(now % 1000000);
+    h->id2 = lwip_htonl(id < 0 ? 0xffffffff : 0);
+    err_t err = udp_send(_udp, _tx);
+    // The UDP, IP and link headers were added in front of the data, and stay
+    if (_tx->ref > 1) {
+        pbuf_free(_tx);
+        _tx = nullptr;
+    } else if (_tx->payload != h) {
+        pbuf_remove_header(_tx, (uint8_t *)h - (uint8_t *)_tx->payload);
+    }
+    if (err != ERR_OK) {
+        return false;
+    }
+    if (id >= 0) {
+        _res.packets++;
+        _res.bytes += len;
+    }
+    return true;
+}
+
+void Iperf::_sUdpRecv(void *arg, udp_pcb *pcb, pbuf *p, const ip_addr_t *addr, uint16_t port) {
+    (void) pcb;
+    Iperf *me = (Iperf *)arg;
+    if (me && (me->_mode == UDP_CLIENT)) {
+        me->_udpReport(p);
+    } else if (me) {
+        me->_udpRecv(p, addr, port);
+    }
+    pbuf_free(p);
+}
+
+void Iperf::_udpRecv(pbuf *p, const ip_addr_t *addr, uint16_t port) {
+    IperfUDPHeader h;
+    if (pbuf_copy_partial(p, &h, sizeof(h), 0) != sizeof(h)) {
+        return;
+    }
+    int32_t id = lwip_ntohl(h.id);
+    uint64_t now = time_us_64();
+    if ((_state == LISTENING) && (id >= 0)) {
+        _start();
+        _peer = IPAddress(addr);
+        _lastId = id - 1;
+        _state = RUNNING;
+    }
+    if (id >= 0) {
+        if (_state != RUNNING) {
+            return;
+        }
+        _lastRxMs = millis();
+        _res.packets++;
+        _res.bytes += p->tot_len;
+        // Counted as lost when skipped, then moved to out of order if it turns up
+        if (id > _lastId + 1) {
+            _res.lost += id - _lastId - 1;
+        } else if (id <= _lastId) {
+            _res.outOfOrder++;
+            if (_res.lost) {
+                _res.lost--;
+            }
+        }
+        _lastId = std::max(_lastId, id);
+        // RFC 1889 jitter, the clocks needn't agree since only changes in the
+        // transit time matter
+        int64_t transit = now - ((int64_t)lwip_ntohl(h.sec) * 1000000 + lwip_ntohl(h.usec));
+        if (_res.packets > 1) {
+            int64_t d = transit - _lastTransit;
+            _jitterUs += ((d < 0 ? -d : d) - _jitterUs) / 16;
+            _res.jitterMs = _jitterUs / 1000;
+        }
+        _lastTransit = transit;
+        return;
+    }
+
+    // The final datagram, which is repeated until a report gets back
+    if (_state == RUNNING) {
+        _res.ms = millis() - _startMs;
+        _state = FINISHED;
+    }
+    struct {
+        IperfUDPHeader h;
+        IperfServerReport r;
+    } reply;
+    memset(&reply, 0, sizeof(reply));
+    reply.h = h;
+    reply.r.flags = lwip_htonl(IPERF_HEADER_VERSION1);
+    reply.r.totalLen1 = lwip_htonl(_res.bytes >> 32);
+    reply.r.totalLen2 = lwip_htonl(_res.bytes & 0xffffffff);
+    reply.r.stopSec = lwip_htonl(_res.ms / 1000);
+    reply.r.stopUsec = lwip_htonl((_res.ms % 1000) * 1000);
+    reply.r.errorCnt = lwip_htonl(_res.lost);
+    reply.r.outOfOrderCnt = lwip_htonl(_res.outOfOrder);
+    reply.r.datagrams = lwip_htonl(_res.packets + _res.lost);
+    reply.r.jitterSec = lwip_htonl((uint32_t)_jitterUs / 1000000);
+    reply.r.jitterUsec = lwip_htonl((uint32_t)_jitterUs % 1000000);
+    pbuf *q = pbuf_alloc(PBUF_TRANSPORT, sizeof(reply), PBUF_RAM);
+    if (q) {
+        pbuf_take(q, &reply, sizeof(reply));
+        udp_sendto(_udp, q, addr, port);
+        pbuf_free(q);
+    }
+}
+
+void Iperf::_udpReport(pbuf *p) {
+    struct {
+        IperfUDPHeader h;
+        IperfServerReport r;
+    } reply;
+    if ((pbuf_copy_partial(p, &reply, sizeof(reply), 0) != sizeof(reply)) || !(lwip_ntohl(reply.r.flags) & IPERF_HEADER_VERSION1)) {
+        return;
+    }
+    if (_gotReport) {
+        return;
+    }
+    _res.lost = lwip_ntohl(reply.r.errorCnt);
+    _res.outOfOrder = lwip_ntohl(reply.r.outOfOrderCnt);
+    _res.jitterMs = lwip_ntohl(reply.r.jitterSec) * 1000.0f + lwip_ntohl(reply.r.jitterUsec) / 1000.0f;
+    _reportBytes = ((uint64_t)lwip_ntohl(reply.r.totalLen1) << 32) | lwip_ntohl(reply.r.totalLen2);
+    _reportMs = lwip_ntohl(reply.r.stopSec) * 1000 + lwip_ntohl(reply.r.stopUsec) / 1000;
+    _reportDatagrams = lwip_ntohl(reply.r.datagrams);
+    _gotReport = true;
+}
@@ -0,0 +1,144 @@
+/*
+    Iperf - iperf2 compatible TCP and UDP throughput tests on the lwIP raw API
+    Copyright (c) 2024 Earle F. Philhower, III <earlephilhower@yahoo.com>
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#pragma once
+
+#include <Arduino.h>
+#include <IPAddress.h>
+#include <lwip/err.h>
+#include <lwip/ip_addr.h>
+
+struct tcp_pcb;
+struct udp_pcb;
+struct pbuf;
+struct netif;
+
+#define IPERF_PORT 5001
+
+class Iperf {
+public:
+    // Totals for the last (or current) test
+    struct Result {
+        uint64_t bytes;       // Acknowledged (TCP client) or received
+        uint32_t ms;          // Length of the test
+        uint32_t retransmits; // TCP segments sent again (TCP client only)
+        uint32_t packets;     // UDP datagrams sent or received
+        uint32_t lost;        // UDP datagrams missing (UDP server, or the server's report)
+        uint32_t outOfOrder;  // UDP datagrams arriving late
+        float jitterMs;       // UDP arrival jitter (UDP server, or the server's report)
+        int cpu;              // Percent of this core busy outside loop(), -1 if unknown
+    };
+
+    Iperf();
+    ~Iperf();
+
+    // Where the reports go, nullptr for none
+    void setOutput(Print *out) {
+        _out = out;
+    }
+
+    // Milliseconds between interim reports, 0 for only the final one
+    void setInterval(uint32_t ms) {
+        _intervalMs = ms;
+    }
+
+    // Waits for "iperf -c <ip> [-u]" tests.  Call handle() from loop()
+    bool server(uint16_t port = IPERF_PORT);
+    bool serverUDP(uint16_t port = IPERF_PORT);
+
+    // Runs a test against "iperf -s [-u]", returning when it's done
+    bool client(IPAddress host, uint32_t seconds = 10, uint16_t port = IPERF_PORT);
+    bool clientUDP(IPAddress host, uint32_t bitsPerSec = 1000000, uint32_t seconds = 10, uint16_t port = IPERF_PORT,
+                   size_t len = 1470);
+
+    // While a server test is running this spins measuring idle time until the
+    // next report is due, otherwise it returns at once
+    void handle();
+
+    void stop();
+
+    bool running() {
+        return _state == RUNNING;
+    }
+
+    const Result &result() {
+        return _res;
+    }
+
+private:
+    enum State { IDLE, LISTENING, RUNNING, FINISHED };
+    enum Mode { NONE, TCP_SERVER, UDP_SERVER, TCP_CLIENT, UDP_CLIENT };
+
+    void _calibrate();
+    void _spin(uint64_t untilUs);
+    void _start();
+    void _report(bool final);
+    void _hook(bool install);
+    err_t _closeTCP();
+
+    // TCP
+    void _fill();
+    static err_t _sAccept(void *arg, tcp_pcb *pcb, err_t err);
+    static err_t _sConnected(void *arg, tcp_pcb *pcb, err_t err);
+    static err_t _sRecv(void *arg, tcp_pcb *pcb, pbuf *p, err_t err);
+    static err_t _sSent(void *arg, tcp_pcb *pcb, uint16_t len);
+    static void _sErr(void *arg, err_t err);
+    static err_t _sOutput(netif *nif, pbuf *p, const ip4_addr_t *ipaddr);
+
+    // UDP
+    bool _sendDatagram(int32_t id, size_t len);
+    void _udpRecv(pbuf *p, const ip_addr_t *addr, uint16_t port);
+    void _udpReport(pbuf *p);
+    static void _sUdpRecv(void *arg, udp_pcb *pcb, pbuf *p, const ip_addr_t *addr, uint16_t port);
+
+    Print *_out = &Serial;
+    uint32_t _intervalMs = 1000;
+
+    volatile State _state = IDLE;
+    Mode _mode = NONE;
+    tcp_pcb *_listen = nullptr;
+    tcp_pcb *_pcb = nullptr;
+    udp_pcb *_udp = nullptr;
+    pbuf *_tx = nullptr;      // UDP client datagram, reused once lwIP lets go of it
+    IPAddress _peer;
+    bool _announced = false;
+
+    // Updated from the lwIP callbacks, read under LWIPMutex
+    Result _res;
+    uint32_t _startMs = 0;
+    volatile bool _connected = false;
+    volatile bool _stopping = false;
+    volatile bool _gotReport = false;
+    uint64_t _reportBytes = 0;  // From the UDP server's report
+    uint32_t _reportMs = 0;
+    uint32_t _reportDatagrams = 0;
+    volatile uint32_t _lastRxMs = 0;
+    uint32_t _maxSeq = 0;     // One past the highest TCP sequence sent
+    int32_t _lastId = -1;     // Highest UDP sequence number seen
+    int64_t _lastTransit = 0; // Previous UDP arrival minus send time, in us
+    float _jitterUs = 0;
+
+    // Interval reporting and CPU load
+    uint32_t _idlePerMs = 0;  // _spin() loops per ms with no traffic
+    uint64_t _idle = 0;       // _spin() loops since the test started
+    uint32_t _lastReportMs = 0;
+    uint64_t _lastBytes = 0;
+    uint32_t _lastRetransmits = 0;
+    uint64_t _lastIdle = 0;
+};
@@ -0,0 +1,126 @@
+// Released to the public domain
+//
+// Compares storing small records as one LittleFS file each against KVStore.
+// Both use the same filesystem flash region, one after the other, so all
+// existing filesystem contents are erased!
+//
+// Select Tools->Flash Size->(some size with at least a 256KB FS/filesystem)
+
+#include <LittleFS.h>
+#include <KVStore.h>
+
+#define RECORDS 500
+
+KVStore kv;
+
+typedef struct {
+  uint32_t id;
+  float gain;
+  float offset;
+  uint32_t flags;
+} Calibration;
+
+void report(const char *what, uint32_t us) {
+  Serial.printf("  %-8s %8lu us total, %6lu us/record\n", what, us, us / RECORDS);
+}
+
+void benchLittleFS() {
+  char name[32];
+  Calibration c;
+  Serial.printf("LittleFS, %d files:\n", RECORDS);
+  LittleFS.format();
+  LittleFS.begin();
+  LittleFS.mkdir("/cal");
+
+  uint32_t start = micros();
+  for (int i = 0; i < RECORDS; i++) {
+    sprintf(name, "/cal/%d", i);
+    c = { (uint32_t)i, 1.0f + i, 0.5f * i, 0 };
+    File f = LittleFS.open(name, "w");
+    f.write((const uint8_t *)&c, sizeof(c));
+    f.close();
+  }
+  report("create", micros() - start);
+
+  start = micros();
+  for (int i = 0; i < RECORDS; i++) {
+    sprintf(name, "/cal/%d", (i * 7919) % RECORDS);
+    File f = LittleFS.open(name, "r");
+    f.read((uint8_t *)&c, sizeof(c));
+    f.close();
+  }
+  report("lookup", micros() - start);
+
+  start = micros();
+  for (int i = 0; i < RECORDS; i++) {
+    sprintf(name, "/cal/%d", (i * 7919) % RECORDS);
+    c = { (uint32_t)i, 2.0f + i, 0.25f * i, 1 };
+    File f = LittleFS.open(name, "w");
+    f.write((const uint8_t *)&c, sizeof(c));
+    f.close();
+  }
+  report("update", micros() - start);
+
+  start = micros();
+  LittleFS.end();
+  LittleFS.begin();
+  report("remount", micros() - start);
+  LittleFS.end();
+}
+
+void benchKVStore() {
+  char name[32];
+  Calibration c;
+  Serial.printf("KVStore, %d keys:\n", RECORDS);
+  kv.begin();
+  kv.format();
+
+  uint32_t start = micros();
+  for (int i = 0; i < RECORDS; i++) {
+    sprintf(name, "cal/%d", i);
+    c = { (uint32_t)i, 1.0f + i, 0.5f * i, 0 };
+    kv.put(name, c);
+  }
+  report("create", micros() - start);
+
+  start = micros();
+  for (int i = 0; i < RECORDS; i++) {
+    sprintf(name, "cal/%d", (i * 7919) % RECORDS);
+    kv.get(name, c);
+  }
+  report("lookup", micros() - start);
+
+  start = micros();
+  for (int i = 0; i < RECORDS; i++) {
+    sprintf(name, "cal/%d", (i * 7919) % RECORDS);
+    c = { (uint32_t)i, 2.0f + i, 0.25f * i, 1 };
+    kv.put(name, c);
+  }
+  report("update", micros() - start);
+
+  start = micros();
+  kv.end();
+  kv.begin();
+  report("remount", micros() - start);
+
+  // Both records change, or neither does
+  Calibration a = { 1, 1.5f, 0, 0 }, b = { 2, 2.5f, 0, 0 };
+  start = micros();
+  kv.beginTransaction();
+  kv.put("cal/a", a);
+  kv.put("cal/b", b);
+  kv.commit();
+  Serial.printf("  2-key transaction %lu us\n", micros() - start);
+  Serial.printf("  %u keys, %u of %u bytes free\n", kv.count(), kv.freeBytes(), kv.totalBytes());
+  kv.end();
+}
+
+void setup() {
+  Serial.begin(115200);
+  delay(5000);
+  benchLittleFS();
+  benchKVStore();
+}
+
+void loop() {
+}
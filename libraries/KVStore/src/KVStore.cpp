@@ -0,0 +1,887 @@
+/*
+    KVStore.cpp - Log-structured key-value store for flash or a file
+    Copyright (c) 2024 Earle F. Philhower, III.  All rights reserved.
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include "KVStore.h"
+#include <Checksum.h>
+#include <FlashProgram.h>
+#include <algorithm>
+
+#ifdef USE_TINYUSB
+// For Serial when selecting TinyUSB.  Can't include in the core because Arduino IDE
+// will not link in libraries called from the core.  Instead, add the header to all
+// the standard libraries in the hope it will still catch some user cases where they
+// use these libraries.
+// See https://github.com/earlephilhower/arduino-pico/issues/167#issuecomment-848622174
+#include <Adafruit_TinyUSB.h>
+#endif
+
+extern "C" uint8_t _FS_start;
+extern "C" uint8_t _FS_end;
+
+// Log layout.  Each 4K sector in use starts with a KVSectorHeader, and sequence
+// numbers increase by one from the oldest (head) to the newest (tail) sector.
+// Records follow the header back to back, 4-byte aligned, with the first all-0xff
+// record header marking the end.  A record whose txn is non-zero only takes effect
+// once a COMMIT record with the same txn has been found after it, and all records
+// of a transaction are written with a single program so they share one sector.
+//
+// One sector is always left free for the garbage collector, which copies the head
+// sector's live records into it and then erases the head.  The target's header
+// state stays 0xffffffff until the copy is complete, so a collection interrupted by
+// power loss (the only way every sector can end up in the log) is either finished
+// or rolled back in begin().
+#define KV_SECTOR_SIZE  4096
+#define KV_MAGIC        0x5356564b // "KVVS"
+#define KV_FLAG_DELETE  0x01
+#define KV_FLAG_COMMIT  0x02
+#define KV_STATE_COMPLETE 0
+
+#define KV_SLOT_EMPTY   0xffffffff
+#define KV_SLOT_DELETED 0xfffffffe
+
+typedef struct {
+    uint32_t magic;
+    uint32_t seq;
+    uint32_t crc;      // Over magic and seq
+    uint32_t state;    // KV_STATE_COMPLETE, or 0xffffffff while being garbage collected into
+} KVSectorHeader;
+
+typedef struct {
+    uint32_t crc;      // Over the rest of this header, the key, and the value
+    uint8_t  keyLen;   // 0 only for COMMIT records
+    uint8_t  flags;
+    uint16_t valLen;
+    uint32_t txn;      // 0 when not part of a transaction
+} KVRecord;
+
+static_assert(sizeof(KVSectorHeader) == 16, "KVSectorHeader must be 16 bytes");
+static_assert(sizeof(KVRecord) == 12, "KVRecord must be 12 bytes");
+
+#define KV_PAYLOAD (KV_SECTOR_SIZE - sizeof(KVSectorHeader))
+
+// FNV-1a
+static uint32_t _hashKey(const char *key, size_t len) {
+    uint32_t h = 2166136261;
+    while (len--) {
+        h ^= (uint8_t)*key++;
+        h *= 16777619;
+    }
+    return h;
+}
+
+static inline uint32_t _recordLen(size_t keyLen, size_t valLen) {
+    return (sizeof(KVRecord) + keyLen + valLen + 3) & ~3;
+}
+
+// Index slots pack the top byte of the hash with the record address / 4, good for 64MB
+static inline uint32_t _slot(uint32_t hash, uint32_t addr) {
+    return (hash & 0xff000000) | (addr >> 2);
+}
+
+static inline uint32_t _slotAddr(uint32_t slot) {
+    return (slot & 0x00ffffff) << 2;
+}
+
+static inline bool _slotLive(uint32_t slot) {
+    return (slot != KV_SLOT_EMPTY) && (slot != KV_SLOT_DELETED);
+}
+
+// Fills in the CRC and copies header, key, and value to buff, returning the padded length
+static uint32_t _buildRecord(uint8_t *buff, const char *key, size_t keyLen, const void *data, size_t valLen, uint8_t flags, uint32_t txn) {
+    KVRecord r = { 0, (uint8_t)keyLen, flags, (uint16_t)valLen, txn };
+    uint32_t len = _recordLen(keyLen, valLen);
+    memset(buff, 0xff, len);
+    memcpy(buff, &r, sizeof(r));
+    if (keyLen) {
+        memcpy(buff + sizeof(r), key, keyLen);
+    }
+    if (valLen) {
+        memcpy(buff + sizeof(r) + keyLen, data, valLen);
+    }
+    r.crc = checksumCRC32(0, buff + 4, sizeof(r) - 4 + keyLen + valLen);
+    memcpy(buff, &r.crc, sizeof(r.crc));
+    return len;
+}
+
+// Where the log lives.  program() is only ever called on erased (0xff) bytes.
+class KVStorage {
+public:
+    virtual ~KVStorage() { }
+    virtual bool read(uint32_t addr, void *dst, size_t len) = 0;
+    virtual bool program(uint32_t addr, const void *src, size_t len) = 0;
+    virtual bool erase(uint32_t addr) = 0; // One KV_SECTOR_SIZE sector
+    size_t size() const {
+        return _size;
+    }
+
+protected:
+    size_t _size;
+};
+
+class KVFlashStorage : public KVStorage {
+public:
+    KVFlashStorage(const uint8_t *start, size_t size) : _start(start) {
+        _size = size;
+    }
+
+    bool read(uint32_t addr, void *dst, size_t len) override {
+        memcpy(dst, _start + addr, len);
+        return true;
+    }
+
+    bool program(uint32_t addr, const void *src, size_t len) override {
+        flashProgram(_start + addr, src, len);
+        return true;
+    }
+
+    bool erase(uint32_t addr) override {
+        flashErase(_start + addr, KV_SECTOR_SIZE);
+        return true;
+    }
+
+private:
+    const uint8_t *_start;
+};
+
+class KVFileStorage : public KVStorage {
+public:
+    KVFileStorage(File f, size_t size) : _f(f) {
+        _size = size;
+    }
+
+    ~KVFileStorage() {
+        _f.close();
+    }
+
+    bool read(uint32_t addr, void *dst, size_t len) override {
+        return _f.seek(addr) && (_f.read((uint8_t *)dst, len) == len);
+    }
+
+    bool program(uint32_t addr, const void *src, size_t len) override {
+        if (!_f.seek(addr) || (_f.write((const uint8_t *)src, len) != len)) {
+            return false;
+        }
+        _f.flush();
+        return true;
+    }
+
+    bool erase(uint32_t addr) override {
+        uint8_t ff[256];
+        memset(ff, 0xff, sizeof(ff));
+        if (!_f.seek(addr)) {
+            return false;
+        }
+        for (size_t i = 0; i < KV_SECTOR_SIZE; i += sizeof(ff)) {
+            if (_f.write(ff, sizeof(ff)) != sizeof(ff)) {
+                return false;
+            }
+        }
+        _f.flush();
+        return true;
+    }
+
+private:
+    File _f;
+};
+
+
+KVStore::KVStore() {
+    _storage = nullptr;
+    _index = nullptr;
+    _indexSize = 0;
+    _count = 0;
+    _deleted = 0;
+    _sectors = 0;
+    _head = 0;
+    _tail = -1;
+    _pos = 0;
+    _seq = 0;
+    _txn = 1;
+    _inTxn = false;
+}
+
+KVStore::~KVStore() {
+    end();
+}
+
+bool KVStore::begin() {
+    return begin(&_FS_start, &_FS_end - &_FS_start);
+}
+
+bool KVStore::begin(const uint8_t *start, size_t size) {
+    end();
+    size &= ~(KV_SECTOR_SIZE - 1);
+    if (((intptr_t)start & (KV_SECTOR_SIZE - 1)) || (size / KV_SECTOR_SIZE < 3)) {
+        DEBUGV("KVStore: Region must be 4K aligned and at least 3 sectors\n");
+        return false;
+    }
+    _storage = new KVFlashStorage(start, size);
+    return _mount();
+}
+
+bool KVStore::begin(FS &fs, const char *path, size_t size) {
+    end();
+    size &= ~(KV_SECTOR_SIZE - 1);
+    if (size / KV_SECTOR_SIZE < 3) {
+        DEBUGV("KVStore: File must be at least 3 sectors\n");
+        return false;
+    }
+    File f = fs.open(path, "r+");
+    if (!f || (f.size() != size)) {
+        // New or resized backing file, start from a blank "erased" image
+        f.close();
+        f = fs.open(path, "w+");
+        if (!f) {
+            return false;
+        }
+        uint8_t ff[256];
+        memset(ff, 0xff, sizeof(ff));
+        for (size_t i = 0; i < size; i += sizeof(ff)) {
+            if (f.write(ff, sizeof(ff)) != sizeof(ff)) {
+                f.close();
+                return false;
+            }
+        }
+        f.flush();
+    }
+    _storage = new KVFileStorage(f, size);
+    return _mount();
+}
+
+void KVStore::end() {
+    abort();
+    delete _storage;
+    _storage = nullptr;
+    delete[] _index;
+    _index = nullptr;
+    _indexSize = 0;
+    _count = 0;
+    _deleted = 0;
+}
+
+bool KVStore::format() {
+    if (!_storage) {
+        return false;
+    }
+    abort();
+    uint32_t buff[64];
+    for (int s = 0; s < _sectors; s++) {
+        // Skip sectors that are already blank to save erase cycles
+        bool blank = true;
+        for (uint32_t off = 0; blank && (off < KV_SECTOR_SIZE); off += sizeof(buff)) {
+            _storage->read(s * KV_SECTOR_SIZE + off, buff, sizeof(buff));
+            for (size_t i = 0; blank && (i < 64); i++) {
+                blank = buff[i] == 0xffffffff;
+            }
+        }
+        if (!blank && !_storage->erase(s * KV_SECTOR_SIZE)) {
+            return false;
+        }
+    }
+    return _mount();
+}
+
+bool KVStore::_mount() {
+    _sectors = _storage->size() / KV_SECTOR_SIZE;
+    _head = 0;
+    _tail = -1;
+    _pos = KV_SECTOR_SIZE;
+    _seq = 0;
+    _txn = 1;
+    _count = 0;
+    _deleted = 0;
+    delete[] _index;
+    _indexSize = 64;
+    _index = new uint32_t[_indexSize];
+    if (!_index) {
+        return false;
+    }
+    memset(_index, 0xff, _indexSize * sizeof(uint32_t));
+
+    // The tail is the sector with the newest header, and the log runs back from it
+    // for as long as the sequence numbers keep decreasing by one
+    uint32_t seq;
+    for (int i = 0; i < _sectors; i++) {
+        if (_validSector(i, &seq) && ((_tail < 0) || ((int32_t)(seq - _seq) > 0))) {
+            _tail = i;
+            _seq = seq;
+        }
+    }
+    if (_tail < 0) {
+        return true; // Empty store
+    }
+    _head = _tail;
+    for (int n = 1; n < _sectors; n++) {
+        int prev = (_head + _sectors - 1) % _sectors;
+        if (!_validSector(prev, &seq) || (seq != _seq - n)) {
+            break;
+        }
+        _head = prev;
+    }
+    if (_used() == _sectors) {
+        // Power was lost during garbage collection
+        uint32_t state;
+        _storage->read(_tail * KV_SECTOR_SIZE + offsetof(KVSectorHeader, state), &state, sizeof(state));
+        if (state == KV_STATE_COMPLETE) {
+            // Everything live was copied, only the erase of the old head is missing
+            if (!_storage->erase(_head * KV_SECTOR_SIZE)) {
+                return false;
+            }
+            _head = (_head + 1) % _sectors;
+        } else {
+            // The head is still intact, drop the partial copy
+            if (!_storage->erase(_tail * KV_SECTOR_SIZE)) {
+                return false;
+            }
+            _tail = (_tail + _sectors - 1) % _sectors;
+            _seq--;
+        }
+    }
+
+    std::vector<uint32_t> pending;
+    uint32_t pendingTxn = 0;
+    for (int i = _head; ; i = (i + 1) % _sectors) {
+        _scan(i, pending, pendingTxn);
+        if (i == _tail) {
+            break;
+        }
+    }
+    return true;
+}
+
+bool KVStore::_validSector(int sector, uint32_t *seq) const {
+    KVSectorHeader h;
+    if (!_storage->read(sector * KV_SECTOR_SIZE, &h, sizeof(h))) {
+        return false;
+    }
+    if ((h.magic != KV_MAGIC) || (h.crc != checksumCRC32(0, &h, 8))) {
+        return false;
+    }
+    *seq = h.seq;
+    return true;
+}
+
+void KVStore::_scan(int sector, std::vector<uint32_t> &pending, uint32_t &pendingTxn) {
+    uint8_t *buff = new uint8_t[KV_SECTOR_SIZE];
+    if (!buff) {
+        return;
+    }
+    uint32_t base = sector * KV_SECTOR_SIZE;
+    uint32_t pos = sizeof(KVSectorHeader);
+    bool torn = false;
+    _storage->read(base, buff, KV_SECTOR_SIZE);
+    while (pos + sizeof(KVRecord) <= KV_SECTOR_SIZE) {
+        KVRecord r;
+        memcpy(&r, buff + pos, sizeof(r));
+        const uint32_t *w = (const uint32_t *)&r;
+        if ((w[0] == 0xffffffff) && (w[1] == 0xffffffff) && (w[2] == 0xffffffff)) {
+            break; // End of the log in this sector
+        }
+        uint32_t len = _recordLen(r.keyLen, r.valLen);
+        bool commit = r.flags & KV_FLAG_COMMIT;
+        if ((pos + len > KV_SECTOR_SIZE) || (commit ? (!r.txn || r.keyLen) : !r.keyLen) ||
+                (r.crc != checksumCRC32(0, buff + pos + 4, sizeof(r) - 4 + r.keyLen + r.valLen))) {
+            // Interrupted write.  Nothing after it can be trusted.
+            DEBUGV("KVStore: Bad record at %08x\n", (unsigned)(base + pos));
+            torn = true;
+            break;
+        }
+        if (r.txn) {
+            if (r.txn != pendingTxn) {
+                // Any earlier transaction without its COMMIT never happened
+                pending.clear();
+                pendingTxn = r.txn;
+            }
+            if (commit) {
+                for (auto a : pending) {
+                    _apply(a);
+                }
+                pending.clear();
+                pendingTxn = 0;
+            } else {
+                pending.push_back(base + pos);
+            }
+            if ((int32_t)(r.txn - _txn) >= 0) {
+                _txn = r.txn + 1;
+            }
+        } else {
+            _apply(base + pos);
+        }
+        pos += len;
+    }
+    delete[] buff;
+    if (sector == _tail) {
+        // Never append after a torn record, start a new sector instead
+        _pos = torn ? KV_SECTOR_SIZE : pos;
+    }
+}
+
+void KVStore::_apply(uint32_t addr) {
+    KVRecord r;
+    char key[256];
+    _storage->read(addr, &r, sizeof(r));
+    _storage->read(addr + sizeof(r), key, r.keyLen);
+    uint32_t hash = _hashKey(key, r.keyLen);
+    if (r.flags & KV_FLAG_DELETE) {
+        int slot = _find(key, r.keyLen, hash);
+        if (slot >= 0) {
+            _indexRemove(slot);
+        }
+    } else {
+        _indexSet(key, r.keyLen, hash, addr);
+    }
+}
+
+int KVStore::_find(const char *key, size_t keyLen, uint32_t hash) const {
+    if (!_index) {
+        return -1;
+    }
+    uint32_t mask = _indexSize - 1;
+    uint32_t i = hash & mask;
+    for (uint32_t n = 0; n < _indexSize; n++, i = (i + 1) & mask) {
+        uint32_t s = _index[i];
+        if (s == KV_SLOT_EMPTY) {
+            return -1;
+        }
+        if (_slotLive(s) && ((s ^ hash) < 0x01000000) && _keyMatches(_slotAddr(s), key, keyLen)) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+bool KVStore::_keyMatches(uint32_t addr, const char *key, size_t keyLen) const {
+    KVRecord r;
+    char buff[256];
+    if (!_storage->read(addr, &r, sizeof(r)) || (r.keyLen != keyLen)) {
+        return false;
+    }
+    return _storage->read(addr + sizeof(r), buff, keyLen) && !memcmp(buff, key, keyLen);
+}
+
+void KVStore::_indexSet(const char *key, size_t keyLen, uint32_t hash, uint32_t addr) {
+    int i = _find(key, keyLen, hash);
+    if (i >= 0) {
+        _index[i] = _slot(hash, addr);
+        return;
+    }
+    // Keep the load, tombstones included, under 3/4
+    if ((_count + _deleted + 1) * 4 > _indexSize * 3) {
+        if (!_indexGrow()) {
+            return;
+        }
+    }
+    uint32_t mask = _indexSize - 1;
+    for (i = hash & mask; _slotLive(_index[i]); i = (i + 1) & mask) {
+        /* Find first empty or deleted slot */
+    }
+    if (_index[i] == KV_SLOT_DELETED) {
+        _deleted--;
+    }
+    _index[i] = _slot(hash, addr);
+    _count++;
+}
+
+void KVStore::_indexRemove(int slot) {
+    _index[slot] = KV_SLOT_DELETED;
+    _count--;
+    _deleted++;
+}
+
+bool KVStore::_indexGrow() {
+    // Only tombstones are cleared out when the table is less than half live
+    uint32_t size = (_count * 2 < _indexSize) ? _indexSize : _indexSize * 2;
+    uint32_t *index = new uint32_t[size];
+    if (!index) {
+        return false;
+    }
+    memset(index, 0xff, size * sizeof(uint32_t));
+    // Slots only keep 8 bits of the hash, so rehash the keys from storage
+    for (uint32_t j = 0; j < _indexSize; j++) {
+        if (!_slotLive(_index[j])) {
+            continue;
+        }
+        uint32_t addr = _slotAddr(_index[j]);
+        KVRecord r;
+        char key[256];
+        _storage->read(addr, &r, sizeof(r));
+        _storage->read(addr + sizeof(r), key, r.keyLen);
+        uint32_t hash = _hashKey(key, r.keyLen);
+        uint32_t i;
+        for (i = hash & (size - 1); index[i] != KV_SLOT_EMPTY; i = (i + 1) & (size - 1)) {
+            /* Find first empty slot */
+        }
+        index[i] = _index[j];
+    }
+    delete[] _index;
+    _index = index;
+    _indexSize = size;
+    _deleted = 0;
+    return true;
+}
+
+bool KVStore::_openSector(int sector, bool complete) {
+    uint32_t base = sector * KV_SECTOR_SIZE;
+    uint32_t buff[64];
+    bool blank = true;
+    for (uint32_t off = 0; blank && (off < KV_SECTOR_SIZE); off += sizeof(buff)) {
+        _storage->read(base + off, buff, sizeof(buff));
+        for (size_t i = 0; blank && (i < 64); i++) {
+            blank = buff[i] == 0xffffffff;
+        }
+    }
+    if (!blank && !_storage->erase(base)) {
+        return false;
+    }
+    KVSectorHeader h = { KV_MAGIC, _seq + 1, 0, complete ? KV_STATE_COMPLETE : 0xffffffff };
+    h.crc = checksumCRC32(0, &h, 8);
+    if (!_storage->program(base, &h, sizeof(h))) {
+        return false;
+    }
+    if (_tail < 0) {
+        _head = sector;
+    }
+    _tail = sector;
+    _seq++;
+    _pos = sizeof(h);
+    return true;
+}
+
+bool KVStore::_reserve(size_t len) {
+    if (len > KV_PAYLOAD) {
+        return false;
+    }
+    if ((_tail >= 0) && (_pos + len <= KV_SECTOR_SIZE)) {
+        return true;
+    }
+    if (_tail < 0) {
+        return _openSector(0, true);
+    }
+    // The last free sector is only ever opened by the garbage collector
+    for (int tries = 0; _sectors - _used() <= 1; tries++) {
+        if ((tries >= _sectors) || !_gcHead()) {
+            DEBUGV("KVStore: Full\n");
+            return false;
+        }
+        if (_pos + len <= KV_SECTOR_SIZE) {
+            return true;
+        }
+    }
+    return _openSector((_tail + 1) % _sectors, true);
+}
+
+bool KVStore::_write(const uint8_t *buff, size_t len, uint32_t *addr) {
+    if (!_reserve(len)) {
+        return false;
+    }
+    *addr = _tail * KV_SECTOR_SIZE + _pos;
+    if (!_storage->program(*addr, buff, len)) {
+        _pos = KV_SECTOR_SIZE; // Unknown state, don't append after it
+        return false;
+    }
+    _pos += len;
+    return true;
+}
+
+bool KVStore::_gcHead() {
+    if (_head == _tail) {
+        return false;
+    }
+    uint8_t *buff = new uint8_t[KV_SECTOR_SIZE];
+    if (!buff) {
+        return false;
+    }
+    uint32_t base = _head * KV_SECTOR_SIZE;
+    _storage->read(base, buff, KV_SECTOR_SIZE);
+    // The live records of one sector always fit in a fresh one
+    if (!_openSector((_tail + 1) % _sectors, false)) {
+        delete[] buff;
+        return false;
+    }
+    uint32_t pos = sizeof(KVSectorHeader);
+    while (pos + sizeof(KVRecord) <= KV_SECTOR_SIZE) {
+        KVRecord r;
+        memcpy(&r, buff + pos, sizeof(r));
+        uint32_t len = _recordLen(r.keyLen, r.valLen);
+        if ((pos + len > KV_SECTOR_SIZE) || (r.crc != checksumCRC32(0, buff + pos + 4, sizeof(r) - 4 + r.keyLen + r.valLen))) {
+            break; // End of the log in this sector, or a torn record
+        }
+        if (r.flags & KV_FLAG_COMMIT) {
+            pos += len;
+            continue;
+        }
+        // Only records the index still points to are live, tombstones are dropped
+        const char *key = (const char *)buff + pos + sizeof(r);
+        uint32_t hash = _hashKey(key, r.keyLen);
+        int slot = _find(key, r.keyLen, hash);
+        if ((slot >= 0) && (_slotAddr(_index[slot]) == base + pos)) {
+            // Copied out of any transaction, since its COMMIT stays behind
+            uint8_t *rec = buff + pos;
+            r.txn = 0;
+            memcpy(rec, &r, sizeof(r));
+            r.crc = checksumCRC32(0, rec + 4, sizeof(r) - 4 + r.keyLen + r.valLen);
+            memcpy(rec, &r.crc, sizeof(r.crc));
+            uint32_t addr = _tail * KV_SECTOR_SIZE + _pos;
+            if (!_storage->program(addr, rec, len)) {
+                delete[] buff;
+                return false;
+            }
+            _pos += len;
+            _index[slot] = _slot(hash, addr);
+        }
+        pos += len;
+    }
+    delete[] buff;
+    uint32_t state = KV_STATE_COMPLETE;
+    if (!_storage->program(_tail * KV_SECTOR_SIZE + offsetof(KVSectorHeader, state), &state, sizeof(state))) {
+        return false;
+    }
+    if (!_storage->erase(base)) {
+        return false;
+    }
+    _head = (_head + 1) % _sectors;
+    return true;
+}
+
+bool KVStore::put(const char *key, const void *data, size_t len) {
+    size_t keyLen = key ? strlen(key) : 0;
+    if (!_storage || !keyLen || (keyLen > 255) || (_recordLen(keyLen, len) > KV_PAYLOAD - sizeof(KVRecord))) {
+        return false;
+    }
+    if (_inTxn) {
+        Op op;
+        op.key = key;
+        op.data.assign((const uint8_t *)data, (const uint8_t *)data + len);
+        op.remove = false;
+        _ops.push_back(std::move(op));
+        return true;
+    }
+    uint32_t hash = _hashKey(key, keyLen);
+    int slot = _find(key, keyLen, hash);
+    if (slot >= 0) {
+        // Rewriting an identical value would only wear the flash
+        uint32_t addr = _slotAddr(_index[slot]);
+        KVRecord r;
+        _storage->read(addr, &r, sizeof(r));
+        if (r.valLen == len) {
+            uint8_t tmp[64];
+            bool same = true;
+            for (size_t off = 0; same && (off < len); off += sizeof(tmp)) {
+                size_t n = std::min(len - off, sizeof(tmp));
+                _storage->read(addr + sizeof(r) + keyLen + off, tmp, n);
+                same = !memcmp(tmp, (const uint8_t *)data + off, n);
+            }
+            if (same) {
+                return true;
+            }
+        }
+    }
+    uint8_t *buff = new uint8_t[_recordLen(keyLen, len)];
+    if (!buff) {
+        return false;
+    }
+    uint32_t recLen = _buildRecord(buff, key, keyLen, data, len, 0, 0);
+    uint32_t addr;
+    bool ok = _write(buff, recLen, &addr);
+    delete[] buff;
+    if (ok) {
+        // GC may have moved records, so don't reuse the slot found above
+        _indexSet(key, keyLen, hash, addr);
+    }
+    return ok;
+}
+
+bool KVStore::remove(const char *key) {
+    size_t keyLen = key ? strlen(key) : 0;
+    if (!_storage || !keyLen || (keyLen > 255)) {
+        return false;
+    }
+    if (_inTxn) {
+        Op op;
+        op.key = key;
+        op.remove = true;
+        _ops.push_back(std::move(op));
+        return true;
+    }
+    uint32_t hash = _hashKey(key, keyLen);
+    if (_find(key, keyLen, hash) < 0) {
+        return false;
+    }
+    uint8_t buff[sizeof(KVRecord) + 256];
+    uint32_t len = _buildRecord(buff, key, keyLen, nullptr, 0, KV_FLAG_DELETE, 0);
+    uint32_t addr;
+    if (!_write(buff, len, &addr)) {
+        return false;
+    }
+    int slot = _find(key, keyLen, hash);
+    if (slot >= 0) {
+        _indexRemove(slot);
+    }
+    return true;
+}
+
+int KVStore::length(const char *key) {
+    size_t keyLen = key ? strlen(key) : 0;
+    if (!_storage || !keyLen || (keyLen > 255)) {
+        return -1;
+    }
+    int slot = _find(key, keyLen, _hashKey(key, keyLen));
+    if (slot < 0) {
+        return -1;
+    }
+    KVRecord r;
+    _storage->read(_slotAddr(_index[slot]), &r, sizeof(r));
+    return r.valLen;
+}
+
+int KVStore::get(const char *key, void *data, size_t maxLen) {
+    size_t keyLen = key ? strlen(key) : 0;
+    if (!_storage || !keyLen || (keyLen > 255)) {
+        return -1;
+    }
+    int slot = _find(key, keyLen, _hashKey(key, keyLen));
+    if (slot < 0) {
+        return -1;
+    }
+    uint32_t addr = _slotAddr(_index[slot]);
+    KVRecord r;
+    _storage->read(addr, &r, sizeof(r));
+    if (!_storage->read(addr + sizeof(r) + keyLen, data, std::min((size_t)r.valLen, maxLen))) {
+        return -1;
+    }
+    return r.valLen;
+}
+
+String KVStore::getString(const char *key) {
+    String s;
+    int len = length(key);
+    if (len <= 0) {
+        return s;
+    }
+    char *buff = new char[len + 1];
+    if (buff) {
+        get(key, buff, len);
+        buff[len] = 0;
+        s = buff;
+        delete[] buff;
+    }
+    return s;
+}
+
+bool KVStore::beginTransaction() {
+    if (!_storage || _inTxn) {
+        return false;
+    }
+    _ops.clear();
+    _inTxn = true;
+    return true;
+}
+
+void KVStore::abort() {
+    _inTxn = false;
+    _ops.clear();
+}
+
+bool KVStore::commit() {
+    if (!_inTxn) {
+        return false;
+    }
+    _inTxn = false;
+    if (_ops.empty()) {
+        return true;
+    }
+    // The whole transaction plus its COMMIT marker goes out in one program
+    size_t total = sizeof(KVRecord);
+    for (auto &op : _ops) {
+        total += _recordLen(op.key.length(), op.data.size());
+    }
+    if (total > KV_PAYLOAD) {
+        DEBUGV("KVStore: Transaction too large\n");
+        _ops.clear();
+        return false;
+    }
+    uint8_t *buff = new uint8_t[total];
+    if (!buff) {
+        _ops.clear();
+        return false;
+    }
+    uint32_t id = _txn++;
+    if (!_txn) {
+        _txn = 1; // 0 is reserved for non-transaction records
+    }
+    uint32_t len = 0;
+    for (auto &op : _ops) {
+        len += _buildRecord(buff + len, op.key.c_str(), op.key.length(), op.data.data(), op.data.size(), op.remove ? KV_FLAG_DELETE : 0, id);
+    }
+    len += _buildRecord(buff + len, nullptr, 0, nullptr, 0, KV_FLAG_COMMIT, id);
+    uint32_t addr;
+    bool ok = _write(buff, len, &addr);
+    delete[] buff;
+    if (ok) {
+        for (auto &op : _ops) {
+            const char *key = op.key.c_str();
+            uint32_t hash = _hashKey(key, op.key.length());
+            if (op.remove) {
+                int slot = _find(key, op.key.length(), hash);
+                if (slot >= 0) {
+                    _indexRemove(slot);
+                }
+            } else {
+                _indexSet(key, op.key.length(), hash, addr);
+            }
+            addr += _recordLen(op.key.length(), op.data.size());
+        }
+    }
+    _ops.clear();
+    return ok;
+}
+
+void KVStore::forEach(std::function<void(const char *key, size_t len)> cb) {
+    for (uint32_t i = 0; i < _indexSize; i++) {
+        if (!_slotLive(_index[i])) {
+            continue;
+        }
+        uint32_t addr = _slotAddr(_index[i]);
+        KVRecord r;
+        char key[256];
+        _storage->read(addr, &r, sizeof(r));
+        _storage->read(addr + sizeof(r), key, r.keyLen);
+        key[r.keyLen] = 0;
+        cb(key, r.valLen);
+    }
+}
+
+size_t KVStore::totalBytes() const {
+    // One sector is always kept free for garbage collection
+    return _storage ? (_sectors - 1) * KV_PAYLOAD : 0;
+}
+
+size_t KVStore::freeBytes() const {
+    // Space that can be written without garbage collection
+    if (!_storage) {
+        return 0;
+    }
+    size_t avail = (_sectors - 1 - _used()) * KV_PAYLOAD;
+    if (_tail >= 0) {
+        avail += KV_SECTOR_SIZE - std::min(_pos, (uint32_t)KV_SECTOR_SIZE);
+    } else {
+        avail += KV_PAYLOAD;
+    }
+    return avail;
+}
@@ -0,0 +1,135 @@
+/*
+    KVStore.h - Log-structured key-value store for flash or a file
+    Copyright (c) 2024 Earle F. Philhower, III.  All rights reserved.
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#pragma once
+
+#include <Arduino.h>
+#include <FS.h>
+#include <functional>
+#include <vector>
+
+class KVStorage;
+
+// Records are appended to a log of 4K sectors and located through a hash
+// table in RAM that is rebuilt by scanning the log in begin().  The oldest
+// sector is garbage collected, by copying its still-current records to the
+// end of the log, whenever only one free sector remains.
+class KVStore {
+public:
+    KVStore();
+    ~KVStore();
+
+    // Use the filesystem flash region, which must then not be used by LittleFS or FatFS
+    bool begin();
+    // Use a 4K-aligned flash region
+    bool begin(const uint8_t *start, size_t size);
+    // Use a file of the given size on any filesystem, created if needed
+    bool begin(FS &fs, const char *path, size_t size);
+    void end();
+
+    // Erase all keys
+    bool format();
+
+    // Keys are 1..255 bytes, key plus value up to 4050 bytes
+    bool put(const char *key, const void *data, size_t len);
+    bool put(const char *key, const char *str) {
+        return put(key, str, strlen(str));
+    }
+    bool put(const char *key, const String &str) {
+        return put(key, str.c_str(), str.length());
+    }
+    template<typename T>
+    bool put(const char *key, const T &t) {
+        return put(key, &t, sizeof(T));
+    }
+
+    // Copies up to maxLen bytes, returns the full value length or -1 if not found
+    int get(const char *key, void *data, size_t maxLen);
+    String getString(const char *key);
+    template<typename T>
+    bool get(const char *key, T &t) {
+        return get(key, &t, sizeof(T)) == (int)sizeof(T);
+    }
+
+    // Value length, or -1 if not found
+    int length(const char *key);
+    bool exists(const char *key) {
+        return length(key) >= 0;
+    }
+    bool remove(const char *key);
+
+    // put() and remove() calls until commit() are written all together or not at all.
+    // get() only sees committed values.
+    bool beginTransaction();
+    bool commit();
+    void abort();
+
+    // Calls cb(key, valueLength) for every key, in no particular order
+    void forEach(std::function<void(const char *key, size_t len)> cb);
+
+    size_t count() const {
+        return _count;
+    }
+    size_t totalBytes() const;
+    size_t freeBytes() const;
+
+protected:
+    typedef struct {
+        String key;
+        std::vector<uint8_t> data;
+        bool remove;
+    } Op;
+
+    bool _mount();
+    bool _validSector(int sector, uint32_t *seq) const;
+    void _scan(int sector, std::vector<uint32_t> &pending, uint32_t &pendingTxn);
+    void _apply(uint32_t addr);
+
+    int _find(const char *key, size_t keyLen, uint32_t hash) const;
+    void _indexSet(const char *key, size_t keyLen, uint32_t hash, uint32_t addr);
+    void _indexRemove(int slot);
+    bool _indexGrow();
+    bool _keyMatches(uint32_t addr, const char *key, size_t keyLen) const;
+
+    bool _reserve(size_t len);
+    bool _openSector(int sector, bool complete);
+    bool _gcHead();
+    bool _write(const uint8_t *buff, size_t len, uint32_t *addr);
+    int _used() const {
+        return (_tail < 0) ? 0 : (_tail - _head + _sectors) % _sectors + 1;
+    }
+
+    KVStorage *_storage;
+    int        _sectors;
+    int        _head;      // Oldest sector in the log
+    int        _tail;      // Sector being appended to, -1 for an empty store
+    uint32_t   _pos;       // Next free byte in _tail
+    uint32_t   _seq;       // Sequence number of _tail
+    uint32_t   _txn;       // Next transaction ID
+
+    // Open addressed hash table, each slot holds the top 8 bits of the key's hash
+    // and the record address / 4, or one of the KV_SLOT_xxx markers
+    uint32_t  *_index;
+    uint32_t   _indexSize; // Power of 2
+    uint32_t   _count;     // Live keys
+    uint32_t   _deleted;   // Tombstoned slots
+
+    bool       _inTxn;
+    std::vector<Op> _ops;
+};
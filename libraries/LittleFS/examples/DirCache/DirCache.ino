@@ -0,0 +1,63 @@
+// Shows the LittleFS directory cache speeding up lookups in a large directory
+// Released to the public domain by Earle F. Philhower, III
+
+#include <LittleFS.h>
+
+// WARNING:  The filesystem will be formatted at the start of the test!
+
+#define FILES 200
+#define LOOKUPS 1000
+#define HOT 24  // Files actually being looked up, the cache needs 2 entries for each
+
+LittleFSCacheStats stats;
+
+// Looks up a mix of existing and missing files, like a web server checking for
+// precompressed versions of each page
+unsigned long lookups() {
+  unsigned long start = millis();
+  int found = 0;
+  for (int i = 0; i < LOOKUPS; i++) {
+    char name[32];
+    sprintf(name, "/logs/%03d.%s", (i * 7) % HOT, (i & 1) ? "txt" : "gz");
+    found += LittleFS.exists(name) ? 1 : 0;
+  }
+  unsigned long stop = millis();
+  Serial.printf("%d lookups, %d found, took %lu ms\n", LOOKUPS, found, stop - start);
+  return stop - start;
+}
+
+void setup() {
+  Serial.begin(115200);
+  delay(5000);
+
+  Serial.printf("Formatting and creating %d files, may take a while...\n", FILES);
+  LittleFS.format();
+  LittleFS.begin();
+  for (int i = 0; i < FILES; i++) {
+    char name[32];
+    sprintf(name, "/logs/%03d.txt", i);
+    File f = LittleFS.open(name, "w");
+    f.printf("Log %d\n", i);
+    f.close();
+  }
+  LittleFS.end();
+
+  Serial.printf("\nWithout the directory cache\n");
+  LittleFS.begin();
+  lookups();
+  LittleFS.end();
+
+  Serial.printf("\nWith a 64 entry directory cache\n");
+  LittleFSConfig cfg;
+  cfg.setDirCache(64, &stats);
+  LittleFS.setConfig(cfg);
+  LittleFS.begin();
+  lookups();
+  lookups();
+  Serial.printf("Cache hits %lu, misses %lu, evictions %lu, hit rate %lu%%\n", stats.hits, stats.misses,
+                stats.evictions, stats.hits * 100 / (stats.hits + stats.misses));
+  LittleFS.end();
+}
+
+void loop() {
+}
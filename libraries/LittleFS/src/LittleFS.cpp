@@ -58,6 +58,16 @@ FileImplPtr LittleFSImpl::open(const char* path, OpenMode openMode, AccessMode a
     int flags = _getFlags(openMode, accessMode);
     auto fd = std::make_shared<lfs_file_t>();
 
+    int type;
+    if (!(openMode & OM_CREATE) && _cache.lookup(path, &type)) {
+        if (type == LittleFSDirCache::MISSING) {
+            DEBUGV("LittleFSImpl::open: path=`%s` not found (cached)\n", path);
+            return FileImplPtr();
+        } else if (type == LFS_TYPE_DIR) {
+            return std::make_shared<LittleFSFileImpl>(this, path, nullptr, flags, 0);
+        }
+    }
+
     if ((openMode & OM_CREATE) && strchr(path, '/')) {
         // For file creation, silently make subdirs as needed.  If any fail,
         // it will be caught by the real file open later on
@@ -73,29 +83,34 @@ FileImplPtr LittleFSImpl::open(const char* path, OpenMode openMode, AccessMode a
             }
         }
         free(pathStr);
+        _cache.forget(path, true);
     }
 
     time_t creation = 0;
     if (_timeCallback && (openMode & OM_CREATE)) {
         // O_CREATE means we *may* make the file, but not if it already exists.
         // See if it exists, and only if not update the creation time
-        int rc = lfs_file_open(&_lfs, fd.get(), path, LFS_O_RDONLY);
-        if (rc == 0) {
-            lfs_file_close(&_lfs, fd.get()); // It exists, don't update create time
-        } else {
+        if (_lookupType(path) != LFS_TYPE_REG) {
             creation = _timeCallback();  // File didn't exist or otherwise, so we're going to create this time
         }
     }
 
     int rc = lfs_file_open(&_lfs, fd.get(), path, flags);
     if (rc == LFS_ERR_ISDIR) {
+        _cache.store(path, LFS_TYPE_DIR);
         // To support the SD.openNextFile, a null FD indicates to the LittleFSFile this is just
         // a directory whose name we are carrying around but which cannot be read or written
         return std::make_shared<LittleFSFileImpl>(this, path, nullptr, flags, creation);
     } else if (rc == 0) {
+        _cache.store(path, LFS_TYPE_REG);
         lfs_file_sync(&_lfs, fd.get());
         return std::make_shared<LittleFSFileImpl>(this, path, fd, flags, creation);
     } else {
+        if (rc == LFS_ERR_NOENT) {
+            _cache.store(path, LittleFSDirCache::MISSING);
+        } else {
+            _cache.forget(path, false);
+        }
         DEBUGV("LittleFSDirImpl::openFile: rc=%d fd=%p path=`%s` openMode=%d accessMode=%d err=%d\n",
                rc, fd.get(), path, openMode, accessMode, rc);
         return FileImplPtr();
@@ -113,7 +128,7 @@ DirImplPtr LittleFSImpl::openDir(const char *path) {
     }
     // At this point we have a name of "blah/blah/blah" or "blah" or ""
     // If that references a directory, just open it and we're done.
-    lfs_info info;
+    int type;
     auto dir = std::make_shared<lfs_dir_t>();
     int rc;
     const char *filter = "";
@@ -121,8 +136,8 @@ DirImplPtr LittleFSImpl::openDir(const char *path) {
         // openDir("") === openDir("/")
         rc = lfs_dir_open(&_lfs, dir.get(), "/");
         filter = "";
-    } else if (lfs_stat(&_lfs, pathStr, &info) >= 0) {
-        if (info.type == LFS_TYPE_DIR) {
+    } else if ((type = _lookupType(pathStr)) != LittleFSDirCache::MISSING) {
+        if (type == LFS_TYPE_DIR) {
             // Easy peasy, path specifies an existing dir!
             rc = lfs_dir_open(&_lfs, dir.get(), pathStr);
             filter = "";
@@ -170,9 +185,177 @@ DirImplPtr LittleFSImpl::openDir(const char *path) {
     return ret;
 }
 
+int LittleFSImpl::_lookupType(const char *path) {
+    int type;
+    if (_cache.lookup(path, &type)) {
+        return type;
+    }
+    lfs_info info;
+    int rc = lfs_stat(&_lfs, path, &info);
+    if (rc == 0) {
+        _cache.store(path, info.type);
+        return info.type;
+    } else if (rc == LFS_ERR_NOENT) {
+        _cache.store(path, LittleFSDirCache::MISSING);
+    }
+    return LittleFSDirCache::MISSING;
+}
+
+
+void LittleFSDirCache::setup(uint16_t entries, LittleFSCacheStats *stats) {
+    _entries.clear();
+    _entries.shrink_to_fit();
+    _entries.resize(entries);
+    _stats = stats;
+    clear();
+}
+
+void LittleFSDirCache::clear() {
+    for (auto &e : _entries) {
+        e.stamp = 0;
+        e.path = String();
+    }
+    _clock = 0;
+}
+
+bool LittleFSDirCache::_key(const char *path, char *key) {
+    size_t plen = strlen(path);
+    if (plen && (path[plen - 1] == '/')) {
+        return false;  // "file/" is an error, leave it to LittleFS
+    }
+    char *k = key;
+    while (*path) {
+        while (*path == '/') {
+            path++;
+        }
+        const char *end = strchr(path, '/');
+        if (!end) {
+            end = path + strlen(path);
+        }
+        size_t len = end - path;
+        if (!len) {
+            break;
+        }
+        if (((len == 1) && (path[0] == '.')) || ((len == 2) && (path[0] == '.') && (path[1] == '.'))) {
+            return false;
+        }
+        if ((size_t)(k - key) + 1 + len >= KEY_MAX) {
+            return false;  // Deeper than the cache bothers with
+        }
+        if (k != key) {
+            *k++ = '/';
+        }
+        memcpy(k, path, len);
+        k += len;
+        path = end;
+    }
+    *k = 0;
+    return k != key;
+}
+
+uint32_t LittleFSDirCache::_hash(const char *key) {
+    // FNV-1a
+    uint32_t h = 2166136261UL;
+    while (*key) {
+        h = (h ^ (uint8_t)*key++) * 16777619UL;
+    }
+    return h;
+}
+
+LittleFSDirCache::Entry *LittleFSDirCache::_find(const char *key, uint32_t hash) {
+    for (auto &e : _entries) {
+        if (e.stamp && (e.hash == hash) && (e.path == key)) {
+            return &e;
+        }
+    }
+    return nullptr;
+}
+
+bool LittleFSDirCache::lookup(const char *path, int *type) {
+    if (!enabled()) {
+        return false;
+    }
+    char key[KEY_MAX];
+    if (!_key(path, key)) {
+        return false;
+    }
+    Entry *e = _find(key, _hash(key));
+    if (_stats) {
+        if (e) {
+            _stats->hits++;
+        } else {
+            _stats->misses++;
+        }
+    }
+    if (!e) {
+        return false;
+    }
+    e->stamp = ++_clock;
+    *type = e->type;
+    return true;
+}
+
+void LittleFSDirCache::store(const char *path, int type) {
+    if (!enabled()) {
+        return;
+    }
+    char key[KEY_MAX];
+    if (!_key(path, key)) {
+        return;
+    }
+    uint32_t hash = _hash(key);
+    Entry *e = _find(key, hash);
+    if (!e) {
+        // Take a free slot, or the least recently used one
+        e = &_entries[0];
+        for (auto &x : _entries) {
+            if (x.stamp < e->stamp) {
+                e = &x;
+            }
+        }
+        if (e->stamp && _stats) {
+            _stats->evictions++;
+        }
+        e->hash = hash;
+        e->path = key;
+    }
+    e->type = type;
+    e->stamp = ++_clock;
+}
+
+void LittleFSDirCache::forget(const char *path, bool parents) {
+    if (!enabled()) {
+        return;
+    }
+    char key[KEY_MAX];
+    if (!_key(path, key)) {
+        if (parents && (strlen(path) >= KEY_MAX)) {
+            // The path itself was never cached but its parents could be
+            clear();
+        }
+        return;
+    }
+    while (true) {
+        Entry *e = _find(key, _hash(key));
+        if (e) {
+            e->stamp = 0;
+            e->path = String();
+        }
+        char *slash = strrchr(key, '/');
+        if (!parents || !slash) {
+            break;
+        }
+        *slash = 0;
+    }
+}
+
+
 int LittleFSImpl::lfs_flash_read(const struct lfs_config *c,
                                  lfs_block_t block, lfs_off_t off, void *dst, lfs_size_t size) {
     LittleFSImpl *me = reinterpret_cast<LittleFSImpl*>(c->context);
+    if (me->_dev) {
+        return me->_dev->read(block * me->_blockSize + off, dst, size) ? 0 : LFS_ERR_IO;
+    }
     //    Serial.printf(" READ: %p, %d\n", me->_start + (block * me->_blockSize) + off, size);
     memcpy(dst, me->_start + (block * me->_blockSize) + off, size);
     return 0;
@@ -181,6 +364,10 @@ int LittleFSImpl::lfs_flash_read(const struct lfs_config *c,
 int LittleFSImpl::lfs_flash_prog(const struct lfs_config *c,
                                  lfs_block_t block, lfs_off_t off, const void *buffer, lfs_size_t size) {
     LittleFSImpl *me = reinterpret_cast<LittleFSImpl*>(c->context);
+    if (me->_dev) {
+        // External flash doesn't share the XIP bus, so there's no need to stop the other core
+        return me->_dev->program(block * me->_blockSize + off, buffer, size) ? 0 : LFS_ERR_IO;
+    }
     uint8_t *addr = me->_start + (block * me->_blockSize) + off;
     noInterrupts();
     rp2040.idleOtherCore();
@@ -193,6 +380,9 @@ int LittleFSImpl::lfs_flash_prog(const struct lfs_config *c,
 
 int LittleFSImpl::lfs_flash_erase(const struct lfs_config *c, lfs_block_t block) {
     LittleFSImpl *me = reinterpret_cast<LittleFSImpl*>(c->context);
+    if (me->_dev) {
+        return me->_dev->erase(block * me->_blockSize, me->_blockSize) ? 0 : LFS_ERR_IO;
+    }
     uint8_t *addr = me->_start + (block * me->_blockSize);
     //    Serial.printf("ERASE: %p, %d\n", (intptr_t)addr - (intptr_t)XIP_BASE, me->_blockSize);
     noInterrupts();
@@ -204,8 +394,11 @@ int LittleFSImpl::lfs_flash_erase(const struct lfs_config *c, lfs_block_t block)
 }
 
 int LittleFSImpl::lfs_flash_sync(const struct lfs_config *c) {
-    /* NOOP */
-    (void) c;
+    LittleFSImpl *me = reinterpret_cast<LittleFSImpl*>(c->context);
+    if (me->_dev) {
+        return me->_dev->sync() ? 0 : LFS_ERR_IO;
+    }
+    /* NOOP for onboard flash */
     return 0;
 }
 
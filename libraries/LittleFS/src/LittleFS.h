@@ -26,8 +26,10 @@
 #pragma once
 
 #include <limits>
+#include <vector>
 #include <FS.h>
 #include <FSImpl.h>
+#include <FlashDevice.h>
 
 #define LFS_NAME_MAX 32
 #include "../lib/littlefs/lfs.h"
@@ -39,16 +41,88 @@ namespace littlefs_impl {
 class LittleFSFileImpl;
 class LittleFSDirImpl;
 
+// Directory entry cache counters, see LittleFSConfig::setDirCache().  The hit
+// rate is hits / (hits + misses); evictions climbing along with misses means
+// the cache is too small for the set of paths being looked up.
+typedef struct {
+    uint32_t hits;
+    uint32_t misses;
+    uint32_t evictions;
+} LittleFSCacheStats;
+
 class LittleFSConfig : public FSConfig {
 public:
     static constexpr uint32_t FSId = 0x4c495454;
     LittleFSConfig(bool autoFormat = true) : FSConfig(FSId, autoFormat) { }
+
+    // Store the filesystem on an external flash device instead of the onboard region
+    LittleFSConfig setFlashDevice(FlashDevice *dev) {
+        _dev = dev;
+        return *this;
+    }
+
+    // Remember whether up to entries recently used paths are a file, a directory,
+    // or missing, so exists(), open() and openDir() can skip the flash lookup.
+    // Costs about 24 bytes plus the path per entry.  If stats is given it's
+    // updated on every cached lookup.
+    LittleFSConfig setDirCache(uint16_t entries, LittleFSCacheStats *stats = nullptr) {
+        _dirCacheEntries = entries;
+        _dirCacheStats = stats;
+        return *this;
+    }
+
+    FlashDevice *_dev = nullptr;
+    uint16_t _dirCacheEntries = 0;
+    LittleFSCacheStats *_dirCacheStats = nullptr;
+};
+
+// LRU map of path to entry type.  Only the type is kept, so writing to a file
+// never invalidates anything, only creating, removing, or renaming does.
+class LittleFSDirCache {
+public:
+    static constexpr int MISSING = 0;  // Otherwise LFS_TYPE_REG or LFS_TYPE_DIR
+    // Longest canonical path cached, including the NUL, so keys fit on the stack
+    static constexpr size_t KEY_MAX = 4 * LFS_NAME_MAX;
+
+    LittleFSDirCache() : _stats(nullptr), _clock(0) { }
+
+    // Drops everything and resizes, 0 entries disables the cache
+    void setup(uint16_t entries, LittleFSCacheStats *stats);
+    void clear();
+    bool enabled() const {
+        return !_entries.empty();
+    }
+    // Returns true and sets type if path is cached
+    bool lookup(const char *path, int *type);
+    void store(const char *path, int type);
+    // Drops path and optionally every directory above it
+    void forget(const char *path, bool parents);
+
+protected:
+    typedef struct {
+        uint32_t hash;
+        uint32_t stamp;  // LRU clock, 0 for an unused slot
+        int      type;
+        String   path;
+    } Entry;
+
+    // Canonical form of path without leading or repeated slashes, into a
+    // KEY_MAX buffer.  Returns false for paths that can't be cached ("/",
+    // trailing slashes, ".", "..", or too long).
+    static bool _key(const char *path, char *key);
+    static uint32_t _hash(const char *key);
+    Entry *_find(const char *key, uint32_t hash);
+
+    std::vector<Entry>  _entries;
+    LittleFSCacheStats *_stats;
+    uint32_t            _clock;
 };
 
 class LittleFSImpl : public FSImpl {
 public:
     LittleFSImpl(uint8_t *start, uint32_t size, uint32_t pageSize, uint32_t blockSize, uint32_t maxOpenFds)
         : _start(start), _size(size), _pageSize(pageSize), _blockSize(blockSize), _maxOpenFds(maxOpenFds),
+          _dev(nullptr), _ownDev(nullptr), _flashSize(size), _flashPageSize(pageSize), _flashBlockSize(blockSize),
           _mounted(false) {
         memset(&_lfs, 0, sizeof(_lfs));
         memset(&_lfs_cfg, 0, sizeof(_lfs_cfg));
@@ -72,6 +146,12 @@ public:
         _lfs_cfg.attr_max = 0;
     }
 
+    // Geometry is read from the device (which must already be started) in begin()
+    LittleFSImpl(FlashDevice *dev, uint32_t maxOpenFds = 16) : LittleFSImpl(nullptr, 0, 256, 4096, maxOpenFds) {
+        _dev = dev;
+        _ownDev = dev;
+    }
+
     ~LittleFSImpl() {
         if (_mounted) {
             lfs_unmount(&_lfs);
@@ -85,9 +165,7 @@ public:
         if (!_mounted || !path || !path[0]) {
             return false;
         }
-        lfs_info info;
-        int rc = lfs_stat(&_lfs, path, &info);
-        return rc == 0;
+        return _lookupType(path) != LittleFSDirCache::MISSING;
     }
 
     bool rename(const char* pathFrom, const char* pathTo) override {
@@ -99,6 +177,8 @@ public:
             DEBUGV("lfs_rename: rc=%d, from=`%s`, to=`%s`\n", rc, pathFrom, pathTo);
             return false;
         }
+        // A renamed directory moves everything under it, so start over
+        _cache.clear();
         return true;
     }
 
@@ -139,6 +219,8 @@ public:
             return false;
         }
         // Now try and remove any empty subdirs this makes, silently
+        _cache.forget(path, true);
+        _cache.store(path, LittleFSDirCache::MISSING);
         char *pathStr = strdup(path);
         if (pathStr) {
             char *ptr = strrchr(pathStr, '/');
@@ -157,6 +239,9 @@ public:
             return false;
         }
         int rc = lfs_mkdir(&_lfs, path);
+        if (rc == 0) {
+            _cache.store(path, LFS_TYPE_DIR);
+        }
         if ((rc == 0) && _timeCallback) {
             time_t now = _timeCallback();
             // Add metadata with creation time to the directory marker
@@ -177,6 +262,8 @@ public:
             return false;
         }
         _cfg = *static_cast<const LittleFSConfig *>(&cfg);
+        // No device in the config means the storage this instance was made with
+        _dev = _cfg._dev ? _cfg._dev : _ownDev;
         return true;
     }
 
@@ -184,10 +271,12 @@ public:
         if (_mounted) {
             return true;
         }
+        _setGeometry();
         if (_size <= 0) {
             DEBUGV("LittleFS size is <= zero");
             return false;
         }
+        _cache.setup(_cfg._dirCacheEntries, _cfg._dirCacheStats);
         if (_tryMount()) {
             return true;
         }
@@ -203,9 +292,13 @@ public:
         }
         lfs_unmount(&_lfs);
         _mounted = false;
+        _cache.clear();
     }
 
     bool format() override {
+        if (!_mounted) {
+            _setGeometry();
+        }
         if (_size == 0) {
             DEBUGV("lfs size is zero\n");
             return false;
@@ -216,6 +309,7 @@ public:
             lfs_unmount(&_lfs);
             _mounted = false;
         }
+        _cache.clear();
 
         memset(&_lfs, 0, sizeof(_lfs));
         int rc = lfs_format(&_lfs, &_lfs_cfg);
@@ -286,6 +380,24 @@ protected:
         return _mounted;
     }
 
+    void _setGeometry() {
+        if (_dev) {
+            _size = _dev->size();
+            _pageSize = _dev->pageSize();
+            _blockSize = _dev->eraseSize();
+        } else {
+            _size = _flashSize;
+            _pageSize = _flashPageSize;
+            _blockSize = _flashBlockSize;
+        }
+        _lfs_cfg.block_size = _blockSize;
+        _lfs_cfg.block_count = _blockSize ? _size / _blockSize : 0;
+    }
+
+    // LFS_TYPE_REG, LFS_TYPE_DIR, or LittleFSDirCache::MISSING (also on errors),
+    // from the directory cache when possible
+    int _lookupType(const char *path);
+
     int _getUsedBlocks() {
         if (!_mounted) {
             return 0;
@@ -351,6 +463,14 @@ protected:
     uint32_t _pageSize;
     uint32_t _blockSize;
     uint32_t _maxOpenFds;
+    FlashDevice *_dev;  // Used instead of _start when set
+    FlashDevice *_ownDev;  // Passed to the constructor, if any
+    // Onboard region geometry from the constructor, for switching back from a device
+    uint32_t _flashSize;
+    uint32_t _flashPageSize;
+    uint32_t _flashBlockSize;
+
+    LittleFSDirCache _cache;
 
     bool     _mounted;
 };
@@ -517,9 +637,7 @@ public:
         if (!_opened || !_fd) {
             return false;
         }
-        lfs_info info;
-        int rc = lfs_stat(_fs->getFS(), fullName(), &info);
-        return (rc == 0) && (info.type == LFS_TYPE_REG);
+        return _fs->_lookupType(fullName()) == LFS_TYPE_REG;
     }
 
     bool isDirectory() const override {
@@ -528,9 +646,7 @@ public:
         } else if (!_fd) {
             return true;
         }
-        lfs_info info;
-        int rc = lfs_stat(_fs->getFS(), fullName(), &info);
-        return (rc == 0) && (info.type == LFS_TYPE_DIR);
+        return _fs->_lookupType(fullName()) == LFS_TYPE_DIR;
     }
 
 protected:
@@ -685,4 +801,5 @@ protected:
 #if !defined(NO_GLOBAL_INSTANCES) && !defined(NO_GLOBAL_LITTLEFS)
 extern FS LittleFS;
 using littlefs_impl::LittleFSConfig;
+using littlefs_impl::LittleFSCacheStats;
 #endif // ARDUINO
@@ -0,0 +1,4532 @@
+const unsigned char blink_lz4[] = {
+    0x04, 0x22, 0x4d, 0x18, 0x48, 0x40, 0x10, 0x11, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xd3, 0xa8, 0xca, 0x00, 0x00, 0xf0, 0x36, 0x00, 0xb5, 0x32,
+    0x4b, 0x21, 0x20, 0x58, 0x60, 0x98, 0x68, 0x02, 0x21, 0x88, 0x43, 0x98,
+    0x60, 0xd8, 0x60, 0x18, 0x61, 0x58, 0x61, 0x2e, 0x4b, 0x00, 0x21, 0x99,
+    0x60, 0x02, 0x21, 0x59, 0x61, 0x01, 0x21, 0xf0, 0x22, 0x99, 0x50, 0x2b,
+    0x49, 0x19, 0x60, 0x01, 0x21, 0x99, 0x60, 0x35, 0x20, 0x00, 0xf0, 0x44,
+    0xf8, 0x02, 0x22, 0x90, 0x42, 0x14, 0xd0, 0x06, 0x21, 0x19, 0x66, 0x00,
+    0xf0, 0x34, 0xf8, 0x19, 0x6e, 0x01, 0x0a, 0x00, 0xb0, 0x20, 0x18, 0x66,
+    0x1a, 0x66, 0x00, 0xf0, 0x2c, 0xf8, 0x19, 0x6e, 0x02, 0x00, 0xc0, 0x05,
+    0x20, 0x00, 0xf0, 0x2f, 0xf8, 0x01, 0x21, 0x08, 0x42, 0xf9, 0xd1, 0x4c,
+    0x00, 0xd1, 0x1b, 0x49, 0x19, 0x60, 0x00, 0x21, 0x59, 0x60, 0x1a, 0x49,
+    0x1b, 0x48, 0x01, 0x4c, 0x00, 0x51, 0xeb, 0x21, 0x19, 0x66, 0xa0, 0x44,
+    0x00, 0x20, 0x12, 0xf8, 0x22, 0x00, 0x33, 0x16, 0x49, 0x14, 0x1a, 0x00,
+    0xf7, 0x4e, 0x01, 0xbc, 0x00, 0x28, 0x00, 0xd0, 0x00, 0x47, 0x12, 0x48,
+    0x13, 0x49, 0x08, 0x60, 0x03, 0xc8, 0x80, 0xf3, 0x08, 0x88, 0x08, 0x47,
+    0x03, 0xb5, 0x99, 0x6a, 0x04, 0x20, 0x01, 0x42, 0xfb, 0xd0, 0x01, 0x20,
+    0x01, 0x42, 0xf8, 0xd1, 0x03, 0xbd, 0x02, 0xb5, 0x18, 0x66, 0x18, 0x66,
+    0xff, 0xf7, 0xf2, 0xff, 0x18, 0x6e, 0x18, 0x6e, 0x02, 0xbd, 0x00, 0x00,
+    0x02, 0x40, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03,
+    0x5f, 0x00, 0x21, 0x22, 0x00, 0x00, 0xf4, 0x00, 0x00, 0x18, 0x22, 0x20,
+    0x00, 0xa0, 0x00, 0x01, 0x00, 0x10, 0x08, 0xed, 0x00, 0xe0, 0x00, 0x01,
+    0x00, 0xff, 0x06, 0x74, 0xb2, 0x4e, 0x7a, 0x00, 0x20, 0x04, 0x20, 0xf7,
+    0x01, 0x00, 0x10, 0xc3, 0x01, 0x00, 0x10, 0xc5, 0x01, 0x00, 0x10, 0xc1,
+    0x04, 0x00, 0x08, 0x17, 0xc7, 0x0c, 0x00, 0x9f, 0xc9, 0x01, 0x00, 0x10,
+    0xcb, 0x01, 0x00, 0x10, 0xcd, 0x04, 0x00, 0x6c, 0x27, 0x00, 0xbe, 0x02,
+    0x00, 0xf0, 0x2a, 0xf0, 0x51, 0xf8, 0x10, 0x38, 0x00, 0xbe, 0xf2, 0xeb,
+    0x88, 0x71, 0xe0, 0x02, 0x00, 0x10, 0xfc, 0x02, 0x00, 0x10, 0x34, 0x02,
+    0x00, 0x10, 0x90, 0xa3, 0x1a, 0xe7, 0x00, 0x20, 0x24, 0x49, 0x08, 0x60,
+    0x06, 0xc8, 0x81, 0xf3, 0x08, 0x88, 0x10, 0x47, 0x22, 0x48, 0x00, 0x68,
+    0x00, 0x28, 0x35, 0xd1, 0x0d, 0xa4, 0x0e, 0xcc, 0x00, 0x29, 0x02, 0xd0,
+    0x84, 0x01, 0xf4, 0x05, 0xf9, 0xe7, 0x1d, 0x49, 0x1e, 0x4a, 0x00, 0x20,
+    0x00, 0xe0, 0x01, 0xc1, 0x91, 0x42, 0xfc, 0xd1, 0x1c, 0x49, 0x88, 0x47,
+    0x04, 0x00, 0xe0, 0x00, 0xbe, 0xfd, 0xe7, 0x01, 0xc9, 0x01, 0xc2, 0x9a,
+    0x42, 0xfb, 0xd3, 0x70, 0x47, 0x58, 0x00, 0xc0, 0xc0, 0x00, 0x00, 0x20,
+    0xb0, 0x22, 0x00, 0x20, 0xec, 0x24, 0x00, 0x10, 0x08, 0x00, 0xc0, 0xbc,
+    0x25, 0x00, 0x20, 0xf8, 0x27, 0x00, 0x10, 0x00, 0x00, 0x04, 0x20, 0x04,
+    0x00, 0x01, 0x0c, 0x00, 0x31, 0x10, 0x04, 0x20, 0x04, 0x00, 0xf3, 0x08,
+    0x00, 0x00, 0x00, 0x70, 0x47, 0x0b, 0x48, 0x00, 0xf0, 0x18, 0xf8, 0x00,
+    0x47, 0xef, 0xf3, 0x05, 0x80, 0xc0, 0xb2, 0x70, 0x47, 0x00, 0x00, 0x90,
+    0x01, 0x10, 0xd0, 0x3c, 0x00, 0xf2, 0x03, 0xcc, 0xd5, 0x00, 0x20, 0x85,
+    0x1e, 0x00, 0x20, 0x5d, 0x01, 0x00, 0x20, 0x99, 0x01, 0x00, 0x20, 0x57,
+    0x56, 0xa4, 0x01, 0xf2, 0x0b, 0x01, 0xb4, 0x02, 0x48, 0x84, 0x46, 0x01,
+    0xbc, 0x60, 0x47, 0x00, 0xbf, 0x0d, 0x1c, 0x00, 0x20, 0x06, 0x00, 0x52,
+    0x50, 0xab, 0xb3, 0x60, 0x53, 0x21, 0x25, 0x0c, 0x00, 0x53, 0x86, 0x1c,
+    0x03, 0x02, 0x2c, 0x0c, 0x00, 0xf0, 0x01, 0x54, 0x22, 0xa2, 0x9d, 0x30,
+    0x25, 0x00, 0x20, 0x05, 0x00, 0x52, 0x50, 0xde, 0x65, 0xf4, 0x68, 0x84,
+    0x00, 0xf0, 0x0a, 0xd4, 0x02, 0x00, 0x10, 0xc8, 0x02, 0x00, 0x10, 0xbc,
+    0x02, 0x00, 0x10, 0x3c, 0x25, 0x00, 0x20, 0xb0, 0x02, 0x00, 0x10, 0x48,
+    0x25, 0x00, 0x20, 0x54, 0xb0, 0x00, 0xf0, 0x08, 0xb5, 0xc0, 0x46, 0x04,
+    0x48, 0x05, 0x4b, 0x10, 0xb5, 0x83, 0x42, 0x03, 0xd0, 0x04, 0x4b, 0x00,
+    0x2b, 0x00, 0xd0, 0x98, 0x47, 0x10, 0xbd, 0x90, 0x00, 0x00, 0x04, 0x00,
+    0x00, 0x80, 0x00, 0xff, 0x01, 0x06, 0x48, 0x07, 0x49, 0x09, 0x1a, 0x8b,
+    0x10, 0xc9, 0x0f, 0xc9, 0x18, 0x10, 0xb5, 0x49, 0x10, 0x28, 0x00, 0x05,
+    0xf2, 0x0f, 0x10, 0xb5, 0x07, 0x4c, 0x23, 0x78, 0x00, 0x2b, 0x09, 0xd1,
+    0xff, 0xf7, 0xd5, 0xff, 0x05, 0x4b, 0x00, 0x2b, 0x02, 0xd0, 0x04, 0x48,
+    0x00, 0xe0, 0x00, 0xbf, 0x01, 0x23, 0x23, 0x70, 0x2c, 0x00, 0x00, 0x28,
+    0x00, 0x00, 0x2c, 0x01, 0x00, 0x72, 0x00, 0x71, 0x00, 0x2b, 0x03, 0xd0,
+    0x04, 0x49, 0x05, 0x22, 0x00, 0x80, 0xff, 0xf7, 0xcc, 0xff, 0x10, 0xbd,
+    0xc0, 0x46, 0x20, 0x00, 0x10, 0xc0, 0xa4, 0x00, 0xf0, 0x21, 0x22, 0x00,
+    0x20, 0xb0, 0xb5, 0x82, 0xb0, 0x00, 0xaf, 0x78, 0x60, 0x39, 0x60, 0x00,
+    0xf0, 0x19, 0xf8, 0x08, 0x4b, 0x08, 0x4a, 0x9a, 0x60, 0x07, 0x4b, 0x1d,
+    0x68, 0x07, 0x4b, 0x1b, 0x68, 0x1c, 0x00, 0x2b, 0x00, 0x9d, 0x46, 0xa0,
+    0x47, 0x00, 0x23, 0x18, 0x00, 0xbd, 0x46, 0x02, 0xb0, 0xb0, 0x3c, 0x00,
+    0x00, 0x4c, 0x01, 0xf0, 0xe8, 0x40, 0x00, 0x10, 0x04, 0x40, 0x00, 0x10,
+    0xfe, 0xe7, 0x00, 0x00, 0x70, 0xb5, 0x4c, 0x49, 0x08, 0x22, 0x4c, 0x48,
+    0x86, 0xb0, 0x01, 0xf0, 0xb9, 0xff, 0x4a, 0x49, 0x00, 0x28, 0x40, 0xd1,
+    0x01, 0x23, 0x0a, 0x00, 0x01, 0x24, 0x48, 0x4d, 0x5b, 0x42, 0x16, 0x78,
+    0x73, 0x40, 0x08, 0x26, 0x18, 0x00, 0x5b, 0x08, 0x20, 0x40, 0x00, 0xd0,
+    0x6b, 0x40, 0x01, 0x3e, 0x00, 0x2e, 0xf7, 0xd1, 0x42, 0x48, 0x01, 0x32,
+    0x82, 0x42, 0xf0, 0xd1, 0xa6, 0x22, 0xdb, 0x43, 0x92, 0x00, 0x8a, 0x58,
+    0x9a, 0x42, 0x26, 0xd1, 0x4b, 0x69, 0x00, 0x2b, 0x23, 0xd0, 0xa7, 0x22,
+    0x3c, 0x4c, 0x39, 0x49, 0x92, 0x00, 0x20, 0x00, 0x01, 0xf0, 0x8a, 0xff,
+    0x22, 0x69, 0xe1, 0x68, 0xa0, 0x68, 0x00, 0xf0, 0xcf, 0xf8, 0x00, 0x28,
+    0x15, 0xd0, 0x80, 0x25, 0x6d, 0x01, 0x35, 0x4b, 0x5b, 0x69, 0xb3, 0x42,
+    0x11, 0xd8, 0xef, 0xf3, 0x10, 0x84, 0x72, 0xb6, 0x80, 0x21, 0xc0, 0x20,
+    0x49, 0x01, 0x80, 0x01, 0x02, 0xf0, 0x66, 0xf8, 0x84, 0xf3, 0x10, 0x88,
+    0x00, 0x21, 0x64, 0x22, 0x08, 0x00, 0x01, 0xf0, 0xf3, 0xfd, 0x06, 0xb0,
+    0x70, 0xbd, 0xa3, 0x69, 0x01, 0x2b, 0x13, 0xd1, 0x20, 0x00, 0x1c, 0x30,
+    0x00, 0xf0, 0x00, 0xf9, 0x00, 0x28, 0xf4, 0xd0, 0xe0, 0x6d, 0x00, 0xf0,
+    0x4f, 0xf9, 0x00, 0x28, 0xef, 0xd0, 0x23, 0x6e, 0x00, 0x93, 0x63, 0x6e,
+    0x01, 0x93, 0x00, 0x9b, 0x00, 0x2b, 0x04, 0xd1, 0x00, 0xf0, 0x9c, 0xf9,
+    0x01, 0x36, 0x50, 0x34, 0xcf, 0xe7, 0x00, 0x9b, 0x02, 0x93, 0xab, 0x42,
+    0x00, 0xd9, 0x02, 0x95, 0x02, 0x98, 0x00, 0xf0, 0x6b, 0xf9, 0x03, 0x90,
+    0x00, 0x28, 0xd8, 0xd0, 0x2a, 0x00, 0x01, 0x99, 0x01, 0xf0, 0x4a, 0xff,
+    0x86, 0x00, 0xf0, 0x1a, 0xef, 0xf3, 0x10, 0x83, 0x05, 0x93, 0x72, 0xb6,
+    0xf0, 0x22, 0x12, 0x06, 0x94, 0x46, 0x01, 0x9b, 0x29, 0x00, 0x63, 0x44,
+    0x18, 0x00, 0x04, 0x93, 0x02, 0xf0, 0x24, 0xf8, 0x2a, 0x00, 0x03, 0x99,
+    0x04, 0x98, 0x02, 0xf0, 0x5b, 0xf8, 0x05, 0x9b, 0x83, 0x90, 0x00, 0xf2,
+    0x2e, 0x9b, 0x02, 0x9a, 0x9b, 0x1a, 0x80, 0x22, 0x52, 0x01, 0x94, 0x46,
+    0x00, 0x93, 0x01, 0x9b, 0x63, 0x44, 0x01, 0x93, 0xc5, 0xe7, 0xc0, 0x46,
+    0xdc, 0x23, 0x00, 0x20, 0x00, 0x30, 0x00, 0x10, 0x20, 0x83, 0xb8, 0xed,
+    0x98, 0x32, 0x00, 0x10, 0xf4, 0x26, 0x00, 0x20, 0x00, 0x20, 0x70, 0x47,
+    0x09, 0x4b, 0x10, 0xb5, 0x1a, 0x68, 0x51, 0x43, 0x08, 0x4a, 0x10, 0x68,
+    0x40, 0x18, 0xe4, 0x00, 0x00, 0x68, 0x00, 0x81, 0x19, 0x68, 0x80, 0x18,
+    0x01, 0xf0, 0xf4, 0xff, 0xe4, 0x00, 0xf6, 0x0c, 0x20, 0x10, 0xbd, 0xd8,
+    0x25, 0x00, 0x20, 0x90, 0x29, 0x00, 0x20, 0x0a, 0x48, 0x10, 0xb5, 0x04,
+    0x68, 0x4c, 0x43, 0xa4, 0x18, 0x09, 0x4a, 0x10, 0x68, 0x00, 0x19, 0x32,
+    0x00, 0x92, 0x80, 0x18, 0x19, 0x00, 0x02, 0x9a, 0x02, 0xf0, 0x16, 0x18,
+    0x01, 0x07, 0x34, 0x00, 0xf8, 0x09, 0x18, 0x00, 0x06, 0x4b, 0x10, 0xb5,
+    0x1c, 0x68, 0x05, 0x4b, 0x4c, 0x43, 0x19, 0x68, 0xa4, 0x18, 0x09, 0x19,
+    0x02, 0x9a, 0x01, 0xf0, 0xd4, 0xfe, 0x24, 0x00, 0xf0, 0x1f, 0x80, 0x23,
+    0x70, 0xb5, 0x07, 0x4d, 0x04, 0x00, 0x2a, 0x00, 0x05, 0x60, 0x06, 0x49,
+    0x5b, 0x01, 0x06, 0x48, 0x01, 0xf0, 0x3b, 0xf8, 0x23, 0x68, 0x2d, 0x18,
+    0x5a, 0x1c, 0x65, 0x60, 0x22, 0x60, 0x18, 0x78, 0x70, 0xbd, 0xc8, 0x2f,
+    0x00, 0x20, 0xdc, 0x25, 0x00, 0x20, 0x30, 0x26, 0xe0, 0x02, 0xf0, 0x67,
+    0x1d, 0x4b, 0x1d, 0x4e, 0x18, 0x60, 0x1d, 0x4b, 0x0d, 0x00, 0x19, 0x60,
+    0x17, 0x00, 0x00, 0x21, 0x78, 0x22, 0x30, 0x00, 0x01, 0xf0, 0xa3, 0xfe,
+    0x00, 0x23, 0x19, 0x4c, 0xa3, 0x64, 0x23, 0x60, 0x19, 0x4b, 0xe5, 0x61,
+    0x63, 0x60, 0x18, 0x4b, 0xa3, 0x60, 0x18, 0x4b, 0xe3, 0x60, 0x18, 0x4b,
+    0x23, 0x61, 0x80, 0x23, 0x5b, 0x00, 0x63, 0x61, 0xa3, 0x61, 0x00, 0x2d,
+    0x04, 0xd0, 0x29, 0x00, 0x38, 0x00, 0x01, 0xf0, 0xd8, 0xfd, 0x05, 0x00,
+    0x10, 0x23, 0x63, 0x62, 0xf0, 0x33, 0xa3, 0x62, 0xe3, 0x62, 0x10, 0x4b,
+    0x30, 0x00, 0x23, 0x63, 0x10, 0x4b, 0x21, 0x00, 0x63, 0x63, 0x0f, 0x4b,
+    0x25, 0x62, 0xa3, 0x63, 0x00, 0x23, 0xe3, 0x63, 0x23, 0x64, 0x63, 0x64,
+    0x00, 0xf0, 0x37, 0xfe, 0xc0, 0x43, 0xc0, 0x0f, 0xf8, 0xbd, 0xac, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0xb8, 0x00, 0xf0, 0x4b, 0xa8, 0x26, 0x00, 0x20,
+    0x4d, 0x03, 0x00, 0x20, 0x19, 0x03, 0x00, 0x20, 0xe9, 0x02, 0x00, 0x20,
+    0xe5, 0x02, 0x00, 0x20, 0xca, 0xd1, 0x00, 0x20, 0xca, 0xd0, 0x00, 0x20,
+    0xca, 0xd2, 0x00, 0x20, 0x00, 0x21, 0xf0, 0xb5, 0x21, 0x4b, 0x22, 0x4f,
+    0x19, 0x70, 0x22, 0x4e, 0x22, 0x4b, 0x85, 0xb0, 0x02, 0x00, 0x00, 0x93,
+    0x39, 0x00, 0x01, 0x23, 0x30, 0x00, 0x00, 0xf0, 0x0f, 0xff, 0x00, 0x28,
+    0x03, 0xda, 0x00, 0x25, 0x28, 0x00, 0x05, 0xb0, 0xf0, 0xbd, 0x02, 0x23,
+    0x39, 0x00, 0x30, 0x00, 0x03, 0xaa, 0x00, 0xf0, 0xc1, 0xff, 0x02, 0x28,
+    0xf3, 0xd1, 0x0e, 0x00, 0xf0, 0x23, 0x01, 0xf0, 0xc9, 0xf8, 0x6b, 0x46,
+    0x1b, 0x7b, 0x01, 0x25, 0x1f, 0x2b, 0xeb, 0xd1, 0x6b, 0x46, 0x5b, 0x7b,
+    0x8b, 0x2b, 0xe7, 0xd1, 0x01, 0xf0, 0xf2, 0xf9, 0x00, 0x23, 0x80, 0x22,
+    0x0f, 0x4c, 0x10, 0x49, 0x23, 0x60, 0x63, 0x60, 0x0f, 0x4b, 0x20, 0x00,
+    0x12, 0x02, 0xa3, 0x60, 0x01, 0xf0, 0xe7, 0xf9, 0xc2, 0x02, 0x62, 0x5b,
+    0xfb, 0x00, 0x28, 0x04, 0xd0, 0x40, 0x00, 0xe6, 0xa9, 0xf8, 0xce, 0xe7,
+    0x01, 0x4b, 0x1d, 0x70, 0xcc, 0xe7, 0xc0, 0x46, 0xc8, 0x50, 0x3c, 0x01,
+    0xe0, 0x6c, 0x25, 0x00, 0x20, 0xc0, 0x2a, 0x00, 0x20, 0xca, 0x50, 0x00,
+    0x20, 0x71, 0x03, 0x4c, 0x01, 0xf0, 0x3f, 0x13, 0x4b, 0x05, 0x00, 0x1c,
+    0x78, 0x00, 0x2c, 0x13, 0xd0, 0x80, 0x27, 0x7f, 0x01, 0x00, 0x2d, 0x19,
+    0xd0, 0x0f, 0x48, 0x10, 0x4b, 0x2e, 0x00, 0x43, 0x61, 0x83, 0x61, 0xbd,
+    0x42, 0x00, 0xd9, 0x3e, 0x00, 0x9b, 0x19, 0xc3, 0x61, 0x01, 0xf0, 0xc4,
+    0xf9, 0x01, 0x28, 0x0d, 0xd8, 0xad, 0x1b, 0xed, 0xe7, 0x23, 0x00, 0x02,
+    0x00, 0x08, 0x49, 0x09, 0x48, 0x01, 0xf0, 0x72, 0xf8, 0x2d, 0x1a, 0x6c,
+    0x42, 0x6c, 0x41, 0xe4, 0xb2, 0x20, 0x00, 0xf8, 0xbd, 0x00, 0x24, 0xfb,
+    0xe7, 0x6c, 0x00, 0x00, 0x60, 0x00, 0x26, 0xc8, 0x40, 0x74, 0x00, 0xa0,
+    0x0d, 0x4b, 0x70, 0xb5, 0x1b, 0x78, 0x05, 0x00, 0x0c, 0x4c, 0x48, 0x04,
+    0x60, 0x03, 0x00, 0x22, 0x00, 0x0b, 0x49, 0x36, 0x05, 0xf1, 0x10, 0x49,
+    0xff, 0xa8, 0x42, 0x0a, 0xd1, 0x20, 0x00, 0x70, 0xbd, 0x09, 0x48, 0x2d,
+    0x19, 0x44, 0x61, 0x84, 0x61, 0xc5, 0x61, 0x01, 0xf0, 0x90, 0xf9, 0x01,
+    0x28, 0xf4, 0xd9, 0x00, 0x20, 0xf3, 0x4c, 0x00, 0x08, 0x48, 0x00, 0x00,
+    0x58, 0x00, 0xc4, 0x10, 0xb5, 0x02, 0x49, 0x02, 0x48, 0x00, 0xf0, 0x25,
+    0xff, 0x10, 0xbd, 0x18, 0x00, 0xf5, 0xff, 0x1d, 0xf7, 0xb5, 0x0c, 0x24,
+    0x44, 0x43, 0x1e, 0x00, 0x22, 0x4b, 0x0d, 0x00, 0xe4, 0x18, 0x63, 0x68,
+    0x01, 0x92, 0xb3, 0x42, 0x00, 0xd2, 0x66, 0x60, 0xc0, 0x23, 0x07, 0x1f,
+    0x9b, 0x01, 0xff, 0xb2, 0x23, 0x43, 0x01, 0x2f, 0x26, 0xd8, 0x01, 0x2d,
+    0x24, 0xd1, 0x03, 0x22, 0x1a, 0x60, 0x2b, 0x00, 0xa2, 0x68, 0x1a, 0x42,
+    0xfc, 0xd0, 0x01, 0x9a, 0x23, 0x68, 0x80, 0x21, 0x52, 0x01, 0x5a, 0x40,
+    0xe0, 0x23, 0x49, 0x01, 0x1a, 0x40, 0x21, 0x43, 0x0a, 0x60, 0x01, 0x2f,
+    0x09, 0xd8, 0x03, 0x22, 0x23, 0x68, 0x6b, 0x40, 0x13, 0x40, 0x0b, 0x60,
+    0x01, 0x23, 0xab, 0x40, 0xa2, 0x68, 0x13, 0x42, 0xfc, 0xd0, 0x80, 0x23,
+    0x80, 0x22, 0x9b, 0x01, 0x23, 0x43, 0x12, 0x01, 0x01, 0x20, 0x1a, 0x60,
+    0x66, 0x60, 0xfe, 0xbd, 0x80, 0x22, 0x12, 0x01, 0x1a, 0x60, 0x07, 0x4b,
+    0x80, 0x00, 0xc1, 0x58, 0x00, 0x29, 0xd8, 0xd0, 0x58, 0x69, 0x01, 0xf0,
+    0xaf, 0xfc, 0x01, 0x30, 0x01, 0x38, 0xfd, 0xd1, 0xd1, 0xe7, 0xc0, 0x46,
+    0x00, 0x80, 0x00, 0x40, 0x94, 0x2a, 0x00, 0x20, 0x73, 0xb5, 0x0c, 0x20,
+    0x01, 0xf0, 0x9c, 0xfb, 0x01, 0xf0, 0xd2, 0xfa, 0x00, 0x28, 0x0a, 0xd0,
+    0x00, 0x23, 0x2a, 0x4a, 0x2a, 0x48, 0x99, 0x00, 0x01, 0x33, 0x88, 0x50,
+    0x0a, 0x2b, 0xfa, 0xd1, 0x28, 0x4b, 0x53, 0x62, 0x73, 0xbd, 0x28, 0x4c,
+    0xa0, 0x67, 0x01, 0xf0, 0xf1, 0xfb, 0x01, 0x22, 0x26, 0x4b, 0x1a, 0x60,
+    0x63, 0x6c, 0x01, 0x2b, 0xfc, 0xd1, 0x03, 0x22, 0x24, 0x4b, 0x1a, 0x60,
+    0xa5, 0x6b, 0x01, 0x2d, 0xfc, 0xd1, 0x02, 0x26, 0x05, 0x24, 0x29, 0x00,
+    0x06, 0x23, 0x21, 0x4a, 0x21, 0x48, 0x00, 0x96, 0x01, 0xf0, 0x26, 0xfb,
+    0x23, 0x00, 0x29, 0x00, 0x1f, 0x4a, 0x20, 0x48, 0x00, 0x94, 0x01, 0xf0,
+    0x1f, 0xfb, 0x80, 0x23, 0x31, 0x00, 0x00, 0x22, 0x5b, 0x00, 0x04, 0x20,
+    0xff, 0xf7, 0x78, 0xff, 0x80, 0x23, 0x29, 0x00, 0x00, 0x22, 0x20, 0x00,
+    0x5b, 0x00, 0xff, 0xf7, 0x71, 0xff, 0x00, 0x22, 0x80, 0x23, 0x11, 0x00,
+    0x5b, 0x00, 0x07, 0x20, 0xff, 0xf7, 0x6a, 0x0e, 0x00, 0x53, 0x08, 0x20,
+    0xff, 0xf7, 0x63, 0x0e, 0x00, 0x75, 0x9b, 0x01, 0x09, 0x20, 0xff, 0xf7,
+    0x5c, 0x1c, 0x00, 0x80, 0x06, 0x20, 0xff, 0xf7, 0x55, 0xff, 0xb3, 0xe7,
+    0xc0, 0x00, 0x80, 0x00, 0x6c, 0xdc, 0x02, 0x1b, 0xb7, 0x00, 0x00, 0xd0,
+    0x00, 0xf0, 0x25, 0x3c, 0xb0, 0x00, 0x40, 0x30, 0xb0, 0x00, 0x40, 0x00,
+    0x2f, 0x68, 0x59, 0x00, 0x80, 0x02, 0x40, 0x00, 0x8c, 0x86, 0x47, 0x00,
+    0xc0, 0x02, 0x40, 0x83, 0x05, 0x9b, 0x15, 0x01, 0x33, 0x02, 0x00, 0x58,
+    0x42, 0x58, 0x41, 0x80, 0x18, 0x80, 0x05, 0x80, 0x0d, 0x04, 0x30, 0x70,
+    0x47, 0x02, 0x00, 0x83, 0x6a, 0x28, 0x32, 0x10, 0x06, 0xf0, 0x27, 0x18,
+    0x68, 0x8b, 0x42, 0x01, 0xd1, 0x10, 0x60, 0x70, 0x47, 0x1a, 0x00, 0x03,
+    0x00, 0xf5, 0xe7, 0xf8, 0xb5, 0xc7, 0x69, 0x0d, 0x68, 0x08, 0x3f, 0x0e,
+    0x00, 0x00, 0x20, 0xbd, 0x42, 0x15, 0xd3, 0x39, 0x00, 0x28, 0x00, 0x01,
+    0xf0, 0x10, 0xfc, 0x01, 0x38, 0x01, 0xf0, 0x07, 0xfc, 0x02, 0x30, 0x80,
+    0x00, 0x39, 0x00, 0x28, 0x1a, 0x0c, 0x00, 0xf1, 0x01, 0x04, 0x00, 0x01,
+    0xf0, 0xfe, 0xfb, 0x67, 0x43, 0x80, 0x00, 0x28, 0x1a, 0xc0, 0x1b, 0x30,
+    0x60, 0x66, 0x02, 0xb0, 0x00, 0xf7, 0xb5, 0x0c, 0x00, 0x05, 0x00, 0x16,
+    0x00, 0x49, 0x6b, 0x5e, 0x00, 0xf1, 0xff, 0x11, 0x01, 0x2b, 0x21, 0xd1,
+    0x8e, 0x18, 0x25, 0xd4, 0x2b, 0x6f, 0xb3, 0x42, 0x22, 0xd3, 0x33, 0x00,
+    0x8e, 0x42, 0x17, 0xd0, 0x00, 0x91, 0xa8, 0x6e, 0x69, 0x46, 0xff, 0xf7,
+    0xca, 0xff, 0x01, 0xa9, 0x07, 0x00, 0xa8, 0x6e, 0x01, 0x96, 0xff, 0xf7,
+    0xc4, 0xff, 0x33, 0x00, 0x87, 0x42, 0x14, 0xd1, 0x62, 0x6c, 0x01, 0x99,
+    0x8a, 0x42, 0x10, 0xd8, 0xa0, 0x6c, 0x12, 0x18, 0x91, 0x42, 0x0c, 0xd2,
+    0x66, 0x63, 0xe1, 0x63, 0x18, 0x00, 0xfe, 0xbd, 0x0e, 0x00, 0x02, 0x2b,
+    0xdc, 0xd1, 0xe3, 0x6a, 0xd6, 0x18, 0xd9, 0xd5, 0x16, 0x23, 0x5b, 0x42,
+    0xf4, 0xe7, 0x22, 0x6b, 0x51, 0x03, 0x07, 0xd5, 0xd1, 0x02, 0x02, 0xd4,
+    0x01, 0x21, 0x49, 0x42, 0x21, 0x64, 0x02, 0x49, 0x0a, 0x40, 0x22, 0x63,
+    0x66, 0x63, 0xe7, 0xe7, 0xc0, 0x46, 0xff, 0xff, 0xfb, 0xff, 0xf0, 0xb5,
+    0x8b, 0xb0, 0x09, 0x92, 0x02, 0x68, 0x04, 0x93, 0x0d, 0x00, 0x13, 0x6a,
+    0x04, 0x99, 0x10, 0x9f, 0x08, 0x90, 0x8b, 0x42, 0x04, 0xd9, 0x12, 0x9b,
+    0xd2, 0x69, 0xfb, 0x18, 0x93, 0x42, 0x21, 0xd9, 0x54, 0x20, 0x40, 0x42,
+    0x7f, 0xe0, 0x04, 0x9b, 0x2a, 0x68, 0x12, 0x9c, 0x93, 0x42, 0x23, 0xd1,
+    0x6c, 0x68, 0xab, 0x68, 0xe6, 0x18, 0xb7, 0x42, 0x4e, 0xd2, 0xa7, 0x42,
+    0x17, 0xd3, 0x12, 0x9b, 0xf6, 0x1b, 0x9e, 0x42, 0x00, 0xd9, 0x1e, 0x00,
+    0xeb, 0x68, 0x39, 0x1b, 0x59, 0x18, 0x32, 0x00, 0x11, 0x98, 0x01, 0xf0,
+    0x46, 0xfc, 0x11, 0x9b, 0xbf, 0x19, 0x9b, 0x19, 0x11, 0x93, 0x12, 0x9b,
+    0x9b, 0x1b, 0x12, 0x93, 0x12, 0x9b, 0x00, 0x2b, 0xdd, 0xd1, 0x18, 0x00,
+    0x5b, 0xe0, 0x12, 0x9b, 0xe4, 0x1b, 0x9c, 0x42, 0x00, 0xd9, 0x1c, 0x00,
+    0x08, 0x9b, 0x38, 0x00, 0x1e, 0x68, 0x73, 0x69, 0x19, 0x00, 0x03, 0x93,
+    0x01, 0xf0, 0x73, 0xfb, 0x73, 0x68, 0x12, 0x9a, 0x06, 0x93, 0x09, 0x9b,
+    0x05, 0x91, 0x93, 0x42, 0x22, 0xd8, 0x00, 0x29, 0x20, 0xd1, 0x13, 0x00,
+    0x03, 0x9a, 0x93, 0x42, 0x1c, 0xd3, 0x11, 0xdc, 0x06, 0xf1, 0x3c, 0x62,
+    0xfb, 0x63, 0x1a, 0x30, 0x00, 0x05, 0x91, 0x03, 0x93, 0x00, 0x93, 0x3a,
+    0x00, 0x11, 0x9b, 0x04, 0x99, 0x06, 0x9e, 0xb0, 0x47, 0x00, 0x28, 0x31,
+    0xd1, 0x03, 0x9a, 0x11, 0x9b, 0x94, 0x46, 0x63, 0x44, 0x11, 0x93, 0x05,
+    0x9b, 0xbf, 0x18, 0x1c, 0x1b, 0x12, 0x9b, 0x1b, 0x19, 0xc4, 0xe7, 0x12,
+    0x9c, 0xcd, 0xe7, 0x04, 0x9b, 0x2b, 0x60, 0x05, 0x9b, 0xfb, 0x1a, 0x07,
+    0x93, 0x6b, 0x60, 0x09, 0x9b, 0x5c, 0x1e, 0x03, 0x9b, 0xe4, 0x18, 0xe4,
+    0x19, 0x19, 0x50, 0x00, 0x62, 0x3a, 0xfb, 0xf3, 0x69, 0x64, 0x1a, 0x8c,
+    0x00, 0x82, 0x05, 0x9b, 0xd9, 0x1b, 0xb3, 0x6a, 0x64, 0x18, 0x0e, 0x00,
+    0xf1, 0x76, 0xac, 0x60, 0x00, 0x94, 0x30, 0x00, 0xeb, 0x68, 0x07, 0x9a,
+    0x04, 0x99, 0x06, 0x9c, 0xa0, 0x47, 0x00, 0x28, 0x9e, 0xd0, 0x0b, 0xb0,
+    0xf0, 0xbd, 0xf0, 0xb5, 0x03, 0x68, 0x8d, 0xb0, 0x06, 0x93, 0x83, 0x68,
+    0x89, 0x05, 0x04, 0x00, 0x8f, 0x0d, 0x05, 0x93, 0xbb, 0x42, 0x00, 0xd9,
+    0x05, 0x97, 0x00, 0x25, 0x13, 0x68, 0x07, 0x93, 0x53, 0x68, 0x08, 0x93,
+    0x63, 0x68, 0x09, 0x93, 0x05, 0x9b, 0xab, 0x42, 0x06, 0xd8, 0xa3, 0x68,
+    0x00, 0x20, 0xbb, 0x42, 0x21, 0xd0, 0xbb, 0x42, 0x40, 0x41, 0x1d, 0xe0,
+    0x05, 0x9b, 0x5a, 0x1b, 0x16, 0x00, 0x08, 0x2a, 0x00, 0xd9, 0x08, 0x26,
+    0x06, 0x99, 0x0a, 0xab, 0x08, 0x00, 0x01, 0x93, 0x08, 0x9b, 0x02, 0x96,
+    0x5b, 0x19, 0x00, 0x93, 0x68, 0x30, 0x07, 0x9b, 0xff, 0xf7, 0x3b, 0xff,
+    0x00, 0x28, 0x0a, 0xd1, 0x09, 0x9b, 0x32, 0x00, 0x59, 0x19, 0x0a, 0xa8,
+    0x01, 0xf0, 0xad, 0x08, 0x05, 0x00, 0xb4, 0x05, 0xf0, 0x25, 0x01, 0x30,
+    0x0d, 0xb0, 0xf0, 0xbd, 0xad, 0x19, 0xd2, 0xe7, 0x10, 0xb5, 0xe0, 0x24,
+    0x03, 0x68, 0xe4, 0x00, 0x1b, 0x0d, 0x02, 0x00, 0x00, 0x20, 0x23, 0x42,
+    0x0d, 0xd0, 0x54, 0x68, 0x0b, 0x68, 0x01, 0x30, 0x9c, 0x42, 0x08, 0xd0,
+    0x92, 0x68, 0x49, 0x68, 0x8a, 0x42, 0x04, 0xd0, 0x8c, 0x42, 0x02, 0xd0,
+    0x9b, 0x1a, 0xc6, 0x02, 0xf0, 0xdf, 0x10, 0xbd, 0xf0, 0xb5, 0x97, 0xb0,
+    0x16, 0x00, 0x0d, 0x93, 0x13, 0x68, 0x82, 0x6e, 0x07, 0x00, 0x12, 0x6a,
+    0x0c, 0x00, 0x93, 0x42, 0x02, 0xd3, 0x54, 0x23, 0x5b, 0x42, 0xc3, 0xe0,
+    0x71, 0x68, 0x8a, 0x42, 0xf9, 0xd9, 0x01, 0x00, 0x00, 0x22, 0x04, 0x25,
+    0x68, 0x31, 0x07, 0x91, 0x10, 0xa9, 0x10, 0x92, 0x11, 0x92, 0x01, 0x91,
+    0x00, 0x92, 0x01, 0x00, 0x2a, 0x00, 0x07, 0x98, 0x02, 0x95, 0xff, 0xf7,
+    0xf1, 0xfe, 0x03, 0x1e, 0x04, 0x90, 0x01, 0xd0, 0x54, 0x33, 0x10, 0xd1,
+    0x02, 0x95, 0x00, 0x25, 0x11, 0xab, 0x01, 0x93, 0x00, 0x95, 0x73, 0x68,
+    0x04, 0x22, 0x39, 0x00, 0x07, 0x98, 0xff, 0xf7, 0xe1, 0xfe, 0x03, 0x00,
+    0x04, 0x90, 0xa8, 0x42, 0x04, 0xd0, 0x54, 0x33, 0x08, 0xd0, 0x04, 0x98,
+    0x17, 0xb0, 0xf0, 0xbd, 0x11, 0x9b, 0x10, 0x9a, 0x9b, 0x1a, 0xdd, 0x17,
+    0xed, 0x1a, 0xed, 0x0f, 0xab, 0x00, 0x9a, 0x59, 0x22, 0x60, 0x01, 0x22,
+    0x55, 0x40, 0xaa, 0x00, 0x92, 0x59, 0x0a, 0x95, 0x62, 0x60, 0x10, 0xaa,
+    0x9b, 0x58, 0xa3, 0x60, 0x00, 0x23, 0xe3, 0x60, 0x02, 0x33, 0x0c, 0x93,
+    0x03, 0x3b, 0x04, 0x93, 0xc5, 0x4b, 0x12, 0xaa, 0x03, 0xcb, 0x03, 0xc2,
+    0x21, 0x00, 0x01, 0x20, 0x04, 0x22, 0x08, 0x31, 0x40, 0x42, 0x00, 0xf0,
+    0xb7, 0xfd, 0x00, 0x23, 0x0b, 0x93, 0x08, 0x93, 0x01, 0x3b, 0x09, 0x93,
+    0x00, 0x23, 0x04, 0x9e, 0x0e, 0x90, 0x05, 0x93, 0x09, 0x98, 0xff, 0xf7,
+    0x2d, 0xfe, 0x05, 0x9b, 0xba, 0x6e, 0x1b, 0x18, 0x05, 0x93, 0x04, 0x23,
+    0x02, 0x93, 0x0f, 0xab, 0x01, 0x93, 0x05, 0x9b, 0x39, 0x00, 0x00, 0x93,
+    0xd2, 0x69, 0x23, 0x68, 0x90, 0x00, 0xf1, 0xd2, 0x99, 0xfe, 0x05, 0x1e,
+    0x06, 0xd0, 0x2b, 0x00, 0x54, 0x33, 0x00, 0xd0, 0x3d, 0xe1, 0x00, 0x23,
+    0xa3, 0x75, 0x1f, 0xe0, 0x04, 0x22, 0x0e, 0x98, 0x0f, 0xa9, 0x00, 0xf0,
+    0x8d, 0xfd, 0x0f, 0x9b, 0x09, 0x9a, 0x1b, 0xba, 0x5a, 0x40, 0x0e, 0x90,
+    0x06, 0x92, 0x0f, 0x92, 0x44, 0xd5, 0x09, 0x9b, 0xe0, 0x22, 0x1e, 0x0d,
+    0xa0, 0x23, 0xd2, 0x00, 0xdb, 0x00, 0x16, 0x40, 0x9e, 0x42, 0x06, 0xd1,
+    0xbb, 0x6e, 0xe0, 0x68, 0x99, 0x69, 0x01, 0xf0, 0x2d, 0xfa, 0x4d, 0x42,
+    0x4d, 0x41, 0x01, 0x20, 0x28, 0x40, 0xa0, 0x75, 0xe3, 0x68, 0x00, 0x2b,
+    0x00, 0xd1, 0x25, 0xe1, 0x38, 0x00, 0x21, 0x00, 0x3c, 0x30, 0xff, 0xf7,
+    0x3d, 0xff, 0x00, 0x28, 0x0d, 0xd0, 0xfb, 0x6b, 0x04, 0x9a, 0x1b, 0x03,
+    0x12, 0x03, 0x9b, 0x0d, 0x92, 0x0d, 0x9a, 0x42, 0x00, 0xd0, 0x08, 0xe1,
+    0x80, 0x23, 0x04, 0x9a, 0x1b, 0x06, 0x1a, 0x43, 0x04, 0x92, 0x1d, 0x9b,
+    0x00, 0x2b, 0x08, 0xd0, 0x04, 0x9b, 0xa2, 0x8a, 0x1b, 0x03, 0x9b, 0x0d,
+    0x93, 0x42, 0x00, 0xd9, 0x13, 0x00, 0x1d, 0x9a, 0x13, 0x80, 0x04, 0x9b,
+    0x00, 0x2b, 0x00, 0xdb, 0x6b, 0xe7, 0x18, 0x03, 0xa3, 0x8a, 0x80, 0x0d,
+    0x83, 0x42, 0x00, 0xd9, 0x0a, 0xe1, 0x00, 0x23, 0x04, 0x93, 0x62, 0xe7,
+    0x06, 0x98, 0xff, 0xf7, 0xbf, 0xfd, 0xbb, 0x6e, 0xda, 0x69, 0x05, 0x9b,
+    0xc0, 0x18, 0x90, 0x42, 0xa1, 0xd8, 0xe0, 0x20, 0x06, 0x9b, 0xc0, 0x00,
+    0x1b, 0x0d, 0xa0, 0x21, 0x03, 0x40, 0x04, 0x20, 0xc9, 0x00, 0x09, 0x90,
+    0x8b, 0x42, 0x3e, 0xd1, 0x14, 0xf2, 0x00, 0x40, 0x02, 0x90, 0x1b, 0x18,
+    0x88, 0x07, 0x02, 0xf4, 0x00, 0xf0, 0x1d, 0x1f, 0xfe, 0x05, 0x1e, 0x85,
+    0xd1, 0x14, 0x9b, 0x0e, 0x9a, 0x93, 0x42, 0x85, 0xd1, 0x0f, 0x9b, 0x06,
+    0x9a, 0x1b, 0x0d, 0xdb, 0x07, 0x5a, 0x40, 0x06, 0x92, 0x0e, 0xa9, 0x04,
+    0x22, 0xf8, 0x6a, 0x00, 0xf0, 0x10, 0xfd, 0xf8, 0x62, 0x0f, 0x98, 0xff,
+    0xf7, 0x8e, 0xfd, 0x5e, 0x00, 0xf0, 0x2b, 0x06, 0x9b, 0xe0, 0x60, 0x23,
+    0x61, 0x08, 0x9b, 0xa3, 0x82, 0x12, 0x9b, 0xa3, 0x61, 0x13, 0x9b, 0xe3,
+    0x61, 0x0b, 0x9b, 0xe3, 0x75, 0x01, 0x23, 0x5b, 0x42, 0x0e, 0x93, 0x33,
+    0x00, 0x06, 0x9a, 0x04, 0x96, 0x09, 0x92, 0x1e, 0x00, 0x47, 0xe7, 0x01,
+    0x22, 0x0e, 0x98, 0x14, 0xa9, 0x00, 0xf0, 0xf1, 0xfc, 0x09, 0x9b, 0x0e,
+    0x90, 0x01, 0x33, 0x09, 0x93, 0x44, 0x00, 0xf2, 0x0f, 0x6c, 0xfd, 0x09,
+    0x9a, 0x23, 0x68, 0x90, 0x42, 0x14, 0xd9, 0x01, 0x21, 0x02, 0x91, 0x14,
+    0xa9, 0x05, 0x98, 0x01, 0x91, 0x09, 0x99, 0xba, 0x6e, 0x09, 0x18, 0x00,
+    0x91, 0xd2, 0x69, 0x16, 0x02, 0xc0, 0xd6, 0xfd, 0x05, 0x1e, 0xdf, 0xd0,
+    0x03, 0x00, 0x54, 0x33, 0x7b, 0xd1, 0x84, 0x01, 0xf0, 0x05, 0xe0, 0x21,
+    0xe0, 0x20, 0x0f, 0x9b, 0xc9, 0x00, 0x1a, 0x0d, 0xc0, 0x00, 0x11, 0x40,
+    0x02, 0x42, 0x1f, 0xd1, 0x08, 0x9a, 0x1a, 0x01, 0xf0, 0x21, 0x9a, 0x42,
+    0x01, 0xd8, 0x01, 0x33, 0x08, 0x93, 0x0f, 0x99, 0x1c, 0x9b, 0x0d, 0x9a,
+    0x4b, 0x40, 0x1a, 0x40, 0x09, 0x92, 0x0d, 0x9a, 0x1a, 0x42, 0x49, 0xd1,
+    0x23, 0x68, 0x1f, 0x98, 0x14, 0x93, 0x05, 0x9b, 0x14, 0xaa, 0x04, 0x33,
+    0x15, 0x93, 0x1e, 0x9b, 0x98, 0x47, 0x05, 0x1e, 0x3a, 0xda, 0x52, 0x00,
+    0xf1, 0x44, 0x52, 0xd1, 0x09, 0x9b, 0x13, 0xe7, 0x80, 0x20, 0xc0, 0x00,
+    0x81, 0x42, 0x19, 0xd1, 0x08, 0x99, 0x52, 0xb2, 0x89, 0x18, 0x89, 0xb2,
+    0x35, 0x48, 0x08, 0x91, 0x35, 0x49, 0x30, 0x40, 0x01, 0x43, 0x8b, 0x42,
+    0x03, 0xd1, 0x80, 0x23, 0x1b, 0x06, 0x1e, 0x43, 0xd3, 0xe7, 0x71, 0x1c,
+    0xd1, 0xd0, 0x1b, 0x03, 0x31, 0x03, 0x9b, 0x0d, 0x89, 0x0d, 0x8b, 0x42,
+    0xcb, 0xd8, 0x92, 0x02, 0x96, 0x19, 0xc8, 0xe7, 0xc0, 0x23, 0xdb, 0x00,
+    0x99, 0x42, 0xc4, 0xd1, 0x01, 0x23, 0x1a, 0x40, 0x07, 0x33, 0x02, 0x93,
+    0x12, 0x54, 0x01, 0x62, 0x0b, 0x92, 0x04, 0x33, 0xba, 0x6e, 0x56, 0x01,
+    0x20, 0xd2, 0x69, 0xc6, 0x00, 0xf0, 0x1b, 0x73, 0xfd, 0x54, 0x30, 0xb1,
+    0xd1, 0xdc, 0xe6, 0x0f, 0x99, 0x00, 0x28, 0x03, 0xd1, 0x0e, 0x00, 0x33,
+    0x00, 0x04, 0x9e, 0x6f, 0xe7, 0x33, 0x00, 0x1c, 0x4a, 0x4b, 0x40, 0x13,
+    0x42, 0x0b, 0xd0, 0x02, 0x28, 0xf5, 0xd1, 0x32, 0x03, 0x0b, 0x03, 0x92,
+    0x0d, 0xca, 0x00, 0xf1, 0x16, 0xef, 0xd3, 0x80, 0x26, 0x36, 0x06, 0x0e,
+    0x43, 0xeb, 0xe7, 0x01, 0x26, 0x76, 0x42, 0xe8, 0xe7, 0x04, 0x95, 0x77,
+    0xe6, 0x04, 0x99, 0x01, 0x31, 0x00, 0xd1, 0xf7, 0xe6, 0x9a, 0x42, 0x00,
+    0xd8, 0xf4, 0xe6, 0x0f, 0x4a, 0x04, 0xa4, 0x04, 0xf2, 0x01, 0x04, 0x93,
+    0xee, 0xe6, 0x23, 0x68, 0x62, 0x68, 0x63, 0x60, 0x0a, 0x9b, 0x22, 0x60,
+    0x9b, 0x00, 0x12, 0x03, 0xf0, 0x04, 0x0c, 0x9b, 0x01, 0x2b, 0x00, 0xd1,
+    0x31, 0xe6, 0x01, 0x23, 0x0c, 0x93, 0x75, 0xe6, 0x02, 0x23, 0x2d, 0xe6,
+    0xf4, 0xf0, 0x0a, 0xf1, 0x05, 0xfc, 0x0f, 0x00, 0x00, 0x00, 0xf0, 0x4f,
+    0x00, 0xfc, 0xff, 0x7f, 0x00, 0xfc, 0xff, 0xff, 0xf0, 0xb5, 0x1c, 0x00,
+    0xcb, 0x82, 0x04, 0xf0, 0x03, 0x0b, 0x69, 0x06, 0x00, 0x3c, 0x30, 0x0b,
+    0x93, 0x0f, 0x00, 0x09, 0x92, 0xff, 0xf7, 0xf3, 0xfd, 0x09, 0x9b, 0x52,
+    0x01, 0xf1, 0x06, 0x08, 0x93, 0x00, 0x23, 0x05, 0x93, 0x98, 0x42, 0x10,
+    0xd0, 0x08, 0x9b, 0x00, 0x2b, 0x0d, 0xd0, 0xf3, 0x6b, 0x1a, 0x03, 0x23,
+    0xa2, 0x00, 0xc0, 0x93, 0x42, 0x9b, 0x41, 0x80, 0x22, 0xd2, 0x00, 0x13,
+    0x40, 0x38, 0x4a, 0x86, 0x00, 0xf1, 0x10, 0x05, 0x93, 0x0b, 0x9d, 0x28,
+    0x00, 0xff, 0xf7, 0x84, 0xfc, 0x06, 0x9a, 0x03, 0x1d, 0x93, 0x42, 0x32,
+    0xd8, 0x06, 0x9b, 0x31, 0x00, 0x1b, 0x1a, 0x06, 0x93, 0x33, 0x00, 0x68,
+    0x33, 0x07, 0x60, 0x03, 0xf0, 0x13, 0x0b, 0xab, 0x01, 0x93, 0x06, 0x9b,
+    0x04, 0x22, 0x00, 0x93, 0x07, 0x98, 0x3b, 0x68, 0xff, 0xf7, 0xea, 0xfc,
+    0x01, 0x1e, 0x20, 0xd1, 0x0b, 0x9b, 0x1b, 0xba, 0x6b, 0x40, 0x5b, 0x00,
+    0x5b, 0x08, 0x0b, 0x93, 0x66, 0x00, 0xf0, 0x25, 0x1f, 0xd0, 0xe0, 0x21,
+    0x80, 0x22, 0x2b, 0x0d, 0xc9, 0x00, 0xd2, 0x00, 0x19, 0x40, 0x91, 0x42,
+    0x17, 0xd1, 0x05, 0x9a, 0xa1, 0x1a, 0x08, 0x03, 0x2a, 0x03, 0x80, 0x0d,
+    0x92, 0x0d, 0x90, 0x42, 0x0f, 0xd3, 0x1d, 0x4a, 0x11, 0x40, 0x1d, 0x4a,
+    0x11, 0x43, 0xa9, 0x42, 0x04, 0xd1, 0x02, 0x21, 0x49, 0x42, 0x08, 0x00,
+    0xd0, 0x04, 0xf2, 0x13, 0x05, 0x9a, 0x5b, 0xb2, 0x9b, 0x02, 0x9b, 0x18,
+    0x05, 0x93, 0x05, 0x9b, 0x09, 0x9a, 0xe3, 0x1a, 0x6b, 0x40, 0x1a, 0x42,
+    0xb4, 0xd1, 0xac, 0x05, 0xa3, 0x15, 0x01, 0x33, 0xeb, 0xd0, 0x14, 0x9b,
+    0xa4, 0x0d, 0x8c, 0x05, 0xf0, 0x22, 0x13, 0x9b, 0x06, 0x9a, 0x01, 0x93,
+    0x12, 0x9b, 0x31, 0x00, 0x04, 0x33, 0x9b, 0x18, 0x00, 0x93, 0x22, 0x00,
+    0x3b, 0x68, 0x07, 0x98, 0x02, 0x94, 0xff, 0xf7, 0xa2, 0xfc, 0x01, 0x1e,
+    0xd8, 0xd1, 0x14, 0x9b, 0x1a, 0x1b, 0x13, 0x9b, 0x18, 0x19, 0x01, 0xf0,
+    0x06, 0xf9, 0x05, 0x9b, 0x59, 0x19, 0xcf, 0xb8, 0x08, 0x32, 0xfc, 0xff,
+    0xff, 0x3c, 0x01, 0xf0, 0x03, 0x10, 0x40, 0x1f, 0xb5, 0x9c, 0x05, 0xa4,
+    0x0d, 0x02, 0x94, 0x06, 0x9c, 0x01, 0x94, 0x00, 0x24, 0x00, 0x94, 0x24,
+    0x08, 0x20, 0x04, 0xb0, 0x1c, 0x05, 0xf0, 0x01, 0x91, 0xb0, 0x0a, 0x93,
+    0x13, 0x68, 0x06, 0x00, 0x06, 0x93, 0x0a, 0x9b, 0x05, 0x91, 0x0b, 0x92,
+    0x16, 0x0e, 0xf0, 0x13, 0x4b, 0x4b, 0x0a, 0x9a, 0x13, 0x80, 0x32, 0x6a,
+    0x05, 0x9b, 0x49, 0x4c, 0x9a, 0x61, 0x72, 0x6a, 0xda, 0x61, 0x48, 0x4d,
+    0x06, 0x98, 0x29, 0x00, 0x01, 0xf0, 0x91, 0xf9, 0x06, 0x9b, 0x29, 0x00,
+    0x1f, 0x18, 0x76, 0x0b, 0xf0, 0x1b, 0x71, 0xf9, 0x07, 0x90, 0x01, 0x28,
+    0x06, 0xd1, 0x3b, 0x78, 0x2e, 0x2b, 0x0d, 0xd1, 0x07, 0x9b, 0xfb, 0x18,
+    0x06, 0x93, 0xea, 0xe7, 0x07, 0x9b, 0x02, 0x2b, 0x06, 0xd1, 0x02, 0x22,
+    0x38, 0x00, 0x3c, 0x49, 0x01, 0xf0, 0xcd, 0xf8, 0x00, 0x28, 0xf1, 0xd0,
+    0x1c, 0x00, 0xf0, 0x0d, 0x1d, 0x00, 0x06, 0x93, 0x01, 0x23, 0x08, 0x93,
+    0x28, 0x00, 0x35, 0x49, 0x01, 0xf0, 0x6d, 0xf9, 0x2d, 0x18, 0x28, 0x00,
+    0x33, 0x49, 0x01, 0xf0, 0x4e, 0xf9, 0x09, 0x90, 0x1e, 0x0d, 0xf0, 0x09,
+    0x02, 0x28, 0x0d, 0xd1, 0x02, 0x22, 0x28, 0x00, 0x2f, 0x49, 0x01, 0xf0,
+    0xb2, 0xf8, 0x00, 0x28, 0x06, 0xd1, 0x08, 0x9b, 0x01, 0x3b, 0x08, 0x93,
+    0x66, 0x0d, 0x60, 0xab, 0x1c, 0xd1, 0xe7, 0x08, 0x9b, 0x26, 0x03, 0xf0,
+    0x0b, 0x09, 0x9b, 0xed, 0x18, 0xdd, 0xe7, 0x3b, 0x78, 0x00, 0x2b, 0x3d,
+    0xd0, 0x0b, 0x9b, 0x1f, 0x60, 0x23, 0x0d, 0x02, 0x2b, 0x3b, 0xd1, 0x1f,
+    0x4b, 0x24, 0x03, 0x2a, 0x01, 0x80, 0x25, 0xd1, 0xf0, 0x25, 0xed, 0x05,
+    0x2f, 0x21, 0x9e, 0x00, 0xf0, 0x2b, 0xb8, 0xf8, 0x42, 0x42, 0x50, 0x41,
+    0x0d, 0xaa, 0x03, 0x92, 0x1b, 0x4a, 0x0a, 0x9b, 0x07, 0x99, 0x40, 0x42,
+    0x02, 0x92, 0x05, 0x9a, 0x03, 0x40, 0x0f, 0x91, 0x01, 0x93, 0x00, 0x91,
+    0x2b, 0x00, 0x30, 0x00, 0x05, 0x99, 0x18, 0x32, 0x0d, 0x96, 0x0e, 0x97,
+    0xff, 0xf7, 0xee, 0xfc, 0x04, 0x1e, 0x15, 0xdb, 0x00, 0x28, 0x8b, 0xd1,
+    0x05, 0x9b, 0xdb, 0x7d, 0xa4, 0x07, 0xf1, 0x33, 0x02, 0x3c, 0x0d, 0xe0,
+    0x0e, 0x4b, 0xa4, 0x02, 0x1c, 0x43, 0x05, 0x9b, 0x30, 0x00, 0x18, 0x33,
+    0x00, 0x93, 0x0c, 0x4a, 0x23, 0x00, 0x05, 0x99, 0xff, 0xf7, 0x5a, 0xff,
+    0x04, 0x1e, 0xcb, 0xda, 0x20, 0x00, 0x11, 0xb0, 0xf0, 0xbd, 0x14, 0x24,
+    0x64, 0x42, 0xf9, 0xe7, 0xff, 0x03, 0x00, 0x00, 0x00, 0xfc, 0x2f, 0x00,
+    0xe5, 0x23, 0x00, 0x20, 0xe7, 0x23, 0x00, 0x20, 0x55, 0x09, 0x00, 0x20,
+    0x08, 0x00, 0xb8, 0x02, 0xf0, 0x03, 0x70, 0xf0, 0xb5, 0x04, 0x00, 0x81,
+    0x66, 0x08, 0x6b, 0x99, 0xb0, 0xe0, 0x60, 0x00, 0x28, 0x03, 0xd0, 0x4b,
+    0xe8, 0x08, 0xf0, 0x3e, 0xd1, 0xe3, 0x61, 0x0c, 0x20, 0x40, 0x42, 0xcd,
+    0xe0, 0x01, 0x25, 0x8a, 0x6a, 0xe3, 0x61, 0xff, 0x21, 0x01, 0xf0, 0x2b,
+    0xf8, 0xa3, 0x6e, 0x6d, 0x42, 0x9a, 0x6a, 0xff, 0x21, 0xe0, 0x69, 0x25,
+    0x60, 0x01, 0xf0, 0x23, 0xf8, 0xa3, 0x6e, 0x25, 0x61, 0x9a, 0x6b, 0x00,
+    0x2a, 0x01, 0xd1, 0x62, 0x66, 0xe7, 0xe7, 0x62, 0x66, 0xda, 0x6b, 0x00,
+    0x2a, 0x4a, 0xd0, 0xe2, 0x66, 0x1a, 0x6c, 0x00, 0x2a, 0x48, 0xd0, 0x5b,
+    0x6c, 0x22, 0x67, 0x00, 0x2b, 0x46, 0xd0, 0x63, 0x67, 0xb4, 0x04, 0xf0,
+    0x0f, 0x23, 0x62, 0x63, 0x62, 0x23, 0x00, 0x00, 0x25, 0x26, 0x00, 0x3c,
+    0x33, 0x18, 0x00, 0x0c, 0x22, 0x29, 0x00, 0xa5, 0x62, 0xe5, 0x62, 0x30,
+    0x36, 0x04, 0x93, 0x00, 0xf0, 0xfe, 0xff, 0x10, 0x00, 0x00, 0xac, 0x0c,
+    0x31, 0xf9, 0xff, 0x20, 0x1c, 0x00, 0xf0, 0xc3, 0x48, 0x30, 0x00, 0xf0,
+    0xf3, 0xff, 0x1c, 0x22, 0x29, 0x00, 0x10, 0xa8, 0x00, 0xf0, 0xee, 0xff,
+    0x01, 0x23, 0x17, 0x93, 0x16, 0x9b, 0x01, 0x33, 0x02, 0xd0, 0x17, 0x9b,
+    0x01, 0x33, 0x1e, 0xd1, 0x23, 0x6a, 0x01, 0x33, 0x50, 0xd0, 0x63, 0x6a,
+    0x01, 0x33, 0x4d, 0xd0, 0x22, 0x6b, 0xd3, 0x0f, 0x9b, 0x18, 0x23, 0x63,
+    0x04, 0x9b, 0x07, 0xce, 0x07, 0xc3, 0xa3, 0x6e, 0xe0, 0x6a, 0x1d, 0x6a,
+    0x29, 0x00, 0x00, 0xf0, 0x1f, 0xff, 0x00, 0x20, 0x61, 0x65, 0xa0, 0x65,
+    0xe0, 0x65, 0x25, 0x66, 0x69, 0xe0, 0xff, 0x22, 0xb2, 0xe7, 0x3c, 0x4a,
+    0xb4, 0xe7, 0x3c, 0x4b, 0xb6, 0xe7, 0xa3, 0x6e, 0x1b, 0x6a, 0x5b, 0x08,
+    0xab, 0x42, 0x00, 0xd8, 0x6c, 0xe0, 0x07, 0xab, 0x03, 0x93, 0x38, 0x4b,
+    0x38, 0x4a, 0x02, 0x93, 0x00, 0x23, 0x08, 0x92, 0x08, 0x22, 0x01, 0x93,
+    0x36, 0x4b, 0x09, 0x92, 0x00, 0x93, 0x20, 0x00, 0x35, 0x4b, 0x16, 0xaa,
+    0x10, 0xa9, 0x01, 0x35, 0x07, 0x94, 0xff, 0xf7, 0x2f, 0xfc, 0x00, 0x28,
+    0x47, 0xdb, 0x39, 0xd0, 0x80, 0x05, 0x80, 0x15, 0x43, 0x1c, 0x35, 0xd0,
+    0x10, 0x9b, 0x0a, 0xaf, 0x23, 0x62, 0x11, 0x9b, 0x20, 0x00, 0x05, 0x93,
+    0x63, 0x62, 0x2b, 0x4a, 0x2b, 0x4b, 0x00, 0x97, 0x10, 0xa9, 0xff, 0xf7,
+    0x9d, 0xfe, 0x00, 0x28, 0x33, 0xdb, 0x0a, 0x9b, 0x9a, 0xb2, 0x1b, 0x0c,
+    0x02, 0x2b, 0x01, 0xd0, 0x16, 0x20, 0x5c, 0xe7, 0x00, 0x2a, 0xfb, 0xd1,
+    0xfb, 0x68, 0x3c, 0x0a, 0xa0, 0xe2, 0x6e, 0x93, 0x42, 0xf5, 0xd8, 0xe3,
+    0x66, 0x3b, 0x69, 0x0e, 0x00, 0x91, 0x22, 0x6f, 0x93, 0x42, 0xee, 0xd8,
+    0x23, 0x67, 0x7b, 0x0e, 0x00, 0xf0, 0x0d, 0x62, 0x6f, 0x93, 0x42, 0xe7,
+    0xd8, 0x63, 0x67, 0xa3, 0x6e, 0xba, 0x68, 0x19, 0x6a, 0x8a, 0x42, 0xe1,
+    0xd1, 0x7a, 0x68, 0xdb, 0x69, 0x9a, 0x42, 0xdd, 0xd1, 0x0a, 0xab, 0x8e,
+    0x00, 0x40, 0x14, 0x4b, 0x14, 0x4a, 0x62, 0x00, 0xf0, 0x27, 0x6c, 0xfe,
+    0x00, 0x28, 0x04, 0xda, 0x83, 0x1c, 0x00, 0xd1, 0x76, 0xe7, 0x19, 0xb0,
+    0xf0, 0xbd, 0x23, 0x6b, 0x0a, 0x9a, 0x53, 0x40, 0x23, 0x63, 0x0b, 0x9a,
+    0x63, 0x6b, 0x53, 0x40, 0x63, 0x63, 0x0c, 0x9a, 0xa3, 0x6b, 0x53, 0x40,
+    0xa3, 0x63, 0x67, 0xe7, 0x54, 0x20, 0x1e, 0xe7, 0xff, 0xff, 0xff, 0x7f,
+    0xfe, 0x03, 0x00, 0x00, 0xf0, 0x01, 0x20, 0xea, 0x23, 0xf4, 0x01, 0x20,
+    0xf0, 0x0f, 0xa4, 0x04, 0xf0, 0x5f, 0x18, 0x00, 0x10, 0x20, 0x0c, 0x00,
+    0xf0, 0x7f, 0x00, 0x00, 0xf0, 0x7f, 0xf0, 0xb5, 0x0f, 0x00, 0x0b, 0x63,
+    0x00, 0x23, 0x89, 0xb0, 0x07, 0x92, 0x0e, 0x9a, 0x08, 0x37, 0x0a, 0x65,
+    0x4b, 0x63, 0xcb, 0x63, 0xcb, 0x64, 0x0c, 0x00, 0x0b, 0x1d, 0x07, 0xaa,
+    0x39, 0x00, 0x06, 0x00, 0xff, 0xf7, 0x3d, 0xfe, 0x05, 0x1e, 0x08, 0xda,
+    0x83, 0x1c, 0x61, 0xd1, 0x4a, 0x4b, 0xa2, 0x88, 0x9a, 0x42, 0x02, 0xd1,
+    0x02, 0x25, 0x6d, 0x42, 0x5a, 0xe0, 0x01, 0x23, 0xa3, 0x71, 0xb3, 0x6a,
+    0x23, 0x60, 0xb4, 0x62, 0xab, 0x1c, 0xf5, 0xd0, 0x6d, 0x00, 0x6d, 0x0d,
+    0x01, 0x2d, 0x00, 0xd0, 0x7c, 0xe0, 0xa2, 0x88, 0x41, 0x4b, 0x92, 0x02,
+    0x13, 0x43, 0x22, 0x00, 0x28, 0x32, 0x00, 0x92, 0x24, 0x0e, 0x60, 0x3e,
+    0x4a, 0xff, 0xf7, 0x0e, 0xfe, 0x72, 0x10, 0xf1, 0x17, 0x00, 0xda, 0x6e,
+    0xe0, 0x00, 0x23, 0x05, 0x95, 0x04, 0x93, 0x23, 0x6d, 0x04, 0x9a, 0x99,
+    0x68, 0x8a, 0x42, 0x14, 0xd3, 0x18, 0x68, 0xe0, 0x64, 0x00, 0x28, 0x37,
+    0xd0, 0xb3, 0x6e, 0xff, 0x21, 0x9a, 0x6a, 0x00, 0xf0, 0xf5, 0xfe, 0x34,
+    0x02, 0xb0, 0x64, 0x31, 0x4a, 0x03, 0x9b, 0x1b, 0x0d, 0x93, 0x42, 0x2c,
+    0xd0, 0xc0, 0x0e, 0xf2, 0x25, 0x09, 0xb0, 0xf0, 0xbd, 0x22, 0x6b, 0x05,
+    0x99, 0x0a, 0x42, 0x03, 0xd1, 0x04, 0x9b, 0x01, 0x33, 0x04, 0x93, 0xdd,
+    0xe7, 0x0c, 0x22, 0xc0, 0x20, 0x04, 0x99, 0x5b, 0x68, 0x4a, 0x43, 0x9a,
+    0x18, 0xa3, 0x88, 0x91, 0x68, 0x9b, 0x02, 0x0b, 0x43, 0x11, 0x78, 0x80,
+    0x00, 0x52, 0x68, 0x09, 0x18, 0x09, 0x05, 0x0b, 0x43, 0x7e, 0x00, 0xf0,
+    0x62, 0x20, 0x4a, 0xff, 0xf7, 0xcf, 0xfd, 0x05, 0x1e, 0xe3, 0xda, 0x83,
+    0x1c, 0xe1, 0xd0, 0x21, 0x00, 0x30, 0x00, 0xff, 0xf7, 0xe6, 0xf9, 0xd5,
+    0xe7, 0x0c, 0x25, 0x9b, 0xe7, 0x03, 0x9b, 0x21, 0x6b, 0x98, 0x05, 0x80,
+    0x23, 0x5b, 0x03, 0x0b, 0x43, 0x23, 0x63, 0x00, 0x23, 0x02, 0x22, 0x63,
+    0x64, 0xb3, 0x6e, 0x52, 0x42, 0x9b, 0x6a, 0x80, 0x0d, 0xa2, 0x62, 0xe0,
+    0x62, 0x22, 0x64, 0xa3, 0x64, 0xbf, 0xd0, 0xa2, 0x88, 0x10, 0x49, 0x92,
+    0x02, 0x8b, 0x42, 0x00, 0xd9, 0x0b, 0x00, 0x13, 0x43, 0x80, 0x22, 0x92,
+    0x05, 0x13, 0x43, 0xe2, 0x6c, 0x39, 0x00, 0x00, 0x92, 0x30, 0x00, 0x07,
+    0x4a, 0xff, 0xf7, 0xa0, 0xfd, 0x05, 0x1e, 0xac, 0xda, 0xd1, 0xe7, 0x15,
+    0x25, 0x72, 0xe7, 0x03, 0x9d, 0xcd, 0xb4, 0x0b, 0x34, 0x03, 0x00, 0x00,
+    0x64, 0x03, 0x20, 0x01, 0x02, 0x80, 0x03, 0x02, 0x8c, 0x01, 0x60, 0x10,
+    0xb5, 0xff, 0xf7, 0xa8, 0xf9, 0x92, 0x10, 0x20, 0x00, 0x00, 0xf8, 0x09,
+    0xf0, 0x65, 0x0c, 0x00, 0x0a, 0x92, 0x4a, 0x6b, 0xc9, 0x6a, 0x07, 0x00,
+    0x00, 0x20, 0x8a, 0x42, 0x00, 0xd3, 0xe4, 0xe0, 0x8a, 0x1a, 0x08, 0x92,
+    0x9a, 0x42, 0x00, 0xd9, 0x08, 0x93, 0x08, 0x9b, 0x06, 0x93, 0x06, 0x9b,
+    0x00, 0x2b, 0x01, 0xd1, 0x08, 0x98, 0xd8, 0xe0, 0x80, 0x22, 0x23, 0x6b,
+    0xd2, 0x02, 0xb8, 0x6e, 0x13, 0x42, 0x03, 0xd0, 0xe2, 0x6b, 0xc1, 0x69,
+    0x8a, 0x42, 0x13, 0xd1, 0x80, 0x21, 0x49, 0x03, 0x62, 0x6b, 0x0b, 0x42,
+    0x79, 0xd1, 0xa1, 0x6a, 0xe3, 0x6a, 0x13, 0x91, 0x14, 0x92, 0x00, 0x2b,
+    0x3b, 0xd1, 0x01, 0x22, 0x52, 0x42, 0xa2, 0x63, 0xe3, 0x63, 0x80, 0x23,
+    0x22, 0x6b, 0xdb, 0x02, 0x13, 0x43, 0x23, 0x63, 0xbb, 0x6e, 0xe6, 0x6b,
+    0xdb, 0x69, 0x06, 0x9a, 0x09, 0x93, 0x9b, 0x1b, 0x05, 0x93, 0xec, 0x08,
+    0x20, 0x05, 0x92, 0x50, 0x00, 0xf1, 0x76, 0x52, 0x03, 0x13, 0x42, 0x00,
+    0xd1, 0xac, 0xe0, 0x23, 0x00, 0x08, 0x33, 0x10, 0x93, 0xa3, 0x88, 0x5e,
+    0x4a, 0x9b, 0x02, 0x1a, 0x43, 0x05, 0x9b, 0x11, 0x92, 0x09, 0x9a, 0xf3,
+    0x18, 0x9a, 0x42, 0x00, 0xd2, 0xaf, 0xe0, 0x0a, 0x9b, 0x0b, 0x93, 0x05,
+    0x9b, 0x07, 0x93, 0x07, 0x9b, 0x00, 0x2b, 0x4a, 0xd1, 0x05, 0x9a, 0x63,
+    0x6b, 0x94, 0x46, 0x9b, 0x18, 0x63, 0x63, 0xe3, 0x6b, 0x9b, 0x18, 0xe3,
+    0x63, 0x0a, 0x9b, 0x63, 0x44, 0x0a, 0x93, 0x06, 0x9b, 0x9b, 0x1a, 0xa8,
+    0xe7, 0x22, 0x00, 0x01, 0x3b, 0x40, 0x32, 0x15, 0xa9, 0x09, 0x92, 0x15,
+    0x93, 0xff, 0xf7, 0x42, 0xf9, 0x14, 0xa9, 0x06, 0x00, 0xb8, 0x6e, 0xff,
+    0xf7, 0x3d, 0xf9, 0x05, 0x90, 0x13, 0x9b, 0x07, 0x93, 0x05, 0x9b, 0xb3,
+    0x42, 0x03, 0xd3, 0x07, 0x9b, 0xa3, 0x63, 0x14, 0x9b, 0xaf, 0xe7, 0x05,
+    0x9b, 0xf0, 0x1a, 0x00, 0xf0, 0x39, 0xfd, 0x05, 0xfc, 0x03, 0x90, 0x3b,
+    0xfd, 0x20, 0x23, 0x5d, 0x1b, 0x01, 0x3d, 0x85, 0x9c, 0x00, 0xf0, 0x10,
+    0x00, 0x04, 0x23, 0x38, 0x00, 0x02, 0x93, 0x13, 0xab, 0x01, 0x93, 0xab,
+    0x00, 0x00, 0x93, 0x04, 0x22, 0x07, 0x9b, 0x09, 0x99, 0x68, 0x30, 0xff,
+    0xf7, 0x7c, 0xf9, 0x00, 0x28, 0x53, 0xd1, 0x2c, 0x0f, 0xf1, 0x3c, 0xf6,
+    0x1a, 0xd5, 0xe7, 0x02, 0x23, 0x5b, 0x42, 0xa3, 0x63, 0xe2, 0x63, 0x8a,
+    0xe7, 0xe3, 0x6c, 0x0f, 0x93, 0x23, 0x6c, 0x02, 0x33, 0x19, 0xd1, 0x61,
+    0x6c, 0xa3, 0x6c, 0xcd, 0x18, 0xae, 0x42, 0x14, 0xd2, 0x8e, 0x42, 0x12,
+    0xd3, 0x07, 0x9b, 0xad, 0x1b, 0x9d, 0x42, 0x00, 0xd9, 0x1d, 0x00, 0x0f,
+    0x9b, 0x71, 0x1a, 0x59, 0x18, 0x2a, 0x00, 0x0b, 0x98, 0x00, 0xf0, 0xcb,
+    0xfd, 0x0b, 0x9b, 0x76, 0x19, 0x5b, 0x19, 0x0b, 0x93, 0x07, 0x9b, 0x5b,
+    0x1b, 0x91, 0x48, 0x00, 0xf4, 0x21, 0x23, 0x64, 0xbb, 0x6e, 0x30, 0x00,
+    0x0d, 0x93, 0x5b, 0x69, 0x19, 0x00, 0x0c, 0x93, 0x00, 0xf0, 0xff, 0xfc,
+    0x73, 0x1a, 0x0c, 0x9a, 0x0e, 0x93, 0x63, 0x64, 0x09, 0x9b, 0x11, 0x00,
+    0x9d, 0x18, 0x01, 0x3d, 0xad, 0x19, 0x28, 0x00, 0x00, 0xf0, 0xf3, 0xfc,
+    0x0d, 0x9b, 0x6d, 0x1a, 0x9b, 0x6a, 0x56, 0x00, 0xf0, 0x01, 0x38, 0x00,
+    0x01, 0x93, 0x0e, 0x9b, 0x11, 0x4a, 0x00, 0x93, 0x10, 0x99, 0x11, 0x9b,
+    0xa5, 0x64, 0x90, 0x0b, 0x80, 0xff, 0xfb, 0x00, 0x28, 0x00, 0xdb, 0x66,
+    0xe7, 0x68, 0x0b, 0x40, 0x21, 0x00, 0x38, 0x00, 0x3a, 0x07, 0xc0, 0x02,
+    0x93, 0x0a, 0x9b, 0x00, 0x96, 0x01, 0x93, 0x40, 0x31, 0xa3, 0x6b, 0xca,
+    0x00, 0xa0, 0x17, 0xf9, 0x00, 0x28, 0x00, 0xd1, 0x57, 0xe7, 0xec, 0xe7,
+    0xb8, 0x0d, 0xa0, 0xe9, 0xe7, 0x00, 0x00, 0x10, 0x20, 0x00, 0xfc, 0xf7,
+    0xff, 0x20, 0x02, 0xf2, 0x03, 0xc5, 0xf8, 0x10, 0xbd, 0x00, 0x23, 0x10,
+    0xb5, 0x1a, 0x00, 0xff, 0xf7, 0xbf, 0xf8, 0x00, 0x28, 0x00, 0xdd, 0x30,
+    0x02, 0xf0, 0x25, 0x70, 0xb5, 0x0f, 0x25, 0x0a, 0x4c, 0x8a, 0x18, 0x91,
+    0x42, 0x00, 0xd1, 0x70, 0xbd, 0x0b, 0x78, 0x06, 0x09, 0x58, 0x40, 0x28,
+    0x40, 0x80, 0x00, 0x00, 0x59, 0x1b, 0x09, 0x46, 0x40, 0x73, 0x40, 0x2b,
+    0x40, 0x9b, 0x00, 0x1b, 0x59, 0x30, 0x09, 0x58, 0x40, 0x01, 0x31, 0xec,
+    0xe7, 0xc0, 0x46, 0xfc, 0x23, 0x00, 0x20, 0xe0, 0x05, 0xf0, 0x23, 0x03,
+    0x00, 0x00, 0x25, 0x89, 0xb0, 0x20, 0x34, 0x1d, 0x80, 0x02, 0x33, 0xa3,
+    0x42, 0xfb, 0xd1, 0x0b, 0x00, 0x56, 0x18, 0x9e, 0x42, 0x0e, 0xd1, 0x00,
+    0x23, 0x1c, 0x00, 0x03, 0x80, 0x6d, 0x46, 0x5c, 0x53, 0xc5, 0x5a, 0x02,
+    0x33, 0x64, 0x19, 0x20, 0x2b, 0xf8, 0xd1, 0x00, 0x24, 0xa2, 0x42, 0x08,
+    0xd1, 0x6c, 0x03, 0xf0, 0x57, 0x1c, 0x78, 0x01, 0x33, 0x64, 0x00, 0x05,
+    0x5b, 0x01, 0x35, 0x05, 0x53, 0xe7, 0xe7, 0x0d, 0x5d, 0x00, 0x2d, 0x08,
+    0xd0, 0x6b, 0x46, 0x6f, 0x46, 0x6d, 0x00, 0x5b, 0x5b, 0x5e, 0x1c, 0x10,
+    0x33, 0x5b, 0x00, 0x7e, 0x53, 0x1c, 0x52, 0x01, 0x34, 0xe6, 0xe7, 0x03,
+    0x68, 0x42, 0x68, 0x10, 0xb5, 0x93, 0x42, 0x03, 0xd2, 0x5a, 0x1c, 0x02,
+    0x60, 0x18, 0x78, 0x10, 0xbd, 0x83, 0x68, 0x84, 0x1d, 0x00, 0x2b, 0x07,
+    0xd0, 0xe2, 0x7f, 0x00, 0x2a, 0x04, 0xd1, 0x98, 0x47, 0x00, 0x28, 0x01,
+    0xdb, 0xc0, 0xb2, 0xf2, 0xe7, 0x01, 0x23, 0x00, 0x20, 0xe3, 0x77, 0xee,
+    0xe7, 0x03, 0x69, 0x10, 0xb5, 0x5a, 0x1e, 0x04, 0x00, 0x02, 0x61, 0x3e,
+    0x07, 0x60, 0xff, 0xf7, 0xde, 0xff, 0x07, 0x23, 0xf0, 0x0a, 0xf0, 0x19,
+    0xe0, 0x68, 0x43, 0x08, 0xe3, 0x60, 0x01, 0x23, 0x18, 0x40, 0x10, 0xbd,
+    0xf7, 0xb5, 0x00, 0x25, 0x06, 0x00, 0x01, 0x92, 0xa9, 0x42, 0x04, 0xd0,
+    0x01, 0x24, 0x27, 0x00, 0x8f, 0x40, 0xbc, 0x42, 0x02, 0xd3, 0x01, 0x9b,
+    0x58, 0x19, 0xfe, 0xbd, 0xc2, 0x03, 0x20, 0xdd, 0xff, 0xe2, 0x18, 0x60,
+    0x2d, 0x19, 0x64, 0x00, 0xf2, 0xe7, 0x2c, 0x00, 0xf0, 0x01, 0x0b, 0x00,
+    0x0e, 0x00, 0x2c, 0x00, 0x20, 0x33, 0x01, 0x90, 0x8f, 0x1c, 0x00, 0x93,
+    0x01, 0x98, 0x12, 0x16, 0xf0, 0x19, 0x00, 0x9b, 0x6d, 0x00, 0x28, 0x18,
+    0x9f, 0x42, 0x0b, 0xd0, 0x3d, 0x88, 0x02, 0x37, 0x2a, 0x19, 0x45, 0x1b,
+    0x04, 0xd5, 0x24, 0x18, 0x10, 0x34, 0x64, 0x00, 0xa0, 0x5b, 0xfe, 0xbd,
+    0x14, 0x00, 0xeb, 0xe7, 0x03, 0x20, 0x40, 0x42, 0xf9, 0xe7, 0x8c, 0x03,
+    0xd0, 0xd5, 0xb0, 0x03, 0x92, 0x02, 0x22, 0x0e, 0x00, 0xff, 0x32, 0x05,
+    0x21, 0x05, 0x7a, 0x01, 0x70, 0xff, 0x01, 0x22, 0x05, 0x21, 0x00, 0x90,
+    0x80, 0x09, 0x80, 0xb9, 0xff, 0x04, 0x22, 0x01, 0x90, 0x11, 0x00, 0x0c,
+    0x00, 0xf0, 0x29, 0xb3, 0xff, 0x00, 0x23, 0x07, 0x00, 0x1a, 0x00, 0x04,
+    0xa9, 0x5a, 0x54, 0x01, 0x33, 0x13, 0x2b, 0xfa, 0xd1, 0x00, 0x24, 0xbc,
+    0x42, 0x1c, 0xd1, 0x13, 0x22, 0x30, 0x00, 0x04, 0xa9, 0xff, 0xf7, 0x46,
+    0xff, 0x01, 0x9a, 0x00, 0x24, 0x94, 0x46, 0x00, 0x9b, 0x63, 0x44, 0x02,
+    0x93, 0x02, 0x9b, 0x9c, 0x42, 0x19, 0xd3, 0x30, 0x00, 0x00, 0x9a, 0x1c,
+    0x00, 0xf0, 0x0b, 0x38, 0xff, 0x00, 0x9b, 0x04, 0xaa, 0x9b, 0x18, 0x03,
+    0x98, 0x19, 0x00, 0x01, 0x9a, 0xff, 0xf7, 0x30, 0xff, 0x00, 0x20, 0x1a,
+    0xe0, 0x00, 0x22, 0x03, 0x21, 0x5a, 0x00, 0xf1, 0x00, 0x86, 0xff, 0x1b,
+    0x4b, 0x04, 0xaa, 0xe3, 0x5c, 0x01, 0x34, 0xd0, 0x54, 0xd5, 0xe7, 0x31,
+    0x6e, 0x00, 0xf0, 0x07, 0x92, 0xff, 0x00, 0x28, 0x09, 0xdb, 0x11, 0x28,
+    0x21, 0xd0, 0x12, 0x28, 0x23, 0xd0, 0x10, 0x28, 0x19, 0xd1, 0x00, 0x2c,
+    0x03, 0xd1, 0xb6, 0x00, 0xf0, 0x03, 0x55, 0xb0, 0xf0, 0xbd, 0x03, 0x22,
+    0x02, 0x21, 0x54, 0xab, 0x1b, 0x19, 0x42, 0x3b, 0xff, 0x3b, 0x1f, 0x78,
+    0x30, 0x00, 0xf0, 0x1f, 0x64, 0xff, 0x02, 0x9b, 0x20, 0x18, 0x98, 0x42,
+    0xed, 0xd8, 0xa0, 0x42, 0xc0, 0xd0, 0x04, 0xab, 0xe7, 0x54, 0x01, 0x34,
+    0xf9, 0xe7, 0x04, 0xab, 0x18, 0x55, 0x01, 0x34, 0xb8, 0xe7, 0x03, 0x22,
+    0x11, 0x00, 0x00, 0x27, 0xea, 0xe7, 0x0b, 0x22, 0x07, 0x21, 0xfa, 0xe7,
+    0x3c, 0x24, 0x9a, 0x15, 0x00, 0x6a, 0x02, 0xf0, 0x07, 0x84, 0x1d, 0xe3,
+    0x77, 0x01, 0x24, 0x64, 0x42, 0x03, 0x61, 0xc3, 0x62, 0x84, 0x62, 0xc2,
+    0x63, 0x81, 0x63, 0x03, 0x64, 0x03, 0x63, 0x74, 0x02, 0xf2, 0x31, 0xf7,
+    0xb5, 0x80, 0x26, 0x04, 0x00, 0x76, 0x00, 0xa3, 0x6a, 0x01, 0x33, 0x00,
+    0xd0, 0x93, 0xe0, 0x20, 0x00, 0xa5, 0x6a, 0xff, 0xf7, 0x1f, 0xff, 0x00,
+    0x22, 0xe0, 0x62, 0x02, 0x21, 0x20, 0x00, 0xff, 0xf7, 0x2b, 0xff, 0xa0,
+    0x62, 0x01, 0x28, 0x79, 0xd1, 0x01, 0x2d, 0x63, 0xd0, 0x21, 0x00, 0x00,
+    0x23, 0x08, 0x31, 0xa2, 0x1d, 0xd3, 0x87, 0x02, 0x31, 0x8b, 0x87, 0xcb,
+    0x87, 0x02, 0x31, 0x04, 0x00, 0xf9, 0x46, 0x40, 0x31, 0x0b, 0x80, 0x4b,
+    0x80, 0x23, 0x00, 0x18, 0x21, 0x52, 0x33, 0x19, 0x80, 0x80, 0x31, 0x59,
+    0x80, 0x28, 0x39, 0x99, 0x80, 0x21, 0x00, 0x33, 0x00, 0x18, 0x30, 0x64,
+    0x31, 0xff, 0x30, 0x0b, 0x80, 0x01, 0x33, 0x9b, 0xb2, 0x02, 0x31, 0x83,
+    0x42, 0xf9, 0xd1, 0x20, 0x00, 0x00, 0x23, 0x94, 0x30, 0x59, 0x00, 0x43,
+    0x52, 0x01, 0x33, 0x90, 0x2b, 0xfa, 0xd1, 0xd7, 0x21, 0x8c, 0x20, 0x49,
+    0x00, 0x40, 0x00, 0x50, 0x52, 0x1a, 0x20, 0x02, 0x31, 0xff, 0x30, 0x50,
+    0x52, 0x02, 0x31, 0x01, 0x30, 0x50, 0x52, 0x1c, 0x0e, 0x00, 0x19, 0x1e,
+    0x0e, 0x00, 0x13, 0x20, 0x0e, 0x00, 0x72, 0x22, 0x00, 0xc5, 0x32, 0xff,
+    0x32, 0x13, 0x5e, 0x00, 0xf0, 0x1e, 0x32, 0xb3, 0x42, 0xf9, 0xd1, 0xa9,
+    0x22, 0x00, 0x23, 0x20, 0x21, 0x92, 0x00, 0xa3, 0x52, 0xa2, 0x18, 0x51,
+    0x81, 0x53, 0x80, 0x93, 0x80, 0xd3, 0x80, 0x13, 0x81, 0xb1, 0x22, 0x92,
+    0x00, 0xa1, 0x18, 0x5a, 0x00, 0x8b, 0x52, 0x01, 0x33, 0x20, 0x2b, 0xfa,
+    0xd1, 0x23, 0x6b, 0xa0, 0x18, 0xf0, 0x21, 0x8b, 0xe0, 0x21, 0x00, 0x20,
+    0x00, 0x44, 0x31, 0xff, 0xf7, 0xcf, 0xfe, 0xa3, 0x1d, 0xdb, 0x7f, 0x00,
+    0x2b, 0x19, 0xd1, 0xff, 0x28, 0x57, 0xdc, 0xa3, 0x69, 0xc0, 0xb2, 0x5a,
+    0x1c, 0xa2, 0x61, 0x3d, 0xe0, 0x02, 0x28, 0x0a, 0xd1, 0xa9, 0x23, 0x21,
+    0x00, 0x9b, 0x00, 0x20, 0x00, 0xe2, 0x18, 0x2a, 0x00, 0x20, 0xdb, 0xfe,
+    0x96, 0x02, 0xe0, 0xa7, 0xe0, 0xa3, 0x6a, 0x00, 0x2b, 0x05, 0xd0, 0x01,
+    0x3b, 0x01, 0x2b, 0xd8, 0xd9, 0xae, 0x01, 0x80, 0x9e, 0xe0, 0x27, 0x6b,
+    0x00, 0x2f, 0x19, 0xd1, 0x32, 0x01, 0x40, 0x67, 0xfe, 0x05, 0x00, 0x08,
+    0x00, 0x60, 0x63, 0xfe, 0x00, 0x02, 0x45, 0x19, 0x0a, 0x00, 0x40, 0x5e,
+    0xfe, 0x01, 0x90, 0x08, 0x00, 0xf0, 0x11, 0x5a, 0xfe, 0x01, 0x9b, 0x00,
+    0x02, 0xc0, 0x18, 0x46, 0x4b, 0x58, 0x40, 0x85, 0x42, 0xe2, 0xd1, 0x01,
+    0x35, 0x25, 0x63, 0x27, 0x61, 0x23, 0x6b, 0x01, 0x3b, 0x23, 0x63, 0x00,
+    0x2b, 0x77, 0xd0, 0x24, 0x00, 0x40, 0x48, 0xfe, 0xa3, 0x69, 0x7e, 0x00,
+    0xf0, 0x31, 0x18, 0x70, 0xa2, 0x6b, 0x00, 0x2a, 0x09, 0xd0, 0x23, 0x6c,
+    0x59, 0x1c, 0x21, 0x64, 0xd0, 0x54, 0x23, 0x6c, 0xe2, 0x6b, 0x93, 0x42,
+    0x01, 0xd1, 0x00, 0x23, 0x23, 0x64, 0xa3, 0x69, 0xe2, 0x69, 0x93, 0x42,
+    0x00, 0xd2, 0x23, 0xe7, 0x00, 0x20, 0x61, 0xe0, 0xb0, 0x42, 0x5a, 0xd0,
+    0x02, 0x38, 0xff, 0x38, 0x1c, 0x28, 0xb9, 0xdc, 0x30, 0x4b, 0x42, 0x00,
+    0xd2, 0x5a, 0x30, 0x4b, 0x19, 0x5c, 0x4c, 0x00, 0xa0, 0x4d, 0xfe, 0xa9,
+    0x23, 0x9b, 0x00, 0x20, 0x63, 0xe1, 0x18, 0x0e, 0x00, 0x71, 0x5c, 0xfe,
+    0x1d, 0x28, 0xa8, 0xdc, 0x2a, 0x22, 0x00, 0x13, 0x29, 0x22, 0x00, 0xf0,
+    0x19, 0x3c, 0xfe, 0xa3, 0x6b, 0x00, 0x2b, 0x2c, 0xd0, 0xe3, 0x6b, 0x98,
+    0x42, 0x3d, 0xd8, 0x22, 0x6c, 0x10, 0x1a, 0x24, 0xd4, 0x60, 0x63, 0xa1,
+    0x6b, 0xa3, 0x69, 0x62, 0x6b, 0x00, 0x29, 0x28, 0xd0, 0x58, 0x1c, 0xa0,
+    0x61, 0x8a, 0x5c, 0x1a, 0x70, 0x26, 0x00, 0xd9, 0x0b, 0xd0, 0x22, 0x6c,
+    0x51, 0x1c, 0x21, 0x64, 0x61, 0x6b, 0x59, 0x5c, 0x99, 0x90, 0x00, 0x82,
+    0x63, 0x6b, 0xe2, 0x6b, 0x01, 0x33, 0x63, 0x63, 0x10, 0x00, 0x22, 0x63,
+    0x63, 0xd2, 0x00, 0xf0, 0x08, 0xab, 0xe7, 0x18, 0x18, 0xd8, 0xe7, 0xa3,
+    0x69, 0x62, 0x69, 0x9b, 0x1a, 0x98, 0x42, 0x00, 0xd9, 0x6a, 0xe7, 0x40,
+    0x42, 0xd0, 0xe7, 0x9a, 0x4e, 0x00, 0x90, 0x69, 0x01, 0x33, 0xa3, 0x61,
+    0xeb, 0xe7, 0xe3, 0x6a, 0xd6, 0x0f, 0x91, 0xc4, 0xe6, 0x01, 0x20, 0xfe,
+    0xbd, 0x05, 0x20, 0x5b, 0x0c, 0x13, 0xf0, 0x00, 0x00, 0x00, 0xaa, 0x24,
+    0x00, 0x20, 0xe6, 0x24, 0x00, 0x20, 0x50, 0x24, 0x00, 0x20, 0x8c, 0xc4,
+    0x02, 0xb0, 0xb5, 0x05, 0x00, 0x0c, 0x00, 0x01, 0x3c, 0x00, 0xd2, 0x70,
+    0xbd, 0x04, 0x03, 0xc2, 0xb7, 0xfd, 0xf8, 0xe7, 0x70, 0xb5, 0x04, 0x00,
+    0xff, 0xf7, 0xb2, 0xfd, 0x6a, 0x01, 0xa2, 0xae, 0xfd, 0x00, 0x02, 0x28,
+    0x43, 0x80, 0xb2, 0x70, 0xbd, 0x18, 0x00, 0x80, 0xa6, 0xfd, 0x06, 0x00,
+    0x1f, 0x28, 0x02, 0xd0, 0x9a, 0x01, 0x20, 0x70, 0xbd, 0x22, 0x00, 0x51,
+    0x9d, 0xfd, 0x8b, 0x28, 0xf7, 0x9e, 0x01, 0x51, 0x98, 0xfd, 0x08, 0x28,
+    0xf2, 0x0a, 0x00, 0xf1, 0x00, 0x93, 0xfd, 0x03, 0x00, 0xb3, 0x43, 0xdb,
+    0xb2, 0x05, 0x00, 0x00, 0x2b, 0xe9, 0xd1, 0x06, 0xee, 0x02, 0x60, 0xc9,
+    0xff, 0x6b, 0x07, 0x06, 0xd5, 0x0a, 0x00, 0x31, 0xce, 0xff, 0x01, 0x5c,
+    0x00, 0x51, 0xc0, 0xff, 0x2b, 0x07, 0x04, 0x12, 0x00, 0x82, 0x7b, 0xfd,
+    0x00, 0x28, 0xfa, 0xd1, 0xeb, 0x06, 0x0e, 0x00, 0x11, 0x74, 0x0e, 0x00,
+    0x51, 0x02, 0x26, 0x35, 0x42, 0x02, 0xb8, 0x01, 0x60, 0xb6, 0xff, 0x63,
+    0x1d, 0xde, 0x77, 0xda, 0x08, 0xf0, 0x15, 0x00, 0x20, 0x23, 0x62, 0xc3,
+    0xe7, 0x00, 0x00, 0x02, 0x4b, 0x18, 0x68, 0x80, 0x07, 0xc0, 0x0f, 0x70,
+    0x47, 0xc0, 0x46, 0x00, 0xc0, 0x06, 0x40, 0x14, 0x23, 0x10, 0xb5, 0x01,
+    0x00, 0x18, 0x88, 0x04, 0x33, 0x1b, 0x88, 0x1c, 0x1b, 0x13, 0x16, 0x10,
+    0x00, 0x13, 0x02, 0x10, 0x00, 0x00, 0xbc, 0x00, 0xf0, 0x17, 0x01, 0x26,
+    0x89, 0x00, 0x45, 0x18, 0xac, 0x42, 0x01, 0xd1, 0x30, 0x00, 0x70, 0xbd,
+    0x20, 0x68, 0xff, 0xf7, 0xe4, 0xff, 0x01, 0xc4, 0x43, 0x1e, 0x98, 0x41,
+    0x40, 0x42, 0x06, 0x40, 0xf2, 0xe7, 0x05, 0x4b, 0x06, 0x4a, 0x13, 0x60,
+    0x04, 0x00, 0xf1, 0x1b, 0x53, 0x60, 0x93, 0x60, 0xd3, 0x60, 0x13, 0x61,
+    0x53, 0x61, 0x93, 0x61, 0x70, 0x47, 0x80, 0x80, 0x80, 0x80, 0x00, 0xe4,
+    0x00, 0xe0, 0x04, 0xe4, 0x00, 0xe0, 0x00, 0x21, 0x04, 0x4b, 0x04, 0x4a,
+    0xbf, 0xf3, 0x5f, 0x8f, 0x02, 0xc3, 0x93, 0x42, 0xfa, 0xd1, 0x80, 0x00,
+    0xf0, 0x18, 0x01, 0x00, 0xd0, 0x80, 0x01, 0x00, 0xd0, 0x04, 0x4a, 0x10,
+    0x78, 0x43, 0x1c, 0xdb, 0xb2, 0x17, 0x2b, 0x01, 0xd8, 0x13, 0x70, 0x70,
+    0x47, 0x10, 0x23, 0xfb, 0xe7, 0x78, 0x25, 0x00, 0x20, 0x02, 0x4b, 0xc9,
+    0x18, 0x89, 0x00, 0x01, 0x60, 0x2c, 0x00, 0x71, 0x40, 0x00, 0x00, 0x34,
+    0x70, 0x47, 0x10, 0x4a, 0x01, 0x13, 0xe7, 0x06, 0x01, 0x60, 0xef, 0xff,
+    0xff, 0x23, 0x23, 0x71, 0x54, 0x00, 0x22, 0x10, 0xbd, 0x1a, 0x00, 0x13,
+    0xda, 0x1a, 0x00, 0x62, 0xe2, 0xff, 0xff, 0x23, 0xa3, 0x80, 0x1a, 0x00,
+    0xf0, 0x41, 0x00, 0x00, 0xf8, 0xb5, 0x04, 0x00, 0x0c, 0x20, 0x17, 0x00,
+    0x1e, 0x00, 0x0d, 0x00, 0x00, 0xf0, 0x4c, 0xf9, 0x1d, 0x49, 0x41, 0x43,
+    0x38, 0x00, 0x00, 0xf0, 0x47, 0xf9, 0x06, 0x9a, 0x33, 0x04, 0x12, 0x03,
+    0x13, 0x43, 0x22, 0x68, 0x00, 0x2a, 0x0f, 0xda, 0x3f, 0x21, 0x22, 0x68,
+    0x0a, 0x40, 0xaa, 0x42, 0x0a, 0xd1, 0xa2, 0x68, 0x12, 0x05, 0x12, 0x0d,
+    0x82, 0x42, 0x05, 0xd1, 0xee, 0x21, 0xe2, 0x68, 0xc9, 0x02, 0x0a, 0x40,
+    0x9a, 0x42, 0x1b, 0xd0, 0x10, 0x4a, 0x94, 0x42, 0x19, 0xd0, 0x80, 0x1a,
+    0xf0, 0x2b, 0x0f, 0x49, 0x0f, 0x4e, 0x0a, 0x60, 0x0f, 0x49, 0x0a, 0x60,
+    0x17, 0x00, 0xb1, 0x68, 0x8f, 0x43, 0xfb, 0xd1, 0xc0, 0x22, 0x21, 0x1d,
+    0x92, 0x01, 0x0a, 0x43, 0x21, 0x21, 0x25, 0x60, 0xa0, 0x60, 0x11, 0x60,
+    0x21, 0x68, 0x00, 0x29, 0xfc, 0xda, 0xe3, 0x60, 0x08, 0x23, 0x13, 0x60,
+    0xf8, 0xbd, 0x80, 0x22, 0x92, 0x01, 0xe4, 0xe7, 0x40, 0x42, 0x0f, 0x00,
+    0x50, 0x16, 0x01, 0xf2, 0x1b, 0xf1, 0x0f, 0xc0, 0x00, 0x40, 0x00, 0xf0,
+    0x00, 0x40, 0x80, 0x23, 0x02, 0x4a, 0x9b, 0x00, 0x03, 0x43, 0xd3, 0x62,
+    0x70, 0x47, 0x00, 0x80, 0x05, 0x40, 0x02, 0x4b, 0x1a, 0x68, 0x02, 0x4b,
+    0x5a, 0xf4, 0x00, 0x10, 0xbc, 0xa0, 0x16, 0xf1, 0x15, 0x80, 0x05, 0x40,
+    0x03, 0x00, 0x80, 0x20, 0x12, 0x4a, 0xc0, 0x05, 0x10, 0xb5, 0x12, 0x4c,
+    0x10, 0x60, 0x12, 0x48, 0x04, 0x60, 0xe0, 0x20, 0x11, 0x4c, 0xc0, 0x04,
+    0x00, 0x29, 0x06, 0xd0, 0x20, 0x60, 0x00, 0x2b, 0x05, 0xd8, 0x10, 0xf0,
+    0x2b, 0x23, 0x60, 0x10, 0xbd, 0x10, 0x60, 0xf7, 0xe7, 0xfa, 0x20, 0x80,
+    0x22, 0xc0, 0x00, 0x58, 0x43, 0x52, 0x04, 0x09, 0x4b, 0x90, 0x42, 0x05,
+    0xd2, 0x18, 0x60, 0xff, 0xf7, 0xd4, 0xff, 0x80, 0x23, 0xdb, 0x05, 0xed,
+    0xe7, 0x06, 0x4a, 0x1a, 0x60, 0xf7, 0xe7, 0x00, 0xb0, 0x05, 0x40, 0xfc,
+    0xff, 0x01, 0x00, 0x08, 0x20, 0x01, 0x40, 0x00, 0xa0, 0x05, 0x40, 0x68,
+    0x00, 0x40, 0xff, 0xff, 0xff, 0x00, 0xec, 0x01, 0xf0, 0x15, 0x10, 0x00,
+    0x80, 0x22, 0x0a, 0x4b, 0xd2, 0x05, 0x1a, 0x60, 0x0a, 0x4b, 0x00, 0x2c,
+    0x0c, 0xd0, 0x01, 0x25, 0x09, 0x4a, 0x2c, 0x43, 0xda, 0x61, 0x08, 0x4a,
+    0x62, 0x40, 0x1a, 0x62, 0x59, 0x62, 0x9c, 0x62, 0x00, 0x21, 0x58, 0x02,
+    0x50, 0x70, 0xbd, 0xdc, 0x61, 0xf9, 0x50, 0x0f, 0x30, 0xb0, 0x05, 0x40,
+    0xa4, 0x00, 0xc0, 0xd3, 0xc0, 0x07, 0xb0, 0x2d, 0x3f, 0xf8, 0x4f, 0xaa,
+    0x22, 0x06, 0x4b, 0x3a, 0x18, 0xf0, 0x2b, 0x21, 0x32, 0xff, 0x32, 0xda,
+    0x60, 0x04, 0x49, 0x04, 0x4a, 0x11, 0x60, 0x5a, 0x68, 0x00, 0x2a, 0xfc,
+    0xda, 0x70, 0x47, 0x00, 0x40, 0x02, 0x40, 0x00, 0xb0, 0xfa, 0x00, 0x00,
+    0x60, 0x02, 0x40, 0x23, 0x4b, 0x24, 0x4a, 0x70, 0xb5, 0x1a, 0x60, 0x23,
+    0x4a, 0x24, 0x4c, 0x15, 0x00, 0x24, 0x4b, 0x23, 0x60, 0x18, 0x00, 0x91,
+    0x68, 0x88, 0x43, 0xfb, 0xd1, 0x50, 0x1a, 0xf0, 0x21, 0x9e, 0x42, 0x24,
+    0xd3, 0xfe, 0xf7, 0xd1, 0xfb, 0x21, 0x4b, 0x23, 0x60, 0xab, 0x68, 0xdb,
+    0x01, 0x80, 0x33, 0xfb, 0xd1, 0x40, 0x22, 0x1e, 0x4b, 0x1f, 0x48, 0x9a,
+    0x67, 0x5a, 0x67, 0x1a, 0x67, 0xda, 0x66, 0x1d, 0x4b, 0x98, 0x42, 0x15,
+    0xd3, 0x1d, 0x4c, 0x1d, 0x4d, 0xa1, 0x68, 0xc0, 0x22, 0x26, 0x09, 0xf0,
+    0x17, 0x1a, 0xf9, 0xa5, 0x60, 0xff, 0xf7, 0xcb, 0xfe, 0xff, 0xf7, 0xb7,
+    0xfe, 0xff, 0xf7, 0xe9, 0xfe, 0x18, 0x4c, 0x18, 0x4b, 0x9c, 0x42, 0x0f,
+    0xd3, 0x70, 0xbd, 0x08, 0xce, 0x98, 0x47, 0xd4, 0xe7, 0x04, 0x00, 0x03,
+    0x68, 0x08, 0x34, 0xfa, 0x0c, 0xf0, 0x05, 0xff, 0xf7, 0xe8, 0xfe, 0x20,
+    0x00, 0xdd, 0xe7, 0xff, 0xf7, 0xd7, 0xfe, 0xfa, 0xe7, 0x08, 0xcc, 0x98,
+    0x47, 0xe9, 0xe7, 0x94, 0x01, 0x44, 0xbf, 0xcd, 0xfb, 0xfe, 0x98, 0x01,
+    0xa1, 0xfe, 0x7f, 0x3c, 0x00, 0xa8, 0x25, 0x00, 0x20, 0xb8, 0x25, 0x1c,
+    0x01, 0x60, 0x01, 0x00, 0xf0, 0x01, 0x40, 0xa0, 0x18, 0x1b, 0x00, 0x10,
+    0x1e, 0x02, 0x00, 0x1f, 0x01, 0x1c, 0x00, 0x01, 0x20, 0x1e, 0x30, 0xb5,
+    0x00, 0xbe, 0xbc, 0x1d, 0xf0, 0x15, 0x10, 0xb5, 0x01, 0x48, 0xff, 0xf7,
+    0xf8, 0xff, 0x60, 0x25, 0x00, 0x20, 0x01, 0x48, 0x04, 0x21, 0x01, 0x4b,
+    0x18, 0x47, 0x80, 0x25, 0x00, 0x20, 0x2d, 0x1c, 0x00, 0x20, 0x01, 0x4b,
+    0x5b, 0x68, 0x18, 0x47, 0x00, 0x00, 0x10, 0x00, 0x37, 0x01, 0x4b, 0x9b,
+    0x0c, 0x00, 0x15, 0x1b, 0x0c, 0x00, 0xf0, 0x03, 0x11, 0x4a, 0x93, 0x6f,
+    0x9b, 0x08, 0x13, 0xd2, 0x10, 0x66, 0x51, 0x66, 0x00, 0x29, 0x05, 0xd0,
+    0xff, 0xe7, 0x02, 0x00, 0xf0, 0x23, 0x51, 0x6f, 0x10, 0x6f, 0x70, 0x47,
+    0x04, 0xb5, 0x00, 0x28, 0x01, 0xd0, 0x00, 0x20, 0xc0, 0x43, 0x00, 0xf0,
+    0xab, 0xf8, 0x00, 0x21, 0x04, 0xbd, 0xc0, 0x46, 0xf0, 0xb5, 0x14, 0x6e,
+    0x55, 0x6e, 0x57, 0x6f, 0x16, 0x6f, 0xff, 0xf7, 0xe5, 0xff, 0x14, 0x66,
+    0x55, 0x66, 0x57, 0x67, 0x16, 0x67, 0xf0, 0xbd, 0x9c, 0x1f, 0xa0, 0x13,
+    0x23, 0x70, 0xb5, 0x1c, 0x78, 0x0f, 0x4d, 0x01, 0x2c, 0x74, 0x09, 0x80,
+    0x0e, 0x49, 0x9a, 0x00, 0x01, 0x33, 0xa9, 0x50, 0x68, 0x06, 0xf1, 0x06,
+    0x0b, 0x4b, 0xab, 0x64, 0x0b, 0x48, 0xff, 0xf7, 0x02, 0xfe, 0x0a, 0x4b,
+    0x18, 0x60, 0x70, 0xbd, 0x01, 0x2c, 0xf5, 0xdd, 0x09, 0x10, 0x00, 0x40,
+    0x80, 0x22, 0x01, 0x00, 0x4a, 0x01, 0xf0, 0x35, 0x75, 0xf8, 0x02, 0x2c,
+    0xed, 0xd1, 0xea, 0xe7, 0xcc, 0xd3, 0x00, 0x20, 0x3d, 0x20, 0x00, 0x20,
+    0x4c, 0x33, 0x00, 0x00, 0xc4, 0x2f, 0x00, 0x20, 0x53, 0x44, 0x00, 0x00,
+    0x07, 0xb5, 0x60, 0x46, 0x01, 0x88, 0x0a, 0x0a, 0x02, 0x30, 0xdf, 0x2a,
+    0xfa, 0xd1, 0xc9, 0xb2, 0x82, 0x08, 0x04, 0xd3, 0x02, 0x88, 0x40, 0x88,
+    0x00, 0x04, 0x10, 0x43, 0x00, 0xe0, 0x00, 0x68, 0x01, 0x4a, 0x50, 0x50,
+    0x03, 0x90, 0x07, 0xbd, 0x3c, 0x00, 0xf0, 0x09, 0x13, 0x23, 0x10, 0xb5,
+    0x10, 0x48, 0x1c, 0x78, 0xff, 0xf7, 0xd4, 0xfd, 0x01, 0x00, 0x01, 0x2c,
+    0x13, 0xd1, 0x0e, 0x4c, 0x54, 0x22, 0x20, 0x00, 0x8c, 0x22, 0x40, 0x15,
+    0x23, 0x0c, 0x4a, 0x26, 0x1a, 0x11, 0x62, 0x94, 0x00, 0x40, 0x22, 0x62,
+    0xe2, 0x61, 0x84, 0x00, 0xe0, 0xb8, 0xfd, 0x08, 0x4b, 0x18, 0x60, 0x10,
+    0xbd, 0x01, 0x2c, 0xf7, 0xdd, 0x80, 0x22, 0x08, 0x1b, 0xd7, 0x2f, 0xf8,
+    0xf2, 0xe7, 0x53, 0x46, 0x00, 0x00, 0xcc, 0xd4, 0x00, 0x20, 0xc5, 0x8c,
+    0x00, 0x0f, 0x88, 0x00, 0x16, 0x16, 0xd4, 0x8c, 0x01, 0x15, 0x90, 0x8c,
+    0x01, 0x02, 0x74, 0x01, 0x00, 0x10, 0x00, 0x04, 0x98, 0x01, 0x00, 0x0c,
+    0x00, 0x00, 0x74, 0x03, 0xf0, 0x5f, 0x30, 0xb5, 0x03, 0x2a, 0x0c, 0xd9,
+    0x03, 0x00, 0x0b, 0x43, 0x9b, 0x07, 0x1c, 0xd1, 0x03, 0x68, 0x0c, 0x68,
+    0xa3, 0x42, 0x18, 0xd1, 0x04, 0x3a, 0x04, 0x30, 0x04, 0x31, 0x03, 0x2a,
+    0xf6, 0xd8, 0x55, 0x1e, 0x00, 0x2a, 0x0e, 0xd0, 0x02, 0x78, 0x0c, 0x78,
+    0x94, 0x42, 0x0e, 0xd1, 0x01, 0x35, 0x01, 0x23, 0x01, 0x39, 0x04, 0xe0,
+    0xc2, 0x5c, 0x01, 0x33, 0xcc, 0x5c, 0xa2, 0x42, 0x05, 0xd1, 0xab, 0x42,
+    0xf8, 0xd1, 0x00, 0x20, 0x30, 0xbd, 0x55, 0x1e, 0xec, 0xe7, 0x10, 0x1b,
+    0xfa, 0xe7, 0x03, 0x23, 0xca, 0xb2, 0xf0, 0xb5, 0x03, 0x40, 0x00, 0x2a,
+    0x39, 0xd0, 0x00, 0x2b, 0x0e, 0xd0, 0x03, 0x78, 0x00, 0x2b, 0x57, 0xd0,
+    0x9a, 0x42, 0x31, 0xd0, 0x03, 0x24, 0x04, 0xe0, 0x0e, 0x00, 0xf0, 0x33,
+    0x50, 0xd0, 0x93, 0x42, 0x2a, 0xd0, 0x01, 0x30, 0x20, 0x42, 0xf7, 0xd1,
+    0xff, 0x25, 0x29, 0x40, 0x0d, 0x02, 0x29, 0x43, 0x0d, 0x04, 0x0d, 0x43,
+    0x2c, 0x00, 0x01, 0x68, 0x23, 0x4e, 0x4c, 0x40, 0x8b, 0x19, 0x8b, 0x43,
+    0xa1, 0x19, 0xa1, 0x43, 0x21, 0x4e, 0x0b, 0x43, 0x33, 0x42, 0x0b, 0xd1,
+    0x04, 0x30, 0x01, 0x68, 0x1d, 0x4f, 0x0c, 0x00, 0xcb, 0x19, 0x6c, 0x40,
+    0x8b, 0x43, 0xe1, 0x19, 0xa1, 0x43, 0x18, 0x00, 0x11, 0xf3, 0x5a, 0x00,
+    0x60, 0x04, 0xd1, 0x29, 0xe0, 0x01, 0x30, 0x0a, 0x00, 0xb1, 0x25, 0xd0,
+    0x9a, 0x42, 0xf9, 0xd1, 0xf0, 0xbd, 0x00, 0x2b, 0x0a, 0x1a, 0x00, 0x51,
+    0xf9, 0xd0, 0x03, 0x22, 0x02, 0x70, 0x00, 0xf2, 0x0d, 0xf4, 0xd0, 0x01,
+    0x30, 0x10, 0x42, 0xf9, 0xd1, 0x02, 0x68, 0x0b, 0x4b, 0x0c, 0x49, 0xd3,
+    0x18, 0x93, 0x43, 0x0b, 0x42, 0x06, 0xd1, 0x04, 0x30, 0x02, 0x68, 0x07,
+    0x4b, 0x0e, 0x00, 0x11, 0xf8, 0x32, 0x00, 0x22, 0xe0, 0xd0, 0x4a, 0x00,
+    0x70, 0xfb, 0xd1, 0xdb, 0xe7, 0x00, 0x20, 0xd9, 0x08, 0x07, 0x30, 0xfe,
+    0xfe, 0xfe, 0xd4, 0x05, 0x31, 0x70, 0xb5, 0x04, 0x50, 0x1d, 0xf0, 0x1c,
+    0x05, 0x00, 0x0e, 0x78, 0x00, 0x2e, 0x09, 0xd0, 0xa6, 0x42, 0x0b, 0xd0,
+    0x0b, 0x00, 0x01, 0xe0, 0xa2, 0x42, 0x07, 0xd0, 0x01, 0x33, 0x1a, 0x78,
+    0x00, 0x2a, 0xf9, 0xd1, 0x01, 0x35, 0x2c, 0x78, 0x00, 0x2c, 0xef, 0xd1,
+    0x28, 0x1a, 0x70, 0xbd, 0x00, 0x20, 0xfc, 0x1c, 0x07, 0x47, 0x78, 0x00,
+    0x2c, 0x14, 0x34, 0x00, 0x13, 0x09, 0x34, 0x00, 0x15, 0x05, 0x34, 0x00,
+    0x00, 0x2c, 0x00, 0x02, 0x38, 0x00, 0xa0, 0xed, 0xd1, 0xf8, 0xe7, 0x00,
+    0x20, 0xf7, 0xe7, 0xc0, 0x46, 0xec, 0x21, 0xc0, 0x08, 0x4a, 0x10, 0xb5,
+    0x13, 0x78, 0x00, 0x2b, 0x0a, 0xd1, 0x80, 0x23, 0xd8, 0x21, 0xf0, 0x01,
+    0x5b, 0x05, 0x1c, 0x68, 0xc4, 0x50, 0x04, 0x33, 0x8b, 0x42, 0xfa, 0xd1,
+    0x01, 0x23, 0x13, 0x70, 0x84, 0x21, 0x80, 0xc9, 0x50, 0x00, 0x20, 0x94,
+    0x29, 0x00, 0x10, 0x30, 0x24, 0x60, 0x10, 0xb5, 0x02, 0x4b, 0x01, 0x33,
+    0xbe, 0x06, 0x31, 0xc0, 0x46, 0x94, 0x80, 0x1f, 0xf0, 0x19, 0xf0, 0xb5,
+    0x42, 0x18, 0x04, 0x00, 0x0d, 0x00, 0x85, 0xb0, 0x5b, 0x04, 0x9a, 0x42,
+    0x01, 0xd9, 0xff, 0xf7, 0x29, 0xfe, 0x14, 0x27, 0x18, 0x26, 0x38, 0x88,
+    0x33, 0x88, 0x12, 0x49, 0x98, 0x47, 0x33, 0x88, 0x03, 0x90, 0x11, 0x49,
+    0x38, 0x88, 0x0a, 0x00, 0x33, 0x02, 0x90, 0x0f, 0x0a, 0x00, 0x40, 0x0e,
+    0x49, 0x01, 0x90, 0x0a, 0x00, 0x00, 0x90, 0x10, 0xf0, 0x0f, 0xbd, 0xff,
+    0x03, 0x9b, 0x98, 0x47, 0x02, 0x9b, 0x98, 0x47, 0x80, 0x22, 0x20, 0x00,
+    0xd8, 0x23, 0x29, 0x00, 0x52, 0x02, 0x01, 0x9c, 0xa0, 0x47, 0xb0, 0x47,
+    0xff, 0xf7, 0xc7, 0xff, 0xe8, 0x1e, 0xf0, 0x03, 0xc0, 0x46, 0x49, 0x46,
+    0x00, 0x00, 0x45, 0x58, 0x00, 0x00, 0x52, 0x45, 0x00, 0x00, 0x46, 0x43,
+    0x00, 0x00, 0x78, 0x00, 0xa4, 0x17, 0x00, 0x85, 0xb0, 0x82, 0x18, 0x04,
+    0x00, 0x03, 0x91, 0x7a, 0x00, 0xf1, 0x00, 0xec, 0xfd, 0x14, 0x26, 0x18,
+    0x25, 0x30, 0x88, 0x2b, 0x88, 0x10, 0x49, 0x98, 0x47, 0x2b, 0x70, 0x00,
+    0x20, 0x30, 0x88, 0x0a, 0x00, 0x33, 0x01, 0x90, 0x0e, 0x0a, 0x00, 0x40,
+    0x0d, 0x49, 0x00, 0x90, 0x0a, 0x00, 0x00, 0x14, 0x0c, 0x20, 0x80, 0xff,
+    0x76, 0x00, 0xf1, 0x04, 0x01, 0x9b, 0x98, 0x47, 0x3a, 0x00, 0x20, 0x00,
+    0x03, 0x99, 0x00, 0x9b, 0x98, 0x47, 0xa8, 0x47, 0xff, 0xf7, 0x8c, 0x76,
+    0x00, 0x05, 0x74, 0x00, 0x12, 0x50, 0x74, 0x00, 0xf3, 0x0a, 0x50, 0x69,
+    0x63, 0x6f, 0x20, 0x4f, 0x54, 0x41, 0x00, 0x2f, 0x00, 0x2e, 0x2e, 0x00,
+    0x6c, 0x69, 0x74, 0x74, 0x6c, 0x65, 0x66, 0x73, 0x00, 0x00, 0xff, 0x01,
+    0x00, 0x00, 0xac, 0x22, 0xf0, 0x0d, 0x64, 0x10, 0xb7, 0x1d, 0xc8, 0x20,
+    0x6e, 0x3b, 0xac, 0x30, 0xd9, 0x26, 0x90, 0x41, 0xdc, 0x76, 0xf4, 0x51,
+    0x6b, 0x6b, 0x58, 0x61, 0xb2, 0x4d, 0x3c, 0x71, 0x05, 0x50, 0x44, 0x21,
+    0xf1, 0x5d, 0x44, 0x93, 0x0f, 0xf0, 0xe8, 0xa3, 0xd6, 0xd6, 0x8c, 0xb3,
+    0x61, 0xcb, 0xb0, 0xc2, 0x64, 0x9b, 0xd4, 0xd2, 0xd3, 0x86, 0x78, 0xe2,
+    0x0a, 0xa0, 0x1c, 0xf2, 0xbd, 0xbd, 0x10, 0x11, 0x12, 0x00, 0x08, 0x07,
+    0x09, 0x06, 0x0a, 0x05, 0x0b, 0x04, 0x0c, 0x03, 0x0d, 0x02, 0x0e, 0x01,
+    0x0f, 0x00, 0x01, 0x00, 0x02, 0x00, 0x03, 0x00, 0x04, 0x00, 0x05, 0x00,
+    0x07, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x11, 0x00, 0x19, 0x00, 0x21, 0x00,
+    0x31, 0x00, 0x41, 0x00, 0x61, 0x00, 0x81, 0x00, 0xc1, 0x00, 0x01, 0x01,
+    0x81, 0x01, 0x01, 0x02, 0x01, 0x03, 0x01, 0x04, 0x01, 0x06, 0x01, 0x08,
+    0x01, 0x0c, 0x01, 0x10, 0x01, 0x18, 0x01, 0x20, 0x01, 0x30, 0x01, 0x40,
+    0x01, 0x60, 0x2c, 0x24, 0xf2, 0x0a, 0x01, 0x02, 0x02, 0x03, 0x03, 0x04,
+    0x04, 0x05, 0x05, 0x06, 0x06, 0x07, 0x07, 0x08, 0x08, 0x09, 0x09, 0x0a,
+    0x0a, 0x0b, 0x0b, 0x0c, 0x0c, 0x0d, 0x0d, 0x56, 0x00, 0xf6, 0x25, 0x06,
+    0x00, 0x07, 0x00, 0x08, 0x00, 0x09, 0x00, 0x0a, 0x00, 0x0b, 0x00, 0x0d,
+    0x00, 0x0f, 0x00, 0x11, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x1f,
+    0x00, 0x23, 0x00, 0x2b, 0x00, 0x33, 0x00, 0x3b, 0x00, 0x43, 0x00, 0x53,
+    0x00, 0x63, 0x00, 0x73, 0x00, 0x83, 0x00, 0xa3, 0x00, 0xc3, 0x00, 0xe3,
+    0x00, 0x02, 0x01, 0x2e, 0x26, 0x20, 0x01, 0x01, 0x60, 0x00, 0x00, 0x62,
+    0x00, 0x00, 0x64, 0x00, 0x00, 0x66, 0x00, 0xf0, 0x2d, 0x05, 0x05, 0x00,
+    0x00, 0x52, 0x65, 0x6c, 0x57, 0x69, 0x74, 0x68, 0x44, 0x65, 0x62, 0x49,
+    0x6e, 0x66, 0x6f, 0x00, 0x62, 0x6f, 0x6f, 0x74, 0x32, 0x5f, 0x77, 0x32,
+    0x35, 0x71, 0x30, 0x38, 0x30, 0x00, 0x31, 0x2e, 0x34, 0x2e, 0x30, 0x00,
+    0x70, 0x69, 0x63, 0x6f, 0x00, 0x6f, 0x74, 0x61, 0x00, 0x41, 0x75, 0x67,
+    0x20, 0x31, 0x30, 0x20, 0x32, 0x30, 0x32, 0x32, 0x00, 0xb0, 0x24, 0x53,
+    0xbb, 0xff, 0x3c, 0xb6, 0x27, 0xbc, 0x24, 0x53, 0xe1, 0x82, 0x88, 0x7f,
+    0x13, 0x0c, 0x00, 0xf2, 0x07, 0xd3, 0xf0, 0x75, 0x42, 0x04, 0x25, 0x00,
+    0x20, 0x48, 0x61, 0x72, 0x64, 0x20, 0x61, 0x73, 0x73, 0x65, 0x72, 0x74,
+    0x00, 0xc8, 0x3f, 0x40, 0x24, 0x01, 0x6c, 0x24, 0x03, 0x08, 0x00, 0x40,
+    0x50, 0x33, 0x00, 0x00, 0xc8, 0x04, 0xf6, 0x07, 0x54, 0x33, 0x00, 0x00,
+    0x52, 0x33, 0x00, 0x00, 0x4d, 0x53, 0x00, 0x00, 0x4d, 0x43, 0x00, 0x00,
+    0x53, 0x34, 0x00, 0x00, 0x43, 0x34, 0xba, 0x00, 0xf0, 0x02, 0xf1, 0x20,
+    0x00, 0x20, 0x65, 0x1f, 0x00, 0x20, 0xe5, 0x1f, 0x00, 0x20, 0x69, 0x20,
+    0x00, 0x20, 0x39, 0xdd, 0x08, 0x0f, 0x01, 0x00, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfb, 0x4f, 0xde, 0xc0, 0x0e, 0x0b, 0x47, 0x00, 0x30,
+    0x0f, 0x01, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0x00, 0x00, 0x3f, 0xcf, 0x40,
+    0x00, 0x10, 0xc3, 0x40, 0x00, 0x10, 0xc5, 0x40, 0x00, 0x10, 0xc1, 0x04,
+    0x00, 0x08, 0x17, 0xc7, 0x0c, 0x00, 0x9f, 0xc9, 0x40, 0x00, 0x10, 0xcb,
+    0x40, 0x00, 0x10, 0xcd, 0x04, 0x00, 0x6c, 0x0a, 0x00, 0x3f, 0x15, 0x4b,
+    0x00, 0x3f, 0x40, 0x4c, 0x05, 0x01, 0x10, 0x04, 0x00, 0x24, 0x34, 0x41,
+    0x00, 0x3f, 0x17, 0x21, 0x00, 0x3f, 0x11, 0x1f, 0x00, 0x3f, 0x1b, 0x2f,
+    0x00, 0x3f, 0x37, 0x1a, 0x49, 0x1b, 0x00, 0x3f, 0x44, 0x19, 0x49, 0x88,
+    0x47, 0x04, 0x00, 0x0a, 0x00, 0x3f, 0x00, 0x58, 0x00, 0x00, 0x00, 0x3f,
+    0x75, 0x84, 0x0c, 0x00, 0x20, 0x10, 0x11, 0x01, 0xf4, 0x3e, 0x01, 0x0c,
+    0x00, 0x0b, 0xf4, 0x3e, 0x3f, 0x02, 0xf0, 0x22, 0xf4, 0x3e, 0x02, 0xf0,
+    0x05, 0x88, 0x0c, 0x00, 0x20, 0x34, 0x1c, 0x00, 0x20, 0x45, 0x65, 0x00,
+    0x10, 0xb1, 0x48, 0x00, 0x10, 0x45, 0x66, 0x00, 0x10, 0xf4, 0x3e, 0x0f,
+    0x94, 0x3e, 0x05, 0x00, 0x6c, 0x00, 0x00, 0x04, 0x00, 0x00, 0x58, 0x00,
+    0x0f, 0x94, 0x3e, 0x09, 0x08, 0x28, 0x00, 0x0f, 0x94, 0x3e, 0x0d, 0x22,
+    0xd0, 0x0d, 0x28, 0x00, 0x4f, 0xf8, 0xfc, 0x00, 0x10, 0x94, 0x3e, 0x09,
+    0x40, 0xd4, 0x0d, 0x00, 0x20, 0x24, 0x00, 0xf0, 0x05, 0x70, 0xb5, 0xfa,
+    0x25, 0x0a, 0x4c, 0x0b, 0x4e, 0x22, 0x68, 0x6d, 0x00, 0x30, 0x00, 0x0a,
+    0x49, 0x00, 0xf0, 0xd0, 0xf9, 0xe8, 0x1f, 0xf1, 0x00, 0xfc, 0xf9, 0x22,
+    0x68, 0x30, 0x00, 0x53, 0x1c, 0x06, 0x49, 0x23, 0x60, 0x00, 0xf0, 0xc6,
+    0x14, 0x00, 0xa2, 0xf2, 0xf9, 0x70, 0xbd, 0x34, 0x14, 0x00, 0x20, 0x24,
+    0x0e, 0x3c, 0x00, 0xf0, 0x01, 0x05, 0xfd, 0x00, 0x10, 0xe1, 0x21, 0x10,
+    0xb5, 0x02, 0x48, 0x49, 0x02, 0x00, 0xf0, 0x09, 0xf8, 0x5c, 0x00, 0x00,
+    0x1c, 0x00, 0x60, 0x10, 0xb5, 0x03, 0x68, 0xdb, 0x69, 0xba, 0x00, 0x20,
+    0x03, 0x7c, 0x2e, 0x2c, 0xf0, 0x1d, 0x01, 0x33, 0x03, 0x74, 0x70, 0x47,
+    0x70, 0x47, 0x13, 0xb5, 0x6b, 0x46, 0x02, 0x68, 0xd9, 0x71, 0x07, 0x33,
+    0x54, 0x68, 0x19, 0x00, 0x01, 0x22, 0xa0, 0x47, 0x16, 0xbd, 0x96, 0x23,
+    0x09, 0x4a, 0x10, 0xb5, 0x12, 0x68, 0xdb, 0x00, 0x9a, 0x42, 0x0a, 0xd1,
+    0x07, 0x4b, 0x8e, 0x3b, 0x20, 0x06, 0xd1, 0x06, 0x3d, 0x82, 0x70, 0xff,
+    0x21, 0x00, 0x03, 0x00, 0x20, 0x00, 0xac, 0x1d, 0xf0, 0x33, 0xc0, 0x04,
+    0x00, 0x20, 0xbc, 0x1a, 0x00, 0x20, 0x55, 0x42, 0x00, 0x00, 0x13, 0xb5,
+    0x00, 0x23, 0x04, 0x00, 0x08, 0x00, 0x21, 0x60, 0x23, 0x71, 0x01, 0xa9,
+    0x0b, 0xf0, 0xcb, 0xfc, 0x00, 0x28, 0x08, 0xd1, 0xd0, 0x23, 0x1b, 0x06,
+    0x1b, 0x68, 0x01, 0x9a, 0x9a, 0x42, 0x04, 0xd0, 0x20, 0x68, 0x0b, 0xf0,
+    0xe8, 0xfc, 0x01, 0x23, 0x23, 0x71, 0x20, 0x00, 0x16, 0xbd, 0x10, 0xb5,
+    0x03, 0x79, 0x04, 0x00, 0x2a, 0x01, 0xf0, 0x15, 0x00, 0x68, 0x0b, 0xf0,
+    0x84, 0xfc, 0x20, 0x00, 0x10, 0xbd, 0x7f, 0xb5, 0x04, 0x00, 0x02, 0xad,
+    0x28, 0x00, 0x0d, 0x49, 0xff, 0xf7, 0xd7, 0xff, 0x23, 0x7c, 0x1c, 0x1e,
+    0x0c, 0xd0, 0x00, 0x24, 0x2b, 0x79, 0xa3, 0x42, 0x56, 0x2a, 0x30, 0xde,
+    0x1d, 0x31, 0x50, 0x1d, 0x81, 0xf0, 0xb4, 0xff, 0xa0, 0x42, 0x06, 0xd0,
+    0x34, 0xca, 0x28, 0x80, 0xdc, 0xff, 0x20, 0x00, 0x04, 0xb0, 0x70, 0xbd,
+    0x98, 0x28, 0xc0, 0xf6, 0xe7, 0xb4, 0x0e, 0x00, 0x20, 0x30, 0xb5, 0x04,
+    0x00, 0x85, 0xb0, 0x46, 0x00, 0xc0, 0x13, 0x49, 0xff, 0xf7, 0xb4, 0xff,
+    0x23, 0x7c, 0x00, 0x2b, 0x02, 0xd1, 0x20, 0x00, 0x40, 0x16, 0xe0, 0x2b,
+    0x79, 0x58, 0x1f, 0x60, 0x00, 0x20, 0x03, 0xf0, 0x5a, 0xff, 0x10, 0x3f,
+    0x00, 0x0a, 0x00, 0x20, 0x6d, 0xff, 0x10, 0x3f, 0x80, 0x6b, 0x46, 0xdc,
+    0x1d, 0x01, 0x22, 0x21, 0x00, 0x12, 0x00, 0x71, 0x70, 0xff, 0x00, 0x28,
+    0xe6, 0xd0, 0x24, 0x60, 0x00, 0xa0, 0xac, 0xff, 0x20, 0x00, 0x05, 0xb0,
+    0x30, 0xbd, 0xc0, 0x46, 0x5c, 0x00, 0xb1, 0x13, 0xb5, 0x04, 0x00, 0x0a,
+    0x49, 0x68, 0x46, 0xff, 0xf7, 0x88, 0x9e, 0x00, 0x00, 0x96, 0x00, 0x80,
+    0x00, 0x24, 0x1b, 0x79, 0xa3, 0x42, 0x03, 0xd0, 0x9a, 0x00, 0x40, 0x47,
+    0xff, 0x04, 0x00, 0x1e, 0x00, 0x20, 0x91, 0xff, 0xe2, 0x00, 0x0c, 0x34,
+    0x00, 0x1f, 0x6e, 0x34, 0x00, 0x02, 0x13, 0xaf, 0x34, 0x00, 0x1b, 0x77,
+    0x34, 0x00, 0x11, 0x09, 0x34, 0x00, 0x11, 0x54, 0xc0, 0x00, 0x60, 0x03,
+    0xd0, 0x6b, 0x46, 0x1b, 0x79, 0x74, 0x31, 0x00, 0x14, 0x00, 0x40, 0x62,
+    0xff, 0x13, 0xbd, 0xa8, 0x00, 0x20, 0x3c, 0xff, 0x70, 0x1f, 0x00, 0x30,
+    0x00, 0x00, 0xc0, 0x2b, 0xf0, 0x3d, 0x87, 0xb0, 0x03, 0x91, 0x04, 0xa8,
+    0x30, 0x49, 0x02, 0x92, 0xff, 0xf7, 0x39, 0xff, 0x23, 0x7c, 0x1e, 0x1e,
+    0x4c, 0xd0, 0x00, 0x26, 0x04, 0xab, 0x1b, 0x79, 0xb3, 0x42, 0x47, 0xd0,
+    0x30, 0x00, 0x03, 0xf0, 0xe0, 0xfe, 0x04, 0x00, 0xb0, 0x42, 0x47, 0xd0,
+    0x01, 0x96, 0x02, 0x9b, 0x9e, 0x42, 0x3c, 0xd2, 0x00, 0x20, 0x9f, 0x1b,
+    0x03, 0xf0, 0x6f, 0xff, 0x05, 0x00, 0xb8, 0x42, 0x00, 0xdd, 0x3d, 0x00,
+    0x00, 0x2d, 0x15, 0xd0, 0x03, 0x9b, 0x2a, 0x00, 0x99, 0x19, 0x5e, 0x00,
+    0x80, 0x49, 0xff, 0x05, 0x00, 0x03, 0xf0, 0x16, 0xfb, 0x0c, 0x00, 0x31,
+    0x07, 0xff, 0x01, 0x0c, 0x2d, 0xf0, 0x09, 0x01, 0x93, 0x01, 0xf0, 0x61,
+    0xfc, 0x18, 0x4b, 0x18, 0x60, 0x59, 0x60, 0xdc, 0xe7, 0x03, 0xf0, 0x07,
+    0xfb, 0x28, 0x00, 0x03, 0xf0, 0xf8, 0xfe, 0x06, 0x00, 0x60, 0xb1, 0xfe,
+    0x00, 0x28, 0x12, 0xd0, 0x0a, 0x00, 0xf0, 0x21, 0x46, 0xff, 0x00, 0x28,
+    0xcd, 0xd1, 0x00, 0x25, 0x01, 0xf0, 0x4b, 0xfc, 0x0e, 0x4c, 0x0c, 0x4b,
+    0x1a, 0x68, 0x5b, 0x68, 0x12, 0x19, 0x6b, 0x41, 0x99, 0x42, 0x02, 0xd8,
+    0xc1, 0xd1, 0x90, 0x42, 0xbf, 0xd9, 0x01, 0x9e, 0x04, 0xa8, 0xff, 0xf7,
+    0xfe, 0xfe, 0x30, 0x00, 0x07, 0xb0, 0xf0, 0xbd, 0x9c, 0x3e, 0x40, 0x03,
+    0x4b, 0x01, 0x94, 0x56, 0x00, 0x11, 0xf1, 0xc4, 0x01, 0x00, 0xb4, 0x03,
+    0x00, 0x7c, 0x25, 0x06, 0x3c, 0x01, 0xf0, 0x05, 0xd0, 0xfe, 0x24, 0x7c,
+    0x00, 0x2c, 0x09, 0xd0, 0x6b, 0x46, 0x1c, 0x79, 0x00, 0x2c, 0x05, 0xd0,
+    0x03, 0xf0, 0xc9, 0xfa, 0x9a, 0x00, 0x22, 0x76, 0xfe, 0x3e, 0x01, 0x20,
+    0xd8, 0xfe, 0x3e, 0x01, 0x00, 0x3c, 0x00, 0x00, 0xfc, 0x03, 0x00, 0x50,
+    0x20, 0x80, 0x19, 0x70, 0xff, 0xf7, 0x9b, 0xfe, 0x10, 0xbd, 0xa0, 0x02,
+    0xf0, 0x11, 0x48, 0x78, 0x0b, 0x78, 0x10, 0xb5, 0x8a, 0x78, 0x00, 0x02,
+    0x18, 0x43, 0xcb, 0x78, 0x12, 0x04, 0x10, 0x43, 0x1b, 0x06, 0x02, 0x4a,
+    0x03, 0x43, 0x13, 0x60, 0xff, 0xf7, 0x89, 0xfe, 0x10, 0xbd, 0xc8, 0x02,
+    0x02, 0x98, 0x03, 0x81, 0x06, 0xd0, 0x04, 0x48, 0xff, 0xf7, 0x0b, 0xff,
+    0xbc, 0x23, 0x30, 0xe0, 0x00, 0xbf, 0x8e, 0x26, 0x20, 0x00, 0x00, 0x40,
+    0x03, 0x20, 0xfa, 0x22, 0x12, 0x27, 0xe0, 0x92, 0x00, 0x9a, 0x60, 0x04,
+    0x4a, 0x59, 0x60, 0x08, 0x32, 0x1a, 0x60, 0x19, 0x74, 0x80, 0x22, 0x00,
+    0x1c, 0x00, 0xf0, 0x1f, 0x14, 0xfd, 0x00, 0x10, 0x0e, 0xb4, 0xf0, 0xb5,
+    0x94, 0xb0, 0x19, 0xad, 0x08, 0xcd, 0x07, 0x00, 0x01, 0x93, 0x40, 0x21,
+    0x2b, 0x00, 0x01, 0x9a, 0x04, 0xa8, 0x03, 0x95, 0x07, 0xf0, 0xde, 0xfe,
+    0x04, 0xac, 0x06, 0x00, 0x3f, 0x28, 0x09, 0xd9, 0x01, 0x30, 0x02, 0xf0,
+    0x83, 0xff, 0x1a, 0x00, 0x40, 0x71, 0x1c, 0x04, 0x00, 0x1c, 0x00, 0x80,
+    0xd0, 0xfe, 0x3b, 0x68, 0x32, 0x00, 0x5b, 0x68, 0x02, 0x2e, 0x71, 0x98,
+    0x47, 0x04, 0xab, 0x05, 0x00, 0x9c, 0x0a, 0x28, 0xf1, 0x02, 0x02, 0xf0,
+    0x73, 0xff, 0x28, 0x00, 0x14, 0xb0, 0xf0, 0xbc, 0x08, 0xbc, 0x03, 0xb0,
+    0x18, 0x47, 0x10, 0x4e, 0x24, 0x40, 0x01, 0xf0, 0x24, 0xfb, 0x92, 0x00,
+    0xd1, 0x30, 0xb5, 0x80, 0x24, 0x00, 0x25, 0x04, 0x49, 0x64, 0x04, 0x0a,
+    0x68, 0x4b, 0x5c, 0x01, 0x80, 0x0a, 0x60, 0x4b, 0x60, 0x30, 0xbd, 0x90,
+    0x0d, 0xe8, 0x03, 0xf0, 0x07, 0xd0, 0x24, 0xff, 0x23, 0x24, 0x06, 0x20,
+    0x68, 0x23, 0x65, 0x04, 0x49, 0x0f, 0x30, 0x00, 0xf0, 0x02, 0xff, 0x20,
+    0x68, 0x01, 0x21, 0x0a, 0x00, 0xe0, 0xe5, 0xfe, 0x10, 0xbd, 0xc1, 0x00,
+    0x00, 0x20, 0x08, 0x4b, 0x10, 0xb5, 0x1b, 0x78, 0x06, 0x04, 0x00, 0x9c,
+    0x27, 0x42, 0x06, 0x4b, 0x00, 0x2b, 0xee, 0x00, 0x00, 0xde, 0x04, 0x11,
+    0xfd, 0x0a, 0x00, 0x47, 0xf9, 0xe7, 0xce, 0x1a, 0x08, 0x1f, 0xf0, 0x00,
+    0xb5, 0x0d, 0x4c, 0x20, 0x00, 0x0c, 0x30, 0x01, 0xf0, 0x2a, 0xfd, 0x00,
+    0xf0, 0x78, 0xfe, 0x02, 0x04, 0xd5, 0x08, 0x22, 0x04, 0x21, 0x14, 0x30,
+    0x01, 0xf0, 0x10, 0xfd, 0x00, 0xf0, 0x6f, 0x12, 0x00, 0xa0, 0x24, 0x30,
+    0x01, 0xf0, 0x07, 0xfd, 0x01, 0x23, 0x23, 0x72, 0x20, 0x04, 0x00, 0x90,
+    0x00, 0xf0, 0x1b, 0x00, 0x23, 0x00, 0x22, 0xf0, 0xb5, 0x02, 0x60, 0x43,
+    0x60, 0x47, 0x4b, 0x04, 0x00, 0x1b, 0x78, 0x87, 0xb0, 0x00, 0x2b, 0x0b,
+    0xd1, 0x01, 0x20, 0x44, 0x49, 0x40, 0x42, 0x01, 0xf0, 0x24, 0xfd, 0x07,
+    0x22, 0x43, 0x4b, 0x1a, 0x60, 0x43, 0x4a, 0x5a, 0x60, 0x0c, 0x02, 0x51,
+    0x0c, 0x20, 0x02, 0xf0, 0xee, 0xda, 0x31, 0xf3, 0x0a, 0x03, 0x60, 0x43,
+    0x60, 0x3e, 0x4e, 0x3f, 0x4b, 0x05, 0x00, 0x83, 0x60, 0xe0, 0x63, 0x02,
+    0xa9, 0x30, 0x00, 0x0b, 0xf0, 0xa1, 0xfa, 0x00, 0x28, 0x33, 0x54, 0x04,
+    0xb1, 0x02, 0x9a, 0x93, 0x42, 0x2a, 0xd1, 0x01, 0x90, 0x37, 0x4f, 0x00,
+    0x2a, 0x35, 0xf3, 0x24, 0xab, 0xfd, 0x00, 0x28, 0x28, 0xdb, 0x67, 0x63,
+    0x34, 0x4b, 0xa0, 0x63, 0x60, 0x6b, 0xc3, 0x18, 0x5a, 0x42, 0x53, 0x41,
+    0x9b, 0x00, 0x5b, 0x59, 0x00, 0x2b, 0x0f, 0xda, 0xa9, 0x68, 0x01, 0xf0,
+    0xb5, 0xfd, 0x00, 0x28, 0x1f, 0xd0, 0xa9, 0x68, 0x60, 0x6b, 0x01, 0xf0,
+    0xc5, 0xfd, 0x2b, 0x4a, 0x63, 0x6b, 0x9b, 0x24, 0x00, 0x37, 0xe8, 0x50,
+    0x27, 0x0e, 0x00, 0x40, 0x5d, 0x59, 0x0d, 0xe0, 0x6c, 0x00, 0x93, 0x93,
+    0xfa, 0x01, 0x23, 0x01, 0x93, 0xcf, 0xe7, 0x21, 0x60, 0x00, 0x00, 0xb8,
+    0x29, 0x60, 0xcf, 0xda, 0x00, 0x25, 0x01, 0x9b, 0xb4, 0x04, 0x00, 0x22,
+    0x00, 0x20, 0x2a, 0xfa, 0xa2, 0x37, 0xf0, 0x09, 0x80, 0x23, 0x5b, 0x02,
+    0x02, 0x93, 0xc0, 0x23, 0x1b, 0x03, 0x04, 0x93, 0x6b, 0x1c, 0x66, 0x6b,
+    0xa7, 0x6b, 0xea, 0x01, 0x1b, 0x03, 0x13, 0x43, 0x54, 0x32, 0x60, 0x2a,
+    0x00, 0x03, 0x93, 0x02, 0xab, 0x9c, 0x00, 0xf0, 0x13, 0x18, 0x23, 0x5f,
+    0x43, 0x10, 0x4b, 0xf6, 0x19, 0xd8, 0x36, 0x33, 0x60, 0x0f, 0x4b, 0xa0,
+    0x6b, 0x33, 0x60, 0x01, 0x23, 0x83, 0x40, 0x62, 0x6b, 0x11, 0x68, 0x0b,
+    0x43, 0x13, 0x60, 0x81, 0xe7, 0xc0, 0x46, 0x70, 0x01, 0x80, 0x4d, 0x46,
+    0x00, 0x10, 0x10, 0xe0, 0x00, 0xe0, 0xf7, 0x21, 0x60, 0xc4, 0x12, 0x00,
+    0x20, 0x7a, 0xfd, 0x83, 0x20, 0xf0, 0x01, 0x20, 0x50, 0x00, 0x00, 0xd0,
+    0xaf, 0x00, 0x00, 0x30, 0x50, 0x20, 0xe0, 0x00, 0x00, 0x40, 0xe0, 0xf0,
+    0x06, 0x20, 0x00, 0x00, 0xc4, 0x01, 0x00, 0xb8, 0x01, 0x46, 0xff, 0xf7,
+    0xa2, 0xfe, 0xc2, 0x01, 0x00, 0x7c, 0x06, 0x04, 0xba, 0x02, 0x45, 0xc0,
+    0x46, 0xa1, 0x45, 0xc3, 0x20, 0x12, 0x00, 0x36, 0x01, 0x00, 0x0c, 0x05,
+    0x00, 0x52, 0x2a, 0xc0, 0x70, 0x47, 0x01, 0x4b, 0xfb, 0xe7, 0x9c, 0x05,
+    0x00, 0x20, 0x3c, 0x0e, 0x7c, 0x43, 0x51, 0x00, 0x21, 0x00, 0x22, 0x02,
+    0xd8, 0x03, 0x40, 0x1a, 0x72, 0x70, 0x47, 0xb8, 0x01, 0xf0, 0x13, 0x7f,
+    0xb5, 0x3b, 0x48, 0x03, 0xab, 0x02, 0xaa, 0x01, 0xa9, 0x01, 0xf0, 0xfd,
+    0xfd, 0x00, 0x28, 0x61, 0xd0, 0x03, 0x9a, 0x02, 0x99, 0x01, 0x98, 0x01,
+    0xf0, 0xba, 0xfd, 0x35, 0x4b, 0x01, 0x22, 0x35, 0x4d, 0x76, 0x2b, 0x90,
+    0x1a, 0x1c, 0x2a, 0x70, 0x00, 0x2b, 0x16, 0xd1, 0x33, 0xf4, 0x06, 0xf0,
+    0x22, 0xd1, 0x32, 0x4b, 0x00, 0x2b, 0x10, 0xd0, 0x01, 0x21, 0xf0, 0x20,
+    0x05, 0xf0, 0x8a, 0xf8, 0x04, 0x00, 0x2f, 0x4b, 0xf0, 0x22, 0x00, 0x21,
+    0x18, 0x60, 0x02, 0xf0, 0xf8, 0xfd, 0x2d, 0x4b, 0x63, 0x60, 0x2d, 0x4b,
+    0xa3, 0x60, 0x2d, 0x4b, 0xe3, 0x60, 0x2d, 0x48, 0x01, 0xf0, 0x05, 0xfc,
+    0x2d, 0x4e, 0xa2, 0x2f, 0x70, 0xef, 0xfe, 0xff, 0xf7, 0x97, 0xff, 0x2b,
+    0x8e, 0x02, 0x01, 0xb8, 0x00, 0x40, 0x00, 0xf0, 0xf8, 0xfc, 0x0e, 0x00,
+    0xb1, 0x2f, 0xd1, 0xe1, 0x21, 0x25, 0x48, 0x49, 0x02, 0xff, 0xf7, 0xa7,
+    0x10, 0x00, 0xa0, 0x27, 0xd1, 0x1a, 0x4c, 0x00, 0x2c, 0x02, 0xd1, 0x19,
+    0x4b, 0xa8, 0x38, 0x40, 0xff, 0xf7, 0xb5, 0xfe, 0x16, 0x00, 0x51, 0x1c,
+    0xd1, 0xff, 0xf7, 0x86, 0x0a, 0x00, 0x20, 0x17, 0xd1, 0x1e, 0x00, 0x21,
+    0x12, 0x4b, 0x52, 0x2d, 0xf1, 0x1a, 0x20, 0xff, 0xf7, 0x66, 0xfe, 0x17,
+    0x48, 0x02, 0xf0, 0x46, 0xfe, 0xff, 0xf7, 0x78, 0xfc, 0xff, 0xf7, 0x56,
+    0xfc, 0xff, 0xf7, 0x66, 0xff, 0xfa, 0xe7, 0x06, 0x49, 0x12, 0x48, 0x01,
+    0xf0, 0x75, 0xfe, 0x34, 0x72, 0xe2, 0xe7, 0xff, 0xf7, 0x93, 0xfe, 0x72,
+    0x00, 0x10, 0x20, 0x42, 0x06, 0x20, 0x88, 0x07, 0x81, 0x33, 0x28, 0x00,
+    0x00, 0xf8, 0x02, 0x00, 0x1c, 0x01, 0xc0, 0x78, 0x01, 0x01, 0x10, 0x58,
+    0x01, 0x01, 0x10, 0x38, 0x01, 0x01, 0x10, 0x94, 0x01, 0x00, 0x1c, 0x01,
+    0x00, 0xf4, 0x03, 0xf0, 0x17, 0x8d, 0x46, 0x00, 0x10, 0x48, 0xfd, 0x00,
+    0x10, 0x83, 0x69, 0xc2, 0x69, 0x93, 0x42, 0x05, 0xd1, 0x80, 0x22, 0x43,
+    0x6a, 0x92, 0x00, 0x04, 0x3b, 0x1b, 0x68, 0x9b, 0x18, 0x18, 0x1f, 0x70,
+    0x47, 0xd0, 0x23, 0x70, 0xb5, 0x28, 0x24, 0x74, 0x01, 0xd1, 0x5c, 0x43,
+    0x11, 0x4b, 0x1c, 0x19, 0xa5, 0x69, 0xa3, 0x68, 0x9d, 0x42, 0x0a, 0xe6,
+    0x2b, 0xf1, 0x12, 0xe5, 0xff, 0xe3, 0x69, 0x06, 0x68, 0x9d, 0x42, 0x04,
+    0xd0, 0x04, 0x3d, 0xa5, 0x61, 0x86, 0xf3, 0x10, 0x88, 0x70, 0xbd, 0x80,
+    0x21, 0x28, 0x00, 0x89, 0x00, 0x02, 0xf0, 0x7b, 0xfd, 0x80, 0x22, 0x63,
+    0x4a, 0x00, 0xf0, 0x0b, 0x63, 0x62, 0x1b, 0x68, 0x9a, 0x18, 0xe3, 0x61,
+    0xfd, 0x33, 0xff, 0x33, 0x22, 0x62, 0xa3, 0x61, 0xea, 0xe7, 0x64, 0x0e,
+    0x00, 0x20, 0xd0, 0x23, 0xf0, 0xb5, 0x56, 0x00, 0x40, 0x87, 0xb0, 0x01,
+    0x93, 0x8c, 0x45, 0xf0, 0x13, 0x03, 0x93, 0x72, 0xb6, 0x50, 0x4b, 0x28,
+    0x20, 0x9c, 0x46, 0x01, 0x9b, 0x58, 0x43, 0x63, 0x46, 0x1d, 0x18, 0x2a,
+    0x6a, 0xab, 0x69, 0x04, 0x3a, 0x93, 0x42, 0x04, 0xd0, 0x03, 0x9a, 0x04,
+    0xc3, 0xab, 0x61, 0x58, 0x03, 0xf0, 0xac, 0x6a, 0x6a, 0x69, 0x69, 0xac,
+    0x68, 0x56, 0x1a, 0xb7, 0x10, 0x04, 0x96, 0xee, 0x69, 0x9b, 0x1b, 0x7e,
+    0x1e, 0x9b, 0x10, 0xf6, 0x01, 0x9e, 0x19, 0x2b, 0x69, 0x1b, 0x1b, 0x9b,
+    0x10, 0xf3, 0x18, 0x41, 0x4e, 0xb3, 0x42, 0x02, 0xd1, 0x40, 0x48, 0x04,
+    0xf0, 0xa4, 0xff, 0x64, 0x46, 0x04, 0x59, 0x6b, 0x68, 0x10, 0x1b, 0x80,
+    0x10, 0x18, 0x1a, 0x01, 0x28, 0x1c, 0xd8, 0x02, 0x37, 0x78, 0x00, 0x83,
+    0x42, 0x3a, 0xd9, 0xdb, 0x1b, 0x5b, 0x08, 0x9b, 0x00, 0xe4, 0x18, 0x13,
+    0x1d, 0x5a, 0x1a, 0xa1, 0x42, 0x29, 0xd9, 0x20, 0x00, 0x99, 0x42, 0x2c,
+    0xd1, 0x80, 0x22, 0x23, 0x68, 0x92, 0x00, 0xeb, 0x60, 0x9b, 0x18, 0x2b,
+    0x61, 0x04, 0x9b, 0x6c, 0x61, 0xe4, 0x18, 0x23, 0x68, 0x6c, 0x62, 0xeb,
+    0x61, 0x9b, 0x18, 0x2b, 0x62, 0x28, 0x24, 0x80, 0x20, 0x01, 0x9b, 0x80,
+    0x00, 0x5c, 0x43, 0x28, 0x4b, 0x1c, 0x19, 0x66, 0x6a, 0x02, 0xf0, 0x00,
+    0xfd, 0x70, 0x60, 0xa3, 0x69, 0x03, 0x9a, 0x1a, 0x60, 0x63, 0x6a, 0x1a,
+    0x1d, 0x6a, 0x62, 0x80, 0x22, 0x5b, 0x68, 0x92, 0x00, 0x9a, 0x18, 0xeb,
+    0x61, 0x2a, 0x62, 0xa3, 0x61, 0xa9, 0xe7, 0x99, 0x42, 0xd6, 0xd0, 0x04,
+    0x9b, 0x18, 0x1d, 0x80, 0x1a, 0x20, 0x18, 0x0b, 0xf0, 0xd9, 0xf8, 0xcf,
+    0xe7, 0x9e, 0x85, 0x47, 0xf1, 0x23, 0xd1, 0x01, 0x33, 0xf6, 0x18, 0x80,
+    0x23, 0x9b, 0x05, 0x9e, 0x42, 0x01, 0xd3, 0x04, 0xf0, 0x4f, 0xff, 0xb0,
+    0x00, 0x02, 0xf0, 0xda, 0xfc, 0x28, 0x22, 0x01, 0x9b, 0xf4, 0x1b, 0x5a,
+    0x43, 0x10, 0x4b, 0x64, 0x08, 0x9b, 0x18, 0x5a, 0x6a, 0x59, 0x69, 0xa4,
+    0x00, 0x04, 0x32, 0x05, 0x90, 0x04, 0x19, 0x91, 0x5e, 0x07, 0xf0, 0x1d,
+    0x52, 0x1a, 0x0b, 0xf0, 0xb7, 0xf8, 0x28, 0x23, 0x01, 0x9a, 0x5a, 0x43,
+    0x07, 0x4b, 0x02, 0x92, 0x9f, 0x18, 0x7b, 0x68, 0x99, 0x00, 0x05, 0x4b,
+    0xd0, 0x58, 0x02, 0xf0, 0xc7, 0xfc, 0x03, 0x4b, 0x02, 0x9a, 0x05, 0x99,
+    0x7e, 0x60, 0xd1, 0x50, 0x9c, 0xe7, 0xc0, 0x46, 0x5c, 0x01, 0xf0, 0x25,
+    0xff, 0xff, 0xff, 0x1f, 0x84, 0xfd, 0x00, 0x10, 0xf8, 0xb5, 0x80, 0x27,
+    0x18, 0x4c, 0xbf, 0x00, 0x00, 0x25, 0x08, 0x23, 0x25, 0x60, 0x63, 0x60,
+    0xa5, 0x60, 0xe5, 0x60, 0x25, 0x61, 0x65, 0x61, 0xa5, 0x61, 0xe5, 0x61,
+    0x25, 0x62, 0x65, 0x62, 0x20, 0x20, 0x02, 0xf0, 0x9b, 0xfc, 0x63, 0x68,
+    0x20, 0x60, 0x01, 0x3b, 0x14, 0x01, 0xf0, 0x29, 0xc6, 0x18, 0x38, 0x00,
+    0x02, 0xf0, 0x92, 0xfc, 0x80, 0x23, 0x9b, 0x00, 0xc3, 0x18, 0x23, 0x61,
+    0x23, 0x62, 0x0a, 0x4b, 0x66, 0x61, 0xe0, 0x60, 0x66, 0x62, 0xe0, 0x61,
+    0xa0, 0x60, 0xa0, 0x61, 0x28, 0x34, 0x30, 0x60, 0xa3, 0x42, 0xd7, 0xd1,
+    0x05, 0x4b, 0x1a, 0x1d, 0x1d, 0x71, 0x9d, 0x60, 0x5d, 0x61, 0xda, 0x60,
+    0x1a, 0x61, 0xf8, 0xbd, 0x74, 0x00, 0x00, 0xb4, 0x06, 0xf0, 0x05, 0x4c,
+    0x0e, 0x00, 0x20, 0x04, 0x4b, 0x10, 0xb5, 0x18, 0x68, 0x00, 0xf0, 0x1b,
+    0xfc, 0xfa, 0x20, 0x00, 0x21, 0x80, 0x00, 0xc0, 0x03, 0x11, 0x44, 0xb8,
+    0x09, 0x70, 0x06, 0x4c, 0x00, 0x21, 0x20, 0x00, 0x0b, 0xe0, 0x0a, 0xe1,
+    0x28, 0x04, 0xd0, 0x02, 0xf0, 0x4c, 0xff, 0x20, 0x00, 0x0a, 0xf0, 0xeb,
+    0xff, 0x10, 0xf0, 0x06, 0x10, 0x3f, 0xec, 0x09, 0xf8, 0x46, 0x4b, 0x03,
+    0x4a, 0x03, 0x48, 0x01, 0xf0, 0xf1, 0xfc, 0xc0, 0x46, 0xb4, 0xfd, 0x00,
+    0x10, 0xcf, 0xfd, 0x00, 0x10, 0x05, 0xfe, 0x00, 0x10, 0x30, 0xb5, 0x23,
+    0x4c, 0x23, 0x4b, 0x24, 0x4d, 0x24, 0x49, 0x25, 0x4a, 0x25, 0x48, 0x00,
+    0x2c, 0x08, 0xd0, 0x00, 0x2b, 0x08, 0xd1, 0x00, 0x2d, 0x12, 0xd1, 0x00,
+    0x29, 0x0e, 0xd1, 0x00, 0x2a, 0x0c, 0xd1, 0x30, 0xbd, 0x00, 0x2b, 0x09,
+    0xd0, 0xc3, 0x7a, 0x84, 0x7a, 0x1b, 0x02, 0x23, 0x43, 0x80, 0x24, 0x24,
+    0x02, 0x1c, 0x43, 0x24, 0x0a, 0x83, 0x72, 0xc4, 0x72, 0x00, 0x2d, 0x18,
+    0x00, 0x25, 0xe4, 0x01, 0x18, 0x00, 0x10, 0x29, 0x18, 0x00, 0xf0, 0x03,
+    0x81, 0x7a, 0x1b, 0x02, 0x0b, 0x43, 0x80, 0x21, 0x49, 0x00, 0x19, 0x43,
+    0x09, 0x0a, 0x83, 0x72, 0xc1, 0x72, 0x66, 0x30, 0x61, 0xc3, 0x7a, 0x82,
+    0x7a, 0x1b, 0x02, 0xfc, 0x36, 0xf7, 0x07, 0x01, 0x1a, 0x43, 0x12, 0x0a,
+    0x83, 0x72, 0xc2, 0x72, 0x00, 0x23, 0x03, 0x71, 0x43, 0x71, 0x83, 0x71,
+    0xc9, 0xe7, 0xc0, 0x46, 0x69, 0x90, 0x04, 0x04, 0x01, 0x00, 0x20, 0xc4,
+    0x04, 0xc0, 0x08, 0xf0, 0x17, 0x8d, 0x4c, 0xbd, 0xb0, 0x21, 0x00, 0x4f,
+    0x22, 0x14, 0xa8, 0x02, 0xf0, 0xe8, 0xfb, 0x21, 0x00, 0x43, 0x22, 0x4f,
+    0x31, 0x03, 0xa8, 0x02, 0xf0, 0xe2, 0xfb, 0x87, 0x4c, 0x26, 0x1e, 0x00,
+    0xd0, 0x43, 0x26, 0x86, 0x4b, 0x87, 0x4f, 0xdc, 0x03, 0x40, 0x86, 0x4b,
+    0x4f, 0x36, 0x42, 0x2d, 0x50, 0x35, 0x00, 0x05, 0xe0, 0x83, 0x8e, 0x0b,
+    0xf0, 0x02, 0xd1, 0xef, 0xe0, 0x35, 0x00, 0x44, 0x35, 0x28, 0x00, 0x05,
+    0xf0, 0x04, 0xf8, 0x01, 0x90, 0x38, 0x60, 0x34, 0x35, 0xf0, 0x05, 0xeb,
+    0xe0, 0x7d, 0x4b, 0x1d, 0x60, 0x00, 0x2c, 0x03, 0xd0, 0x43, 0x22, 0x03,
+    0xa9, 0x02, 0xf0, 0xbe, 0xfb, 0x76, 0x4b, 0xce, 0x29, 0xf1, 0x10, 0x00,
+    0x2c, 0x00, 0xd1, 0xdf, 0xe0, 0x77, 0x49, 0x4f, 0x22, 0x12, 0x31, 0x28,
+    0xa8, 0x02, 0xf0, 0xb2, 0xfb, 0x4f, 0x22, 0x01, 0x98, 0x28, 0xa9, 0x43,
+    0x30, 0x02, 0xf0, 0xac, 0xfb, 0x6f, 0x50, 0x00, 0xf1, 0x9c, 0xcd, 0xe0,
+    0x63, 0x1e, 0x9c, 0x41, 0x6a, 0x4b, 0x00, 0x21, 0x5a, 0x1e, 0x93, 0x41,
+    0x32, 0xa8, 0x13, 0x22, 0x01, 0x34, 0xe4, 0x18, 0x02, 0xf0, 0x96, 0xfb,
+    0xa1, 0x20, 0x01, 0x23, 0x28, 0xad, 0x28, 0x71, 0x1c, 0x38, 0xa8, 0x71,
+    0x55, 0x38, 0xe8, 0x72, 0xc0, 0x18, 0x68, 0x73, 0xc0, 0x18, 0xe8, 0x73,
+    0x33, 0x20, 0xec, 0x71, 0x35, 0x24, 0x09, 0x22, 0x05, 0x21, 0x81, 0x27,
+    0xe8, 0x74, 0xc0, 0x18, 0x68, 0x75, 0x1f, 0x38, 0xa8, 0x75, 0x10, 0x30,
+    0x28, 0x76, 0x5a, 0x30, 0x68, 0x76, 0x16, 0x30, 0xa8, 0x76, 0x8f, 0x38,
+    0xe8, 0x76, 0x6f, 0x30, 0x28, 0x77, 0x6d, 0x38, 0x68, 0x77, 0x06, 0x38,
+    0x84, 0x46, 0x6c, 0x74, 0xe8, 0x77, 0x02, 0xac, 0x97, 0x30, 0x00, 0x19,
+    0x29, 0x70, 0x6b, 0x70, 0xaa, 0x70, 0xe9, 0x70, 0x6b, 0x71, 0x29, 0x72,
+    0x6b, 0x72, 0xaa, 0x72, 0x2a, 0x73, 0xaa, 0x73, 0x2a, 0x74, 0xaa, 0x74,
+    0x2a, 0x75, 0xef, 0x75, 0xaf, 0x77, 0xc1, 0x77, 0x9a, 0x20, 0x00, 0x19,
+    0xc3, 0x77, 0x9b, 0x20, 0x00, 0x19, 0x39, 0x24, 0xc2, 0x77, 0x29, 0xa8,
+    0xc4, 0x77, 0x9d, 0x20, 0x02, 0xac, 0x00, 0x19, 0x15, 0x24, 0xc4, 0x77,
+    0x9e, 0x0a, 0x00, 0xf1, 0x0c, 0xc3, 0x77, 0x9f, 0x20, 0x00, 0x19, 0x25,
+    0x24, 0xc4, 0x77, 0x2a, 0xa8, 0x1d, 0x3c, 0xc4, 0x77, 0x02, 0xa8, 0xb8,
+    0x34, 0x00, 0x19, 0x8b, 0x3c, 0x04, 0x70, 0xc2, 0x20, 0x00, 0x51, 0x46,
+    0x24, 0x04, 0x70, 0xc3, 0x0a, 0x00, 0x91, 0x3b, 0x24, 0x04, 0x70, 0x33,
+    0xa8, 0x03, 0x70, 0xc5, 0x0e, 0x00, 0x51, 0x95, 0x24, 0x04, 0x70, 0xc6,
+    0x0a, 0x00, 0xf1, 0x02, 0x03, 0x70, 0xc7, 0x20, 0x00, 0x19, 0x75, 0x24,
+    0x04, 0x70, 0x34, 0xa8, 0x6d, 0x3c, 0x04, 0x70, 0xc9, 0x16, 0x00, 0xb1,
+    0x07, 0x70, 0xca, 0x20, 0x00, 0x19, 0x64, 0x46, 0x04, 0x70, 0xcb, 0x10,
+    0x00, 0xf0, 0x09, 0x01, 0x70, 0x35, 0xa9, 0x0a, 0x70, 0x19, 0x21, 0xc4,
+    0x32, 0x12, 0x19, 0x11, 0x70, 0xce, 0x22, 0x12, 0x19, 0x13, 0x70, 0xcf,
+    0x22, 0x29, 0x21, 0x0e, 0x00, 0xf1, 0x0e, 0x20, 0x22, 0x36, 0xa9, 0x0a,
+    0x70, 0xd1, 0x21, 0x09, 0x19, 0x15, 0x24, 0x0c, 0x70, 0xd3, 0x21, 0x02,
+    0xa8, 0x09, 0x18, 0x10, 0x34, 0x0c, 0x70, 0x37, 0xa9, 0x0b, 0x70, 0xd5,
+    0x0e, 0x00, 0x51, 0x70, 0x34, 0x0c, 0x70, 0xd6, 0x0a, 0x00, 0xf0, 0x11,
+    0x0a, 0x70, 0xb7, 0x32, 0x12, 0x18, 0x20, 0x3c, 0x14, 0x70, 0x38, 0xaa,
+    0x13, 0x70, 0xd8, 0x33, 0x1b, 0x18, 0x1f, 0x70, 0xda, 0x23, 0x62, 0x46,
+    0x1b, 0x18, 0x1a, 0x70, 0xdb, 0x23, 0xc0, 0x22, 0x08, 0x00, 0x00, 0x58,
+    0x4a, 0xf0, 0x0b, 0x98, 0x19, 0x7c, 0x3a, 0x02, 0xf0, 0xe1, 0xfa, 0x05,
+    0xe0, 0x00, 0x2e, 0x00, 0xd0, 0x06, 0xe7, 0x09, 0x4b, 0x3e, 0x60, 0x1e,
+    0x60, 0x3d, 0xb0, 0xf0, 0xbd, 0xb4, 0x01, 0x66, 0x14, 0xa9, 0x25, 0xe7,
+    0x85, 0xfe, 0x50, 0x02, 0x10, 0x38, 0xc8, 0x06, 0xc1, 0x00, 0x00, 0x00,
+    0x48, 0x0e, 0x00, 0x20, 0x05, 0xff, 0x00, 0x10, 0x01, 0xe6, 0x06, 0x20,
+    0xc0, 0x46, 0x18, 0x00, 0x04, 0x0c, 0x00, 0x11, 0x40, 0x2c, 0x0b, 0x40,
+    0xc2, 0x4b, 0xb9, 0xb0, 0x0a, 0x07, 0x80, 0x00, 0xd0, 0x67, 0xe1, 0xc0,
+    0x4b, 0xc0, 0x4e, 0x0a, 0x00, 0x31, 0x6f, 0xe1, 0xbf, 0xda, 0x0d, 0xf0,
+    0x0d, 0x6b, 0xe1, 0xbe, 0x4d, 0x00, 0x2d, 0x00, 0xd0, 0x6c, 0xe1, 0x02,
+    0x23, 0x01, 0x93, 0x2b, 0x00, 0x00, 0x2e, 0x05, 0xd1, 0x01, 0x96, 0x02,
+    0xe0, 0x02, 0x23, 0x01, 0x25, 0x10, 0x00, 0xf1, 0x00, 0x01, 0x9a, 0x9b,
+    0x18, 0xb7, 0x4a, 0xdb, 0xb2, 0x03, 0x93, 0x02, 0x23, 0x00, 0x2a, 0x00,
+    0xd6, 0x44, 0xf0, 0x0b, 0xb4, 0x49, 0xd3, 0x18, 0xdb, 0xb2, 0x42, 0x22,
+    0x61, 0x31, 0x10, 0xa8, 0x02, 0x93, 0x02, 0xf0, 0x88, 0xfa, 0xb0, 0x4b,
+    0x09, 0xac, 0x1b, 0x68, 0x19, 0x22, 0xb8, 0x03, 0x00, 0x1a, 0x4b, 0xf3,
+    0x10, 0x79, 0xfa, 0x5c, 0x22, 0x00, 0x21, 0x21, 0xa8, 0x02, 0xf0, 0x74,
+    0xfa, 0x4b, 0x27, 0x00, 0x2e, 0x00, 0xd1, 0x42, 0x3f, 0x19, 0x23, 0x6a,
+    0x42, 0x13, 0x40, 0xa4, 0x4a, 0xff, 0x18, 0x5c, 0x4a, 0x00, 0xf0, 0x34,
+    0xff, 0x18, 0x09, 0x22, 0x00, 0x21, 0x06, 0xa8, 0x02, 0xf0, 0x61, 0xfa,
+    0xfb, 0xb2, 0x38, 0x00, 0x05, 0x93, 0x04, 0xf0, 0x9b, 0xfe, 0x96, 0x4b,
+    0x06, 0x1e, 0x18, 0x60, 0x00, 0xd1, 0x11, 0xe1, 0x3a, 0x00, 0x00, 0x21,
+    0x02, 0xf0, 0x53, 0xfa, 0x09, 0x22, 0x06, 0xab, 0x1a, 0x70, 0x02, 0x23,
+    0x06, 0xaa, 0x53, 0x70, 0x13, 0x00, 0x05, 0x9a, 0x30, 0x00, 0x9a, 0x70,
+    0x02, 0x9a, 0x06, 0xa9, 0x1a, 0x71, 0x01, 0x14, 0x00, 0xf0, 0x06, 0x71,
+    0x9f, 0x33, 0xd3, 0x71, 0x23, 0x3b, 0x13, 0x72, 0x09, 0x22, 0x02, 0xf0,
+    0x42, 0xfa, 0x30, 0x00, 0x88, 0x4b, 0x09, 0x30, 0xdc, 0x00, 0xf0, 0x03,
+    0xf6, 0xe0, 0x02, 0x90, 0x00, 0x2d, 0x29, 0xd0, 0x04, 0x23, 0x63, 0x70,
+    0x01, 0x9b, 0x09, 0x21, 0xa3, 0x70, 0x8c, 0x0d, 0xf1, 0x38, 0x23, 0x73,
+    0xa3, 0x73, 0x21, 0x33, 0xe3, 0x73, 0x04, 0x9b, 0x03, 0x22, 0x23, 0x74,
+    0x1b, 0x12, 0x63, 0x74, 0x07, 0x23, 0xa3, 0x74, 0x02, 0x3b, 0xe3, 0x74,
+    0x7e, 0x33, 0x21, 0x70, 0x61, 0x72, 0x23, 0x75, 0x18, 0x31, 0x43, 0x3b,
+    0xa1, 0x72, 0xa3, 0x75, 0x10, 0x39, 0x36, 0x3b, 0x62, 0x71, 0xe1, 0x72,
+    0x62, 0x75, 0x23, 0x76, 0x21, 0x00, 0x02, 0x98, 0x16, 0x32, 0x02, 0xf0,
+    0x12, 0xfa, 0x02, 0x9b, 0x19, 0x33, 0x02, 0x93, 0x72, 0x3a, 0x03, 0xf0,
+    0x3f, 0xbf, 0xe0, 0x04, 0x25, 0x03, 0x27, 0x6d, 0x24, 0x21, 0xa9, 0x4d,
+    0x70, 0x00, 0x95, 0xcd, 0x74, 0x0f, 0x76, 0x7f, 0x19, 0x06, 0xad, 0x64,
+    0x19, 0xcf, 0x76, 0x27, 0x00, 0x25, 0x24, 0xfc, 0x77, 0x06, 0x27, 0x24,
+    0x26, 0x03, 0x9b, 0x4a, 0x34, 0x64, 0x19, 0xe7, 0x77, 0x5a, 0x1c, 0x22,
+    0xac, 0xe6, 0x77, 0xd2, 0xb2, 0x71, 0x24, 0x4a, 0x74, 0x0a, 0x75, 0x02,
+    0x22, 0x03, 0x9b, 0x64, 0x19, 0xe2, 0x77, 0x72, 0x24, 0x8b, 0x70, 0x01,
+    0x23, 0x64, 0x19, 0xe3, 0x77, 0x73, 0x24, 0x06, 0x00, 0xf1, 0x4e, 0x2b,
+    0xac, 0x27, 0x70, 0x95, 0x24, 0x64, 0x19, 0x27, 0x00, 0x34, 0x00, 0x09,
+    0x20, 0x72, 0x34, 0x64, 0x19, 0x08, 0x70, 0x4b, 0x71, 0x8b, 0x71, 0x48,
+    0x72, 0x8e, 0x72, 0xcb, 0x72, 0x4b, 0x73, 0x88, 0x73, 0x0b, 0x74, 0x88,
+    0x74, 0x8a, 0x75, 0xcb, 0x75, 0x0e, 0x77, 0x4b, 0x77, 0xcb, 0x77, 0x3e,
+    0x70, 0x22, 0x70, 0x97, 0x24, 0x64, 0x19, 0x22, 0x70, 0x9a, 0x24, 0x64,
+    0x19, 0x20, 0x70, 0x9b, 0x24, 0x2c, 0xaf, 0x64, 0x19, 0x3a, 0x70, 0x27,
+    0x00, 0x24, 0x24, 0x3c, 0x70, 0x9d, 0x24, 0x64, 0x19, 0x23, 0x70, 0x9e,
+    0x24, 0x03, 0x26, 0x64, 0x19, 0x26, 0x70, 0x9f, 0x0e, 0x00, 0x11, 0xa1,
+    0x06, 0x00, 0x11, 0xa3, 0x2e, 0x00, 0xf0, 0x01, 0x24, 0x24, 0x2d, 0xaf,
+    0x3e, 0x70, 0x2e, 0xaf, 0x3a, 0x70, 0x2f, 0xaf, 0x3c, 0x70, 0x81, 0x34,
+    0x26, 0x00, 0x11, 0xa6, 0x4e, 0x00, 0xd1, 0xa7, 0x24, 0x04, 0x27, 0x64,
+    0x19, 0x27, 0x70, 0x30, 0xac, 0x23, 0x70, 0xa9, 0x32, 0x00, 0x11, 0xaa,
+    0x06, 0x00, 0xf0, 0x13, 0x31, 0xac, 0x20, 0x70, 0x05, 0x24, 0xa9, 0x37,
+    0x7f, 0x19, 0x3c, 0x70, 0xae, 0x27, 0x7f, 0x19, 0x3b, 0x70, 0xaf, 0x27,
+    0x7f, 0x19, 0x40, 0x25, 0x3a, 0x70, 0x32, 0xaf, 0x3d, 0x70, 0xb5, 0x27,
+    0x06, 0xad, 0x1a, 0x00, 0xe0, 0xb6, 0x27, 0x7f, 0x19, 0x3d, 0x00, 0x25,
+    0x27, 0x2f, 0x70, 0x06, 0xad, 0x92, 0x37, 0x26, 0x00, 0x60, 0xb9, 0x27,
+    0x34, 0xad, 0x2b, 0x70, 0x1e, 0x00, 0x31, 0x3b, 0x70, 0xba, 0x26, 0x00,
+    0xf2, 0x24, 0x38, 0x70, 0x06, 0xad, 0xb2, 0x30, 0x40, 0x19, 0x81, 0x25,
+    0x04, 0x70, 0x35, 0xa8, 0x05, 0x70, 0xbd, 0x20, 0x06, 0xad, 0x40, 0x19,
+    0x02, 0x70, 0x40, 0x20, 0xbc, 0x32, 0x52, 0x19, 0x10, 0x70, 0xc3, 0x22,
+    0x25, 0x27, 0x52, 0x19, 0x14, 0x70, 0x37, 0xaa, 0x17, 0x70, 0xc5, 0x22,
+    0x52, 0x19, 0x13, 0x70, 0xc6, 0x06, 0x00, 0xe1, 0x33, 0x5b, 0x19, 0x5c,
+    0x22, 0x02, 0x98, 0x1e, 0x70, 0x02, 0xf0, 0x4b, 0xf9, 0x39, 0xc0, 0x4b,
+    0xf0, 0x05, 0x01, 0x93, 0x01, 0x25, 0xa8, 0xe6, 0x42, 0x22, 0x10, 0xa9,
+    0x4b, 0x36, 0x02, 0xf0, 0x40, 0xf9, 0x02, 0x96, 0x02, 0xe7, 0x44, 0x03,
+    0xe2, 0x9b, 0xe6, 0x01, 0x96, 0xf1, 0xe7, 0x00, 0x2e, 0xed, 0xd1, 0x01,
+    0x25, 0x93, 0xe6, 0x10, 0x03, 0x00, 0x34, 0x03, 0x0c, 0x98, 0x05, 0x00,
+    0x40, 0x03, 0x00, 0x48, 0x03, 0x00, 0xa4, 0x33, 0x20, 0x14, 0x48, 0x54,
+    0x2e, 0xf0, 0xa7, 0x02, 0xd1, 0x11, 0x21, 0x01, 0xf0, 0x9b, 0xf8, 0x00,
+    0x2c, 0x0c, 0xd1, 0x11, 0x4b, 0x11, 0x4a, 0x5a, 0x80, 0x01, 0x23, 0xc0,
+    0x22, 0x01, 0x33, 0xdb, 0xb2, 0x0d, 0x48, 0x5b, 0x00, 0x92, 0x00, 0x13,
+    0x43, 0x03, 0x80, 0x10, 0xbd, 0x00, 0x20, 0x04, 0x2c, 0xfb, 0xd8, 0x02,
+    0x00, 0x0a, 0x4b, 0xa4, 0x00, 0xe4, 0x58, 0x07, 0x49, 0xa0, 0x5c, 0xd3,
+    0xb2, 0x00, 0x28, 0xea, 0xd0, 0x01, 0x32, 0x48, 0x80, 0x02, 0x31, 0x13,
+    0x2a, 0xf6, 0xd1, 0x13, 0x00, 0xe3, 0xe7, 0xc0, 0x46, 0xbd, 0x1a, 0x00,
+    0x20, 0x94, 0x1a, 0x00, 0x20, 0x09, 0x04, 0x00, 0x00, 0xa8, 0xff, 0x00,
+    0x10, 0xf0, 0xb5, 0x85, 0xb0, 0x03, 0xf0, 0x5d, 0xfb, 0x05, 0x1e, 0x2d,
+    0xd1, 0xff, 0xf7, 0xf8, 0xfc, 0xff, 0xf7, 0x2c, 0xfe, 0x15, 0x48, 0x00,
+    0xf0, 0xf3, 0xfe, 0x03, 0xf0, 0x4d, 0xfb, 0x01, 0x20, 0x00, 0xf0, 0xd6,
+    0xf9, 0x12, 0x4c, 0x13, 0x49, 0x20, 0x60, 0x00, 0xf0, 0x9b, 0xf8, 0x01,
+    0x21, 0x20, 0x68, 0x00, 0xf0, 0x7f, 0xf8, 0x00, 0xf0, 0x97, 0xfb, 0x04,
+    0x00, 0x00, 0xf0, 0x18, 0xfd, 0x06, 0x00, 0x0f, 0x1e, 0x01, 0xda, 0xff,
+    0xf7, 0x79, 0xfc, 0xfa, 0x22, 0x00, 0x23, 0x92, 0x00, 0x92, 0x19, 0x7b,
+    0x41, 0x00, 0x2b, 0xf6, 0xdb, 0xd8, 0x44, 0xc0, 0x06, 0x49, 0x20, 0x00,
+    0x01, 0x95, 0x00, 0x91, 0x00, 0xf0, 0x84, 0xfb, 0x80, 0x2d, 0x00, 0x34,
+    0x07, 0x00, 0x58, 0x07, 0x80, 0x39, 0x4c, 0x00, 0x10, 0x21, 0x4c, 0x00,
+    0x10, 0x32, 0x0e, 0x00, 0x50, 0x0b, 0x0f, 0xf0, 0x34, 0x1d, 0x20, 0xd6,
+    0x04, 0xd4, 0x30, 0xf0, 0x15, 0x04, 0x4b, 0x01, 0x00, 0x00, 0x93, 0x18,
+    0x22, 0x1f, 0x23, 0x02, 0x48, 0x03, 0xf0, 0x63, 0xfe, 0x0e, 0xbd, 0xbc,
+    0xff, 0x00, 0x10, 0x38, 0x14, 0x00, 0x20, 0x07, 0x4b, 0x10, 0x30, 0x9b,
+    0x68, 0x80, 0x00, 0xc1, 0x50, 0x54, 0x00, 0x00, 0x04, 0x00, 0x00, 0xe6,
+    0x0e, 0x30, 0x19, 0x60, 0x82, 0xee, 0x09, 0x00, 0x5c, 0x00, 0xf0, 0x02,
+    0xed, 0x00, 0xe0, 0x24, 0x01, 0x00, 0xd0, 0x01, 0x22, 0x82, 0x40, 0x03,
+    0x4b, 0x1b, 0x68, 0x13, 0x40, 0x6e, 0x06, 0x21, 0xd8, 0xb2, 0x1c, 0x00,
+    0xb0, 0xe1, 0x00, 0xe0, 0x00, 0x29, 0x04, 0xd0, 0x03, 0x4b, 0x18, 0x60,
+    0x04, 0x00, 0xc0, 0x70, 0x47, 0x03, 0x4b, 0xfb, 0xe7, 0xc0, 0x46, 0x80,
+    0xe2, 0x00, 0xe0, 0x1c, 0x00, 0x40, 0x80, 0xe1, 0x00, 0xe0, 0x40, 0x0c,
+    0x80, 0x10, 0xb5, 0x18, 0x00, 0xff, 0xf7, 0xea, 0xff, 0x14, 0x0e, 0x00,
+    0x10, 0x00, 0x31, 0x01, 0x4a, 0x13, 0x88, 0x34, 0x53, 0x00, 0xe2, 0x00,
+    0xe0, 0x02, 0x80, 0x00, 0x40, 0xc0, 0x58, 0x70, 0x47, 0x6c, 0x00, 0x00,
+    0x2c, 0x34, 0xf0, 0x01, 0x0d, 0x00, 0xef, 0xf3, 0x10, 0x86, 0x72, 0xb6,
+    0x0a, 0x4a, 0x13, 0x68, 0x00, 0x2b, 0xfc, 0xd0, 0x96, 0x00, 0x00, 0x90,
+    0x0a, 0xa0, 0xe9, 0xff, 0x07, 0x4b, 0x98, 0x42, 0x03, 0xd0, 0xa8, 0x42,
+    0x64, 0x0e, 0x51, 0xfc, 0xf8, 0x32, 0x00, 0x29, 0x96, 0x35, 0x40, 0x9d,
+    0xff, 0x70, 0xbd, 0xa4, 0x00, 0x00, 0x00, 0x14, 0x00, 0xa4, 0x01, 0x40,
+    0x05, 0x00, 0x01, 0x91, 0x74, 0x0a, 0x57, 0x02, 0x93, 0x72, 0xb6, 0x49,
+    0x44, 0x00, 0xf0, 0x13, 0x2f, 0x00, 0x47, 0x4b, 0x10, 0x37, 0x9b, 0x68,
+    0xba, 0x00, 0xd4, 0x58, 0x45, 0x4b, 0x9c, 0x42, 0x68, 0xd0, 0x01, 0x9a,
+    0x94, 0x42, 0x00, 0xd1, 0x7d, 0xe0, 0x43, 0x4b, 0xe3, 0x1a, 0x2f, 0x2b,
+    0x60, 0xd8, 0x4c, 0x11, 0x51, 0x8a, 0xff, 0x00, 0x21, 0x03, 0x2a, 0x3b,
+    0x20, 0xa1, 0xff, 0x36, 0x00, 0x91, 0xfe, 0xf7, 0x28, 0xfe, 0x06, 0x1e,
+    0x03, 0xd0, 0x87, 0x76, 0x00, 0xf1, 0x9a, 0xc1, 0xf8, 0x01, 0x23, 0x22,
+    0x00, 0x9a, 0x43, 0x13, 0x00, 0x00, 0x22, 0x35, 0x4f, 0x98, 0x68, 0x06,
+    0x21, 0x84, 0x46, 0x01, 0x98, 0x59, 0x56, 0x84, 0x45, 0x14, 0xd1, 0x00,
+    0x29, 0x19, 0xda, 0x00, 0x2e, 0x49, 0xd1, 0x00, 0x2a, 0x45, 0xd0, 0xff,
+    0x21, 0x91, 0x71, 0x2e, 0x49, 0x91, 0x80, 0x2e, 0x49, 0x2c, 0x48, 0x0a,
+    0x78, 0x9a, 0x71, 0x2d, 0x4a, 0x1b, 0x1a, 0x5b, 0x41, 0x5a, 0x43, 0x12,
+    0x0d, 0x0a, 0x70, 0x28, 0xe0, 0x00, 0x29, 0x26, 0xdb, 0x0c, 0x22, 0x51,
+    0x43, 0x1a, 0x00, 0x7b, 0x18, 0xdc, 0xe7, 0x0c, 0x20, 0x48, 0x43, 0x22,
+    0x4a, 0x16, 0x18, 0xb7, 0x68, 0x9f, 0x60, 0xf7, 0x79, 0xdf, 0x71, 0x06,
+    0x27, 0xf7, 0x57, 0x9f, 0x71, 0xb7, 0x79, 0x7f, 0x2f, 0x1e, 0xd8, 0xb6,
+    0x88, 0xd2, 0x1a, 0x76, 0x05, 0x36, 0x15, 0x80, 0x19, 0x12, 0x18, 0xe0,
+    0x20, 0x12, 0x05, 0x52, 0x0d, 0x00, 0x02, 0x02, 0x43, 0x9a, 0x80, 0x0c,
+    0x22, 0x4a, 0x43, 0x15, 0x4b, 0x9b, 0x18, 0x16, 0x4a, 0x10, 0x78, 0x11,
+    0x70, 0x98, 0x71, 0x28, 0x00, 0x03, 0x99, 0xff, 0xf7, 0x48, 0xff, 0x21,
+    0x00, 0x28, 0x00, 0x02, 0x9a, 0xff, 0xf7, 0x13, 0xc6, 0x2f, 0xf0, 0x1b,
+    0xbd, 0x22, 0x12, 0x02, 0xe8, 0xe7, 0x0a, 0x4c, 0xbb, 0xe7, 0x0e, 0x4a,
+    0x0f, 0x49, 0xd2, 0x1a, 0x08, 0x3a, 0x50, 0x02, 0x40, 0x0d, 0x01, 0x43,
+    0x99, 0x80, 0x0c, 0x49, 0x52, 0x08, 0x0a, 0x43, 0xda, 0x80, 0xe2, 0xe7,
+    0x1c, 0x00, 0xe4, 0xe7, 0xc0, 0x46, 0x40, 0x01, 0x00, 0x80, 0x01, 0x00,
+    0x44, 0x01, 0xf0, 0x02, 0xd8, 0x04, 0x00, 0x20, 0x00, 0xbd, 0xff, 0xff,
+    0x28, 0x1c, 0x00, 0x20, 0xaa, 0xaa, 0x00, 0x00, 0x12, 0x79, 0x38, 0xf0,
+    0x0e, 0xf0, 0xff, 0xff, 0x00, 0xf8, 0xff, 0xff, 0x01, 0x23, 0xf7, 0xb5,
+    0x03, 0x43, 0x04, 0x00, 0x01, 0x93, 0xfe, 0xf7, 0x9c, 0xfd, 0xef, 0xf3,
+    0x10, 0x87, 0x72, 0xb6, 0x1d, 0x4b, 0xa8, 0x06, 0x11, 0xfb, 0x64, 0x01,
+    0xf1, 0x2b, 0x1b, 0x49, 0x22, 0x00, 0x1b, 0x4b, 0x52, 0x1a, 0x52, 0x41,
+    0x53, 0x43, 0x1b, 0x0d, 0x5b, 0xb2, 0x9c, 0x46, 0x19, 0x4b, 0x9a, 0x68,
+    0x83, 0x00, 0xd2, 0x58, 0x08, 0x00, 0x15, 0x00, 0x2e, 0x00, 0x01, 0x9d,
+    0x00, 0x22, 0xae, 0x42, 0x14, 0xd1, 0x13, 0x4a, 0x14, 0x49, 0x92, 0x68,
+    0xd1, 0x50, 0x13, 0x4b, 0x1a, 0x78, 0xa2, 0x71, 0x62, 0x46, 0x1a, 0x70,
+    0x7c, 0x02, 0xf3, 0x1b, 0x23, 0x0a, 0x4a, 0x13, 0x60, 0x87, 0xf3, 0x10,
+    0x88, 0xf7, 0xbd, 0x01, 0x32, 0x0c, 0x30, 0x04, 0x2a, 0xee, 0xd0, 0x06,
+    0x23, 0xc3, 0x56, 0x63, 0x45, 0xf7, 0xd1, 0x0c, 0x23, 0x5a, 0x43, 0xf3,
+    0x33, 0x89, 0x18, 0x8b, 0x71, 0x07, 0x4b, 0x8b, 0x80, 0xe2, 0xb4, 0x00,
+    0x00, 0xac, 0x00, 0x00, 0xa4, 0x00, 0x04, 0xbc, 0x00, 0x00, 0xb4, 0x00,
+    0x00, 0xbc, 0x00, 0x0f, 0x3c, 0x38, 0x11, 0x31, 0xd0, 0x23, 0x07, 0xa4,
+    0x0c, 0xf0, 0x03, 0x01, 0x00, 0x06, 0x48, 0x00, 0x22, 0xc0, 0x18, 0x05,
+    0x4b, 0x00, 0x93, 0x05, 0x23, 0x03, 0xf0, 0xd3, 0xfc, 0xe4, 0x3d, 0xc0,
+    0x1f, 0x23, 0x18, 0x1a, 0x0e, 0xbd, 0x32, 0x1c, 0x00, 0x20, 0xd7, 0xff,
+    0xa4, 0x0a, 0xf0, 0x0f, 0x08, 0x4d, 0x01, 0x22, 0x6c, 0x6a, 0x00, 0x23,
+    0xa1, 0x42, 0x06, 0xd8, 0xad, 0x6a, 0x13, 0x00, 0x85, 0x42, 0x02, 0xd2,
+    0x0b, 0x1b, 0x59, 0x1e, 0x8b, 0x41, 0x13, 0x40, 0x18, 0x00, 0x7c, 0x13,
+    0x60, 0x00, 0x40, 0x05, 0x40, 0x83, 0x68, 0xee, 0x51, 0xf0, 0x0d, 0x09,
+    0x18, 0x12, 0x18, 0x12, 0x01, 0x09, 0x01, 0x59, 0x18, 0x9b, 0x18, 0x5c,
+    0x68, 0x4a, 0x68, 0x01, 0x20, 0x94, 0x42, 0x05, 0xd8, 0x03, 0xd1, 0x1a,
+    0x68, 0x0b, 0x68, 0x9c, 0x47, 0xb1, 0x00, 0x20, 0xc0, 0xb2, 0x10, 0xbd,
+    0xff, 0xff, 0xff, 0x0f, 0x70, 0x94, 0x4d, 0x10, 0x08, 0x36, 0x15, 0x10,
+    0xfa, 0xc2, 0x34, 0xf0, 0x15, 0xc5, 0xfb, 0x20, 0x00, 0x06, 0x49, 0x00,
+    0xf0, 0x19, 0xfb, 0xff, 0xf7, 0x17, 0xfe, 0x05, 0x4b, 0x2c, 0x75, 0xc0,
+    0x18, 0x04, 0x4b, 0x80, 0x00, 0xa4, 0x00, 0x68, 0x60, 0xe5, 0x50, 0x70,
+    0xbd, 0xc9, 0x58, 0x00, 0x10, 0xb4, 0x38, 0xf0, 0x00, 0x6c, 0x18, 0x00,
+    0x20, 0x0a, 0x4b, 0x18, 0x68, 0xef, 0xf3, 0x10, 0x82, 0x72, 0xb6, 0x01,
+    0x16, 0x38, 0x02, 0x80, 0x01, 0x12, 0x68, 0xc4, 0x03, 0x02, 0xc2, 0x03,
+    0x20, 0x40, 0xbf, 0x34, 0x0f, 0x00, 0x6c, 0x03, 0xf1, 0x16, 0x80, 0x1a,
+    0x00, 0x20, 0x03, 0x23, 0x30, 0xb5, 0x1c, 0x00, 0x53, 0x43, 0x4c, 0x43,
+    0x03, 0x3b, 0xc3, 0x18, 0x03, 0x3c, 0x99, 0x70, 0x01, 0x5d, 0x05, 0x19,
+    0x00, 0x29, 0x01, 0xd1, 0x2a, 0x70, 0x30, 0xbd, 0x59, 0x70, 0xfb, 0x3c,
+    0x3e, 0xf0, 0x1d, 0x85, 0xb0, 0x02, 0x93, 0x0c, 0xab, 0x1c, 0x78, 0x0d,
+    0xab, 0x1b, 0x78, 0x07, 0x00, 0x05, 0x68, 0x01, 0x92, 0x03, 0x93, 0x00,
+    0x2c, 0x10, 0xd1, 0xac, 0x7b, 0x00, 0x2c, 0x47, 0xd0, 0x03, 0x23, 0x63,
+    0x43, 0x2a, 0x68, 0x03, 0x3b, 0xd3, 0x18, 0x5a, 0x78, 0xaa, 0x73, 0x12,
+    0x08, 0xf6, 0x15, 0xea, 0x73, 0x00, 0x22, 0x9a, 0x70, 0x5a, 0x70, 0x1a,
+    0x70, 0x21, 0x4b, 0xba, 0x68, 0xe3, 0x18, 0x1b, 0x01, 0xd3, 0x18, 0x01,
+    0x9a, 0x1a, 0x60, 0x02, 0x9a, 0x5a, 0x60, 0x0a, 0x9a, 0x9a, 0x60, 0x0b,
+    0x9a, 0xda, 0x60, 0x36, 0x00, 0x04, 0x2c, 0x00, 0xe0, 0x6e, 0x7b, 0x96,
+    0x42, 0x28, 0xd0, 0x22, 0x00, 0x31, 0x00, 0xa8, 0x68, 0x6b, 0x68, 0x56,
+    0x3f, 0x11, 0x1c, 0x0e, 0x00, 0xf0, 0x07, 0x28, 0x68, 0xff, 0xf7, 0xab,
+    0xff, 0x6e, 0x73, 0xa6, 0x42, 0x11, 0xd1, 0x38, 0x7d, 0x01, 0x9a, 0x02,
+    0x9b, 0x00, 0xf0, 0xdd, 0xfa, 0x64, 0x4b, 0x20, 0x03, 0x9b, 0x5a, 0x14,
+    0x90, 0x21, 0x00, 0x38, 0x68, 0x00, 0xf0, 0xf2, 0xfb, 0x0e, 0xda, 0x4a,
+    0x30, 0xd0, 0x1d, 0x70, 0xf8, 0x14, 0x51, 0xf0, 0xbd, 0x32, 0x00, 0x21,
+    0x3a, 0x00, 0x50, 0x8e, 0xff, 0x26, 0x00, 0xe0, 0x2c, 0x44, 0xf0, 0x0b,
+    0x0f, 0x00, 0x23, 0xf0, 0xb5, 0x8f, 0xb0, 0x0b, 0x93, 0x5d, 0x4b, 0x82,
+    0x00, 0xd4, 0x58, 0x0c, 0x90, 0x00, 0xf0, 0x58, 0xfa, 0x02, 0x00, 0x0b,
+    0x00, 0x60, 0x32, 0x01, 0x38, 0x81, 0x08, 0x91, 0x34, 0x01, 0xf0, 0x25,
+    0x21, 0x68, 0x8c, 0x46, 0x49, 0x7b, 0x07, 0x91, 0x00, 0x29, 0x74, 0xd0,
+    0x52, 0x48, 0x0d, 0x18, 0xa1, 0x68, 0x2d, 0x01, 0x4d, 0x19, 0x2e, 0x68,
+    0x6f, 0x68, 0x30, 0x00, 0x39, 0x00, 0x80, 0x1a, 0x99, 0x41, 0x00, 0x29,
+    0x5d, 0xdc, 0x01, 0xd1, 0x00, 0x28, 0x5a, 0xd1, 0x00, 0x21, 0x60, 0x46,
+    0x00, 0xf0, 0xa8, 0xfb, 0x1e, 0x00, 0xf2, 0x0c, 0xab, 0x68, 0x07, 0x9a,
+    0x0a, 0x93, 0xe3, 0x68, 0xed, 0x68, 0x9b, 0x18, 0x01, 0x3b, 0x1b, 0x78,
+    0x0b, 0x93, 0x1b, 0x02, 0x03, 0x43, 0x00, 0x20, 0x23, 0x61, 0x63, 0x86,
+    0x01, 0x41, 0x22, 0x1a, 0x60, 0x08, 0x62, 0x54, 0xf0, 0x0a, 0x0a, 0x9b,
+    0x93, 0x42, 0x6f, 0xd0, 0x0b, 0x9b, 0x29, 0x00, 0x18, 0x02, 0x07, 0x9b,
+    0x18, 0x43, 0x0a, 0x9b, 0x98, 0x47, 0x08, 0x90, 0x09, 0x91, 0x62, 0x8e,
+    0x00, 0x56, 0x83, 0x0d, 0x93, 0x72, 0xb6, 0xa6, 0x04, 0xf0, 0x13, 0x09,
+    0x9b, 0x00, 0x2b, 0x36, 0xda, 0x23, 0x69, 0x00, 0x2b, 0x43, 0xd0, 0x08,
+    0x98, 0x09, 0x99, 0x32, 0x00, 0x3b, 0x00, 0x12, 0x1a, 0x8b, 0x41, 0x9f,
+    0x42, 0x02, 0xd8, 0x04, 0xd1, 0x96, 0x42, 0x02, 0xd9, 0x14, 0x43, 0x10,
+    0x13, 0x0a, 0x06, 0xd0, 0x91, 0x01, 0x31, 0x03, 0x91, 0x07, 0x99, 0x20,
+    0x00, 0x02, 0x91, 0x0a, 0x99, 0x3e, 0x06, 0x02, 0xce, 0x3e, 0x40, 0x63,
+    0x68, 0x22, 0x61, 0x4a, 0x00, 0x31, 0x1a, 0x60, 0x0d, 0x7e, 0x00, 0x40,
+    0x80, 0xe7, 0x00, 0x25, 0x46, 0x00, 0xf0, 0x01, 0x0c, 0x98, 0x00, 0xf0,
+    0x37, 0xfa, 0x00, 0x26, 0x00, 0x27, 0x0a, 0x95, 0xad, 0xe7, 0x07, 0x9d,
+    0x0a, 0x00, 0xe0, 0x28, 0x00, 0x0a, 0x95, 0xa7, 0xe7, 0x08, 0x9b, 0x09,
+    0x9a, 0x13, 0x43, 0x0b, 0xd0, 0x76, 0x00, 0xd1, 0x08, 0xd0, 0x00, 0xf0,
+    0xc2, 0xf9, 0x08, 0x9a, 0x09, 0x9b, 0x06, 0x00, 0x0f, 0xa4, 0x06, 0x60,
+    0xc1, 0xe7, 0x22, 0x68, 0xd1, 0x7b, 0x16, 0x3a, 0xf0, 0x0f, 0x03, 0x23,
+    0x4b, 0x43, 0x11, 0x68, 0xcb, 0x18, 0x07, 0x99, 0x03, 0x3b, 0x59, 0x70,
+    0x07, 0x9b, 0xd3, 0x73, 0xe1, 0x68, 0x01, 0x3b, 0xca, 0x5c, 0x01, 0x32,
+    0xca, 0x54, 0xc2, 0xe7, 0x2e, 0x3e, 0x31, 0x4a, 0xe7, 0x0f, 0xb4, 0x34,
+    0x00, 0xa0, 0x02, 0x00, 0x88, 0x01, 0x60, 0x10, 0xb5, 0x09, 0x4c, 0x63,
+    0x68, 0x74, 0x18, 0xd1, 0x10, 0x21, 0x20, 0x68, 0x23, 0x00, 0x06, 0x4a,
+    0x00, 0xf0, 0xb9, 0xfa, 0x03, 0x80, 0x3c, 0xf0, 0x05, 0x81, 0xfe, 0x0a,
+    0x21, 0x03, 0x48, 0x03, 0xf0, 0x37, 0xfc, 0x10, 0xbd, 0x20, 0x05, 0x00,
+    0x20, 0x41, 0x57, 0x00, 0x10, 0xa8, 0x02, 0x40, 0x00, 0x48, 0x70, 0x47,
+    0x10, 0x00, 0xf0, 0x05, 0xf0, 0xb5, 0x8d, 0xb0, 0x07, 0x93, 0x14, 0xab,
+    0x1b, 0x78, 0x00, 0x27, 0x09, 0x93, 0x1f, 0x23, 0x06, 0x00, 0x06, 0x92,
+    0x72, 0x40, 0x30, 0x1f, 0x70, 0x72, 0x38, 0x01, 0x18, 0x85, 0x36, 0x01,
+    0xa0, 0x1f, 0x24, 0x04, 0xab, 0xe4, 0x18, 0x13, 0x9b, 0x30, 0x00, 0xba,
+    0x49, 0xf0, 0x01, 0x04, 0x94, 0x00, 0x93, 0x03, 0x97, 0x06, 0x9a, 0x07,
+    0x9b, 0x02, 0x97, 0xff, 0xf7, 0x95, 0xfe, 0xbc, 0x4e, 0x51, 0x82, 0x42,
+    0x03, 0xd0, 0xf3, 0xaa, 0x01, 0x31, 0x18, 0x78, 0x71, 0xa0, 0x01, 0x30,
+    0x0f, 0x60, 0x85, 0x76, 0x55, 0xd0, 0x2a, 0x28, 0xd0, 0x21, 0x78, 0x00,
+    0x29, 0x28, 0xd1, 0x00, 0x02, 0x10, 0x43, 0x28, 0x4a, 0x60, 0x04, 0x00,
+    0x0d, 0x1e, 0x12, 0xda, 0x3e, 0x00, 0xf0, 0x04, 0x12, 0x1b, 0xab, 0x41,
+    0x1d, 0x00, 0x07, 0x9b, 0x14, 0x00, 0xab, 0x42, 0x03, 0xd8, 0x05, 0xd1,
+    0x06, 0x9b, 0xa3, 0x80, 0x01, 0xf0, 0x00, 0x24, 0x64, 0x42, 0x25, 0x00,
+    0x06, 0x94, 0x07, 0x95, 0xba, 0xe7, 0x00, 0xf0, 0x2c, 0xf9, 0x58, 0x02,
+    0xf0, 0x07, 0xa4, 0x18, 0x5d, 0x41, 0xa9, 0x42, 0xf1, 0xd8, 0xf3, 0xd1,
+    0xa0, 0x42, 0xf1, 0xd9, 0xed, 0xe7, 0x01, 0x20, 0x40, 0x42, 0xd8, 0xe7,
+    0xcc, 0x01, 0xa0, 0x06, 0xd0, 0x12, 0x9b, 0x00, 0x20, 0x13, 0x99, 0x98,
+    0x47, 0xfe, 0x37, 0xd3, 0xd0, 0xd1, 0x00, 0x20, 0xcc, 0xe7, 0xf8, 0xb5,
+    0x0b, 0x00, 0x04, 0x00, 0x41, 0xc6, 0x00, 0x10, 0x0a, 0xc8, 0x3a, 0x01,
+    0xc6, 0x00, 0xf0, 0x1b, 0x27, 0x68, 0xd9, 0xb2, 0x78, 0x7b, 0xda, 0xb2,
+    0x88, 0x42, 0x07, 0xd0, 0x03, 0x26, 0x56, 0x43, 0x38, 0x68, 0x86, 0x19,
+    0x03, 0x3e, 0xb0, 0x78, 0x00, 0x28, 0x13, 0xd0, 0xe0, 0x68, 0x1b, 0x0a,
+    0x82, 0x18, 0x01, 0x3a, 0x12, 0x78, 0xdb, 0xb2, 0x00, 0x20, 0xba, 0x46,
+    0x00, 0x6c, 0x3c, 0x26, 0x6d, 0xfa, 0x6c, 0x02, 0x00, 0xce, 0x00, 0xe0,
+    0xf8, 0xbd, 0x22, 0x69, 0x9a, 0x42, 0xf4, 0xd1, 0x20, 0x61, 0xf2, 0xe7,
+    0xf0, 0xb5, 0xc2, 0x01, 0xf1, 0x12, 0x06, 0x24, 0x64, 0x42, 0xe5, 0x17,
+    0xa4, 0x19, 0x7d, 0x41, 0x85, 0xb0, 0x8d, 0x42, 0x02, 0xd8, 0x03, 0xd1,
+    0x84, 0x42, 0x01, 0xd9, 0x00, 0x24, 0x00, 0x25, 0x00, 0xf0, 0xce, 0xf8,
+    0x22, 0x00, 0x2b, 0x5e, 0x02, 0x30, 0x00, 0x2b, 0x08, 0xe2, 0x02, 0x30,
+    0x2a, 0x05, 0xd1, 0xf4, 0x02, 0x40, 0x00, 0xf0, 0xcb, 0xf8, 0x58, 0x03,
+    0xff, 0x16, 0x00, 0x23, 0x02, 0x93, 0x01, 0x93, 0x10, 0x4b, 0x22, 0x00,
+    0x00, 0x93, 0x10, 0x48, 0x2b, 0x00, 0xff, 0xf7, 0x35, 0xff, 0x00, 0x28,
+    0xed, 0xdb, 0x20, 0x00, 0x29, 0x00, 0xff, 0xf7, 0x75, 0xfd, 0x00, 0x28,
+    0xe7, 0xd1, 0x0b, 0x86, 0x04, 0x0e, 0x80, 0x20, 0xbf, 0xe6, 0xe7, 0xad,
+    0x57, 0x00, 0x10, 0xd4, 0x01, 0x00, 0xe0, 0x01, 0x02, 0xe4, 0x07, 0x40,
+    0x00, 0xf0, 0x8f, 0xf8, 0x3a, 0x01, 0x00, 0x4c, 0x00, 0x51, 0x80, 0x18,
+    0x59, 0x41, 0x8b, 0xe0, 0x02, 0x10, 0x82, 0x60, 0x01, 0xf0, 0x00, 0x20,
+    0x40, 0x42, 0xc1, 0x17, 0xff, 0xf7, 0x9f, 0xff, 0x70, 0xbd, 0xfa, 0x22,
+    0x10, 0xb5, 0x2c, 0x09, 0x20, 0x00, 0x21, 0xd8, 0x52, 0x40, 0xff, 0xf7,
+    0xe1, 0xff, 0x80, 0x19, 0x40, 0x00, 0x23, 0x0c, 0x4e, 0x9a, 0x00, 0x20,
+    0x0c, 0x4b, 0x20, 0x56, 0x70, 0x05, 0x00, 0x0b, 0x00, 0x30, 0x00, 0x0c,
+    0x0a, 0x47, 0xd0, 0xfe, 0x01, 0x1e, 0x05, 0xdc, 0x28, 0x00, 0x21, 0x00,
+    0xff, 0xf7, 0x26, 0xfd, 0x30, 0x13, 0x20, 0x20, 0xbf, 0xbe, 0x13, 0x60,
+    0x47, 0xff, 0xf4, 0xe7, 0xc0, 0x46, 0x80, 0x00, 0x00, 0x88, 0x00, 0xf2,
+    0x01, 0xf7, 0xb5, 0xef, 0xf3, 0x05, 0x82, 0x3f, 0x23, 0x1a, 0x40, 0x10,
+    0x00, 0x01, 0x92, 0x10, 0x38, 0xc6, 0x06, 0x17, 0x18, 0xc6, 0x06, 0xf3,
+    0x22, 0x01, 0x26, 0x34, 0x00, 0x84, 0x40, 0x14, 0x4d, 0x15, 0x4b, 0x6c,
+    0x63, 0x1b, 0x78, 0x1a, 0x00, 0xc2, 0x40, 0x94, 0x46, 0x61, 0x46, 0x00,
+    0x22, 0x31, 0x42, 0x0a, 0xd0, 0x11, 0x4e, 0x69, 0x6a, 0x85, 0x00, 0xae,
+    0x59, 0xb1, 0x42, 0x0f, 0xd3, 0x0f, 0x4a, 0x0c, 0x49, 0xa3, 0x43, 0xaa,
+    0x58, 0x0b, 0xbe, 0x06, 0x31, 0x07, 0x49, 0x0b, 0xbe, 0x06, 0x00, 0xa0,
+    0x4f, 0xf0, 0x04, 0x90, 0x47, 0xf7, 0xbd, 0x01, 0x9b, 0x07, 0x49, 0x9b,
+    0x00, 0x5b, 0x18, 0x1c, 0x68, 0x1c, 0x60, 0xed, 0xe7, 0x28, 0x64, 0x07,
+    0xf0, 0x04, 0x40, 0x05, 0x40, 0x31, 0x1c, 0x00, 0x20, 0x84, 0x1a, 0x00,
+    0x20, 0x24, 0x13, 0x00, 0x20, 0xd0, 0x3f, 0x05, 0x40, 0x1a, 0x3f, 0x20,
+    0x02, 0x4a, 0x0a, 0x03, 0x20, 0x79, 0xf9, 0x50, 0x11, 0xf1, 0x04, 0xf2,
+    0xff, 0x00, 0x10, 0xe6, 0x1b, 0x00, 0x20, 0x03, 0x4b, 0x59, 0x6a, 0x0a,
+    0x00, 0x98, 0x6a, 0x59, 0x6a, 0x8a, 0xea, 0x09, 0x00, 0x3c, 0x00, 0xf0,
+    0x09, 0x05, 0x4b, 0x5a, 0x6a, 0x8a, 0x42, 0xfc, 0xd3, 0x8a, 0x42, 0x02,
+    0xd1, 0x9a, 0x6a, 0x82, 0x42, 0x00, 0xd3, 0x70, 0x47, 0x5a, 0x6a, 0xf7,
+    0xe7, 0x1c, 0x00, 0x14, 0xf7, 0x3c, 0x09, 0x85, 0x83, 0x00, 0x93, 0x72,
+    0xb6, 0x1c, 0x4f, 0x3b, 0x1e, 0x03, 0x91, 0xa3, 0x00, 0x19, 0x4e, 0x01,
+    0x93, 0x00, 0x2d, 0x1b, 0xd8, 0x13, 0x60, 0x45, 0xfb, 0x86, 0x42, 0x0b,
+    0xd0, 0xa6, 0x1a, 0x52, 0xff, 0xf7, 0x47, 0xfb, 0x01, 0xfa, 0x42, 0xe1,
+    0xfb, 0x01, 0x23, 0xa3, 0x40, 0x11, 0x4a, 0x13, 0x60, 0x11, 0x4b, 0x01,
+    0x9a, 0x9d, 0x0e, 0x0a, 0x51, 0x00, 0x23, 0x3b, 0x60, 0x00, 0x42, 0x04,
+    0xf1, 0x08, 0xf7, 0xbd, 0x0b, 0x4b, 0xa2, 0x00, 0x9d, 0x50, 0x01, 0x22,
+    0xa2, 0x40, 0x0a, 0x49, 0x20, 0x00, 0x0b, 0x78, 0x93, 0x43, 0x0b, 0x70,
+    0x31, 0x40, 0x00, 0x02, 0x84, 0x09, 0x31, 0x0b, 0xfb, 0xe5, 0xe0, 0x00,
+    0x80, 0xe5, 0x5c, 0x00, 0x10, 0x38, 0x60, 0x05, 0x40, 0xdc, 0x00, 0x00,
+    0xe8, 0x00, 0x00, 0x50, 0x06, 0x60, 0x1e, 0x00, 0x04, 0x00, 0x01, 0x92,
+    0x40, 0x15, 0xc4, 0x8e, 0x42, 0x03, 0xd8, 0x47, 0xd1, 0x01, 0x9b, 0x83,
+    0x42, 0x44, 0xd9, 0x16, 0x14, 0x18, 0x21, 0x78, 0x01, 0xf2, 0x20, 0x25,
+    0xa5, 0x40, 0x1e, 0x4b, 0x1e, 0x4f, 0x1b, 0x78, 0x00, 0x93, 0x2b, 0x43,
+    0xdb, 0xb2, 0x02, 0x93, 0x02, 0x9a, 0x1a, 0x4b, 0x1a, 0x70, 0x01, 0x9a,
+    0x23, 0x1d, 0x9b, 0x00, 0x7d, 0x63, 0xda, 0x51, 0x18, 0x4a, 0xa3, 0x00,
+    0x9e, 0x50, 0x3b, 0x6a, 0x2b, 0x42, 0x0a, 0xd1, 0x00, 0x20, 0xa6, 0x00,
+    0x51, 0x10, 0x4a, 0x13, 0x60, 0x03, 0xa8, 0x00, 0x00, 0xb4, 0x02, 0x00,
+    0xa0, 0x55, 0x51, 0x8e, 0x42, 0xf0, 0xd8, 0x02, 0x68, 0x00, 0xf1, 0x18,
+    0xec, 0xd8, 0x02, 0x9b, 0x00, 0x9a, 0x01, 0x20, 0x93, 0x42, 0xe8, 0xd0,
+    0x1f, 0x23, 0x02, 0x00, 0x1c, 0x40, 0xa2, 0x40, 0x08, 0x4b, 0x3d, 0x62,
+    0x7d, 0x63, 0x1a, 0x60, 0x03, 0x4b, 0x00, 0x9a, 0x1a, 0x70, 0xdc, 0xe7,
+    0x01, 0x20, 0xe2, 0xbc, 0x00, 0x00, 0xb0, 0x00, 0x00, 0x48, 0x01, 0x00,
+    0x9c, 0x01, 0x00, 0xc4, 0x0a, 0x22, 0x10, 0xb5, 0xaa, 0x59, 0x35, 0x0a,
+    0x49, 0x0b, 0x4a, 0x01, 0x00, 0xc0, 0x0a, 0xb3, 0x07, 0x4a, 0x08, 0x48,
+    0x13, 0x62, 0x02, 0x78, 0x9a, 0x43, 0x02, 0xf8, 0x01, 0x20, 0x0b, 0x60,
+    0xc0, 0x59, 0x00, 0xbc, 0x01, 0x08, 0xe4, 0x01, 0x0f, 0x70, 0x07, 0x0f,
+    0xc0, 0x70, 0xb5, 0x06, 0x00, 0x0c, 0x00, 0x15, 0x00, 0x00, 0x29, 0x12,
+    0xd0, 0x9a, 0x12, 0x31, 0x80, 0x68, 0x73, 0x0c, 0x07, 0x80, 0x06, 0xd0,
+    0x2a, 0x00, 0x21, 0x00, 0x30, 0x68, 0x1a, 0x46, 0x00, 0xe8, 0x57, 0x31,
+    0x22, 0x00, 0x29, 0x0e, 0x00, 0xf2, 0x37, 0xd6, 0xff, 0x2c, 0x00, 0xf6,
+    0xe7, 0x01, 0x22, 0x00, 0x23, 0x30, 0xb5, 0x04, 0x7b, 0x82, 0x73, 0x43,
+    0x73, 0x02, 0x68, 0xc4, 0x73, 0x03, 0x20, 0x01, 0x33, 0xdd, 0xb2, 0xac,
+    0x42, 0x05, 0xd8, 0x00, 0x23, 0x60, 0x43, 0x12, 0x18, 0x03, 0x3a, 0x53,
+    0x70, 0x30, 0xbd, 0x01, 0x00, 0x59, 0x43, 0x51, 0x18, 0x03, 0x39, 0x01,
+    0x35, 0x4d, 0x70, 0xee, 0xe7, 0x10, 0xb5, 0x01, 0x73, 0x42, 0x60, 0x83,
+    0x60, 0xff, 0xf7, 0xe0, 0xff, 0x7e, 0x41, 0xf0, 0x15, 0x00, 0x29, 0x1d,
+    0xd0, 0x05, 0x68, 0x03, 0x20, 0x03, 0x00, 0x4b, 0x43, 0x03, 0x3b, 0xeb,
+    0x18, 0x5a, 0x78, 0x00, 0x2a, 0x14, 0xd0, 0x00, 0x26, 0x50, 0x43, 0x03,
+    0x38, 0x28, 0x18, 0x45, 0x78, 0x46, 0x70, 0x5e, 0x70, 0xda, 0x01, 0x51,
+    0xad, 0xff, 0x29, 0x00, 0x06, 0xe4, 0x01, 0x51, 0xe4, 0xff, 0x31, 0x00,
+    0x02, 0x0a, 0x00, 0x10, 0xa3, 0xe6, 0x3f, 0xf2, 0x04, 0x00, 0x70, 0xbd,
+    0xf7, 0xb5, 0x03, 0x27, 0x3e, 0x00, 0x4e, 0x43, 0x03, 0x68, 0x03, 0x3e,
+    0x0d, 0x00, 0x99, 0x5d, 0xe8, 0x01, 0x20, 0xd0, 0xff, 0x7e, 0x18, 0xf0,
+    0x27, 0x08, 0xd0, 0xe3, 0x7b, 0x00, 0x2b, 0x04, 0xd0, 0x5f, 0x43, 0x23,
+    0x68, 0xdf, 0x19, 0x03, 0x3f, 0x7d, 0x70, 0xe5, 0x73, 0x22, 0x68, 0x00,
+    0x28, 0x05, 0xd0, 0x03, 0x23, 0x00, 0x21, 0x43, 0x43, 0xd3, 0x18, 0x03,
+    0x3b, 0x99, 0x70, 0x00, 0x23, 0x92, 0x19, 0x53, 0x70, 0xfe, 0xbd, 0x70,
+    0xb5, 0x45, 0x7b, 0x0a, 0x00, 0x29, 0x00, 0x6e, 0x41, 0x62, 0xd4, 0xff,
+    0x60, 0x73, 0x28, 0x00, 0xe0, 0x42, 0xa2, 0x08, 0x1e, 0x07, 0xd0, 0x63,
+    0x7b, 0x8b, 0x42, 0x05, 0xd1, 0xa8, 0x02, 0xe0, 0xeb, 0xff, 0x01, 0x20,
+    0x70, 0xbd, 0x03, 0x26, 0x33, 0x00, 0x4b, 0x43, 0x25, 0x68, 0xb8, 0x00,
+    0xf0, 0x07, 0x9a, 0x78, 0x10, 0x1e, 0xf5, 0xd0, 0x72, 0x43, 0x03, 0x3a,
+    0xa8, 0x18, 0xaa, 0x5c, 0x8a, 0x42, 0x11, 0xd1, 0x5a, 0x78, 0x02, 0x70,
+    0xc8, 0x57, 0x00, 0x6a, 0x08, 0x20, 0x01, 0x32, 0x1e, 0x1d, 0x22, 0x61,
+    0x7b, 0xb8, 0x00, 0x93, 0x47, 0xff, 0x60, 0x73, 0xde, 0xe7, 0x00, 0x2a,
+    0xef, 0x30, 0x00, 0xf3, 0x1e, 0x42, 0x78, 0x8a, 0x42, 0xf7, 0xd1, 0x5a,
+    0x78, 0x42, 0x70, 0xe6, 0xe7, 0x70, 0xb5, 0x16, 0x00, 0x0d, 0x00, 0x19,
+    0x00, 0x04, 0x00, 0x03, 0xf0, 0xee, 0xf8, 0x29, 0x00, 0x70, 0x1c, 0x03,
+    0xf0, 0x7b, 0xfc, 0x00, 0x23, 0xe6, 0x81, 0xa5, 0x81, 0x60, 0x60, 0xa3,
+    0x60, 0x70, 0x0c, 0x42, 0x20, 0x4c, 0xf9, 0x2f, 0x39, 0x4c, 0x03, 0xf0,
+    0xdc, 0xf8, 0x26, 0x42, 0x13, 0x3f, 0x1a, 0x00, 0x26, 0xcf, 0xf8, 0x26,
+    0x42, 0x0c, 0xe0, 0x0c, 0x00, 0x34, 0x42, 0x10, 0x0e, 0xa4, 0x03, 0xf1,
+    0x17, 0x87, 0x72, 0xb6, 0xff, 0xf7, 0xf0, 0xff, 0x05, 0x00, 0xb0, 0x42,
+    0x07, 0xd0, 0x09, 0x4b, 0x98, 0x42, 0x02, 0xd3, 0x08, 0x4b, 0x98, 0x42,
+    0x01, 0xd3, 0x00, 0xf0, 0x8f, 0xfa, 0x07, 0x4b, 0x10, 0x34, 0x9b, 0x68,
+    0xa4, 0x00, 0xe6, 0x88, 0x03, 0x00, 0x52, 0x04, 0x90, 0x28, 0x00, 0xf8,
+    0xbd, 0xc0, 0x40, 0x00, 0x10, 0xcc, 0xe4, 0x20, 0x3f, 0xed, 0x00, 0xe0,
+    0x60, 0x43, 0x0d, 0xe0, 0xf8, 0xb5, 0x0e, 0x00, 0x04, 0x00, 0x00, 0x27,
+    0x01, 0x25, 0xb7, 0x42, 0x01, 0xd1, 0x3e, 0x00, 0x0a, 0x60, 0x43, 0xf0,
+    0x20, 0x05, 0x40, 0x01, 0x37, 0xf1, 0xe7, 0x00, 0x00, 0x0f, 0x4b, 0x10,
+    0xb5, 0xc0, 0x18, 0x43, 0x42, 0x58, 0x41, 0x83, 0x00, 0x0d, 0x48, 0x1c,
+    0x58, 0x01, 0x23, 0x20, 0x20, 0x8b, 0x40, 0x40, 0x1a, 0x01, 0x3b, 0x00,
+    0x2a, 0x0d, 0xdb, 0x82, 0x42, 0x03, 0xdc, 0x93, 0x40, 0x10, 0x00, 0x1c,
+    0xfc, 0x0c, 0xf0, 0x06, 0x20, 0x40, 0x42, 0x10, 0xbd, 0x1a, 0x00, 0x82,
+    0x40, 0x14, 0x42, 0xfa, 0xd0, 0x01, 0x38, 0x00, 0x28, 0xf8, 0xda, 0xf4,
+    0xe7, 0xf4, 0x19, 0xf0, 0x15, 0x1c, 0x13, 0x00, 0x20, 0x05, 0x23, 0xf7,
+    0xb5, 0xcb, 0x56, 0x00, 0x2b, 0x01, 0xdb, 0x9a, 0x42, 0x12, 0xd1, 0x0b,
+    0x79, 0x9c, 0x46, 0x18, 0x4b, 0x65, 0x46, 0xc3, 0x18, 0x5c, 0x42, 0x5c,
+    0x41, 0x16, 0x4b, 0x01, 0x94, 0x6a, 0x0f, 0x00, 0xec, 0x4a, 0xf1, 0x3a,
+    0x01, 0x3b, 0x93, 0x40, 0x1d, 0x00, 0x25, 0x40, 0x23, 0x42, 0x16, 0xd0,
+    0x11, 0x48, 0x00, 0xf0, 0x03, 0xfa, 0x4e, 0x78, 0x0f, 0x78, 0x36, 0x02,
+    0x3e, 0x43, 0x8f, 0x78, 0x3f, 0x04, 0x37, 0x43, 0xce, 0x78, 0x36, 0x06,
+    0x3e, 0x43, 0x6f, 0x00, 0xbf, 0x5b, 0x7e, 0x0b, 0x00, 0xd1, 0xbf, 0x18,
+    0x56, 0x19, 0x12, 0x36, 0xb6, 0x00, 0x37, 0x50, 0x01, 0x35, 0x65, 0x45,
+    0xe9, 0xd3, 0x01, 0x9a, 0x03, 0x49, 0x92, 0x00, 0x23, 0x43, 0x53, 0x50,
+    0xf7, 0x8c, 0x20, 0x02, 0x7c, 0x00, 0x73, 0x14, 0x00, 0x01, 0x10, 0x09,
+    0x4b, 0x13, 0xc8, 0x00, 0xf0, 0x09, 0x08, 0x4a, 0x84, 0x00, 0x00, 0x92,
+    0x07, 0x48, 0x22, 0x00, 0xe3, 0x1c, 0x02, 0xf0, 0xed, 0xfe, 0x84, 0x42,
+    0x01, 0xdc, 0x00, 0x1b, 0x16, 0xbd, 0xc0, 0x00, 0x00, 0xe2, 0x0a, 0x80,
+    0xd0, 0xaf, 0x25, 0x00, 0x01, 0x10, 0xe7, 0x1b, 0x88, 0x06, 0x00, 0x7e,
+    0x03, 0xc0, 0x02, 0xf0, 0x9d, 0xfe, 0x05, 0x22, 0x05, 0x00, 0xa2, 0x56,
+    0x21, 0x79, 0x2c, 0x06, 0x60, 0x76, 0xff, 0x04, 0x00, 0x01, 0x34, 0x5c,
+    0x15, 0x91, 0x28, 0x00, 0x02, 0xf0, 0x9b, 0xfe, 0xe0, 0xb2, 0x70, 0xec,
+    0x43, 0xf0, 0x12, 0x0d, 0x00, 0x06, 0x00, 0x02, 0xf0, 0x87, 0xfe, 0x05,
+    0x22, 0x07, 0x00, 0xaa, 0x56, 0x30, 0x00, 0x29, 0x79, 0xff, 0xf7, 0x60,
+    0xff, 0x04, 0x1e, 0x02, 0xda, 0x06, 0x48, 0x00, 0xf0, 0x9f, 0xf9, 0x02,
+    0xa4, 0x03, 0x50, 0x00, 0xff, 0xf7, 0x7a, 0xff, 0x66, 0x17, 0x20, 0x7f,
+    0xfe, 0x74, 0x59, 0x20, 0xc0, 0x46, 0x9c, 0x00, 0xf1, 0x1c, 0xf0, 0xb5,
+    0x01, 0x25, 0x8d, 0x40, 0x04, 0x68, 0xac, 0x43, 0x04, 0x60, 0x18, 0x24,
+    0x4c, 0x43, 0x04, 0x19, 0x25, 0x00, 0xc8, 0x35, 0x00, 0x2b, 0x2a, 0xd0,
+    0x1e, 0x68, 0x2e, 0x60, 0x5e, 0x68, 0x6e, 0x60, 0x9e, 0x68, 0xdb, 0x68,
+    0xae, 0x60, 0xdc, 0x34, 0x23, 0x20, 0x00, 0xf0, 0x45, 0x25, 0x00, 0x80,
+    0x23, 0xd0, 0x35, 0x45, 0x19, 0x5b, 0x01, 0x2b, 0x43, 0x80, 0x25, 0x2d,
+    0x06, 0x1d, 0x60, 0x1d, 0x60, 0x0f, 0x4b, 0x0d, 0x1d, 0x8b, 0x40, 0x83,
+    0x60, 0x01, 0x23, 0x1f, 0x00, 0xaf, 0x40, 0x3d, 0x00, 0x08, 0x31, 0x8b,
+    0x40, 0x06, 0x68, 0x35, 0x43, 0x05, 0x60, 0x05, 0x68, 0x2b, 0x43, 0x03,
+    0x60, 0x1f, 0x23, 0x00, 0x19, 0x1a, 0x40, 0xd8, 0x30, 0x02, 0x60, 0xf0,
+    0xbd, 0x80, 0x26, 0x76, 0x02, 0x2e, 0x60, 0xf8, 0x26, 0x76, 0x02, 0x6e,
+    0x60, 0xc0, 0x26, 0x36, 0x03, 0xae, 0x60, 0xd1, 0xe7, 0xae, 0x3c, 0x04,
+    0xb0, 0x40, 0x61, 0x50, 0x05, 0x00, 0x20, 0xc9, 0x61, 0xd0, 0x3e, 0x41,
+    0x48, 0x02, 0xf0, 0xfe, 0xd8, 0x21, 0x11, 0x29, 0xac, 0x05, 0xf2, 0x2f,
+    0x00, 0x23, 0x01, 0x25, 0x0f, 0x26, 0x01, 0x39, 0x99, 0x42, 0x01, 0xd9,
+    0x10, 0x2b, 0x02, 0xd1, 0x00, 0x22, 0xc2, 0x54, 0xf0, 0xbd, 0x1f, 0x00,
+    0x09, 0x4c, 0x2f, 0x40, 0x5a, 0x08, 0xa2, 0x5c, 0x3c, 0x00, 0x67, 0x42,
+    0x67, 0x41, 0xbf, 0x00, 0x3a, 0x41, 0x32, 0x40, 0xd4, 0xb2, 0x27, 0x00,
+    0x37, 0x37, 0x09, 0x2a, 0x00, 0xdc, 0x07, 0x3f, 0xc7, 0x54, 0x01, 0x33,
+    0xe4, 0xe7, 0x44, 0x00, 0x20, 0x85, 0xb0, 0x76, 0x08, 0xf1, 0x4a, 0x03,
+    0x92, 0x02, 0xf0, 0x59, 0xfe, 0x04, 0x1e, 0x2a, 0xd1, 0x01, 0x22, 0x15,
+    0x4d, 0x11, 0x00, 0x2b, 0x00, 0x05, 0x20, 0x00, 0x95, 0x02, 0xf0, 0x57,
+    0xfe, 0x03, 0x9b, 0x32, 0x00, 0x01, 0x21, 0x11, 0x48, 0x00, 0x93, 0x3b,
+    0x00, 0x02, 0xf0, 0x55, 0xff, 0x03, 0x99, 0x30, 0x00, 0x79, 0x43, 0x00,
+    0xf0, 0x42, 0xf9, 0x06, 0x00, 0x0d, 0x4b, 0x22, 0x00, 0x02, 0x21, 0x00,
+    0x93, 0x04, 0x20, 0x02, 0xf0, 0x42, 0xfe, 0x33, 0x00, 0x22, 0x00, 0x01,
+    0x21, 0x05, 0x20, 0x00, 0x96, 0x02, 0xf0, 0x3b, 0xfe, 0x2b, 0x00, 0x02,
+    0x22, 0x21, 0x00, 0x06, 0x46, 0x00, 0x21, 0x34, 0xfe, 0x9e, 0x08, 0x31,
+    0x6c, 0xdc, 0x02, 0x50, 0x5b, 0xf1, 0x73, 0x1b, 0xb7, 0x00, 0xf0, 0xb5,
+    0x87, 0xb0, 0x02, 0x90, 0x04, 0x20, 0x03, 0x91, 0x04, 0x92, 0x05, 0x93,
+    0x02, 0xf0, 0x07, 0xff, 0xfa, 0x21, 0xa0, 0x26, 0x89, 0x00, 0x00, 0xf0,
+    0x16, 0xf9, 0x32, 0x25, 0x76, 0x00, 0x46, 0x43, 0x01, 0x90, 0xff, 0x35,
+    0x17, 0x4b, 0x17, 0x4a, 0xf3, 0x18, 0x07, 0x24, 0x93, 0x42, 0x0f, 0xd9,
+    0x01, 0x9b, 0x01, 0x3d, 0xf6, 0x1a, 0x00, 0x2d, 0xf4, 0xd1, 0x28, 0x00,
+    0x1f, 0xe0, 0x00, 0x9b, 0x01, 0x3f, 0x1b, 0x1b, 0x00, 0x93, 0x00, 0x2f,
+    0x06, 0xd1, 0x01, 0x3c, 0x00, 0x2c, 0xef, 0xd0, 0x23, 0x00, 0x27, 0x00,
+    0x63, 0x43, 0x00, 0x93, 0x30, 0x00, 0x00, 0x99, 0x00, 0xf0, 0xf3, 0xf8,
+    0x02, 0x9b, 0x98, 0x42, 0xeb, 0xd1, 0x00, 0x29, 0xe9, 0xd1, 0xfa, 0x23,
+    0x01, 0x20, 0x9b, 0x00, 0x5e, 0x43, 0x03, 0x9b, 0x1e, 0x60, 0x04, 0x9b,
+    0x1c, 0x60, 0x05, 0x9b, 0x1f, 0x16, 0x1e, 0x85, 0x50, 0x8e, 0xf4, 0xff,
+    0x50, 0xf8, 0x0c, 0x00, 0x84, 0x44, 0xc0, 0x4e, 0x24, 0x4b, 0x24, 0x4d,
+    0x33, 0x60, 0x19, 0x00, 0xaa, 0x68, 0x91, 0x82, 0x44, 0xe7, 0x4c, 0x23,
+    0x4b, 0x9c, 0x42, 0x24, 0xd3, 0x02, 0xf0, 0x3e, 0xfe, 0x21, 0x4b, 0x33,
+    0x82, 0x44, 0x17, 0x1f, 0x82, 0x44, 0x13, 0x1e, 0x82, 0x44, 0x15, 0x1e,
+    0x82, 0x44, 0xf4, 0x04, 0xb3, 0xff, 0xa5, 0x60, 0xfe, 0xf7, 0x02, 0xff,
+    0xff, 0xf7, 0x94, 0xf8, 0xff, 0xf7, 0x56, 0xfa, 0x18, 0x4c, 0x19, 0x82,
+    0x44, 0x1c, 0xcc, 0x82, 0x44, 0x22, 0xba, 0xfd, 0x82, 0x44, 0x24, 0xa9,
+    0xfd, 0x82, 0x44, 0x25, 0xc0, 0x46, 0x84, 0x44, 0x03, 0x80, 0x44, 0x00,
+    0x8c, 0x44, 0x66, 0x60, 0x0c, 0x00, 0x20, 0x70, 0x0c, 0x84, 0x44, 0x40,
+    0x10, 0x0c, 0x00, 0x20, 0x14, 0x00, 0x04, 0x84, 0x44, 0x00, 0x1c, 0x00,
+    0x01, 0x38, 0x24, 0x90, 0xbe, 0xfd, 0xe7, 0x08, 0x4a, 0x03, 0x00, 0x11,
+    0x68, 0xb8, 0x06, 0xe0, 0x07, 0x49, 0x11, 0x60, 0x10, 0x68, 0x06, 0x49,
+    0xc3, 0x18, 0x8b, 0x42, 0x01, 0xd8, 0xc6, 0x11, 0x02, 0x56, 0x03, 0x42,
+    0xc0, 0x46, 0x64, 0x14, 0xc0, 0x24, 0x01, 0xfc, 0x24, 0xb0, 0xbe, 0xfd,
+    0xe7, 0x13, 0xb5, 0x0c, 0x00, 0x19, 0x00, 0x07, 0x4b, 0x54, 0x53, 0xf0,
+    0x03, 0x06, 0x4b, 0x1a, 0x00, 0x01, 0x92, 0x00, 0x93, 0x02, 0x00, 0x23,
+    0x00, 0x04, 0x48, 0x04, 0xf0, 0xd1, 0xfc, 0x22, 0x00, 0xf0, 0x09, 0xc0,
+    0x46, 0x49, 0x00, 0x01, 0x10, 0x11, 0xfd, 0x00, 0x10, 0x56, 0x00, 0x01,
+    0x10, 0x0f, 0xb4, 0x07, 0xb5, 0x07, 0x48, 0x04, 0xf0, 0x41, 0xfd, 0xb4,
+    0x58, 0xf0, 0x03, 0x07, 0xd0, 0x05, 0xa9, 0x18, 0x00, 0x01, 0x91, 0x05,
+    0xf0, 0x43, 0xfe, 0x03, 0x48, 0x04, 0xf0, 0x36, 0xfd, 0x32, 0x00, 0x60,
+    0x85, 0x00, 0x01, 0x10, 0x10, 0xfd, 0xb8, 0x02, 0x00, 0x10, 0x45, 0x71,
+    0xe6, 0xff, 0x95, 0x00, 0x01, 0x10, 0x12, 0xdc, 0x44, 0x5f, 0x15, 0xd2,
+    0x90, 0x66, 0xd1, 0xdc, 0x44, 0x00, 0x80, 0x80, 0x21, 0x09, 0x06, 0xc2,
+    0x17, 0x51, 0x40, 0x9a, 0x0c, 0x60, 0xc8, 0x43, 0x09, 0xf0, 0xc4, 0xfa,
+    0xe2, 0x44, 0x08, 0xe0, 0x44, 0x1b, 0xe3, 0xe0, 0x44, 0x0f, 0x2c, 0x45,
+    0x13, 0x31, 0x09, 0xf0, 0x9f, 0x4a, 0x00, 0x0f, 0x2c, 0x45, 0x0b, 0xe0,
+    0x94, 0x46, 0x4e, 0x4a, 0x92, 0x6f, 0x92, 0x08, 0x62, 0x46, 0x01, 0xd2,
+    0x30, 0xe0, 0x2c, 0x00, 0xf4, 0x09, 0x4a, 0x4e, 0xb5, 0x6f, 0x6d, 0x08,
+    0xfc, 0xd3, 0x34, 0x6e, 0x75, 0x6e, 0x77, 0x6f, 0x36, 0x6f, 0x00, 0xf0,
+    0x25, 0xf8, 0x94, 0x46, 0x44, 0x4a, 0x38, 0x00, 0x20, 0x62, 0x46, 0x3c,
+    0x0d, 0x35, 0x94, 0x46, 0x40, 0x38, 0x00, 0x11, 0x58, 0x38, 0x00, 0x1d,
+    0x3c, 0x38, 0x00, 0x5b, 0x4d, 0xf8, 0x94, 0x46, 0x36, 0x38, 0x00, 0xf4,
+    0x09, 0x00, 0x2b, 0x24, 0xdb, 0x11, 0xd0, 0x00, 0x29, 0x3e, 0xda, 0x00,
+    0xb5, 0xc9, 0x43, 0x40, 0x42, 0x00, 0xd1, 0x01, 0x31, 0x00, 0xf0, 0x38,
+    0xf8, 0x0c, 0x00, 0x30, 0xdb, 0x43, 0x52, 0x08, 0x00, 0xb0, 0x33, 0x00,
+    0xbd, 0x00, 0x2a, 0xeb, 0xd1, 0x00, 0x28, 0x01, 0xd1, 0xe2, 0x00, 0xf5,
+    0x0f, 0x00, 0x20, 0xc9, 0x0f, 0xc9, 0x07, 0x01, 0xd1, 0xc0, 0x43, 0x41,
+    0x08, 0x00, 0xb5, 0x09, 0xf0, 0x1a, 0xfa, 0x00, 0x22, 0x00, 0x23, 0x00,
+    0xbd, 0x00, 0xb5, 0x00, 0x29, 0x0a, 0xdb, 0x34, 0x00, 0x25, 0xf0, 0x14,
+    0x48, 0x00, 0x2d, 0x00, 0xbd, 0x52, 0x00, 0x37, 0xf0, 0x05, 0xf8, 0x5e,
+    0x00, 0x60, 0x29, 0x23, 0xd1, 0x00, 0x2b, 0x18, 0xba, 0x1b, 0xd2, 0xd0,
+    0xbc, 0x46, 0x0d, 0x4f, 0x38, 0x66, 0x7a, 0x66, 0x00, 0x21, 0x00, 0x23,
+    0x4c, 0x01, 0x70, 0x7a, 0x6f, 0x38, 0x6f, 0x67, 0x46, 0x70, 0x48, 0x4f,
+    0x50, 0xd0, 0x07, 0x48, 0x01, 0x00, 0x74, 0x00, 0x22, 0xe0, 0xf9, 0x74,
+    0x00, 0x00, 0x10, 0x0c, 0x02, 0xb2, 0x10, 0x00, 0x40, 0x01, 0x01, 0x58,
+    0x42, 0xf0, 0x06, 0x2b, 0x00, 0xd0, 0xbf, 0xe0, 0x13, 0x0c, 0x28, 0xd1,
+    0x00, 0x2a, 0xe7, 0xd0, 0x80, 0xb4, 0x11, 0x4f, 0x39, 0x66, 0x7a, 0x66,
+    0x48, 0x00, 0xd3, 0x30, 0xb4, 0x04, 0x0c, 0x7b, 0x6f, 0x39, 0x6f, 0x1b,
+    0x04, 0x23, 0x43, 0x3b, 0x14, 0x00, 0x99, 0xff, 0xe7, 0xc0, 0x46, 0x84,
+    0xb2, 0x7b, 0x6f, 0x3d, 0x16, 0x00, 0x80, 0xc0, 0x46, 0x00, 0x23, 0x2c,
+    0x04, 0x2d, 0x0c, 0x7a, 0x00, 0x62, 0x00, 0x19, 0x69, 0x41, 0xb0, 0xbc,
+    0x60, 0x00, 0xf2, 0x27, 0xf0, 0xb5, 0x94, 0x46, 0x00, 0x25, 0x14, 0x0e,
+    0x01, 0xd1, 0x12, 0x02, 0x08, 0x35, 0x14, 0x0f, 0x01, 0xd1, 0x12, 0x01,
+    0x04, 0x35, 0x94, 0x0f, 0x01, 0xd1, 0x92, 0x00, 0x02, 0x35, 0xd4, 0x0f,
+    0x01, 0xd1, 0x52, 0x00, 0x01, 0x35, 0xd4, 0x0b, 0x01, 0x34, 0x25, 0x4f,
+    0x7c, 0x66, 0x25, 0x4c, 0x3c, 0x66, 0x0e, 0x0c, 0x93, 0xb2, 0x68, 0x00,
+    0xf0, 0x0f, 0x3c, 0x6f, 0x66, 0x43, 0x36, 0x0c, 0x77, 0x03, 0xbe, 0x46,
+    0x73, 0x43, 0xdf, 0x0b, 0x5b, 0x04, 0xc0, 0x1a, 0xb9, 0x41, 0x13, 0x0c,
+    0x73, 0x43, 0xdb, 0x18, 0xc9, 0x1a, 0xce, 0x08, 0x1c, 0x00, 0xa4, 0xb6,
+    0x44, 0x93, 0xb2, 0x73, 0x43, 0x1f, 0x0f, 0x1b, 0x01, 0x1c, 0x00, 0x40,
+    0x1f, 0x0b, 0x1b, 0x05, 0x0c, 0x00, 0x60, 0x86, 0x0d, 0x8f, 0x02, 0x3e,
+    0x43, 0x24, 0x00, 0xe0, 0x09, 0x2d, 0x24, 0xdb, 0x52, 0x0a, 0x72, 0x43,
+    0x80, 0x1a, 0x77, 0x03, 0x46, 0x0a, 0x12, 0x00, 0xf1, 0x19, 0x16, 0x23,
+    0x5b, 0x1b, 0xde, 0x40, 0xdf, 0x40, 0xbf, 0x19, 0x64, 0x46, 0x66, 0x43,
+    0x82, 0x1b, 0x70, 0x46, 0x04, 0x35, 0x06, 0x33, 0x01, 0x00, 0xd9, 0x40,
+    0xa8, 0x40, 0xc0, 0x19, 0x00, 0xd3, 0x01, 0x31, 0xa2, 0x42, 0x06, 0xd2,
+    0x00, 0x23, 0x62, 0x02, 0x03, 0x24, 0x01, 0xf0, 0x03, 0x12, 0x1b, 0x01,
+    0x30, 0xf3, 0xd3, 0xf1, 0xe7, 0x09, 0x27, 0x7f, 0x1b, 0xfe, 0x40, 0x64,
+    0x46, 0xa2, 0xb2, 0x52, 0x00, 0xf0, 0x03, 0x00, 0xd2, 0x01, 0x39, 0x22,
+    0x0c, 0x72, 0x43, 0x13, 0x0c, 0x12, 0x04, 0x82, 0x1a, 0x99, 0x41, 0x0b,
+    0x00, 0x4c, 0x00, 0x91, 0x13, 0x37, 0x01, 0x00, 0xf9, 0x40, 0xa8, 0x40,
+    0x80, 0x4c, 0x00, 0x00, 0x32, 0x17, 0x80, 0xa2, 0x42, 0x0a, 0xd2, 0xf0,
+    0xbd, 0x01, 0x30, 0x10, 0x00, 0xb7, 0x12, 0x1b, 0xfa, 0xd2, 0x01, 0x3b,
+    0xf8, 0xd1, 0xa2, 0x42, 0x00, 0x14, 0x00, 0xf0, 0x09, 0xf7, 0xe7, 0xf0,
+    0xb5, 0x1c, 0x0c, 0x00, 0xd0, 0x80, 0xe0, 0x0c, 0xb4, 0x00, 0x25, 0x1c,
+    0x0a, 0x04, 0xd1, 0x1b, 0x02, 0x16, 0x0e, 0x33, 0x43, 0x36, 0x01, 0xa0,
+    0x1c, 0x0b, 0x04, 0xd1, 0x1b, 0x01, 0x16, 0x0f, 0x33, 0x43, 0x3c, 0x01,
+    0xa0, 0x9c, 0x0b, 0x04, 0xd1, 0x9b, 0x00, 0x96, 0x0f, 0x33, 0x43, 0x42,
+    0x01, 0xf1, 0x08, 0xdc, 0x0b, 0x02, 0xd1, 0x92, 0x18, 0x5b, 0x41, 0x01,
+    0x35, 0x1c, 0x00, 0x97, 0x18, 0x64, 0x41, 0x01, 0x34, 0x46, 0x4f, 0x7c,
+    0x66, 0x46, 0x48, 0x01, 0x04, 0xae, 0x01, 0x06, 0x48, 0x01, 0x60, 0x97,
+    0xb2, 0x77, 0x43, 0xc0, 0x1b, 0xb6, 0x00, 0x02, 0x06, 0x00, 0xf2, 0x05,
+    0x9f, 0xb2, 0x77, 0x43, 0xc9, 0x1b, 0xc9, 0x1b, 0x17, 0x0c, 0x77, 0x43,
+    0x7e, 0x04, 0xff, 0x0b, 0x80, 0x1b, 0xb9, 0x41, 0x5a, 0x01, 0xe6, 0x0c,
+    0x2d, 0x33, 0xdb, 0xb6, 0x44, 0x12, 0x0b, 0x1f, 0x05, 0x3a, 0x43, 0x1b,
+    0x0b, 0x38, 0x00, 0x02, 0x32, 0x00, 0x00, 0x30, 0x00, 0x40, 0x3e, 0x04,
+    0x3f, 0x0c, 0x30, 0x00, 0x04, 0x6a, 0x01, 0x11, 0x29, 0x1a, 0x01, 0xf0,
+    0x03, 0x0c, 0x3d, 0x77, 0x46, 0xaf, 0x40, 0xbf, 0x19, 0x30, 0xbc, 0xa2,
+    0xb2, 0xab, 0xb2, 0x72, 0x43, 0x73, 0x43, 0xdc, 0x11, 0x04, 0x24, 0x01,
+    0x00, 0x0c, 0x00, 0x00, 0x80, 0x02, 0xf1, 0x00, 0x01, 0x37, 0x00, 0x1b,
+    0xa9, 0x41, 0xf9, 0xd2, 0x78, 0x1e, 0x00, 0x21, 0xf0, 0xbd, 0x0c, 0x3a,
+    0x00, 0xf3, 0x06, 0x77, 0x46, 0x7f, 0x0b, 0xaf, 0x40, 0xff, 0x19, 0xe0,
+    0xe7, 0x00, 0x24, 0x5d, 0x1c, 0x07, 0xd0, 0x14, 0x4f, 0x7d, 0x66, 0x39,
+    0x72, 0x02, 0x00, 0x0c, 0x02, 0xf0, 0x01, 0x95, 0xb2, 0x9e, 0xb2, 0x65,
+    0x43, 0x66, 0x43, 0x40, 0x1b, 0xb1, 0x41, 0x15, 0x0c, 0x1e, 0x0c, 0x0c,
+    0x00, 0x80, 0x36, 0x04, 0x2f, 0x0c, 0x3e, 0x43, 0x2d, 0x04, 0x14, 0x00,
+    0x42, 0x99, 0x42, 0x04, 0xd2, 0xec, 0x0e, 0x00, 0x54, 0x00, 0x60, 0x01,
+    0xd1, 0x90, 0x42, 0xf7, 0xd3, 0x70, 0x00, 0x86, 0x01, 0x34, 0x99, 0x42,
+    0xf2, 0xd3, 0xf6, 0xe7, 0xcc, 0x01, 0xf3, 0x0e, 0x48, 0x40, 0x41, 0x40,
+    0x48, 0x40, 0x18, 0xb4, 0x1b, 0x4b, 0x5b, 0x68, 0xfc, 0x46, 0x01, 0x93,
+    0x08, 0xbd, 0x04, 0xdf, 0x7b, 0x6e, 0x00, 0x10, 0x18, 0xb4, 0x17, 0x4b,
+    0x1b, 0x12, 0x00, 0x91, 0x00, 0xdf, 0x85, 0x6e, 0x00, 0x10, 0x94, 0x46,
+    0x13, 0x26, 0x04, 0x93, 0x09, 0xd2, 0x62, 0x46, 0x18, 0xb4, 0x0f, 0x4b,
+    0xdb, 0x1e, 0x00, 0x86, 0x0c, 0xdf, 0x3d, 0x71, 0x00, 0x10, 0x0c, 0x4a,
+    0x9a, 0x04, 0x75, 0x62, 0x46, 0xff, 0xf7, 0xee, 0xff, 0x08, 0x2e, 0x04,
+    0x73, 0xf0, 0xbd, 0x18, 0xb4, 0x03, 0x4b, 0x9b, 0x30, 0x00, 0x81, 0x08,
+    0xdf, 0xe1, 0x6f, 0x00, 0x10, 0x7c, 0x18, 0x64, 0x19, 0xf5, 0x1b, 0xd0,
+    0xff, 0xb5, 0x50, 0x40, 0x42, 0x40, 0x50, 0x40, 0x59, 0x40, 0x4b, 0x40,
+    0x59, 0x40, 0x00, 0xe0, 0xff, 0xb5, 0x15, 0x4f, 0x4c, 0x00, 0x64, 0x0d,
+    0x03, 0xd0, 0xbc, 0x42, 0x04, 0xd1, 0x0c, 0x03, 0x14, 0xd8, 0x00, 0x20,
+    0x09, 0x0d, 0x09, 0x05, 0x5c, 0x14, 0x00, 0xf0, 0x31, 0x1c, 0x03, 0x0a,
+    0xd8, 0x00, 0x22, 0x1b, 0x0d, 0x1b, 0x05, 0x01, 0x26, 0x4b, 0x40, 0x09,
+    0xd4, 0x4b, 0x40, 0x03, 0xd5, 0x8b, 0x42, 0x00, 0xd1, 0x82, 0x42, 0xff,
+    0xbd, 0x99, 0x42, 0xfc, 0xd1, 0x90, 0x42, 0xff, 0xbd, 0x0b, 0x43, 0xdb,
+    0x18, 0x03, 0x43, 0x13, 0x43, 0xf5, 0xd0, 0xc9, 0x43, 0x49, 0x18, 0xff,
+    0xbd, 0x00, 0x00, 0xff, 0x07, 0x00, 0x00, 0x00, 0xb5, 0xff, 0xf7, 0xcf,
+    0xff, 0x52, 0x05, 0x40, 0x00, 0xbd, 0x01, 0x20, 0x72, 0x04, 0x00, 0xf4,
+    0x46, 0x30, 0x80, 0x41, 0x00, 0xcc, 0x04, 0x78, 0xb5, 0xff, 0xf7, 0xc1,
+    0xff, 0x01, 0xd9, 0x1c, 0x00, 0x1b, 0xb1, 0x10, 0x00, 0x11, 0xa9, 0x2c,
+    0x00, 0xf0, 0x01, 0x01, 0x20, 0x40, 0x05, 0x4a, 0x00, 0x12, 0x18, 0x04,
+    0xd8, 0x5a, 0x00, 0x12, 0x18, 0x01, 0xd8, 0x2a, 0x19, 0x10, 0x01, 0x60,
+    0x27, 0x01, 0x64, 0x27, 0x00, 0x19, 0x14, 0xf0, 0x23, 0x05, 0xd1, 0x70,
+    0x47, 0xc1, 0x17, 0x48, 0x40, 0x40, 0x1a, 0xfa, 0xd0, 0xc9, 0x07, 0x13,
+    0xb5, 0x06, 0x4b, 0x1b, 0x68, 0x98, 0x47, 0x0c, 0xbc, 0x44, 0x1c, 0xa2,
+    0x40, 0x10, 0x05, 0x12, 0x0b, 0x03, 0x49, 0x09, 0x1b, 0x09, 0x05, 0x19,
+    0x43, 0x11, 0x43, 0x10, 0xbd, 0x7c, 0x19, 0x00, 0x20, 0x1f, 0x04, 0x4c,
+    0x26, 0xf0, 0x23, 0x4c, 0x00, 0x62, 0x0d, 0x80, 0x23, 0xd2, 0x18, 0xdb,
+    0x00, 0xd2, 0x1a, 0x5b, 0x05, 0x7e, 0x2a, 0x10, 0xdd, 0x9e, 0x3a, 0x13,
+    0xda, 0xcc, 0x17, 0x09, 0x03, 0x49, 0x08, 0x19, 0x43, 0x52, 0x42, 0xd1,
+    0x40, 0x64, 0x00, 0x01, 0x34, 0x15, 0x32, 0x20, 0x2a, 0x05, 0xda, 0xd0,
+    0x40, 0x08, 0x43, 0x60, 0x43, 0x5a, 0x1a, 0x40, 0x10, 0xbd, 0x08, 0x46,
+    0x0a, 0x00, 0xe2, 0xc8, 0x0f, 0xc0, 0x18, 0x01, 0x38, 0x10, 0xbd, 0x18,
+    0xb4, 0x04, 0x4b, 0x5b, 0x6a, 0x6a, 0x01, 0x40, 0x24, 0xdf, 0xed, 0x72,
+    0xc2, 0x1a, 0x00, 0x6c, 0x01, 0x00, 0x18, 0x00, 0x22, 0xdb, 0x6d, 0x18,
+    0x00, 0x44, 0x5c, 0xdf, 0xf9, 0x73, 0x18, 0x00, 0xc1, 0xc9, 0x42, 0x11,
+    0xd3, 0x00, 0xb5, 0x49, 0x00, 0x49, 0x08, 0x00, 0x22, 0x20, 0x6b, 0xd0,
+    0x29, 0x04, 0xd4, 0x00, 0x22, 0x40, 0x42, 0x8a, 0x41, 0x11, 0x46, 0x00,
+    0xbd, 0xd0, 0x06, 0x00, 0x02, 0x01, 0x21, 0x00, 0x00, 0x40, 0x00, 0x12,
+    0x6e, 0x40, 0x00, 0x39, 0x6c, 0xdf, 0xfb, 0x58, 0x00, 0x22, 0x9b, 0x6f,
+    0x18, 0x00, 0x35, 0x78, 0xdf, 0x17, 0x58, 0x00, 0x01, 0x30, 0x00, 0x03,
+    0x18, 0x00, 0x35, 0x7c, 0xdf, 0x85, 0x18, 0x00, 0x0f, 0xd0, 0x4b, 0x0f,
+    0x2a, 0xca, 0xf9, 0xd0, 0x4b, 0x24, 0xca, 0xf9, 0xd0, 0x4b, 0x22, 0x67,
+    0xfb, 0xd0, 0x4b, 0x00, 0x48, 0x00, 0x40, 0x49, 0x6e, 0x00, 0x10, 0x7c,
+    0x46, 0x00, 0x40, 0x01, 0x0f, 0xd0, 0x4b, 0x19, 0x00, 0x3c, 0x00, 0xf1,
+    0x11, 0x0f, 0xb4, 0x03, 0xbc, 0x0c, 0xbc, 0xf0, 0xb5, 0x01, 0x24, 0xe4,
+    0x07, 0x63, 0x40, 0x00, 0xe0, 0xf0, 0xb5, 0x0c, 0x0d, 0xcf, 0x0f, 0x66,
+    0x1e, 0x36, 0x05, 0x89, 0x1b, 0x64, 0x05, 0x03, 0xd3, 0x6e, 0x06, 0x30,
+    0xd3, 0x01, 0x31, 0x72, 0x02, 0xf1, 0x15, 0x66, 0x1c, 0xf6, 0x0a, 0x07,
+    0xd0, 0xe4, 0x1b, 0x00, 0x20, 0x7f, 0x00, 0x79, 0x1c, 0x89, 0x07, 0x89,
+    0x12, 0x80, 0x3c, 0x24, 0x03, 0x1d, 0x0d, 0xdf, 0x0f, 0x6e, 0x1e, 0x36,
+    0x05, 0x9b, 0x1b, 0x6d, 0x05, 0x03, 0xd3, 0x8a, 0x06, 0x81, 0xd3, 0x01,
+    0x33, 0x6d, 0x0d, 0x03, 0xd0, 0x6e, 0x30, 0x00, 0xf0, 0x1d, 0xed, 0x1b,
+    0x00, 0x22, 0x7f, 0x00, 0x7b, 0x1c, 0x9b, 0x07, 0x9b, 0x12, 0x80, 0x3d,
+    0x2d, 0x03, 0x2f, 0x1b, 0x66, 0x1b, 0x58, 0xd4, 0xa4, 0x46, 0x20, 0x2e,
+    0x46, 0xda, 0x20, 0x37, 0x14, 0x00, 0xbc, 0x40, 0x1d, 0x00, 0xbd, 0x40,
+    0xf2, 0x40, 0x33, 0x41, 0x2a, 0x43, 0x8c, 0x12, 0xf0, 0x0b, 0xcb, 0x0f,
+    0x05, 0xd0, 0xc9, 0x43, 0xc0, 0x43, 0x00, 0x22, 0x64, 0x42, 0x50, 0x41,
+    0x51, 0x41, 0x62, 0x46, 0x4d, 0x0d, 0x28, 0xd1, 0x0d, 0x0d, 0x07, 0xd1,
+    0x9e, 0x27, 0xf2, 0x01, 0x24, 0x19, 0x40, 0x41, 0x49, 0x41, 0x01, 0x3a,
+    0x0d, 0x0d, 0xf9, 0xd0, 0x64, 0x00, 0x06, 0xd3, 0x28, 0x05, 0xf1, 0x3e,
+    0x00, 0x2c, 0x01, 0xd1, 0x40, 0x08, 0x40, 0x00, 0x01, 0x3a, 0x0b, 0xd4,
+    0x94, 0x1c, 0xe4, 0x0a, 0x04, 0xd1, 0x12, 0x05, 0x11, 0x44, 0xdb, 0x07,
+    0x19, 0x44, 0xf0, 0xbd, 0xd9, 0x07, 0x20, 0x4b, 0x19, 0x43, 0x00, 0xe0,
+    0xd9, 0x07, 0x00, 0x20, 0xf0, 0xbd, 0x00, 0x29, 0xdd, 0xd1, 0x00, 0x2c,
+    0xdb, 0xd1, 0xf0, 0xbd, 0x01, 0x32, 0xc6, 0x07, 0x40, 0x08, 0xcd, 0x07,
+    0x28, 0x43, 0x49, 0x08, 0x00, 0x2e, 0xe1, 0xd0, 0xd9, 0xe7, 0x3c, 0x2e,
+    0x29, 0xda, 0x20, 0x3e, 0x40, 0x94, 0x00, 0xf1, 0x22, 0x00, 0xd0, 0x01,
+    0x24, 0xf2, 0x40, 0x14, 0x43, 0x1a, 0x00, 0xbb, 0x40, 0x1c, 0x43, 0xd3,
+    0x17, 0xac, 0xe7, 0xac, 0x46, 0x20, 0x2f, 0x08, 0xda, 0x20, 0x36, 0x04,
+    0x00, 0xb4, 0x40, 0x0d, 0x00, 0xb5, 0x40, 0xf8, 0x40, 0x39, 0x41, 0x28,
+    0x43, 0xa5, 0xe7, 0x3c, 0x2f, 0x0c, 0xda, 0x20, 0x3f, 0x40, 0x18, 0x00,
+    0x00, 0x36, 0x00, 0xf0, 0x06, 0xf8, 0x40, 0x04, 0x43, 0x08, 0x00, 0xb1,
+    0x40, 0x0c, 0x43, 0xc1, 0x17, 0xea, 0xe7, 0x10, 0x00, 0x19, 0x00, 0x00,
+    0x24, 0x94, 0xde, 0x17, 0x10, 0x7f, 0x5c, 0x01, 0x02, 0x5a, 0x01, 0xf0,
+    0x05, 0xe6, 0x0a, 0x64, 0x05, 0x64, 0x0d, 0x02, 0xd0, 0x65, 0x1c, 0xed,
+    0x0a, 0x04, 0xd0, 0x00, 0x20, 0x01, 0x21, 0x09, 0x05, 0x4c, 0x01, 0xba,
+    0xa4, 0x46, 0x1c, 0x0d, 0x67, 0x1e, 0x3f, 0x05, 0xdb, 0x1b, 0xe7, 0x22,
+    0x00, 0x41, 0x22, 0x01, 0x23, 0x1b, 0x22, 0x00, 0xf3, 0x56, 0x77, 0x40,
+    0x64, 0x44, 0x97, 0xb4, 0x84, 0xb2, 0x96, 0xb2, 0x74, 0x43, 0x07, 0x0c,
+    0x7e, 0x43, 0x15, 0x0c, 0x6f, 0x43, 0x80, 0xb2, 0x68, 0x43, 0x36, 0x18,
+    0x02, 0xd3, 0x01, 0x20, 0x00, 0x04, 0x3f, 0x18, 0x30, 0x04, 0x35, 0x0c,
+    0x00, 0x19, 0x7d, 0x41, 0x84, 0x46, 0x88, 0xb2, 0x9a, 0xb2, 0x50, 0x43,
+    0x0c, 0x0c, 0x62, 0x43, 0x1f, 0x0c, 0x7c, 0x43, 0x8e, 0xb2, 0x7e, 0x43,
+    0x92, 0x19, 0x02, 0xd3, 0x01, 0x26, 0x36, 0x04, 0xa4, 0x19, 0x16, 0x04,
+    0x17, 0x0c, 0x36, 0x18, 0x67, 0x41, 0x01, 0xbc, 0x81, 0xb2, 0x9a, 0xb2,
+    0x51, 0x43, 0x04, 0x0c, 0x62, 0x43, 0x1b, 0x0c, 0x5c, 0x43, 0x80, 0xb2,
+    0x58, 0x43, 0x12, 0x4c, 0x00, 0xf0, 0x18, 0x24, 0x18, 0x10, 0x04, 0x13,
+    0x0c, 0x40, 0x18, 0x63, 0x41, 0x2d, 0x18, 0x5e, 0x41, 0x00, 0x20, 0x47,
+    0x41, 0x06, 0xbc, 0x88, 0xb2, 0x93, 0xb2, 0x58, 0x43, 0x0c, 0x0c, 0x63,
+    0x43, 0x12, 0x0c, 0x54, 0x43, 0x89, 0xb2, 0x51, 0x43, 0x5b, 0x2e, 0x00,
+    0xf1, 0x01, 0x21, 0x09, 0x04, 0x64, 0x18, 0x19, 0x04, 0x1a, 0x0c, 0x09,
+    0x18, 0x62, 0x41, 0x6d, 0x18, 0x56, 0x2e, 0x00, 0xf2, 0x06, 0x18, 0xbc,
+    0xf9, 0x02, 0x72, 0x0d, 0x11, 0x43, 0xf0, 0x02, 0x6a, 0x0d, 0x10, 0x43,
+    0xed, 0x02, 0x0a, 0x0d, 0x03, 0xd1, 0x6d, 0xc0, 0x01, 0xe0, 0x3b, 0x12,
+    0x4e, 0x9b, 0x1b, 0x76, 0x00, 0xb3, 0x42, 0x0e, 0xd2, 0x6d, 0x00, 0x07,
+    0xc6, 0x01, 0x72, 0x26, 0x71, 0x41, 0x66, 0x46, 0x35, 0x43, 0xc8, 0x01,
+    0xf1, 0x10, 0x1b, 0x05, 0xc9, 0x18, 0xe4, 0x07, 0x21, 0x44, 0xf0, 0xbd,
+    0x0b, 0xda, 0x01, 0x33, 0x06, 0xd1, 0x01, 0x30, 0x04, 0xd1, 0x01, 0x31,
+    0x4f, 0x0d, 0x01, 0xd0, 0x49, 0x08, 0xf2, 0xe7, 0xe1, 0xca, 0x01, 0xa0,
+    0x01, 0x36, 0x31, 0x05, 0x00, 0x20, 0xeb, 0xe7, 0x00, 0x00, 0x24, 0x5b,
+    0x2c, 0xf0, 0xb5, 0x3a, 0x01, 0x00, 0xae, 0x02, 0x08, 0x3a, 0x01, 0xf0,
+    0x10, 0xd0, 0x25, 0x2d, 0x06, 0x00, 0x26, 0xf6, 0x43, 0x2e, 0x66, 0x1e,
+    0x09, 0x6e, 0x66, 0xce, 0x0f, 0xf6, 0x19, 0xb4, 0x46, 0x49, 0x00, 0x4f,
+    0x0d, 0x02, 0xd0, 0x7e, 0x1c, 0xf6, 0x0a, 0x03, 0x0a, 0x05, 0xf0, 0x3b,
+    0x21, 0x40, 0x3f, 0x3f, 0x03, 0x3e, 0x1b, 0xb6, 0x00, 0xb4, 0x44, 0x01,
+    0x3f, 0x7f, 0x05, 0xc9, 0x1b, 0x49, 0x08, 0x2e, 0x6f, 0x01, 0x36, 0x76,
+    0x08, 0x9c, 0x02, 0x95, 0x0d, 0x25, 0x43, 0x75, 0x43, 0xed, 0x13, 0x75,
+    0x43, 0xad, 0x13, 0x01, 0x35, 0x6d, 0x10, 0xf6, 0x03, 0x76, 0x1b, 0x0c,
+    0xb4, 0xcc, 0x02, 0x45, 0x0d, 0x2c, 0x43, 0xa2, 0xb2, 0xb3, 0xb2, 0x5a,
+    0x43, 0x27, 0x0c, 0x7b, 0x43, 0x35, 0x0c, 0x6f, 0x43, 0xa4, 0xb2, 0x6c,
+    0x43, 0x1b, 0x68, 0x01, 0xf0, 0x17, 0x24, 0x24, 0x04, 0x3f, 0x19, 0x1c,
+    0x04, 0x1d, 0x0c, 0xa4, 0x18, 0x7d, 0x41, 0x24, 0x19, 0x6d, 0x41, 0x00,
+    0x9a, 0x91, 0xb2, 0xac, 0xb2, 0x61, 0x43, 0x17, 0x0c, 0x7c, 0x43, 0x2b,
+    0x0c, 0x5f, 0x43, 0x92, 0xb2, 0x5a, 0x43, 0xa4, 0x3e, 0x01, 0xf0, 0x00,
+    0x22, 0x12, 0x04, 0xbf, 0x18, 0x22, 0x04, 0x23, 0x0c, 0x52, 0x18, 0x7b,
+    0x41, 0x01, 0x9c, 0x40, 0x00, 0xf1, 0x43, 0x52, 0x0e, 0xd9, 0x01, 0x0a,
+    0x43, 0x44, 0x01, 0xa0, 0x1a, 0x81, 0xb2, 0xb2, 0xb2, 0x51, 0x43, 0x03,
+    0x14, 0x5a, 0x43, 0x36, 0x0c, 0x73, 0x43, 0x87, 0xb2, 0x77, 0x43, 0xd6,
+    0x17, 0xd2, 0x19, 0x00, 0x27, 0x7e, 0x41, 0x36, 0x04, 0x9b, 0x19, 0x17,
+    0x04, 0x16, 0x0c, 0x7f, 0x18, 0x5e, 0x41, 0x73, 0x16, 0xed, 0x18, 0xf3,
+    0x01, 0x00, 0x26, 0x80, 0x33, 0x75, 0x41, 0xa9, 0x0f, 0x06, 0xd1, 0x64,
+    0x00, 0x69, 0x0a, 0xe8, 0x05, 0x5b, 0x0a, 0x18, 0x43, 0x09, 0xd2, 0x2f,
+    0xe0, 0x04, 0x22, 0x94, 0x44, 0x1a, 0x00, 0x90, 0x0a, 0xa8, 0x05, 0x9b,
+    0x0a, 0x18, 0x43, 0x26, 0xd3, 0x86, 0x01, 0xf3, 0x0c, 0x24, 0x04, 0x00,
+    0x9a, 0x01, 0x9b, 0x0d, 0x00, 0x55, 0x43, 0x64, 0x1b, 0x43, 0x43, 0xe4,
+    0x1a, 0x95, 0xb2, 0x86, 0xb2, 0x75, 0x43, 0x17, 0x0c, 0x7e, 0x43, 0x03,
+    0x9e, 0x00, 0x15, 0xb6, 0x9e, 0x00, 0xf1, 0x27, 0x32, 0x04, 0x33, 0x0c,
+    0x52, 0x19, 0x7b, 0x41, 0x52, 0x42, 0x9c, 0x41, 0x00, 0x2c, 0x02, 0xd4,
+    0x00, 0x22, 0x01, 0x30, 0x51, 0x41, 0x40, 0x08, 0xca, 0x07, 0x10, 0x43,
+    0x49, 0x08, 0x02, 0xb0, 0x62, 0x46, 0xd7, 0x07, 0x92, 0x10, 0x08, 0x4b,
+    0xd2, 0x18, 0x08, 0x4b, 0x9a, 0x42, 0x03, 0xd2, 0x12, 0x05, 0x89, 0x18,
+    0xc9, 0x19, 0xba, 0x2d, 0xf0, 0x03, 0x2a, 0x01, 0xdc, 0x39, 0x00, 0xf0,
+    0xbd, 0x01, 0x33, 0x19, 0x05, 0xf5, 0xe7, 0xfd, 0x03, 0x00, 0x00, 0xfe,
+    0x80, 0x06, 0xd0, 0x22, 0x00, 0xb5, 0x20, 0x32, 0x00, 0xf0, 0x10, 0xf8,
+    0x08, 0x00, 0x00, 0xbd, 0x0e, 0x00, 0xf0, 0x05, 0x00, 0xf0, 0x0c, 0xf8,
+    0xca, 0x17, 0x9a, 0x42, 0x00, 0xd1, 0x00, 0xbd, 0xd8, 0x43, 0x01, 0x21,
+    0xc9, 0x07, 0x41, 0x40, 0x1a, 0x00, 0x50, 0x0b, 0x15, 0x0a, 0xd4, 0x10,
+    0x2e, 0x0a, 0xf2, 0x02, 0xf0, 0xa7, 0xf8, 0x14, 0x14, 0x01, 0x34, 0x00,
+    0xda, 0x00, 0x21, 0xcb, 0x17, 0x14, 0x4c, 0x20, 0x47, 0xae, 0x0a, 0xf1,
+    0x18, 0x62, 0x44, 0x34, 0x3a, 0x0c, 0xd4, 0x0c, 0x2a, 0x07, 0xda, 0x04,
+    0x00, 0x91, 0x40, 0x90, 0x40, 0x52, 0x42, 0x20, 0x32, 0xd4, 0x40, 0x21,
+    0x43, 0x10, 0xbd, 0xd8, 0x43, 0xd9, 0x43, 0x10, 0xbd, 0x20, 0x32, 0x07,
+    0xd4, 0x0c, 0x46, 0x94, 0x18, 0x00, 0xf0, 0x01, 0x11, 0x41, 0xd0, 0x40,
+    0x20, 0x43, 0x10, 0xbd, 0x08, 0x00, 0xc9, 0x17, 0x20, 0x32, 0x03, 0xd4,
+    0x14, 0x00, 0xf0, 0x58, 0x10, 0x41, 0x10, 0xbd, 0x18, 0x00, 0x19, 0x00,
+    0x10, 0xbd, 0x37, 0x73, 0x00, 0x10, 0x4a, 0x00, 0x52, 0x0d, 0x14, 0x4b,
+    0xd2, 0x1a, 0x13, 0xdd, 0xff, 0x2a, 0x1e, 0xda, 0xd2, 0x05, 0xcb, 0x0f,
+    0xdb, 0x07, 0x1a, 0x43, 0xc3, 0x00, 0x40, 0x0f, 0x09, 0x03, 0x49, 0x0a,
+    0x08, 0x43, 0x10, 0x43, 0x5b, 0x00, 0x01, 0xd3, 0x01, 0xd0, 0x01, 0x30,
+    0x70, 0x47, 0x43, 0x08, 0xfb, 0xd2, 0x70, 0x47, 0x02, 0xd0, 0xc8, 0x0f,
+    0xc0, 0x07, 0x70, 0x47, 0x0a, 0x03, 0x12, 0x13, 0x01, 0x32, 0xf8, 0xd1,
+    0x42, 0x0f, 0x07, 0x2a, 0xf5, 0xd1, 0x01, 0x22, 0x00, 0xe0, 0xff, 0x22,
+    0xc8, 0x0f, 0x00, 0x02, 0x80, 0x18, 0xc0, 0x05, 0x70, 0x47, 0x80, 0x3c,
+    0x61, 0x20, 0x21, 0x0a, 0x3a, 0x1a, 0x10, 0xe0, 0x08, 0x00, 0x40, 0xc1,
+    0x17, 0x04, 0xe0, 0x78, 0x0b, 0xf1, 0x28, 0x06, 0xe0, 0xc0, 0x46, 0x00,
+    0x22, 0xcb, 0x17, 0x58, 0x40, 0x59, 0x40, 0xc0, 0x1a, 0x99, 0x41, 0x30,
+    0xb5, 0x18, 0x4c, 0xa2, 0x1a, 0x00, 0x29, 0x03, 0xd1, 0x01, 0x00, 0x10,
+    0xd0, 0x00, 0x20, 0x20, 0x3a, 0x4c, 0x15, 0x12, 0xd1, 0x04, 0xd2, 0x01,
+    0x3a, 0x00, 0x18, 0x49, 0x41, 0x4c, 0x0d, 0xfa, 0xd3, 0x11, 0x4c, 0xa2,
+    0x42, 0x04, 0x60, 0x01, 0x90, 0xdb, 0x07, 0xc9, 0x18, 0x30, 0xbd, 0xd2,
+    0x43, 0x52, 0x44, 0x2d, 0x52, 0x21, 0xf5, 0xe7, 0x03, 0xd4, 0x26, 0x00,
+    0xf2, 0x13, 0xfb, 0xd5, 0x0b, 0x32, 0x44, 0x05, 0xc0, 0x0a, 0x4d, 0x05,
+    0x28, 0x43, 0xc9, 0x0a, 0x64, 0x00, 0x03, 0xd0, 0x00, 0x24, 0x60, 0x41,
+    0x61, 0x41, 0xe1, 0xe7, 0xe0, 0xd3, 0x44, 0x08, 0xf8, 0xe7, 0x32, 0x04,
+    0x84, 0x01, 0xb7, 0x0a, 0x0d, 0xcc, 0x0f, 0x53, 0x1e, 0x1b, 0x05, 0xc9,
+    0x1a, 0x52, 0xea, 0x05, 0xf2, 0x02, 0x52, 0x0d, 0x03, 0xd0, 0x53, 0x1c,
+    0xdb, 0x0a, 0x07, 0xd0, 0x12, 0x1b, 0x00, 0x20, 0x64, 0x00, 0x61, 0xea,
+    0x05, 0x70, 0x3a, 0x12, 0x03, 0x01, 0x4b, 0xd2, 0x1a, 0xd8, 0x07, 0x00,
+    0x70, 0x03, 0xf0, 0x21, 0x51, 0x43, 0x43, 0x43, 0xc9, 0x18, 0x8c, 0x46,
+    0x11, 0x0c, 0x83, 0xb2, 0x4b, 0x43, 0x10, 0xb4, 0x04, 0x0c, 0x61, 0x43,
+    0x92, 0xb2, 0x80, 0xb2, 0x50, 0x43, 0x62, 0x43, 0x1c, 0x04, 0x1b, 0x0c,
+    0x00, 0x19, 0x10, 0xbc, 0x59, 0x41, 0x13, 0x04, 0x12, 0x0c, 0xc0, 0x18,
+    0x51, 0x41, 0x61, 0x44, 0x38, 0x00, 0x04, 0x04, 0x11, 0x13, 0x60, 0x04,
+    0x11, 0x04, 0xb4, 0x51, 0x00, 0x10, 0x00, 0x04, 0xb4, 0x51, 0x00, 0x0c,
+    0x00, 0x60, 0x10, 0xb5, 0x02, 0xf0, 0x30, 0xfc, 0xda, 0x13, 0x33, 0x02,
+    0xf0, 0x2c, 0x08, 0x00, 0x08, 0x10, 0x00, 0xf1, 0x06, 0xd0, 0x23, 0x01,
+    0x22, 0x1b, 0x06, 0x19, 0x6d, 0x11, 0x42, 0x01, 0xd0, 0x98, 0x6d, 0x70,
+    0x47, 0x20, 0xbf, 0xf8, 0xe7, 0x03, 0x08, 0x14, 0x60, 0xfe, 0xf7, 0xc1,
+    0xf8, 0xa0, 0x47, 0x22, 0x00, 0x13, 0x02, 0x22, 0x00, 0x60, 0xfc, 0xd0,
+    0x58, 0x65, 0x40, 0xbf, 0x66, 0x56, 0x00, 0x70, 0x0e, 0x00, 0x08, 0x64,
+    0xf0, 0x09, 0x04, 0x00, 0x89, 0xb0, 0x0f, 0x20, 0x17, 0x00, 0x0e, 0x00,
+    0xfd, 0xf7, 0x52, 0xff, 0x00, 0x21, 0x01, 0x90, 0x0f, 0x20, 0xfd, 0xf7,
+    0x69, 0xff, 0x80, 0x11, 0xf1, 0x14, 0x05, 0x97, 0xd0, 0x27, 0x07, 0x94,
+    0x1c, 0x00, 0x02, 0x93, 0x03, 0x93, 0x04, 0x95, 0x06, 0x96, 0x3f, 0x06,
+    0xa3, 0x00, 0x02, 0xaa, 0xd6, 0x58, 0x00, 0x2e, 0x03, 0xd1, 0x3b, 0x6d,
+    0x2b, 0x42, 0x12, 0xd1, 0x40, 0xd4, 0x18, 0xf0, 0x09, 0xcf, 0xff, 0xff,
+    0xf7, 0xbc, 0xff, 0x86, 0x42, 0x08, 0xd1, 0x01, 0x34, 0x05, 0x2c, 0xec,
+    0xd9, 0x0f, 0x20, 0x01, 0x99, 0xfd, 0xf7, 0x47, 0xff, 0xf0, 0x5c, 0xf2,
+    0x25, 0x00, 0x24, 0xe4, 0xe7, 0xbb, 0x6d, 0xe7, 0xe7, 0x00, 0x00, 0x0b,
+    0x00, 0x03, 0x21, 0x8a, 0x43, 0x9a, 0x18, 0x11, 0x00, 0x0c, 0x39, 0x10,
+    0xb5, 0x08, 0x60, 0x10, 0x00, 0x08, 0x38, 0x03, 0x60, 0x04, 0x4b, 0x04,
+    0x3a, 0x13, 0x60, 0x03, 0x4b, 0x04, 0x48, 0x9a, 0x68, 0xff, 0xf7, 0xb7,
+    0xff, 0x10, 0xbd, 0x3f, 0x75, 0x58, 0x14, 0x20, 0x3d, 0x75, 0xfc, 0x33,
+    0x80, 0x06, 0x49, 0x10, 0xb5, 0x99, 0x42, 0x01, 0xd2, 0xc0, 0x6b, 0x00,
+    0xb2, 0x6d, 0x31, 0xff, 0xf7, 0xdb, 0xbe, 0x21, 0xf0, 0x15, 0x04, 0x20,
+    0x00, 0x08, 0x04, 0x20, 0x0b, 0x4a, 0x03, 0x00, 0x00, 0x2a, 0x0b, 0xd0,
+    0x0a, 0x4a, 0x10, 0x78, 0x98, 0x42, 0x05, 0xd9, 0x18, 0x20, 0x09, 0x4a,
+    0x43, 0x43, 0x10, 0x68, 0xc0, 0x18, 0x70, 0x47, 0x1b, 0x1a, 0x9e, 0x1a,
+    0xa0, 0x01, 0x2b, 0xf9, 0xd8, 0x18, 0x30, 0x43, 0x43, 0x04, 0x48, 0x78,
+    0x19, 0x01, 0xdd, 0x0a, 0xb0, 0x1a, 0x00, 0x20, 0xbc, 0x0e, 0x00, 0x20,
+    0xa4, 0x00, 0x01, 0x10, 0xe4, 0x58, 0x20, 0x00, 0x24, 0x90, 0x15, 0xf1,
+    0x0a, 0xda, 0xff, 0x43, 0x68, 0x28, 0x00, 0x98, 0x47, 0x0c, 0x4b, 0x01,
+    0x34, 0x1b, 0x78, 0xe4, 0xb2, 0x01, 0x33, 0xa3, 0x42, 0xf2, 0xda, 0x09,
+    0x4c, 0x53, 0x94, 0x26, 0x00, 0x54, 0x5c, 0x60, 0x10, 0x22, 0xff, 0x21,
+    0xe0, 0x1c, 0x9a, 0x5b, 0xe0, 0x20, 0x00, 0x20, 0x22, 0xff, 0x21, 0x13,
+    0x30, 0xff, 0xf7, 0x25, 0xff, 0x70, 0xbd, 0x50, 0x00, 0x11, 0xd1, 0x4c,
+    0x1a, 0x00, 0x30, 0x59, 0x40, 0x16, 0x00, 0xc8, 0x68, 0x78, 0x5f, 0x10,
+    0x32, 0x98, 0x08, 0x52, 0x21, 0xe3, 0x68, 0x98, 0x47, 0xae, 0x15, 0x20,
+    0xc0, 0x69, 0x66, 0x18, 0x35, 0x72, 0xb6, 0x02, 0x62, 0x1b, 0x20, 0x23,
+    0x62, 0x88, 0x6b, 0x62, 0x3f, 0xfc, 0xe2, 0x69, 0x23, 0x6a, 0xa4, 0x1a,
+    0x20, 0x11, 0x60, 0x3a, 0x18, 0x00, 0xde, 0x00, 0x40, 0x02, 0x4b, 0x58,
+    0x78, 0x1e, 0x15, 0x00, 0x9a, 0x35, 0x00, 0x5c, 0x00, 0x53, 0x02, 0x4b,
+    0x18, 0x78, 0x40, 0xd4, 0x58, 0x00, 0x10, 0x00, 0x41, 0x01, 0x4b, 0x18,
+    0x78, 0x4c, 0x31, 0x10, 0x1b, 0x00, 0x70, 0xf0, 0x11, 0x1c, 0x4e, 0x05,
+    0x00, 0x31, 0x78, 0x00, 0x29, 0x30, 0xd1, 0x53, 0x22, 0x1a, 0x48, 0xff,
+    0xf7, 0xda, 0xfe, 0x19, 0x4c, 0x20, 0x00, 0xfe, 0xf7, 0xec, 0xfc, 0x18,
+    0x4b, 0x1c, 0x60, 0x18, 0x4c, 0xd2, 0x72, 0x40, 0x01, 0xf0, 0xdb, 0xfd,
+    0x70, 0x00, 0xa0, 0x40, 0xfc, 0x15, 0x4b, 0x16, 0x4f, 0x1c, 0x60, 0x16,
+    0x4b, 0x12, 0x17, 0x20, 0x38, 0x00, 0xd0, 0x2d, 0x42, 0x14, 0x4b, 0x18,
+    0x60, 0x06, 0x01, 0xa2, 0x57, 0xff, 0x03, 0x68, 0x98, 0x47, 0x3b, 0x78,
+    0x01, 0x34, 0x02, 0x01, 0x20, 0xf4, 0xda, 0xd8, 0x6d, 0x20, 0x82, 0xff,
+    0x06, 0x00, 0x80, 0x67, 0xff, 0x01, 0x23, 0x33, 0x70, 0x01, 0x20, 0x4c,
+    0x14, 0x00, 0x78, 0x00, 0x00, 0x88, 0x00, 0xd0, 0xcc, 0x12, 0x00, 0x20,
+    0x14, 0x13, 0x00, 0x20, 0x70, 0x05, 0x00, 0x20, 0x18, 0x44, 0x1a, 0x03,
+    0x0c, 0x2e, 0x00, 0x60, 0x01, 0xf0, 0x13, 0x1f, 0xb5, 0x04, 0x00, 0x40,
+    0x78, 0x02, 0x38, 0x03, 0x28, 0x18, 0xd8, 0x19, 0x4b, 0x1a, 0x78, 0x08,
+    0xf0, 0x72, 0xfa, 0x02, 0x1a, 0x0f, 0x17, 0x01, 0x21, 0x8a, 0x43, 0x1a,
+    0x70, 0x1a, 0x78, 0x49, 0x18, 0x08, 0x00, 0xf0, 0x17, 0x00, 0x22, 0x5a,
+    0x70, 0x04, 0x21, 0x1a, 0x78, 0x8a, 0x43, 0x04, 0xe0, 0xd2, 0x07, 0x07,
+    0xd5, 0x04, 0x22, 0x19, 0x78, 0x0a, 0x43, 0x1a, 0x70, 0x21, 0x00, 0x13,
+    0xe0, 0xd2, 0x07, 0xf1, 0xd4, 0x1f, 0xbd, 0x52, 0x07, 0xfc, 0xd5, 0x22,
+    0x00, 0x21, 0x01, 0xa8, 0x30, 0x00, 0xf0, 0x0e, 0x21, 0x0c, 0x22, 0xff,
+    0xf7, 0x69, 0xfe, 0x6a, 0x46, 0x23, 0x78, 0x01, 0xa9, 0x13, 0x71, 0x05,
+    0x23, 0x53, 0x71, 0x03, 0x4b, 0x18, 0x68, 0xff, 0xf7, 0x4c, 0xff, 0xe8,
+    0xe7, 0x94, 0x00, 0x00, 0x88, 0x00, 0x80, 0x7f, 0xb5, 0x06, 0x00, 0x0d,
+    0x00, 0x14, 0x00, 0x2e, 0x00, 0xf0, 0x07, 0x01, 0xa8, 0xff, 0xf7, 0x51,
+    0xfe, 0x6b, 0x46, 0x21, 0x00, 0x01, 0xa8, 0x1e, 0x71, 0x5d, 0x71, 0xff,
+    0xf7, 0xb2, 0xff, 0x7f, 0xbd, 0x1e, 0x14, 0x50, 0x01, 0xac, 0x07, 0x00,
+    0x0e, 0xf4, 0x18, 0x30, 0x21, 0x0c, 0x22, 0xfe, 0x00, 0x40, 0x3e, 0xfe,
+    0x01, 0x23, 0x44, 0x1a, 0x91, 0x27, 0x70, 0x63, 0x70, 0x26, 0x71, 0xff,
+    0xf7, 0x9e, 0xba, 0x22, 0xf0, 0x09, 0x1f, 0xb5, 0x14, 0x00, 0x6b, 0x46,
+    0x00, 0x22, 0xda, 0x80, 0x6b, 0x46, 0x6a, 0x46, 0x18, 0x71, 0x06, 0x23,
+    0x02, 0xa8, 0x53, 0x71, 0x08, 0x22, 0x74, 0x25, 0x00, 0x54, 0x00, 0x00,
+    0xa8, 0x23, 0x20, 0x1f, 0xbd, 0xf6, 0x13, 0x20, 0x03, 0xac, 0x76, 0x00,
+    0x80, 0x00, 0x92, 0x01, 0x93, 0x08, 0x22, 0x0c, 0xab, 0x38, 0x02, 0xf1,
+    0x0f, 0x1f, 0x78, 0xff, 0xf7, 0x13, 0xfe, 0x07, 0x23, 0x63, 0x70, 0x00,
+    0x9b, 0x39, 0x00, 0x05, 0x93, 0x01, 0x9b, 0x20, 0x00, 0x26, 0x70, 0x25,
+    0x71, 0x63, 0x71, 0xff, 0xf7, 0x6f, 0xff, 0xcc, 0x33, 0x60, 0x00, 0x70,
+    0x23, 0x70, 0xb5, 0x8a, 0x5c, 0x71, 0x30, 0x00, 0x1a, 0x42, 0x82, 0x0c,
+    0x80, 0x70, 0xbd, 0x06, 0x4b, 0x20, 0x00, 0x99, 0x78, 0x9c, 0x71, 0x40,
+    0x00, 0x28, 0xf6, 0xd0, 0x48, 0x23, 0x62, 0x01, 0xf0, 0xfe, 0xfe, 0xf2,
+    0xe7, 0xfc, 0x01, 0x11, 0xf7, 0x2c, 0x16, 0xf0, 0x04, 0x1f, 0x00, 0x00,
+    0x25, 0x01, 0x92, 0x01, 0x9b, 0xab, 0x42, 0x01, 0xdc, 0x01, 0x20, 0x03,
+    0xe0, 0x63, 0x78, 0x05, 0x10, 0x30, 0xd2, 0x20, 0xfe, 0xbd, 0xe3, 0x78,
+    0x9b, 0x07, 0x9b, 0x0f, 0xbb, 0x42, 0xf8, 0xd1, 0x94, 0x63, 0xf0, 0x0f,
+    0xcf, 0xff, 0x00, 0x28, 0xf2, 0xd0, 0xa3, 0x78, 0xda, 0x09, 0x01, 0x2a,
+    0x05, 0xd1, 0x09, 0x9a, 0x13, 0x70, 0x23, 0x78, 0x01, 0x35, 0xe4, 0x18,
+    0xe0, 0xe7, 0x08, 0x9a, 0xf8, 0xe7, 0x50, 0x16, 0xf4, 0x21, 0x7f, 0x24,
+    0x0c, 0x40, 0x63, 0x00, 0x15, 0x4c, 0xc9, 0x09, 0xe4, 0x18, 0x64, 0x18,
+    0x30, 0x34, 0xe3, 0x78, 0xdb, 0x07, 0xdd, 0x0f, 0x00, 0x2b, 0x1e, 0xd1,
+    0xe3, 0x78, 0x5b, 0x07, 0xdf, 0x0f, 0x00, 0x2b, 0x15, 0xdb, 0x01, 0x21,
+    0x0e, 0x4e, 0x49, 0x42, 0x30, 0x68, 0x08, 0xf0, 0x7f, 0xf9, 0x20, 0x00,
+    0x11, 0x0c, 0x20, 0x00, 0xc0, 0x04, 0xd4, 0x04, 0x23, 0x01, 0x25, 0xe2,
+    0x78, 0x13, 0x43, 0xe3, 0x70, 0x20, 0x00, 0x20, 0x37, 0xf9, 0xe4, 0x17,
+    0x60, 0x3d, 0x00, 0xf8, 0xe7, 0x00, 0x25, 0x40, 0x59, 0x00, 0xb4, 0x00,
+    0x01, 0x24, 0x02, 0xf1, 0x1b, 0xb5, 0x0d, 0x00, 0x01, 0x21, 0x0f, 0x4c,
+    0x49, 0x42, 0x20, 0x68, 0x08, 0xf0, 0x5c, 0xf9, 0x7f, 0x21, 0x29, 0x40,
+    0x4b, 0x00, 0x0c, 0x49, 0xed, 0x09, 0xc9, 0x18, 0x49, 0x19, 0x30, 0x31,
+    0xcb, 0x78, 0x00, 0x25, 0xdb, 0x07, 0x08, 0xd4, 0xcb, 0x78, 0x5b, 0x5e,
+    0x00, 0xa0, 0x03, 0xda, 0x04, 0x22, 0xcb, 0x78, 0x93, 0x43, 0xcb, 0x70,
+    0x30, 0x00, 0x20, 0x0c, 0xf9, 0x88, 0x19, 0x00, 0x48, 0x00, 0x02, 0x6c,
+    0x03, 0xf0, 0x13, 0x06, 0x00, 0x7f, 0x20, 0x0e, 0x4c, 0x08, 0x40, 0x40,
+    0x00, 0xcd, 0x09, 0x24, 0x18, 0x64, 0x19, 0x30, 0x34, 0xe5, 0x78, 0x00,
+    0x20, 0xed, 0x07, 0x0f, 0xd4, 0x01, 0x25, 0xe0, 0x78, 0x28, 0x43, 0xe0,
+    0x70, 0x44, 0x73, 0x20, 0x77, 0xfe, 0x52, 0x68, 0xf2, 0x01, 0x04, 0x22,
+    0xe3, 0x78, 0xab, 0x43, 0xe3, 0x70, 0xe3, 0x78, 0x93, 0x43, 0xe3, 0x70,
+    0x70, 0xbd, 0x94, 0x00, 0xf1, 0x00, 0x7f, 0x23, 0x10, 0xb5, 0x0b, 0x40,
+    0x0a, 0x4c, 0x5b, 0x00, 0xe4, 0x18, 0xca, 0x09, 0xa4, 0xf8, 0x00, 0xa2,
+    0x9b, 0x07, 0x09, 0xd4, 0x01, 0xf0, 0x6e, 0xfe, 0x02, 0x23, 0xd0, 0x00,
+    0x13, 0x01, 0x08, 0x00, 0x00, 0x98, 0x16, 0x0f, 0x34, 0x00, 0x08, 0x11,
+    0xd5, 0x34, 0x00, 0x12, 0x22, 0x60, 0x00, 0x40, 0xe3, 0x78, 0x01, 0x3a,
+    0x08, 0x00, 0x05, 0x34, 0x00, 0xf2, 0x02, 0x22, 0xcb, 0x09, 0x0a, 0x40,
+    0x04, 0x49, 0x52, 0x00, 0x89, 0x18, 0xc9, 0x18, 0x30, 0x31, 0xc8, 0x78,
+    0x9e, 0x5c, 0x00, 0x1c, 0x00, 0x00, 0x80, 0x70, 0x30, 0x00, 0xf0, 0x79,
+    0x74, 0x61, 0x83, 0xd1, 0x95, 0xe2, 0xbf, 0x4b, 0x1d, 0x68, 0xe9, 0x28,
+    0x04, 0x06, 0x8a, 0x1f, 0x42, 0x07, 0xac, 0x2b, 0x62, 0x04, 0x02, 0x59,
+    0xf5, 0xf9, 0xea, 0x69, 0x2b, 0x2c, 0x04, 0xf0, 0x25, 0x88, 0x42, 0x00,
+    0xd1, 0x79, 0xe2, 0x60, 0x78, 0x01, 0x38, 0x07, 0x28, 0xdf, 0xd8, 0x08,
+    0xf0, 0x91, 0xf8, 0x08, 0x00, 0x11, 0x00, 0x6b, 0x02, 0x40, 0x02, 0x4f,
+    0x02, 0x1c, 0x00, 0x19, 0x02, 0x6d, 0x02, 0x20, 0x78, 0xff, 0xf7, 0x8c,
+    0xfd, 0x00, 0xf0, 0xe8, 0xfa, 0x22, 0x79, 0xa8, 0x4b, 0x9a, 0x70, 0xcc,
+    0xe7, 0x12, 0x00, 0xb1, 0x83, 0xfd, 0x00, 0xf0, 0xdf, 0xfa, 0xa5, 0x4b,
+    0x00, 0x2b, 0xc4, 0x44, 0x32, 0xf1, 0x0a, 0xc1, 0xe7, 0x01, 0x20, 0xa0,
+    0x4d, 0x04, 0x21, 0x2b, 0x78, 0x27, 0x78, 0x03, 0x43, 0x2b, 0x70, 0x2b,
+    0x00, 0x33, 0x33, 0x1a, 0x78, 0x60, 0x26, 0x82, 0xaa, 0x03, 0x00, 0x78,
+    0x03, 0x62, 0x2b, 0x00, 0x34, 0x33, 0x1a, 0x78, 0x10, 0x00, 0x21, 0x00,
+    0x20, 0x8a, 0x03, 0xf0, 0x0e, 0xf0, 0xc8, 0xfa, 0x23, 0x79, 0x1a, 0x00,
+    0x32, 0x40, 0x00, 0x92, 0xb2, 0x42, 0x27, 0xd0, 0x40, 0x2a, 0x0c, 0xd1,
+    0x91, 0x48, 0x00, 0x28, 0x22, 0xd0, 0x00, 0xf0, 0xbb, 0xfa, 0x04, 0x34,
+    0x21, 0x08, 0xaa, 0x2e, 0x32, 0xb0, 0x28, 0x92, 0xd1, 0x18, 0xe0, 0xdb,
+    0x06, 0xdb, 0x0e, 0x01, 0x93, 0xe8, 0x6b, 0xf0, 0x1d, 0x53, 0xe1, 0x02,
+    0x2b, 0x00, 0xd1, 0x78, 0xe1, 0x00, 0x2b, 0x0d, 0xd1, 0x00, 0x9b, 0x20,
+    0x2b, 0x14, 0xd1, 0x23, 0x7a, 0x0f, 0x2b, 0x07, 0xd8, 0xeb, 0x18, 0xd8,
+    0x78, 0xff, 0xf7, 0x16, 0xfd, 0x08, 0xaa, 0x01, 0x1e, 0x00, 0xd0, 0x7f,
+    0xe1, 0x07, 0xac, 0x20, 0x78, 0x6c, 0x1f, 0xc0, 0xa7, 0xfd, 0x80, 0x21,
+    0x20, 0x78, 0x01, 0xf0, 0xa3, 0xfd, 0x6e, 0xe7, 0x7e, 0x77, 0xf0, 0x43,
+    0xf2, 0xd1, 0x60, 0x79, 0x09, 0x28, 0xef, 0xd8, 0x08, 0xf0, 0x42, 0xf8,
+    0x1f, 0x01, 0x17, 0x01, 0xee, 0xff, 0x0e, 0x01, 0xee, 0xff, 0x0a, 0x00,
+    0xb1, 0x00, 0xee, 0xff, 0x16, 0x00, 0x1c, 0x00, 0x08, 0xa8, 0x00, 0xf0,
+    0x81, 0xfa, 0x38, 0x00, 0xa1, 0x79, 0x01, 0xf0, 0x13, 0xfd, 0x02, 0x23,
+    0x2a, 0x78, 0x13, 0x43, 0x2b, 0x70, 0x50, 0xe7, 0x06, 0xaa, 0x6b, 0x78,
+    0x02, 0x32, 0x13, 0x70, 0x01, 0x23, 0x0d, 0xe1, 0xa3, 0x79, 0x00, 0x93,
+    0x6b, 0x78, 0x00, 0x9a, 0x9a, 0x42, 0x35, 0xd0, 0x6b, 0x78, 0xe6, 0x15,
+    0x00, 0xb2, 0x34, 0xc0, 0x5c, 0xfd, 0xac, 0x78, 0x38, 0x00, 0xff, 0xf7,
+    0xf4, 0xfc, 0xac, 0x70, 0x6a, 0x00, 0xf0, 0x23, 0x27, 0xd0, 0x58, 0x1e,
+    0xc0, 0xb2, 0xfd, 0xf7, 0x78, 0xf9, 0x00, 0x28, 0xb7, 0xd0, 0x43, 0x78,
+    0x03, 0x93, 0x02, 0x2b, 0xb3, 0xd1, 0x01, 0x21, 0x04, 0x00, 0xc2, 0x79,
+    0x09, 0x34, 0x93, 0x11, 0x52, 0x11, 0x0b, 0x40, 0x0a, 0x40, 0x12, 0x01,
+    0x5b, 0x01, 0x13, 0x43, 0x2a, 0x78, 0x2f, 0x31, 0x8a, 0x43, 0x6a, 0x00,
+    0x40, 0xc3, 0x78, 0x82, 0x78, 0xd4, 0x2f, 0xb5, 0xc3, 0x18, 0x04, 0x93,
+    0x04, 0x9b, 0xa3, 0x42, 0x0c, 0xd8, 0x4d, 0x64, 0x34, 0xf0, 0x08, 0x47,
+    0x4b, 0x00, 0x9a, 0x5a, 0x70, 0x38, 0x00, 0x08, 0xa9, 0x00, 0xf0, 0xe3,
+    0xf9, 0x06, 0xe7, 0x01, 0x22, 0x63, 0x78, 0x01, 0x92, 0x0b, 0x1c, 0x6a,
+    0xf0, 0x14, 0x78, 0x01, 0x93, 0x23, 0x78, 0xe4, 0x18, 0x63, 0x78, 0x04,
+    0x2b, 0x81, 0xd1, 0x00, 0x26, 0x04, 0x9b, 0x1b, 0x1b, 0x9b, 0xb2, 0x05,
+    0x93, 0x3f, 0x4b, 0x1b, 0x78, 0x01, 0x33, 0xb3, 0x42, 0x00, 0xda, 0x76,
+    0xe7, 0xce, 0x03, 0x41, 0x86, 0xfc, 0x05, 0x00, 0xfe, 0x64, 0xf0, 0x26,
+    0x9a, 0xab, 0x68, 0x98, 0x47, 0x02, 0x90, 0x08, 0x28, 0x2a, 0xd9, 0x05,
+    0x9b, 0x83, 0x42, 0x27, 0xd3, 0x01, 0x9b, 0x01, 0x2b, 0x05, 0xd1, 0x34,
+    0x4b, 0xaa, 0x68, 0x9a, 0x42, 0x01, 0xd1, 0x03, 0x9b, 0x01, 0x93, 0x00,
+    0x22, 0x2b, 0x48, 0x01, 0x9b, 0x9a, 0x42, 0x0d, 0xd1, 0x33, 0x00, 0x21,
+    0x00, 0x02, 0x9a, 0x13, 0x30, 0x8c, 0x36, 0x51, 0x02, 0x9b, 0xe4, 0x18,
+    0x29, 0x56, 0x00, 0x80, 0x9e, 0x42, 0xae, 0xdd, 0x4b, 0xe7, 0xa3, 0x78,
+    0x8e, 0x2d, 0xf1, 0x28, 0xc3, 0x18, 0xd9, 0x78, 0xff, 0x29, 0x00, 0xd0,
+    0x43, 0xe7, 0x01, 0x32, 0xde, 0x70, 0xd2, 0xb2, 0xe2, 0xe7, 0x01, 0x36,
+    0xf6, 0xb2, 0xbf, 0xe7, 0xe3, 0x88, 0x1a, 0x0a, 0x50, 0x1e, 0xdb, 0xb2,
+    0x0e, 0x28, 0x00, 0xd9, 0x35, 0xe7, 0x07, 0xf0, 0x88, 0xff, 0x0f, 0x00,
+    0x24, 0x00, 0x44, 0x00, 0x34, 0xff, 0x34, 0xff, 0x4d, 0x00, 0x24, 0x08,
+    0x00, 0x06, 0x02, 0x00, 0xa2, 0x18, 0x00, 0xfc, 0xf7, 0x5d, 0xff, 0x12,
+    0x23, 0x02, 0x00, 0xe4, 0x00, 0x51, 0x83, 0xf9, 0xff, 0xe6, 0x10, 0xea,
+    0x2c, 0x10, 0x17, 0x80, 0x5c, 0x70, 0xbf, 0x02, 0x00, 0xd3, 0x78, 0x91,
+    0x78, 0x0a, 0x31, 0xf0, 0x03, 0xee, 0xe7, 0x02, 0x2a, 0x15, 0xd1, 0x18,
+    0x00, 0xfd, 0xf7, 0xc9, 0xf8, 0x02, 0x1e, 0xf3, 0xd1, 0x07, 0xe7, 0xb8,
+    0x05, 0x00, 0x14, 0x03, 0x08, 0x58, 0x2b, 0x00, 0x50, 0x06, 0x22, 0x3d,
+    0x84, 0x6c, 0x2b, 0x20, 0x84, 0x4a, 0xe4, 0x25, 0x31, 0xf3, 0xe6, 0x18,
+    0xb4, 0x06, 0xf1, 0x06, 0xe4, 0xe7, 0x18, 0x00, 0x21, 0x89, 0xfd, 0xf7,
+    0x46, 0xfa, 0x02, 0x1e, 0x00, 0xd1, 0xe8, 0xe6, 0x03, 0x78, 0xc5, 0xe7,
+    0x7d, 0x6a, 0x00, 0x20, 0xe2, 0xe6, 0x20, 0x00, 0xe0, 0xf3, 0xe7, 0xe3,
+    0x88, 0x01, 0x2b, 0x00, 0xd0, 0xdb, 0xe6, 0x2a, 0x78, 0x07, 0x33, 0x98,
+    0x01, 0x13, 0x43, 0x12, 0x00, 0xf2, 0x11, 0xd2, 0xe6, 0x08, 0x22, 0x2b,
+    0x78, 0x93, 0x43, 0xf5, 0xe7, 0x01, 0x21, 0x2b, 0x78, 0x06, 0xaa, 0x58,
+    0x09, 0x08, 0x40, 0x99, 0x08, 0x02, 0x23, 0x19, 0x40, 0x02, 0x32, 0x01,
+    0x43, 0x11, 0x80, 0xba, 0x00, 0x40, 0x26, 0xf9, 0x37, 0xe6, 0x98, 0x02,
+    0x42, 0x00, 0xd9, 0xba, 0xe6, 0x9a, 0x02, 0x80, 0xc9, 0xfb, 0x01, 0x1e,
+    0x00, 0xd1, 0xb3, 0xe6, 0xd8, 0x02, 0x40, 0xff, 0xf7, 0x08, 0xfc, 0xca,
+    0x17, 0xf0, 0x09, 0x25, 0xe6, 0x23, 0x79, 0x1d, 0x00, 0x35, 0x40, 0x33,
+    0x42, 0x00, 0xd0, 0xa6, 0xe6, 0x63, 0x79, 0x0a, 0x3b, 0x01, 0x2b, 0x00,
+    0xd9, 0xa1, 0xe6, 0x94, 0x10, 0xf1, 0x23, 0x39, 0xf9, 0x63, 0x79, 0x0a,
+    0x2b, 0x00, 0xd0, 0x07, 0xe7, 0x06, 0xab, 0x9a, 0x1c, 0x15, 0x70, 0xc2,
+    0xe6, 0x70, 0x23, 0x26, 0x7a, 0x1e, 0x42, 0x00, 0xd0, 0x91, 0xe6, 0x0f,
+    0x33, 0x33, 0x40, 0x5b, 0x00, 0xf2, 0x09, 0xeb, 0x18, 0x9b, 0x18, 0xd8,
+    0x7c, 0xff, 0xf7, 0x9b, 0xfb, 0x00, 0x9b, 0x02, 0x90, 0xf2, 0x24, 0x90,
+    0x28, 0x00, 0xd1, 0x81, 0xe6, 0x01, 0x00, 0x08, 0xaa, 0x8a, 0x02, 0xf0,
+    0x01, 0xd5, 0xfb, 0x5f, 0xe6, 0x63, 0x79, 0x01, 0x99, 0x1a, 0x00, 0x8a,
+    0x43, 0x01, 0x2a, 0x0b, 0xd0, 0x84, 0x16, 0x40, 0x72, 0xe6, 0x31, 0x00,
+    0x1c, 0x00, 0x20, 0xd3, 0xfd, 0x58, 0x00, 0x80, 0x10, 0x80, 0x01, 0x9b,
+    0xa5, 0xe7, 0xe2, 0x88, 0x30, 0x23, 0x00, 0x18, 0x00, 0x00, 0xc2, 0x7a,
+    0x50, 0xff, 0xf7, 0xab, 0xfd, 0x02, 0x96, 0x26, 0x43, 0xd1, 0xd5, 0xe5,
+    0x19, 0x4a, 0x00, 0x40, 0xb0, 0xfb, 0x34, 0x35, 0x3c, 0x29, 0xf0, 0x23,
+    0xee, 0xf8, 0x2b, 0x78, 0xdb, 0x07, 0x00, 0xd5, 0xc8, 0xe5, 0xbb, 0xe6,
+    0xff, 0xf7, 0x7d, 0xfd, 0xea, 0xe7, 0x7f, 0x20, 0x25, 0x79, 0x2f, 0x4b,
+    0x28, 0x40, 0x41, 0x00, 0xea, 0x09, 0x5b, 0x18, 0x9b, 0x18, 0x1a, 0x00,
+    0x01, 0x26, 0x30, 0x32, 0xd1, 0x78, 0xb1, 0x43, 0xd1, 0x70, 0xd1, 0x78,
+    0x03, 0x36, 0x08, 0x00, 0x00, 0x46, 0x05, 0xe0, 0x29, 0x00, 0x62, 0x79,
+    0x20, 0x78, 0xa3, 0x68, 0x00, 0xf0, 0xe0, 0xf8, 0xa9, 0xe5, 0xb6, 0x00,
+    0x84, 0x40, 0xfb, 0x03, 0x1e, 0x3a, 0xd0, 0x1e, 0x69, 0x1a, 0x00, 0xf1,
+    0x00, 0xb0, 0x47, 0x9d, 0xe5, 0x1d, 0x4b, 0x1a, 0x78, 0xd2, 0x07, 0x00,
+    0xd4, 0x98, 0xe5, 0x1b, 0xb0, 0x01, 0x80, 0x94, 0xe5, 0x18, 0x78, 0x00,
+    0x07, 0xc0, 0x0f, 0x94, 0x01, 0x50, 0x8e, 0xe5, 0x15, 0x4b, 0x1b, 0x7e,
+    0x00, 0x41, 0xd4, 0x89, 0xe5, 0x15, 0xac, 0x01, 0x20, 0x85, 0xe5, 0x18,
+    0x00, 0x20, 0x82, 0xe5, 0xe4, 0x2a, 0x40, 0x19, 0xfb, 0x43, 0x69, 0x28,
+    0x03, 0x91, 0x20, 0x78, 0x98, 0x47, 0x01, 0x35, 0xed, 0xb2, 0x0d, 0xa4,
+    0x02, 0xa0, 0xab, 0x42, 0xf0, 0xda, 0x72, 0xe5, 0x00, 0x25, 0xf7, 0xe7,
+    0xbc, 0x25, 0xa0, 0x00, 0xd1, 0x6c, 0xe5, 0xa0, 0x68, 0x98, 0x47, 0x69,
+    0xe5, 0x92, 0x74, 0x02, 0xd0, 0x09, 0x00, 0x01, 0x00, 0x08, 0x38, 0x02,
+    0x00, 0x34, 0x02, 0xf0, 0x19, 0x70, 0xb5, 0x13, 0x4b, 0x06, 0x00, 0xd9,
+    0x89, 0x98, 0x89, 0x42, 0x1a, 0x15, 0x1c, 0x92, 0xb2, 0x40, 0x2a, 0x00,
+    0xd9, 0x40, 0x25, 0x1a, 0x78, 0xad, 0xb2, 0x7f, 0x2a, 0x0e, 0xd9, 0x88,
+    0x42, 0x11, 0xd0, 0x0c, 0x4c, 0x2a, 0x00, 0x99, 0x68, 0xf6, 0x07, 0x40,
+    0x49, 0xfa, 0x80, 0x21, 0x7c, 0x24, 0x00, 0x5e, 0x03, 0x80, 0xd3, 0xfc,
+    0x70, 0xbd, 0x88, 0x42, 0x04, 0xd1, 0xde, 0x37, 0xf0, 0x09, 0xf5, 0xe7,
+    0x80, 0x21, 0xfb, 0xe7, 0x00, 0x21, 0x01, 0x4a, 0xf0, 0xe7, 0x98, 0x11,
+    0x00, 0x20, 0xd4, 0x12, 0x00, 0x20, 0x49, 0xb2, 0xc9, 0x43, 0xda, 0x65,
+    0xa0, 0xc9, 0x0f, 0x1a, 0x00, 0xc9, 0x01, 0xff, 0xf7, 0xbb, 0xfc, 0xc2,
+    0x20, 0x62, 0x07, 0x4e, 0x05, 0x00, 0x08, 0x22, 0xf8, 0x23, 0xc0, 0x22,
+    0xfa, 0x00, 0x23, 0x28, 0x00, 0xf3, 0x60, 0x21, 0x78, 0xb3, 0x60, 0x2c,
+    0x3a, 0x20, 0x70, 0xbd, 0x3c, 0x00, 0xb0, 0xf7, 0xb5, 0x13, 0x4f, 0x15,
+    0x00, 0x06, 0x00, 0x08, 0x22, 0x38, 0x54, 0x63, 0xf0, 0x14, 0x93, 0xff,
+    0xf7, 0x0e, 0xfa, 0x00, 0x23, 0xbd, 0x60, 0xfb, 0x81, 0xe3, 0x79, 0xa2,
+    0x79, 0x1b, 0x02, 0x01, 0x99, 0x13, 0x43, 0x1a, 0x1c, 0x8b, 0x42, 0x01,
+    0xd9, 0x6a, 0x46, 0x92, 0x88, 0x91, 0xb2, 0xba, 0x81, 0x94, 0x04, 0x60,
+    0x00, 0x29, 0x01, 0xd0, 0x28, 0x1e, 0x3c, 0x39, 0x40, 0xff, 0xf7, 0x96,
+    0xff, 0xa0, 0x67, 0x20, 0x21, 0x78, 0xa8, 0x5b, 0x11, 0xf9, 0x90, 0x00,
+    0xb1, 0x10, 0xb5, 0x14, 0x22, 0x00, 0x21, 0x02, 0x48, 0xff, 0xf7, 0xe2,
+    0xac, 0x23, 0x00, 0x14, 0x00, 0x40, 0x01, 0x4b, 0x18, 0x61, 0x18, 0x0a,
+    0x02, 0x20, 0x00, 0x51, 0x05, 0x4c, 0x01, 0x00, 0x08, 0xda, 0x08, 0x84,
+    0xd7, 0xf9, 0x00, 0x23, 0xa3, 0x60, 0xe3, 0x60, 0x28, 0x00, 0xf0, 0x0b,
+    0x70, 0xb5, 0x25, 0x4c, 0x1e, 0x00, 0x23, 0x78, 0x05, 0x00, 0xda, 0x09,
+    0xc9, 0x09, 0x8a, 0x42, 0x13, 0xd0, 0x00, 0x20, 0x86, 0x42, 0x2c, 0xd1,
+    0x20, 0x4b, 0xdc, 0x3f, 0x02, 0x6e, 0x06, 0xa0, 0xb9, 0xfa, 0x23, 0x69,
+    0x01, 0x20, 0x00, 0x2b, 0x21, 0xd0, 0x0a, 0x1d, 0x00, 0x1c, 0x0b, 0x60,
+    0x01, 0x20, 0x1b, 0xe0, 0x7f, 0x2b, 0xde, 0x75, 0xf0, 0x15, 0x18, 0x1e,
+    0x16, 0xd0, 0x32, 0x00, 0x16, 0x49, 0xff, 0xf7, 0xaa, 0xf9, 0xa2, 0x68,
+    0xe3, 0x89, 0x92, 0x19, 0x9b, 0x19, 0xa2, 0x60, 0xe2, 0x88, 0x9b, 0xb2,
+    0xe3, 0x81, 0x9a, 0x42, 0x01, 0xd0, 0x3f, 0x2e, 0x15, 0xd8, 0xc2, 0x27,
+    0x31, 0x04, 0xd1, 0x28, 0xb4, 0x00, 0x81, 0x63, 0xff, 0x70, 0xbd, 0x01,
+    0x21, 0x22, 0x00, 0x46, 0x00, 0x10, 0x1e, 0xe8, 0x1c, 0x40, 0x01, 0xf0,
+    0xbb, 0xfa, 0xc2, 0x37, 0x60, 0x01, 0xf0, 0xb7, 0xfa, 0xd2, 0xe7, 0x00,
+    0x02, 0x31, 0x25, 0xff, 0xec, 0xd8, 0x00, 0x40, 0xf5, 0x96, 0x00, 0x10,
+    0x6c, 0x01, 0x00, 0x50, 0x0b, 0x31, 0x10, 0x35, 0x04, 0xe0, 0x13, 0xf0,
+    0x03, 0x6a, 0xfe, 0x3f, 0x28, 0x12, 0xd9, 0x00, 0x20, 0xe1, 0x78, 0xff,
+    0xf7, 0xa7, 0xfb, 0x00, 0x28, 0x0c, 0xd0, 0x16, 0x00, 0xf0, 0x07, 0x5f,
+    0xfe, 0xe1, 0x78, 0x3f, 0x28, 0x07, 0xd9, 0x96, 0x23, 0x9b, 0x00, 0xe2,
+    0x18, 0x00, 0x20, 0x40, 0x23, 0xff, 0xf7, 0xf2, 0xfb, 0x8e, 0x5d, 0x51,
+    0xff, 0xf7, 0xc8, 0xfb, 0xfa, 0xb0, 0x60, 0x00, 0x0e, 0x21, 0x21, 0x58,
+    0xfa, 0x62, 0x1a, 0xf0, 0x1a, 0x20, 0x10, 0xbd, 0xff, 0xf7, 0x5a, 0xfa,
+    0x00, 0x28, 0xf9, 0xd1, 0xb6, 0x20, 0x01, 0x23, 0x80, 0x00, 0x44, 0x43,
+    0x02, 0x48, 0x00, 0x19, 0x00, 0x79, 0x18, 0x40, 0xf1, 0xe7, 0xc0, 0x46,
+    0xc0, 0x0e, 0x00, 0x20, 0xb6, 0x23, 0x9b, 0x00, 0x58, 0x43, 0x20, 0x36,
+    0x70, 0x10, 0x30, 0xc0, 0x18, 0x00, 0xf0, 0x16, 0xec, 0x3c, 0x00, 0x24,
+    0x3d, 0xf0, 0x0a, 0xb5, 0xb6, 0x24, 0xa4, 0x00, 0x44, 0x43, 0x20, 0x00,
+    0x06, 0x4e, 0x10, 0x30, 0x92, 0xb2, 0x80, 0x19, 0x00, 0xf0, 0x49, 0xfe,
+    0x05, 0x00, 0xa0, 0x19, 0x24, 0x2a, 0x00, 0x9a, 0x08, 0x0f, 0x40, 0x00,
+    0x03, 0x13, 0x3c, 0x40, 0x00, 0x00, 0x10, 0x25, 0x33, 0xff, 0xf7, 0x14,
+    0x88, 0x00, 0x80, 0xfe, 0xbd, 0xff, 0xf7, 0x16, 0xfa, 0x05, 0x1e, 0x88,
+    0x00, 0x00, 0x86, 0x00, 0x80, 0x26, 0x00, 0x14, 0x4f, 0x2c, 0x36, 0xf6,
+    0x19, 0xb2, 0x6b, 0x90, 0xdd, 0xfd, 0x00, 0x28, 0xed, 0xd0, 0x3b, 0x19,
+    0x28, 0x02, 0x0a, 0xb0, 0x93, 0xff, 0xf7, 0x30, 0xfb, 0x00, 0x28, 0xe5,
+    0xd0, 0xa6, 0x23, 0x48, 0x38, 0x60, 0xe7, 0x19, 0x39, 0x00, 0x40, 0x22,
+    0x26, 0x00, 0xf1, 0x00, 0x0b, 0xfe, 0x01, 0x9b, 0x04, 0x00, 0x99, 0x78,
+    0x00, 0x28, 0x08, 0xd0, 0x03, 0x00, 0x3a, 0xd4, 0x68, 0xf8, 0x01, 0x75,
+    0xfb, 0x00, 0x28, 0xd0, 0xd0, 0x20, 0x00, 0xcf, 0xe7, 0xff, 0xf7, 0x49,
+    0xfb, 0xfa, 0xe7, 0xb8, 0x00, 0xa0, 0x09, 0x4b, 0x2c, 0x34, 0xe4, 0x18,
+    0x05, 0x00, 0x92, 0xb2, 0xda, 0x2b, 0x20, 0x35, 0xfe, 0xbb, 0x15, 0x80,
+    0x00, 0xf0, 0xa7, 0xfd, 0x3f, 0x28, 0x02, 0xd9, 0x3c, 0x00, 0x20, 0xaf,
+    0xff, 0xf8, 0x64, 0x0c, 0xc4, 0x00, 0x11, 0x2c, 0xc4, 0x00, 0x24, 0xac,
+    0xfd, 0xc4, 0x00, 0x31, 0xb6, 0x22, 0x15, 0x5a, 0x37, 0xf0, 0x37, 0x92,
+    0x00, 0xff, 0xf7, 0xa8, 0xf8, 0xff, 0x23, 0x63, 0x71, 0x12, 0x4b, 0x80,
+    0x27, 0x00, 0x26, 0x01, 0x25, 0xe3, 0x80, 0x08, 0x23, 0x7f, 0x00, 0x3a,
+    0x00, 0x25, 0x81, 0x23, 0x73, 0x0e, 0x49, 0x2b, 0x00, 0x00, 0x96, 0x0e,
+    0x48, 0x00, 0xf0, 0x4e, 0xfd, 0x2b, 0x00, 0x3a, 0x00, 0x0c, 0x49, 0x00,
+    0x95, 0x0c, 0x48, 0x00, 0xf0, 0x47, 0xfd, 0x0c, 0x4d, 0x28, 0x00, 0xfd,
+    0xf7, 0xa1, 0xfe, 0xa5, 0x62, 0x0a, 0x4d, 0x66, 0x62, 0x0c, 0x00, 0x71,
+    0x9b, 0xfe, 0x25, 0x64, 0x66, 0x64, 0xf7, 0x60, 0x00, 0xf0, 0x02, 0x00,
+    0xc2, 0xff, 0xff, 0x08, 0x0f, 0x00, 0x20, 0xd0, 0x0e, 0x00, 0x20, 0x08,
+    0x10, 0x00, 0x20, 0xec, 0x08, 0x00, 0x00, 0xc8, 0x02, 0x02, 0xcc, 0x02,
+    0x90, 0x22, 0x00, 0x21, 0x07, 0x48, 0xff, 0xf7, 0x6c, 0xf8, 0xe4, 0x20,
+    0x40, 0xdd, 0xfd, 0x06, 0x4c, 0xc2, 0x00, 0x20, 0xd9, 0xfd, 0x8c, 0x23,
+    0x33, 0x00, 0xf0, 0xef, 0xa4, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x38, 0x00,
+    0x50, 0xf0, 0xb5, 0x4b, 0x79, 0x07, 0xd6, 0x40, 0x21, 0x2b, 0x03, 0xe6,
+    0x6e, 0x00, 0xc8, 0x0b, 0x90, 0x8b, 0x79, 0x02, 0x2b, 0xf8, 0xd1, 0x1f,
+    0x4e, 0xb3, 0x22, 0x60, 0xf0, 0x04, 0xd1, 0x8b, 0x78, 0x09, 0x25, 0x33,
+    0x70, 0x0c, 0x78, 0x0c, 0x19, 0x03, 0xe0, 0x23, 0x78, 0xed, 0x18, 0xad,
+    0xb2, 0x7c, 0x07, 0x80, 0x24, 0x2b, 0x1d, 0xd1, 0x95, 0x42, 0xf6, 0xd9,
+    0x86, 0x07, 0x20, 0x14, 0xd1, 0xc0, 0x05, 0xf0, 0x05, 0x11, 0xd1, 0x23,
+    0x78, 0x38, 0x00, 0x03, 0x93, 0xe1, 0x18, 0x11, 0x4b, 0x01, 0x93, 0x11,
+    0x4b, 0x00, 0x93, 0x02, 0x23, 0x42, 0x6c, 0xa0, 0x3c, 0xfa, 0x00, 0x28,
+    0xd1, 0xd0, 0x03, 0x9b, 0x0e, 0x35, 0x3c, 0x00, 0x00, 0xa2, 0x03, 0x70,
+    0xa7, 0xfe, 0xca, 0xe7, 0x05, 0x2b, 0xe1, 0x18, 0x2c, 0x03, 0xec, 0x01,
+    0x64, 0xc1, 0xd0, 0xa3, 0x78, 0x73, 0x70, 0x5e, 0x00, 0x13, 0xd4, 0x64,
+    0x02, 0x50, 0xc2, 0x0e, 0x00, 0x20, 0xc3, 0x7c, 0x42, 0xf0, 0x50, 0xb5,
+    0x05, 0x00, 0x60, 0x20, 0x0b, 0x00, 0x11, 0x00, 0x12, 0x78, 0x00, 0x24,
+    0x02, 0x40, 0x20, 0x2a, 0x43, 0xd1, 0x2a, 0x4f, 0x4a, 0x79, 0x0e, 0x79,
+    0x38, 0x78, 0x12, 0x02, 0x32, 0x43, 0x90, 0x42, 0x3b, 0xd1, 0x48, 0x78,
+    0x20, 0x38, 0x03, 0x28, 0x37, 0xd8, 0x07, 0xf0, 0xd4, 0xfb, 0x02, 0x15,
+    0x18, 0x38, 0x00, 0x2b, 0x06, 0xd1, 0x07, 0x23, 0x28, 0x00, 0x21, 0x4a,
+    0xff, 0xf7, 0xd5, 0xfd, 0x01, 0x24, 0x2a, 0xe0, 0x02, 0x2b, 0xfb, 0xd1,
+    0x1f, 0x4b, 0x00, 0x2b, 0xf8, 0xd0, 0x00, 0x20, 0x1c, 0x49, 0xfc, 0xf7,
+    0x22, 0xf8, 0xf3, 0xe7, 0x00, 0x2b, 0xf1, 0xd1, 0xeb, 0xe7, 0xa4, 0x2c,
+    0x01, 0xdc, 0x01, 0xf1, 0x24, 0xfd, 0xea, 0xe7, 0x02, 0x2b, 0xe8, 0xd1,
+    0x01, 0x24, 0xcd, 0x78, 0x8a, 0x78, 0x21, 0x00, 0x2d, 0x02, 0x15, 0x43,
+    0x2e, 0x00, 0x13, 0x48, 0x3d, 0x71, 0xa9, 0x43, 0x00, 0xf0, 0x52, 0xfd,
+    0x11, 0x4b, 0x26, 0x40, 0x00, 0x2b, 0xd8, 0xd0, 0x6a, 0x08, 0x31, 0x00,
+    0x00, 0x20, 0x22, 0x40, 0xfb, 0xf7, 0xf8, 0xff, 0xa6, 0x7b, 0xf0, 0x06,
+    0x2b, 0xdf, 0xd0, 0x02, 0x2b, 0xcc, 0xd1, 0x0a, 0x4b, 0x00, 0x2b, 0xc9,
+    0xd0, 0x8b, 0x78, 0xc9, 0x78, 0x00, 0x20, 0x09, 0x02, 0x3c, 0x16, 0x00,
+    0x30, 0x0a, 0x02, 0xcc, 0x00, 0x80, 0xc6, 0x0e, 0x00, 0x20, 0x7d, 0x45,
+    0x00, 0x10, 0x74, 0x01, 0x13, 0x6d, 0x14, 0x33, 0xf1, 0x06, 0xf7, 0xb5,
+    0x31, 0x4c, 0x01, 0x90, 0x00, 0x91, 0x1d, 0x00, 0xe3, 0x78, 0x8b, 0x42,
+    0x05, 0xd0, 0xa3, 0x78, 0x8b, 0x42, 0x11, 0x86, 0x01, 0xa0, 0xfe, 0xbd,
+    0x2b, 0x4f, 0x2c, 0x49, 0x38, 0x00, 0xaa, 0xb2, 0xf2, 0x6d, 0x20, 0x2a,
+    0x4b, 0xd8, 0x3e, 0x00, 0x06, 0x00, 0x11, 0x1d, 0x18, 0x68, 0xf1, 0x14,
+    0x07, 0xfe, 0xa3, 0x78, 0x00, 0x9a, 0x93, 0x42, 0x1e, 0xd0, 0x01, 0x25,
+    0xe8, 0xe7, 0x63, 0x79, 0x00, 0x26, 0xff, 0x2b, 0xef, 0xd0, 0xae, 0x42,
+    0xed, 0xd0, 0x1f, 0x4b, 0x62, 0x79, 0x9b, 0x5d, 0x9a, 0x42, 0x07, 0x68,
+    0x2a, 0x81, 0x5c, 0xfc, 0x00, 0x28, 0x02, 0xd1, 0x61, 0x79, 0x2e, 0x44,
+    0x30, 0x36, 0xee, 0xe7, 0x14, 0x00, 0x60, 0x52, 0xfc, 0x00, 0x28, 0xdc,
+    0xd1, 0x12, 0x00, 0x20, 0xd9, 0xe7, 0xda, 0x0e, 0x10, 0x02, 0xc0, 0x14,
+    0x01, 0xaa, 0x3c, 0x90, 0xff, 0xf7, 0x41, 0xfe, 0x00, 0x28, 0xd5, 0xd1,
+    0x12, 0x6a, 0x63, 0xf0, 0x06, 0xfc, 0x00, 0x28, 0xd0, 0xd1, 0x00, 0x2d,
+    0xce, 0xd0, 0x3f, 0x23, 0x2e, 0x00, 0x1e, 0x40, 0x1d, 0x42, 0xc9, 0xd1,
+    0xa1, 0x78, 0xd4, 0x6c, 0xa2, 0x7d, 0xf9, 0x05, 0x1e, 0xc3, 0xd0, 0x33,
+    0x00, 0x32, 0x00, 0x10, 0x00, 0x31, 0xcf, 0xf9, 0xa7, 0x40, 0x03, 0x00,
+    0x50, 0x02, 0x10, 0x18, 0x81, 0x7b, 0x07, 0x01, 0x00, 0x00, 0xec, 0x00,
+    0x10, 0x8c, 0x0c, 0x2a, 0xc1, 0x21, 0x02, 0x48, 0x52, 0x00, 0xfe, 0xf7,
+    0x23, 0xff, 0x10, 0xbd, 0xac, 0xa4, 0x02, 0x00, 0x6e, 0x00, 0x11, 0xf2,
+    0x9e, 0x10, 0x01, 0xa0, 0x33, 0xb0, 0x90, 0x13, 0x00, 0x4a, 0x79, 0x0d,
+    0x00, 0x03, 0x2a, 0x04, 0xd0, 0xbe, 0x2a, 0x20, 0x02, 0x98, 0x86, 0x02,
+    0xf0, 0x35, 0x0a, 0x79, 0x07, 0x21, 0x51, 0x43, 0x12, 0x31, 0x02, 0x91,
+    0x99, 0x42, 0xf3, 0xd8, 0x21, 0x4b, 0x5f, 0x78, 0x00, 0x2f, 0x05, 0xd0,
+    0x19, 0x00, 0x8d, 0x31, 0x09, 0x78, 0x00, 0x29, 0xea, 0xd1, 0x01, 0x27,
+    0x8c, 0x24, 0x7c, 0x43, 0x1e, 0x19, 0x30, 0x00, 0x29, 0x78, 0x88, 0x30,
+    0x69, 0x18, 0x01, 0x60, 0x48, 0x78, 0x21, 0x28, 0xde, 0xd1, 0x08, 0x78,
+    0x09, 0x18, 0x60, 0x1c, 0x18, 0x18, 0x01, 0x90, 0xa0, 0x1c, 0x02, 0x79,
+    0x80, 0x03, 0x98, 0x03, 0x23, 0xff, 0xf7, 0xf9, 0xf8, 0xf4, 0x03, 0xf0,
+    0x33, 0xab, 0x79, 0x01, 0x2b, 0x01, 0xd1, 0xeb, 0x79, 0xf3, 0x70, 0x8c,
+    0x23, 0x01, 0x22, 0x7b, 0x43, 0x0c, 0x4e, 0xa0, 0x1d, 0xf7, 0x18, 0x3a,
+    0x71, 0xaa, 0x78, 0x80, 0x19, 0x9a, 0x55, 0x3b, 0x00, 0x88, 0x33, 0x19,
+    0x68, 0x02, 0x22, 0x07, 0x31, 0xfe, 0xf7, 0xd3, 0xfe, 0xb9, 0x78, 0x00,
+    0x29, 0xb9, 0xd0, 0x22, 0x00, 0x48, 0x32, 0x40, 0x23, 0x03, 0x98, 0x92,
+    0x19, 0xff, 0xf7, 0x59, 0xf9, 0xb1, 0xe7, 0xc0, 0x00, 0xf0, 0x01, 0xf0,
+    0xb5, 0x1f, 0x26, 0x13, 0x78, 0x07, 0x00, 0x14, 0x00, 0x85, 0xb0, 0x1e,
+    0x40, 0x01, 0x2e, 0x4e, 0x0e, 0xf0, 0x37, 0x26, 0xe0, 0x70, 0x4d, 0x12,
+    0x79, 0x28, 0x78, 0x90, 0x42, 0x0d, 0xd0, 0x28, 0x00, 0x8c, 0x30, 0x00,
+    0x78, 0x90, 0x42, 0xf3, 0xd1, 0x60, 0x22, 0x18, 0x00, 0x10, 0x40, 0x13,
+    0x42, 0x28, 0xd1, 0x00, 0x29, 0x03, 0xd0, 0x01, 0x20, 0x13, 0xe0, 0x00,
+    0x26, 0xf4, 0xe7, 0x63, 0x78, 0x06, 0x2b, 0xe5, 0xd1, 0xe3, 0x78, 0x21,
+    0x2b, 0x0d, 0xd1, 0x8c, 0x22, 0x56, 0x43, 0xad, 0x19, 0x88, 0x35, 0x2a,
+    0x68, 0x00, 0x2a, 0xdb, 0xd0, 0x12, 0x03, 0x60, 0x13, 0x78, 0xff, 0xf7,
+    0x7c, 0xfc, 0x02, 0x01, 0xf2, 0x05, 0x22, 0x2b, 0xd2, 0xd1, 0x30, 0x00,
+    0xfc, 0xf7, 0xc7, 0xfb, 0x8c, 0x23, 0x02, 0x00, 0x5e, 0x43, 0xad, 0x19,
+    0xeb, 0x88, 0x34, 0x03, 0x80, 0x6c, 0xfc, 0xd8, 0xe7, 0x20, 0x28, 0xc3,
+    0xd1, 0xd0, 0x0c, 0xf4, 0x01, 0x0a, 0x28, 0xbf, 0xd8, 0x07, 0xf0, 0x51,
+    0xfa, 0x0b, 0x00, 0x7f, 0x00, 0x88, 0x00, 0xbe, 0xff, 0x02, 0x00, 0xf0,
+    0x0b, 0x3a, 0x00, 0x69, 0x00, 0x8f, 0x00, 0x00, 0x29, 0xc3, 0xd1, 0xe3,
+    0x78, 0x03, 0x93, 0x8c, 0x23, 0x73, 0x43, 0x08, 0x33, 0xed, 0x18, 0xe3,
+    0x79, 0xa0, 0x79, 0xf2, 0x2e, 0xf0, 0x21, 0xa1, 0x78, 0x18, 0x1c, 0x40,
+    0x2b, 0x00, 0xd9, 0x40, 0x20, 0xac, 0x46, 0x80, 0xb2, 0x02, 0x91, 0x00,
+    0x29, 0x0a, 0xd0, 0x00, 0x22, 0x02, 0x92, 0x01, 0x2b, 0x06, 0xd9, 0x6b,
+    0x1c, 0x9c, 0x46, 0x01, 0x23, 0x01, 0x38, 0x29, 0x70, 0x80, 0xb2, 0x02,
+    0x93, 0x63, 0x46, 0x03, 0x9a, 0x00, 0x90, 0x88, 0x00, 0xa0, 0x97, 0xfd,
+    0x02, 0x9b, 0x2a, 0x00, 0x18, 0x18, 0x83, 0xb2, 0x60, 0x08, 0x82, 0x84,
+    0xe7, 0xb8, 0xe7, 0x00, 0x29, 0x0b, 0xd1, 0x98, 0x07, 0x20, 0x13, 0x43,
+    0x4e, 0x00, 0xf0, 0x03, 0x7a, 0xe7, 0x8c, 0x22, 0x72, 0x43, 0x48, 0x32,
+    0xaa, 0x18, 0xaa, 0xe7, 0x02, 0x29, 0x00, 0xd0, 0x85, 0xe7, 0x78, 0x00,
+    0xf0, 0x05, 0xa0, 0x79, 0xe2, 0x78, 0xa1, 0x78, 0xe4, 0x79, 0x48, 0x33,
+    0x24, 0x02, 0x04, 0x43, 0xeb, 0x18, 0x20, 0x1c, 0x40, 0x2c, 0x7a, 0x00,
+    0xf2, 0x07, 0x80, 0xb2, 0x00, 0x29, 0x07, 0xd0, 0x01, 0x2c, 0x05, 0xd9,
+    0x1c, 0x78, 0x8c, 0x42, 0x02, 0xd1, 0x01, 0x38, 0x01, 0x33, 0x80, 0xb2,
+    0x6c, 0x00, 0x91, 0x63, 0xfd, 0x67, 0xe7, 0x00, 0x29, 0x00, 0xd0, 0x64,
+    0x52, 0x00, 0x80, 0xe1, 0x78, 0x19, 0x4b, 0xad, 0x18, 0x69, 0x71, 0xa6,
+    0x3b, 0x11, 0x30, 0xd6, 0x0a, 0x00, 0xfe, 0x09, 0x22, 0x43, 0xe7, 0x0e,
+    0x01, 0x31, 0xd3, 0xfb, 0x51, 0x2c, 0x00, 0x11, 0x4e, 0x2c, 0x00, 0x71,
+    0x05, 0x32, 0x01, 0x23, 0xaa, 0x18, 0x6a, 0x12, 0x00, 0x11, 0x45, 0x12,
+    0x00, 0x80, 0x04, 0x32, 0xf5, 0xe7, 0x00, 0x29, 0xe8, 0xd0, 0x92, 0x00,
+    0x11, 0x3c, 0x12, 0x00, 0x80, 0xa1, 0x78, 0x06, 0x4b, 0xad, 0x18, 0x29,
+    0x71, 0xc8, 0x00, 0x22, 0x33, 0xe7, 0x52, 0x00, 0x11, 0x2f, 0xdc, 0x01,
+    0x04, 0xbc, 0x02, 0xf0, 0x33, 0x73, 0xb5, 0x1c, 0x4c, 0x05, 0x00, 0xa0,
+    0x78, 0x62, 0x78, 0x88, 0x42, 0x0e, 0xd0, 0x91, 0x42, 0x0c, 0xd0, 0x22,
+    0x00, 0x8e, 0x34, 0x20, 0x78, 0x8d, 0x32, 0x12, 0x78, 0x88, 0x42, 0x02,
+    0xd0, 0x00, 0x26, 0x91, 0x42, 0x0f, 0xd1, 0x01, 0x20, 0x13, 0x4c, 0x00,
+    0xe0, 0x00, 0x20, 0x62, 0x78, 0x8a, 0x42, 0x0a, 0xd1, 0x11, 0x4a, 0x01,
+    0x26, 0x00, 0x2a, 0x04, 0xd0, 0x21, 0x00, 0xda, 0xb2, 0x08, 0x31, 0x54,
+    0x00, 0xf1, 0x1e, 0x30, 0x00, 0x76, 0xbd, 0xa2, 0x78, 0x01, 0x26, 0x8a,
+    0x42, 0xf9, 0xd1, 0x26, 0x00, 0x00, 0x22, 0x48, 0x36, 0x9b, 0xb2, 0x11,
+    0x00, 0x00, 0x93, 0x33, 0x00, 0xfc, 0xf7, 0xf2, 0xfc, 0x32, 0x00, 0x40,
+    0x23, 0x28, 0x00, 0xa1, 0x78, 0xff, 0xf7, 0x2c, 0xf8, 0x06, 0x00, 0xe8,
+    0x80, 0x00, 0x24, 0x38, 0x12, 0xf8, 0x47, 0x60, 0x00, 0x20, 0xfe, 0xf7,
+    0xa6, 0xfe, 0xbe, 0x14, 0x40, 0xfe, 0xf7, 0x9c, 0xfe, 0x2c, 0x03, 0xf0,
+    0x0a, 0x03, 0x00, 0x02, 0x79, 0x10, 0xb5, 0x44, 0x79, 0x07, 0x20, 0xdb,
+    0x78, 0x04, 0x40, 0x24, 0x02, 0x9b, 0x07, 0x22, 0x43, 0x9b, 0x0f, 0x02,
+    0x2b, 0x0d, 0x6e, 0x46, 0xf0, 0x06, 0x2b, 0x12, 0xd0, 0x01, 0x2b, 0x07,
+    0xd1, 0x02, 0x39, 0x4b, 0x42, 0x59, 0x41, 0x0b, 0x4b, 0xc9, 0x18, 0x91,
+    0x42, 0x40, 0x41, 0xb2, 0x32, 0x91, 0x00, 0x20, 0x02, 0x29, 0x06, 0xd1,
+    0x07, 0x4b, 0xd0, 0x6a, 0x27, 0xf3, 0x03, 0xf5, 0xe7, 0x02, 0x29, 0x03,
+    0xd0, 0x40, 0x23, 0x93, 0x42, 0x40, 0x41, 0xef, 0xe7, 0x80, 0x23, 0xdb,
+    0x00, 0xa0, 0x77, 0x10, 0xfe, 0x38, 0x7a, 0xf0, 0x4d, 0x00, 0x24, 0x7f,
+    0x26, 0x94, 0x42, 0x00, 0xd3, 0xf0, 0xbd, 0x4d, 0x78, 0x05, 0x2d, 0x06,
+    0xd1, 0x8f, 0x78, 0x3d, 0x00, 0x35, 0x40, 0x6d, 0x00, 0xff, 0x09, 0x45,
+    0x19, 0xeb, 0x55, 0x0d, 0x78, 0x64, 0x19, 0xa4, 0xb2, 0x49, 0x19, 0xed,
+    0xe7, 0x8a, 0x18, 0x03, 0x00, 0x90, 0xb2, 0x88, 0x42, 0x02, 0xd3, 0x9a,
+    0x89, 0x82, 0x42, 0x02, 0xd2, 0x5a, 0x89, 0x80, 0x18, 0x80, 0xb2, 0x70,
+    0x47, 0x82, 0x88, 0x10, 0xb5, 0x8a, 0x42, 0x04, 0xd8, 0x8b, 0x1a, 0x84,
+    0x89, 0x9b, 0xb2, 0x9c, 0x42, 0x03, 0xd2, 0x43, 0x89, 0xd2, 0x18, 0x89,
+    0x1a, 0x8b, 0xb2, 0x03, 0x82, 0xca, 0x00, 0x01, 0x40, 0x22, 0x30, 0xf0,
+    0xbb, 0xf8, 0x5e, 0x71, 0x70, 0x96, 0x08, 0x14, 0x00, 0x05, 0x00, 0x32,
+    0xbe, 0x1f, 0xf0, 0x0c, 0x3a, 0x11, 0x48, 0x92, 0xb2, 0x82, 0x42, 0x0e,
+    0xd1, 0x03, 0x23, 0x22, 0x00, 0xb6, 0x00, 0x89, 0x19, 0x1a, 0x40, 0x1c,
+    0x42, 0x06, 0xd0, 0x00, 0x23, 0x01, 0xa8, 0xb4, 0x34, 0xf3, 0x16, 0x0d,
+    0xfd, 0x01, 0x9b, 0x2b, 0x60, 0xf7, 0xbd, 0x18, 0x78, 0x84, 0x46, 0x67,
+    0x46, 0x58, 0x78, 0x00, 0x02, 0x38, 0x43, 0x9f, 0x78, 0x3f, 0x04, 0x07,
+    0x43, 0xd8, 0x78, 0x04, 0x33, 0x00, 0x06, 0x38, 0x43, 0x28, 0x60, 0xdc,
+    0x9c, 0x6d, 0xf0, 0x1b, 0xf0, 0xb5, 0x0e, 0x00, 0x19, 0x00, 0x89, 0xb0,
+    0x0e, 0xab, 0x05, 0x00, 0x18, 0x88, 0x0f, 0xab, 0x1b, 0x78, 0x0c, 0x1a,
+    0x17, 0x00, 0x04, 0x93, 0xa4, 0xb2, 0x81, 0x42, 0x02, 0xd2, 0x6b, 0x89,
+    0xe4, 0x1a, 0xa4, 0xb2, 0xab, 0x88, 0xa3, 0x42, 0x05, 0xd2, 0xf2, 0x05,
+    0xf1, 0x42, 0xa7, 0xff, 0x28, 0x8a, 0xac, 0x88, 0x80, 0xb2, 0x00, 0x2c,
+    0x21, 0xd0, 0x23, 0x1c, 0xbc, 0x42, 0x00, 0xd9, 0x3b, 0x1c, 0x9c, 0xb2,
+    0xab, 0x88, 0x83, 0x42, 0x1c, 0xd9, 0xea, 0x88, 0x1f, 0x1a, 0x11, 0x00,
+    0xe3, 0x1a, 0xc3, 0x18, 0x53, 0x43, 0x50, 0x43, 0x9b, 0xb2, 0xbf, 0xb2,
+    0x79, 0x43, 0x01, 0x93, 0x2b, 0x68, 0x89, 0xb2, 0x1b, 0x18, 0x03, 0x93,
+    0x04, 0x9b, 0x02, 0x91, 0x01, 0x2b, 0x16, 0xd0, 0xbc, 0x42, 0x0a, 0xd8,
+    0x30, 0x00, 0x62, 0x43, 0x03, 0x99, 0xfe, 0xf7, 0xb9, 0xfc, 0x20, 0x26,
+    0x76, 0x80, 0xc0, 0x1a, 0x80, 0xb2, 0xdd, 0xe7, 0x02, 0x9a, 0x26, 0x27,
+    0xf0, 0x03, 0xfe, 0xf7, 0xae, 0xfc, 0x02, 0x9b, 0x29, 0x68, 0x01, 0x9a,
+    0xf0, 0x18, 0xed, 0xe7, 0xbc, 0x42, 0x06, 0xd8, 0x2c, 0x00, 0x11, 0x92,
+    0x08, 0x07, 0xf0, 0x2c, 0x7d, 0xff, 0xe6, 0xe7, 0x03, 0x27, 0x02, 0x9b,
+    0x30, 0x00, 0xbb, 0x43, 0x1a, 0x00, 0x03, 0x99, 0x05, 0x93, 0xff, 0xf7,
+    0x73, 0xff, 0x02, 0x9b, 0x3b, 0x40, 0x04, 0x93, 0x02, 0x9b, 0x3b, 0x42,
+    0x2b, 0xd0, 0x04, 0x23, 0x04, 0x9a, 0x9b, 0x1a, 0x01, 0x9a, 0x1f, 0x1c,
+    0x9b, 0xb2, 0x93, 0x42, 0x01, 0xd9, 0x6b, 0x46, 0x9f, 0x88, 0x01, 0x9b,
+    0xbf, 0xb2, 0xdb, 0xf2, 0x0e, 0xf0, 0x22, 0x9a, 0x01, 0x93, 0x00, 0x23,
+    0x94, 0x46, 0x07, 0x93, 0x03, 0x9b, 0x04, 0x9a, 0x63, 0x44, 0x19, 0x00,
+    0x07, 0xa8, 0xfe, 0xf7, 0x77, 0xfc, 0x07, 0xaa, 0x94, 0x46, 0x04, 0x9b,
+    0x2d, 0x68, 0x63, 0x44, 0x18, 0x00, 0x29, 0x00, 0x3a, 0x00, 0xfe, 0xf7,
+    0x6d, 0xfc, 0x07, 0x9b, 0xe9, 0x19, 0x33, 0x60, 0xe2, 0x2b, 0x80, 0xad,
+    0xd0, 0x1a, 0x00, 0xc0, 0xe7, 0x29, 0x68, 0xd0, 0x12, 0x00, 0x84, 0x01,
+    0xf0, 0x13, 0x15, 0x00, 0x03, 0x00, 0x32, 0x00, 0x01, 0x3a, 0x0d, 0x4c,
+    0x92, 0xb2, 0xa2, 0x42, 0x0c, 0xd1, 0x03, 0x23, 0x2a, 0x00, 0xb6, 0x00,
+    0x80, 0x19, 0x1a, 0x40, 0x1d, 0x42, 0x04, 0xd0, 0x0b, 0x68, 0x01, 0xa9,
+    0x82, 0x01, 0xf0, 0x07, 0x4c, 0xfc, 0xf7, 0xbd, 0x0c, 0x68, 0x27, 0x0a,
+    0x1c, 0x70, 0x5f, 0x70, 0x27, 0x0c, 0x24, 0x0e, 0x9f, 0x70, 0xdc, 0x70,
+    0x04, 0x33, 0x70, 0x39, 0x00, 0x74, 0x01, 0xf0, 0x0b, 0x70, 0xb5, 0x1c,
+    0x00, 0xd3, 0x1a, 0x0e, 0x00, 0x05, 0x00, 0x11, 0x00, 0x9b, 0xb2, 0xa2,
+    0x42, 0x02, 0xd2, 0x42, 0x89, 0x9b, 0x1a, 0x9b, 0xb2, 0xaa, 0x88, 0xd2,
+    0x19, 0x00, 0x68, 0x01, 0xf0, 0x0d, 0xf3, 0xfe, 0xab, 0x88, 0x18, 0x1e,
+    0x0a, 0xd0, 0xaa, 0x88, 0xa2, 0x42, 0x08, 0xd9, 0xea, 0x88, 0x29, 0x68,
+    0x54, 0x43, 0x30, 0x00, 0x09, 0x19, 0xfe, 0xf7, 0x1f, 0xfc, 0x1c, 0x2c,
+    0x60, 0xa4, 0x1a, 0xa4, 0xb2, 0xf1, 0xe7, 0x20, 0x02, 0x20, 0x03, 0xd0,
+    0xc0, 0x16, 0x20, 0x06, 0xf0, 0x34, 0x30, 0x00, 0x0c, 0x0a, 0x80, 0x16,
+    0x00, 0x1f, 0x00, 0x0d, 0x00, 0x80, 0x69, 0x78, 0x2b, 0xf0, 0x0d, 0xe3,
+    0x89, 0x22, 0x8a, 0x9b, 0xb2, 0x29, 0x00, 0x01, 0x97, 0x00, 0x92, 0x20,
+    0x00, 0x32, 0x00, 0xff, 0xf7, 0x08, 0xff, 0x21, 0x8a, 0x05, 0x00, 0x02,
+    0x00, 0x89, 0xb2, 0x18, 0x07, 0x60, 0xb4, 0xfe, 0x20, 0x82, 0xa0, 0x69,
+    0xf8, 0x6b, 0x00, 0x42, 0x07, 0x02, 0xb2, 0x17, 0x40, 0x40, 0x69, 0x0d,
+    0x00, 0x00, 0x02, 0x00, 0xe2, 0x2c, 0xf0, 0x0a, 0xe3, 0x89, 0x22, 0x7a,
+    0x21, 0x8a, 0x9b, 0xb2, 0x02, 0x93, 0x89, 0xb2, 0xa3, 0x88, 0x00, 0x2a,
+    0x37, 0xd1, 0x02, 0x9a, 0x02, 0x98, 0x52, 0x1a, 0x92, 0xca, 0x02, 0x30,
+    0xd2, 0x61, 0x89, 0x0a, 0x00, 0xf0, 0x2d, 0x9a, 0x1a, 0x11, 0x1c, 0x92,
+    0xb2, 0xba, 0x42, 0x00, 0xd9, 0x39, 0x1c, 0x8f, 0xb2, 0x02, 0x9e, 0xb3,
+    0x42, 0x2d, 0xd9, 0xe2, 0x88, 0x99, 0x1b, 0x10, 0x00, 0xfb, 0x1a, 0xf3,
+    0x18, 0x53, 0x43, 0x56, 0x43, 0x89, 0xb2, 0x9b, 0xb2, 0x48, 0x43, 0x01,
+    0x93, 0x23, 0x68, 0x80, 0xb2, 0x9e, 0x19, 0x04, 0x9b, 0x03, 0x90, 0x01,
+    0x2b, 0x28, 0xd0, 0x8f, 0x42, 0x1c, 0xd8, 0x4c, 0x2a, 0xa0, 0x7a, 0x43,
+    0xfe, 0xf7, 0xb5, 0xfb, 0x3a, 0x00, 0x02, 0x99, 0x92, 0x00, 0xb1, 0x6b,
+    0xfe, 0xe0, 0x81, 0x60, 0x69, 0xff, 0xf7, 0x82, 0xfe, 0x38, 0x1a, 0x02,
+    0xf0, 0x0d, 0xe2, 0x88, 0x9f, 0x42, 0xd4, 0xd3, 0xff, 0x1a, 0x7a, 0x43,
+    0x02, 0x91, 0x1f, 0x00, 0xad, 0x18, 0xce, 0xe7, 0xf6, 0x1a, 0xb6, 0xb2,
+    0xcc, 0xe7, 0x29, 0x00, 0x03, 0x9a, 0x2c, 0x02, 0xf3, 0x00, 0x98, 0xfb,
+    0x03, 0x9b, 0x01, 0x9a, 0x20, 0x68, 0xe9, 0x18, 0xdb, 0xe7, 0x8f, 0x42,
+    0x06, 0x52, 0x00, 0xf0, 0x09, 0x92, 0xb2, 0xff, 0xf7, 0x29, 0xff, 0xd4,
+    0xe7, 0x03, 0x23, 0x03, 0x9a, 0x29, 0x00, 0x9a, 0x43, 0x30, 0x00, 0x05,
+    0x92, 0xff, 0xf7, 0x20, 0xff, 0x10, 0x00, 0xf0, 0x07, 0x1a, 0x40, 0x04,
+    0x92, 0x03, 0x9a, 0x1a, 0x42, 0x2a, 0xd0, 0x04, 0x9a, 0x01, 0x33, 0x9b,
+    0x1a, 0x01, 0x99, 0x1a, 0x1c, 0x9b, 0xb2, 0x20, 0x0d, 0xe0, 0x6b, 0x46,
+    0x9a, 0x88, 0x93, 0xb2, 0x03, 0x93, 0x03, 0x9a, 0x01, 0x9b, 0x07, 0xa9,
+    0x90, 0x01, 0x00, 0xbe, 0x02, 0x20, 0x04, 0x9a, 0x08, 0x77, 0x62, 0xf0,
+    0x18, 0xfe, 0xf7, 0x62, 0xfb, 0x2a, 0x02, 0x20, 0x26, 0x68, 0x3c, 0x02,
+    0xc0, 0x30, 0x00, 0x03, 0x9a, 0xfe, 0xf7, 0x58, 0xfb, 0x03, 0x9b, 0xf0,
+    0x18, 0x28, 0x02, 0xf0, 0x08, 0x9d, 0xd0, 0x1a, 0x00, 0x29, 0x00, 0xc2,
+    0xe7, 0x20, 0x68, 0xf7, 0xe7, 0xf7, 0xb5, 0x01, 0x93, 0x08, 0xab, 0x1f,
+    0x78, 0x80, 0x23, 0x04, 0x04, 0x16, 0xb0, 0x26, 0x00, 0x91, 0x1b, 0x02,
+    0x9a, 0x42, 0x1a, 0xd8, 0x40, 0x69, 0x8c, 0x0c, 0x00, 0x72, 0x01, 0xf0,
+    0x15, 0x22, 0xff, 0x00, 0x9b, 0xa5, 0x80, 0x23, 0x60, 0x6d, 0x00, 0x01,
+    0x9b, 0xad, 0xb2, 0xe3, 0x80, 0x6b, 0x1e, 0x6d, 0x42, 0xe6, 0x81, 0x60,
+    0x69, 0xa3, 0x81, 0x26, 0x82, 0x27, 0x72, 0x65, 0x81, 0xff, 0xf7, 0x01,
+    0xfe, 0x28, 0x00, 0xf5, 0x02, 0xfe, 0xfd, 0x01, 0x36, 0x30, 0x00, 0xfe,
+    0xbd, 0xc1, 0x89, 0x02, 0x8a, 0x8b, 0x1a, 0x9b, 0xb2, 0x91, 0x2c, 0x02,
+    0x40, 0x82, 0x88, 0x10, 0x1c, 0x76, 0x78, 0x20, 0x18, 0x1c, 0x48, 0x04,
+    0x80, 0x03, 0x00, 0xc0, 0x89, 0x1b, 0x8a, 0xc0, 0x1a, 0xb2, 0x04, 0x00,
+    0xda, 0x17, 0xf2, 0x0b, 0x10, 0xb5, 0xc4, 0x89, 0x01, 0x8a, 0x82, 0x88,
+    0x63, 0x1a, 0x9b, 0xb2, 0x8c, 0x42, 0x02, 0xd2, 0x40, 0x89, 0x1b, 0x1a,
+    0x9b, 0xb2, 0xd0, 0x1a, 0x80, 0xb2, 0x18, 0x2f, 0x02, 0x22, 0x02, 0xc0,
+    0xdf, 0xfe, 0xe2, 0x89, 0x23, 0x8a, 0x29, 0x00, 0x9b, 0xb2, 0x20, 0x00,
+    0x34, 0x01, 0x20, 0xb3, 0xfe, 0x1e, 0x02, 0x22, 0x82, 0xb2, 0x1e, 0x02,
+    0x22, 0xa5, 0xfd, 0x1e, 0x02, 0x20, 0xbc, 0xfd, 0x86, 0x0c, 0x00, 0xa2,
+    0x32, 0x48, 0xff, 0xf7, 0xce, 0xfe, 0x40, 0x00, 0x13, 0xbf, 0x40, 0x00,
+    0x20, 0x92, 0xb2, 0x42, 0x00, 0x00, 0xc4, 0x45, 0x20, 0x05, 0x00, 0x32,
+    0x00, 0x11, 0xa3, 0x32, 0x00, 0x00, 0x28, 0x00, 0xf2, 0x00, 0x40, 0x69,
+    0x0e, 0x00, 0xff, 0xf7, 0xab, 0xfe, 0xe2, 0x89, 0x21, 0x8a, 0x95, 0xb2,
+    0x53, 0xc2, 0x00, 0x21, 0xd9, 0x62, 0xc2, 0x00, 0x00, 0x9a, 0x7a, 0x60,
+    0x1a, 0xd1, 0x20, 0x7a, 0x2b, 0x00, 0x76, 0x09, 0x20, 0x70, 0xbd, 0x14,
+    0x00, 0xf2, 0x05, 0x93, 0x42, 0xfb, 0xd2, 0xe2, 0x88, 0x21, 0x68, 0x53,
+    0x43, 0xc8, 0x18, 0x31, 0x00, 0xfe, 0xf7, 0xa8, 0xfa, 0x01, 0x22, 0x7c,
+    0x31, 0x22, 0x5e, 0xfd, 0x1a, 0x02, 0x90, 0x75, 0xfd, 0x01, 0x20, 0xe8,
+    0xe7, 0x2b, 0x00, 0xe9, 0xfe, 0x02, 0x30, 0x2a, 0x03, 0xd0, 0x96, 0x00,
+    0x62, 0xa2, 0xfe, 0x02, 0x00, 0x10, 0x00, 0xa2, 0x2e, 0x00, 0x64, 0x01,
+    0x11, 0x73, 0x3c, 0x01, 0xf0, 0x0d, 0x70, 0xfe, 0x00, 0x23, 0xe3, 0x81,
+    0x23, 0x82, 0xa3, 0x88, 0x60, 0x69, 0x5b, 0x00, 0x9b, 0xb2, 0x5a, 0x1e,
+    0x5b, 0x42, 0xa2, 0x81, 0x63, 0x81, 0xff, 0xf7, 0x53, 0xfd, 0x20, 0x00,
+    0x44, 0x50, 0xfd, 0x01, 0x20, 0xce, 0x00, 0x00, 0x36, 0x00, 0x11, 0x58,
+    0x36, 0x00, 0x91, 0x55, 0xfe, 0x60, 0x69, 0x25, 0x72, 0xff, 0xf7, 0x41,
+    0x24, 0x00, 0x20, 0x3e, 0xfd, 0x6e, 0x03, 0x77, 0xef, 0xf3, 0x10, 0x80,
+    0x72, 0xb6, 0x03, 0x66, 0x3b, 0x51, 0x70, 0x47, 0x2c, 0x01, 0x00, 0x0a,
+    0x00, 0x00, 0xac, 0x47, 0x31, 0x1a, 0x60, 0x80, 0x4a, 0x3c, 0x00, 0x14,
+    0x00, 0xe4, 0x07, 0x22, 0xcb, 0x08, 0xc3, 0x5c, 0x01, 0x20, 0x11, 0x40,
+    0x88, 0x40, 0x18, 0x40, 0x6a, 0x19, 0x00, 0x92, 0x0b, 0xb1, 0x0c, 0x00,
+    0x17, 0x00, 0xff, 0xf7, 0xd9, 0xff, 0x21, 0x00, 0x06, 0x56, 0x0d, 0x20,
+    0xea, 0xff, 0xbe, 0x03, 0x00, 0x92, 0x07, 0xf0, 0x07, 0xfd, 0xf7, 0xf2,
+    0xfa, 0x07, 0x21, 0x01, 0x23, 0xe2, 0x08, 0x0c, 0x40, 0xa3, 0x40, 0xa9,
+    0x5c, 0x30, 0x00, 0x0b, 0x43, 0xab, 0x54, 0x60, 0x17, 0xf3, 0x04, 0xf8,
+    0xbd, 0xf7, 0xb5, 0x05, 0x00, 0x14, 0x00, 0x1f, 0x00, 0x01, 0x91, 0xff,
+    0xf7, 0xbb, 0xff, 0x06, 0x00, 0xbc, 0x9c, 0x35, 0x20, 0x0d, 0xe0, 0x4c,
+    0x0f, 0x00, 0x4c, 0x24, 0xf0, 0x05, 0x00, 0x28, 0x12, 0xd1, 0x07, 0x22,
+    0x01, 0x23, 0x22, 0x40, 0x93, 0x40, 0xe1, 0x08, 0x6a, 0x5c, 0x13, 0x43,
+    0x6b, 0x54, 0x2e, 0x05, 0x60, 0xb0, 0xff, 0x00, 0x2c, 0x07, 0xda, 0x9c,
+    0x02, 0xfc, 0x01, 0x04, 0xd0, 0x08, 0x98, 0xfd, 0xf7, 0xc0, 0xfa, 0x01,
+    0x34, 0xdf, 0xe7, 0x20, 0x00, 0xfe, 0xbd, 0xc8, 0x72, 0x01, 0x54, 0x0a,
+    0x70, 0x92, 0x0a, 0x9a, 0x05, 0x00, 0x0f, 0x00, 0x76, 0x35, 0xf0, 0x01,
+    0x40, 0xd8, 0x0c, 0x24, 0x1a, 0x0e, 0x1b, 0x02, 0x02, 0x92, 0x01, 0x93,
+    0x0a, 0x9a, 0x03, 0x00, 0x6c, 0x48, 0xf0, 0x43, 0xfd, 0xf7, 0x26, 0xfb,
+    0x6c, 0x43, 0x28, 0x4b, 0x06, 0x00, 0xe4, 0x18, 0x63, 0x68, 0x83, 0x42,
+    0x00, 0xd2, 0x60, 0x60, 0x2b, 0x1f, 0xdb, 0xb2, 0x00, 0x93, 0xc0, 0x23,
+    0x00, 0x9a, 0x9b, 0x01, 0x23, 0x43, 0x01, 0x2a, 0x26, 0xd8, 0x01, 0x2f,
+    0x24, 0xd1, 0x03, 0x22, 0x1a, 0x60, 0xa3, 0x68, 0x3b, 0x42, 0xfc, 0xd0,
+    0x03, 0x9a, 0x23, 0x68, 0x52, 0x01, 0x5a, 0x40, 0x80, 0x21, 0xe0, 0x23,
+    0x49, 0x01, 0x1a, 0x40, 0x00, 0x9b, 0x21, 0x43, 0x0a, 0x60, 0x01, 0x2b,
+    0x21, 0xd9, 0x80, 0x23, 0x80, 0x22, 0x34, 0x00, 0x00, 0xee, 0x70, 0xf0,
+    0x07, 0x01, 0x98, 0x00, 0x23, 0x32, 0x00, 0x02, 0x99, 0x66, 0x60, 0xfd,
+    0xf7, 0xf4, 0xfa, 0x10, 0x4b, 0xad, 0x00, 0x58, 0x51, 0x01, 0x20, 0xd0,
+    0x09, 0x00, 0x96, 0x1b, 0xf0, 0x31, 0x1a, 0x60, 0x0c, 0x4b, 0xaa, 0x00,
+    0xd1, 0x58, 0x00, 0x29, 0xd7, 0xd0, 0x58, 0x69, 0xfd, 0xf7, 0xa1, 0xfa,
+    0x01, 0x30, 0x01, 0x38, 0xfd, 0xd1, 0xd0, 0xe7, 0x03, 0x22, 0x23, 0x68,
+    0x7b, 0x40, 0x13, 0x40, 0x0b, 0x60, 0x01, 0x23, 0xbb, 0x40, 0xa2, 0x68,
+    0x13, 0x42, 0xfc, 0xd0, 0xd2, 0xe7, 0x00, 0x80, 0x00, 0x40, 0x3c, 0x14,
+    0x00, 0x20, 0x73, 0xb5, 0x0c, 0x20, 0x00, 0xf0, 0xe6, 0xf8, 0x20, 0x4e,
+    0xa0, 0x00, 0x28, 0x0a, 0xd0, 0x00, 0x23, 0x2c, 0x4a, 0x2c, 0x48, 0x36,
+    0x6f, 0xf0, 0x2f, 0x88, 0x50, 0x0a, 0x2b, 0xfa, 0xd1, 0x2a, 0x4b, 0x53,
+    0x62, 0x73, 0xbd, 0x2a, 0x4d, 0xa8, 0x67, 0x00, 0xf0, 0xdb, 0xf8, 0x01,
+    0x22, 0x28, 0x4b, 0x1a, 0x60, 0x6b, 0x6c, 0x01, 0x2b, 0xfc, 0xd1, 0x03,
+    0x22, 0x26, 0x4b, 0x1a, 0x60, 0xac, 0x6b, 0x01, 0x2c, 0xfc, 0xd1, 0x02,
+    0x25, 0x05, 0x26, 0x21, 0x00, 0x00, 0x95, 0x06, 0x23, 0x22, 0x4a, 0x23,
+    0x48, 0x00, 0xf0, 0x70, 0xf8, 0xf0, 0x14, 0xf0, 0x10, 0x21, 0x4a, 0x22,
+    0x48, 0x00, 0x96, 0x00, 0xf0, 0x69, 0xf8, 0x21, 0x4b, 0x29, 0x00, 0x21,
+    0x4d, 0x00, 0x93, 0x00, 0x22, 0x04, 0x20, 0xff, 0xf7, 0x5b, 0xff, 0x2b,
+    0x00, 0x21, 0x00, 0x00, 0x48, 0x0f, 0x10, 0x95, 0x30, 0x4e, 0xc0, 0x00,
+    0x22, 0x10, 0x4c, 0x11, 0x00, 0x23, 0x00, 0x00, 0x94, 0x07, 0x20, 0x46,
+    0x1a, 0xf0, 0x03, 0x00, 0x22, 0x23, 0x00, 0x11, 0x00, 0x00, 0x94, 0x08,
+    0x20, 0xff, 0xf7, 0x45, 0xff, 0x00, 0x22, 0x09, 0x4b, 0xdc, 0x08, 0x30,
+    0x09, 0x20, 0x23, 0xb4, 0x7d, 0x40, 0xff, 0x00, 0x22, 0x2b, 0x1e, 0x00,
+    0x80, 0x95, 0x06, 0x20, 0xff, 0xf7, 0x36, 0xff, 0xb0, 0x38, 0x28, 0x30,
+    0x14, 0x00, 0x20, 0x00, 0x2e, 0x41, 0x1b, 0xb7, 0x00, 0x00, 0xd8, 0x00,
+    0xb1, 0xb0, 0x00, 0x40, 0x30, 0xb0, 0x00, 0x40, 0x00, 0x2f, 0x68, 0x59,
+    0x14, 0x2e, 0x31, 0x8c, 0x86, 0x47, 0x14, 0x73, 0x92, 0x1b, 0xb7, 0x00,
+    0x40, 0x59, 0x73, 0x07, 0x01, 0x4b, 0x84, 0x31, 0x00, 0x38, 0x00, 0x0c,
+    0x00, 0x74, 0x13, 0x03, 0x10, 0x00, 0x02, 0xbe, 0x02, 0x02, 0x14, 0x00,
+    0x00, 0x30, 0x03, 0x62, 0x01, 0x20, 0xfc, 0xf7, 0x61, 0xf8, 0xfa, 0x73,
+    0x20, 0xed, 0xff, 0x54, 0x31, 0x06, 0xf0, 0x73, 0x33, 0xfd, 0xf7, 0xea,
+    0xf0, 0x73, 0x3f, 0xfd, 0xf7, 0xe5, 0xf0, 0x73, 0x80, 0x0f, 0x30, 0x73,
+    0x15, 0x80, 0x70, 0xb5, 0x00, 0x24, 0x09, 0x26, 0x88, 0xb0, 0x3e, 0x09,
+    0x00, 0x58, 0x1b, 0x60, 0x00, 0x94, 0xfe, 0xf7, 0x75, 0xf8, 0x0c, 0x00,
+    0xf0, 0x17, 0x05, 0xa8, 0x04, 0x94, 0xfe, 0xf7, 0x6f, 0xf8, 0x4b, 0x23,
+    0x6a, 0x46, 0x68, 0x46, 0x13, 0x70, 0x04, 0xa9, 0x0d, 0x22, 0x06, 0xf0,
+    0xfb, 0xfb, 0x15, 0x21, 0x08, 0x22, 0x28, 0x00, 0x69, 0x44, 0xfe, 0xf7,
+    0x67, 0xf8, 0x08, 0xb0, 0x1c, 0x31, 0xf0, 0x42, 0x7f, 0x23, 0x03, 0x40,
+    0xf0, 0xb5, 0xc4, 0x09, 0x5d, 0x00, 0x27, 0x4e, 0x2f, 0x19, 0x7f, 0x01,
+    0xf7, 0x19, 0xb8, 0x70, 0x01, 0x20, 0xa0, 0x43, 0x78, 0x70, 0x00, 0x20,
+    0xf8, 0x70, 0x98, 0x01, 0xb9, 0x83, 0xba, 0x77, 0x8c, 0x46, 0xdf, 0x00,
+    0x30, 0x18, 0x01, 0x2c, 0x10, 0xd1, 0x1f, 0x49, 0x7f, 0x18, 0x87, 0x62,
+    0x00, 0x27, 0x28, 0x19, 0x40, 0x01, 0x30, 0x18, 0x80, 0x68, 0x07, 0x60,
+    0xbb, 0x42, 0x09, 0xd1, 0x64, 0x01, 0x36, 0x19, 0x73, 0x60, 0x19, 0x4b,
+    0xf3, 0x60, 0xf0, 0xbd, 0x18, 0x22, 0x00, 0xf0, 0x2e, 0x60, 0xed, 0xe7,
+    0x58, 0x1e, 0x9b, 0x01, 0xc0, 0x00, 0xf3, 0x18, 0x01, 0x2c, 0x1c, 0xd1,
+    0x14, 0x49, 0x40, 0x18, 0x58, 0x62, 0x61, 0x46, 0x3f, 0x23, 0x3f, 0x31,
+    0x89, 0xb2, 0x99, 0x43, 0x02, 0x2a, 0x00, 0xd1, 0x49, 0x00, 0x10, 0x48,
+    0x2d, 0x19, 0x03, 0x68, 0x6d, 0x01, 0x59, 0x18, 0x01, 0x60, 0x0e, 0x49,
+    0x76, 0x19, 0xf3, 0x60, 0x92, 0x06, 0x4b, 0x40, 0x1a, 0x43, 0xb8, 0x74,
+    0x90, 0x1a, 0x43, 0x73, 0x68, 0x1a, 0x60, 0xd7, 0xe7, 0x09, 0x3a, 0x00,
+    0xf1, 0x0b, 0x60, 0xe1, 0xe7, 0xc0, 0x46, 0x68, 0x14, 0x00, 0x20, 0x80,
+    0x00, 0x10, 0x50, 0x00, 0x01, 0x10, 0x50, 0x84, 0x00, 0x10, 0x50, 0x08,
+    0x00, 0x10, 0x50, 0x68, 0xf8, 0x28, 0x30, 0x10, 0x50, 0x0c, 0x18, 0x00,
+    0x80, 0x23, 0x19, 0x00, 0x10, 0xb5, 0x09, 0x48, 0xda, 0x48, 0x28, 0xb0,
+    0x33, 0x91, 0x60, 0xd1, 0x60, 0x0f, 0x2b, 0xf7, 0xd1, 0xf0, 0x22, 0x7e,
+    0x38, 0x60, 0x04, 0x48, 0xfd, 0xf7, 0xe9, 0xff, 0x7c, 0x41, 0x11, 0x1a,
+    0xd0, 0x13, 0x00, 0x34, 0x00, 0x40, 0xa8, 0x14, 0x00, 0x20, 0x40, 0x00,
+    0xf0, 0x35, 0x80, 0x01, 0x10, 0x50, 0x43, 0x4b, 0xf0, 0xb5, 0x1e, 0x68,
+    0x80, 0x24, 0x35, 0x00, 0x64, 0x02, 0x85, 0xb0, 0x25, 0x40, 0x26, 0x42,
+    0x0d, 0xd0, 0x01, 0x22, 0x3f, 0x4b, 0x00, 0x20, 0xda, 0x70, 0x04, 0x33,
+    0xda, 0x77, 0x3d, 0x49, 0xfe, 0xf7, 0x95, 0xf9, 0x80, 0x22, 0x25, 0x00,
+    0x3c, 0x4b, 0x92, 0x02, 0x1a, 0x65, 0x10, 0x23, 0x1e, 0x42, 0x0c, 0xd0,
+    0x1d, 0x43, 0x39, 0x4b, 0x01, 0x27, 0x9b, 0x6d, 0x03, 0x93, 0xac, 0x0e,
+    0x00, 0xe2, 0x3c, 0xf0, 0x09, 0x02, 0xd0, 0x02, 0x9b, 0x20, 0x2b, 0x34,
+    0xd1, 0x80, 0x23, 0x5b, 0x01, 0x1e, 0x42, 0x0e, 0xd0, 0x00, 0x24, 0x1d,
+    0x43, 0x30, 0x4b, 0x1c, 0x60, 0xb4, 0x04, 0x00, 0xfa, 0x51, 0x00, 0x62,
+    0x1e, 0xf0, 0x13, 0x5c, 0xf9, 0x80, 0x22, 0x2a, 0x4b, 0x12, 0x03, 0x1a,
+    0x65, 0x80, 0x23, 0xdb, 0x01, 0x1e, 0x42, 0x08, 0xd0, 0x01, 0x22, 0x04,
+    0x21, 0x00, 0x20, 0x1d, 0x43, 0xfe, 0xf7, 0x3d, 0xf9, 0x10, 0x22, 0x23,
+    0x4b, 0x1a, 0x00, 0x61, 0x1b, 0x02, 0x1e, 0x42, 0x09, 0xd0, 0xf8, 0x7b,
+    0x01, 0x1a, 0x00, 0x50, 0x30, 0xf9, 0x80, 0x22, 0x1d, 0x14, 0x02, 0xf0,
+    0x1e, 0x65, 0xb5, 0x42, 0x2c, 0xd0, 0x29, 0x00, 0x1c, 0x48, 0x71, 0x40,
+    0xfd, 0xf7, 0x43, 0xf8, 0x03, 0x9b, 0x1f, 0x42, 0x1e, 0xd0, 0x16, 0x4b,
+    0x02, 0x9a, 0x9f, 0x65, 0x02, 0x9b, 0x5c, 0x08, 0x01, 0x23, 0x64, 0x00,
+    0x93, 0x43, 0xe4, 0x18, 0x10, 0x4b, 0x64, 0x01, 0xe4, 0x18, 0xe8, 0x11,
+    0x20, 0xc1, 0xf9, 0x26, 0x04, 0xf0, 0x01, 0x01, 0x23, 0xa2, 0x8a, 0xa1,
+    0x78, 0x00, 0x93, 0x00, 0x23, 0x18, 0x00, 0xfe, 0xf7, 0x42, 0xf9, 0x1a,
+    0x00, 0xc0, 0x42, 0xf9, 0x03, 0x9b, 0xbb, 0x43, 0x03, 0x93, 0x02, 0x9b,
+    0x7f, 0x00, 0x66, 0x43, 0x42, 0x02, 0x93, 0x9c, 0xe7, 0xb4, 0x70, 0x40,
+    0x98, 0x00, 0x11, 0x50, 0x70, 0x01, 0x00, 0x28, 0x01, 0x90, 0x00, 0x30,
+    0x11, 0x50, 0x00, 0x00, 0x11, 0x50, 0xd4, 0xc0, 0x2f, 0x10, 0xb5, 0xd2,
+    0x31, 0x30, 0xfb, 0xf7, 0xf3, 0x86, 0x0c, 0x50, 0x22, 0x10, 0xb5, 0x11,
+    0x00, 0x8e, 0x73, 0x11, 0x86, 0x4c, 0x15, 0x10, 0x88, 0xa0, 0x01, 0x71,
+    0x22, 0x02, 0x4b, 0x52, 0x02, 0xda, 0x64, 0x80, 0x05, 0x31, 0x20, 0x11,
+    0x50, 0x2c, 0x20, 0xf1, 0x0b, 0xf0, 0xe8, 0xf8, 0x0c, 0x23, 0x40, 0x26,
+    0x11, 0x4c, 0x05, 0x20, 0xa3, 0x67, 0x11, 0x49, 0xfb, 0xf7, 0xec, 0xfe,
+    0x32, 0x00, 0x00, 0x21, 0x0f, 0x48, 0xfd, 0xf0, 0x3c, 0xe2, 0x31, 0x00,
+    0x10, 0x00, 0xff, 0xf7, 0xbc, 0xfe, 0x31, 0x00, 0x00, 0x22, 0x80, 0x20,
+    0xa8, 0x75, 0x60, 0x19, 0xff, 0x01, 0x23, 0x23, 0x64, 0x8c, 0x4b, 0xa0,
+    0xe3, 0x64, 0x06, 0x4b, 0x90, 0x34, 0x28, 0x00, 0x23, 0x60, 0xb8, 0x09,
+    0x00, 0x70, 0x13, 0x00, 0x8c, 0x00, 0x40, 0x39, 0x95, 0x00, 0x10, 0xa0,
+    0x00, 0xf0, 0x07, 0x10, 0xd0, 0x01, 0x00, 0x0b, 0x78, 0x5b, 0x06, 0x05,
+    0xd1, 0x4b, 0x78, 0x05, 0x2b, 0x02, 0xd1, 0x8a, 0x78, 0x01, 0x4b, 0x1a,
+    0x60, 0x2a, 0x22, 0xf0, 0x0b, 0x11, 0x50, 0x07, 0x23, 0x08, 0x00, 0x10,
+    0xb5, 0xca, 0x78, 0x0c, 0x79, 0x49, 0x79, 0x92, 0x07, 0x19, 0x40, 0x09,
+    0x02, 0x80, 0x78, 0x92, 0x0f, 0x21, 0x43, 0xcc, 0x4d, 0x00, 0x20, 0x07,
+    0x00, 0xd0, 0x21, 0x00, 0xac, 0x50, 0x40, 0x10, 0xb5, 0x7f, 0x20, 0x0b,
+    0x52, 0xe0, 0x40, 0x00, 0xe4, 0x09, 0x11, 0x00, 0x00, 0x19, 0x1a, 0x00,
+    0x03, 0x4b, 0x40, 0x01, 0xc6, 0x13, 0x20, 0x1a, 0xf9, 0x28, 0x00, 0x00,
+    0x68, 0x00, 0x20, 0x7f, 0x22, 0x4c, 0x00, 0xf0, 0x14, 0x10, 0x40, 0xcc,
+    0x09, 0x11, 0x42, 0x03, 0xd1, 0x07, 0x49, 0x7d, 0x3a, 0x12, 0x1b, 0x8a,
+    0x66, 0x80, 0x22, 0x40, 0x00, 0x05, 0x4b, 0x00, 0x19, 0x40, 0x01, 0x00,
+    0x21, 0xc0, 0x18, 0x12, 0x01, 0x00, 0xf0, 0x9f, 0x30, 0x7f, 0x12, 0x20,
+    0x3c, 0x01, 0x04, 0x34, 0x00, 0x20, 0x11, 0x42, 0x50, 0x0f, 0xf2, 0x05,
+    0xc9, 0x09, 0x40, 0x00, 0x40, 0x18, 0x03, 0x49, 0x40, 0x01, 0x08, 0x18,
+    0xc2, 0x70, 0x02, 0x49, 0x00, 0xf0, 0x89, 0xf8, 0x5c, 0x00, 0xf1, 0x00,
+    0xff, 0xf7, 0xff, 0xff, 0xf8, 0xb5, 0x82, 0x8b, 0x43, 0x8a, 0x04, 0x00,
+    0x0f, 0x00, 0x16, 0xfc, 0x08, 0xf1, 0x13, 0x1e, 0x1c, 0xe1, 0x78, 0xb6,
+    0xb2, 0x0d, 0x00, 0x9b, 0x1b, 0x63, 0x82, 0x6b, 0x1e, 0x9d, 0x41, 0x01,
+    0x23, 0x80, 0x22, 0x4b, 0x40, 0xd2, 0x00, 0xe3, 0x70, 0x63, 0x78, 0x32,
+    0x43, 0x6d, 0x03, 0x15, 0x43, 0x4a, 0x1e, 0xf0, 0x02, 0x68, 0xb8, 0x01,
+    0x32, 0x00, 0x18, 0x18, 0xa1, 0x69, 0xfd, 0xf7, 0x80, 0xfe, 0xa3, 0x69,
+    0x9e, 0x19, 0x38, 0x02, 0x60, 0xa6, 0x61, 0x1d, 0x43, 0x63, 0x8a, 0x1c,
+    0x2e, 0x00, 0x60, 0x02, 0x80, 0x1d, 0x43, 0x00, 0x2f, 0x00, 0xd0, 0x2d,
+    0x04, 0x60, 0x1e, 0x20, 0x83, 0x68, 0x14, 0x08, 0x20, 0x1d, 0x68, 0x10,
+    0x0f, 0x80, 0x2d, 0x0c, 0x63, 0x78, 0xad, 0x05, 0xad, 0x0d, 0xdc, 0x3d,
+    0x90, 0xa3, 0x8a, 0xeb, 0x18, 0xa3, 0x82, 0xa3, 0x8b, 0xab, 0x5a, 0x3c,
+    0x30, 0x23, 0x63, 0x82, 0xe4, 0x08, 0xe3, 0xe3, 0x68, 0x89, 0x01, 0x59,
+    0x18, 0x2a, 0x00, 0xa0, 0x69, 0xfd, 0xf7, 0x52, 0xfe, 0x22, 0x00, 0x30,
+    0x69, 0x5b, 0x19, 0x22, 0x4e, 0x00, 0xc4, 0x72, 0xf0, 0x09, 0x0d, 0x4a,
+    0x5b, 0x04, 0x70, 0xb5, 0x13, 0x60, 0x0c, 0x4a, 0x0c, 0x49, 0x13, 0x60,
+    0x1c, 0x00, 0x8a, 0x68, 0x94, 0x43, 0xfb, 0xd1, 0x0a, 0x4d, 0xbc, 0x07,
+    0xf1, 0x07, 0x9c, 0x22, 0xfd, 0xf7, 0x32, 0xfe, 0x80, 0x22, 0x21, 0x00,
+    0x52, 0x01, 0x07, 0x48, 0xfd, 0xf7, 0x2c, 0xfe, 0x09, 0x23, 0x6b, 0x67,
+    0xbc, 0x01, 0x00, 0xf4, 0x04, 0x13, 0xf0, 0xf8, 0x04, 0x10, 0x00, 0x58,
+    0x02, 0x00, 0xb8, 0x03, 0x80, 0x03, 0x74, 0x43, 0x82, 0x83, 0x82, 0x83,
+    0x61, 0xde, 0x09, 0x10, 0x83, 0xaa, 0x32, 0xf4, 0x24, 0xd0, 0x1c, 0x68,
+    0x21, 0x40, 0x00, 0x2a, 0x1a, 0xd0, 0x80, 0x24, 0xe4, 0x00, 0x11, 0x43,
+    0x22, 0x42, 0x15, 0xd0, 0x1a, 0x68, 0x22, 0x42, 0x09, 0xd0, 0x7f, 0x22,
+    0x81, 0x78, 0x09, 0x48, 0xcb, 0x09, 0x11, 0x40, 0x09, 0x4a, 0x9b, 0x00,
+    0x9a, 0x58, 0xfc, 0xf7, 0xc2, 0xfe, 0x07, 0x4a, 0x0a, 0x40, 0x1a, 0x60,
+    0xce, 0x2d, 0x00, 0x02, 0x00, 0xf0, 0x0d, 0x83, 0x68, 0x19, 0x60, 0x10,
+    0xbd, 0xe8, 0x00, 0x01, 0x10, 0x94, 0x05, 0x00, 0x20, 0xff, 0xfb, 0xff,
+    0xff, 0x43, 0x68, 0x70, 0xb5, 0x00, 0x21, 0x80, 0x25, 0x1e, 0x68, 0x54,
+    0x16, 0xf3, 0x12, 0x48, 0xff, 0x13, 0x4b, 0x6d, 0x01, 0x1a, 0x6c, 0x05,
+    0x43, 0x00, 0x23, 0x92, 0x07, 0x03, 0xd4, 0xa2, 0x78, 0x01, 0x33, 0xd2,
+    0x09, 0x9b, 0x1a, 0x62, 0x8a, 0x00, 0x2a, 0x13, 0xd0, 0x00, 0x2b, 0x11,
+    0xae, 0x38, 0xf0, 0x05, 0x34, 0xff, 0x0a, 0x4b, 0x05, 0x43, 0x1e, 0x40,
+    0xa0, 0x23, 0xdb, 0x05, 0x62, 0x68, 0x33, 0x43, 0x13, 0x60, 0x00, 0x21,
+    0x7d, 0x79, 0x00, 0xc0, 0x16, 0x60, 0x70, 0xbd, 0x04, 0x4b, 0x1e, 0x40,
+    0xa2, 0x02, 0x00, 0x08, 0x17, 0x00, 0xcc, 0x00, 0x80, 0xff, 0xff, 0xff,
+    0xdf, 0xff, 0xff, 0xff, 0xaf, 0xec, 0x18, 0xa0, 0x83, 0x82, 0x01, 0x33,
+    0x42, 0x82, 0x03, 0x74, 0x81, 0x61, 0x08, 0x2d, 0x00, 0x8c, 0x09, 0xf3,
+    0x1e, 0x05, 0x7c, 0x04, 0x00, 0x00, 0x2d, 0x06, 0xd1, 0x7f, 0x23, 0x81,
+    0x78, 0x0f, 0x4a, 0x0f, 0x48, 0x19, 0x40, 0xfc, 0xf7, 0x64, 0xfe, 0x83,
+    0x68, 0x00, 0x21, 0x1b, 0x68, 0xff, 0xf7, 0x32, 0xff, 0x63, 0x68, 0x1b,
+    0x68, 0x5b, 0x00, 0x06, 0xd5, 0xa3, 0x8b, 0x83, 0x42, 0x03, 0x80, 0x00,
+    0x20, 0x27, 0xff, 0xc8, 0x01, 0x00, 0x64, 0x4e, 0x00, 0x58, 0x21, 0x00,
+    0x0e, 0x14, 0x00, 0x44, 0x01, 0x00, 0xd4, 0x00, 0x20, 0x07, 0x01, 0x8c,
+    0x03, 0x40, 0x00, 0xf0, 0x03, 0xf8, 0x06, 0x00, 0xa0, 0x00, 0xf8, 0x06,
+    0x20, 0x10, 0xb5, 0x01, 0xf0, 0x1b, 0xfc, 0xf4, 0x06, 0x20, 0x05, 0xfe,
+    0x36, 0x20, 0x60, 0x04, 0x00, 0xfa, 0xf7, 0x38, 0xff, 0x88, 0x3a, 0xf0,
+    0x43, 0x00, 0xf0, 0x01, 0xf8, 0x70, 0xbd, 0xf8, 0xb5, 0x00, 0x25, 0x0e,
+    0x00, 0x0c, 0x0c, 0x13, 0x0c, 0xac, 0x42, 0x32, 0xd1, 0xab, 0x42, 0x21,
+    0xd1, 0xb6, 0xb2, 0x91, 0xb2, 0x71, 0x43, 0x00, 0xf0, 0xad, 0xf9, 0x04,
+    0x1e, 0x32, 0xd0, 0x03, 0x00, 0x08, 0x3b, 0x5a, 0x68, 0x03, 0x23, 0x9a,
+    0x43, 0x04, 0x3a, 0x24, 0x2a, 0x31, 0xd8, 0x03, 0x00, 0x13, 0x2a, 0x0a,
+    0xd9, 0x05, 0x60, 0x45, 0x60, 0x08, 0x33, 0x1b, 0x2a, 0x05, 0xd9, 0x85,
+    0x60, 0xc5, 0x60, 0x24, 0x2a, 0x20, 0xd0, 0x03, 0x00, 0x10, 0x33, 0xae,
+    0x3e, 0xf0, 0x15, 0x5a, 0x60, 0x9a, 0x60, 0x17, 0xe0, 0x1c, 0x1c, 0xb1,
+    0xb2, 0xb6, 0xb2, 0x92, 0xb2, 0x72, 0x43, 0xa3, 0xb2, 0x4b, 0x43, 0x11,
+    0x0c, 0x5b, 0x18, 0x19, 0x0c, 0x07, 0xd1, 0x19, 0x04, 0x92, 0xb2, 0x11,
+    0x43, 0xd1, 0xe7, 0xfc, 0x53, 0xe0, 0x91, 0xb2, 0xee, 0xe7, 0x00, 0xf0,
+    0x0e, 0xf8, 0x0c, 0x23, 0x00, 0x24, 0x03, 0x60, 0x24, 0x15, 0xf1, 0x08,
+    0x03, 0x00, 0x05, 0x61, 0x18, 0x33, 0x45, 0x61, 0xdb, 0xe7, 0x00, 0x21,
+    0xfd, 0xf7, 0x1e, 0xfd, 0xf4, 0xe7, 0x10, 0xb5, 0xfa, 0xf7, 0xe2, 0xd8,
+    0x10, 0x00, 0x3c, 0x01, 0x20, 0x04, 0x00, 0x96, 0x53, 0xf0, 0x1b, 0x83,
+    0x60, 0x81, 0x81, 0x83, 0x66, 0x19, 0x00, 0xc2, 0x81, 0x03, 0x61, 0x43,
+    0x61, 0x83, 0x61, 0x08, 0x22, 0x60, 0x30, 0xfd, 0xf7, 0x07, 0xfd, 0x05,
+    0x4b, 0x24, 0x62, 0x63, 0x62, 0x04, 0x4b, 0xa3, 0x62, 0x04, 0x4b, 0xe3,
+    0x62, 0x04, 0x4b, 0x23, 0x63, 0x7c, 0x04, 0xe1, 0x1d, 0xb3, 0x00, 0x10,
+    0x49, 0xb3, 0x00, 0x10, 0x81, 0xb3, 0x00, 0x10, 0xad, 0xb3, 0x1c, 0x37,
+    0x41, 0x49, 0x00, 0xf0, 0x0f, 0x98, 0x04, 0xf0, 0x09, 0x6d, 0xd1, 0x00,
+    0x10, 0x83, 0x6e, 0x10, 0xb5, 0xdb, 0x07, 0x05, 0xd4, 0x83, 0x89, 0x9b,
+    0x05, 0x02, 0xd4, 0x58, 0x30, 0x05, 0xf0, 0xb5, 0xff, 0xdc, 0x18, 0x0e,
+    0x18, 0x00, 0x11, 0xad, 0x18, 0x00, 0x90, 0x70, 0xb5, 0x70, 0x25, 0x4a,
+    0x1e, 0x55, 0x43, 0x0e, 0xde, 0x3e, 0x90, 0x31, 0x00, 0xf0, 0x1b, 0xf9,
+    0x04, 0x1e, 0x08, 0xd0, 0xfe, 0x01, 0xe0, 0x01, 0x60, 0x46, 0x60, 0x10,
+    0x30, 0xa0, 0x60, 0x70, 0x32, 0xfd, 0xf7, 0xc0, 0xfc, 0xde, 0x3b, 0x00,
+    0xf6, 0x17, 0x00, 0x4c, 0x23, 0x51, 0xc5, 0xff, 0x10, 0xbd, 0x98, 0x98,
+    0x01, 0x51, 0x02, 0x48, 0x05, 0xf0, 0x85, 0x98, 0x37, 0x10, 0x50, 0x54,
+    0x5a, 0x01, 0x10, 0x00, 0x1b, 0x81, 0x10, 0x00, 0x11, 0x75, 0x10, 0x00,
+    0x15, 0x58, 0x10, 0x00, 0x15, 0x71, 0x10, 0x00, 0x00, 0x90, 0x56, 0x60,
+    0xff, 0xf7, 0xec, 0xff, 0xa3, 0x69, 0x50, 0x06, 0x00, 0xd0, 0x7c, 0xa2,
+    0x13, 0xbd, 0x15, 0x4a, 0xa2, 0x62, 0x22, 0x00, 0xd8, 0x32, 0x10, 0x45,
+    0xe0, 0x13, 0x4b, 0x1b, 0x68, 0x01, 0x93, 0xa3, 0x42, 0x01, 0xd1, 0x01,
+    0x23, 0xa3, 0x61, 0xca, 0x05, 0x40, 0x1f, 0xf8, 0x60, 0x60, 0x08, 0x00,
+    0x31, 0x1b, 0xf8, 0xa0, 0x08, 0x00, 0xf0, 0x13, 0x17, 0xf8, 0x00, 0x22,
+    0x04, 0x21, 0xe0, 0x60, 0x60, 0x68, 0xff, 0xf7, 0x55, 0xff, 0x01, 0x22,
+    0x09, 0x21, 0xa0, 0x68, 0xff, 0xf7, 0x50, 0xff, 0x02, 0x22, 0x12, 0x21,
+    0xe0, 0x68, 0xff, 0xf7, 0x4b, 0xff, 0x3a, 0x00, 0x10, 0xd0, 0xe2, 0x40,
+    0x10, 0x10, 0xb4, 0x00, 0xd0, 0xf8, 0xb5, 0x07, 0x00, 0xff, 0xf7, 0xa2,
+    0xff, 0x1f, 0x4b, 0x1e, 0x68, 0xb3, 0x78, 0x00, 0x10, 0xd1, 0x68, 0x0b,
+    0xf0, 0x21, 0xba, 0xff, 0xd8, 0x36, 0xb4, 0x68, 0x73, 0x68, 0x01, 0x3b,
+    0x04, 0xd5, 0x33, 0x68, 0x00, 0x2b, 0x22, 0xd0, 0x36, 0x68, 0xf6, 0xe7,
+    0x0c, 0x22, 0xa5, 0x5e, 0x00, 0x2d, 0x1a, 0xd1, 0x20, 0x00, 0x15, 0x4b,
+    0x58, 0x30, 0xe3, 0x60, 0xa5, 0x66, 0x05, 0xf0, 0x09, 0xff, 0xff, 0xf7,
+    0x8b, 0xff, 0x9e, 0x55, 0x73, 0x29, 0x00, 0x25, 0x60, 0xa5, 0x60, 0x65,
+    0xca, 0x50, 0x00, 0xb4, 0x01, 0xa0, 0x2d, 0xfc, 0x65, 0x63, 0xa5, 0x63,
+    0xa5, 0x64, 0xe5, 0x64, 0xfe, 0x01, 0x60, 0x70, 0x34, 0xd7, 0xe7, 0x04,
+    0x21, 0xac, 0x13, 0x80, 0x4d, 0xff, 0x04, 0x1e, 0x30, 0x60, 0xd5, 0xd1,
+    0xb4, 0x58, 0x80, 0x0c, 0x23, 0x3b, 0x60, 0xef, 0xe7, 0xc0, 0x46, 0x8c,
+    0x00, 0x40, 0x01, 0x00, 0xff, 0xff, 0x9c, 0x05, 0x60, 0x5b, 0xff, 0xfa,
+    0xf7, 0xd7, 0xfd, 0xc8, 0x01, 0x11, 0x10, 0x60, 0x5a, 0x20, 0x19, 0x9b,
+    0xd8, 0x01, 0xd1, 0xfa, 0xf7, 0xcd, 0xfd, 0x03, 0x49, 0x00, 0xf0, 0x06,
+    0xf8, 0xff, 0xf7, 0x52, 0x34, 0x01, 0x20, 0x31, 0x9b, 0x14, 0x40, 0xf0,
+    0x07, 0xd8, 0x30, 0x04, 0x00, 0x00, 0x26, 0x01, 0x91, 0xa5, 0x68, 0x67,
+    0x68, 0x01, 0x3f, 0x04, 0xd5, 0x24, 0x68, 0x00, 0x2c, 0xf8, 0xd1, 0x62,
+    0x0e, 0xf0, 0x01, 0xab, 0x89, 0x01, 0x2b, 0x07, 0xd9, 0x0e, 0x22, 0xab,
+    0x5e, 0x01, 0x33, 0x03, 0xd0, 0x28, 0x00, 0x34, 0x77, 0x60, 0x06, 0x43,
+    0x70, 0x35, 0xeb, 0xe7, 0x56, 0x10, 0x10, 0x06, 0x66, 0x3b, 0xf2, 0x00,
+    0x91, 0xd8, 0x34, 0x63, 0x68, 0xa5, 0x68, 0x00, 0x93, 0x00, 0x9b, 0x01,
+    0x3b, 0x00, 0x93, 0x3e, 0x00, 0x33, 0xf5, 0xd1, 0x38, 0x3e, 0x00, 0x13,
+    0x08, 0x3e, 0x00, 0x20, 0x04, 0xd0, 0x86, 0x0f, 0x00, 0x40, 0x00, 0x60,
+    0x07, 0x43, 0x70, 0x35, 0xe8, 0xe7, 0xac, 0x02, 0x40, 0xfa, 0xf7, 0x85,
+    0xfd, 0x64, 0x03, 0x22, 0x0a, 0xf8, 0xa6, 0x0d, 0x91, 0xfa, 0xf7, 0x7d,
+    0xfd, 0x21, 0x00, 0x03, 0xf0, 0xac, 0x44, 0x57, 0xf1, 0x0e, 0x0b, 0x00,
+    0xf0, 0xb5, 0x0b, 0x33, 0x85, 0xb0, 0x01, 0x90, 0x16, 0x2b, 0x09, 0xd9,
+    0x07, 0x22, 0x93, 0x43, 0x00, 0x93, 0x07, 0xd5, 0x0c, 0x23, 0x01, 0x9a,
+    0x13, 0x60, 0x00, 0x0a, 0x0c, 0x20, 0x10, 0x23, 0x76, 0x00, 0xf0, 0x25,
+    0x99, 0x42, 0xf4, 0xd8, 0x01, 0x98, 0x00, 0xf0, 0xf7, 0xf9, 0xfc, 0x23,
+    0x00, 0x99, 0xbd, 0x4a, 0x5b, 0x00, 0x99, 0x42, 0x19, 0xd2, 0xcf, 0x08,
+    0x08, 0x31, 0x51, 0x18, 0x08, 0x00, 0x4c, 0x68, 0x08, 0x38, 0x84, 0x42,
+    0x03, 0xd1, 0xcc, 0x68, 0x02, 0x37, 0xa1, 0x42, 0x25, 0xd0, 0x03, 0x23,
+    0x62, 0x68, 0xa1, 0x68, 0xc6, 0x48, 0xf0, 0x09, 0xe2, 0x68, 0xca, 0x60,
+    0x91, 0x60, 0x01, 0x22, 0xe3, 0x18, 0x59, 0x68, 0x0a, 0x43, 0x5a, 0x60,
+    0x56, 0xe0, 0x00, 0x9b, 0x59, 0x0a, 0x3f, 0x23, 0xd8, 0x49, 0xf0, 0x61,
+    0x04, 0x29, 0x29, 0xd8, 0x00, 0x9b, 0x9b, 0x09, 0x38, 0x33, 0x03, 0x27,
+    0xd8, 0x00, 0x80, 0x18, 0xc4, 0x68, 0x84, 0x42, 0x06, 0xd0, 0x61, 0x68,
+    0x00, 0x9d, 0xb9, 0x43, 0x4e, 0x1b, 0x0f, 0x2e, 0x35, 0xdd, 0x01, 0x3b,
+    0x5f, 0x1c, 0x14, 0x69, 0xa2, 0x49, 0x8c, 0x42, 0x5b, 0xd0, 0x03, 0x23,
+    0x60, 0x68, 0x98, 0x43, 0x03, 0x00, 0x00, 0x98, 0x1d, 0x1a, 0x0f, 0x2d,
+    0x3a, 0xdd, 0x01, 0x26, 0x00, 0x9f, 0x20, 0x18, 0x37, 0x43, 0x2e, 0x43,
+    0x67, 0x60, 0x50, 0x61, 0x10, 0x61, 0xc1, 0x60, 0x81, 0x60, 0x46, 0x60,
+    0xe5, 0x50, 0x25, 0xe0, 0x14, 0x29, 0x02, 0xd8, 0x0b, 0x00, 0x5b, 0x33,
+    0xd3, 0xe7, 0x54, 0x29, 0x03, 0xd8, 0x00, 0x9b, 0x1b, 0x0b, 0x6e, 0x33,
+    0xcd, 0xe7, 0xaa, 0x23, 0xb4, 0x00, 0x00, 0x10, 0x00, 0xd0, 0xdb, 0x0b,
+    0x77, 0x33, 0xc5, 0xe7, 0x8e, 0x48, 0x7e, 0x23, 0x81, 0x42, 0xc1, 0x82,
+    0x00, 0xf0, 0x0b, 0x0c, 0x7c, 0x33, 0xbd, 0xe7, 0xe5, 0x68, 0x00, 0x2e,
+    0x0d, 0xdb, 0xa3, 0x68, 0x61, 0x18, 0xdd, 0x60, 0xab, 0x60, 0x01, 0x23,
+    0x4a, 0x68, 0x13, 0x43, 0x4b, 0x22, 0x0d, 0xf0, 0x18, 0xf0, 0x85, 0xf9,
+    0x20, 0x00, 0x08, 0x30, 0x78, 0xe7, 0x2c, 0x00, 0xae, 0xe7, 0x51, 0x61,
+    0x11, 0x61, 0x00, 0x2d, 0x96, 0xda, 0x51, 0x68, 0x8c, 0x46, 0x80, 0x21,
+    0x89, 0x00, 0x8b, 0x42, 0x00, 0xd3, 0x82, 0xe0, 0x58, 0x09, 0xd9, 0x08,
+    0xba, 0x3f, 0xf1, 0x68, 0x60, 0x46, 0xc9, 0x00, 0x03, 0x43, 0x53, 0x60,
+    0x8a, 0x18, 0x93, 0x68, 0xe2, 0x60, 0xa3, 0x60, 0x94, 0x60, 0xdc, 0x60,
+    0x01, 0x22, 0x71, 0x49, 0xbb, 0x10, 0x48, 0x68, 0x9a, 0x40, 0x90, 0x42,
+    0x27, 0xd3, 0x02, 0x42, 0x05, 0xd1, 0x03, 0x23, 0x9f, 0x43, 0x52, 0x00,
+    0x04, 0x37, 0x02, 0x42, 0xfb, 0xd0, 0xfe, 0x00, 0x8e, 0x19, 0xb4, 0x46,
+    0x02, 0x97, 0x63, 0x46, 0xdc, 0x68, 0x64, 0x45, 0x00, 0xd0, 0x93, 0xe0,
+    0x08, 0x23, 0x03, 0x20, 0x9c, 0x44, 0x02, 0x9b, 0x01, 0x33, 0x02, 0x93,
+    0x03, 0x42, 0xf2, 0xd1, 0x03, 0x23, 0x1f, 0x42, 0x00, 0xd0, 0xad, 0xe0,
+    0x4b, 0x68, 0x93, 0x43, 0x4b, 0x60, 0x5e, 0x4b, 0x52, 0x00, 0x5b, 0x68,
+    0x93, 0x42, 0x02, 0xd3, 0x00, 0x2a, 0x00, 0xd0, 0xae, 0xe0, 0x03, 0x23,
+    0x8e, 0x68, 0x72, 0x6a, 0x01, 0x20, 0x02, 0x92, 0x68, 0x19, 0xf0, 0x0a,
+    0x03, 0xd3, 0x99, 0x1a, 0x0f, 0x29, 0x00, 0xdd, 0x11, 0xe1, 0x02, 0x9b,
+    0x56, 0x4f, 0xf3, 0x18, 0x3a, 0x68, 0x03, 0x93, 0x00, 0x9b, 0x9d, 0x18,
+    0x54, 0x92, 0x03, 0x90, 0x33, 0x00, 0xd0, 0x97, 0xe0, 0x10, 0x35, 0x29,
+    0x00, 0xc0, 0x56, 0xf0, 0x12, 0xc4, 0xf8, 0x04, 0x00, 0x43, 0x1c, 0x00,
+    0xd1, 0xd2, 0xe0, 0x03, 0x9b, 0x83, 0x42, 0x03, 0xd9, 0x48, 0x4b, 0x9e,
+    0x42, 0x00, 0xd0, 0xcb, 0xe0, 0x7b, 0x68, 0xea, 0x18, 0x03, 0x9b, 0x7a,
+    0x60, 0xa3, 0xd4, 0x20, 0xf0, 0x92, 0xe0, 0x1b, 0x05, 0x00, 0xd0, 0x8e,
+    0xe0, 0x41, 0x4b, 0x9a, 0x68, 0x02, 0x9b, 0x5d, 0x19, 0x01, 0x23, 0x1d,
+    0x43, 0x55, 0x60, 0x40, 0x4b, 0x5a, 0x68, 0xd9, 0x6a, 0x8a, 0x42, 0x00,
+    0xd9, 0xda, 0x62, 0x19, 0x6b, 0x8a, 0x42, 0x00, 0xd8, 0xb0, 0xe0, 0x1a,
+    0x63, 0xae, 0xe0, 0x58, 0x0a, 0x04, 0x28, 0x12, 0xd8, 0x99, 0x09, 0x38,
+    0x31, 0xcd, 0x00, 0xad, 0x18, 0xa8, 0x68, 0x03, 0x26, 0x85, 0x42, 0x25,
+    0xd1, 0x01, 0x23, 0x89, 0x10, 0x8b, 0x40, 0x61, 0x46, 0x0b, 0x43, 0x53,
+    0x60, 0xe5, 0x60, 0xa0, 0x60, 0xac, 0x60, 0xc4, 0x60, 0x74, 0xe7, 0x14,
+    0x28, 0x02, 0xd8, 0x01, 0x00, 0x5b, 0x31, 0xe9, 0xe7, 0x54, 0x28, 0x02,
+    0xd8, 0x19, 0x0b, 0x6e, 0x31, 0xe4, 0xe7, 0xaa, 0x21, 0x49, 0x00, 0x88,
+    0x42, 0x02, 0xd8, 0xd9, 0x0b, 0x77, 0x31, 0xdd, 0xe7, 0x26, 0x4d, 0x7e,
+    0x21, 0xa8, 0x42, 0xd9, 0xd8, 0x99, 0x0c, 0x7c, 0x31, 0xd6, 0xe7, 0x80,
+    0x68, 0x85, 0x42, 0x03, 0xd0, 0x42, 0x68, 0xb2, 0x43, 0x9a, 0x42, 0xf8,
+    0xd8, 0xc5, 0x68, 0xd9, 0xe7, 0x03, 0x20, 0x63, 0x68, 0x83, 0x43, 0x0e,
+    0x02, 0x51, 0xe0, 0x68, 0x0f, 0x2d, 0x10, 0x10, 0x02, 0xf6, 0x13, 0x00,
+    0x9a, 0x37, 0x43, 0x67, 0x60, 0xa7, 0x68, 0xa2, 0x18, 0xf8, 0x60, 0x87,
+    0x60, 0x4a, 0x61, 0x0a, 0x61, 0x13, 0x49, 0x2e, 0x43, 0xd1, 0x60, 0x91,
+    0x60, 0x56, 0x60, 0xf1, 0xe6, 0x00, 0x2d, 0x08, 0xdb, 0x8a, 0x02, 0xf0,
+    0x5f, 0xa3, 0x68, 0xd8, 0x60, 0x83, 0x60, 0x0e, 0xe7, 0x04, 0x00, 0x42,
+    0xe7, 0x33, 0x68, 0x08, 0x3e, 0x01, 0x3f, 0xb3, 0x42, 0x00, 0xd1, 0x47,
+    0xe7, 0x4d, 0xe7, 0x04, 0x37, 0x52, 0x00, 0x1a, 0x42, 0xfb, 0xd0, 0x30,
+    0xe7, 0x02, 0x9f, 0xfa, 0xe7, 0x07, 0x4b, 0xed, 0x18, 0x2d, 0x0b, 0x2d,
+    0x03, 0x63, 0xe7, 0x98, 0x06, 0x00, 0x20, 0xa0, 0x06, 0x00, 0x20, 0x54,
+    0x05, 0x00, 0x00, 0xec, 0x0d, 0x00, 0x20, 0x90, 0x06, 0x00, 0x20, 0x0f,
+    0x10, 0x00, 0x00, 0x33, 0x4b, 0x19, 0x68, 0x01, 0x31, 0x3d, 0xd1, 0x1c,
+    0x60, 0x07, 0x22, 0x27, 0x00, 0x00, 0x23, 0x17, 0x40, 0x14, 0x42, 0x02,
+    0xd0, 0x08, 0x33, 0xdb, 0x1b, 0xe4, 0x18, 0x62, 0x19, 0x9d, 0x1a, 0x2d,
+    0x05, 0x2d, 0x0d, 0x74, 0x01, 0xe1, 0x03, 0x92, 0x01, 0xf0, 0x09, 0xf8,
+    0x43, 0x1c, 0x07, 0xd1, 0x3d, 0x1e, 0x03, 0x98, 0xa8, 0x29, 0xf0, 0x32,
+    0x25, 0x03, 0x9b, 0x08, 0x38, 0x18, 0x18, 0x24, 0x4a, 0x00, 0x1b, 0x53,
+    0x68, 0x5b, 0x19, 0x53, 0x60, 0x01, 0x22, 0x22, 0x4b, 0x45, 0x19, 0x15,
+    0x43, 0x9c, 0x60, 0x65, 0x60, 0x9e, 0x42, 0x00, 0xd1, 0x48, 0xe7, 0x02,
+    0x9b, 0x0f, 0x2b, 0x15, 0xd8, 0x62, 0x60, 0x03, 0x22, 0x1b, 0x4b, 0x9b,
+    0x68, 0x5b, 0x68, 0x93, 0x43, 0x00, 0x9a, 0x99, 0x1a, 0x93, 0x42, 0x01,
+    0xd3, 0x0f, 0x29, 0x1e, 0xdc, 0xa0, 0x02, 0xf0, 0x41, 0x35, 0xf8, 0x29,
+    0xe6, 0x03, 0x9b, 0xe3, 0x1a, 0x9b, 0x18, 0x12, 0x4a, 0x53, 0x60, 0xbc,
+    0xe7, 0x07, 0x21, 0x02, 0x9b, 0x0c, 0x3b, 0x8b, 0x43, 0x71, 0x68, 0x0a,
+    0x40, 0x05, 0x21, 0x1a, 0x43, 0x72, 0x60, 0xf2, 0x18, 0x51, 0x60, 0x91,
+    0x60, 0x0f, 0x2b, 0x00, 0xd8, 0x20, 0xe7, 0x31, 0x00, 0x01, 0x98, 0x08,
+    0x31, 0x03, 0xf0, 0xac, 0xf9, 0x1a, 0xe7, 0x01, 0x22, 0x06, 0x48, 0x00,
+    0x9b, 0x84, 0x68, 0x13, 0x43, 0x63, 0x60, 0x00, 0x9b, 0xe3, 0x18, 0x83,
+    0x60, 0x2c, 0xe6, 0xc0, 0x46, 0xd8, 0x00, 0x00, 0xe0, 0x00, 0x00, 0xf0,
+    0x00, 0x02, 0xfc, 0x05, 0x20, 0x6f, 0xfc, 0xc8, 0x04, 0x15, 0x38, 0x0c,
+    0x06, 0x15, 0x6b, 0x10, 0x00, 0xe0, 0xf0, 0xb5, 0x1e, 0x00, 0x00, 0x23,
+    0x14, 0x00, 0x8b, 0xb0, 0x9e, 0x42, 0x04, 0xda, 0x40, 0x34, 0xf0, 0x4d,
+    0x73, 0x18, 0x1e, 0x00, 0x2d, 0x23, 0x12, 0x9a, 0x14, 0x9f, 0x13, 0x70,
+    0x20, 0x23, 0x03, 0x22, 0x9f, 0x43, 0x46, 0x2f, 0x07, 0xd0, 0x3b, 0x00,
+    0x45, 0x3b, 0x59, 0x42, 0x4b, 0x41, 0x10, 0x99, 0x01, 0x3a, 0xcb, 0x18,
+    0x10, 0x93, 0x09, 0xab, 0x04, 0x93, 0x08, 0xab, 0x03, 0x93, 0x13, 0x9b,
+    0x00, 0x92, 0x02, 0x93, 0x10, 0x9b, 0x22, 0x00, 0x01, 0x93, 0x33, 0x00,
+    0x02, 0xf0, 0x8a, 0xf9, 0x05, 0x00, 0x47, 0x2f, 0x02, 0xd1, 0x11, 0x9b,
+    0xdb, 0x07, 0x28, 0xd5, 0x10, 0x9b, 0xeb, 0x18, 0x07, 0x93, 0x46, 0x2f,
+    0x14, 0xd1, 0x2b, 0x78, 0x30, 0x2b, 0x0c, 0xd1, 0x4e, 0x2e, 0xf6, 0x11,
+    0x20, 0x00, 0x31, 0x00, 0xfc, 0xf7, 0x11, 0xfd, 0x00, 0x28, 0x04, 0xd1,
+    0x01, 0x23, 0x10, 0x9a, 0x9b, 0x1a, 0x13, 0x9a, 0x13, 0x60, 0x13, 0x9b,
+    0x07, 0x9a, 0x1b, 0x68, 0xd3, 0x18, 0x07, 0x93, 0x24, 0x00, 0x10, 0xff,
+    0x68, 0x4b, 0xf0, 0x0a, 0xd0, 0x07, 0x9b, 0x09, 0x93, 0x30, 0x22, 0x09,
+    0x9b, 0x07, 0x99, 0x8b, 0x42, 0x06, 0xd3, 0x28, 0x00, 0x09, 0x9b, 0x15,
+    0x9a, 0x5b, 0x1b, 0x13, 0x60, 0x6c, 0x22, 0xf0, 0x01, 0x59, 0x1c, 0x09,
+    0x91, 0x1a, 0x70, 0xf0, 0xe7, 0xf0, 0xb5, 0x83, 0x1c, 0x87, 0xb0, 0x03,
+    0x93, 0x2a, 0x12, 0xf0, 0x43, 0x2b, 0x23, 0x02, 0x70, 0x00, 0x29, 0x01,
+    0xda, 0x4c, 0x42, 0x02, 0x33, 0x6b, 0x70, 0x09, 0x2c, 0x31, 0xdd, 0x0a,
+    0x27, 0x04, 0xab, 0xde, 0x1d, 0x20, 0x00, 0x39, 0x00, 0x01, 0x96, 0xfc,
+    0xf7, 0xf6, 0xf9, 0x01, 0x3e, 0x30, 0x31, 0x20, 0x00, 0x31, 0x70, 0x39,
+    0x00, 0x02, 0x94, 0xfc, 0xf7, 0xee, 0xf9, 0x02, 0x9b, 0x04, 0x00, 0x63,
+    0x2b, 0xee, 0xdc, 0x01, 0x9b, 0x30, 0x34, 0x9a, 0x1e, 0x13, 0x00, 0x03,
+    0x99, 0x14, 0x70, 0x04, 0xa8, 0x07, 0x30, 0x98, 0x42, 0x0e, 0xd8, 0x04,
+    0xab, 0x07, 0x33, 0xd8, 0x11, 0xf0, 0x03, 0x04, 0xd8, 0x04, 0xab, 0x09,
+    0x30, 0xc0, 0x18, 0x01, 0x9b, 0xc0, 0x1a, 0x03, 0x9b, 0x18, 0x18, 0x40,
+    0x1b, 0x28, 0x2a, 0xf0, 0x45, 0x18, 0x78, 0x01, 0x33, 0x08, 0x70, 0x01,
+    0x31, 0xe7, 0xe7, 0x30, 0x23, 0xe4, 0x18, 0xab, 0x70, 0x28, 0x1d, 0xec,
+    0x70, 0xf1, 0xe7, 0xf0, 0xb5, 0x95, 0xb0, 0x0c, 0x00, 0x08, 0x92, 0x1a,
+    0x9d, 0x09, 0x93, 0x07, 0x00, 0x03, 0xf0, 0x99, 0xfe, 0x03, 0x68, 0x18,
+    0x00, 0x0b, 0x93, 0x01, 0xf0, 0x3c, 0xf8, 0x00, 0x23, 0x12, 0x93, 0x23,
+    0x7e, 0x07, 0x22, 0x1e, 0x00, 0x23, 0x68, 0x0d, 0x90, 0x0c, 0x93, 0x0c,
+    0x99, 0x2b, 0x68, 0xc9, 0x05, 0x47, 0xd5, 0x9b, 0x18, 0x93, 0x43, 0x1a,
+    0x00, 0x08, 0x32, 0x2a, 0x60, 0x68, 0x5e, 0xf2, 0x19, 0xa2, 0x64, 0xe3,
+    0x64, 0x01, 0x22, 0xa3, 0x6c, 0xe5, 0x6c, 0x0a, 0x93, 0x6b, 0x00, 0x5b,
+    0x08, 0x0e, 0x93, 0x0a, 0x98, 0xa8, 0x4b, 0x0e, 0x99, 0x52, 0x42, 0xfc,
+    0xf7, 0x97, 0xfc, 0x00, 0x28, 0x31, 0xd1, 0x01, 0x22, 0xa4, 0x4b, 0x0a,
+    0x98, 0x12, 0x00, 0x51, 0x79, 0xfc, 0x00, 0x28, 0x28, 0x5c, 0x01, 0x80,
+    0x29, 0x00, 0x0a, 0x98, 0xfc, 0xf7, 0x6b, 0xfc, 0x1e, 0x13, 0xf0, 0x27,
+    0x23, 0x00, 0x2d, 0x22, 0x43, 0x33, 0x1a, 0x70, 0x9b, 0x4d, 0x47, 0x2e,
+    0x00, 0xd9, 0x9a, 0x4d, 0x03, 0x23, 0x0c, 0x9a, 0x23, 0x61, 0x01, 0x33,
+    0x9a, 0x43, 0x00, 0x23, 0x22, 0x60, 0x0a, 0x93, 0x09, 0x9b, 0x21, 0x00,
+    0x00, 0x93, 0x38, 0x00, 0x08, 0x9b, 0x13, 0xaa, 0x00, 0xf0, 0xf3, 0xf9,
+    0x43, 0x1c, 0x00, 0xd0, 0x9e, 0xe0, 0xb0, 0x3d, 0xf0, 0x00, 0x15, 0xb0,
+    0xf0, 0xbd, 0x07, 0x33, 0xb6, 0xe7, 0x0a, 0x9a, 0x2b, 0x00, 0x10, 0x00,
+    0x29, 0x3e, 0x26, 0x11, 0xfc, 0x08, 0x12, 0x34, 0x2d, 0x03, 0xda, 0x56,
+    0x00, 0xf0, 0x2f, 0x87, 0x4d, 0x47, 0x2e, 0xd5, 0xd9, 0x87, 0x4d, 0xd3,
+    0xe7, 0x20, 0x22, 0x31, 0x00, 0x63, 0x68, 0x91, 0x43, 0x0e, 0x91, 0x5a,
+    0x1c, 0x47, 0xd1, 0x07, 0x33, 0x63, 0x60, 0x80, 0x23, 0x0c, 0x9a, 0xdb,
+    0x00, 0x13, 0x43, 0x00, 0x22, 0x06, 0x92, 0x12, 0xaa, 0x05, 0x92, 0x11,
+    0xaa, 0x03, 0x92, 0x23, 0x22, 0x08, 0xa9, 0x23, 0x60, 0x01, 0x93, 0x63,
+    0x68, 0x52, 0x18, 0x02, 0x92, 0x78, 0x00, 0xf0, 0x1b, 0x2b, 0x00, 0x0a,
+    0x9a, 0x04, 0x96, 0xff, 0xf7, 0xbe, 0xfe, 0x0e, 0x9b, 0x05, 0x00, 0x11,
+    0x99, 0x47, 0x2b, 0x08, 0xd1, 0xcb, 0x1c, 0x02, 0xdb, 0x63, 0x68, 0x99,
+    0x42, 0x46, 0xdd, 0x33, 0x00, 0x02, 0x3b, 0xdb, 0xb2, 0x1e, 0x00, 0x65,
+    0x2e, 0x24, 0xd8, 0x80, 0x17, 0xf0, 0x17, 0x01, 0x39, 0x50, 0x30, 0x11,
+    0x91, 0xff, 0xf7, 0x0a, 0xff, 0x12, 0x9a, 0x0a, 0x90, 0x13, 0x18, 0x23,
+    0x61, 0x01, 0x2a, 0x02, 0xdc, 0x22, 0x68, 0xd2, 0x07, 0x01, 0xd5, 0x01,
+    0x33, 0x23, 0x61, 0x23, 0x23, 0x08, 0xaa, 0x9b, 0x18, 0x0e, 0x5e, 0x44,
+    0x00, 0xd1, 0x91, 0xe7, 0xa6, 0x00, 0xf0, 0x0d, 0x8c, 0xe7, 0x0e, 0x9a,
+    0x47, 0x2a, 0xb6, 0xd1, 0x00, 0x2b, 0xb4, 0xd1, 0x01, 0x33, 0xb1, 0xe7,
+    0x66, 0x2e, 0x1b, 0xd1, 0x63, 0x68, 0x00, 0x29, 0x0d, 0xdd, 0x21, 0x61,
+    0x84, 0x08, 0x00, 0x40, 0x00, 0xf1, 0x02, 0x02, 0xd5, 0x01, 0x33, 0x59,
+    0x18, 0x21, 0x61, 0x11, 0x9b, 0xa3, 0x65, 0x00, 0x23, 0x0a, 0x93, 0xd9,
+    0xa4, 0x1f, 0xf1, 0x12, 0x01, 0x22, 0x21, 0x68, 0x11, 0x42, 0x00, 0xd0,
+    0x9a, 0x1c, 0x22, 0x61, 0xf1, 0xe7, 0x67, 0x23, 0x1e, 0x00, 0x11, 0x9b,
+    0x12, 0x9a, 0x93, 0x42, 0x06, 0xdb, 0x22, 0x68, 0x23, 0x61, 0xd2, 0x07,
+    0xe7, 0x76, 0x00, 0xf0, 0x0a, 0xe4, 0xe7, 0x01, 0x21, 0x00, 0x2b, 0x01,
+    0xdc, 0x49, 0x18, 0xc9, 0x1a, 0x52, 0x18, 0xe9, 0xe7, 0x22, 0x68, 0x53,
+    0x05, 0x08, 0xd4, 0x23, 0x69, 0x2a, 0x6a, 0x27, 0xf0, 0x06, 0x99, 0x09,
+    0x9d, 0xa8, 0x47, 0x43, 0x1c, 0x29, 0xd1, 0x54, 0xe7, 0x65, 0x2e, 0x00,
+    0xd8, 0xec, 0xe0, 0xa0, 0x6c, 0xe1, 0x6c, 0xa6, 0x01, 0xe4, 0xfc, 0xf7,
+    0x92, 0xfb, 0x00, 0x28, 0x34, 0xd0, 0x01, 0x23, 0x38, 0x00, 0x37, 0x4a,
+    0x28, 0x00, 0x42, 0x00, 0xd1, 0x40, 0xe7, 0x64, 0x00, 0xf0, 0x07, 0x02,
+    0xdb, 0x23, 0x68, 0xdb, 0x07, 0x0d, 0xd5, 0x09, 0x9d, 0x38, 0x00, 0x0d,
+    0x9b, 0x0b, 0x9a, 0x08, 0x99, 0xa8, 0x47, 0x00, 0x25, 0x22, 0x00, 0xf0,
+    0x13, 0x2f, 0xe7, 0x12, 0x9b, 0x01, 0x3b, 0xab, 0x42, 0x0a, 0xdc, 0x23,
+    0x68, 0x9b, 0x07, 0x00, 0xd5, 0x14, 0xe1, 0x13, 0x9b, 0xe0, 0x68, 0x98,
+    0x42, 0x00, 0xdb, 0x24, 0xe7, 0x18, 0x00, 0x22, 0xe7, 0x22, 0x00, 0x54,
+    0x00, 0x71, 0x08, 0x99, 0x09, 0x9e, 0x1a, 0x32, 0xb0, 0x54, 0x00, 0xc0,
+    0x16, 0xe7, 0x01, 0x35, 0xe4, 0xe7, 0x11, 0x9b, 0x00, 0x2b, 0x3b, 0xdc,
+    0x1c, 0x00, 0x10, 0x1b, 0x70, 0x00, 0x12, 0x9e, 0x1c, 0x00, 0x11, 0x08,
+    0x70, 0x00, 0x40, 0x13, 0x43, 0x02, 0xd1, 0x70, 0x00, 0x60, 0xd5, 0xd5,
+    0x0d, 0x9b, 0x38, 0x00, 0x6e, 0x00, 0x04, 0x20, 0x00, 0x20, 0xf8, 0xe6,
+    0x10, 0x01, 0xdf, 0x11, 0x9b, 0x0a, 0x9a, 0x5b, 0x42, 0x93, 0x42, 0x01,
+    0xdc, 0x12, 0x9b, 0x92, 0x62, 0x00, 0x00, 0x71, 0xe5, 0xe6, 0x0a, 0x9b,
+    0x01, 0x33, 0xea, 0xa0, 0x19, 0xf2, 0x39, 0xef, 0x7f, 0x9c, 0x01, 0x01,
+    0x10, 0xa0, 0x01, 0x01, 0x10, 0xa4, 0x01, 0x01, 0x10, 0xa8, 0x01, 0x01,
+    0x10, 0xac, 0x01, 0x01, 0x10, 0x12, 0x9a, 0xa3, 0x6d, 0x0a, 0x92, 0x9a,
+    0x42, 0x00, 0xdd, 0x0a, 0x93, 0x0a, 0x9b, 0x00, 0x2b, 0x3d, 0xdc, 0x00,
+    0x23, 0x0e, 0x93, 0x0a, 0x9b, 0xdb, 0x43, 0xdb, 0x17, 0x0f, 0x93, 0xa3,
+    0x6d, 0x0f, 0x9a, 0x0c, 0x93, 0x0a, 0x9b, 0x13, 0x40, 0x0c, 0x9a, 0xd3,
+    0x1a, 0x0e, 0x9a, 0x93, 0x42, 0x36, 0xdc, 0x08, 0x01, 0x11, 0x40, 0x08,
+    0x01, 0xc8, 0x3d, 0xd4, 0x12, 0x9a, 0x0c, 0x9b, 0x11, 0x99, 0xd3, 0x1a,
+    0x52, 0x1a, 0x46, 0x00, 0x60, 0x3a, 0xdc, 0x0a, 0x9b, 0x00, 0x25, 0x44,
+    0x00, 0xff, 0x06, 0x0b, 0x93, 0x11, 0x9a, 0x12, 0x9b, 0x0b, 0x99, 0x9b,
+    0x1a, 0x0a, 0x9a, 0x0a, 0x40, 0x9b, 0x1a, 0xab, 0x42, 0x00, 0xdc, 0x6e,
+    0xaa, 0x00, 0x00, 0x83, 0x90, 0xe6, 0x01, 0x35, 0xe9, 0xe7, 0x0a, 0x9b,
+    0x9e, 0x01, 0x01, 0xe6, 0x00, 0x4e, 0xb9, 0xd1, 0x85, 0xe6, 0x2a, 0x00,
+    0xaa, 0x7b, 0xe6, 0x0e, 0x9b, 0x01, 0x33, 0x0e, 0x93, 0xb0, 0xe7, 0x14,
+    0x01, 0xe2, 0xb9, 0xd1, 0x6e, 0xe6, 0x0c, 0x9b, 0x38, 0x00, 0xea, 0x18,
+    0x08, 0x99, 0x0a, 0x9b, 0xb8, 0x01, 0xf8, 0x03, 0xbb, 0xd1, 0x64, 0xe6,
+    0x12, 0x9b, 0x01, 0x2b, 0x02, 0xdc, 0x01, 0x23, 0x1a, 0x42, 0x38, 0xd0,
+    0x01, 0x23, 0x60, 0x00, 0x4c, 0x00, 0xd1, 0x55, 0xe6, 0x58, 0x01, 0x26,
+    0x4c, 0xe6, 0x0a, 0x02, 0xc6, 0x8d, 0xfa, 0x00, 0x28, 0x1c, 0xd1, 0x12,
+    0x9b, 0x6a, 0x1c, 0x01, 0x3b, 0x34, 0x02, 0x3f, 0x0f, 0xd1, 0x3a, 0x96,
+    0x00, 0x00, 0x42, 0x30, 0xe6, 0x01, 0x35, 0x00, 0x02, 0xf7, 0x02, 0xf0,
+    0xdc, 0x22, 0x00, 0x0a, 0x9b, 0x50, 0x32, 0xcb, 0xe6, 0x00, 0x25, 0xf5,
+    0xe7, 0x2a, 0x00, 0xe1, 0xee, 0x00, 0x13, 0x19, 0x2e, 0x00, 0x80, 0x19,
+    0xe6, 0x01, 0x35, 0xe3, 0x68, 0x13, 0x9a, 0x10, 0x01, 0x40, 0xef, 0xdc,
+    0xea, 0xe6, 0xae, 0x27, 0xf0, 0x35, 0xc0, 0x46, 0xf7, 0xb5, 0x15, 0x00,
+    0x01, 0x93, 0x8a, 0x68, 0x0b, 0x69, 0x0c, 0x00, 0x00, 0x90, 0x93, 0x42,
+    0x00, 0xda, 0x13, 0x00, 0x22, 0x00, 0x2b, 0x60, 0x43, 0x32, 0x12, 0x78,
+    0x00, 0x2a, 0x01, 0xd0, 0x01, 0x33, 0x2b, 0x60, 0x23, 0x68, 0x9b, 0x06,
+    0x02, 0xd5, 0x2b, 0x68, 0x02, 0x33, 0x2b, 0x60, 0x22, 0x68, 0x06, 0x23,
+    0x17, 0x00, 0x1f, 0x40, 0x1a, 0x42, 0x27, 0xd0, 0x23, 0x00, 0x43, 0x33,
+    0x1b, 0x78, 0xe0, 0x53, 0xf1, 0x00, 0x22, 0x68, 0x92, 0x06, 0x30, 0xd4,
+    0x22, 0x00, 0x01, 0x99, 0x00, 0x98, 0x08, 0x9e, 0x43, 0x72, 0x00, 0xf0,
+    0x1c, 0x25, 0xd0, 0x06, 0x23, 0x20, 0x68, 0x2a, 0x68, 0xe1, 0x68, 0x00,
+    0x25, 0x03, 0x40, 0x04, 0x2b, 0x03, 0xd1, 0x8d, 0x1a, 0xeb, 0x43, 0xdb,
+    0x17, 0x1d, 0x40, 0xa3, 0x68, 0x22, 0x69, 0x93, 0x42, 0x01, 0xdd, 0x9b,
+    0x1a, 0xed, 0x18, 0x00, 0x27, 0xbd, 0x42, 0x20, 0xf6, 0x25, 0xd0, 0xe0,
+    0x01, 0x37, 0xe3, 0x68, 0x2a, 0x68, 0x9b, 0x1a, 0xbb, 0x42, 0xd2, 0xdd,
+    0xbe, 0x00, 0x02, 0x4c, 0x00, 0x02, 0xbe, 0x00, 0x20, 0xf0, 0xd1, 0x88,
+    0x04, 0xf1, 0x0c, 0xfe, 0xbd, 0x30, 0x20, 0xe1, 0x18, 0x43, 0x31, 0x08,
+    0x70, 0x21, 0x00, 0x5a, 0x1c, 0x45, 0x31, 0x09, 0x78, 0xa2, 0x18, 0x43,
+    0x32, 0x02, 0x33, 0x11, 0x70, 0xc1, 0xf0, 0x00, 0x02, 0x32, 0x00, 0x02,
+    0x1e, 0x01, 0x61, 0xe6, 0xd0, 0x01, 0x37, 0xd1, 0xe7, 0x12, 0x4e, 0xf0,
+    0x30, 0x92, 0x0a, 0x00, 0x43, 0x32, 0x08, 0x93, 0x06, 0x90, 0x05, 0x92,
+    0x0e, 0x00, 0x09, 0x7e, 0x12, 0x9b, 0x78, 0x29, 0x0a, 0xd8, 0x62, 0x29,
+    0x0c, 0xd8, 0x53, 0x29, 0x00, 0xd1, 0x48, 0xe1, 0x58, 0x29, 0x00, 0xd1,
+    0xe0, 0xe0, 0x00, 0x29, 0x00, 0xd1, 0x3a, 0xe1, 0x37, 0x00, 0x42, 0x37,
+    0x39, 0x70, 0x22, 0xe0, 0x08, 0x00, 0x63, 0x38, 0x15, 0x28, 0xf7, 0xd8,
+    0x05, 0xf0, 0xe3, 0xf9, 0x06, 0x1c, 0x22, 0xf6, 0xff, 0x02, 0x00, 0x06,
+    0x0a, 0x00, 0x51, 0x24, 0x01, 0x51, 0x00, 0xf4, 0x0e, 0x00, 0x51, 0x39,
+    0x01, 0xf6, 0xff, 0x51, 0x0a, 0x00, 0xf2, 0x0d, 0xf8, 0x00, 0x37, 0x00,
+    0x1a, 0x68, 0x42, 0x37, 0x11, 0x1d, 0x19, 0x60, 0x13, 0x68, 0x3b, 0x70,
+    0x01, 0x23, 0x27, 0xe1, 0x31, 0x68, 0x1a, 0x68, 0x08, 0x06, 0x03, 0xd5,
+    0x14, 0x00, 0x51, 0x05, 0xe0, 0x48, 0x06, 0x06, 0x0c, 0x00, 0xd4, 0x00,
+    0x23, 0xd3, 0x5e, 0x1c, 0x00, 0xdd, 0x17, 0x10, 0xe0, 0x88, 0x05, 0x04,
+    0x12, 0x00, 0xf0, 0x0c, 0x56, 0xf5, 0xe7, 0x09, 0x05, 0xe9, 0xd5, 0x07,
+    0x21, 0x07, 0x32, 0x8a, 0x43, 0x11, 0x00, 0x14, 0x68, 0x55, 0x68, 0x08,
+    0x31, 0x19, 0x60, 0x00, 0x2d, 0x08, 0xda, 0xfc, 0x28, 0x73, 0x00, 0x25,
+    0x54, 0x42, 0x9d, 0x41, 0x33, 0xcc, 0x04, 0xf0, 0x1d, 0x93, 0x4b, 0x04,
+    0x93, 0x0a, 0x23, 0x03, 0x93, 0x16, 0xe0, 0x34, 0x68, 0x80, 0x20, 0x27,
+    0x00, 0x1a, 0x68, 0x07, 0x40, 0x04, 0x42, 0x55, 0xd0, 0x00, 0x25, 0x10,
+    0x1d, 0x14, 0x68, 0x18, 0x60, 0x08, 0x22, 0x8a, 0x4b, 0x03, 0x92, 0x04,
+    0x93, 0x6f, 0x29, 0x01, 0xd0, 0x28, 0x00, 0x31, 0x33, 0x00, 0x00, 0x38,
+    0x00, 0xf0, 0x15, 0x73, 0x68, 0xb3, 0x60, 0x00, 0x2b, 0x03, 0xdb, 0x04,
+    0x22, 0x31, 0x68, 0x91, 0x43, 0x31, 0x60, 0x22, 0x00, 0x2a, 0x43, 0x02,
+    0xd1, 0x05, 0x9f, 0x00, 0x2b, 0x18, 0xd0, 0x03, 0x9b, 0x05, 0x9f, 0xdb,
+    0x17, 0x09, 0x93, 0x64, 0x4d, 0xf1, 0x0a, 0x03, 0x9a, 0x09, 0x9b, 0xfb,
+    0xf7, 0xd1, 0xfe, 0x04, 0x9b, 0x01, 0x3f, 0x9b, 0x5c, 0x22, 0x00, 0x3b,
+    0x70, 0x2b, 0x00, 0x0d, 0x00, 0x09, 0x99, 0x04, 0x76, 0x0b, 0xf0, 0x29,
+    0xed, 0xd1, 0x03, 0x9b, 0x93, 0x42, 0xea, 0xd9, 0x03, 0x9b, 0x08, 0x2b,
+    0x09, 0xd1, 0x33, 0x68, 0xdb, 0x07, 0x06, 0xd5, 0x73, 0x68, 0x32, 0x69,
+    0x93, 0x42, 0x02, 0xdc, 0x30, 0x23, 0x01, 0x3f, 0x3b, 0x70, 0x05, 0x9b,
+    0xdb, 0x1b, 0x33, 0x61, 0x08, 0x9b, 0x31, 0x00, 0x00, 0x93, 0x06, 0x98,
+    0x07, 0x9b, 0x0b, 0xaa, 0xff, 0xf7, 0xc8, 0xfe, 0x56, 0x06, 0x11, 0xa1,
+    0x56, 0x06, 0x00, 0x3a, 0x4f, 0xf0, 0x1d, 0x40, 0x25, 0x20, 0x00, 0x28,
+    0x40, 0x2c, 0x42, 0x05, 0xd0, 0x10, 0x1d, 0x18, 0x60, 0x13, 0x68, 0x3d,
+    0x00, 0x9c, 0xb2, 0xa2, 0xe7, 0xa5, 0x05, 0x05, 0xd5, 0x14, 0x1d, 0x1c,
+    0x60, 0x13, 0x68, 0xdc, 0xb2, 0x05, 0x00, 0x9a, 0xe7, 0x80, 0x25, 0x20,
+    0x00, 0x2d, 0x01, 0x28, 0x00, 0x92, 0x08, 0xd0, 0x07, 0x20, 0x07, 0x32,
+    0x82, 0x43, 0x10, 0x1c, 0x01, 0x50, 0x30, 0x18, 0x60, 0x8b, 0xe7, 0x2a,
+    0x00, 0xf5, 0x0c, 0x14, 0x68, 0xea, 0xe7, 0x32, 0x00, 0x45, 0x32, 0x11,
+    0x70, 0x4d, 0x4a, 0x31, 0x68, 0x80, 0x20, 0x0f, 0x00, 0x04, 0x92, 0x07,
+    0x40, 0x1a, 0x68, 0x01, 0x42, 0x1d, 0x10, 0x01, 0xf0, 0x10, 0xcb, 0x07,
+    0x02, 0xd5, 0x20, 0x23, 0x19, 0x43, 0x31, 0x60, 0x10, 0x23, 0x03, 0x93,
+    0x23, 0x00, 0x2b, 0x43, 0x00, 0xd0, 0x74, 0xe7, 0x32, 0x68, 0x20, 0x33,
+    0x9a, 0x43, 0x32, 0x60, 0x6f, 0xb8, 0x06, 0x90, 0x68, 0x0a, 0x43, 0x32,
+    0x60, 0x32, 0x00, 0x78, 0x21, 0x4a, 0x00, 0xb5, 0x3c, 0x4a, 0xd9, 0xe7,
+    0x40, 0x24, 0x08, 0x00, 0x20, 0x40, 0x21, 0xa0, 0x00, 0x75, 0x9c, 0xb2,
+    0x3d, 0x00, 0xda, 0xe7, 0x8c, 0xa0, 0x00, 0x60, 0x05, 0x00, 0xdc, 0xb2,
+    0xd2, 0xe7, 0x70, 0x00, 0x5f, 0x00, 0x01, 0x07, 0x40, 0x01, 0xa0, 0x00,
+    0x00, 0x22, 0xc3, 0xe7, 0x7e, 0x00, 0xa0, 0xe2, 0xe7, 0x1a, 0x68, 0x34,
+    0x68, 0x11, 0x1d, 0x70, 0x69, 0x08, 0x02, 0xf0, 0x11, 0x25, 0x06, 0x01,
+    0xd5, 0x18, 0x60, 0x02, 0xe0, 0x65, 0x06, 0x04, 0xd5, 0x18, 0x80, 0x00,
+    0x23, 0x05, 0x9f, 0x33, 0x61, 0x69, 0xe7, 0xa4, 0x05, 0xf4, 0xd5, 0x18,
+    0x70, 0xf7, 0xe7, 0x1a, 0x68, 0x10, 0x02, 0x20, 0x17, 0x68, 0x9e, 0x2f,
+    0x60, 0x72, 0x68, 0x05, 0xf0, 0x71, 0xf8, 0xf8, 0x08, 0xf1, 0x0c, 0xc0,
+    0x1b, 0x70, 0x60, 0x73, 0x68, 0x33, 0x61, 0x00, 0x23, 0x05, 0x9a, 0x13,
+    0x70, 0x52, 0xe7, 0x33, 0x69, 0x3a, 0x00, 0x07, 0x99, 0x06, 0x98, 0x08,
+    0x9c, 0xa0, 0xe0, 0x03, 0xb1, 0x54, 0xe7, 0x33, 0x68, 0x9b, 0x07, 0x17,
+    0xd4, 0x0b, 0x9b, 0xf0, 0x02, 0x06, 0xa1, 0x4e, 0xe7, 0x18, 0x00, 0x4c,
+    0xe7, 0x32, 0x00, 0x01, 0x23, 0x26, 0x00, 0x34, 0x9d, 0x19, 0x32, 0x56,
+    0x06, 0xf0, 0x01, 0x01, 0x34, 0xf3, 0x68, 0x0b, 0x9a, 0x9b, 0x1a, 0xa3,
+    0x42, 0xef, 0xdc, 0xe7, 0xe7, 0x00, 0x24, 0x08, 0x04, 0x60, 0xae, 0x01,
+    0x01, 0x10, 0xbf, 0x01, 0x7c, 0x48, 0xf0, 0x1b, 0x8b, 0xb0, 0x15, 0x00,
+    0x01, 0x90, 0xae, 0x22, 0x00, 0x20, 0x06, 0x93, 0x8b, 0x68, 0x0e, 0x00,
+    0x59, 0x1e, 0x52, 0x00, 0x05, 0x90, 0x91, 0x42, 0x05, 0xd9, 0x5e, 0x3b,
+    0xff, 0x3b, 0x05, 0x93, 0x5e, 0x23, 0xff, 0x33, 0xb3, 0x60, 0xf0, 0x23,
+    0x32, 0x68, 0xd4, 0x07, 0x90, 0x33, 0x60, 0x33, 0x00, 0x00, 0x24, 0x1c,
+    0x33, 0x1f, 0x14, 0x64, 0xf0, 0x16, 0x94, 0x08, 0x94, 0x07, 0x94, 0x00,
+    0x94, 0x04, 0x94, 0xb2, 0x68, 0x00, 0x2a, 0x0a, 0xd0, 0x2b, 0x68, 0x1b,
+    0x78, 0x4e, 0x2b, 0x44, 0xd8, 0x18, 0x00, 0x40, 0x2b, 0x2c, 0xd8, 0x2b,
+    0x38, 0xc1, 0xb2, 0x0e, 0x29, 0x2a, 0xd9, 0xb4, 0x2f, 0xd1, 0x03, 0xd0,
+    0x32, 0x68, 0xa4, 0x4b, 0x13, 0x40, 0x33, 0x60, 0x02, 0x9b, 0x01, 0x8e,
+    0x2d, 0xf0, 0x15, 0xf9, 0xe0, 0xbe, 0x24, 0x64, 0x00, 0x03, 0x9b, 0x9f,
+    0x42, 0x00, 0xd9, 0xe9, 0xe0, 0x01, 0x23, 0x02, 0x93, 0x85, 0xe1, 0x18,
+    0x00, 0x61, 0x38, 0x0d, 0x28, 0xe6, 0xd8, 0x05, 0xf0, 0x20, 0xf8, 0x83,
+    0x00, 0xe5, 0xff, 0x02, 0x00, 0x31, 0xb6, 0x00, 0xa2, 0x0a, 0x00, 0x13,
+    0x89, 0x10, 0x00, 0xfd, 0x0e, 0xe5, 0xff, 0x65, 0x00, 0x41, 0x38, 0xeb,
+    0xe7, 0x0e, 0x28, 0xd2, 0xd8, 0x05, 0xf0, 0x0c, 0xf8, 0x4b, 0x00, 0xd1,
+    0xff, 0x4b, 0x00, 0x98, 0x00, 0xd1, 0xff, 0x20, 0x00, 0x40, 0x02, 0x00,
+    0xf1, 0x26, 0x6e, 0x2b, 0x09, 0xd8, 0x60, 0x2b, 0xd2, 0xd8, 0x54, 0x2b,
+    0x7d, 0xd0, 0x59, 0x2b, 0xb9, 0xd1, 0x07, 0x2c, 0xb7, 0xd1, 0x08, 0x24,
+    0x2c, 0xe0, 0x74, 0x2b, 0x75, 0xd0, 0x79, 0x2b, 0xf7, 0xd0, 0xb0, 0xe7,
+    0x31, 0x68, 0xc8, 0x05, 0x1c, 0xd5, 0x80, 0x23, 0x99, 0x43, 0x00, 0x9b,
+    0x31, 0x60, 0x01, 0x33, 0x00, 0x93, 0x05, 0xb0, 0x00, 0xf0, 0x13, 0x01,
+    0x3b, 0x01, 0x32, 0x05, 0x93, 0xb2, 0x60, 0xb3, 0x68, 0x01, 0x3b, 0xb3,
+    0x60, 0x33, 0x69, 0x01, 0x33, 0x33, 0x61, 0x6b, 0x68, 0x01, 0x3b, 0x6b,
+    0x60, 0x00, 0x2b, 0x00, 0xdc, 0x86, 0xe0, 0x2b, 0x68, 0x2a, 0x05, 0xf1,
+    0x1c, 0x82, 0xe7, 0x02, 0x9a, 0x12, 0x19, 0x00, 0x2a, 0x8c, 0xd1, 0x6d,
+    0x4a, 0x31, 0x68, 0x0a, 0x40, 0x32, 0x60, 0x3b, 0x70, 0x01, 0x37, 0xe4,
+    0xe7, 0x80, 0x21, 0x32, 0x68, 0x0a, 0x42, 0x81, 0xd0, 0x8a, 0x43, 0xf5,
+    0xe7, 0x02, 0x9a, 0x00, 0x2a, 0x0f, 0xd1, 0x00, 0x06, 0x00, 0xf0, 0x01,
+    0x32, 0x68, 0xe0, 0x21, 0x10, 0x00, 0xc9, 0x00, 0x08, 0x40, 0x88, 0x42,
+    0x08, 0xd1, 0x61, 0x49, 0x32, 0x00, 0xf0, 0x03, 0x01, 0x22, 0x02, 0x92,
+    0xe3, 0xe7, 0x02, 0x9a, 0x02, 0x2a, 0x59, 0xd0, 0x01, 0x2c, 0x02, 0xd0,
+    0x04, 0x2c, 0x8a, 0x24, 0x00, 0xec, 0x35, 0xe0, 0xd8, 0xe7, 0x02, 0x9a,
+    0x01, 0x2a, 0x00, 0xd0, 0x5d, 0xe7, 0x02, 0x22, 0xec, 0xe7, 0x64, 0x55,
+    0x00, 0x46, 0x00, 0x48, 0x00, 0xd0, 0x58, 0xe7, 0x48, 0x00, 0x80, 0x00,
+    0xd0, 0x54, 0xe7, 0x4f, 0x49, 0x01, 0x34, 0x4c, 0x00, 0x80, 0xbf, 0xe7,
+    0xfd, 0x21, 0xe2, 0x1e, 0x0a, 0x42, 0x32, 0x30, 0xf1, 0x10, 0xdd, 0xe7,
+    0x02, 0x2c, 0x00, 0xd0, 0x3f, 0xe7, 0x03, 0x24, 0xb4, 0xe7, 0x06, 0x2c,
+    0x00, 0xd0, 0x3a, 0xe7, 0x07, 0x24, 0xaf, 0xe7, 0x32, 0x68, 0x91, 0x05,
+    0x00, 0xd4, 0x34, 0xe7, 0x43, 0x7c, 0x00, 0xf0, 0x0f, 0x00, 0x9a, 0x04,
+    0x92, 0xa5, 0xe7, 0xa0, 0x21, 0x80, 0x20, 0x32, 0x68, 0xc9, 0x00, 0x11,
+    0x40, 0xc0, 0x00, 0x81, 0x42, 0x06, 0xd0, 0x02, 0x42, 0x00, 0xd1, 0x23,
+    0xe7, 0x00, 0x99, 0x24, 0x05, 0xf0, 0x09, 0x26, 0xe7, 0x91, 0x05, 0x04,
+    0xd4, 0x00, 0x99, 0x04, 0x98, 0x08, 0x97, 0x09, 0x1a, 0x07, 0x91, 0x34,
+    0x49, 0x0a, 0x40, 0xc0, 0x21, 0x49, 0x00, 0x3a, 0x03, 0xf0, 0x05, 0x00,
+    0x22, 0x00, 0x92, 0x86, 0xe7, 0x03, 0x22, 0x9e, 0xe7, 0xc0, 0x23, 0x5b,
+    0x00, 0x29, 0x00, 0xf3, 0x58, 0x01, 0x98, 0x9e, 0x4e, 0xe0, 0x00, 0xd1,
+    0xf6, 0xe6, 0x03, 0xe7, 0x01, 0x3f, 0x33, 0x59, 0x2a, 0x00, 0x39, 0x78,
+    0x14, 0x00, 0xf5, 0x27, 0x33, 0x69, 0x01, 0x3b, 0x33, 0x61, 0x07, 0xe7,
+    0x63, 0x1e, 0x06, 0x2b, 0x0e, 0xd8, 0x02, 0x97, 0x02, 0x2c, 0x20, 0xd9,
+    0xe3, 0x1b, 0xdb, 0xb2, 0x05, 0x93, 0x02, 0x9b, 0x05, 0x9a, 0x9b, 0x18,
+    0xdb, 0xb2, 0x03, 0x2b, 0x27, 0xd8, 0x03, 0x3c, 0xe4, 0xb2, 0x3f, 0x1b,
+    0x33, 0x68, 0xda, 0x05, 0x54, 0xd5, 0x5b, 0x05, 0x37, 0xd5, 0x22, 0x02,
+    0x3e, 0xd8, 0xee, 0xe6, 0x4e, 0x00, 0x26, 0xf1, 0xe7, 0x20, 0x00, 0x1f,
+    0xde, 0x20, 0x00, 0x02, 0x00, 0x42, 0x26, 0x91, 0x01, 0x3b, 0x19, 0x78,
+    0x02, 0x93, 0xbe, 0x23, 0x5b, 0x9e, 0x00, 0x24, 0x09, 0x93, 0x1e, 0x00,
+    0x10, 0xc2, 0xb0, 0x08, 0x40, 0xfe, 0xff, 0xff, 0x7f, 0x04, 0x00, 0xd0,
+    0xf8, 0xff, 0xff, 0x7f, 0xfd, 0xff, 0xff, 0x33, 0x69, 0x7c, 0x1e, 0x21,
+    0x78, 0x1e, 0x00, 0x82, 0x65, 0x29, 0x0c, 0xd0, 0x45, 0x29, 0x0a, 0xd0,
+    0x38, 0x00, 0x22, 0x2a, 0x00, 0x56, 0x00, 0x80, 0xbc, 0x1e, 0x01, 0x3b,
+    0x21, 0x78, 0x33, 0x61, 0x16, 0x00, 0x13, 0x2a, 0xee, 0x00, 0xf1, 0x05,
+    0x27, 0x00, 0x32, 0x68, 0x10, 0x23, 0x11, 0x00, 0x19, 0x40, 0x02, 0x91,
+    0x1a, 0x42, 0x58, 0xd1, 0xc0, 0x23, 0x39, 0x70, 0x2a, 0x03, 0xf1, 0x09,
+    0x40, 0x80, 0x22, 0xd2, 0x00, 0x93, 0x42, 0x1d, 0xd1, 0x04, 0x9b, 0x00,
+    0x9a, 0x00, 0x99, 0x9a, 0x1a, 0x8b, 0x42, 0x24, 0xd1, 0x00, 0x22, 0x03,
+    0x7c, 0x66, 0xf0, 0x15, 0x70, 0xf8, 0x06, 0x9b, 0x0d, 0x00, 0x31, 0x68,
+    0x04, 0x00, 0x1b, 0x68, 0x8a, 0x07, 0x25, 0xd5, 0x1a, 0x1d, 0x06, 0x99,
+    0x0a, 0x60, 0x1b, 0x68, 0x1c, 0x60, 0x5d, 0x60, 0xf3, 0x68, 0x01, 0x33,
+    0xf3, 0x60, 0x02, 0x98, 0xe0, 0x0c, 0xf0, 0x33, 0x07, 0x9b, 0x00, 0x2b,
+    0xe4, 0xd0, 0x08, 0x9b, 0x02, 0x9a, 0x59, 0x1c, 0x01, 0x98, 0x0a, 0x23,
+    0x01, 0xf0, 0xaf, 0xf9, 0x07, 0x9b, 0x08, 0x9f, 0xc2, 0x1a, 0x33, 0x00,
+    0x70, 0x33, 0xff, 0x33, 0x9f, 0x42, 0x02, 0xd3, 0x37, 0x00, 0x6f, 0x37,
+    0xff, 0x37, 0x38, 0x00, 0x0f, 0x49, 0x00, 0xf0, 0x9e, 0xf9, 0xcd, 0xe7,
+    0x1a, 0x1d, 0x49, 0x07, 0xd7, 0xd4, 0x06, 0x99, 0x20, 0x00, 0x0a, 0x60,
+    0x1f, 0x68, 0x48, 0x06, 0x60, 0x29, 0x00, 0xfb, 0xf7, 0x7c, 0xfe, 0x76,
+    0x63, 0xa0, 0x07, 0x48, 0x00, 0xf0, 0xba, 0xf8, 0x38, 0x60, 0xcc, 0xe7,
+    0xf2, 0x05, 0xe2, 0xfb, 0xf7, 0x04, 0xff, 0xf8, 0xe7, 0x00, 0x23, 0x40,
+    0xe6, 0xc0, 0x46, 0xd0, 0x01, 0x6c, 0x49, 0x90, 0x0e, 0xb4, 0x17, 0xb5,
+    0x04, 0x1e, 0x04, 0xd0, 0x83, 0xf6, 0x2f, 0xf3, 0x05, 0xd1, 0xfe, 0xf7,
+    0xe9, 0xfd, 0x06, 0xab, 0x20, 0x00, 0x05, 0x9a, 0xa1, 0x68, 0x01, 0x93,
+    0x03, 0xf0, 0xbe, 0xff, 0x1e, 0xca, 0x69, 0x88, 0x0f, 0xb4, 0x13, 0xb5,
+    0xf9, 0xf7, 0x38, 0xfc, 0x2c, 0x00, 0x73, 0xd3, 0xfd, 0x05, 0xab, 0x20,
+    0x00, 0x04, 0x2c, 0x00, 0xf1, 0x26, 0xa8, 0xff, 0x16, 0xbc, 0x08, 0xbc,
+    0x04, 0xb0, 0x18, 0x47, 0x30, 0xb5, 0x05, 0x00, 0x89, 0xb0, 0x08, 0x00,
+    0x0c, 0x00, 0x00, 0xf0, 0xbb, 0xf9, 0x2b, 0x4a, 0x04, 0xab, 0x06, 0x92,
+    0x01, 0x22, 0x01, 0x93, 0x02, 0x23, 0x05, 0x90, 0x80, 0x18, 0x04, 0x94,
+    0x07, 0x92, 0x03, 0x90, 0x02, 0x93, 0x00, 0x2d, 0x05, 0xd0, 0xab, 0x1a,
+    0x14, 0x91, 0x28, 0x00, 0xfe, 0xf7, 0xad, 0xfd, 0xab, 0x69, 0xac, 0xe8,
+    0x67, 0x00, 0x0e, 0x00, 0xf0, 0x27, 0xa6, 0xfd, 0x1e, 0x4b, 0x9c, 0x42,
+    0x2d, 0xd1, 0x6c, 0x68, 0xa3, 0x6e, 0xdb, 0x07, 0x06, 0xd4, 0xa3, 0x89,
+    0x9b, 0x05, 0x03, 0xd4, 0x20, 0x00, 0x58, 0x30, 0x04, 0xf0, 0x01, 0xfd,
+    0x0c, 0x23, 0xe2, 0x5e, 0x80, 0x23, 0x9b, 0x01, 0x1a, 0x42, 0x05, 0xd1,
+    0x13, 0x43, 0xa3, 0x81, 0xa2, 0x6e, 0x14, 0x4b, 0x13, 0x40, 0xa3, 0x66,
+    0xe8, 0x53, 0x81, 0x01, 0xaa, 0x02, 0xf0, 0xc9, 0xfa, 0x0a, 0x25, 0x78,
+    0x6a, 0x3e, 0x25, 0x6d, 0x42, 0x40, 0x00, 0xf0, 0x0f, 0xe5, 0xfc, 0x28,
+    0x00, 0x09, 0xb0, 0x30, 0xbd, 0x08, 0x4b, 0x9c, 0x42, 0x01, 0xd1, 0xac,
+    0x68, 0xcd, 0xe7, 0x06, 0x4b, 0x9c, 0x42, 0xca, 0xd1, 0xec, 0x68, 0xc8,
+    0xe7, 0xc0, 0x46, 0x50, 0x4a, 0x00, 0x3c, 0x67, 0x00, 0x7a, 0x17, 0x04,
+    0x40, 0x67, 0x00, 0x86, 0x13, 0x40, 0xf9, 0xf7, 0xba, 0xfb, 0x46, 0x54,
+    0x10, 0x91, 0x5a, 0x2a, 0x50, 0x23, 0x70, 0xb5, 0x06, 0x4d, 0x36, 0x6e,
+    0xb1, 0x2b, 0x60, 0xfb, 0xf7, 0x78, 0xfa, 0x43, 0x1c, 0x03, 0xd1, 0x2b,
+    0x9a, 0x61, 0x20, 0x23, 0x60, 0x50, 0x17, 0x10, 0x20, 0x48, 0x2d, 0x10,
+    0x48, 0x34, 0x1a, 0xf0, 0x05, 0xc0, 0x7f, 0x70, 0xb5, 0x44, 0x6c, 0x05,
+    0x00, 0x00, 0x2c, 0x0a, 0xd1, 0x80, 0x21, 0xfe, 0xf7, 0x20, 0xfe, 0x68,
+    0x64, 0xce, 0x51, 0xa0, 0x03, 0x00, 0x80, 0x33, 0x10, 0xc0, 0x98, 0x42,
+    0xfc, 0xd1, 0x6a, 0x38, 0x02, 0x34, 0x4b, 0x02, 0x5e, 0x21, 0xa0, 0x16,
+    0x00, 0x1f, 0x29, 0x04, 0xd9, 0x16, 0x23, 0x03, 0x60, 0x16, 0x00, 0x40,
+    0x07, 0xe0, 0x43, 0x6c, 0x98, 0x28, 0xc0, 0xa9, 0x00, 0x65, 0x6c, 0x6d,
+    0x18, 0x28, 0x68, 0x2e, 0x60, 0x70, 0xbd, 0xac, 0x6f, 0x53, 0x00, 0x28,
+    0xf5, 0xd0, 0xee, 0x32, 0x00, 0x08, 0x30, 0x00, 0x20, 0x70, 0xbd, 0x30,
+    0x00, 0xc0, 0x04, 0xd0, 0x8a, 0x00, 0x9b, 0x18, 0x1a, 0x68, 0x00, 0x2a,
+    0x08, 0xd1, 0xbc, 0x15, 0x40, 0x6b, 0xf8, 0x2a, 0x00, 0xb6, 0x1e, 0xf5,
+    0x14, 0x00, 0xf0, 0x54, 0xf8, 0xed, 0xe7, 0x00, 0x20, 0x01, 0x2a, 0xea,
+    0xd0, 0x51, 0x1c, 0x03, 0xd1, 0x16, 0x23, 0x01, 0x30, 0x23, 0x60, 0xe4,
+    0xe7, 0x00, 0x24, 0x28, 0x00, 0x1c, 0x60, 0x90, 0x47, 0x20, 0x00, 0xde,
+    0x54, 0x00, 0x02, 0x76, 0x55, 0x02, 0x50, 0x00, 0xa0, 0x12, 0xd0, 0x62,
+    0x6c, 0xab, 0x00, 0xd2, 0x18, 0x13, 0x68, 0x8a, 0x30, 0xe0, 0xf4, 0xd0,
+    0x02, 0x20, 0x59, 0x1c, 0xf1, 0xd0, 0x01, 0x30, 0x01, 0x2b, 0xee, 0xd0,
+    0x3c, 0x00, 0x82, 0x14, 0x60, 0x98, 0x47, 0x20, 0x00, 0xe8, 0xe7, 0x40,
+    0x20, 0x31, 0xe8, 0xd0, 0xe1, 0xc8, 0x14, 0x31, 0xf9, 0xf7, 0x21, 0x32,
+    0x01, 0x11, 0xac, 0xae, 0x18, 0x00, 0x40, 0x18, 0x40, 0xf9, 0xf7, 0x18,
+    0xfb, 0x40, 0x18, 0x40, 0xff, 0xf7, 0x89, 0xff, 0xe6, 0x16, 0x40, 0xf9,
+    0xf7, 0x10, 0xfb, 0xac, 0x15, 0x02, 0xe8, 0x14, 0x31, 0xf9, 0xf7, 0x09,
+    0x30, 0x00, 0x11, 0xbe, 0xbc, 0x2b, 0x06, 0x64, 0x01, 0x8a, 0x11, 0x00,
+    0x2b, 0x60, 0x04, 0xf0, 0x31, 0xfc, 0x66, 0x01, 0x00, 0x64, 0x01, 0xf0,
+    0x13, 0x10, 0xb5, 0x04, 0xf0, 0x15, 0xfc, 0x10, 0xbd, 0x0c, 0xb4, 0x00,
+    0xb5, 0x9f, 0xb0, 0x02, 0x91, 0x06, 0x91, 0x09, 0x49, 0x20, 0xab, 0x07,
+    0x91, 0x04, 0x91, 0x08, 0x49, 0x04, 0xcb, 0x05, 0x91, 0x02, 0xa9, 0x98,
+    0x02, 0xf0, 0x01, 0xce, 0xfc, 0x00, 0x23, 0x02, 0x9a, 0x13, 0x70, 0x1f,
+    0xb0, 0x08, 0xbc, 0x02, 0xb0, 0x18, 0x47, 0xb8, 0x0c, 0xf5, 0x1e, 0xff,
+    0x7f, 0x08, 0x02, 0xff, 0xff, 0x0e, 0xb4, 0x10, 0xb5, 0x0c, 0x4a, 0x9f,
+    0xb0, 0x21, 0xab, 0x10, 0xcb, 0x07, 0x92, 0x04, 0x92, 0x0a, 0x4a, 0x01,
+    0x93, 0x05, 0x92, 0x02, 0x90, 0x06, 0x90, 0xf9, 0xf7, 0xc3, 0xfa, 0x22,
+    0x00, 0x01, 0x9b, 0x02, 0xa9, 0x03, 0xf0, 0xae, 0x40, 0x00, 0x13, 0x10,
+    0x0c, 0x03, 0x04, 0x40, 0x00, 0x00, 0xac, 0x5b, 0x70, 0x0e, 0x25, 0x49,
+    0x5f, 0x03, 0xf0, 0x8e, 0xa0, 0x22, 0xf0, 0x02, 0xdb, 0x63, 0x6d, 0x1b,
+    0x18, 0x63, 0x65, 0x70, 0xbd, 0xa3, 0x89, 0x02, 0x4a, 0x13, 0x40, 0xa3,
+    0x81, 0x78, 0x39, 0x40, 0xff, 0xef, 0xff, 0xff, 0x7a, 0x46, 0x62, 0xf8,
+    0xb5, 0x1f, 0x00, 0x8b, 0x89, 0x9c, 0x3c, 0xf0, 0x07, 0xdb, 0x05, 0x05,
+    0xd5, 0x0e, 0x23, 0xc9, 0x5e, 0x00, 0x22, 0x02, 0x23, 0x02, 0xf0, 0x8a,
+    0xfe, 0xa3, 0x89, 0x05, 0x4a, 0x28, 0x00, 0x32, 0x00, 0xe0, 0x32, 0x00,
+    0x0e, 0x23, 0xe1, 0x5e, 0x3b, 0x00, 0x01, 0xf0, 0x2d, 0xf8, 0xf8, 0xbd,
+    0x3c, 0x00, 0x04, 0x64, 0x00, 0xb1, 0x02, 0xf0, 0x76, 0xfe, 0xa3, 0x89,
+    0x42, 0x1c, 0x03, 0xd1, 0x05, 0x5c, 0x00, 0x20, 0x70, 0xbd, 0x30, 0x20,
+    0x00, 0xfe, 0x02, 0x33, 0x60, 0x65, 0xf8, 0x68, 0x00, 0x20, 0x10, 0xb5,
+    0x56, 0x00, 0x30, 0x01, 0xf0, 0x23, 0x34, 0x1c, 0xb0, 0x23, 0xc2, 0x5c,
+    0x01, 0x33, 0x00, 0x2a, 0xfb, 0xd1, 0x58, 0x1e, 0x8a, 0x02, 0x02, 0xce,
+    0x52, 0xf0, 0x14, 0x03, 0xf0, 0x05, 0xfa, 0x00, 0x2e, 0x0d, 0xd0, 0x6b,
+    0x23, 0x6a, 0x00, 0x52, 0x0d, 0x9b, 0x1a, 0x00, 0x2b, 0x07, 0xdd, 0x00,
+    0x24, 0x03, 0x4a, 0x1b, 0x05, 0x9d, 0x18, 0x2b, 0x00, 0x22, 0x00, 0xfb,
+    0xf7, 0xfa, 0xba, 0x31, 0xf0, 0x12, 0x00, 0xf0, 0x3f, 0xf0, 0xb5, 0x1d,
+    0x00, 0x00, 0x23, 0xa5, 0xb0, 0x20, 0x93, 0xac, 0x4b, 0x05, 0x90, 0x1b,
+    0x68, 0x08, 0x91, 0x18, 0x00, 0x07, 0x93, 0x1b, 0x92, 0xff, 0xf7, 0xd2,
+    0xff, 0x00, 0x26, 0x4a, 0x52, 0xf0, 0x0b, 0x08, 0x9b, 0x1f, 0x93, 0x1f,
+    0x9a, 0x13, 0x78, 0x2b, 0x2b, 0x58, 0xd0, 0x44, 0xd8, 0x0d, 0x2b, 0x3d,
+    0xd8, 0x08, 0x2b, 0x3d, 0xd8, 0x00, 0x2b, 0x47, 0xd0, 0xee, 0x0d, 0xf0,
+    0x3b, 0x00, 0x22, 0x1f, 0x9b, 0x0a, 0x92, 0x06, 0x93, 0x1b, 0x78, 0x30,
+    0x2b, 0x00, 0xd0, 0x7f, 0xe0, 0x06, 0x9b, 0x20, 0x32, 0x5b, 0x78, 0x93,
+    0x43, 0x58, 0x2b, 0x00, 0xd0, 0x6e, 0xe0, 0x0e, 0x9b, 0x02, 0x95, 0x01,
+    0x93, 0x20, 0xab, 0x00, 0x93, 0x95, 0x4a, 0x21, 0xab, 0x05, 0x98, 0x1f,
+    0xa9, 0x02, 0xf0, 0xbf, 0xfa, 0x07, 0x23, 0x05, 0x00, 0x04, 0x00, 0x1d,
+    0x40, 0x18, 0x42, 0x06, 0xd0, 0x06, 0x2d, 0x2f, 0xd1, 0x06, 0x9b, 0x01,
+    0x33, 0x1f, 0x93, 0x4e, 0x00, 0x11, 0x1b, 0x0a, 0x1f, 0x60, 0x1b, 0x9b,
+    0x1f, 0x9a, 0x1a, 0x60, 0xea, 0x5b, 0xa0, 0x1c, 0xd0, 0x80, 0x23, 0x32,
+    0x00, 0x1b, 0x06, 0xfb, 0x18, 0xcc, 0x44, 0xf0, 0x11, 0x25, 0xb0, 0xf0,
+    0xbd, 0x20, 0x2b, 0xc3, 0xd1, 0x01, 0x32, 0x1f, 0x92, 0xb5, 0xe7, 0x2d,
+    0x2b, 0xbe, 0xd1, 0x2c, 0x3b, 0x0e, 0x93, 0x53, 0x1c, 0x1f, 0x93, 0x53,
+    0x78, 0x00, 0x2b, 0xb9, 0xd1, 0xaa, 0x00, 0x04, 0x46, 0x00, 0x20, 0xdc,
+    0xd1, 0xfa, 0x5a, 0xf0, 0x25, 0xe3, 0xe7, 0x00, 0x23, 0xed, 0xe7, 0x20,
+    0x9a, 0x00, 0x2a, 0x07, 0xd0, 0x35, 0x21, 0x22, 0xa8, 0x03, 0xf0, 0x95,
+    0xfa, 0x20, 0x99, 0x05, 0x98, 0x02, 0xf0, 0x37, 0xfe, 0x68, 0x1e, 0x04,
+    0x28, 0x06, 0xd8, 0x04, 0xf0, 0xde, 0xfb, 0x0b, 0x03, 0x16, 0x18, 0x0b,
+    0x00, 0x22, 0x9e, 0x23, 0x9f, 0x23, 0x07, 0xbd, 0xd5, 0x44, 0x20, 0xf0,
+    0x20, 0x1f, 0x43, 0xb9, 0xe7, 0x23, 0x9b, 0x69, 0x4a, 0x6a, 0x49, 0x1a,
+    0x40, 0x21, 0x9b, 0x22, 0x9e, 0x5b, 0x18, 0x1b, 0x05, 0x1a, 0x43, 0x17,
+    0x00, 0xee, 0xe7, 0x66, 0x4f, 0xec, 0xe7, 0x01, 0x26, 0x66, 0x4f, 0x76,
+    0x42, 0xe8, 0xe7, 0x1f, 0x9b, 0x5a, 0x1c, 0x1f, 0x92, 0x5b, 0x78, 0x30,
+    0xb6, 0x71, 0xf0, 0x32, 0x2b, 0xa0, 0xd0, 0x01, 0x23, 0x0a, 0x93, 0x1f,
+    0x9b, 0x0a, 0x22, 0x10, 0x93, 0x00, 0x23, 0x0f, 0x93, 0x0b, 0x93, 0x09,
+    0x93, 0x1f, 0x98, 0x05, 0x78, 0x2b, 0x00, 0x30, 0x3b, 0xd9, 0xb2, 0x09,
+    0x29, 0x27, 0xd9, 0x22, 0x00, 0x07, 0x99, 0x04, 0xf0, 0x32, 0xf8, 0x00,
+    0x28, 0x33, 0xd0, 0x00, 0x20, 0x2b, 0x00, 0x84, 0x46, 0x09, 0x9a, 0x0c,
+    0x90, 0x06, 0x92, 0x20, 0x22, 0x19, 0x00, 0x91, 0x43, 0xa0, 0x41, 0xc0,
+    0x07, 0x91, 0x45, 0x2a, 0x00, 0xd0, 0xc5, 0xe0, 0x06, 0x9b, 0x0a, 0x9a,
+    0x38, 0x49, 0x80, 0x8b, 0x42, 0x94, 0xd0, 0x1f, 0x9b, 0x08, 0x93, 0x20,
+    0x01, 0xf0, 0x0b, 0x08, 0x9b, 0x5b, 0x78, 0x2b, 0x2b, 0x76, 0xd0, 0x0c,
+    0x00, 0x2d, 0x2b, 0x79, 0xd1, 0x01, 0x24, 0x72, 0xe0, 0x09, 0x99, 0x08,
+    0x29, 0x09, 0xdc, 0x0b, 0x99, 0x08, 0x45, 0xf1, 0x00, 0x0b, 0x93, 0x09,
+    0x9b, 0x01, 0x30, 0x01, 0x33, 0x09, 0x93, 0x1f, 0x90, 0xc3, 0xe7, 0x0f,
+    0x14, 0x00, 0xf0, 0x03, 0x0f, 0x93, 0xf4, 0xe7, 0x1f, 0x9b, 0x09, 0x9a,
+    0x1c, 0x19, 0x1f, 0x94, 0x23, 0x78, 0x00, 0x2a, 0x39, 0xd0, 0x6e, 0x00,
+    0xf4, 0x03, 0x1a, 0x00, 0x30, 0x3a, 0x09, 0x2a, 0x12, 0xd9, 0x01, 0x22,
+    0x94, 0x46, 0xc1, 0xe7, 0x1f, 0x9b, 0x01, 0x30, 0xc6, 0x00, 0xf2, 0x3f,
+    0xf8, 0xd0, 0x1a, 0x00, 0x31, 0x3a, 0x08, 0x2a, 0x3f, 0xd8, 0x0c, 0x90,
+    0x00, 0x20, 0x1f, 0x9a, 0x06, 0x90, 0x10, 0x92, 0x1a, 0x00, 0x41, 0x1c,
+    0x30, 0x3a, 0x30, 0x2b, 0x15, 0xd0, 0x0c, 0x9b, 0x5b, 0x18, 0x0a, 0x21,
+    0x0c, 0x93, 0x06, 0x9b, 0xc4, 0x18, 0xa3, 0x42, 0x15, 0xd1, 0x06, 0x99,
+    0x06, 0x9b, 0x01, 0x31, 0x09, 0x18, 0x1b, 0x18, 0x06, 0x91, 0x08, 0x2b,
+    0x1b, 0xdc, 0x0a, 0x23, 0x0b, 0x99, 0x4b, 0x43, 0x00, 0x21, 0xd3, 0x18,
+    0x0b, 0x93, 0x1f, 0x9b, 0x08, 0x00, 0x56, 0x00, 0xf0, 0x1f, 0xc7, 0xe7,
+    0x09, 0x98, 0xd1, 0xe7, 0x08, 0x2b, 0x04, 0xdc, 0x0b, 0x9d, 0x4d, 0x43,
+    0x0b, 0x95, 0x01, 0x33, 0xe0, 0xe7, 0x5d, 0x1c, 0x10, 0x2d, 0xfa, 0xdc,
+    0x0f, 0x9d, 0x4d, 0x43, 0x0f, 0x95, 0xf6, 0xe7, 0x06, 0x9b, 0x00, 0x21,
+    0x10, 0x2b, 0xe5, 0xdc, 0x0a, 0x23, 0x0f, 0x98, 0x1e, 0x56, 0xf1, 0x04,
+    0x0f, 0x93, 0xdf, 0xe7, 0x00, 0x22, 0x0c, 0x92, 0x06, 0x92, 0x01, 0x32,
+    0xad, 0xe7, 0x00, 0x24, 0x08, 0x9b, 0x02, 0xfe, 0x00, 0x22, 0x9b, 0x78,
+    0xba, 0x00, 0xf0, 0x00, 0x13, 0xd9, 0x08, 0x9a, 0x1f, 0x92, 0x00, 0x22,
+    0x31, 0xe0, 0xc8, 0x03, 0x01, 0x10, 0xd8, 0xc4, 0x05, 0x50, 0xff, 0xef,
+    0xff, 0x33, 0x04, 0xf2, 0x2c, 0x20, 0xf0, 0x7f, 0xb4, 0x03, 0x09, 0x98,
+    0x01, 0x32, 0x22, 0x07, 0x92, 0xd6, 0x00, 0xf0, 0x39, 0x1a, 0xd8, 0x30,
+    0x3b, 0x1a, 0x00, 0x1f, 0x9b, 0x07, 0x93, 0x1f, 0x9b, 0x59, 0x1c, 0x1f,
+    0x91, 0x5b, 0x78, 0x1d, 0x00, 0x30, 0x3d, 0x09, 0x2d, 0x3a, 0xd9, 0x07,
+    0x9d, 0x49, 0x1b, 0xb1, 0x4d, 0x07, 0x95, 0x08, 0x29, 0x03, 0xdc, 0x07,
+    0x92, 0xaa, 0x42, 0x00, 0xdd, 0x07, 0x95, 0x00, 0x2c, 0x02, 0xd0, 0x07,
+    0x9a, 0x52, 0x42, 0x07, 0x92, 0x06, 0x9a, 0x00, 0x2a, 0x4c, 0xd1, 0x0a,
+    0x9a, 0x10, 0x43, 0x00, 0xd0, 0xae, 0xe6, 0x62, 0x46, 0xaa, 0x09, 0xf0,
+    0x0b, 0xc9, 0xe6, 0x69, 0x2b, 0x26, 0xd0, 0x22, 0xdc, 0x49, 0x2b, 0x23,
+    0xd0, 0x4e, 0x2b, 0x00, 0xd0, 0xc1, 0xe6, 0xa2, 0x49, 0x1f, 0xa8, 0x02,
+    0xf0, 0xa0, 0xfb, 0x26, 0x09, 0xf0, 0x01, 0xba, 0xe6, 0x1f, 0x9b, 0x1b,
+    0x78, 0x28, 0x2b, 0x2b, 0xd1, 0x9e, 0x49, 0x22, 0xaa, 0x14, 0x31, 0x1a,
+    0x00, 0xc0, 0xa7, 0xfb, 0x05, 0x28, 0x23, 0xd1, 0x23, 0x9b, 0x9a, 0x4a,
+    0x22, 0x9e, 0x4a, 0x02, 0xf1, 0x04, 0x89, 0xe6, 0x0a, 0x21, 0x4a, 0x43,
+    0xd2, 0x18, 0x30, 0x3a, 0xb7, 0xe7, 0x6e, 0x2b, 0xdf, 0xd0, 0xa0, 0xe6,
+    0x95, 0x42, 0x00, 0x11, 0x7f, 0x42, 0x00, 0xe0, 0x99, 0xe6, 0x1f, 0x9b,
+    0x92, 0x49, 0x01, 0x3b, 0x1f, 0xa8, 0x1f, 0x93, 0x02, 0xf0, 0x6c, 0x34,
+    0x32, 0x02, 0xd1, 0x1f, 0x26, 0x03, 0xb0, 0x26, 0x8a, 0x4f, 0x6b, 0xe6,
+    0x8c, 0x48, 0x03, 0xf0, 0xfe, 0xfe, 0x70, 0x53, 0x80, 0x65, 0xe6, 0x07,
+    0x9b, 0x0c, 0x9a, 0x9b, 0x1a, 0xf8, 0x13, 0x00, 0xae, 0x07, 0xf1, 0x04,
+    0x06, 0x9b, 0x09, 0x93, 0x06, 0x9c, 0x10, 0x2c, 0x00, 0xdd, 0x10, 0x24,
+    0x0b, 0x98, 0xfb, 0xf7, 0x7b, 0xfa, 0x06, 0xd0, 0x5d, 0xb1, 0x09, 0x2b,
+    0x15, 0xdd, 0x22, 0x00, 0x7f, 0x4b, 0x09, 0x3a, 0xd2, 0x34, 0x06, 0xf1,
+    0x00, 0x5b, 0x68, 0xfb, 0xf7, 0xf8, 0xf9, 0x06, 0x00, 0x0f, 0x98, 0x0f,
+    0x00, 0xfb, 0xf7, 0x68, 0x24, 0x5f, 0x00, 0x02, 0x5c, 0x30, 0xfb, 0xf7,
+    0xc6, 0x16, 0x00, 0x60, 0x00, 0x06, 0x9b, 0x0f, 0x2b, 0x39, 0x8a, 0x11,
+    0x00, 0xde, 0x2e, 0xf0, 0x0f, 0xe6, 0x24, 0xdd, 0x16, 0x2b, 0x09, 0xdc,
+    0x6f, 0x49, 0xdb, 0x00, 0xc9, 0x18, 0x32, 0x00, 0x08, 0x68, 0x49, 0x68,
+    0x3b, 0x00, 0xfb, 0xf7, 0xd8, 0xf9, 0xbd, 0xe7, 0x25, 0x23, 0x06, 0x7e,
+    0x00, 0xf7, 0x01, 0x9a, 0x93, 0x42, 0x22, 0xdb, 0x0f, 0x24, 0x06, 0x9b,
+    0x66, 0x4d, 0xe4, 0x1a, 0xe1, 0x00, 0x69, 0x26, 0x00, 0xf0, 0x0a, 0xc5,
+    0xf9, 0x0a, 0x9b, 0x1c, 0x1b, 0xe4, 0x00, 0x2c, 0x19, 0x22, 0x68, 0x63,
+    0x68, 0xe3, 0xe7, 0x0a, 0x9b, 0x16, 0x33, 0x0c, 0xdb, 0x0c, 0x9b, 0x07,
+    0x1a, 0x68, 0x30, 0x1a, 0x5a, 0x4b, 0x90, 0x00, 0x22, 0x39, 0x00, 0x92,
+    0x00, 0xf4, 0x13, 0x91, 0xf9, 0x94, 0xe7, 0x06, 0x9b, 0x1c, 0x1b, 0x0a,
+    0x9b, 0xe4, 0x18, 0x00, 0x2c, 0x72, 0xdd, 0x0f, 0x23, 0x21, 0x00, 0x19,
+    0x40, 0x1c, 0x42, 0x0a, 0xd0, 0xcb, 0x00, 0x50, 0x49, 0x32, 0x00, 0xc9,
+    0x18, 0x56, 0x00, 0x11, 0x9a, 0xa6, 0x00, 0xf1, 0x04, 0x0f, 0x23, 0x9c,
+    0x43, 0x4a, 0xd0, 0x26, 0x33, 0xff, 0x33, 0x9c, 0x42, 0x22, 0xdd, 0x00,
+    0x23, 0x06, 0x93, 0x07, 0x78, 0x03, 0xc0, 0x22, 0x23, 0x00, 0x26, 0x05,
+    0x9a, 0x3f, 0x4f, 0x13, 0x60, 0x0b, 0x9b, 0x3e, 0x18, 0x22, 0xd2, 0xe5,
+    0xf6, 0x03, 0x31, 0x3c, 0xfc, 0x09, 0x08, 0x00, 0x31, 0x38, 0xfc, 0x07,
+    0x08, 0x00, 0x31, 0x34, 0xfc, 0x0b, 0x08, 0x00, 0x31, 0x30, 0xfc, 0x06,
+    0x08, 0x00, 0x60, 0x2c, 0xfc, 0xbd, 0xe5, 0x00, 0x23, 0x08, 0x01, 0xa0,
+    0x35, 0x4d, 0x24, 0x11, 0x08, 0x93, 0x01, 0x2c, 0x1e, 0xdc, 0x26, 0x39,
+    0x00, 0x6c, 0x00, 0xf1, 0x02, 0x32, 0x4b, 0x32, 0x00, 0xff, 0x18, 0x08,
+    0x9b, 0xdd, 0x00, 0x2e, 0x4b, 0x5d, 0x19, 0x28, 0x68, 0x69, 0x88, 0x00,
+    0xf7, 0x4a, 0x56, 0xf9, 0x26, 0x4b, 0x2c, 0x4a, 0x06, 0x00, 0x0b, 0x40,
+    0x93, 0x42, 0xbe, 0xd8, 0x2b, 0x4a, 0x93, 0x42, 0x13, 0xd9, 0x01, 0x26,
+    0x2a, 0x4f, 0x76, 0x42, 0x00, 0x23, 0x08, 0x93, 0x89, 0xe0, 0x01, 0x22,
+    0x14, 0x42, 0x04, 0xd0, 0x2a, 0x68, 0x6b, 0x68, 0xfb, 0xf7, 0x40, 0xf9,
+    0x01, 0x23, 0x08, 0x9a, 0x64, 0x10, 0x01, 0x32, 0x08, 0x92, 0x08, 0x35,
+    0xd0, 0xe7, 0xd4, 0x23, 0x9b, 0x04, 0xcf, 0x18, 0xea, 0xe7, 0x00, 0x2c,
+    0xe8, 0xd0, 0x64, 0x42, 0x0f, 0x22, 0x23, 0x00, 0x13, 0x40, 0x14, 0x42,
+    0x0a, 0xd0, 0xda, 0x00, 0x15, 0x4b, 0x30, 0x16, 0x01, 0x11, 0x06, 0xec,
+    0x00, 0x79, 0x24, 0x11, 0xd5, 0xd0, 0x1f, 0x2c, 0x28, 0xe6, 0x00, 0x40,
+    0x05, 0x9a, 0x00, 0x26, 0xe4, 0x00, 0xf2, 0x01, 0x00, 0x27, 0x00, 0x2b,
+    0x8d, 0xd1, 0x5f, 0xe5, 0xc0, 0x46, 0x1f, 0x4e, 0x00, 0x00, 0xa9, 0x01,
+    0x18, 0x03, 0x00, 0x10, 0x03, 0x62, 0xa1, 0x01, 0x01, 0x10, 0x2c, 0x03,
+    0x04, 0x0a, 0x60, 0x70, 0x04, 0x01, 0x10, 0x48, 0x04, 0x18, 0x00, 0xa0,
+    0xb0, 0xfc, 0x00, 0x00, 0xa0, 0x7c, 0x00, 0x00, 0x90, 0x7c, 0xdc, 0x13,
+    0x80, 0x10, 0x23, 0x22, 0x00, 0x1a, 0x40, 0x08, 0x92, 0xee, 0x57, 0x41,
+    0x5a, 0x33, 0x08, 0x93, 0x0a, 0x5e, 0x58, 0x23, 0xc6, 0x4d, 0x28, 0x35,
+    0xbe, 0x00, 0xc4, 0xe1, 0xf8, 0x01, 0x23, 0x64, 0x10, 0x08, 0x35, 0x00,
+    0x2c, 0xf3, 0xd1, 0x14, 0x01, 0xe0, 0x08, 0x9b, 0x00, 0x2b, 0x0f, 0xd0,
+    0x6b, 0x23, 0x7a, 0x00, 0x52, 0x0d, 0x39, 0x00, 0x68, 0x06, 0xf0, 0x05,
+    0x08, 0xdd, 0x1f, 0x2b, 0x00, 0xdc, 0x24, 0xe1, 0x00, 0x26, 0x34, 0x2b,
+    0x00, 0xdc, 0x19, 0xe1, 0xdc, 0x27, 0xbf, 0x04, 0x12, 0x13, 0x02, 0x5c,
+    0x02, 0xf0, 0x01, 0x02, 0xf9, 0x00, 0x28, 0x9e, 0xd1, 0x0b, 0x9b, 0x09,
+    0x9a, 0x00, 0x93, 0x10, 0x99, 0x06, 0x9b, 0x74, 0x01, 0x40, 0xda, 0xfb,
+    0x0b, 0x90, 0xf4, 0x02, 0xf1, 0x0f, 0x1f, 0xe7, 0x0a, 0x9b, 0x07, 0x99,
+    0xda, 0x17, 0x0c, 0x9b, 0x5b, 0x1a, 0x1a, 0x40, 0x0a, 0x9b, 0x15, 0x92,
+    0xdb, 0x43, 0x0a, 0x9a, 0xdb, 0x17, 0x1a, 0x40, 0x00, 0x23, 0x1a, 0x92,
+    0xf4, 0x00, 0xa1, 0x9b, 0x05, 0x98, 0x59, 0x68, 0x02, 0xf0, 0x15, 0xfb,
+    0x09, 0x32, 0x00, 0xf0, 0x0f, 0x0b, 0xe7, 0x0b, 0x9b, 0x0b, 0x99, 0x1b,
+    0x69, 0x0c, 0x31, 0x9a, 0x1c, 0x92, 0x00, 0x0c, 0x30, 0x0c, 0x93, 0xfb,
+    0xf7, 0x19, 0xfd, 0x22, 0xab, 0x01, 0x93, 0x21, 0xab, 0x00, 0x93, 0x00,
+    0x06, 0xb1, 0x05, 0x98, 0x12, 0x96, 0x13, 0x97, 0x02, 0xf0, 0xf2, 0xfe,
+    0x20, 0x32, 0x00, 0x42, 0xf2, 0xe6, 0x01, 0x21, 0xf8, 0x01, 0x11, 0x07,
+    0x10, 0x00, 0xa0, 0xea, 0xe6, 0x21, 0x9b, 0x1a, 0x9a, 0x15, 0x9d, 0xd4,
+    0x1a, 0xc2, 0x58, 0xf2, 0x53, 0x1a, 0x9c, 0x5d, 0x19, 0x08, 0x99, 0x22,
+    0x9a, 0x5b, 0x1a, 0x36, 0x21, 0x9b, 0x18, 0x8a, 0x1a, 0x86, 0x49, 0x01,
+    0x20, 0x8c, 0x46, 0x00, 0x21, 0x01, 0x3b, 0x10, 0x91, 0x14, 0x90, 0x63,
+    0x45, 0x07, 0xda, 0x61, 0x46, 0xc9, 0x1a, 0x52, 0x1a, 0x1f, 0x29, 0x00,
+    0xdd, 0xb8, 0xe0, 0x88, 0x40, 0x14, 0x90, 0xab, 0x18, 0x0c, 0x93, 0xa4,
+    0x18, 0x08, 0x9b, 0x0c, 0x9a, 0x1c, 0x19, 0x2b, 0x00, 0x95, 0x42, 0x00,
+    0xdd, 0x13, 0x00, 0xa3, 0x42, 0x00, 0xdd, 0x23, 0x00, 0x00, 0x2b, 0x04,
+    0xdd, 0x0c, 0x9a, 0xe4, 0x1a, 0xd2, 0x1a, 0x0c, 0x92, 0xed, 0x1a, 0x15,
+    0x9b, 0x00, 0x2b, 0x17, 0xdd, 0x1a, 0x00, 0x76, 0x02, 0x13, 0xbb, 0x7e,
+    0x00, 0x60, 0xab, 0xe6, 0x01, 0x00, 0x20, 0x9a, 0x12, 0x00, 0x31, 0x02,
+    0xfc, 0x0f, 0x12, 0x00, 0x22, 0xa2, 0xe6, 0xa8, 0x02, 0x70, 0xe8, 0xfa,
+    0x0f, 0x9b, 0x20, 0x93, 0x0c, 0x7e, 0x03, 0x30, 0xdd, 0x89, 0xe0, 0x86,
+    0x03, 0x42, 0x08, 0xdd, 0x1a, 0x9a, 0xbc, 0x02, 0x22, 0x9c, 0xfc, 0xfe,
+    0x00, 0x82, 0x8c, 0xe6, 0x00, 0x2c, 0x08, 0xdd, 0x22, 0x00, 0x16, 0x00,
+    0x13, 0xed, 0x16, 0x00, 0x10, 0x81, 0x4e, 0x1b, 0x23, 0xdd, 0x2a, 0x6a,
+    0x00, 0x13, 0xe2, 0x6a, 0x00, 0x42, 0x76, 0xe6, 0x09, 0x9a, 0x5a, 0x00,
+    0x31, 0x62, 0xfd, 0x06, 0x12, 0x00, 0xf0, 0x27, 0x6d, 0xe6, 0x00, 0x22,
+    0xc3, 0x68, 0x07, 0x99, 0xc2, 0x60, 0x0f, 0x93, 0x02, 0xf0, 0x3c, 0xfd,
+    0x00, 0x28, 0x5f, 0xda, 0x0f, 0x9b, 0x33, 0x43, 0x00, 0xd0, 0x8a, 0xe0,
+    0x3b, 0x03, 0x00, 0xd0, 0x87, 0xe0, 0xd6, 0x22, 0x47, 0x4b, 0xd2, 0x04,
+    0x3b, 0x40, 0x93, 0x42, 0x00, 0xd8, 0x80, 0xe0, 0x06, 0x9b, 0x5b, 0x69,
+    0x0a, 0x93, 0x64, 0x3a, 0xe0, 0x06, 0x9b, 0x1b, 0x69, 0x0a, 0x93, 0x01,
+    0x2b, 0x76, 0xdd, 0x06, 0x99, 0x01, 0x22, 0x54, 0x00, 0xf0, 0x05, 0xaf,
+    0xfc, 0x07, 0x99, 0x06, 0x90, 0x02, 0xf0, 0x19, 0xfd, 0x00, 0x28, 0x6b,
+    0xdd, 0x08, 0x99, 0x3b, 0x00, 0x39, 0x4a, 0x64, 0x0e, 0xf1, 0x0b, 0x93,
+    0xe0, 0x11, 0x00, 0xd6, 0x20, 0x39, 0x40, 0xc0, 0x04, 0x81, 0x42, 0x00,
+    0xdd, 0x8c, 0xe0, 0xdc, 0x23, 0x9b, 0x04, 0x99, 0x42, 0x00, 0xdc, 0xa2,
+    0xe6, 0x62, 0x02, 0x71, 0x22, 0x30, 0x4b, 0xfa, 0xf7, 0xb6, 0xff, 0x48,
+    0x02, 0x50, 0x43, 0x00, 0xd0, 0x2d, 0xe6, 0xd0, 0x02, 0xf0, 0x03, 0x13,
+    0x60, 0x29, 0xe6, 0x4b, 0x23, 0x9a, 0x1a, 0x4c, 0x3b, 0x93, 0x40, 0x19,
+    0x40, 0x0f, 0x00, 0xe0, 0xe6, 0xf6, 0x62, 0xf3, 0x04, 0x9a, 0x40, 0x16,
+    0x40, 0xdb, 0xe6, 0x25, 0x49, 0xcb, 0x1a, 0x01, 0x00, 0x99, 0x40, 0x10,
+    0x91, 0x41, 0xe7, 0x0c, 0xd0, 0x00, 0x21, 0x71, 0xfc, 0xda, 0x01, 0xf0,
+    0x02, 0xd0, 0x6c, 0xe7, 0x04, 0xe6, 0x0c, 0x97, 0x00, 0x28, 0x77, 0xd1,
+    0x0f, 0x9a, 0x3b, 0x03, 0x1b, 0x0b, 0xee, 0x06, 0xc0, 0x1a, 0x4a, 0x93,
+    0x42, 0x39, 0xd1, 0x01, 0x22, 0x08, 0x9b, 0x52, 0x42, 0x2c, 0x26, 0xf0,
+    0x15, 0x00, 0x2b, 0x0b, 0xd0, 0xd4, 0x24, 0x12, 0x4b, 0x10, 0x00, 0x3b,
+    0x40, 0xe4, 0x04, 0xa3, 0x42, 0x04, 0xd8, 0x6c, 0x30, 0x1b, 0x0d, 0xc3,
+    0x1a, 0x9a, 0x40, 0x10, 0x00, 0x81, 0x42, 0x24, 0xd1, 0x0f, 0x4b, 0x0c,
+    0x9a, 0x60, 0x61, 0xf0, 0x07, 0x4b, 0x1c, 0x00, 0xd1, 0xdd, 0xe5, 0x08,
+    0x4b, 0x0c, 0x9a, 0x00, 0x26, 0x1a, 0x40, 0x13, 0x00, 0x80, 0x22, 0x52,
+    0x03, 0x9f, 0x18, 0xec, 0x02, 0x60, 0xa2, 0xd1, 0xda, 0xe5, 0xc0, 0x46,
+    0x5c, 0x03, 0x21, 0x02, 0xfc, 0x2a, 0x32, 0x70, 0x7f, 0x00, 0x00, 0x50,
+    0x39, 0xe2, 0xfb, 0xc2, 0x51, 0x20, 0x0f, 0x00, 0x4c, 0x03, 0xf0, 0x07,
+    0x33, 0x43, 0x00, 0xd1, 0x7d, 0xe7, 0x10, 0x9b, 0x00, 0x2b, 0x1d, 0xd0,
+    0x0c, 0x9b, 0x10, 0x9a, 0x13, 0x42, 0xe2, 0xd0, 0x0f, 0x9b, 0xf0, 0x00,
+    0xa0, 0x08, 0x9a, 0x00, 0x2b, 0x17, 0xd0, 0xff, 0xf7, 0x2e, 0xfb, 0x6c,
+    0x05, 0x71, 0x12, 0x98, 0x13, 0x99, 0xfa, 0xf7, 0x10, 0xfe, 0x00, 0xe0,
+    0xd1, 0xe7, 0x01, 0x26, 0x13, 0x40, 0x99, 0x4a, 0x76, 0x42, 0x9b, 0x18,
+    0x98, 0x4a, 0x1e, 0x06, 0xd7, 0xc8, 0xe7, 0x14, 0x9b, 0x33, 0x42, 0xc5,
+    0xd0, 0xe1, 0xe7, 0xff, 0xf7, 0x16, 0x30, 0x00, 0x21, 0xef, 0xfe, 0xb8,
+    0x49, 0xd0, 0x00, 0x0f, 0x00, 0xfa, 0xf7, 0x5c, 0xff, 0x00, 0x28, 0xb4,
+    0xd0, 0xfc, 0xe5, 0x16, 0x12, 0xa0, 0x02, 0xf0, 0xe5, 0xfd, 0x80, 0x23,
+    0x00, 0x22, 0xdb, 0x05, 0xd6, 0x0b, 0x02, 0x1c, 0x00, 0x42, 0x75, 0xd0,
+    0x0f, 0x9b, 0xa6, 0x09, 0xf0, 0x07, 0x84, 0x4c, 0x00, 0x25, 0x10, 0x93,
+    0x11, 0x94, 0x82, 0x4c, 0x83, 0x4a, 0x0c, 0x9b, 0x13, 0x40, 0x14, 0x93,
+    0x14, 0x9a, 0x81, 0x4b, 0xac, 0x60, 0xf1, 0x00, 0xac, 0xe0, 0x80, 0x4a,
+    0x0c, 0x9b, 0x94, 0x46, 0x63, 0x44, 0x1f, 0x00, 0x10, 0x9a, 0x11, 0xa8,
+    0x00, 0x80, 0x0c, 0x92, 0x0d, 0x93, 0x02, 0xf0, 0xe5, 0xfc, 0x76, 0x00,
+    0x80, 0x0c, 0x98, 0x0d, 0x99, 0xfa, 0xf7, 0xe4, 0xfe, 0x4c, 0x03, 0xa0,
+    0xfa, 0xf7, 0xb9, 0xfe, 0x73, 0x4a, 0x75, 0x4b, 0x06, 0x00, 0xce, 0x2a,
+    0x50, 0x5e, 0xd9, 0x13, 0x9a, 0x73, 0x6e, 0x4b, 0xf2, 0x00, 0xd1, 0x12,
+    0x9b, 0x01, 0x33, 0x00, 0xd1, 0x45, 0xe5, 0x01, 0x26, 0x6f, 0x4f, 0x76,
+    0x42, 0x96, 0x01, 0x22, 0x88, 0xf9, 0x96, 0x02, 0x22, 0x84, 0xf9, 0x88,
+    0x02, 0x22, 0x80, 0xf9, 0x60, 0x05, 0xe0, 0x7c, 0xf9, 0x1c, 0xe6, 0x00,
+    0x2e, 0x1c, 0xd1, 0x0c, 0x9b, 0x1b, 0x03, 0x1f, 0xd1, 0xac, 0x5d, 0xa0,
+    0x29, 0x00, 0x5d, 0x4b, 0xfa, 0xf7, 0xfe, 0xfe, 0x00, 0x28, 0x18, 0x22,
+    0xa0, 0x29, 0x00, 0x00, 0x22, 0x5f, 0x4b, 0xfa, 0xf7, 0xab, 0xfe, 0x42,
+    0x0b, 0x00, 0x8a, 0x09, 0xf1, 0x05, 0xe3, 0x18, 0x1c, 0x95, 0x1d, 0x93,
+    0x1c, 0x9a, 0x1d, 0x9b, 0x10, 0x92, 0x11, 0x93, 0x9e, 0xe7, 0x01, 0x2e,
+    0x03, 0xd1, 0x18, 0x03, 0xf2, 0x00, 0xd1, 0x7f, 0xe5, 0x00, 0x23, 0x55,
+    0x4c, 0x91, 0xe7, 0x0f, 0x9d, 0x52, 0x4c, 0xe9, 0xe7, 0x4c, 0x00, 0x80,
+    0x50, 0x4b, 0xfa, 0xf7, 0x8d, 0xfe, 0x0f, 0x9a, 0x1a, 0x62, 0xf3, 0x0e,
+    0x0c, 0x00, 0x00, 0x2a, 0x07, 0xd1, 0x80, 0x22, 0x12, 0x06, 0x8b, 0x18,
+    0x16, 0x90, 0x17, 0x93, 0x16, 0x9a, 0x17, 0x9b, 0xdc, 0xe7, 0x02, 0x00,
+    0x16, 0x92, 0x17, 0x93, 0xf8, 0x7c, 0x05, 0x00, 0xd4, 0x01, 0xb0, 0xa5,
+    0xd1, 0x3d, 0x4b, 0x14, 0x9a, 0x3b, 0x40, 0x9a, 0x42, 0xa0, 0x40, 0x3d,
+    0x90, 0x00, 0xfa, 0xf7, 0x39, 0xff, 0xfa, 0xf7, 0x2b, 0xff, 0x00, 0x01,
+    0x02, 0x10, 0x00, 0xc0, 0x34, 0xfe, 0x3b, 0x03, 0x0f, 0x9a, 0x1b, 0x0b,
+    0x33, 0x43, 0x13, 0x43, 0x60, 0x01, 0xc0, 0x38, 0x4a, 0x00, 0x2b, 0x55,
+    0xd0, 0x38, 0x4b, 0xfa, 0xf7, 0xa2, 0xfe, 0x7c, 0x02, 0x20, 0xd0, 0xe4,
+    0x7c, 0x00, 0x20, 0x35, 0x4a, 0xd0, 0x02, 0x10, 0xaf, 0x12, 0x00, 0x50,
+    0xd1, 0x7b, 0xe7, 0xc6, 0xe4, 0x5c, 0x00, 0xc0, 0x2b, 0xd0, 0xd4, 0x23,
+    0x14, 0x9a, 0xdb, 0x04, 0x9a, 0x42, 0x26, 0xd8, 0x4c, 0x00, 0x31, 0x2d,
+    0x4a, 0x2d, 0xa2, 0x00, 0x42, 0x00, 0x28, 0x17, 0xd0, 0x5c, 0x00, 0x11,
+    0xeb, 0x30, 0x00, 0x57, 0x01, 0x30, 0xfa, 0xf7, 0xa6, 0xb8, 0x00, 0x13,
+    0x22, 0xb8, 0x00, 0x71, 0x18, 0x90, 0x19, 0x93, 0x18, 0x9a, 0x19, 0xfc,
+    0x00, 0xe0, 0xd6, 0x22, 0x11, 0x9b, 0xd2, 0x04, 0x9b, 0x18, 0x14, 0x9a,
+    0x9b, 0x1a, 0x11, 0x93, 0x10, 0x02, 0x71, 0x10, 0x9e, 0x11, 0x9f, 0x02,
+    0xf0, 0x10, 0xaa, 0x01, 0x00, 0xba, 0x01, 0xb0, 0xfa, 0xf7, 0x0f, 0xfe,
+    0x12, 0x9a, 0x13, 0x9b, 0xfa, 0xf7, 0xe4, 0x74, 0x6c, 0xf1, 0x03, 0x00,
+    0x8f, 0xe7, 0x02, 0x00, 0x18, 0x92, 0x19, 0x93, 0xdd, 0xe7, 0x11, 0x4b,
+    0xfa, 0xf7, 0x4c, 0xfe, 0xb1, 0x70, 0x26, 0x11, 0xf0, 0xac, 0x02, 0x00,
+    0xfc, 0x0b, 0x02, 0xc0, 0x02, 0x20, 0xe0, 0x7f, 0x10, 0x06, 0x31, 0xff,
+    0xff, 0x9f, 0x0c, 0x06, 0x30, 0x00, 0x00, 0xe0, 0x18, 0x00, 0xf0, 0x01,
+    0xbf, 0x95, 0x35, 0xa0, 0x94, 0xff, 0xff, 0xdf, 0x3f, 0x35, 0xe5, 0xaf,
+    0x35, 0x00, 0x00, 0xc0, 0xa3, 0x26, 0x50, 0x41, 0xff, 0xff, 0xcf, 0x3f,
+    0xb4, 0x24, 0x31, 0xff, 0xf7, 0xe4, 0x20, 0x25, 0x22, 0xa4, 0x0a, 0x68,
+    0x46, 0xa2, 0x16, 0x00, 0x04, 0x00, 0xf8, 0xf7, 0x1e, 0xfc, 0x33, 0x00,
+    0xf6, 0x0d, 0x20, 0xd5, 0xf9, 0xea, 0x30, 0x00, 0x0a, 0x0e, 0x40, 0xf8,
+    0xf7, 0x13, 0xfc, 0x14, 0x00, 0x00, 0x34, 0x00, 0x20, 0xca, 0xf9, 0x34,
+    0x0f, 0x00, 0x34, 0x00, 0x20, 0xf8, 0xb5, 0x32, 0x00, 0x55, 0x0d, 0x00,
+    0xf8, 0xf7, 0x04, 0x34, 0x00, 0x21, 0xbb, 0xf9, 0x94, 0x5d, 0x01, 0xca,
+    0x00, 0x00, 0x18, 0x01, 0xf0, 0x01, 0x10, 0xfe, 0x00, 0x28, 0x0d, 0xd0,
+    0x1d, 0x48, 0x00, 0x2c, 0x06, 0xda, 0xff, 0xf7, 0x4c, 0xf8, 0x0c, 0x02,
+    0xe0, 0xc5, 0x18, 0x28, 0x1c, 0xf8, 0xbd, 0xff, 0xf7, 0x45, 0xf8, 0x05,
+    0x1c, 0xf9, 0xe7, 0x70, 0x47, 0xf1, 0x08, 0xfa, 0xf7, 0x8f, 0xfe, 0x47,
+    0x00, 0x7f, 0x08, 0x05, 0x1c, 0x13, 0x49, 0x38, 0x1c, 0x03, 0xf0, 0x56,
+    0xfd, 0x00, 0x28, 0xec, 0xd1, 0x10, 0x0c, 0x00, 0xc0, 0x48, 0xfd, 0x00,
+    0x28, 0xe6, 0xd1, 0x01, 0x22, 0x64, 0x00, 0x64, 0x08, 0x54, 0x00, 0x40,
+    0x0c, 0x4b, 0x52, 0x42, 0x1a, 0x01, 0x00, 0xf8, 0x7d, 0x20, 0x01, 0x22,
+    0x12, 0x00, 0x11, 0x07, 0x12, 0x00, 0xf0, 0x03, 0xc6, 0xfd, 0x00, 0x28,
+    0xd2, 0xd0, 0xf8, 0xf7, 0xbe, 0xfb, 0x22, 0x23, 0x03, 0x60, 0xcd, 0xe7,
+    0xc0, 0x46, 0x2c, 0x07, 0x40, 0xff, 0xff, 0x7f, 0x7f, 0x10, 0x01, 0x00,
+    0xfc, 0x2d, 0x00, 0xaa, 0x00, 0x11, 0xaf, 0xd2, 0x0e, 0x5b, 0x23, 0x4b,
+    0xff, 0xf7, 0x66, 0xaa, 0x00, 0x26, 0xbb, 0xfd, 0xaa, 0x00, 0x46, 0xfe,
+    0xf7, 0xf7, 0xff, 0xaa, 0x00, 0x10, 0xfe, 0xe8, 0x5f, 0x05, 0xaa, 0x00,
+    0x13, 0x3a, 0xaa, 0x00, 0x11, 0x14, 0x9e, 0x00, 0x11, 0x01, 0xaa, 0x00,
+    0x11, 0x11, 0x0c, 0x00, 0x2f, 0xf3, 0xfc, 0xaa, 0x00, 0x01, 0x17, 0x8f,
+    0xaa, 0x00, 0x11, 0x08, 0x12, 0x00, 0x13, 0x71, 0xaa, 0x00, 0x13, 0x69,
+    0xaa, 0x00, 0x00, 0x4c, 0x01, 0x08, 0xac, 0x00, 0x00, 0x16, 0x49, 0x60,
+    0x1e, 0x00, 0x05, 0x90, 0x01, 0x91, 0x84, 0x39, 0xf1, 0x2a, 0x45, 0xd0,
+    0x0b, 0x00, 0x24, 0x2e, 0x42, 0xd8, 0x3f, 0x4a, 0x08, 0x21, 0x94, 0x46,
+    0x1a, 0x00, 0x60, 0x46, 0x14, 0x78, 0x01, 0x33, 0x00, 0x5d, 0x1d, 0x00,
+    0x07, 0x00, 0x0f, 0x40, 0x08, 0x42, 0xf5, 0xd1, 0x2d, 0x2c, 0x3a, 0xd1,
+    0x01, 0x27, 0x1c, 0x78, 0x95, 0x1c, 0x00, 0x2e, 0x65, 0xd0, 0x10, 0x2e,
+    0x09, 0xd1, 0x30, 0x2c, 0x07, 0xd1, 0x20, 0xb0, 0x43, 0xf0, 0x23, 0x58,
+    0x2b, 0x57, 0xd1, 0x10, 0x26, 0x6c, 0x78, 0x02, 0x35, 0x30, 0x4b, 0x31,
+    0x00, 0xfb, 0x18, 0x18, 0x00, 0x03, 0x93, 0xfa, 0xf7, 0x6c, 0xfa, 0x00,
+    0x23, 0x01, 0x22, 0x84, 0x46, 0x18, 0x00, 0x04, 0x91, 0x52, 0x42, 0x21,
+    0x00, 0x30, 0x39, 0x09, 0x29, 0x1d, 0xd8, 0x0c, 0x00, 0xa6, 0x42, 0x28,
+    0xdd, 0x86, 0x5a, 0xf0, 0x07, 0x13, 0x00, 0x84, 0x45, 0x06, 0xd3, 0x02,
+    0xd1, 0x04, 0x99, 0xa1, 0x42, 0x02, 0xdb, 0x01, 0x23, 0x70, 0x43, 0x20,
+    0x18, 0x2c, 0x78, 0x9e, 0x1b, 0x40, 0xfd, 0xf7, 0x29, 0xfc, 0xbe, 0x10,
+    0x20, 0x00, 0x20, 0x60, 0x1f, 0x40, 0x2b, 0x2c, 0xc5, 0xd1, 0x78, 0x00,
+    0xf0, 0x13, 0xc2, 0xe7, 0x21, 0x00, 0x41, 0x39, 0x19, 0x29, 0x01, 0xd8,
+    0x37, 0x3c, 0xdc, 0xe7, 0x21, 0x00, 0x61, 0x39, 0x19, 0x29, 0x03, 0xd8,
+    0x57, 0x3c, 0xd6, 0xe7, 0x13, 0x00, 0xe2, 0xe7, 0x00, 0x2b, 0x09, 0xda,
+    0x14, 0x06, 0x40, 0x03, 0x98, 0x13, 0x60, 0x62, 0x43, 0x80, 0xe1, 0xd0,
+    0x6b, 0x1e, 0x01, 0x93, 0x07, 0xe0, 0x98, 0x2a, 0x20, 0x40, 0x42, 0x80,
+    0x15, 0x20, 0xd8, 0xd0, 0x5e, 0x3e, 0x20, 0x02, 0x9b, 0x78, 0x6a, 0xf0,
+    0x09, 0xd2, 0xe7, 0x30, 0x24, 0x00, 0x2e, 0xa7, 0xd1, 0x08, 0x36, 0xa5,
+    0xe7, 0x30, 0x2c, 0x9b, 0xd0, 0x0a, 0x26, 0xa1, 0xe7, 0xc0, 0x46, 0x29,
+    0x02, 0x20, 0x0c, 0x20, 0xff, 0x7f, 0x18, 0x26, 0x13, 0x6f, 0xa2, 0x10,
+    0x02, 0xb0, 0x02, 0x24, 0xc6, 0xfa, 0x7c, 0x02, 0x00, 0x30, 0x41, 0x06,
+    0x18, 0x00, 0x15, 0xba, 0x18, 0x00, 0x11, 0x57, 0x18, 0x00, 0x30, 0x05,
+    0x00, 0x0e, 0x00, 0x02, 0x16, 0xfa, 0x12, 0x13, 0x31, 0xfd, 0xf7, 0x4a,
+    0xb8, 0x02, 0x82, 0x20, 0x00, 0xa1, 0x68, 0x02, 0xf0, 0x20, 0xfe, 0xd8,
+    0x33, 0x00, 0x40, 0x00, 0x00, 0x8c, 0x13, 0x04, 0x24, 0x00, 0x17, 0x38,
+    0x24, 0x00, 0x60, 0x0e, 0xfe, 0x70, 0xbd, 0x30, 0xb5, 0xac, 0x38, 0x93,
+    0x1a, 0x00, 0x9d, 0xb0, 0x00, 0x2c, 0x05, 0xda, 0x8b, 0xca, 0x11, 0xf1,
+    0x32, 0x1d, 0xb0, 0x30, 0xbd, 0x82, 0x23, 0x68, 0x46, 0x9b, 0x00, 0x83,
+    0x81, 0x00, 0x23, 0x00, 0x91, 0x04, 0x91, 0x9c, 0x42, 0x00, 0xd0, 0x63,
+    0x1e, 0x02, 0x93, 0x05, 0x93, 0x01, 0x23, 0x69, 0x46, 0x5b, 0x42, 0xcb,
+    0x81, 0x28, 0x00, 0x20, 0x9b, 0x02, 0xf0, 0x5e, 0xfc, 0x43, 0x1c, 0x01,
+    0xda, 0x8b, 0x23, 0x2b, 0x60, 0x00, 0x2c, 0xe3, 0xd0, 0x00, 0x23, 0x00,
+    0x9a, 0x13, 0x70, 0xdf, 0xe7, 0xf7, 0xb8, 0x00, 0x11, 0x1f, 0xba, 0x00,
+    0x11, 0x5d, 0xba, 0x00, 0x20, 0x00, 0x97, 0xbc, 0x00, 0x20, 0xc8, 0xff,
+    0x5c, 0x63, 0x02, 0x58, 0x11, 0xcf, 0x1a, 0x00, 0x00, 0x23, 0x05, 0x4d,
+    0x2b, 0x60, 0x03, 0xf0, 0x5f, 0xfb, 0xc4, 0x12, 0x02, 0x07, 0xe8, 0x12,
+    0x3f, 0x03, 0xf0, 0x50, 0x24, 0x00, 0x02, 0x00, 0x54, 0x68, 0xf1, 0xac,
+    0x0b, 0x69, 0x32, 0x69, 0x87, 0xb0, 0x00, 0x20, 0x03, 0x91, 0x9a, 0x42,
+    0x65, 0xdb, 0x01, 0x3b, 0x9c, 0x00, 0x00, 0x93, 0x0b, 0x00, 0x14, 0x33,
+    0x05, 0x93, 0x1b, 0x19, 0x04, 0x93, 0x33, 0x00, 0x14, 0x33, 0x02, 0x93,
+    0x1c, 0x19, 0x04, 0x9b, 0x27, 0x68, 0x1b, 0x68, 0x38, 0x00, 0x5d, 0x1c,
+    0x29, 0x00, 0x01, 0x93, 0xfa, 0xf7, 0x52, 0xf9, 0x01, 0x90, 0xaf, 0x42,
+    0x24, 0xd3, 0x00, 0x25, 0xac, 0x46, 0x02, 0x98, 0x05, 0x9f, 0x08, 0xcf,
+    0x01, 0x9a, 0x99, 0xb2, 0x51, 0x43, 0x1b, 0x0c, 0x53, 0x43, 0x49, 0x19,
+    0x0a, 0x0c, 0x9b, 0x18, 0x02, 0x68, 0x89, 0xb2, 0x92, 0xb2, 0x62, 0x44,
+    0x52, 0x1a, 0x01, 0x68, 0x1d, 0x0c, 0x09, 0x0c, 0x9b, 0xb2, 0xcb, 0x1a,
+    0x11, 0x14, 0x5b, 0x18, 0x19, 0x14, 0x92, 0xb2, 0x1b, 0x04, 0x1a, 0x43,
+    0x04, 0x9b, 0x8c, 0x46, 0x04, 0xc0, 0xbb, 0x42, 0xe1, 0xd2, 0x23, 0x68,
+    0x00, 0x2b, 0x30, 0xd0, 0x30, 0x00, 0x03, 0x99, 0x02, 0xf0, 0xe2, 0xf8,
+    0x00, 0x28, 0x21, 0xdb, 0x30, 0x00, 0x00, 0x24, 0x01, 0x9b, 0x03, 0x99,
+    0x01, 0x33, 0x01, 0x93, 0x14, 0x30, 0x14, 0x31, 0x03, 0x68, 0x20, 0xc9,
+    0x9a, 0xb2, 0x14, 0x19, 0xaa, 0xb2, 0xa2, 0x1a, 0x1b, 0x0c, 0x2d, 0x0c,
+    0x14, 0x14, 0x5b, 0x1b, 0x1b, 0x19, 0x1c, 0x4a, 0x00, 0xf1, 0x02, 0x13,
+    0x43, 0x08, 0xc0, 0x04, 0x9b, 0x8b, 0x42, 0xec, 0xd2, 0x00, 0x9b, 0x02,
+    0x9a, 0x9b, 0x00, 0xd3, 0x3c, 0x13, 0x40, 0x15, 0xd0, 0x01, 0x98, 0x94,
+    0x02, 0x00, 0x5c, 0x00, 0x22, 0x06, 0xd1, 0xc8, 0x27, 0xe0, 0x02, 0x9b,
+    0x04, 0x3c, 0xa3, 0x42, 0xf5, 0xd3, 0x00, 0x9b, 0x33, 0x61, 0xc7, 0xe7,
+    0x26, 0x00, 0xd3, 0x06, 0xd1, 0x00, 0x9a, 0x01, 0x3a, 0x00, 0x92, 0x02,
+    0x9a, 0x04, 0x3b, 0x9a, 0x1a, 0x00, 0x80, 0xe2, 0xe7, 0xf0, 0xb5, 0x9d,
+    0xb0, 0x02, 0x92, 0x08, 0x2f, 0xf0, 0x23, 0x03, 0x9c, 0x08, 0x93, 0x09,
+    0x94, 0x44, 0x6a, 0x07, 0x00, 0x25, 0x9d, 0x00, 0x2c, 0x0e, 0xd1, 0x10,
+    0x20, 0xfd, 0xf7, 0x0c, 0xfc, 0x02, 0x1e, 0x78, 0x62, 0x04, 0xd1, 0xea,
+    0x21, 0xc8, 0x4b, 0xc8, 0x48, 0xfa, 0xf7, 0x71, 0xf8, 0x44, 0x60, 0x84,
+    0x60, 0x04, 0x60, 0xc4, 0x60, 0x7b, 0x6a, 0x19, 0x68, 0x2e, 0x3d, 0xa0,
+    0x5a, 0x68, 0x01, 0x23, 0x93, 0x40, 0x4a, 0x60, 0x8b, 0x60, 0x12, 0x49,
+    0x80, 0xed, 0xfd, 0x00, 0x22, 0x7b, 0x6a, 0x1a, 0x60, 0x10, 0x30, 0xf1,
+    0x11, 0x20, 0xda, 0x01, 0x23, 0x2b, 0x60, 0x03, 0x9b, 0x5b, 0x00, 0x5b,
+    0x08, 0x09, 0x93, 0x09, 0x9d, 0xb9, 0x4b, 0xb9, 0x4a, 0x2b, 0x40, 0x93,
+    0x42, 0x17, 0xd1, 0xb8, 0x4b, 0x24, 0x9a, 0x28, 0x03, 0x12, 0x03, 0xf0,
+    0x00, 0x0b, 0x18, 0x43, 0x01, 0xd1, 0x00, 0xf0, 0xc0, 0xfd, 0xb4, 0x48,
+    0x26, 0x9b, 0x06, 0x90, 0x3c, 0x11, 0x91, 0xb2, 0x4b, 0x26, 0x9a, 0x13,
+    0x60, 0x06, 0x98, 0x1d, 0xc6, 0x69, 0x30, 0x2b, 0x60, 0xe1, 0xe4, 0x6b,
+    0x50, 0x9c, 0x12, 0x93, 0x13, 0x94, 0x32, 0x06, 0x00, 0x3e, 0x08, 0xf0,
+    0x13, 0xfa, 0xf7, 0x3f, 0xfb, 0x04, 0x1e, 0x09, 0xd0, 0x01, 0x23, 0x24,
+    0x9a, 0x13, 0x60, 0xa7, 0x4b, 0x06, 0x93, 0x26, 0x9b, 0x00, 0x2b, 0xe5,
+    0xd0, 0xa6, 0x4b, 0xe1, 0xe7, 0x1a, 0xab, 0x01, 0x93, 0x1b, 0xab, 0xc6,
+    0x21, 0x00, 0x48, 0x06, 0xe0, 0x02, 0xf0, 0x56, 0xf9, 0x6e, 0x00, 0x05,
+    0x90, 0x76, 0x0d, 0x00, 0xd1, 0x7c, 0xe0, 0x40, 0x00, 0xf0, 0x0d, 0x13,
+    0x9b, 0x9d, 0x4a, 0x1b, 0x03, 0x1b, 0x0b, 0x1a, 0x43, 0x11, 0x00, 0x9c,
+    0x4b, 0x18, 0x94, 0xf6, 0x18, 0x00, 0x22, 0x9b, 0x4b, 0xfa, 0xf7, 0xa3,
+    0xfa, 0x9a, 0x4a, 0x08, 0x00, 0x13, 0xcf, 0x08, 0x00, 0x51, 0xa4, 0xfa,
+    0x04, 0x00, 0x30, 0x8a, 0x08, 0x91, 0x3f, 0xfb, 0x98, 0x4a, 0x98, 0x4b,
+    0xfa, 0xf7, 0xc2, 0x62, 0x0e, 0x00, 0x28, 0x07, 0x42, 0xfa, 0xf7, 0x95,
+    0xfa, 0xa6, 0x08, 0x60, 0x49, 0xfb, 0x00, 0x22, 0x02, 0x90, 0x16, 0x24,
+    0x00, 0x16, 0x00, 0xc0, 0xfc, 0xfa, 0x00, 0x28, 0x0b, 0xd0, 0x02, 0x98,
+    0xfa, 0xf7, 0x25, 0xfb, 0xa4, 0x12, 0x40, 0xfa, 0xf7, 0xeb, 0xfa, 0xbc,
+    0x37, 0xf0, 0x01, 0x02, 0x9b, 0x1b, 0x1a, 0x02, 0x93, 0x01, 0x23, 0x16,
+    0x93, 0x02, 0x9b, 0x16, 0x2b, 0x0f, 0xd8, 0x88, 0x00, 0x42, 0xda, 0x00,
+    0x84, 0x4b, 0xc6, 0x0e, 0x80, 0xfa, 0xf7, 0xe0, 0xfa, 0x00, 0x28, 0x49,
+    0xd0, 0x80, 0x1a, 0xa0, 0x02, 0x93, 0x00, 0x23, 0x16, 0x93, 0x1a, 0x9b,
+    0x9e, 0x1b, 0xe0, 0x20, 0xf0, 0x03, 0x33, 0x00, 0x01, 0x3b, 0x0d, 0x93,
+    0x04, 0xd5, 0x01, 0x23, 0x9b, 0x1b, 0x0a, 0x93, 0x00, 0x23, 0x0d, 0x93,
+    0x44, 0x04, 0x51, 0x36, 0xdb, 0x02, 0x9a, 0x0d, 0xf2, 0x08, 0xf0, 0x58,
+    0x0d, 0x93, 0x00, 0x23, 0x15, 0x92, 0x0e, 0x93, 0x22, 0x9b, 0x01, 0x24,
+    0x09, 0x2b, 0x64, 0xd8, 0x05, 0x2b, 0x02, 0xdd, 0x00, 0x24, 0x04, 0x3b,
+    0x22, 0x93, 0x22, 0x9b, 0x98, 0x1e, 0x03, 0x28, 0x64, 0xd8, 0x03, 0xf0,
+    0xd0, 0xfa, 0x29, 0x38, 0x36, 0x58, 0x1a, 0x9b, 0x1b, 0x9a, 0x9e, 0x18,
+    0x69, 0x4b, 0xf2, 0x18, 0x20, 0x2a, 0x0f, 0xdd, 0x40, 0x23, 0x9b, 0x1a,
+    0x9d, 0x40, 0x66, 0x4b, 0x02, 0x98, 0xf3, 0x18, 0xd8, 0x40, 0x28, 0x43,
+    0xfa, 0xf7, 0xc9, 0xfa, 0x01, 0x23, 0x63, 0x4c, 0x01, 0x3e, 0x09, 0x19,
+    0x18, 0x93, 0x76, 0xe7, 0x20, 0x23, 0x02, 0x98, 0x9b, 0x1a, 0x98, 0x40,
+    0xf2, 0xe7, 0x16, 0x90, 0xb8, 0xe7, 0x0a, 0x6a, 0x02, 0x60, 0x1a, 0x0a,
+    0x93, 0x53, 0x42, 0x0e, 0x70, 0x00, 0x30, 0x93, 0xc7, 0xe7, 0x1c, 0x12,
+    0x90, 0x23, 0x9b, 0x0c, 0x93, 0x07, 0x93, 0x00, 0x2b, 0x13, 0x5c, 0x20,
+    0x10, 0x00, 0x0c, 0x00, 0xf0, 0x09, 0x23, 0x92, 0x0d, 0xe0, 0x01, 0x23,
+    0xf1, 0xe7, 0x00, 0x23, 0x23, 0x9a, 0x0f, 0x93, 0x94, 0x46, 0x02, 0x9b,
+    0x63, 0x44, 0x0c, 0x93, 0x01, 0x33, 0x26, 0x00, 0xf0, 0x07, 0x00, 0xdc,
+    0x01, 0x23, 0x00, 0x22, 0x78, 0x6a, 0x42, 0x60, 0x04, 0x32, 0x15, 0x00,
+    0x14, 0x35, 0x41, 0x68, 0x9d, 0x42, 0x19, 0xd9, 0x32, 0x02, 0x20, 0x90,
+    0xfc, 0xce, 0x0b, 0xf0, 0x00, 0x17, 0xd1, 0xd5, 0x21, 0x02, 0x00, 0x44,
+    0x4b, 0x49, 0x00, 0xcb, 0xe6, 0x01, 0x23, 0xde, 0x62, 0x00, 0x51, 0x94,
+    0x22, 0x93, 0x01, 0x3b, 0x64, 0x00, 0xf0, 0x14, 0x22, 0x13, 0x33, 0xd0,
+    0xe7, 0x01, 0x23, 0x0f, 0x93, 0x02, 0x3b, 0xf6, 0xe7, 0x01, 0x31, 0x41,
+    0x60, 0x52, 0x00, 0xdc, 0xe7, 0x7b, 0x6a, 0x06, 0x9a, 0x1a, 0x60, 0x07,
+    0x9b, 0x0e, 0x2b, 0x00, 0xd9, 0xec, 0xe0, 0x76, 0x7a, 0x20, 0xe9, 0xe0,
+    0x1e, 0x01, 0xa0, 0x69, 0xdd, 0x1a, 0x00, 0x0f, 0x21, 0x2d, 0x4b, 0x0a,
+    0x40, 0x96, 0x0f, 0xf2, 0x0b, 0x1d, 0x68, 0x5e, 0x68, 0x02, 0x9b, 0x1c,
+    0x11, 0x02, 0x23, 0x10, 0x93, 0x02, 0x9b, 0xdb, 0x05, 0x0b, 0xd5, 0x2c,
+    0x4b, 0x0c, 0x40, 0x1a, 0x6a, 0x5b, 0x6a, 0x8e, 0x0a, 0x40, 0xba, 0xf9,
+    0x03, 0x23, 0xce, 0x6e, 0xa0, 0x10, 0x93, 0x26, 0x4b, 0x14, 0x93, 0x00,
+    0x2c, 0x08, 0xd1, 0xb8, 0x6e, 0x80, 0x2a, 0x00, 0x33, 0x00, 0xfa, 0xf7,
+    0xac, 0xf9, 0x1a, 0x00, 0xf1, 0x04, 0x5d, 0xe0, 0x01, 0x23, 0x1c, 0x42,
+    0x0b, 0xd0, 0x10, 0x9b, 0x28, 0x00, 0x01, 0x33, 0x10, 0x93, 0x14, 0x9b,
+    0x31, 0xd4, 0x0e, 0x00, 0x3c, 0x00, 0x00, 0x58, 0x05, 0xf2, 0x01, 0x14,
+    0x9b, 0x64, 0x10, 0x08, 0x33, 0xe0, 0xe7, 0xc0, 0x46, 0x36, 0x03, 0x01,
+    0x10, 0x4d, 0x03, 0xb4, 0x0e, 0xa2, 0x0f, 0x27, 0x00, 0x00, 0x32, 0x03,
+    0x01, 0x10, 0x35, 0x03, 0x68, 0x22, 0x12, 0xad, 0xcc, 0x0e, 0x21, 0x3f,
+    0x01, 0x74, 0x0b, 0xf0, 0x0b, 0xf8, 0x3f, 0x61, 0x43, 0x6f, 0x63, 0xa7,
+    0x87, 0xd2, 0x3f, 0xb3, 0xc8, 0x60, 0x8b, 0x28, 0x8a, 0xc6, 0x3f, 0xfb,
+    0x79, 0x9f, 0x50, 0x13, 0x44, 0xd3, 0x3f, 0xe0, 0x0e, 0x00, 0x60, 0x54,
+    0x11, 0x12, 0x0c, 0x12, 0x42, 0x10, 0xfe, 0x7c, 0x03, 0xf0, 0x0e, 0x02,
+    0xc0, 0x00, 0x40, 0x00, 0x2b, 0x16, 0xd0, 0xb8, 0x00, 0x91, 0x5c, 0x42,
+    0x0f, 0x23, 0xb6, 0x4a, 0x23, 0x40, 0xdb, 0x00, 0x04, 0x00, 0x8c, 0x00,
+    0x51, 0x74, 0xf9, 0x01, 0x26, 0x00, 0xca, 0x00, 0xf1, 0x00, 0xb1, 0x4d,
+    0x24, 0x11, 0x00, 0x2c, 0x00, 0xd0, 0x94, 0xe0, 0x00, 0x2b, 0x9e, 0xd1,
+    0x16, 0x68, 0x0a, 0x62, 0x9b, 0xe0, 0x08, 0x9c, 0x09, 0x9d, 0x60, 0x0a,
+    0x60, 0xaa, 0x4b, 0xfa, 0xf7, 0xa8, 0xf9, 0xb2, 0x09, 0x20, 0x90, 0xe0,
+    0xc4, 0x19, 0x40, 0x00, 0xd1, 0x8c, 0xe0, 0x8e, 0x0a, 0x42, 0x46, 0xdd,
+    0x02, 0x9b, 0x22, 0x00, 0xa0, 0x5e, 0x1e, 0xa2, 0x4b, 0xfa, 0xf7, 0x4b,
+    0xf9, 0x10, 0x9b, 0x50, 0x00, 0x00, 0xf4, 0x00, 0x40, 0x0c, 0x9b, 0x10,
+    0x98, 0x42, 0x00, 0x60, 0x14, 0x93, 0xfa, 0xf7, 0xb8, 0xf9, 0xb8, 0x19,
+    0xf0, 0x01, 0xfa, 0xf7, 0x3b, 0xf9, 0x00, 0x22, 0x99, 0x4b, 0xfa, 0xf7,
+    0x10, 0xf9, 0x10, 0x90, 0x11, 0x91, 0x7a, 0x0b, 0x71, 0x08, 0x92, 0x09,
+    0x93, 0x95, 0x4a, 0x11, 0x9a, 0x02, 0x93, 0x17, 0x93, 0x09, 0x93, 0x14,
+    0x9b, 0x00, 0x2b, 0x61, 0x22, 0x0b, 0xa2, 0x90, 0x4b, 0xfa, 0xf7, 0xf2,
+    0xf8, 0x08, 0x9a, 0x17, 0x9b, 0x38, 0x03, 0x10, 0x7d, 0x82, 0x00, 0xb2,
+    0xd0, 0xaf, 0xe2, 0x8b, 0x48, 0x11, 0x99, 0x84, 0x46, 0x61, 0x44, 0x58,
+    0x03, 0x51, 0x08, 0x9a, 0xfa, 0xf7, 0x5a, 0x1a, 0x00, 0x51, 0x9f, 0xe2,
+    0x12, 0x9b, 0x13, 0x90, 0x04, 0x00, 0x0a, 0x15, 0xd1, 0x00, 0xda, 0x72,
+    0xe1, 0x02, 0x9a, 0x0e, 0x2a, 0x00, 0xdd, 0x6e, 0xe1, 0x78, 0x6e, 0x11,
+    0x90, 0x5c, 0x68, 0x1b, 0x68, 0x0a, 0x93, 0x0b, 0x94, 0x23, 0x1e, 0x00,
+    0x22, 0xdb, 0xf7, 0xca, 0x00, 0xf0, 0x04, 0xdd, 0xf3, 0xe0, 0x00, 0xd0,
+    0x82, 0xe2, 0x0a, 0x98, 0x0b, 0x99, 0x00, 0x22, 0x74, 0x4b, 0xfa, 0xf7,
+    0xe9, 0xf8, 0x0c, 0x70, 0x80, 0xfa, 0xf7, 0x3e, 0xf9, 0x07, 0x9e, 0x35,
+    0x00, 0x58, 0x00, 0xe2, 0x59, 0xe2, 0x06, 0x9b, 0x06, 0x9a, 0x01, 0x33,
+    0x08, 0x93, 0x31, 0x23, 0x13, 0x70, 0x0a, 0x2b, 0x80, 0x54, 0xe2, 0x34,
+    0x42, 0x07, 0xd0, 0x10, 0x9b, 0xea, 0x00, 0x00, 0x28, 0x10, 0x60, 0xfa,
+    0xf7, 0xcd, 0xf8, 0x33, 0x00, 0x28, 0x10, 0xf1, 0x00, 0x5a, 0xe7, 0x02,
+    0x9e, 0x07, 0x9b, 0x80, 0xe7, 0x14, 0x9b, 0x0f, 0x99, 0x5a, 0x1e, 0x59,
+    0x7a, 0x00, 0x00, 0x70, 0x01, 0xb3, 0x00, 0x29, 0x51, 0xd0, 0x00, 0x20,
+    0x5d, 0x49, 0xfa, 0xf7, 0x9a, 0x62, 0x00, 0xc0, 0x84, 0xf8, 0x06, 0x9a,
+    0x06, 0x9b, 0x94, 0x46, 0x17, 0x93, 0x14, 0x9b, 0x10, 0x01, 0x40, 0x63,
+    0x44, 0x19, 0x93, 0xe2, 0x3a, 0x91, 0xfa, 0xf7, 0x38, 0xf9, 0x14, 0x90,
+    0xfa, 0xf7, 0x1d, 0x6a, 0x6f, 0x02, 0x26, 0x04, 0x51, 0x6e, 0xf8, 0x17,
+    0x9b, 0x17, 0x84, 0x00, 0x80, 0x14, 0x9b, 0x04, 0x00, 0x30, 0x33, 0x13,
+    0x70, 0x3e, 0x01, 0x00, 0x16, 0x01, 0x61, 0xdc, 0xf8, 0x00, 0x28, 0x75,
+    0xd1, 0x60, 0x21, 0x70, 0x20, 0x40, 0x49, 0xfa, 0xf7, 0x59, 0xf8, 0x1a,
+    0x00, 0x40, 0xfa, 0xf7, 0xd0, 0xf8, 0xbc, 0x00, 0xf0, 0x03, 0xd2, 0xe0,
+    0x19, 0x9b, 0x08, 0x9a, 0x93, 0x42, 0x00, 0xd1, 0x70, 0xe7, 0x10, 0x98,
+    0x11, 0x99, 0x00, 0x22, 0xc0, 0x0b, 0x40, 0x77, 0xf8, 0x36, 0x4b, 0x72,
+    0x00, 0x02, 0x68, 0x01, 0x51, 0xfa, 0xf7, 0x6f, 0xf8, 0x08, 0x64, 0x01,
+    0x40, 0x17, 0x93, 0xbe, 0xe7, 0xcc, 0x02, 0x33, 0xfa, 0xf7, 0x66, 0x9c,
+    0x00, 0x00, 0x70, 0x00, 0x0a, 0x9c, 0x00, 0x75, 0xea, 0xf8, 0x17, 0x90,
+    0xfa, 0xf7, 0xcf, 0xcc, 0x6e, 0x80, 0xfa, 0xf7, 0x20, 0xf8, 0x17, 0x9b,
+    0x08, 0x9a, 0x94, 0x00, 0x60, 0x13, 0x00, 0x19, 0x9a, 0x01, 0x33, 0x4a,
+    0x00, 0x60, 0x08, 0x93, 0x93, 0x42, 0x2c, 0xd1, 0x72, 0x00, 0x31, 0x06,
+    0x9a, 0x14, 0xde, 0x01, 0x97, 0x00, 0x22, 0x08, 0x93, 0x1e, 0x4b, 0xfa,
+    0xf7, 0x12, 0x3a, 0x00, 0x11, 0x94, 0xa4, 0x00, 0x20, 0x80, 0xe0, 0xb2,
+    0x00, 0x71, 0x00, 0x20, 0x16, 0x49, 0xf9, 0xf7, 0xfa, 0x80, 0x0c, 0x04,
+    0x96, 0x00, 0x00, 0x72, 0x02, 0xf0, 0x0f, 0x14, 0xe7, 0x08, 0x9b, 0x1a,
+    0x00, 0x01, 0x3a, 0x08, 0x92, 0x12, 0x78, 0x30, 0x2a, 0xf8, 0xd0, 0x08,
+    0x93, 0x02, 0x96, 0x55, 0xe0, 0x00, 0x22, 0x06, 0x4b, 0xfa, 0xf7, 0x13,
+    0xf8, 0x6c, 0x00, 0x46, 0xb2, 0xe7, 0xc0, 0x46, 0xe4, 0x11, 0x00, 0xe0,
+    0x0b, 0xd0, 0x24, 0x40, 0x00, 0x00, 0x1c, 0x40, 0x00, 0x00, 0xc0, 0xfc,
+    0x00, 0x00, 0x14, 0x08, 0x00, 0x10, 0x7c, 0xe0, 0x0b, 0xa0, 0x07, 0x9b,
+    0x06, 0x9e, 0x01, 0x3b, 0x9b, 0x19, 0x0c, 0x93, 0x98, 0x02, 0x40, 0x0a,
+    0x9a, 0x0b, 0x9b, 0x68, 0x00, 0xe0, 0xf9, 0xf7, 0xd2, 0xff, 0xfa, 0xf7,
+    0x7f, 0xf8, 0x07, 0x90, 0xfa, 0xf7, 0x64, 0xf8, 0x16, 0x00, 0x35, 0xf9,
+    0xf7, 0xe7, 0x86, 0x00, 0xf0, 0x07, 0xf9, 0xf7, 0xb1, 0xff, 0x33, 0x00,
+    0x07, 0x9a, 0x01, 0x36, 0x30, 0x32, 0x1a, 0x70, 0x0c, 0x9a, 0x08, 0x96,
+    0x9a, 0x42, 0x39, 0xd1, 0x1e, 0x00, 0x40, 0xf9, 0xf7, 0xad, 0xff, 0x2e,
+    0x00, 0x02, 0x9c, 0x02, 0x64, 0x2f, 0xf8, 0x00, 0x28, 0x1b, 0xd1, 0x54,
+    0x00, 0xf0, 0x15, 0xfa, 0xf7, 0x09, 0xf8, 0x00, 0x28, 0x02, 0xd0, 0x07,
+    0x9b, 0xdb, 0x07, 0x10, 0xd4, 0x38, 0x00, 0x05, 0x99, 0x01, 0xf0, 0x7a,
+    0xfa, 0x00, 0x23, 0x08, 0x9a, 0x02, 0x98, 0x13, 0x70, 0x24, 0x9b, 0x01,
+    0x30, 0x18, 0x60, 0x7e, 0x06, 0xb0, 0x00, 0xd1, 0xa5, 0xe4, 0x1a, 0x60,
+    0xa3, 0xe4, 0x02, 0x9e, 0x08, 0xee, 0x16, 0xf0, 0x16, 0x3b, 0x1a, 0x78,
+    0x39, 0x2a, 0x06, 0xd1, 0x06, 0x9a, 0x9a, 0x42, 0xf7, 0xd1, 0x30, 0x22,
+    0x06, 0x99, 0x01, 0x36, 0x0a, 0x70, 0x1a, 0x78, 0x01, 0x32, 0x1a, 0x70,
+    0x84, 0xe7, 0x00, 0x22, 0xaa, 0x4b, 0xf9, 0xf7, 0x9a, 0xff, 0xcc, 0x06,
+    0x00, 0x74, 0x00, 0xf0, 0x29, 0xf9, 0xf7, 0xd7, 0xff, 0x00, 0x28, 0x9b,
+    0xd0, 0xcf, 0xe7, 0x0f, 0x9d, 0x0e, 0x9e, 0x0a, 0x9c, 0x00, 0x2d, 0x12,
+    0xd0, 0x22, 0x9a, 0x01, 0x2a, 0x66, 0xdc, 0x18, 0x9a, 0x00, 0x2a, 0x5d,
+    0xd0, 0xa0, 0x4a, 0x9b, 0x18, 0x0a, 0x9a, 0x01, 0x21, 0xd2, 0x18, 0x0a,
+    0x92, 0x0d, 0x9a, 0x38, 0x00, 0xd3, 0x18, 0x0d, 0x93, 0x01, 0xf0, 0x33,
+    0xfb, 0xae, 0x1b, 0xd1, 0x0e, 0xdd, 0x0d, 0x9b, 0x00, 0x2b, 0x0b, 0xdd,
+    0x0d, 0x9a, 0x23, 0x00, 0x94, 0xbe, 0x11, 0x11, 0x0a, 0xb4, 0x11, 0x00,
+    0x2a, 0x00, 0x40, 0xd3, 0x1a, 0x0d, 0x93, 0x84, 0x18, 0x11, 0x1f, 0x48,
+    0x0f, 0x90, 0x54, 0xd0, 0x00, 0x2e, 0x11, 0xdd, 0x29, 0x00, 0x32, 0xf6,
+    0x4d, 0x81, 0xf0, 0xda, 0xfb, 0x05, 0x9a, 0x01, 0x00, 0x05, 0x0c, 0x00,
+    0x60, 0x24, 0xfb, 0x05, 0x99, 0x14, 0x90, 0x0a, 0x00, 0xc0, 0x0d, 0xfa,
+    0x14, 0x9b, 0x05, 0x93, 0x0e, 0x9b, 0x9a, 0x1b, 0xb3, 0x42, 0x46, 0x2c,
+    0x00, 0xee, 0x00, 0x60, 0xc5, 0xfb, 0x05, 0x90, 0x01, 0x21, 0x1e, 0x00,
+    0xd1, 0xfa, 0xfa, 0x15, 0x9b, 0x06, 0x00, 0x00, 0x2b, 0x31, 0xdd, 0x1a,
+    0x00, 0x01, 0x3a, 0x00, 0xa0, 0xb7, 0xfb, 0x22, 0x9b, 0x06, 0x00, 0x01,
+    0x2b, 0x2d, 0xdd, 0xb6, 0x18, 0xf0, 0x09, 0x33, 0x69, 0x03, 0x33, 0x9b,
+    0x00, 0xf3, 0x18, 0x58, 0x68, 0x01, 0xf0, 0x9c, 0xfa, 0x20, 0x23, 0x18,
+    0x1a, 0x39, 0xe0, 0x36, 0x23, 0x1a, 0x9a, 0xd4, 0x00, 0xf0, 0x23, 0x9b,
+    0x1a, 0x9d, 0xe7, 0x07, 0x9b, 0x5e, 0x1e, 0x0e, 0x9b, 0xb3, 0x42, 0x07,
+    0xdb, 0x9e, 0x1b, 0x07, 0x9b, 0x0a, 0x9c, 0x00, 0x2b, 0x93, 0xda, 0xe4,
+    0x1a, 0x00, 0x23, 0x90, 0xe7, 0x0e, 0x9b, 0x15, 0x9a, 0xf3, 0x1a, 0xd3,
+    0x18, 0x0e, 0x96, 0x15, 0x93, 0x00, 0x26, 0xf0, 0xe7, 0x0e, 0x9a, 0xc0,
+    0xe7, 0x52, 0x00, 0x51, 0x22, 0x9b, 0x01, 0x2b, 0x13, 0x94, 0x27, 0x00,
+    0x8c, 0x0e, 0xf0, 0x01, 0x0e, 0xd1, 0x09, 0x9b, 0x1b, 0x03, 0x0b, 0xd1,
+    0x5d, 0x4b, 0x09, 0x9a, 0x13, 0x42, 0x07, 0xd0, 0xde, 0x27, 0xe0, 0x0a,
+    0x93, 0x0d, 0x9b, 0x01, 0x33, 0x0d, 0x93, 0x01, 0x23, 0x0e, 0x93, 0x15,
+    0x9b, 0xf6, 0x1b, 0xf2, 0x11, 0xbb, 0xd1, 0x0d, 0x9b, 0x1f, 0x22, 0x18,
+    0x18, 0x03, 0x00, 0x13, 0x40, 0x10, 0x42, 0x46, 0xd0, 0x01, 0x32, 0xd2,
+    0x1a, 0x04, 0x2a, 0x3f, 0xdd, 0x1c, 0x22, 0xd3, 0x1a, 0x0a, 0x9a, 0xe4,
+    0x18, 0x46, 0x01, 0x00, 0x44, 0x01, 0x00, 0x96, 0x12, 0x30, 0x05, 0xdd,
+    0x1a, 0x1e, 0x51, 0x70, 0x99, 0x01, 0xf0, 0xad, 0xfb, 0x05, 0x90, 0x4c,
+    0x01, 0x40, 0x05, 0xdd, 0x31, 0x00, 0x14, 0x00, 0x60, 0x01, 0xf0, 0xa4,
+    0xfb, 0x06, 0x00, 0x42, 0x05, 0xf0, 0x03, 0x26, 0xd0, 0x31, 0x00, 0x05,
+    0x98, 0x01, 0xf0, 0x0a, 0xfc, 0x00, 0x28, 0x20, 0xda, 0x02, 0x9b, 0x0a,
+    0x22, 0xaa, 0x07, 0x10, 0x38, 0x94, 0x0a, 0x90, 0x99, 0x01, 0xf0, 0x97,
+    0xf9, 0x0f, 0x9b, 0x05, 0x90, 0x02, 0x02, 0x21, 0x66, 0xe1, 0xe8, 0x2a,
+    0x10, 0x22, 0x3c, 0x00, 0xf0, 0x0d, 0x8c, 0xf9, 0x0c, 0x9b, 0x05, 0x00,
+    0x00, 0x2b, 0x47, 0xdc, 0x22, 0x9b, 0x02, 0x2b, 0x0d, 0xdc, 0x43, 0xe0,
+    0x04, 0x2a, 0xc6, 0xd0, 0x13, 0x00, 0x1c, 0x33, 0xbc, 0xe7, 0xae, 0x04,
+    0x11, 0x35, 0x18, 0x00, 0x51, 0x32, 0xdd, 0x07, 0x9b, 0x0c, 0x26, 0x13,
+    0x51, 0x0c, 0xd1, 0x31, 0x00, 0x05, 0x3a, 0x00, 0x51, 0x6f, 0xf9, 0x06,
+    0x00, 0x01, 0x70, 0x00, 0x10, 0xd2, 0x4a, 0x17, 0xf1, 0x00, 0xdd, 0xa5,
+    0xe5, 0x23, 0x9b, 0xdb, 0x43, 0x02, 0x93, 0x06, 0x9b, 0x08, 0x93, 0x00,
+    0x24, 0xb4, 0x4f, 0xe1, 0xf0, 0x39, 0xf9, 0x00, 0x2d, 0x00, 0xd1, 0xb7,
+    0xe6, 0x00, 0x2c, 0x05, 0xd0, 0xac, 0x82, 0x4d, 0x00, 0x16, 0x00, 0x31,
+    0x2e, 0xf9, 0x29, 0x08, 0x00, 0xf0, 0x03, 0x2a, 0xf9, 0xaa, 0xe6, 0x00,
+    0x26, 0x35, 0x00, 0xe2, 0xe7, 0x02, 0x96, 0x14, 0x9e, 0x35, 0x00, 0x84,
+    0xe5, 0x00, 0x02, 0x40, 0x00, 0xd1, 0xce, 0xe0, 0x6e, 0x00, 0x71, 0x00,
+    0x2c, 0x05, 0xdd, 0x29, 0x00, 0x22, 0x2a, 0x00, 0x00, 0x44, 0x02, 0x40,
+    0x0e, 0x9b, 0x28, 0x00, 0xe0, 0x32, 0xf0, 0x07, 0x38, 0x00, 0x69, 0x68,
+    0x01, 0xf0, 0xc8, 0xf8, 0x04, 0x1e, 0x0f, 0xd1, 0x02, 0x00, 0x05, 0x4b,
+    0x05, 0x49, 0xff, 0xf7, 0x05, 0xfb, 0x70, 0x0f, 0x24, 0x24, 0x40, 0x9c,
+    0x18, 0x00, 0x90, 0x06, 0x75, 0xea, 0x02, 0x00, 0x00, 0x29, 0x00, 0x2b,
+    0xb4, 0x14, 0x10, 0xfa, 0x84, 0x3e, 0x12, 0x22, 0x82, 0x00, 0xf0, 0x0b,
+    0x0b, 0xfb, 0x06, 0x9b, 0x0c, 0x9a, 0x0a, 0x93, 0x01, 0x3b, 0x9b, 0x18,
+    0x01, 0x22, 0x2c, 0x00, 0x05, 0x00, 0x14, 0x93, 0x08, 0x9b, 0x13, 0x40,
+    0x0f, 0x93, 0x42, 0x01, 0x50, 0xff, 0xf7, 0x3d, 0xfa, 0x03, 0x1e, 0x70,
+    0xf2, 0x00, 0x33, 0x0d, 0x90, 0x05, 0x98, 0x07, 0x93, 0x01, 0xf0, 0x61,
+    0xfb, 0x2a, 0x00, 0x0e, 0x90, 0xd4, 0x00, 0xc0, 0x76, 0xfb, 0xc3, 0x68,
+    0x08, 0x90, 0x10, 0x93, 0x01, 0x23, 0x0c, 0x93, 0x7e, 0x12, 0x22, 0x04,
+    0xd1, 0x06, 0x01, 0x40, 0x4f, 0xfb, 0x0c, 0x90, 0x40, 0x28, 0x71, 0x01,
+    0xf0, 0xbe, 0xf8, 0x0a, 0x9b, 0x0c, 0x3a, 0x05, 0xf0, 0x01, 0x22, 0x9b,
+    0x13, 0x43, 0x0f, 0x9a, 0x13, 0x43, 0x0c, 0xd1, 0x07, 0x9b, 0x39, 0x2b,
+    0x26, 0xd0, 0xe6, 0x02, 0xf0, 0x01, 0x02, 0xdd, 0x0d, 0x9b, 0x31, 0x33,
+    0x07, 0x93, 0x0a, 0x9b, 0x07, 0x9a, 0x1a, 0x70, 0x6a, 0xe7, 0x14, 0x00,
+    0x42, 0x04, 0xdb, 0x22, 0x9a, 0x2a, 0x00, 0x11, 0x1f, 0x74, 0x11, 0x51,
+    0xf0, 0xdd, 0x05, 0x99, 0x01, 0x66, 0x01, 0x30, 0xb6, 0xfa, 0x31, 0x68,
+    0x0e, 0x90, 0xf0, 0x20, 0xfb, 0x00, 0x28, 0x03, 0xdc, 0xe4, 0xd1, 0xe0,
+    0x03, 0x20, 0xe1, 0xd5, 0x4e, 0x00, 0x86, 0xdb, 0xd1, 0x39, 0x23, 0x0a,
+    0x9a, 0x13, 0x70, 0xc8, 0x03, 0x60, 0x68, 0xd0, 0x01, 0x32, 0xd5, 0xe7,
+    0x40, 0x00, 0x20, 0x07, 0xdd, 0x22, 0x00, 0xb0, 0xee, 0xd0, 0x07, 0x9b,
+    0x0a, 0x9a, 0x01, 0x33, 0x13, 0x70, 0x37, 0xf2, 0x15, 0x50, 0x9a, 0x1a,
+    0x70, 0x14, 0x9b, 0x40, 0x18, 0x81, 0x3e, 0xd0, 0x00, 0x23, 0x0a, 0x22,
+    0x05, 0x99, 0x00, 0x02, 0x61, 0xf8, 0x00, 0x23, 0x05, 0x90, 0x0a, 0x18,
+    0x01, 0x90, 0xac, 0x42, 0x06, 0xd1, 0x01, 0xf0, 0x83, 0xf8, 0x04, 0x30,
+    0x79, 0x90, 0x9b, 0x0a, 0x93, 0x78, 0xe7, 0x01, 0xf0, 0x7c, 0xf8, 0x32,
+    0x70, 0x00, 0x30, 0x00, 0x00, 0x2e, 0x00, 0x61, 0x75, 0xf8, 0x05, 0x00,
+    0xf1, 0xe7, 0x9e, 0x01, 0x12, 0x24, 0x2a, 0x01, 0xf2, 0x03, 0xa8, 0xf9,
+    0x06, 0x9b, 0x30, 0x30, 0x18, 0x55, 0x0c, 0x9b, 0x01, 0x34, 0x07, 0x90,
+    0xa3, 0x42, 0x07, 0xdd, 0x2c, 0x00, 0x00, 0x72, 0x02, 0x71, 0x5e, 0xf8,
+    0x05, 0x90, 0xeb, 0xe7, 0x0c, 0xee, 0x02, 0xc4, 0x00, 0xdd, 0x18, 0x00,
+    0x00, 0x24, 0x06, 0x9b, 0x1b, 0x18, 0x08, 0x93, 0xdc, 0x00, 0x13, 0x48,
+    0xdc, 0x00, 0x71, 0xb2, 0xfa, 0x00, 0x28, 0x9b, 0xdc, 0x02, 0xdc, 0x00,
+    0x24, 0x97, 0xd4, 0xd0, 0x00, 0x60, 0x30, 0x2a, 0xfa, 0xd0, 0xdb, 0xe6,
+    0x9a, 0x04, 0x10, 0x8e, 0x78, 0x0e, 0xe0, 0x33, 0x02, 0x93, 0x31, 0x23,
+    0x99, 0xe7, 0x09, 0x4b, 0x26, 0x9a, 0x06, 0x93, 0x08, 0xf6, 0x6a, 0x50,
+    0xd0, 0xff, 0xf7, 0x3e, 0xfa, 0x04, 0x00, 0x00, 0xf2, 0x00, 0x11, 0xb6,
+    0xa8, 0x02, 0x40, 0x00, 0xdd, 0xac, 0xe6, 0x7c, 0x11, 0x62, 0x29, 0x03,
+    0x01, 0x10, 0x31, 0x03, 0x08, 0x5b, 0x60, 0x0c, 0x1e, 0x02, 0xd1, 0x00,
+    0x26, 0x08, 0x4e, 0x06, 0x34, 0x0e, 0x9f, 0xfc, 0xf7, 0x1e, 0xfd, 0x31,
+    0x4b, 0x9c, 0x42, 0x19, 0x10, 0x21, 0x00, 0xf2, 0x09, 0x02, 0xf0, 0x79,
+    0xfc, 0x0c, 0x22, 0xa3, 0x5e, 0x00, 0x2b, 0x14, 0xd1, 0xa2, 0x6e, 0x01,
+    0x33, 0x16, 0x00, 0x1e, 0x40, 0x1a, 0x42, 0xdd, 0xd1, 0x1c, 0x00, 0x53,
+    0x6f, 0xfc, 0xd9, 0xe7, 0x24, 0xe8, 0x20, 0xa0, 0xe1, 0xe7, 0x22, 0x4b,
+    0x9c, 0x42, 0xde, 0xd1, 0xec, 0x68, 0x52, 0x0f, 0x00, 0xba, 0x4f, 0x40,
+    0x47, 0xf8, 0x23, 0x6b, 0x7a, 0x04, 0x10, 0x06, 0x74, 0x12, 0x10, 0x6a,
+    0xca, 0x23, 0xf1, 0x12, 0x01, 0xda, 0x01, 0x26, 0x76, 0x42, 0xa3, 0x89,
+    0x1b, 0x06, 0x03, 0xd5, 0x28, 0x00, 0x21, 0x69, 0x00, 0xf0, 0x71, 0xf9,
+    0x61, 0x6b, 0x00, 0x29, 0x08, 0xd0, 0x23, 0x00, 0x44, 0x33, 0x99, 0x42,
+    0x02, 0xf2, 0x4f, 0x80, 0x67, 0xf9, 0x00, 0x23, 0x63, 0x63, 0xa1, 0x6c,
+    0x14, 0x34, 0x01, 0x02, 0x50, 0x00, 0xd8, 0x50, 0xf0, 0x04, 0x64, 0xfc,
+    0xf7, 0xab, 0xfc, 0x00, 0x23, 0x25, 0x00, 0xa3, 0x81, 0xa3, 0x6e, 0x58,
+    0x35, 0xdb, 0x07, 0x02, 0xd4, 0x30, 0x6f, 0x20, 0x2e, 0xfc, 0x06, 0x00,
+    0xa0, 0x26, 0xfc, 0xfc, 0xf7, 0xa4, 0xfc, 0x93, 0xe7, 0xc0, 0x46, 0x5c,
+    0x21, 0x08, 0x58, 0x21, 0x31, 0xf7, 0xf7, 0x0e, 0xf6, 0x1f, 0x00, 0xce,
+    0x36, 0x60, 0xf7, 0xb5, 0x0c, 0x23, 0xca, 0x5e, 0x00, 0x7b, 0xf0, 0x07,
+    0x91, 0xb2, 0x13, 0x07, 0x67, 0xd4, 0x80, 0x23, 0x1b, 0x01, 0x13, 0x43,
+    0x62, 0x68, 0xa3, 0x81, 0x00, 0x2a, 0x04, 0xdc, 0x22, 0x6c, 0xb6, 0x5f,
+    0x00, 0xb8, 0x4f, 0xf0, 0x17, 0xe7, 0x6a, 0x00, 0x2f, 0xfa, 0xd0, 0x00,
+    0x22, 0x80, 0x21, 0x2e, 0x68, 0x2a, 0x60, 0x1a, 0x00, 0x49, 0x01, 0x0a,
+    0x40, 0x0b, 0x42, 0x38, 0xd0, 0x60, 0x6d, 0xa3, 0x89, 0x5b, 0x07, 0x06,
+    0xd5, 0x63, 0x68, 0xc0, 0x1a, 0x63, 0x6b, 0x8c, 0x18, 0x80, 0x23, 0x6c,
+    0xc0, 0x1a, 0x02, 0x00, 0x21, 0x6a, 0x0e, 0x52, 0xf2, 0x20, 0xe7, 0x6a,
+    0xb8, 0x47, 0xa1, 0x89, 0x43, 0x1c, 0x06, 0xd1, 0x2b, 0x68, 0x1d, 0x2b,
+    0x35, 0xd8, 0x2e, 0x4a, 0xda, 0x40, 0xd3, 0x07, 0x31, 0xd5, 0x00, 0x22,
+    0x2c, 0x4b, 0x62, 0x60, 0x0b, 0x40, 0x22, 0x69, 0x1b, 0xb2, 0xa3, 0x81,
+    0x22, 0x60, 0xdb, 0x04, 0x05, 0xd5, 0x43, 0x1c, 0x02, 0xea, 0x0e, 0xa9,
+    0xd1, 0x60, 0x65, 0x61, 0x6b, 0x2e, 0x60, 0x00, 0x29, 0xc2, 0x02, 0x01,
+    0x90, 0xe6, 0xf8, 0x00, 0x20, 0x60, 0x63, 0xb9, 0xe7, 0x01, 0x06, 0x4e,
+    0x61, 0x6a, 0xb8, 0x47, 0x43, 0x1c, 0xc1, 0x30, 0x00, 0xf0, 0x03, 0xbe,
+    0xd0, 0x1d, 0x2b, 0x01, 0xd0, 0x16, 0x2b, 0x01, 0xd1, 0x2e, 0x60, 0xa9,
+    0xe7, 0x40, 0x23, 0xa2, 0x89, 0xa2, 0x1f, 0xf0, 0x05, 0xa5, 0xe7, 0x40,
+    0x23, 0x0b, 0x43, 0xfa, 0xe7, 0x27, 0x69, 0x00, 0x2f, 0x9e, 0xd0, 0x23,
+    0x68, 0x27, 0x60, 0xdb, 0x1b, 0x60, 0x47, 0x71, 0x8a, 0x07, 0x00, 0xd1,
+    0x63, 0x69, 0xa3, 0x3c, 0x47, 0x40, 0x00, 0xdc, 0x91, 0xe7, 0x42, 0x50,
+    0x70, 0x01, 0x9b, 0x21, 0x6a, 0xa6, 0x6a, 0xb0, 0xf4, 0x73, 0x90, 0xdc,
+    0x40, 0x23, 0x01, 0x20, 0xa2, 0x89, 0x40, 0x42, 0x44, 0x00, 0xf1, 0x00,
+    0x83, 0xe7, 0x01, 0x9b, 0x3f, 0x18, 0x1b, 0x1a, 0x01, 0x93, 0xe7, 0xe7,
+    0x01, 0x00, 0x40, 0xe4, 0x3b, 0x22, 0x0b, 0x69, 0xee, 0x5c, 0x00, 0x36,
+    0x23, 0x02, 0xcc, 0x39, 0x08, 0x34, 0x02, 0xa2, 0x04, 0xfc, 0x15, 0x4b,
+    0x9c, 0x42, 0x1d, 0xd1, 0x6c, 0x68, 0x20, 0x02, 0x86, 0xed, 0xd0, 0xa2,
+    0x6e, 0xd2, 0x07, 0x05, 0xd4, 0x3a, 0x02, 0x22, 0x5c, 0xfb, 0x1a, 0x77,
+    0x91, 0x43, 0xff, 0xa3, 0x6e, 0x05, 0x00, 0xdb, 0x07, 0xdd, 0x58, 0x02,
+    0x13, 0xda, 0x1e, 0x00, 0x31, 0x51, 0xfb, 0xd5, 0x1a, 0x23, 0x00, 0x3c,
+    0x02, 0xbe, 0xdd, 0xe7, 0x04, 0x4b, 0x9c, 0x42, 0xda, 0xd1, 0xec, 0x68,
+    0xd8, 0xc4, 0x01, 0xf0, 0x04, 0x1e, 0x05, 0xd1, 0x06, 0x4b, 0x06, 0x49,
+    0x18, 0x68, 0xfc, 0xf7, 0x7f, 0xfc, 0x10, 0xbd, 0xf7, 0xf7, 0x25, 0xfa,
+    0x56, 0x00, 0x20, 0xb0, 0xff, 0x98, 0x20, 0x00, 0x80, 0x37, 0xf0, 0x1b,
+    0x9d, 0xd3, 0x00, 0x10, 0xf8, 0xb5, 0x0c, 0x00, 0x06, 0x00, 0xfc, 0xf7,
+    0xaf, 0xfe, 0x20, 0x4f, 0xbb, 0x68, 0x5d, 0x68, 0x03, 0x23, 0x9d, 0x43,
+    0x1e, 0x4b, 0x2c, 0x1b, 0xe4, 0x18, 0x24, 0x0b, 0x01, 0x3c, 0x11, 0x33,
+    0x24, 0x03, 0x9c, 0x42, 0x04, 0xda, 0x9e, 0x4b, 0xf2, 0x13, 0xa6, 0xfe,
+    0x00, 0x20, 0xf8, 0xbd, 0x00, 0x21, 0x30, 0x00, 0xfd, 0xf7, 0x4a, 0xfe,
+    0xbb, 0x68, 0x5b, 0x19, 0x98, 0x42, 0xf2, 0xd1, 0x30, 0x00, 0x61, 0x42,
+    0xfd, 0xf7, 0x42, 0xfe, 0x43, 0x1c, 0x10, 0xd1, 0x1c, 0x00, 0xf0, 0x07,
+    0x3c, 0xfe, 0xba, 0x68, 0x81, 0x1a, 0x0f, 0x29, 0xe4, 0xdd, 0x0d, 0x4b,
+    0x1b, 0x68, 0xc0, 0x1a, 0x0d, 0x4b, 0x18, 0x60, 0x01, 0x23, 0xb6, 0x34,
+    0xf0, 0x0e, 0xdb, 0xe7, 0xbb, 0x68, 0x01, 0x27, 0x2d, 0x1b, 0x3d, 0x43,
+    0x5d, 0x60, 0x07, 0x4b, 0x30, 0x00, 0x1a, 0x68, 0x14, 0x1b, 0x1c, 0x60,
+    0xfc, 0xf7, 0x79, 0xfe, 0x38, 0x00, 0xd1, 0x94, 0x00, 0x70, 0x06, 0x00,
+    0x20, 0xef, 0x0f, 0x00, 0x00, 0x38, 0x33, 0x20, 0xf0, 0x0d, 0x54, 0x51,
+    0x91, 0x0d, 0x1e, 0x01, 0x90, 0x2d, 0xd0, 0xfc, 0xf7, 0x60, 0x7c, 0x5c,
+    0xf0, 0x13, 0x9c, 0x46, 0x08, 0x39, 0x4f, 0x68, 0x62, 0x46, 0x3b, 0x00,
+    0x66, 0x46, 0x93, 0x43, 0xc8, 0x18, 0x45, 0x68, 0x02, 0x32, 0x95, 0x43,
+    0x4a, 0x4a, 0x37, 0x40, 0x96, 0x68, 0x86, 0x42, 0x1a, 0xd1, 0x5b, 0x19,
+    0x16, 0x70, 0xf0, 0x0b, 0x08, 0x68, 0x09, 0x1a, 0x8d, 0x68, 0x1b, 0x18,
+    0xc8, 0x68, 0xe8, 0x60, 0x85, 0x60, 0x01, 0x20, 0x18, 0x43, 0x48, 0x60,
+    0x91, 0x60, 0x41, 0x4a, 0x12, 0x68, 0x3e, 0x32, 0xf0, 0x39, 0x40, 0x4b,
+    0x01, 0x98, 0x19, 0x68, 0xff, 0xf7, 0x83, 0xff, 0x01, 0x98, 0xfc, 0xf7,
+    0x3c, 0xfe, 0xf7, 0xbd, 0x00, 0x26, 0x45, 0x60, 0xb7, 0x42, 0x09, 0xd1,
+    0x0f, 0x68, 0x3a, 0x4c, 0xc9, 0x1b, 0xdb, 0x19, 0x8f, 0x68, 0xa7, 0x42,
+    0x2c, 0xd0, 0xcc, 0x68, 0xfc, 0x60, 0xa7, 0x60, 0x47, 0x19, 0x7c, 0x68,
+    0x01, 0x27, 0x3c, 0x42, 0x0b, 0xd1, 0x5b, 0x19, 0x85, 0x68, 0x00, 0x2e,
+    0x22, 0xd1, 0x31, 0x4c, 0xa5, 0x42, 0x1f, 0xd1, 0x3e, 0x00, 0xc0, 0x36,
+    0x80, 0xcd, 0x60, 0x8d, 0x60, 0x01, 0x25, 0x28, 0x00, 0x62, 0x00, 0xf0,
+    0x09, 0xcb, 0x50, 0x00, 0x2e, 0xd5, 0xd1, 0x80, 0x20, 0x80, 0x00, 0x83,
+    0x42, 0x13, 0xd2, 0xd8, 0x08, 0x5b, 0x09, 0x9d, 0x40, 0x53, 0x68, 0xc0,
+    0x00, 0xe8, 0x35, 0xf1, 0x04, 0x82, 0x18, 0x93, 0x68, 0xca, 0x60, 0x8b,
+    0x60, 0x91, 0x60, 0xd9, 0x60, 0xc3, 0xe7, 0x66, 0x46, 0xd3, 0xe7, 0xc0,
+    0x9c, 0x00, 0xf1, 0x06, 0xe0, 0xe7, 0x5d, 0x0a, 0x04, 0x2d, 0x12, 0xd8,
+    0x98, 0x09, 0x38, 0x30, 0xc6, 0x00, 0xb6, 0x18, 0xb5, 0x68, 0x03, 0x27,
+    0xae, 0xea, 0x35, 0x60, 0x80, 0x10, 0x83, 0x40, 0x50, 0x68, 0x02, 0x37,
+    0xf0, 0x12, 0xce, 0x60, 0x8d, 0x60, 0xb1, 0x60, 0xe9, 0x60, 0xa7, 0xe7,
+    0x14, 0x2d, 0x02, 0xd8, 0x28, 0x00, 0x5b, 0x30, 0xe9, 0xe7, 0x54, 0x2d,
+    0x02, 0xd8, 0x18, 0x0b, 0x6e, 0x30, 0xe4, 0xe7, 0xaa, 0x20, 0x40, 0xe0,
+    0x7e, 0xf1, 0x0f, 0xd8, 0xd8, 0x0b, 0x77, 0x30, 0xdd, 0xe7, 0x0b, 0x4e,
+    0x7e, 0x20, 0xb5, 0x42, 0xd9, 0xd8, 0x98, 0x0c, 0x7c, 0x30, 0xd6, 0xe7,
+    0xad, 0x68, 0xae, 0x42, 0x03, 0xd0, 0x6a, 0x68, 0xba, 0xea, 0x35, 0x31,
+    0xee, 0x68, 0xd9, 0x78, 0x35, 0x13, 0x94, 0x94, 0x34, 0x04, 0x80, 0x35,
+    0x60, 0xf0, 0xb5, 0x93, 0x68, 0x87, 0xb0, 0xd8, 0x45, 0x10, 0x03, 0x90,
+    0x10, 0x12, 0xd1, 0xf0, 0x13, 0xf2, 0x05, 0x8b, 0x89, 0x1b, 0x07, 0x59,
+    0xd5, 0x0b, 0x69, 0x00, 0x2b, 0x56, 0xd0, 0x3b, 0x68, 0x02, 0x22, 0x02,
+    0x93, 0xa3, 0x89, 0xd6, 0x4e, 0xf0, 0x05, 0x75, 0xd1, 0x01, 0x22, 0x01,
+    0x21, 0x1a, 0x40, 0x0b, 0x42, 0x00, 0xd1, 0xad, 0xe0, 0x06, 0x00, 0x01,
+    0x90, 0x04, 0x90, 0x0a, 0x70, 0xf0, 0x05, 0x00, 0xd1, 0x16, 0xe1, 0x00,
+    0x28, 0x0c, 0xd1, 0x1a, 0x00, 0x0a, 0x21, 0x30, 0x00, 0x02, 0xf0, 0xd3,
+    0xfa, 0x04, 0x9b, 0xe4, 0x11, 0x00, 0x4e, 0x0a, 0xf0, 0x2b, 0x01, 0x30,
+    0x83, 0x1b, 0x01, 0x93, 0x01, 0x9b, 0x04, 0x9a, 0x05, 0x93, 0x93, 0x42,
+    0x00, 0xd9, 0x05, 0x92, 0x20, 0x68, 0x22, 0x69, 0x63, 0x69, 0x90, 0x42,
+    0x00, 0xd8, 0x04, 0xe1, 0xa2, 0x68, 0x9d, 0x18, 0x05, 0x9a, 0xaa, 0x42,
+    0x00, 0xdc, 0xfe, 0xe0, 0x31, 0x00, 0x2a, 0x00, 0x02, 0xf0, 0x05, 0xfb,
+    0x23, 0x68, 0x21, 0x00, 0x5b, 0x19, 0x03, 0x98, 0x0c, 0x40, 0xf0, 0x1f,
+    0x58, 0xfe, 0x00, 0x28, 0x73, 0xd1, 0x01, 0x9b, 0x01, 0x20, 0x5b, 0x1b,
+    0x01, 0x93, 0x05, 0xd1, 0x21, 0x00, 0x03, 0x98, 0xff, 0xf7, 0x4d, 0xfe,
+    0x00, 0x28, 0x68, 0xd1, 0x04, 0x9b, 0x76, 0x19, 0x5b, 0x1b, 0x04, 0x93,
+    0xbb, 0x68, 0x5d, 0x1b, 0xbd, 0x60, 0xba, 0xd1, 0x9f, 0xe7, 0x1e, 0x00,
+    0x71, 0x01, 0xf0, 0xf0, 0xff, 0x00, 0x28, 0xa2, 0x0a, 0x75, 0x40, 0x97,
+    0xe7, 0x02, 0x9b, 0x44, 0x3b, 0x60, 0x02, 0x9b, 0x5d, 0x68, 0x08, 0x33,
+    0xde, 0x26, 0x41, 0xf6, 0xd0, 0x72, 0x4a, 0xfc, 0x1b, 0x92, 0xd9, 0x13,
+    0x00, 0x01, 0x9a, 0x21, 0x6a, 0x03, 0x98, 0xd8, 0x03, 0xf1, 0x0c, 0x41,
+    0xdd, 0x01, 0x9b, 0x2d, 0x1a, 0x1b, 0x18, 0x01, 0x93, 0xbb, 0x68, 0x18,
+    0x1a, 0xb8, 0x60, 0xe9, 0xd1, 0x78, 0xe7, 0x00, 0x23, 0x1d, 0x00, 0x01,
+    0x93, 0xe4, 0x44, 0x00, 0x00, 0xa0, 0x4b, 0x11, 0x5b, 0x4a, 0x00, 0x00,
+    0x48, 0x00, 0x00, 0x1c, 0x04, 0xf0, 0x2a, 0xf3, 0xd0, 0x80, 0x23, 0xa2,
+    0x89, 0x9b, 0x00, 0x20, 0x68, 0xa5, 0x68, 0x1a, 0x42, 0x64, 0xd0, 0x01,
+    0x9b, 0x9d, 0x42, 0x38, 0xd8, 0x90, 0x23, 0xdb, 0x00, 0x1a, 0x42, 0x34,
+    0xd0, 0x21, 0x69, 0x43, 0x1a, 0x03, 0x20, 0x05, 0x93, 0x63, 0x69, 0x58,
+    0x43, 0x05, 0x9b, 0xc6, 0x0f, 0x36, 0x18, 0x01, 0x98, 0x01, 0x33, 0x1b,
+    0x18, 0x76, 0x10, 0xb3, 0xf8, 0x3f, 0xf4, 0x08, 0x00, 0x53, 0x05, 0x3c,
+    0xd5, 0x31, 0x00, 0x03, 0x98, 0xfc, 0xf7, 0xe1, 0xfa, 0x05, 0x1e, 0x0a,
+    0xd1, 0x0c, 0x23, 0x03, 0x9a, 0x13, 0x60, 0x9c, 0x04, 0xf0, 0x09, 0xa0,
+    0xe7, 0x04, 0x92, 0x01, 0x92, 0xcb, 0xe7, 0x05, 0x9a, 0x21, 0x69, 0xf9,
+    0xf7, 0x86, 0xfe, 0xa3, 0x89, 0x46, 0x4a, 0x1a, 0x40, 0x80, 0x23, 0x1c,
+    0x00, 0xf0, 0x29, 0x05, 0x9b, 0x25, 0x61, 0xed, 0x18, 0x25, 0x60, 0x66,
+    0x61, 0x01, 0x9d, 0xf6, 0x1a, 0xa6, 0x60, 0x01, 0x9e, 0xb5, 0x42, 0x00,
+    0xd9, 0x35, 0x00, 0x2a, 0x00, 0x04, 0x99, 0x20, 0x68, 0x02, 0xf0, 0x65,
+    0xfa, 0xa3, 0x68, 0x5b, 0x1b, 0xa3, 0x60, 0x23, 0x68, 0x5d, 0x19, 0x25,
+    0x60, 0x04, 0x9b, 0x9b, 0x19, 0x04, 0x93, 0x01, 0x9b, 0x9b, 0x1b, 0xda,
+    0x00, 0x91, 0x9e, 0x1b, 0xbe, 0x60, 0xa0, 0xd1, 0x0b, 0xe7, 0x32, 0x28,
+    0x01, 0x80, 0x12, 0xfd, 0x05, 0x1e, 0xd7, 0xd1, 0x21, 0x69, 0x52, 0x01,
+    0xf0, 0x0b, 0x48, 0xfe, 0x80, 0x22, 0xa3, 0x89, 0x93, 0x43, 0xa3, 0x81,
+    0xb9, 0xe7, 0x23, 0x69, 0x83, 0x42, 0x03, 0xd3, 0x66, 0x69, 0x01, 0x9b,
+    0x9e, 0x42, 0x17, 0xd9, 0xd8, 0x00, 0x31, 0x00, 0xd9, 0x1d, 0x60, 0x00,
+    0xf3, 0x06, 0x02, 0xf0, 0x36, 0xfa, 0xa3, 0x68, 0x22, 0x68, 0x5b, 0x1b,
+    0x52, 0x19, 0x2e, 0x00, 0xa3, 0x60, 0x22, 0x60, 0x00, 0x2b, 0xcd, 0x94,
+    0x01, 0xe0, 0x83, 0xfd, 0x00, 0x28, 0xc7, 0xd0, 0x9d, 0xe7, 0x01, 0x9a,
+    0x1c, 0x4b, 0x10, 0x00, 0xde, 0x40, 0xe0, 0x1b, 0x48, 0x31, 0x00, 0xf8,
+    0xf7, 0x01, 0xff, 0x33, 0x00, 0x04, 0x9a, 0x43, 0x43, 0x6c, 0x01, 0xf1,
+    0x02, 0xa5, 0x6a, 0xa8, 0x47, 0x06, 0x1e, 0xb4, 0xdc, 0x8a, 0xe7, 0x02,
+    0x9b, 0x00, 0x20, 0x1e, 0x68, 0x5b, 0x58, 0x01, 0x00, 0x52, 0x01, 0xc0,
+    0xdb, 0xe6, 0x05, 0x9a, 0x93, 0x42, 0x08, 0xdc, 0xa5, 0x6a, 0x32, 0x00,
+    0x2a, 0x00, 0xf0, 0x0b, 0xa8, 0x47, 0x05, 0x1e, 0x00, 0xdd, 0x02, 0xe7,
+    0x75, 0xe7, 0x05, 0x9a, 0x31, 0x00, 0x02, 0xf0, 0xfa, 0xf9, 0x05, 0x9a,
+    0xa3, 0x68, 0x15, 0x00, 0x9b, 0x1a, 0xda, 0x00, 0xf1, 0x00, 0x9b, 0x18,
+    0x23, 0x60, 0xf4, 0xe6, 0xc0, 0x46, 0x00, 0xfc, 0xff, 0x7f, 0x7f, 0xfb,
+    0xff, 0x43, 0x2a, 0x00, 0x38, 0x16, 0xf0, 0x2d, 0x02, 0x00, 0xf0, 0xb5,
+    0x04, 0x69, 0x14, 0x32, 0x13, 0x00, 0x85, 0xb0, 0x4f, 0x11, 0xbc, 0x42,
+    0x31, 0xdd, 0xbb, 0x00, 0xd3, 0x18, 0x1f, 0x26, 0x01, 0x93, 0x0b, 0x00,
+    0xa5, 0x00, 0x33, 0x40, 0x55, 0x19, 0x02, 0x93, 0x31, 0x42, 0x0c, 0xd1,
+    0x16, 0x00, 0x01, 0x99, 0x8d, 0x42, 0x38, 0xd8, 0x01, 0x99, 0x00, 0x23,
+    0x03, 0x39, 0x8d, 0x42, 0x01, 0xd3, 0xe3, 0x1b, 0x62, 0x14, 0xf1, 0x14,
+    0x19, 0xe0, 0x20, 0x21, 0x02, 0x9b, 0x01, 0x9e, 0xcb, 0x1a, 0x03, 0x93,
+    0x02, 0xce, 0x02, 0x9b, 0x94, 0x46, 0xd9, 0x40, 0x00, 0x91, 0xb5, 0x42,
+    0x16, 0xd8, 0x01, 0x9e, 0x00, 0x23, 0x01, 0x36, 0xb5, 0x42, 0x02, 0x2a,
+    0x00, 0x80, 0x04, 0x3b, 0x00, 0x99, 0xd3, 0x18, 0x19, 0x60, 0x62, 0x41,
+    0xf0, 0x01, 0x04, 0x33, 0x99, 0x1a, 0x89, 0x10, 0x01, 0x61, 0x93, 0x42,
+    0x01, 0xd1, 0x00, 0x23, 0x43, 0x61, 0xee, 0x3b, 0xf0, 0x01, 0x33, 0x68,
+    0x03, 0x99, 0x8b, 0x40, 0x00, 0x99, 0x19, 0x43, 0x63, 0x46, 0x02, 0xc3,
+    0x9c, 0x46, 0x4c, 0x00, 0x00, 0x4a, 0x00, 0xf0, 0x21, 0xd9, 0xe7, 0x08,
+    0xc9, 0x08, 0xc6, 0xc1, 0xe7, 0x02, 0x00, 0x30, 0x3a, 0x03, 0x00, 0x09,
+    0x2a, 0x02, 0xd8, 0x20, 0x3b, 0xd8, 0xb2, 0x70, 0x47, 0x02, 0x00, 0x61,
+    0x3a, 0x05, 0x2a, 0x01, 0xd8, 0x47, 0x3b, 0xf7, 0xe7, 0x1a, 0x00, 0x41,
+    0x3a, 0x00, 0x20, 0x05, 0x2a, 0xf3, 0xd8, 0x27, 0x3b, 0x54, 0x37, 0x51,
+    0x8d, 0xb0, 0x0a, 0x93, 0xbf, 0xee, 0x25, 0xf0, 0x0b, 0x09, 0x91, 0x18,
+    0x00, 0x02, 0x92, 0x07, 0x93, 0xfd, 0xf7, 0xdb, 0xfc, 0x02, 0x22, 0x07,
+    0x9b, 0x52, 0x42, 0x1b, 0x18, 0x01, 0x3b, 0x1b, 0x78, 0x03, 0x90, 0x50,
+    0x24, 0xf1, 0x18, 0x19, 0x68, 0x8b, 0x1c, 0x52, 0x1a, 0xd1, 0x18, 0x01,
+    0x93, 0x08, 0x91, 0x01, 0x99, 0x01, 0x33, 0x08, 0x78, 0x30, 0x28, 0xf7,
+    0xd0, 0xff, 0xf7, 0xc9, 0xff, 0x00, 0x23, 0x1c, 0x00, 0x04, 0x93, 0x98,
+    0x42, 0x1f, 0xd1, 0x03, 0x9a, 0x07, 0xfa, 0x2a, 0xf1, 0x2e, 0xc7, 0xfd,
+    0x07, 0x00, 0xa0, 0x42, 0x00, 0xd0, 0x6b, 0xe0, 0x01, 0x9b, 0x03, 0x9a,
+    0x98, 0x5c, 0x9d, 0x18, 0xff, 0xf7, 0xb5, 0xff, 0x01, 0x23, 0x04, 0x93,
+    0xa0, 0x42, 0x30, 0xd0, 0x01, 0x95, 0x01, 0x9b, 0x18, 0x78, 0x30, 0x28,
+    0x09, 0xd0, 0xff, 0xf7, 0xaa, 0xff, 0x42, 0x42, 0x42, 0x41, 0x01, 0x23,
+    0x2c, 0x00, 0x04, 0x92, 0x08, 0x93, 0x01, 0x9d, 0x04, 0xe0, 0x01, 0xda,
+    0x03, 0xf1, 0x01, 0xed, 0xe7, 0x01, 0x35, 0x28, 0x78, 0xff, 0xf7, 0x9a,
+    0xff, 0x07, 0x1e, 0xf9, 0xd1, 0x28, 0x00, 0x5a, 0x00, 0xf0, 0x02, 0xf0,
+    0x9b, 0xfd, 0x00, 0x28, 0x0e, 0xd1, 0x00, 0x2c, 0x07, 0xd1, 0x03, 0x9b,
+    0xed, 0x18, 0x2c, 0x00, 0x22, 0x00, 0x20, 0x89, 0xff, 0x10, 0x23, 0xa0,
+    0x64, 0x1b, 0xa7, 0x00, 0x03, 0xe0, 0x01, 0x35, 0xf5, 0xe7, 0xb0, 0x3d,
+    0x00, 0xb6, 0x18, 0xf0, 0x0b, 0x2e, 0x00, 0x93, 0x43, 0x50, 0x2b, 0x1d,
+    0xd1, 0x6b, 0x78, 0x2b, 0x2b, 0x2c, 0xd0, 0x2d, 0x2b, 0x2e, 0xd0, 0x00,
+    0x23, 0x6e, 0x1c, 0x06, 0x93, 0x30, 0x78, 0xfc, 0x17, 0xf1, 0x02, 0x43,
+    0x1e, 0xdb, 0xb2, 0x18, 0x2b, 0x2b, 0xd8, 0x10, 0x38, 0x04, 0x00, 0x70,
+    0x78, 0xff, 0xf7, 0x66, 0x12, 0x00, 0x70, 0x01, 0x36, 0x18, 0x2b, 0x1c,
+    0xd9, 0x06, 0x72, 0x04, 0x61, 0xd0, 0x64, 0x42, 0x3f, 0x19, 0x09, 0xdc,
+    0x75, 0x71, 0x00, 0x2b, 0x19, 0xd0, 0x00, 0x26, 0x08, 0x3c, 0x22, 0x40,
+    0x06, 0x36, 0x30, 0x00, 0xe4, 0x30, 0xa0, 0x01, 0x23, 0x00, 0x27, 0x01,
+    0x9d, 0x04, 0x93, 0xc9, 0xe7, 0x82, 0x21, 0xf0, 0x3d, 0xae, 0x1c, 0xd3,
+    0xe7, 0x01, 0x23, 0xfa, 0xe7, 0x0a, 0x23, 0x5c, 0x43, 0x24, 0x18, 0x10,
+    0x3c, 0xd5, 0xe7, 0x2e, 0x00, 0xe0, 0xe7, 0x01, 0x9b, 0x04, 0x99, 0xeb,
+    0x1a, 0x01, 0x3b, 0x07, 0x2b, 0x0a, 0xdc, 0x05, 0x98, 0x00, 0xf0, 0xc0,
+    0xfa, 0x04, 0x1e, 0x08, 0xd1, 0x02, 0x00, 0xde, 0x21, 0x64, 0x4b, 0x65,
+    0x48, 0xf8, 0xf7, 0x70, 0xfd, 0x01, 0x31, 0x5b, 0x10, 0xef, 0xe7, 0x03,
+    0x00, 0x14, 0x33, 0x04, 0x93, 0x09, 0x93, 0x00, 0x23, 0x1e, 0x00, 0x06,
+    0x93, 0x58, 0x62, 0xf0, 0x15, 0x40, 0xd3, 0x09, 0x9d, 0x04, 0x9b, 0x40,
+    0xc5, 0xed, 0x1a, 0xad, 0x10, 0x30, 0x00, 0x25, 0x61, 0x00, 0xf0, 0x9a,
+    0xfb, 0x02, 0x9b, 0x6d, 0x01, 0x1b, 0x68, 0x2e, 0x1a, 0x01, 0x93, 0x9e,
+    0x42, 0x5a, 0xdd, 0xf6, 0x1a, 0xba, 0x7d, 0xf0, 0x21, 0x00, 0xf0, 0x55,
+    0xff, 0x05, 0x1e, 0x16, 0xd0, 0x01, 0x25, 0x1f, 0x21, 0x28, 0x00, 0x73,
+    0x1e, 0x19, 0x40, 0x88, 0x40, 0x01, 0x00, 0x5a, 0x11, 0x04, 0x98, 0x92,
+    0x00, 0x12, 0x58, 0x0a, 0x42, 0x09, 0xd0, 0xab, 0x42, 0x06, 0xdd, 0x20,
+    0x00, 0xb1, 0x1e, 0x00, 0xf0, 0x40, 0xff, 0x02, 0x35, 0x3a, 0x10, 0x22,
+    0x02, 0x25, 0xf4, 0x7d, 0xf0, 0x01, 0x99, 0xfe, 0xbf, 0x19, 0x02, 0x9b,
+    0x9b, 0x68, 0x03, 0x93, 0xbb, 0x42, 0x42, 0xda, 0x21, 0x00, 0xa2, 0x00,
+    0xf0, 0x3a, 0xb3, 0xfa, 0x00, 0x23, 0x12, 0x9a, 0xa3, 0x26, 0x13, 0x60,
+    0x8b, 0xe7, 0x6b, 0x1e, 0x08, 0x93, 0x0b, 0x9a, 0x1b, 0x78, 0x93, 0x42,
+    0x14, 0xd0, 0x06, 0x9b, 0x20, 0x2b, 0x04, 0xd1, 0x09, 0x9b, 0x40, 0xc3,
+    0x00, 0x26, 0x09, 0x93, 0x06, 0x96, 0x08, 0x9b, 0x18, 0x78, 0xff, 0xf7,
+    0xcc, 0xfe, 0x0f, 0x23, 0x18, 0x40, 0x06, 0x9b, 0x08, 0x9d, 0x98, 0x40,
+    0x04, 0x33, 0x06, 0x43, 0x06, 0x93, 0xa0, 0xe7, 0x01, 0x23, 0x03, 0x9a,
+    0x9d, 0x1a, 0x08, 0x86, 0x3c, 0x70, 0x9b, 0x9d, 0x42, 0xe2, 0xd3, 0x28,
+    0x00, 0xb8, 0x01, 0x11, 0xbf, 0x24, 0x56, 0xf1, 0x00, 0x91, 0xe7, 0x01,
+    0x9b, 0x00, 0x25, 0x9e, 0x42, 0xc3, 0xda, 0x9e, 0x1b, 0x21, 0x00, 0x32,
+    0x72, 0x00, 0x21, 0x98, 0xfc, 0xfe, 0x00, 0xf0, 0x26, 0x00, 0xbf, 0x1b,
+    0x04, 0x93, 0xb7, 0xe7, 0x02, 0x9b, 0x5e, 0x68, 0xbe, 0x42, 0x72, 0xdd,
+    0x01, 0x9b, 0xf6, 0x1b, 0xb3, 0x42, 0x39, 0xdc, 0x02, 0x9b, 0xdb, 0x68,
+    0x02, 0x2b, 0x26, 0xd0, 0x03, 0x2b, 0x28, 0xd0, 0x01, 0x2b, 0x19, 0xd1,
+    0x01, 0x9b, 0xb3, 0x42, 0x16, 0xd1, 0x01, 0x2b, 0x0d, 0xd1, 0x02, 0x9b,
+    0x62, 0x26, 0x30, 0x05, 0xf2, 0x13, 0x01, 0x9a, 0x0a, 0x9b, 0x1a, 0x60,
+    0x01, 0x23, 0x04, 0x9a, 0x23, 0x61, 0x13, 0x60, 0x12, 0x9b, 0x1c, 0x60,
+    0x2e, 0xe7, 0x01, 0x99, 0x20, 0x00, 0x01, 0x39, 0x00, 0xf0, 0xc7, 0xfe,
+    0x00, 0x28, 0xea, 0xd1, 0xda, 0x00, 0x11, 0x46, 0xda, 0x00, 0x70, 0x50,
+    0x26, 0x13, 0x60, 0x1e, 0xe7, 0x13, 0x5e, 0x05, 0x21, 0xd1, 0xdd, 0x08,
+    0x00, 0x60, 0xda, 0xd1, 0xee, 0xe7, 0xc0, 0x46, 0x3c, 0x26, 0x00, 0x90,
+    0x0d, 0xf1, 0x00, 0x8d, 0x03, 0x01, 0x10, 0x77, 0x1e, 0x00, 0x2d, 0x2f,
+    0xd1, 0x00, 0x2f, 0x04, 0xd0, 0x39, 0x62, 0x01, 0xf0, 0x05, 0xa4, 0xfe,
+    0x05, 0x00, 0x1f, 0x23, 0x7a, 0x11, 0x1f, 0x40, 0x1e, 0x3b, 0xbb, 0x40,
+    0x04, 0x99, 0x92, 0x00, 0x52, 0x58, 0x2e, 0x64, 0xd1, 0x02, 0x23, 0x1d,
+    0x43, 0x01, 0x9b, 0x31, 0x00, 0x9b, 0x1b, 0x02, 0x26, 0x20, 0x58, 0x5c,
+    0xa2, 0xf0, 0xfd, 0x02, 0x9b, 0x5f, 0x68, 0x00, 0x2d, 0x41, 0xd0, 0xb8,
+    0x00, 0x22, 0x10, 0xd0, 0x44, 0x53, 0xf0, 0x0f, 0x06, 0xd1, 0xaa, 0x07,
+    0x04, 0xd5, 0x04, 0x9a, 0x10, 0x68, 0x05, 0x43, 0x1d, 0x42, 0x0c, 0xd1,
+    0x10, 0x23, 0x2f, 0xe0, 0x01, 0x25, 0xd4, 0xe7, 0x01, 0x26, 0xe8, 0xe7,
+    0x01, 0x23, 0xbc, 0x35, 0x10, 0x13, 0x62, 0x3b, 0xf0, 0x11, 0x2b, 0xf2,
+    0xd0, 0x23, 0x69, 0x00, 0x20, 0x03, 0x93, 0x9b, 0x00, 0x04, 0x93, 0x23,
+    0x00, 0x04, 0x9a, 0x14, 0x33, 0x99, 0x18, 0x1a, 0x68, 0x55, 0x1c, 0x1e,
+    0xd0, 0x01, 0x32, 0x1a, 0x60, 0x23, 0x52, 0x19, 0xf0, 0x1c, 0x2e, 0x40,
+    0xd1, 0x02, 0x9a, 0x01, 0x99, 0x12, 0x68, 0x01, 0x3a, 0x8a, 0x42, 0x0b,
+    0xd1, 0x4a, 0x11, 0x1f, 0x21, 0x01, 0x98, 0x92, 0x00, 0x01, 0x40, 0x01,
+    0x20, 0x05, 0x00, 0x8d, 0x40, 0xd3, 0x58, 0x2b, 0x42, 0x00, 0xd0, 0x01,
+    0x26, 0x20, 0x23, 0x1e, 0x43, 0x0c, 0x01, 0xf5, 0x1e, 0x0a, 0x9b, 0x1f,
+    0x60, 0xa6, 0xe6, 0x01, 0xc3, 0x99, 0x42, 0xda, 0xd8, 0x03, 0x9b, 0xa2,
+    0x68, 0x93, 0x42, 0x17, 0xdb, 0x63, 0x68, 0x05, 0x98, 0x59, 0x1c, 0x00,
+    0xf0, 0x79, 0xf9, 0x05, 0x1e, 0x03, 0xd1, 0x02, 0x00, 0x84, 0x21, 0x1c,
+    0x4b, 0xb7, 0xe6, 0x21, 0x00, 0x23, 0x86, 0x0e, 0x42, 0xf9, 0xf7, 0x7d,
+    0xfb, 0x36, 0x01, 0xf2, 0x0f, 0xab, 0xf9, 0x2c, 0x00, 0x23, 0x69, 0x5a,
+    0x1c, 0x22, 0x61, 0x01, 0x22, 0x04, 0x33, 0x9b, 0x00, 0xe3, 0x18, 0x5a,
+    0x60, 0xba, 0xe7, 0x22, 0x69, 0x03, 0x99, 0x8a, 0x42, 0x09, 0xdd, 0x5e,
+    0x44, 0xf0, 0x21, 0x75, 0xfd, 0x02, 0x9b, 0x01, 0x37, 0x9b, 0x68, 0xbb,
+    0x42, 0xc2, 0xda, 0xdb, 0xe6, 0x1f, 0x22, 0x01, 0x9d, 0x01, 0x99, 0x01,
+    0x26, 0x15, 0x40, 0x11, 0x42, 0xbb, 0xd0, 0x04, 0x9a, 0x9b, 0x18, 0x04,
+    0x3b, 0x18, 0x68, 0x00, 0xf0, 0x3a, 0xfa, 0x20, 0x23, 0x5d, 0x1b, 0xa8,
+    0x42, 0xe4, 0xdb, 0xb8, 0x4b, 0x00, 0x6c, 0x01, 0xf0, 0x13, 0x08, 0x23,
+    0x70, 0xb5, 0x20, 0x25, 0x9a, 0x1a, 0x92, 0x00, 0xad, 0x1a, 0x43, 0x68,
+    0x06, 0x68, 0x1c, 0x00, 0xac, 0x40, 0xd3, 0x40, 0x34, 0x43, 0x04, 0x60,
+    0x43, 0x60, 0x04, 0x30, 0x88, 0x42, 0xf4, 0xd3, 0x26, 0x1b, 0x30, 0x03,
+    0x68, 0x0c, 0xa8, 0x1c, 0x30, 0x2c, 0x02, 0xd1, 0x22, 0x1b, 0xe0, 0x30,
+    0xbd, 0x1a, 0x78, 0x15, 0x00, 0x41, 0x3d, 0x19, 0x2d, 0x00, 0xd8, 0x20,
+    0x32, 0x06, 0x75, 0xf0, 0x15, 0xef, 0xd0, 0x00, 0x20, 0xf3, 0xe7, 0xf0,
+    0xb5, 0x0b, 0x68, 0x8b, 0xb0, 0x01, 0x92, 0x01, 0x99, 0x5a, 0x11, 0x92,
+    0x00, 0x8a, 0x18, 0x02, 0x92, 0x19, 0x00, 0x1f, 0x22, 0x11, 0x40, 0x08,
+    0x90, 0x06, 0x91, 0x13, 0x42, 0x4e, 0x49, 0x30, 0x04, 0x33, 0x02, 0xf6,
+    0x15, 0xf0, 0x06, 0x25, 0x1e, 0x1f, 0x37, 0x00, 0x34, 0x00, 0x08, 0x9b,
+    0x35, 0x60, 0x1b, 0x68, 0x07, 0x95, 0x05, 0x93, 0x03, 0x95, 0x05, 0x9b,
+    0x28, 0x29, 0xf0, 0x1d, 0x05, 0x9b, 0x5b, 0x78, 0x04, 0x93, 0x00, 0x2b,
+    0x28, 0xd0, 0x04, 0x98, 0xff, 0xf7, 0x5f, 0xfd, 0x00, 0x28, 0x54, 0xd1,
+    0x04, 0x9b, 0x20, 0x2b, 0x19, 0xd8, 0x03, 0x9b, 0x07, 0x9a, 0x93, 0x42,
+    0x12, 0xdd, 0xbc, 0x42, 0x06, 0xd2, 0x07, 0x2d, 0x04, 0xdc, 0x2a, 0x00,
+    0x18, 0x02, 0xf1, 0x1c, 0xff, 0xf7, 0x9f, 0xff, 0x01, 0x9b, 0x08, 0x25,
+    0x9c, 0x42, 0x05, 0xd9, 0x27, 0x1f, 0x00, 0x25, 0x3c, 0x00, 0x03, 0x9b,
+    0x3d, 0x60, 0x07, 0x93, 0x09, 0x9b, 0x05, 0x93, 0xd5, 0xe7, 0x04, 0x9b,
+    0x29, 0x2b, 0x59, 0xd1, 0x05, 0x9b, 0x08, 0x9a, 0x02, 0x33, 0x13, 0xc2,
+    0x19, 0x2c, 0x52, 0xd0, 0x40, 0x00, 0xf0, 0x29, 0x7f, 0xff, 0x01, 0x9b,
+    0x9c, 0x42, 0x35, 0xd9, 0x1a, 0x00, 0x23, 0x00, 0x02, 0xcb, 0x02, 0xc2,
+    0x9e, 0x42, 0xfb, 0xd2, 0x02, 0x9b, 0x61, 0x1c, 0xda, 0x1e, 0x04, 0x23,
+    0x91, 0x42, 0x05, 0xd8, 0x02, 0x9b, 0x04, 0x3b, 0x1b, 0x1b, 0x9b, 0x08,
+    0x01, 0x33, 0x9b, 0x00, 0x01, 0x9a, 0xd3, 0x18, 0x00, 0x22, 0x04, 0xc3,
+    0x9e, 0x42, 0xfc, 0xd2, 0x42, 0x43, 0x20, 0x04, 0xd1, 0x3c, 0x07, 0xf0,
+    0x07, 0x26, 0xd1, 0x01, 0x23, 0x33, 0x60, 0x05, 0x20, 0x25, 0xe0, 0x03,
+    0x9b, 0x01, 0x35, 0x01, 0x33, 0x03, 0x93, 0x08, 0x2d, 0x06, 0xdd, 0x56,
+    0x00, 0x20, 0xbb, 0xd9, 0x44, 0x6a, 0xf0, 0x02, 0x04, 0x3c, 0x23, 0x60,
+    0x0f, 0x22, 0x23, 0x68, 0x10, 0x40, 0x1b, 0x01, 0x18, 0x43, 0x20, 0x60,
+    0xb0, 0x5e, 0x29, 0xb0, 0x2b, 0xde, 0xd0, 0x20, 0x21, 0x06, 0x9a, 0x02,
+    0x9b, 0x89, 0x1a, 0x4c, 0x23, 0x60, 0xca, 0x40, 0x04, 0x3b, 0x19, 0x68,
+    0xfa, 0x46, 0x80, 0xd2, 0xe7, 0x04, 0x3e, 0xd0, 0xe7, 0x04, 0x20, 0x92,
+    0x30, 0x60, 0x70, 0xb5, 0x14, 0x1e, 0x0b, 0x4d, 0x32, 0x7e, 0xe0, 0x70,
+    0xbd, 0x10, 0x00, 0x0a, 0x49, 0x01, 0xf0, 0xd4, 0xfa, 0x00, 0x28, 0xf7,
+    0xd0, 0xec, 0x14, 0xf3, 0x0e, 0x01, 0xf0, 0xce, 0xfa, 0x00, 0x28, 0xf1,
+    0xd0, 0x20, 0x00, 0x05, 0x49, 0x01, 0xf0, 0xc8, 0xfa, 0x00, 0x28, 0xeb,
+    0xd0, 0x00, 0x20, 0xea, 0xe7, 0x83, 0xfe, 0x00, 0x10, 0xd4, 0x5c, 0x26,
+    0x80, 0x94, 0x23, 0x02, 0x4a, 0x5b, 0x00, 0xd0, 0x5c, 0xc0, 0x49, 0x04,
+    0x18, 0x20, 0x33, 0x04, 0x00, 0xf6, 0x00, 0x20, 0x00, 0xb8, 0x4f, 0x60,
+    0x70, 0xbd, 0xf0, 0x30, 0x70, 0x47, 0x30, 0x2f, 0x10, 0x94, 0x53, 0x14,
+    0x03, 0x08, 0x00, 0x0c, 0xa4, 0x1c, 0x4f, 0x01, 0xf0, 0x38, 0xfd, 0x80,
+    0x1c, 0x01, 0xf0, 0x01, 0x37, 0xb5, 0x06, 0x9d, 0x02, 0x4c, 0x00, 0x95,
+    0xe4, 0x34, 0x24, 0x68, 0xa0, 0x47, 0x3e, 0xbd, 0x64, 0x00, 0x20, 0x82,
+    0xb0, 0x66, 0x24, 0x60, 0x01, 0xa9, 0x10, 0x1e, 0x06, 0xd0, 0xde, 0x0e,
+    0x51, 0x13, 0x78, 0x0b, 0x60, 0x10, 0xca, 0x69, 0xe0, 0x02, 0xb0, 0x70,
+    0x47, 0x02, 0x20, 0x40, 0x42, 0xfa, 0xe7, 0x70, 0xb5, 0x45, 0x6a, 0xb0,
+    0x1f, 0x20, 0x00, 0x2d, 0x94, 0x1b, 0xf1, 0x30, 0xfb, 0xf7, 0x42, 0xfe,
+    0x02, 0x1e, 0x70, 0x62, 0x04, 0xd1, 0x66, 0x21, 0x19, 0x4b, 0x19, 0x48,
+    0xf8, 0xf7, 0xa7, 0xfa, 0x45, 0x60, 0x85, 0x60, 0x05, 0x60, 0xc5, 0x60,
+    0x75, 0x6a, 0xeb, 0x68, 0x00, 0x2b, 0x13, 0xd0, 0x73, 0x6a, 0xa2, 0x00,
+    0xdb, 0x68, 0x9b, 0x18, 0x18, 0x68, 0x00, 0x28, 0x18, 0xd1, 0x01, 0x21,
+    0x0d, 0x00, 0xa5, 0x40, 0x6a, 0x1d, 0x30, 0x00, 0x92, 0x00, 0xfb, 0x92,
+    0x3d, 0xf1, 0x0c, 0x0c, 0xd0, 0x44, 0x60, 0x85, 0x60, 0x0d, 0xe0, 0x21,
+    0x22, 0x04, 0x21, 0x30, 0x00, 0xfb, 0xf7, 0x6f, 0xfc, 0x73, 0x6a, 0xe8,
+    0x60, 0xdb, 0x68, 0x00, 0x2b, 0xe1, 0xe6, 0x2f, 0xa0, 0x02, 0x68, 0x1a,
+    0x60, 0x00, 0x23, 0x03, 0x61, 0xc3, 0x60, 0x18, 0x0d, 0x00, 0xd8, 0x18,
+    0x11, 0xda, 0xf4, 0x0f, 0x21, 0x46, 0x6a, 0xc4, 0x0d, 0x12, 0x2e, 0x88,
+    0x00, 0xf1, 0x16, 0xfe, 0xfd, 0x02, 0x1e, 0x68, 0x62, 0x04, 0xd1, 0x8a,
+    0x21, 0x09, 0x4b, 0x09, 0x48, 0xf8, 0xf7, 0x63, 0xfa, 0x46, 0x60, 0x86,
+    0x60, 0x06, 0x60, 0xc6, 0x60, 0x00, 0x2c, 0x07, 0xd0, 0x6b, 0x6a, 0x62,
+    0x68, 0xdb, 0x68, 0x92, 0x32, 0x17, 0x64, 0x22, 0x60, 0x1c, 0x60, 0x70,
+    0xbd, 0x48, 0x00, 0xf6, 0x05, 0xf7, 0xb5, 0x0e, 0x00, 0x01, 0x90, 0x0c,
+    0x00, 0x1d, 0x00, 0x00, 0x20, 0x0f, 0x69, 0x14, 0x36, 0x33, 0x68, 0x01,
+    0x30, 0x4e, 0x1d, 0xf0, 0x13, 0x0d, 0x0c, 0x5b, 0x19, 0x1d, 0x0c, 0x89,
+    0xb2, 0x1b, 0x04, 0x5b, 0x18, 0x08, 0xc6, 0x87, 0x42, 0xef, 0xdc, 0x00,
+    0x2d, 0x22, 0xd0, 0xa3, 0x68, 0xbb, 0x42, 0x19, 0xdc, 0x63, 0x68, 0x01,
+    0x98, 0x59, 0x1c, 0xe8, 0x7e, 0xfa, 0x01, 0x06, 0x1e, 0x05, 0xd1, 0x02,
+    0x00, 0xb5, 0x21, 0x0c, 0x4b, 0x0d, 0x48, 0xf8, 0xf7, 0x26, 0xfa, 0x0a,
+    0x04, 0x40, 0x78, 0xf9, 0x21, 0x00, 0x96, 0x5b, 0x60, 0xa6, 0xff, 0x34,
+    0x00, 0x3b, 0x1d, 0x02, 0x04, 0x60, 0x5d, 0x60, 0x7b, 0x1c, 0x23, 0x61,
+    0x26, 0x51, 0x02, 0xc8, 0x03, 0x02, 0x88, 0x00, 0xf0, 0x0b, 0x06, 0x00,
+    0x18, 0x00, 0x0c, 0x00, 0x08, 0x30, 0x09, 0x21, 0x01, 0x93, 0x15, 0x00,
+    0xf8, 0xf7, 0x36, 0xfa, 0x01, 0x23, 0x00, 0x21, 0x83, 0x42, 0x0a, 0xdb,
+    0x02, 0x46, 0x31, 0x43, 0xff, 0x01, 0xfa, 0x06, 0xf4, 0x49, 0x19, 0x4b,
+    0x1a, 0x48, 0xce, 0x31, 0xf8, 0xf7, 0xf3, 0xf9, 0x5b, 0x00, 0x01, 0x31,
+    0xef, 0xe7, 0x08, 0x9b, 0x43, 0x61, 0x01, 0x23, 0x03, 0x61, 0x09, 0x2d,
+    0x18, 0xdd, 0x23, 0x00, 0x09, 0x33, 0x1f, 0x00, 0x00, 0x93, 0x64, 0x19,
+    0x3b, 0x78, 0x0a, 0x22, 0x30, 0x00, 0x30, 0x3b, 0xff, 0xf7, 0x8f, 0xff,
+    0x01, 0x37, 0x01, 0x00, 0xa7, 0x42, 0xf5, 0xd1, 0x2c, 0x00, 0x00, 0x9b,
+    0x08, 0x3c, 0x1c, 0x19, 0x2f, 0x00, 0x01, 0x9b, 0x9f, 0x42, 0x04, 0xdb,
+    0x08, 0x00, 0xfe, 0xbd, 0x09, 0x25, 0x0a, 0x34, 0xf6, 0xe7, 0x63, 0x1b,
+    0xdb, 0x5d, 0x30, 0x00, 0x11, 0x77, 0x30, 0x00, 0x24, 0xed, 0xe7, 0x98,
+    0x00, 0xf0, 0x17, 0x03, 0x00, 0x02, 0x0c, 0x00, 0x20, 0x82, 0x42, 0x01,
+    0xd1, 0x1b, 0x04, 0x10, 0x30, 0x1a, 0x0e, 0x01, 0xd1, 0x08, 0x30, 0x1b,
+    0x02, 0x1a, 0x0f, 0x01, 0xd1, 0x04, 0x30, 0x1b, 0x01, 0x9a, 0x0f, 0x01,
+    0xd1, 0x02, 0x30, 0x9b, 0x00, 0x38, 0x39, 0xf0, 0x1b, 0x01, 0x30, 0x5b,
+    0x00, 0x00, 0xd4, 0x20, 0x20, 0x70, 0x47, 0x03, 0x68, 0x02, 0x00, 0x07,
+    0x21, 0x18, 0x00, 0x08, 0x40, 0x0b, 0x42, 0x0d, 0xd0, 0x06, 0x39, 0x00,
+    0x20, 0x0b, 0x42, 0x05, 0xd1, 0x02, 0x30, 0x03, 0x42, 0x03, 0xd0, 0xcb,
+    0x40, 0x08, 0x00, 0xf0, 0x7c, 0x80, 0x9b, 0x08, 0x13, 0x60, 0xfb, 0xe7,
+    0x99, 0xb2, 0x0e, 0x7d, 0x51, 0x10, 0x20, 0x1b, 0x0c, 0xd9, 0x0a, 0x00,
+    0x61, 0x08, 0x30, 0x1b, 0x0a, 0x19, 0x07, 0x5c, 0x00, 0x31, 0x09, 0x99,
+    0x07, 0x5c, 0x00, 0xf1, 0x09, 0x08, 0xd9, 0x07, 0xe9, 0xd4, 0x01, 0x30,
+    0x5b, 0x08, 0xe6, 0xd1, 0x20, 0x20, 0xe2, 0xe7, 0x10, 0xb5, 0x0c, 0x00,
+    0x01, 0x21, 0xff, 0xf7, 0xbb, 0x1c, 0x69, 0xf4, 0x07, 0xa0, 0x21, 0x02,
+    0x00, 0x04, 0x4b, 0x04, 0x48, 0x49, 0x00, 0xf8, 0xf7, 0x6a, 0xf9, 0x01,
+    0x23, 0x44, 0x61, 0x03, 0x61, 0x10, 0xbd, 0xbc, 0x00, 0xf0, 0x13, 0xf0,
+    0xb5, 0x0b, 0x69, 0x14, 0x00, 0x12, 0x69, 0x0d, 0x00, 0x89, 0xb0, 0x93,
+    0x42, 0x01, 0xda, 0x25, 0x00, 0x0c, 0x00, 0x2f, 0x69, 0x26, 0x69, 0x69,
+    0x68, 0xbb, 0x19, 0x02, 0x93, 0xab, 0x68, 0xba, 0x19, 0xd8, 0x3b, 0x80,
+    0x01, 0x31, 0xff, 0xf7, 0x94, 0xfe, 0x01, 0x90, 0x50, 0x00, 0xf0, 0x0e,
+    0x5e, 0x21, 0x02, 0x00, 0x48, 0x4b, 0x48, 0x48, 0xff, 0x31, 0xf8, 0xf7,
+    0x42, 0xf9, 0x01, 0x9b, 0x00, 0x22, 0x14, 0x33, 0x9c, 0x46, 0xbb, 0x19,
+    0x9b, 0x00, 0x63, 0x44, 0x03, 0x76, 0x5b, 0x50, 0x99, 0x8b, 0x42, 0x2c,
+    0xd3, 0x4e, 0x1d, 0xf2, 0x17, 0x14, 0x33, 0xbf, 0x00, 0x14, 0x32, 0x06,
+    0x93, 0xb6, 0x00, 0xdb, 0x19, 0x04, 0x93, 0x93, 0x19, 0x07, 0x93, 0x04,
+    0x23, 0x05, 0x93, 0x2b, 0x00, 0x04, 0x99, 0x15, 0x33, 0x00, 0x92, 0x99,
+    0x42, 0x05, 0xd3, 0x4b, 0x1b, 0x15, 0x3b, 0x7c, 0x04, 0x40, 0x05, 0x93,
+    0x07, 0x9b, 0xae, 0x67, 0x20, 0x11, 0xd3, 0x36, 0x1b, 0x90, 0x06, 0xdd,
+    0x03, 0x9b, 0x04, 0x3b, 0x03, 0x93, 0x1b, 0xe6, 0x46, 0xb0, 0x2b, 0x53,
+    0xd0, 0x01, 0x9b, 0x02, 0x9a, 0x18, 0x00, 0x1a, 0x61, 0x8c, 0x56, 0xf0,
+    0x37, 0x04, 0xc3, 0xcd, 0xe7, 0x00, 0x9b, 0x1b, 0x68, 0x98, 0xb2, 0x00,
+    0x28, 0x1b, 0xd0, 0x67, 0x46, 0x00, 0x24, 0x06, 0x9e, 0x02, 0xce, 0x3a,
+    0x68, 0x8b, 0xb2, 0x43, 0x43, 0x92, 0xb2, 0x9b, 0x18, 0x1b, 0x19, 0x0c,
+    0x0c, 0x44, 0x43, 0x3a, 0x68, 0x11, 0x0c, 0x61, 0x18, 0x1c, 0x0c, 0x09,
+    0x19, 0x0c, 0x0c, 0x9b, 0xb2, 0x09, 0x04, 0x0b, 0x43, 0x08, 0xc7, 0x04,
+    0x9b, 0xb3, 0x42, 0xe9, 0xd8, 0x63, 0x46, 0x05, 0x9a, 0x9c, 0x50, 0x42,
+    0x00, 0xf1, 0x04, 0x1e, 0x0c, 0x20, 0xd0, 0x63, 0x46, 0x2c, 0x00, 0x60,
+    0x46, 0x00, 0x27, 0x1b, 0x68, 0x14, 0x34, 0x22, 0x68, 0x9b, 0x66, 0x4a,
+    0xf2, 0x2b, 0x02, 0x68, 0x12, 0x0c, 0x89, 0x18, 0xcf, 0x19, 0x39, 0x04,
+    0x0b, 0x43, 0x03, 0x60, 0x02, 0xcc, 0x43, 0x68, 0x09, 0x0c, 0x71, 0x43,
+    0x9b, 0xb2, 0x3f, 0x0c, 0xcb, 0x18, 0x04, 0x9a, 0xdb, 0x19, 0x1f, 0x0c,
+    0x04, 0x30, 0xa2, 0x42, 0xe7, 0xd8, 0x62, 0x46, 0x05, 0x99, 0x53, 0x50,
+    0x00, 0x9b, 0x04, 0x33, 0x00, 0x93, 0x04, 0x23, 0x9c, 0x44, 0x9d, 0xe7,
+    0x12, 0x1e, 0x13, 0x9d, 0x7c, 0x06, 0x02, 0xb4, 0x02, 0x40, 0x03, 0x23,
+    0x15, 0x00, 0x86, 0x6c, 0x00, 0x9a, 0x58, 0x60, 0x08, 0xd0, 0x25, 0x49,
+    0x01, 0x3a, 0xdc, 0x07, 0xf1, 0x04, 0x00, 0x23, 0x31, 0x00, 0xff, 0xf7,
+    0x52, 0xfe, 0x06, 0x00, 0xad, 0x10, 0x3d, 0xd0, 0x7c, 0x6a, 0x00, 0x2c,
+    0x0f, 0xa4, 0x03, 0x11, 0x2c, 0xc0, 0x1f, 0x71, 0x05, 0xd1, 0xd7, 0x21,
+    0x1c, 0x4b, 0x1c, 0xb4, 0x01, 0x17, 0x90, 0xc2, 0x1f, 0x31, 0x9c, 0x68,
+    0x01, 0xf4, 0x1c, 0x11, 0x38, 0x9a, 0x63, 0x20, 0x0b, 0xff, 0x24, 0x62,
+    0x10, 0x98, 0xfa, 0x03, 0x81, 0x60, 0x01, 0x23, 0x1d, 0x42, 0x0a, 0xd0,
+    0x31, 0x26, 0x16, 0x80, 0xff, 0xf7, 0x14, 0xff, 0x31, 0x00, 0x01, 0x90,
+    0x0a, 0x00, 0xf1, 0x00, 0xfd, 0xfd, 0x01, 0x9e, 0x6d, 0x10, 0x0c, 0xd0,
+    0x20, 0x68, 0x00, 0x28, 0x07, 0xd1, 0x22, 0x5a, 0x68, 0xe0, 0xff, 0xf7,
+    0x04, 0xff, 0x00, 0x23, 0x20, 0x60, 0x03, 0x60, 0x04, 0x00, 0xe2, 0xe7,
+    0x76, 0x48, 0x64, 0xc0, 0x46, 0x10, 0x04, 0x01, 0x10, 0xf0, 0x03, 0x20,
+    0x71, 0x02, 0x54, 0x0f, 0x00, 0x50, 0x0f, 0xa0, 0x23, 0x69, 0x55, 0x11,
+    0x87, 0xb0, 0xeb, 0x18, 0x02, 0x93, 0x2e, 0x0b, 0xc0, 0x49, 0x68, 0xa3,
+    0x68, 0x04, 0x90, 0x01, 0x9a, 0x93, 0x42, 0x10, 0xdb, 0xc0, 0x06, 0xf1,
+    0x08, 0x8b, 0xfd, 0x00, 0x23, 0x02, 0x00, 0x06, 0x00, 0x19, 0x00, 0x14,
+    0x32, 0x98, 0x42, 0x0c, 0xd1, 0xda, 0x21, 0x02, 0x00, 0x26, 0x4b, 0x27,
+    0x1a, 0x02, 0x80, 0x35, 0xf8, 0x01, 0x31, 0x5b, 0x00, 0xe8, 0xe7, 0x9c,
+    0x4f, 0x00, 0xe4, 0x65, 0x22, 0xfa, 0xdb, 0xc0, 0x3d, 0xf5, 0x38, 0x1f,
+    0x21, 0x23, 0x00, 0x38, 0x00, 0xad, 0x00, 0x55, 0x19, 0x22, 0x69, 0x14,
+    0x33, 0x92, 0x00, 0x08, 0x40, 0x84, 0x46, 0x9a, 0x18, 0x0f, 0x42, 0x2a,
+    0xd0, 0x01, 0x31, 0x09, 0x1a, 0x05, 0x91, 0x00, 0x21, 0x03, 0x95, 0x67,
+    0x46, 0x18, 0x68, 0xb8, 0x40, 0x01, 0x43, 0x03, 0x98, 0x02, 0xc0, 0x02,
+    0xcb, 0x03, 0x90, 0x05, 0x98, 0xc1, 0x40, 0x9a, 0x42, 0xf3, 0xd8, 0x20,
+    0x00, 0x15, 0x30, 0x04, 0x23, 0x82, 0x42, 0x04, 0xd3, 0x13, 0x38, 0x02,
+    0x40, 0xe9, 0x50, 0x00, 0x29, 0x7a, 0x07, 0x21, 0x02, 0x33, 0x9e, 0x0f,
+    0xd0, 0x98, 0x01, 0x3b, 0x21, 0x00, 0x33, 0x61, 0xff, 0xf7, 0x81, 0xfd,
+    0x30, 0x00, 0x06, 0x10, 0x97, 0x02, 0xcb, 0x02, 0xc5, 0x9a, 0x42, 0xfb,
+    0xd8, 0xf0, 0x94, 0x01, 0xa0, 0x02, 0x69, 0x0b, 0x69, 0x30, 0xb5, 0x04,
+    0x00, 0xd0, 0x1a, 0x3a, 0x69, 0xf0, 0x05, 0x9b, 0x00, 0x14, 0x34, 0x14,
+    0x31, 0xe2, 0x18, 0xc9, 0x18, 0x04, 0x3a, 0x04, 0x39, 0x15, 0x68, 0x0b,
+    0x68, 0x9d, 0x42, 0xf4, 0x5e, 0xf0, 0x01, 0x9d, 0x42, 0x03, 0xd3, 0x30,
+    0xbd, 0x94, 0x42, 0xf3, 0xd3, 0xfb, 0xe7, 0x40, 0x42, 0xf9, 0xe7, 0xa2,
+    0x5b, 0xf0, 0x03, 0x07, 0x00, 0x11, 0x00, 0x30, 0x00, 0x87, 0xb0, 0x14,
+    0x00, 0xff, 0xf7, 0xdc, 0xff, 0x05, 0x1e, 0x10, 0xd1, 0x56, 0x19, 0xf0,
+    0x06, 0xff, 0xf7, 0x06, 0xfd, 0x02, 0x1e, 0x04, 0xd1, 0x3f, 0x4b, 0x40,
+    0x49, 0x40, 0x48, 0xf7, 0xf7, 0xb7, 0xff, 0x01, 0x23, 0x45, 0x66, 0x03,
+    0x01, 0x82, 0x00, 0x20, 0x01, 0x23, 0x42, 0x10, 0x60, 0x04, 0xdb, 0x23,
+    0x00, 0x34, 0x00, 0x20, 0x45, 0xf0, 0x06, 0x01, 0x93, 0x38, 0x00, 0x61,
+    0x68, 0xff, 0xf7, 0xec, 0xfc, 0x02, 0x1e, 0x03, 0xd1, 0x90, 0x21, 0x32,
+    0x4b, 0x89, 0x00, 0xe3, 0xb4, 0x0a, 0xf0, 0x10, 0x27, 0xc3, 0x60, 0x20,
+    0x69, 0x14, 0x34, 0x01, 0x94, 0x01, 0x9b, 0x84, 0x00, 0x1b, 0x19, 0x34,
+    0x00, 0x02, 0x93, 0x33, 0x69, 0x14, 0x34, 0x99, 0x00, 0x63, 0x18, 0x03,
+    0x93, 0x13, 0x00, 0x66, 0x03, 0x00, 0x60, 0x6e, 0x00, 0x74, 0x6a, 0xf5,
+    0x2a, 0x02, 0xcc, 0x20, 0xcb, 0x04, 0x93, 0xab, 0xb2, 0xdf, 0x19, 0x8b,
+    0xb2, 0xfb, 0x1a, 0x09, 0x0c, 0x2d, 0x0c, 0x6d, 0x1a, 0x19, 0x14, 0x6d,
+    0x18, 0x61, 0x46, 0x2f, 0x14, 0x9b, 0xb2, 0x2d, 0x04, 0x2b, 0x43, 0x08,
+    0xc1, 0x03, 0x9b, 0x8c, 0x46, 0xa3, 0x42, 0xe8, 0xd8, 0x31, 0x00, 0x03,
+    0x9c, 0x15, 0x31, 0x04, 0x23, 0x8c, 0x42, 0x04, 0xd3, 0xa3, 0x38, 0x01,
+    0xf0, 0x19, 0x01, 0x99, 0xcc, 0x18, 0x05, 0x99, 0x26, 0x00, 0xcb, 0x18,
+    0x9c, 0x46, 0x02, 0x99, 0x8e, 0x42, 0x10, 0xd3, 0x02, 0x9e, 0xe1, 0x1e,
+    0x00, 0x25, 0x8e, 0x42, 0x04, 0xd3, 0x31, 0x00, 0x03, 0x31, 0x0c, 0x1b,
+    0xa4, 0x08, 0xa5, 0x00, 0x5b, 0x19, 0xb8, 0x07, 0xf1, 0x18, 0x00, 0x29,
+    0x0f, 0xd0, 0x10, 0x61, 0x97, 0xe7, 0x02, 0xce, 0x8d, 0xb2, 0xed, 0x19,
+    0x0f, 0x0c, 0x29, 0x14, 0x79, 0x18, 0x0f, 0x14, 0xad, 0xb2, 0x09, 0x04,
+    0x0d, 0x43, 0x61, 0x46, 0x20, 0xc1, 0x8c, 0x46, 0xdd, 0xe7, 0x01, 0x38,
+    0xe9, 0x10, 0x05, 0x40, 0x32, 0x02, 0x00, 0x00, 0x64, 0x01, 0xf0, 0x01,
+    0x0f, 0x4b, 0x19, 0x40, 0x0f, 0x4b, 0xc9, 0x18, 0x00, 0x29, 0x04, 0xdd,
+    0x00, 0x22, 0x0b, 0x00, 0x4c, 0x33, 0x40, 0x70, 0x47, 0x49, 0x42, 0x42,
+    0x1b, 0xf0, 0x08, 0x09, 0x15, 0x13, 0x29, 0x04, 0xdc, 0x80, 0x20, 0x00,
+    0x03, 0x08, 0x41, 0x03, 0x00, 0xf1, 0xe7, 0x14, 0x39, 0x01, 0x20, 0x1e,
+    0x29, 0x02, 0x12, 0x00, 0x62, 0x06, 0xc8, 0x40, 0x02, 0x00, 0xe8, 0x34,
+    0x28, 0x10, 0x7f, 0x44, 0x1c, 0x00, 0xf4, 0x05, 0x40, 0x03, 0x69, 0x14,
+    0x36, 0xa6, 0x1a, 0x50, 0x1d, 0x1f, 0x2c, 0x68, 0x0f, 0x1c, 0x08, 0xf1,
+    0x27, 0x93, 0xff, 0xf7, 0x45, 0xfd, 0x20, 0x23, 0x1b, 0x1a, 0x1f, 0x49,
+    0x3b, 0x60, 0x0a, 0x28, 0x16, 0xdc, 0x0b, 0x23, 0x27, 0x00, 0x1b, 0x1a,
+    0xdf, 0x40, 0x39, 0x43, 0x9c, 0x46, 0x0b, 0x00, 0x00, 0x21, 0xae, 0x42,
+    0x02, 0xd2, 0x01, 0x99, 0x08, 0x39, 0x09, 0x68, 0x15, 0x30, 0x84, 0x40,
+    0x60, 0x46, 0xc1, 0x40, 0x0c, 0x43, 0x22, 0x84, 0x00, 0x10, 0x03, 0xa4,
+    0x22, 0x11, 0x27, 0x20, 0x00, 0xf0, 0x12, 0x9d, 0x08, 0x3d, 0x2f, 0x68,
+    0x0b, 0x23, 0x5b, 0x42, 0x9c, 0x46, 0x84, 0x44, 0x0b, 0x28, 0x13, 0xd0,
+    0x63, 0x46, 0x20, 0x20, 0x9c, 0x40, 0xc0, 0x1a, 0x3b, 0x00, 0xc3, 0x40,
+    0x1c, 0x43, 0x21, 0x43, 0x4a, 0x00, 0xf0, 0x05, 0xb5, 0x42, 0x01, 0xd9,
+    0x04, 0x3d, 0x29, 0x68, 0x64, 0x46, 0xc1, 0x40, 0xa7, 0x40, 0x0f, 0x43,
+    0x3a, 0x00, 0xdb, 0xe7, 0x1a, 0x00, 0x12, 0xfa, 0xa4, 0x00, 0xf1, 0x01,
+    0x3f, 0xf7, 0xb5, 0x01, 0x21, 0x14, 0x00, 0x1e, 0x00, 0x08, 0x9f, 0xff,
+    0xf7, 0x03, 0xfc, 0x05, 0xe6, 0x06, 0xf0, 0x05, 0x26, 0x4b, 0x27, 0x49,
+    0x27, 0x48, 0xf7, 0xf7, 0xb3, 0xfe, 0x33, 0x03, 0x76, 0x00, 0x1b, 0x0b,
+    0x76, 0x0d, 0x24, 0xd1, 0xb8, 0x03, 0xf0, 0x33, 0x27, 0xd0, 0x68, 0x46,
+    0x00, 0x94, 0xff, 0xf7, 0x01, 0xfd, 0x00, 0x9c, 0x00, 0x28, 0x1e, 0xd0,
+    0x01, 0x9b, 0x20, 0x21, 0x1a, 0x00, 0x09, 0x1a, 0x8a, 0x40, 0xc3, 0x40,
+    0x22, 0x43, 0x6a, 0x61, 0x01, 0x93, 0x01, 0x9c, 0xac, 0x61, 0x63, 0x1e,
+    0x9c, 0x41, 0x01, 0x34, 0x2c, 0x61, 0x00, 0x2e, 0x18, 0xd0, 0x17, 0x4b,
+    0xf6, 0x18, 0x35, 0x23, 0x36, 0x18, 0x18, 0x1a, 0x09, 0x9b, 0x3e, 0x60,
+    0x18, 0x60, 0x20, 0x5c, 0x00, 0x1a, 0x2c, 0x80, 0x13, 0x43, 0xd6, 0xe7,
+    0x6c, 0x61, 0xe7, 0xe7, 0x9c, 0x70, 0xf3, 0x1c, 0xda, 0xfc, 0x01, 0x24,
+    0x01, 0x9b, 0x2c, 0x61, 0x6b, 0x61, 0x20, 0x30, 0xe4, 0xe7, 0x0b, 0x4b,
+    0xc0, 0x18, 0x0b, 0x4b, 0x38, 0x60, 0xe3, 0x18, 0x9b, 0x00, 0xeb, 0x18,
+    0x58, 0x69, 0xff, 0xf7, 0xb0, 0xfc, 0x64, 0x01, 0x09, 0x9b, 0x24, 0x1a,
+    0x1c, 0x60, 0xdf, 0x04, 0x03, 0x22, 0x0a, 0x03, 0xa4, 0x01, 0x51, 0xcd,
+    0xfb, 0xff, 0xff, 0xce, 0x48, 0x2c, 0x20, 0xff, 0x3f, 0xc8, 0x27, 0x61,
+    0x0f, 0x00, 0x04, 0xa9, 0x06, 0x00, 0x14, 0x57, 0xb0, 0x90, 0x01, 0x91,
+    0x00, 0x9c, 0x01, 0x9d, 0x38, 0x00, 0x05, 0xa9, 0x14, 0x57, 0xf0, 0x13,
+    0x02, 0x90, 0x03, 0x91, 0x02, 0x9a, 0x03, 0x9b, 0x31, 0x69, 0x38, 0x69,
+    0x05, 0x9e, 0x08, 0x1a, 0x04, 0x99, 0x40, 0x01, 0x89, 0x1b, 0x41, 0x18,
+    0x08, 0x05, 0x00, 0x29, 0x07, 0xdd, 0x01, 0x99, 0x45, 0x18, 0x7a, 0x1d,
+    0x40, 0xf8, 0xf7, 0xeb, 0xf8, 0xf2, 0x02, 0x51, 0x03, 0x99, 0x0b, 0x1a,
+    0xf6, 0xa8, 0x37, 0xe0, 0x17, 0x28, 0x05, 0xdc, 0x08, 0x4c, 0xc0, 0x00,
+    0x24, 0x18, 0x20, 0x68, 0x61, 0x68, 0x6e, 0x52, 0xc0, 0x05, 0x49, 0x00,
+    0x22, 0x05, 0x4b, 0x01, 0x3c, 0xf8, 0xf7, 0xf3, 0xf8, 0x44, 0x0f, 0x00,
+    0xb4, 0x73, 0x00, 0x40, 0x1e, 0x04, 0x3c, 0x1e, 0x11, 0x70, 0xb2, 0x26,
+    0xf3, 0x3e, 0x01, 0x39, 0x13, 0x69, 0x49, 0x11, 0x01, 0x31, 0x89, 0x00,
+    0x14, 0x34, 0x9b, 0x00, 0x41, 0x18, 0xe3, 0x18, 0xa3, 0x42, 0x0d, 0xd8,
+    0x14, 0x00, 0x11, 0x34, 0x00, 0x25, 0x9c, 0x42, 0x03, 0xd8, 0x9b, 0x1a,
+    0x11, 0x3b, 0x9b, 0x08, 0x9d, 0x00, 0x00, 0x23, 0x40, 0x19, 0x81, 0x42,
+    0x03, 0xd8, 0x70, 0xbd, 0x40, 0xcc, 0x40, 0xc5, 0xec, 0xe7, 0x08, 0xc0,
+    0xf7, 0xe7, 0x02, 0x00, 0x00, 0x69, 0x10, 0xb5, 0x14, 0x32, 0x4b, 0x11,
+    0x98, 0x42, 0x13, 0xdb, 0x0c, 0xdd, 0x1f, 0x88, 0x3f, 0xf0, 0x03, 0x07,
+    0xd0, 0x99, 0x00, 0x8c, 0x58, 0x21, 0x00, 0xc1, 0x40, 0x81, 0x40, 0x01,
+    0x20, 0x8c, 0x42, 0x04, 0xd1, 0x2c, 0x11, 0x10, 0x93, 0x06, 0x4c, 0x72,
+    0x20, 0x10, 0xbd, 0x03, 0x00, 0xf7, 0xe7, 0xec, 0x02, 0xf0, 0x03, 0xf5,
+    0xd0, 0x01, 0x20, 0xf6, 0xe7, 0xf0, 0xb5, 0x8e, 0x68, 0x85, 0xb0, 0x07,
+    0x00, 0x0c, 0x00, 0x03, 0x92, 0x0c, 0x0f, 0x62, 0x3c, 0xd8, 0x90, 0x23,
+    0x8a, 0x89, 0x16, 0x13, 0xf1, 0x06, 0x09, 0x69, 0x23, 0x68, 0x60, 0x69,
+    0x5b, 0x1a, 0x02, 0x93, 0x03, 0x23, 0x43, 0x43, 0xdd, 0x0f, 0xed, 0x18,
+    0x01, 0x9b, 0x02, 0x18, 0x13, 0x31, 0x6d, 0x10, 0xab, 0x66, 0x12, 0x40,
+    0x53, 0x05, 0x32, 0xd5, 0xda, 0x1b, 0x80, 0xfb, 0xf7, 0x55, 0xf9, 0x06,
+    0x1e, 0x09, 0xd1, 0x32, 0x4e, 0x08, 0x72, 0x17, 0x00, 0x5e, 0x11, 0xb5,
+    0x02, 0x9a, 0x21, 0x69, 0xf8, 0xf7, 0xfb, 0xfc, 0xa3, 0x89, 0x14, 0x16,
+    0x13, 0xf0, 0x01, 0x02, 0x9b, 0x26, 0x61, 0xf6, 0x18, 0x26, 0x60, 0x65,
+    0x61, 0x01, 0x9e, 0xed, 0x1a, 0xa5, 0x60, 0x80, 0x0b, 0xf1, 0x04, 0x00,
+    0xd9, 0x01, 0x9e, 0x32, 0x00, 0x03, 0x99, 0x20, 0x68, 0x01, 0xf0, 0xda,
+    0xf8, 0xa3, 0x68, 0x00, 0x20, 0x9b, 0x18, 0x13, 0x60, 0x9e, 0x19, 0x26,
+    0x60, 0xda, 0xe7, 0x20, 0x44, 0xf0, 0x05, 0x00, 0xf0, 0x90, 0xfb, 0x06,
+    0x1e, 0xe0, 0xd1, 0x38, 0x00, 0x21, 0x69, 0xfe, 0xf7, 0xc6, 0xfc, 0xc7,
+    0xe7, 0xc0, 0x46, 0x50, 0x12, 0x06, 0x18, 0x15, 0x00, 0x7a, 0x6c, 0x30,
+    0x65, 0xd0, 0x13, 0x00, 0x4c, 0x30, 0x23, 0x05, 0x93, 0x2a, 0x05, 0xd1,
+    0x00, 0x2b, 0x2d, 0xd0, 0xa6, 0x68, 0x9e, 0x42, 0x49, 0xd8, 0x90, 0x23,
+    0xa2, 0xd8, 0x00, 0xe2, 0x41, 0xd0, 0x03, 0x20, 0x21, 0x69, 0x23, 0x68,
+    0x5b, 0x1a, 0x04, 0x93, 0x63, 0x69, 0xd8, 0x00, 0x22, 0x04, 0x9b, 0xf0,
+    0x13, 0x06, 0xd8, 0x00, 0xf2, 0x05, 0x46, 0xd5, 0x29, 0x00, 0x02, 0x98,
+    0xfb, 0xf7, 0xe9, 0xf8, 0x06, 0x1e, 0x16, 0xd1, 0x0c, 0x23, 0x02, 0x9a,
+    0x01, 0x20, 0xf2, 0x13, 0x02, 0xda, 0x00, 0xf1, 0x00, 0x00, 0x23, 0xbb,
+    0x60, 0x7b, 0x60, 0x31, 0xe0, 0x03, 0x9b, 0x1b, 0x68, 0x05, 0x93, 0x03,
+    0x6e, 0x14, 0x91, 0x03, 0x9b, 0x08, 0x33, 0x03, 0x93, 0xc4, 0xe7, 0x04,
+    0xf2, 0x00, 0x55, 0x82, 0xfc, 0xa3, 0x89, 0x18, 0xf2, 0x00, 0x1f, 0x04,
+    0xf2, 0x00, 0x06, 0x11, 0x05, 0xf2, 0x00, 0x64, 0x61, 0xf8, 0xa3, 0x68,
+    0x01, 0x9a, 0xf2, 0x00, 0xe0, 0xbb, 0x68, 0x26, 0x60, 0x9b, 0x1a, 0xbb,
+    0x60, 0xcf, 0xd1, 0x00, 0x20, 0x78, 0x60, 0x6c, 0x02, 0xf5, 0x06, 0x2a,
+    0x00, 0x02, 0x98, 0x00, 0xf0, 0x10, 0xfb, 0x06, 0x1e, 0xd9, 0xd1, 0x21,
+    0x69, 0x02, 0x98, 0xfe, 0xf7, 0x46, 0xfc, 0xb3, 0x00, 0x01, 0xf1, 0x00,
+    0xa1, 0xb0, 0x03, 0x90, 0x1c, 0x00, 0x8b, 0x89, 0x0f, 0x00, 0x16, 0x00,
+    0x1b, 0x06, 0x11, 0x0e, 0x16, 0xc0, 0x0e, 0xd1, 0x40, 0x21, 0xfb, 0xf7,
+    0x89, 0xf8, 0x38, 0x60, 0x38, 0x61, 0xb0, 0x7f, 0x00, 0xb4, 0x14, 0x50,
+    0x01, 0x38, 0x13, 0x60, 0x21, 0x54, 0x42, 0xf0, 0x08, 0x23, 0x7b, 0x61,
+    0x00, 0x23, 0x08, 0xad, 0x6b, 0x61, 0x20, 0x33, 0x6b, 0x76, 0x10, 0x33,
+    0xab, 0x76, 0x07, 0x94, 0x34, 0x00, 0x23, 0x78, 0xf0, 0x19, 0xf1, 0x00,
+    0x25, 0x2b, 0x48, 0xd1, 0xa3, 0x1b, 0x05, 0x93, 0xb4, 0x42, 0x0c, 0xd0,
+    0x32, 0x00, 0x39, 0x2e, 0x14, 0x10, 0xec, 0x94, 0x42, 0x61, 0xd1, 0xcf,
+    0xe0, 0x6a, 0x69, 0x05, 0x68, 0x21, 0x20, 0x6b, 0x61, 0x2c, 0x00, 0xf0,
+    0x12, 0x00, 0xd1, 0xc6, 0xe0, 0x01, 0x22, 0x00, 0x23, 0x52, 0x42, 0x6a,
+    0x60, 0x04, 0xa9, 0x54, 0x32, 0x52, 0x18, 0x01, 0x34, 0x2b, 0x60, 0xeb,
+    0x60, 0xab, 0x60, 0x13, 0x70, 0xab, 0x65, 0x65, 0x4e, 0x05, 0x60, 0x2b,
+    0xf4, 0x0e, 0x78, 0x00, 0xf0, 0xa3, 0xff, 0x62, 0x1c, 0x00, 0x28, 0x1f,
+    0xd1, 0x29, 0x68, 0xcb, 0x06, 0x04, 0xd5, 0x53, 0x23, 0x04, 0xa8, 0x1b,
+    0x18, 0x20, 0x20, 0x18, 0x70, 0x0b, 0x07, 0x0e, 0x00, 0xf0, 0x01, 0x2b,
+    0x20, 0x18, 0x70, 0x23, 0x78, 0x2a, 0x2b, 0x15, 0xd0, 0x0a, 0x21, 0x22,
+    0x78, 0x60, 0x1c, 0x8c, 0x36, 0xf0, 0x34, 0x17, 0xd8, 0xeb, 0x68, 0x04,
+    0x00, 0x4b, 0x43, 0x9b, 0x18, 0xeb, 0x60, 0xf4, 0xe7, 0x01, 0x34, 0xaf,
+    0xe7, 0x01, 0x23, 0x80, 0x1b, 0x83, 0x40, 0x29, 0x68, 0x14, 0x00, 0x0b,
+    0x43, 0x2b, 0x60, 0xce, 0xe7, 0x07, 0x9b, 0x18, 0x1d, 0x1b, 0x68, 0x07,
+    0x90, 0x00, 0x2b, 0x5e, 0xdb, 0x0b, 0x93, 0x14, 0x00, 0x23, 0x78, 0x2e,
+    0x2b, 0x0a, 0xd1, 0x63, 0x78, 0x2a, 0x2b, 0x5f, 0xd1, 0x07, 0x9b, 0x02,
+    0x34, 0x1a, 0x1e, 0x00, 0xa3, 0x92, 0x00, 0x2b, 0x55, 0xdb, 0x09, 0x93,
+    0x42, 0x4e, 0x03, 0x8e, 0x00, 0x00, 0xc0, 0x2f, 0x31, 0x06, 0xd0, 0x40,
+    0x4c, 0x00, 0xf0, 0x09, 0x2a, 0x68, 0x01, 0x34, 0x13, 0x43, 0x2b, 0x60,
+    0x80, 0x22, 0x2b, 0x68, 0x13, 0x42, 0x08, 0xd0, 0x21, 0x78, 0x6c, 0x29,
+    0x05, 0xd1, 0x93, 0x43, 0x0a, 0x5c, 0x20, 0x13, 0x43, 0xce, 0x00, 0x15,
+    0x40, 0x1a, 0x00, 0x11, 0x68, 0x1a, 0x00, 0x42, 0xc1, 0x32, 0xff, 0x32,
+    0x1a, 0x00, 0xf0, 0x07, 0x23, 0x78, 0x7a, 0x2b, 0x01, 0xd0, 0x74, 0x2b,
+    0x00, 0xd1, 0x01, 0x34, 0x23, 0x78, 0x6a, 0x2b, 0x05, 0xd1, 0x80, 0x23,
+    0x2a, 0x68, 0x6e, 0x1b, 0x00, 0x1e, 0x00, 0xf0, 0x17, 0x21, 0x78, 0x06,
+    0x22, 0x26, 0x48, 0x66, 0x1c, 0x29, 0x76, 0x00, 0xf0, 0x23, 0xff, 0x00,
+    0x28, 0x39, 0xd0, 0x24, 0x4b, 0x00, 0x2b, 0x22, 0xd1, 0x07, 0x22, 0x07,
+    0x9b, 0x07, 0x33, 0x93, 0x43, 0x08, 0x33, 0x07, 0x93, 0x6b, 0x69, 0xd2,
+    0x0f, 0xa0, 0x6b, 0x61, 0x41, 0xe7, 0x5b, 0x42, 0xeb, 0x60, 0x02, 0x23,
+    0xd6, 0x00, 0xf4, 0x01, 0x9b, 0xe7, 0x01, 0x23, 0x5b, 0x42, 0xa6, 0xe7,
+    0x00, 0x23, 0x0a, 0x21, 0x01, 0x34, 0x09, 0x93, 0x0e, 0x01, 0x33, 0x9e,
+    0xd8, 0x6b, 0x0e, 0x01, 0xf0, 0x05, 0x6b, 0x60, 0xf4, 0xe7, 0x07, 0xab,
+    0x00, 0x93, 0x3a, 0x00, 0x29, 0x00, 0x10, 0x4b, 0x03, 0x98, 0xfb, 0xf7,
+    0x61, 0xfa, 0xd8, 0x17, 0xe0, 0x01, 0x33, 0xd6, 0xd1, 0xbb, 0x89, 0x0d,
+    0x98, 0x5b, 0x06, 0x00, 0xd4, 0x0c, 0xe7, 0x50, 0x17, 0x15, 0x09, 0x28,
+    0x00, 0x11, 0x06, 0x28, 0x00, 0xf1, 0x33, 0x0a, 0xfd, 0xea, 0xe7, 0x38,
+    0x05, 0x01, 0x10, 0x3e, 0x05, 0x01, 0x10, 0x42, 0x05, 0x01, 0x10, 0x25,
+    0xa3, 0x00, 0x10, 0x9d, 0xea, 0x00, 0x10, 0x93, 0x68, 0x10, 0xb5, 0x01,
+    0x3b, 0x93, 0x60, 0x00, 0x2b, 0x04, 0xda, 0x94, 0x69, 0xa3, 0x42, 0x07,
+    0xdb, 0x0a, 0x29, 0x05, 0xd0, 0x13, 0x68, 0x58, 0x1c, 0x10, 0x60, 0x19,
+    0x70, 0x08, 0x00, 0x10, 0xbd, 0x00, 0xf0, 0x97, 0xfb, 0x01, 0x00, 0xf9,
+    0xe7, 0x82, 0x3b, 0x12, 0x6e, 0x92, 0x76, 0xd1, 0x9b, 0x04, 0x0b, 0xd4,
+    0xd7, 0x19, 0xbc, 0x42, 0x0d, 0xd0, 0x21, 0x78, 0x2a, 0x74, 0x6e, 0xe0,
+    0xdb, 0xff, 0x01, 0x34, 0x43, 0x1c, 0xf5, 0xd1, 0x0d, 0xe0, 0xbf, 0x08,
+    0xbf, 0x00, 0x1c, 0x00, 0x00, 0x24, 0x6c, 0x20, 0x08, 0xe0, 0x1e, 0x00,
+    0x91, 0x02, 0xcc, 0x00, 0xf0, 0xaf, 0xfc, 0x43, 0x1c, 0xf4, 0xa6, 0x46,
+    0x12, 0xf8, 0xb6, 0x76, 0x31, 0x90, 0x90, 0x68, 0xdc, 0x76, 0x51, 0x28,
+    0x02, 0xd1, 0x50, 0x60, 0xda, 0x6a, 0xf0, 0x1c, 0x6e, 0x9b, 0x04, 0x21,
+    0xd5, 0x17, 0x68, 0x00, 0x26, 0x3b, 0x68, 0x02, 0x93, 0x7b, 0x68, 0x00,
+    0x93, 0x9b, 0x08, 0x03, 0x93, 0x03, 0x9b, 0x9e, 0x42, 0x0b, 0xdb, 0x03,
+    0x23, 0x00, 0x98, 0x08, 0x37, 0x98, 0x43, 0xa3, 0x68, 0x18, 0x1a, 0xa0,
+    0x60, 0xed, 0xd1, 0x08, 0x6e, 0x91, 0x63, 0x60, 0xe3, 0xe7, 0x02, 0x99,
+    0xb3, 0x00, 0xc9, 0x70, 0x40, 0xf0, 0x05, 0x00, 0xf0, 0x7e, 0xfc, 0x43,
+    0x1c, 0xf2, 0xd0, 0x01, 0x36, 0xe5, 0xe7, 0x01, 0x98, 0xfe, 0xf7, 0x67,
+    0xfb, 0xec, 0xe7, 0x1c, 0x03, 0x00, 0x96, 0x0a, 0x46, 0x1c, 0x00, 0x03,
+    0x92, 0xda, 0x1b, 0xd1, 0xfa, 0xf7, 0x17, 0xfe, 0x9d, 0x4b, 0x9e, 0x42,
+    0x1d, 0xd1, 0x7e, 0x68, 0xb3, 0x0e, 0x1e, 0x11, 0xb3, 0x0e, 0x1e, 0xf0,
+    0x01, 0x30, 0x00, 0x58, 0x30, 0x00, 0xf0, 0x72, 0xfd, 0xb3, 0x89, 0x1b,
+    0x07, 0x02, 0xd5, 0x33, 0x69, 0x3a, 0x76, 0x00, 0x04, 0x20, 0x80, 0x00,
+    0xf0, 0x9d, 0xfb, 0x00, 0x28, 0x18, 0xd0, 0x2c, 0x00, 0x20, 0x0d, 0xd5,
+    0xc2, 0x00, 0x00, 0x46, 0x03, 0xf0, 0x05, 0x8d, 0x4b, 0x9e, 0x42, 0x01,
+    0xd1, 0xbe, 0x68, 0xdd, 0xe7, 0x8c, 0x4b, 0x9e, 0x42, 0xda, 0xd1, 0xfe,
+    0x68, 0xd8, 0xe7, 0x48, 0x00, 0x13, 0xee, 0x48, 0x00, 0x4c, 0x52, 0xfd,
+    0xe9, 0xe7, 0x66, 0x03, 0x24, 0x03, 0x9c, 0x66, 0x03, 0x20, 0x4a, 0xd1,
+    0xc0, 0x4e, 0x00, 0x3c, 0x04, 0x60, 0x9c, 0x42, 0x0d, 0xd0, 0x05, 0x9b,
+    0x68, 0x00, 0x20, 0x03, 0x9a, 0x82, 0x53, 0x00, 0x6c, 0x03, 0x1d, 0xd0,
+    0x6c, 0x03, 0x1f, 0xc7, 0x6c, 0x03, 0x08, 0xaf, 0x05, 0x22, 0x21, 0x78,
+    0x6c, 0x48, 0x00, 0xf0, 0xee, 0xfd, 0x6a, 0x03, 0x15, 0x17, 0x16, 0x6a,
+    0x03, 0x1b, 0x18, 0x6a, 0x03, 0x80, 0xad, 0xe7, 0x59, 0x4b, 0x29, 0x68,
+    0xc0, 0x1a, 0xde, 0x51, 0x4a, 0x0b, 0x43, 0x14, 0x00, 0x6c, 0x03, 0x1b,
+    0x5f, 0x6c, 0x03, 0x19, 0x60, 0x6c, 0x03, 0xa0, 0x56, 0xdb, 0x09, 0x93,
+    0x03, 0x22, 0x21, 0x78, 0x49, 0x48, 0x96, 0x6d, 0xe2, 0x00, 0x28, 0x07,
+    0xd0, 0x47, 0x4b, 0x2a, 0x68, 0xc0, 0x1a, 0x40, 0x23, 0x83, 0x40, 0x1a,
+    0x03, 0x0f, 0x6c, 0x03, 0x41, 0x80, 0x63, 0x1c, 0x06, 0x22, 0x2e, 0x48,
+    0x03, 0x93, 0x6e, 0x03, 0x7f, 0x6c, 0xfd, 0x00, 0x28, 0x41, 0xd0, 0x2b,
+    0x6e, 0x03, 0x06, 0x17, 0x3d, 0x6e, 0x03, 0x11, 0x9a, 0x6e, 0x03, 0x1d,
+    0xa5, 0x6e, 0x03, 0x1d, 0x9d, 0x6e, 0x03, 0x20, 0x32, 0x00, 0xe8, 0x06,
+    0x64, 0x17, 0x4b, 0xfb, 0xf7, 0xaa, 0xf8, 0x6e, 0x03, 0x0e, 0x3a, 0x02,
+    0xe6, 0x59, 0xfc, 0xb3, 0x89, 0x5b, 0x06, 0x00, 0xd5, 0xed, 0xe6, 0x0d,
+    0x98, 0xed, 0xe6, 0x38, 0x00, 0x7b, 0x09, 0x4b, 0xfb, 0xf7, 0x4b, 0xfb,
+    0xe2, 0xf8, 0x1d, 0x0c, 0x8c, 0x03, 0x44, 0xcb, 0xee, 0x00, 0x10, 0x2c,
+    0x2f, 0x44, 0xf5, 0xf7, 0x24, 0xfb, 0x2c, 0x2f, 0x13, 0x9d, 0x06, 0x2f,
+    0x08, 0xcc, 0x11, 0x3b, 0x00, 0xf0, 0x5a, 0xce, 0x3f, 0x04, 0x4c, 0x2e,
+    0xf2, 0x04, 0x87, 0xb0, 0x0c, 0x1e, 0x02, 0x90, 0x05, 0x92, 0x06, 0xd1,
+    0x11, 0x00, 0xfa, 0xf7, 0x89, 0xfd, 0x07, 0x00, 0x38, 0x22, 0x0c, 0xc1,
+    0x98, 0xfa, 0xf7, 0x92, 0xff, 0x05, 0x9b, 0x0b, 0x33, 0x16, 0x2b, 0x08,
+    0xf6, 0x54, 0x40, 0x01, 0x93, 0x06, 0xd5, 0xda, 0x06, 0x80, 0x00, 0x27,
+    0x13, 0x60, 0xec, 0xe7, 0x10, 0x23, 0x30, 0x07, 0x00, 0xd8, 0x19, 0xc0,
+    0xf4, 0xd3, 0x23, 0x00, 0x08, 0x3b, 0x5f, 0x68, 0x04, 0x93, 0x3a, 0x00,
+    0x7c, 0x58, 0xf0, 0x19, 0x01, 0x9b, 0x03, 0x92, 0x93, 0x42, 0x00, 0xdc,
+    0x68, 0xe1, 0x04, 0x9b, 0xb7, 0x48, 0x9b, 0x18, 0x82, 0x68, 0x94, 0x46,
+    0x5a, 0x68, 0x9c, 0x45, 0x06, 0xd0, 0x01, 0x25, 0x11, 0x00, 0xa9, 0x43,
+    0x59, 0x18, 0x49, 0x68, 0x29, 0x42, 0x27, 0xd1, 0x16, 0x7d, 0xf0, 0x03,
+    0x03, 0x99, 0x8e, 0x18, 0x01, 0x99, 0x9c, 0x45, 0x18, 0xd1, 0x10, 0x31,
+    0xb1, 0x42, 0x1f, 0xdc, 0x01, 0x99, 0x62, 0x2e, 0xf3, 0x08, 0x63, 0x44,
+    0x83, 0x60, 0x1a, 0x00, 0x01, 0x23, 0x76, 0x1a, 0x1e, 0x43, 0x56, 0x60,
+    0x22, 0x00, 0x08, 0x3a, 0x51, 0x68, 0x02, 0x98, 0x0b, 0x22, 0x53, 0xf0,
+    0x27, 0xfa, 0xf7, 0x4e, 0xff, 0x27, 0x00, 0xab, 0xe7, 0xb1, 0x42, 0x07,
+    0xdc, 0xda, 0x68, 0x9b, 0x68, 0xda, 0x60, 0x93, 0x60, 0x04, 0x9d, 0x7f,
+    0xe0, 0x00, 0x22, 0x13, 0x00, 0xf9, 0x07, 0x00, 0xd5, 0xe2, 0xe0, 0x21,
+    0x00, 0x08, 0x39, 0x0d, 0x68, 0x04, 0x99, 0x4d, 0x1b, 0x03, 0x21, 0x6f,
+    0x68, 0x8f, 0x43, 0x03, 0x99, 0x7f, 0x18, 0x14, 0x03, 0xb0, 0xa0, 0xe0,
+    0xd6, 0x19, 0x9c, 0x45, 0x49, 0xd1, 0x01, 0x9b, 0x10, 0x5a, 0x76, 0xf0,
+    0x32, 0xdd, 0x98, 0xe0, 0xaa, 0x68, 0xeb, 0x68, 0x2f, 0x00, 0xd3, 0x60,
+    0x9a, 0x60, 0x0a, 0x00, 0x04, 0x3a, 0x08, 0x37, 0x24, 0x2a, 0x35, 0xd8,
+    0x3b, 0x00, 0x13, 0x2a, 0x08, 0xd9, 0x23, 0x68, 0xab, 0x60, 0x63, 0x68,
+    0xeb, 0x60, 0x1b, 0x2a, 0x1a, 0xd8, 0x2b, 0x00, 0x08, 0x34, 0x10, 0x33,
+    0x22, 0x68, 0x1a, 0x60, 0x62, 0x68, 0x5a, 0x60, 0xa2, 0x68, 0x9a, 0x60,
+    0x01, 0x9b, 0xea, 0x18, 0x80, 0x4b, 0x08, 0x00, 0x40, 0xf6, 0x1a, 0x01,
+    0x23, 0xa6, 0x00, 0xa0, 0x6a, 0x68, 0x13, 0x40, 0x01, 0x9a, 0x13, 0x43,
+    0x6b, 0x60, 0x3a, 0x01, 0xf1, 0x18, 0xfd, 0xfe, 0x5b, 0xe7, 0xa3, 0x68,
+    0x2b, 0x61, 0xe3, 0x68, 0x6b, 0x61, 0x24, 0x2a, 0x03, 0xd0, 0x2b, 0x00,
+    0x10, 0x34, 0x18, 0x33, 0xdd, 0xe7, 0x23, 0x69, 0xab, 0x61, 0x2b, 0x00,
+    0x62, 0x69, 0x20, 0x33, 0xea, 0x61, 0x18, 0x34, 0xd5, 0xf2, 0x6a, 0xe0,
+    0x00, 0xf0, 0x7a, 0xfc, 0xd6, 0xe7, 0x01, 0x9a, 0xb2, 0x42, 0x50, 0xdc,
+    0x28, 0x00, 0xd2, 0x00, 0x20, 0x08, 0x30, 0xd4, 0x00, 0x00, 0x9c, 0x00,
+    0x00, 0x9a, 0x00, 0x20, 0x03, 0x9a, 0xce, 0x59, 0x57, 0x3e, 0xd8, 0x13,
+    0x2a, 0x07, 0x96, 0x00, 0xf0, 0x27, 0x24, 0xd8, 0x08, 0x34, 0x08, 0x30,
+    0x23, 0x68, 0x03, 0x60, 0x63, 0x68, 0x43, 0x60, 0xa3, 0x68, 0x83, 0x60,
+    0x01, 0x9b, 0x68, 0x68, 0xf4, 0x1a, 0x01, 0x23, 0xaa, 0x19, 0x18, 0x40,
+    0x0f, 0x2c, 0x00, 0xd8, 0xaa, 0xe0, 0x01, 0x99, 0x01, 0x9e, 0x69, 0x18,
+    0x30, 0x43, 0x1c, 0x43, 0x68, 0x60, 0x4c, 0x60, 0x50, 0x68, 0x08, 0x31,
+    0x78, 0x1e, 0x00, 0x0e, 0x08, 0xd9, 0x3f, 0xf8, 0x02, 0x98, 0x08, 0x35,
+    0xfa, 0xf7, 0xa9, 0xfe, 0x2f, 0x00, 0x06, 0xaa, 0x00, 0x10, 0x28, 0xaa,
+    0x00, 0x10, 0x30, 0x9a, 0x72, 0xe0, 0x23, 0x69, 0x20, 0x30, 0xab, 0x61,
+    0x63, 0x69, 0x18, 0x34, 0xeb, 0x61, 0xca, 0xe7, 0x20, 0x57, 0xc0, 0x26,
+    0xfc, 0xcc, 0xe7, 0x01, 0x9b, 0xbb, 0x42, 0x31, 0xdc, 0x28, 0x00, 0x9e,
+    0x00, 0x26, 0x08, 0x30, 0xa0, 0x00, 0x1b, 0x23, 0xa0, 0x00, 0x1d, 0x09,
+    0xa0, 0x00, 0x3f, 0x3e, 0x00, 0xad, 0x6a, 0x00, 0x00, 0x1b, 0xed, 0x6a,
+    0x00, 0x11, 0xe5, 0x6a, 0x00, 0x60, 0xf1, 0xfb, 0xe7, 0xe7, 0x05, 0x99,
+    0x4a, 0x01, 0x40, 0x40, 0xfc, 0x07, 0x1e, 0x8a, 0x49, 0x60, 0x23, 0x00,
+    0x01, 0x22, 0x08, 0x3b, 0xdc, 0x53, 0xf2, 0x09, 0x04, 0x9a, 0xd3, 0x18,
+    0x02, 0x00, 0x08, 0x3a, 0x93, 0x42, 0x05, 0xd1, 0x5e, 0x68, 0x03, 0x23,
+    0x9e, 0x43, 0x03, 0x9b, 0xf6, 0x18, 0xfd, 0xe6, 0x88, 0x00, 0x20, 0x29,
+    0xd8, 0x9a, 0x25, 0x02, 0xc2, 0x01, 0x02, 0x7c, 0x00, 0xf0, 0x11, 0x1b,
+    0x2a, 0x0d, 0xd8, 0x03, 0x00, 0x08, 0x31, 0x08, 0x33, 0x0a, 0x68, 0x1a,
+    0x60, 0x4a, 0x68, 0x5a, 0x60, 0x8a, 0x68, 0x9a, 0x60, 0x21, 0x00, 0x02,
+    0x98, 0xfd, 0xf7, 0xbb, 0xff, 0x27, 0xe7, 0x9c, 0x00, 0x40, 0xe3, 0x68,
+    0xc3, 0x60, 0x94, 0x00, 0xf1, 0x08, 0x03, 0x00, 0x10, 0x31, 0x10, 0x33,
+    0xea, 0xe7, 0x23, 0x69, 0x18, 0x31, 0x03, 0x61, 0x03, 0x00, 0x62, 0x69,
+    0x18, 0x33, 0x42, 0x61, 0xe2, 0x94, 0x00, 0xe0, 0xa7, 0xfb, 0xe4, 0xe7,
+    0x03, 0x9e, 0xc9, 0xe6, 0x06, 0x43, 0x6e, 0x60, 0x51, 0x68, 0x8a, 0x02,
+    0x11, 0x5c, 0x78, 0x1f, 0x41, 0x00, 0x20, 0x01, 0x49, 0x2c, 0x5f, 0x70,
+    0x00, 0xf8, 0x7f, 0x02, 0x78, 0x0b, 0x78, 0xf8, 0x65, 0xb1, 0x01, 0x30,
+    0x01, 0x31, 0x9a, 0x42, 0xf7, 0xd0, 0xd0, 0x1a, 0x70, 0x9c, 0x45, 0x10,
+    0x10, 0x7a, 0x5a, 0xf0, 0x06, 0x24, 0x01, 0x3a, 0x2b, 0x5d, 0x08, 0x5d,
+    0x83, 0x42, 0x01, 0xd1, 0x94, 0x42, 0x01, 0xd1, 0x18, 0x1a, 0x30, 0xbd,
+    0x01, 0x34, 0x36, 0x33, 0x00, 0x2a, 0x07, 0x01, 0x84, 0x2d, 0x07, 0xb6,
+    0x32, 0x90, 0xfa, 0xf7, 0xdd, 0xfa, 0x29, 0x4b, 0x9c, 0x42, 0x34, 0x82,
+    0x24, 0x90, 0x69, 0xa3, 0x60, 0xa3, 0x89, 0x1b, 0x07, 0x38, 0xd5, 0x5c,
+    0x74, 0x24, 0x35, 0xd0, 0x8e, 0x45, 0xf0, 0x05, 0xf7, 0xb2, 0xf6, 0xb2,
+    0x1a, 0x42, 0x36, 0xd0, 0x23, 0x68, 0x22, 0x69, 0x98, 0x1a, 0x63, 0x69,
+    0x83, 0x42, 0x05, 0xdc, 0x68, 0x24, 0xe0, 0xfd, 0xf7, 0xab, 0xfe, 0x00,
+    0x28, 0x27, 0xd1, 0xa3, 0x68, 0x01, 0x30, 0x01, 0x3b, 0x24, 0x0a, 0x60,
+    0x5a, 0x1c, 0x22, 0x60, 0x1f, 0x70, 0x22, 0x00, 0xa0, 0x04, 0xd0, 0xa3,
+    0x89, 0xdb, 0x07, 0x07, 0xd5, 0x0a, 0x2e, 0x70, 0x1f, 0x00, 0x2c, 0x00,
+    0xb3, 0x95, 0xfe, 0x00, 0x28, 0x11, 0xd1, 0x30, 0x00, 0xf8, 0xbd, 0x0e,
+    0x7c, 0x22, 0xb3, 0xc6, 0xe7, 0x0c, 0x4b, 0x9c, 0x42, 0xc3, 0xd1, 0xec,
+    0x68, 0xc1, 0xb8, 0x24, 0x60, 0x35, 0xf8, 0x00, 0x28, 0xc3, 0xd0, 0xaa,
+    0x24, 0x22, 0xea, 0xe7, 0x00, 0x46, 0x11, 0x05, 0x00, 0x46, 0x00, 0x10,
+    0x71, 0x08, 0xa4, 0x04, 0x00, 0xc4, 0x45, 0x02, 0x70, 0x16, 0x42, 0xf5,
+    0xf7, 0xdb, 0xf8, 0x90, 0x04, 0x11, 0x91, 0x7a, 0x44, 0x31, 0x02, 0x4c,
+    0xe0, 0x30, 0x16, 0x11, 0x10, 0x30, 0x16, 0xf0, 0x0a, 0x03, 0x00, 0x08,
+    0x1e, 0x05, 0xd0, 0xff, 0x2a, 0x04, 0xd9, 0x8a, 0x22, 0x01, 0x20, 0x1a,
+    0x60, 0x40, 0x42, 0x70, 0x47, 0x01, 0x20, 0x0a, 0x70, 0xfb, 0xf8, 0x0c,
+    0x01, 0xe8, 0x7d, 0x55, 0xf5, 0xf7, 0xbb, 0xf8, 0x05, 0xe8, 0x33, 0x40,
+    0xfa, 0xf7, 0x56, 0xfa, 0x90, 0x25, 0x10, 0x0f, 0x5c, 0x23, 0xf0, 0x06,
+    0x23, 0xe2, 0x5e, 0x93, 0xb2, 0x11, 0x07, 0x2d, 0xd4, 0xd9, 0x06, 0x11,
+    0xd4, 0x09, 0x23, 0x01, 0x20, 0x33, 0x60, 0x37, 0x33, 0x96, 0x00, 0x00,
+    0x3e, 0x45, 0x00, 0x34, 0x01, 0x00, 0xc4, 0x00, 0xfa, 0x01, 0xeb, 0xe7,
+    0x27, 0x4b, 0x9c, 0x42, 0xe8, 0xd1, 0xec, 0x68, 0xe6, 0xe7, 0x5b, 0x07,
+    0x13, 0xd5, 0x54, 0x25, 0x00, 0xce, 0x22, 0x20, 0xbd, 0xfe, 0x54, 0x25,
+    0x13, 0x24, 0x1a, 0x1f, 0x93, 0x00, 0x23, 0x63, 0x60, 0x23, 0x69, 0x23,
+    0x60, 0x08, 0xa6, 0x1f, 0x00, 0x6a, 0x01, 0x40, 0x0b, 0xd1, 0xa0, 0x21,
+    0x3a, 0x1f, 0x31, 0x89, 0x00, 0x92, 0x56, 0x3e, 0x00, 0xa0, 0x28, 0x00,
+    0x86, 0x74, 0x20, 0xe6, 0xf8, 0xe0, 0x23, 0xf0, 0x15, 0x01, 0x20, 0x1a,
+    0x00, 0x99, 0xb2, 0x02, 0x40, 0x03, 0x42, 0x0f, 0xd0, 0x00, 0x22, 0xa2,
+    0x60, 0x62, 0x69, 0x52, 0x42, 0xa2, 0x61, 0x00, 0x20, 0x22, 0x69, 0x82,
+    0x42, 0xba, 0xd1, 0x0a, 0x06, 0xb8, 0xd5, 0x40, 0x22, 0x4a, 0x00, 0xb1,
+    0x01, 0x38, 0xb3, 0xe7, 0x88, 0x07, 0x00, 0xd4, 0x62, 0x69, 0xa2, 0x20,
+    0x5b, 0x08, 0x30, 0x01, 0x00, 0xd8, 0x08, 0x00, 0x8a, 0x7f, 0xf1, 0x16,
+    0x01, 0x90, 0xfe, 0xf7, 0x23, 0xfc, 0x04, 0x00, 0x01, 0x28, 0x19, 0xd1,
+    0x73, 0x1e, 0xfe, 0x2b, 0x16, 0xd8, 0x02, 0xab, 0x1e, 0x71, 0x00, 0x27,
+    0xa7, 0x42, 0x20, 0xd0, 0x03, 0xab, 0xd9, 0x5d, 0xab, 0x68, 0x01, 0x3b,
+    0xab, 0x72, 0x09, 0xf0, 0x08, 0xaa, 0x69, 0x93, 0x42, 0x19, 0xdb, 0x0a,
+    0x29, 0x17, 0xd0, 0x2b, 0x68, 0x5a, 0x1c, 0x2a, 0x60, 0x19, 0x70, 0x01,
+    0x37, 0xeb, 0xe7, 0x2b, 0xc0, 0x53, 0x81, 0x98, 0x60, 0x33, 0x03, 0xa9,
+    0x00, 0xf0, 0xdd, 0xb6, 0x58, 0xd1, 0xe0, 0xd1, 0x40, 0x23, 0x06, 0x00,
+    0xaa, 0x89, 0x13, 0x43, 0xab, 0x81, 0x30, 0x08, 0x74, 0x00, 0xf4, 0x08,
+    0xe2, 0xff, 0xf7, 0xca, 0xfe, 0x43, 0x1c, 0xe5, 0xd1, 0x06, 0x00, 0xf4,
+    0xe7, 0x93, 0x6e, 0x52, 0x35, 0x20, 0x14, 0x00, 0x98, 0x06, 0x11, 0x93,
+    0x98, 0x06, 0x11, 0x10, 0x98, 0x06, 0x26, 0x09, 0xf9, 0xf0, 0x47, 0xa0,
+    0x04, 0xd1, 0x1a, 0x43, 0xa2, 0x81, 0xa2, 0x6e, 0x13, 0x43, 0xee, 0x47,
+    0x20, 0x22, 0x00, 0xa0, 0x13, 0x13, 0xa4, 0xbe, 0x24, 0x08, 0x16, 0x27,
+    0x42, 0x00, 0xf0, 0xf2, 0xf8, 0x58, 0x69, 0x00, 0xf0, 0x09, 0x46, 0xf4,
+    0xf7, 0xdc, 0xff, 0xa6, 0x35, 0xe2, 0xfa, 0xf7, 0x77, 0xf9, 0x0a, 0x4b,
+    0x9d, 0x42, 0x06, 0xd1, 0x65, 0x68, 0x2a, 0x00, 0x02, 0x1d, 0x20, 0xc0,
+    0xff, 0xf0, 0x7f, 0xfc, 0x01, 0x9d, 0x42, 0x01, 0xd1, 0xa5, 0x68, 0xf4,
+    0xe7, 0x04, 0x4b, 0x9d, 0x42, 0xf1, 0xd1, 0xe5, 0x68, 0x20, 0x01, 0x60,
+    0x70, 0xb5, 0x0e, 0x00, 0x1d, 0x00, 0x64, 0x45, 0xf0, 0x01, 0x14, 0x00,
+    0x96, 0xb0, 0x00, 0x29, 0x0c, 0xda, 0x0c, 0x23, 0xf1, 0x5e, 0x80, 0x22,
+    0x00, 0x23, 0x22, 0x35, 0x00, 0x98, 0x61, 0x10, 0x17, 0x22, 0x61, 0xf0,
+    0x0e, 0x00, 0x23, 0x60, 0x16, 0xe0, 0x6a, 0x46, 0x00, 0xf0, 0x83, 0xf8,
+    0x00, 0x28, 0xed, 0xdb, 0xf0, 0x23, 0x01, 0x99, 0x1b, 0x02, 0x19, 0x40,
+    0x08, 0x4b, 0x80, 0x20, 0xc9, 0x18, 0x42, 0x6f, 0x00, 0x24, 0x00, 0xf2,
+    0x01, 0x29, 0x60, 0x00, 0x01, 0x23, 0x60, 0x02, 0xe0, 0x40, 0x22, 0x18,
+    0x00, 0x22, 0x60, 0x16, 0xb0, 0xcc, 0x60, 0x00, 0x10, 0x0d, 0x22, 0x02,
+    0x26, 0x28, 0x46, 0xf1, 0x02, 0x85, 0xb0, 0x33, 0x42, 0x07, 0xd0, 0x23,
+    0x00, 0x47, 0x33, 0x23, 0x60, 0x23, 0x61, 0x01, 0x23, 0x63, 0xf0, 0x1f,
+    0x40, 0x03, 0xab, 0x02, 0xaa, 0x48, 0x5d, 0xc0, 0x02, 0x9f, 0x01, 0x90,
+    0x39, 0x00, 0x28, 0x00, 0xfa, 0xf7, 0xf6, 0xf9, 0x10, 0x38, 0x00, 0x04,
+    0x02, 0xf0, 0x03, 0x9a, 0x05, 0xed, 0xd4, 0x03, 0x22, 0x93, 0x43, 0x1e,
+    0x43, 0xa6, 0x81, 0xe2, 0xe7, 0x0f, 0x4b, 0xab, 0x62, 0x38, 0x22, 0x20,
+    0x20, 0x60, 0xf8, 0x01, 0x80, 0x03, 0x9b, 0x20, 0x61, 0x67, 0x61, 0x00,
+    0x2b, 0x42, 0x72, 0x00, 0x64, 0x46, 0x41, 0x00, 0xf0, 0x46, 0xf8, 0x8a,
+    0x48, 0x01, 0x72, 0x02, 0x00, 0xe0, 0x06, 0x01, 0x0e, 0x22, 0x81, 0x89,
+    0x01, 0x9b, 0x18, 0x43, 0xa0, 0x81, 0xc9, 0xc8, 0x5d, 0xe0, 0x7f, 0xb5,
+    0x1d, 0x00, 0x09, 0x4b, 0x04, 0x00, 0xe0, 0x33, 0x1e, 0x68, 0x2b, 0x00,
+    0xd8, 0x16, 0x60, 0x0a, 0x00, 0x01, 0xa9, 0x20, 0x00, 0x80, 0x51, 0x20,
+    0x03, 0xd1, 0x46, 0x34, 0x51, 0x8a, 0x33, 0x23, 0x60, 0x04, 0xbc, 0x00,
+    0x08, 0xf4, 0x39, 0x44, 0xf4, 0xf7, 0x24, 0xff, 0x00, 0x08, 0x37, 0xdd,
+    0xff, 0x70, 0x30, 0x49, 0x00, 0xcc, 0x47, 0x4e, 0x00, 0xf0, 0x33, 0xf8,
+    0xcc, 0x47, 0x08, 0x6c, 0x36, 0x3b, 0x00, 0xf0, 0x32, 0x22, 0x00, 0x02,
+    0x20, 0x08, 0x80, 0x10, 0xb5, 0xf6, 0xf7, 0x52, 0xfb, 0x10, 0xbd, 0xd6,
+    0x61, 0x00, 0x44, 0x7b, 0x01, 0xf6, 0x6f, 0x30, 0xf0, 0x12, 0xf9, 0xb4,
+    0x10, 0x00, 0xe4, 0x46, 0x80, 0x58, 0x22, 0x01, 0x20, 0x01, 0x4b, 0x40,
+    0x42, 0xb0, 0x63, 0x00, 0x30, 0x00, 0x0f, 0x10, 0x00, 0x0f, 0x40, 0x02,
+    0x4b, 0x00, 0x20, 0x0e, 0x00, 0x02, 0x60, 0x00, 0x0f, 0x30, 0x00, 0x0d,
+    0x01, 0x12, 0x49, 0xf5, 0x15, 0x47, 0x00, 0x00, 0x07, 0xb5, 0x48, 0x40,
+    0x41, 0x40, 0x48, 0x40, 0x01, 0xe0, 0xc0, 0x46, 0x07, 0xb5, 0x42, 0x00,
+    0x12, 0x0e, 0x03, 0xd0, 0xff, 0x2a, 0x03, 0xd1, 0x42, 0x02, 0x18, 0xd8,
+    0xc0, 0x0d, 0xc0, 0x05, 0x4a, 0x12, 0x00, 0xf1, 0x19, 0x4a, 0x02, 0x0f,
+    0xd8, 0xc9, 0x0d, 0xc9, 0x05, 0x01, 0x22, 0x41, 0x40, 0x05, 0xd4, 0x41,
+    0x40, 0x01, 0xd5, 0x81, 0x42, 0x07, 0xbd, 0x88, 0x42, 0x07, 0xbd, 0x01,
+    0x43, 0x49, 0x18, 0x01, 0xd0, 0xc0, 0x43, 0x00, 0x18, 0x07, 0xbd, 0x00,
+    0xb5, 0x80, 0x0c, 0x60, 0xd9, 0x00, 0x20, 0x00, 0xbd, 0x01, 0x04, 0x00,
+    0xf0, 0x00, 0x23, 0x1b, 0x06, 0x42, 0x00, 0xd2, 0x18, 0x04, 0xd8, 0x4a,
+    0x00, 0xd2, 0x18, 0x01, 0xd8, 0xde, 0x00, 0xf0, 0x15, 0x01, 0x20, 0x70,
+    0x47, 0x13, 0x23, 0x10, 0xb5, 0x10, 0x48, 0x1c, 0x78, 0xf6, 0xf7, 0x10,
+    0xfb, 0x01, 0x00, 0x01, 0x2c, 0x13, 0xd1, 0x0e, 0x4c, 0x54, 0x22, 0x20,
+    0x00, 0xf7, 0xf7, 0xaa, 0xfc, 0x15, 0x23, 0x0c, 0x4a, 0xb2, 0x69, 0xf0,
+    0x44, 0x62, 0x50, 0x20, 0x2b, 0xfa, 0xd1, 0x22, 0x62, 0xe2, 0x61, 0x09,
+    0x48, 0xf6, 0xf7, 0xf4, 0xfa, 0x08, 0x4b, 0x18, 0x60, 0x10, 0xbd, 0x01,
+    0x2c, 0xf7, 0xdd, 0x80, 0x22, 0x02, 0x48, 0xf7, 0xf7, 0x95, 0xfc, 0xf2,
+    0xe7, 0x53, 0x46, 0x00, 0x00, 0x80, 0x19, 0x00, 0x20, 0xe9, 0xfb, 0x00,
+    0x10, 0x4c, 0x33, 0x00, 0x00, 0x7c, 0x19, 0x00, 0x20, 0x07, 0xb5, 0x60,
+    0x46, 0x01, 0x88, 0x0a, 0x0a, 0x02, 0x30, 0xdf, 0x2a, 0xfa, 0xd1, 0xc9,
+    0xb2, 0x82, 0x08, 0x04, 0xd3, 0x02, 0x88, 0x40, 0x88, 0x00, 0x04, 0x10,
+    0x6c, 0x76, 0x90, 0x68, 0x01, 0x4a, 0x50, 0x50, 0x03, 0x90, 0x07, 0xbd,
+    0x38, 0x00, 0xf8, 0x05, 0xf8, 0xb5, 0xc0, 0x46, 0x01, 0xb4, 0x02, 0x48,
+    0x84, 0x46, 0x01, 0xbc, 0x60, 0x47, 0x00, 0xbf, 0x3d, 0x03, 0x00, 0x20,
+    0x10, 0x00, 0x2a, 0x6d, 0x02, 0x10, 0x00, 0x2a, 0x59, 0x04, 0x10, 0x00,
+    0x1b, 0x07, 0x10, 0x00, 0x1b, 0x45, 0x10, 0x00, 0x0c, 0x30, 0x00, 0x2a,
+    0x47, 0x01, 0x10, 0x00, 0x1b, 0x97, 0x10, 0x00, 0x1b, 0x31, 0x70, 0x00,
+    0x1b, 0x31, 0x40, 0x00, 0x1b, 0x1d, 0x10, 0x00, 0x1b, 0x95, 0x30, 0x00,
+    0x1b, 0x05, 0x50, 0x00, 0xf1, 0x02, 0xe1, 0x03, 0x00, 0x20, 0x25, 0x39,
+    0x75, 0x3a, 0x20, 0x62, 0x6c, 0x69, 0x6e, 0x6b, 0x0d, 0x0a, 0x00, 0x0d,
+    0x00, 0x77, 0x42, 0x4c, 0x49, 0x4e, 0x4b, 0x0d, 0x0a, 0x84, 0x76, 0xf3,
+    0x59, 0x99, 0x42, 0x00, 0x10, 0x5d, 0x44, 0x00, 0x10, 0xf9, 0x43, 0x00,
+    0x10, 0x2d, 0x44, 0x00, 0x10, 0xc5, 0x43, 0x00, 0x10, 0x69, 0x43, 0x00,
+    0x10, 0x25, 0x43, 0x00, 0x10, 0x8b, 0x42, 0x00, 0x10, 0x81, 0x42, 0x00,
+    0x10, 0x97, 0x42, 0x00, 0x10, 0x35, 0x45, 0x00, 0x10, 0x53, 0x79, 0x73,
+    0x74, 0x65, 0x6d, 0x20, 0x63, 0x6c, 0x6f, 0x63, 0x6b, 0x20, 0x6f, 0x66,
+    0x20, 0x25, 0x75, 0x20, 0x6b, 0x48, 0x7a, 0x20, 0x63, 0x61, 0x6e, 0x6e,
+    0x6f, 0x74, 0x20, 0x62, 0x65, 0x20, 0x65, 0x78, 0x61, 0x63, 0x74, 0x6c,
+    0x79, 0x20, 0x61, 0x63, 0x68, 0x69, 0x65, 0x76, 0x65, 0x64, 0x00, 0x80,
+    0xfd, 0x00, 0x10, 0x02, 0xff, 0x40, 0x00, 0x80, 0x00, 0x25, 0x00, 0xf9,
+    0x41, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x20, 0x73, 0x74, 0x64, 0x3a,
+    0x3a, 0x64, 0x65, 0x71, 0x75, 0x65, 0x20, 0x6c, 0x61, 0x72, 0x67, 0x65,
+    0x72, 0x20, 0x74, 0x68, 0x61, 0x6e, 0x20, 0x6d, 0x61, 0x78, 0x5f, 0x73,
+    0x69, 0x7a, 0x65, 0x28, 0x29, 0x00, 0x75, 0x73, 0x5f, 0x73, 0x69, 0x6e,
+    0x63, 0x65, 0x5f, 0x62, 0x6f, 0x6f, 0x74, 0x20, 0x3c, 0x3d, 0x20, 0x49,
+    0x4e, 0x54, 0x36, 0x34, 0x5f, 0x4d, 0x41, 0x58, 0x00, 0x76, 0x6f, 0x69,
+    0x64, 0x20, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x5f, 0x27, 0x00, 0xf1,
+    0x37, 0x28, 0x61, 0x62, 0x73, 0x6f, 0x6c, 0x75, 0x74, 0x65, 0x5f, 0x74,
+    0x69, 0x6d, 0x65, 0x5f, 0x74, 0x2a, 0x2c, 0x20, 0x75, 0x69, 0x6e, 0x74,
+    0x36, 0x34, 0x5f, 0x74, 0x29, 0x00, 0x2f, 0x68, 0x6f, 0x6d, 0x65, 0x2f,
+    0x65, 0x61, 0x72, 0x6c, 0x65, 0x2f, 0x41, 0x72, 0x64, 0x75, 0x69, 0x6e,
+    0x6f, 0x2f, 0x68, 0x61, 0x72, 0x64, 0x77, 0x61, 0x72, 0x65, 0x2f, 0x70,
+    0x69, 0x63, 0x6f, 0x2f, 0x72, 0x70, 0x32, 0x30, 0x34, 0x30, 0x2f, 0x0d,
+    0x00, 0xf1, 0x00, 0x2d, 0x73, 0x64, 0x6b, 0x2f, 0x73, 0x72, 0x63, 0x2f,
+    0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x14, 0x00, 0xc3, 0x5f, 0x62, 0x61,
+    0x73, 0x65, 0x2f, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x33, 0x00, 0xf3,
+    0x0a, 0x74, 0x79, 0x70, 0x65, 0x73, 0x2e, 0x68, 0x00, 0x52, 0x61, 0x73,
+    0x70, 0x62, 0x65, 0x72, 0x72, 0x79, 0x20, 0x50, 0x69, 0x00, 0x50, 0x69,
+    0x63, 0x6f, 0x62, 0x00, 0xf1, 0x30, 0x00, 0x42, 0x6f, 0x61, 0x72, 0x64,
+    0x20, 0x43, 0x44, 0x43, 0x00, 0x05, 0x01, 0x09, 0x02, 0xa1, 0x01, 0x85,
+    0x01, 0x09, 0x01, 0xa1, 0x00, 0x05, 0x09, 0x19, 0x01, 0x29, 0x05, 0x15,
+    0x00, 0x25, 0x01, 0x95, 0x05, 0x75, 0x01, 0x81, 0x02, 0x95, 0x01, 0x75,
+    0x03, 0x81, 0x01, 0x05, 0x01, 0x09, 0x30, 0x09, 0x31, 0x15, 0x81, 0x25,
+    0x7f, 0x95, 0x02, 0x75, 0x08, 0x81, 0x06, 0x09, 0x38, 0x0c, 0x00, 0x10,
+    0x01, 0x0c, 0x00, 0x56, 0x05, 0x0c, 0x0a, 0x38, 0x02, 0x0f, 0x00, 0x60,
+    0xc0, 0xc0, 0x05, 0x01, 0x09, 0x06, 0x4f, 0x00, 0x61, 0x05, 0x07, 0x19,
+    0xe0, 0x29, 0xe7, 0x4b, 0x00, 0x13, 0x08, 0x4b, 0x00, 0x50, 0x08, 0x81,
+    0x01, 0x05, 0x08, 0x61, 0x00, 0x00, 0x5d, 0x00, 0x11, 0x91, 0x5d, 0x00,
+    0x10, 0x91, 0x28, 0x00, 0xf0, 0x00, 0x00, 0x2a, 0xff, 0x00, 0x15, 0x00,
+    0x26, 0xff, 0x00, 0x95, 0x06, 0x75, 0x08, 0x81, 0x00, 0x43, 0x00, 0x00,
+    0x92, 0x00, 0x1f, 0x02, 0x92, 0x00, 0x34, 0xf0, 0x21, 0x08, 0x0b, 0x00,
+    0x02, 0x02, 0x02, 0x00, 0x00, 0x09, 0x04, 0x00, 0x00, 0x01, 0x02, 0x02,
+    0x00, 0x04, 0x05, 0x24, 0x00, 0x20, 0x01, 0x05, 0x24, 0x01, 0x00, 0x01,
+    0x04, 0x24, 0x02, 0x02, 0x05, 0x24, 0x06, 0x00, 0x01, 0x07, 0x05, 0x81,
+    0x03, 0x08, 0x00, 0x10, 0x09, 0x04, 0x01, 0x00, 0x02, 0x86, 0x02, 0x50,
+    0x07, 0x05, 0x02, 0x02, 0x40, 0x07, 0x00, 0x10, 0x82, 0x07, 0x00, 0x00,
+    0x6c, 0x1f, 0xf0, 0x08, 0x62, 0xfe, 0x00, 0x10, 0x6f, 0xfe, 0x00, 0x10,
+    0xbd, 0x1a, 0x00, 0x20, 0x7b, 0xfe, 0x00, 0x10, 0x4e, 0x6f, 0x20, 0x73,
+    0x70, 0x69, 0x6e, 0x73, 0x02, 0xfc, 0x0c, 0x73, 0x20, 0x61, 0x72, 0x65,
+    0x20, 0x61, 0x76, 0x61, 0x69, 0x6c, 0x61, 0x62, 0x6c, 0x65, 0x00, 0x4e,
+    0x6f, 0x20, 0x75, 0x73, 0x65, 0x72, 0x20, 0x49, 0x52, 0x51, 0x1b, 0x00,
+    0x13, 0x48, 0xd9, 0x01, 0x60, 0x20, 0x61, 0x6c, 0x61, 0x72, 0x6d, 0x93,
+    0x09, 0x00, 0x00, 0xf0, 0x04, 0x20, 0x25, 0x64, 0x20, 0x61, 0x6c, 0x72,
+    0x65, 0x61, 0x64, 0x79, 0x20, 0x63, 0x6c, 0x61, 0x69, 0x6d, 0x65, 0x64,
+    0x3d, 0x00, 0xc1, 0x70, 0x72, 0x6f, 0x67, 0x72, 0x61, 0x6d, 0x20, 0x73,
+    0x70, 0x61, 0x63, 0x4e, 0x00, 0x60, 0x50, 0x49, 0x4f, 0x20, 0x73, 0x74,
+    0xa0, 0x02, 0x10, 0x6d, 0xc2, 0x02, 0x2c, 0x6e, 0x65, 0x57, 0x00, 0xf0,
+    0x03, 0x2c, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3a,
+    0x20, 0x00, 0x61, 0x73, 0x73, 0x65, 0x72, 0x0c, 0x00, 0xf1, 0x03, 0x20,
+    0x22, 0x25, 0x73, 0x22, 0x20, 0x66, 0x61, 0x69, 0x6c, 0x65, 0x64, 0x3a,
+    0x20, 0x66, 0x69, 0x6c, 0x65, 0x12, 0x00, 0xf1, 0x0f, 0x2c, 0x20, 0x6c,
+    0x69, 0x6e, 0x65, 0x20, 0x25, 0x64, 0x25, 0x73, 0x25, 0x73, 0x0a, 0x00,
+    0x0a, 0x2a, 0x2a, 0x2a, 0x20, 0x50, 0x41, 0x4e, 0x49, 0x43, 0x20, 0x2a,
+    0x2a, 0x2a, 0x0a, 0xa3, 0x00, 0x12, 0x20, 0x44, 0x00, 0x00, 0x88, 0x03,
+    0xf2, 0x03, 0x91, 0x83, 0x00, 0x10, 0x0d, 0x84, 0x00, 0x10, 0x3d, 0x84,
+    0x00, 0x10, 0xe1, 0x84, 0x00, 0x10, 0xb9, 0x85, 0x04, 0x7b, 0xf2, 0x03,
+    0xb1, 0x86, 0x00, 0x10, 0x9d, 0x86, 0x00, 0x10, 0xbd, 0x86, 0x00, 0x10,
+    0x71, 0x87, 0x00, 0x10, 0x55, 0x89, 0x18, 0x00, 0x90, 0x55, 0x6e, 0x68,
+    0x61, 0x6e, 0x64, 0x6c, 0x65, 0x64, 0xff, 0x00, 0x90, 0x20, 0x30, 0x78,
+    0x25, 0x78, 0x0a, 0x00, 0x65, 0x70, 0xea, 0x00, 0x65, 0x25, 0x73, 0x20,
+    0x77, 0x61, 0x73, 0xf1, 0x00, 0x06, 0xbe, 0x00, 0xf4, 0x11, 0x43, 0x61,
+    0x6e, 0x27, 0x74, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x69, 0x6e, 0x75, 0x65,
+    0x20, 0x78, 0x66, 0x65, 0x72, 0x20, 0x6f, 0x6e, 0x20, 0x69, 0x6e, 0x61,
+    0x63, 0x74, 0x69, 0x76, 0x65, 0x20, 0x3f, 0x00, 0x78, 0x00, 0x6f, 0x75,
+    0x74, 0x00, 0x69, 0x6e, 0xaa, 0x7a, 0x0f, 0x01, 0x00, 0x43, 0xf7, 0x17,
+    0xa0, 0x05, 0x00, 0x20, 0x49, 0x4e, 0x46, 0x00, 0x69, 0x6e, 0x66, 0x00,
+    0x4e, 0x41, 0x4e, 0x00, 0x6e, 0x61, 0x6e, 0x00, 0x30, 0x00, 0x30, 0x31,
+    0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x41, 0x42, 0x43, 0x44,
+    0x45, 0x46, 0x11, 0x00, 0xb0, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x00,
+    0x65, 0x25, 0x6c, 0x64, 0x40, 0x00, 0x40, 0x35, 0x00, 0x00, 0x00, 0x58,
+    0x18, 0x53, 0xcb, 0x03, 0x00, 0x00, 0x01, 0x54, 0x00, 0x1f, 0x34, 0x14,
+    0x00, 0x00, 0xf4, 0x1b, 0xbc, 0x89, 0xd8, 0x97, 0xb2, 0xd2, 0x9c, 0x3c,
+    0x33, 0xa7, 0xa8, 0xd5, 0x23, 0xf6, 0x49, 0x39, 0x3d, 0xa7, 0xf4, 0x44,
+    0xfd, 0x0f, 0xa5, 0x32, 0x9d, 0x97, 0x8c, 0xcf, 0x08, 0xba, 0x5b, 0x25,
+    0x43, 0x6f, 0xac, 0x64, 0x28, 0x06, 0x68, 0x11, 0x00, 0x20, 0x01, 0x00,
+    0x10, 0x28, 0x01, 0x00, 0x05, 0x0e, 0x00, 0x05, 0x01, 0x00, 0x2a, 0x88,
+    0x10, 0x01, 0x00, 0x15, 0x04, 0x01, 0x00, 0x03, 0x11, 0x00, 0x11, 0x41,
+    0x01, 0x00, 0x1f, 0x01, 0x01, 0x00, 0x00, 0x02, 0x20, 0x00, 0x11, 0x42,
+    0x01, 0x00, 0x1f, 0x02, 0x01, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x09, 0x1d,
+    0x7c, 0x0f, 0x01, 0x00, 0x61, 0xf4, 0x29, 0x49, 0x6e, 0x66, 0x69, 0x6e,
+    0x69, 0x74, 0x79, 0x00, 0x4e, 0x61, 0x4e, 0x00, 0x52, 0x45, 0x45, 0x4e,
+    0x54, 0x20, 0x6d, 0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x20, 0x73, 0x75, 0x63,
+    0x63, 0x65, 0x65, 0x64, 0x65, 0x64, 0x00, 0x2f, 0x77, 0x6f, 0x72, 0x6b,
+    0x64, 0x69, 0x72, 0x2f, 0x72, 0x65, 0x70, 0x6f, 0x2f, 0x6e, 0x65, 0x77,
+    0x6c, 0x69, 0x62, 0x07, 0x00, 0x80, 0x6c, 0x69, 0x62, 0x63, 0x2f, 0x73,
+    0x74, 0x64, 0x0c, 0x00, 0x8f, 0x64, 0x74, 0x6f, 0x61, 0x2e, 0x63, 0x00,
+    0x42, 0x40, 0x00, 0x25, 0x10, 0x67, 0x41, 0x00, 0xf3, 0x00, 0x2d, 0x67,
+    0x65, 0x74, 0x68, 0x65, 0x78, 0x2e, 0x63, 0x00, 0x2e, 0x00, 0x00, 0x00,
+    0xc4, 0x90, 0x23, 0x9f, 0xa0, 0x0a, 0x00, 0x20, 0x50, 0x4f, 0x53, 0x49,
+    0x58, 0x4d, 0x00, 0x16, 0x73, 0x6d, 0x70, 0x72, 0x65, 0x63, 0x2e, 0x63,
+    0xe7, 0x00, 0x93, 0x05, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x7d,
+    0x10, 0x00, 0x0f, 0x20, 0x02, 0x13, 0xf2, 0x1b, 0xc8, 0x0a, 0x00, 0x80,
+    0xe0, 0x37, 0x79, 0xc3, 0x41, 0x43, 0x17, 0x6e, 0x05, 0xb5, 0xb5, 0xb8,
+    0x93, 0x46, 0xf5, 0xf9, 0x3f, 0xe9, 0x03, 0x4f, 0x38, 0x4d, 0x32, 0x1d,
+    0x30, 0xf9, 0x48, 0x77, 0x82, 0x5a, 0x3c, 0xbf, 0x73, 0x7f, 0xdd, 0x4f,
+    0x15, 0x75, 0x56, 0x00, 0x00, 0x68, 0x1a, 0x00, 0x01, 0x00, 0x00, 0xa8,
+    0x38, 0x00, 0x01, 0x00, 0x12, 0x59, 0x08, 0x00, 0x22, 0x40, 0x8f, 0x08,
+    0x00, 0x22, 0x88, 0xc3, 0x08, 0x00, 0x21, 0x6a, 0xf8, 0x08, 0x00, 0x40,
+    0x80, 0x84, 0x2e, 0x41, 0x08, 0x00, 0x31, 0xd0, 0x12, 0x63, 0x08, 0x00,
+    0x31, 0x84, 0xd7, 0x97, 0x08, 0x00, 0x30, 0x65, 0xcd, 0xcd, 0x08, 0x00,
+    0xc0, 0x20, 0x5f, 0xa0, 0x02, 0x42, 0x00, 0x00, 0x00, 0xe8, 0x76, 0x48,
+    0x37, 0x08, 0x00, 0xf4, 0x0e, 0xa2, 0x94, 0x1a, 0x6d, 0x42, 0x00, 0x00,
+    0x40, 0xe5, 0x9c, 0x30, 0xa2, 0x42, 0x00, 0x00, 0x90, 0x1e, 0xc4, 0xbc,
+    0xd6, 0x42, 0x00, 0x00, 0x34, 0x26, 0xf5, 0x6b, 0x0c, 0x43, 0xa8, 0x00,
+    0xf0, 0x41, 0x00, 0xa0, 0xd8, 0x85, 0x57, 0x34, 0x76, 0x43, 0x00, 0xc8,
+    0x4e, 0x67, 0x6d, 0xc1, 0xab, 0x43, 0x00, 0x3d, 0x91, 0x60, 0xe4, 0x58,
+    0xe1, 0x43, 0x40, 0x8c, 0xb5, 0x78, 0x1d, 0xaf, 0x15, 0x44, 0x50, 0xef,
+    0xe2, 0xd6, 0xe4, 0x1a, 0x4b, 0x44, 0x92, 0xd5, 0x4d, 0x06, 0xcf, 0xf0,
+    0x80, 0x44, 0xf6, 0x4a, 0xe1, 0xc7, 0x02, 0x2d, 0xb5, 0x44, 0xb4, 0x9d,
+    0xd9, 0x79, 0x43, 0x78, 0xea, 0x44, 0x23, 0x2d, 0x30, 0x2b, 0x20, 0x00,
+    0x68, 0x6c, 0x4c, 0x00, 0x65, 0x66, 0x67, 0x45, 0x46, 0x47, 0x90, 0x00,
+    0x40, 0x0d, 0x4b, 0x70, 0xb5, 0xb2, 0x60, 0xf0, 0x41, 0x15, 0xd1, 0xd0,
+    0x25, 0xff, 0x33, 0x2d, 0x06, 0x2b, 0x65, 0x00, 0xf0, 0xe5, 0xf9, 0x01,
+    0x24, 0x2b, 0x6d, 0x23, 0x42, 0x09, 0xd0, 0x00, 0xf0, 0xbf, 0xf9, 0x06,
+    0x4b, 0x98, 0x42, 0xf7, 0xd1, 0x05, 0x4b, 0x1c, 0x70, 0x1a, 0x78, 0x00,
+    0x2a, 0xfc, 0xd1, 0x00, 0xf0, 0xdd, 0xf9, 0x70, 0xbd, 0xce, 0x1a, 0x00,
+    0x20, 0x2e, 0xd0, 0xde, 0xc0, 0xcf, 0x1a, 0x00, 0x20, 0xd0, 0x23, 0x30,
+    0xb5, 0x00, 0x24, 0x00, 0x21, 0x1b, 0x06, 0x1c, 0x57, 0x05, 0x68, 0xef,
+    0xf3, 0x10, 0x83, 0x72, 0xb6, 0xe0, 0x7d, 0x02, 0x6c, 0x75, 0xa0, 0x05,
+    0x79, 0x02, 0x68, 0x7f, 0x2d, 0x06, 0xd9, 0x04, 0x71, 0x0e, 0x00, 0x86,
+    0x11, 0x60, 0x83, 0xf3, 0x10, 0x88, 0x30, 0xbd, 0x0c, 0x00, 0x41, 0x20,
+    0xbf, 0xe4, 0xe7, 0x42, 0x00, 0x80, 0x25, 0x1b, 0x06, 0x1b, 0x78, 0x5b,
+    0xb2, 0x04, 0x42, 0x00, 0x31, 0x82, 0x72, 0xb6, 0x56, 0x72, 0x01, 0x42,
+    0x00, 0xf1, 0x06, 0x04, 0x24, 0x04, 0x57, 0x01, 0x68, 0x9c, 0x42, 0x01,
+    0xd0, 0x00, 0x2c, 0x0a, 0xda, 0x03, 0x71, 0x43, 0x79, 0x01, 0x33, 0x43,
+    0x4e, 0x00, 0x55, 0x00, 0x23, 0x0b, 0x60, 0x82, 0x50, 0x00, 0x11, 0x0d,
+    0x0c, 0x00, 0x50, 0x20, 0xbf, 0xdd, 0xe7, 0x03, 0x50, 0x7c, 0x00, 0x48,
+    0x00, 0x45, 0x84, 0x72, 0xb6, 0x02, 0x8a, 0x00, 0xf2, 0x05, 0x04, 0x22,
+    0x9a, 0x56, 0x00, 0x2a, 0x0c, 0xda, 0xd0, 0x22, 0x01, 0x20, 0x12, 0x06,
+    0x12, 0x68, 0x1a, 0x71, 0x1b, 0x68, 0x04, 0x76, 0xf0, 0x0f, 0x1a, 0x60,
+    0x84, 0xf3, 0x10, 0x88, 0x10, 0xbd, 0x08, 0x1e, 0xf5, 0xd0, 0x00, 0x20,
+    0x0a, 0x60, 0xf2, 0xe7, 0xf7, 0xb5, 0x1e, 0x00, 0xd0, 0x23, 0x05, 0x00,
+    0x17, 0x00, 0x1b, 0x06, 0x44, 0x2f, 0x13, 0x29, 0xd8, 0x00, 0x15, 0x0a,
+    0x4e, 0x00, 0xd1, 0x29, 0x79, 0x00, 0x24, 0x2a, 0x68, 0x7f, 0x29, 0x08,
+    0xd9, 0x01, 0x99, 0x29, 0x8e, 0x00, 0x11, 0x14, 0xd0, 0x00, 0x31, 0x01,
+    0x20, 0xfe, 0x8e, 0x00, 0x02, 0x0e, 0x00, 0xf0, 0x04, 0x38, 0x00, 0x31,
+    0x00, 0x00, 0xf0, 0x34, 0xf9, 0x00, 0x28, 0xdd, 0xd0, 0x20, 0x00, 0xf1,
+    0xe7, 0xf8, 0xb5, 0x0f, 0x8e, 0x69, 0x50, 0xf0, 0x23, 0xf9, 0xfa, 0x22,
+    0x12, 0x3a, 0x30, 0x00, 0x23, 0x92, 0xe2, 0x12, 0x10, 0x21, 0x34, 0x0c,
+    0x01, 0x3c, 0x49, 0xa0, 0x19, 0x6b, 0x41, 0x9d, 0x42, 0x02, 0xd8, 0x04,
+    0xd1, 0x94, 0x2a, 0x76, 0x50, 0x22, 0x52, 0x42, 0xd3, 0x17, 0x0c, 0x18,
+    0x5d, 0xb7, 0xff, 0xf8, 0xbd, 0x01, 0x84, 0x00, 0x52, 0xff, 0x22, 0x02,
+    0x71, 0x02, 0xc4, 0x00, 0x12, 0x21, 0x4e, 0x01, 0x20, 0x40, 0xbf, 0x8a,
+    0x0c, 0x01, 0x2a, 0x00, 0x45, 0x82, 0x72, 0xb6, 0x0b, 0xf2, 0x76, 0xf2,
+    0x01, 0x43, 0x79, 0x01, 0x68, 0x01, 0x3b, 0xdb, 0xb2, 0x43, 0x71, 0x00,
+    0x2b, 0x08, 0xd1, 0xff, 0x24, 0x8e, 0x01, 0x02, 0x3e, 0x01, 0x31, 0x40,
+    0xbf, 0x10, 0xb2, 0x00, 0x04, 0x4e, 0x01, 0xf0, 0x15, 0xf7, 0xe7, 0x00,
+    0x00, 0x08, 0x4a, 0x10, 0xb5, 0x13, 0x78, 0x00, 0x2b, 0x0a, 0xd1, 0x80,
+    0x23, 0x06, 0x48, 0x07, 0x49, 0x5b, 0x05, 0x1c, 0x68, 0xc4, 0x50, 0x04,
+    0x33, 0x8b, 0x42, 0xfa, 0xd1, 0x01, 0x23, 0x13, 0x70, 0x54, 0x47, 0xa1,
+    0xe5, 0x1b, 0x00, 0x20, 0x34, 0x13, 0x00, 0x10, 0x00, 0x01, 0x8c, 0x6c,
+    0x50, 0x4b, 0x01, 0x33, 0x98, 0x47, 0x18, 0x00, 0x40, 0x34, 0x13, 0x00,
+    0x20, 0xda, 0x26, 0xf1, 0x04, 0x05, 0x4b, 0x02, 0x30, 0x1b, 0x68, 0x00,
+    0x02, 0x58, 0x40, 0xc0, 0x23, 0x9b, 0x00, 0x18, 0x40, 0x02, 0x4b, 0x18,
+    0xd8, 0x0c, 0xf0, 0x11, 0x0c, 0x80, 0x01, 0x40, 0x0c, 0x90, 0x01, 0x40,
+    0xf0, 0xb5, 0x14, 0x27, 0x18, 0x26, 0x85, 0xb0, 0x33, 0x88, 0x01, 0x90,
+    0x02, 0x91, 0x38, 0x88, 0x21, 0x49, 0x14, 0x00, 0x98, 0x47, 0x33, 0x88,
+    0x47, 0x06, 0x20, 0x38, 0x88, 0x0a, 0x00, 0x40, 0x1f, 0x49, 0x03, 0x90,
+    0x0a, 0x00, 0x00, 0x5e, 0x1e, 0x80, 0xb6, 0xff, 0xa8, 0x47, 0x03, 0x9b,
+    0x98, 0x47, 0x4c, 0x70, 0xf0, 0x05, 0xd0, 0xff, 0xc0, 0x22, 0x23, 0x00,
+    0x08, 0x20, 0x52, 0x05, 0x12, 0x3f, 0x21, 0x00, 0x19, 0x43, 0x07, 0xd1,
+    0x01, 0x20, 0x9c, 0x6c, 0x20, 0xb0, 0x47, 0x88, 0x0e, 0x00, 0x94, 0x0e,
+    0xf0, 0x37, 0x91, 0x6a, 0x0d, 0x00, 0x05, 0x40, 0x39, 0x42, 0x0b, 0xd0,
+    0x00, 0x2c, 0x09, 0xd0, 0x19, 0x1b, 0x0d, 0x29, 0x06, 0xd8, 0x01, 0x99,
+    0x01, 0x3c, 0x09, 0x78, 0x11, 0x66, 0x01, 0x99, 0x01, 0x31, 0x01, 0x91,
+    0x00, 0x2d, 0xe1, 0xd0, 0x00, 0x2b, 0xdf, 0xd0, 0x11, 0x6e, 0x02, 0x9d,
+    0x01, 0x3b, 0x29, 0x70, 0x29, 0x00, 0x01, 0x31, 0x02, 0x91, 0xd7, 0xe7,
+    0xc0, 0x46, 0x49, 0x46, 0x00, 0x00, 0x45, 0x58, 0x00, 0x00, 0x46, 0x43,
+    0x98, 0x7e, 0xf1, 0x1a, 0x88, 0x42, 0x02, 0xd9, 0x8b, 0x18, 0x98, 0x42,
+    0x03, 0xd3, 0x00, 0x23, 0x07, 0xe0, 0x8b, 0x5c, 0x83, 0x54, 0x01, 0x3a,
+    0xfb, 0xd2, 0x10, 0xbd, 0xcc, 0x5c, 0xc4, 0x54, 0x01, 0x33, 0x9a, 0x42,
+    0xfa, 0xd1, 0xf8, 0xe7, 0xc9, 0xb2, 0x82, 0x18, 0x90, 0x9e, 0x19, 0xf0,
+    0x0d, 0x70, 0x47, 0x03, 0x78, 0x8b, 0x42, 0xfb, 0xd0, 0x01, 0x30, 0xf6,
+    0xe7, 0x02, 0xb4, 0x71, 0x46, 0x49, 0x08, 0x49, 0x00, 0x09, 0x5c, 0x49,
+    0x00, 0x8e, 0x44, 0x02, 0xbc, 0xfc, 0x00, 0x11, 0x03, 0x14, 0x00, 0x60,
+    0x40, 0x00, 0x49, 0x00, 0x09, 0x5e, 0x16, 0x00, 0x47, 0x03, 0xbc, 0x70,
+    0x47, 0x14, 0x00, 0x14, 0x5a, 0x14, 0x00, 0x02, 0x30, 0x13, 0x28, 0x00,
+    0x00, 0x04, 0x0c, 0x48, 0x5d, 0x75, 0x00, 0x10, 0x10, 0x00, 0x2a, 0xad,
+    0x74, 0x10, 0x00, 0x2a, 0x8d, 0x5d, 0x10, 0x00, 0x2a, 0xa5, 0x5c, 0x10,
+    0x00, 0x2a, 0x49, 0x4a, 0x10, 0x00, 0xa0, 0xf1, 0x49, 0x00, 0x10, 0x00,
+    0xc2, 0x01, 0x00, 0x12, 0x01, 0xea, 0x09, 0xa1, 0x01, 0x40, 0x8a, 0x2e,
+    0x0a, 0x00, 0x00, 0x01, 0x01, 0x02, 0xdb, 0x40, 0x01, 0x01, 0x00, 0x04,
+    0x72, 0x07, 0x00, 0x01, 0x00, 0x17, 0x02, 0x0c, 0x00, 0x00, 0x41, 0x7f,
+    0x04, 0x01, 0x00, 0x12, 0xff, 0x07, 0x00, 0xf2, 0x0a, 0xb5, 0x48, 0x68,
+    0x01, 0x31, 0x8e, 0x46, 0x00, 0x47, 0x70, 0x46, 0x09, 0x38, 0x01, 0x49,
+    0x88, 0x47, 0x00, 0xbd, 0x21, 0x56, 0x00, 0x10, 0x38, 0x05, 0xe0, 0x7f,
+    0x62, 0x90, 0x0c, 0x00, 0x20, 0xe8, 0x1b, 0x0c, 0x00, 0x00, 0x01, 0x00,
+    0x17, 0xf8, 0x0c, 0x00, 0x04, 0x6e, 0x00, 0x00, 0x01, 0x00, 0x40, 0x50,
+    0x33, 0x00, 0x00, 0x00, 0x0e, 0xf0, 0x0e, 0x54, 0x33, 0x00, 0x00, 0x52,
+    0x33, 0x00, 0x00, 0x4d, 0x53, 0x00, 0x00, 0x4d, 0x43, 0x00, 0x00, 0x53,
+    0x34, 0x00, 0x00, 0x43, 0x34, 0x00, 0x00, 0x25, 0x1b, 0x00, 0x20, 0x10,
+    0x9c, 0x28, 0x47, 0x00, 0xe0, 0xff, 0x1f, 0x38, 0x00, 0x08, 0x01, 0x00,
+    0x50, 0x30, 0x01, 0x01, 0x10, 0x34, 0x04, 0x64, 0x03, 0x7c, 0x00, 0x08,
+    0x30, 0x11, 0x0f, 0x33, 0x00, 0x04, 0x0f, 0x01, 0x00, 0xb6, 0x00, 0x95,
+    0x21, 0x08, 0xac, 0x01, 0x00, 0x80, 0x15, 0x04, 0x74, 0x6a, 0x00, 0x04,
+    0x00, 0x13, 0xa8, 0x04, 0x00, 0x13, 0xb0, 0x04, 0x00, 0x13, 0xb8, 0x04,
+    0x00, 0x13, 0xc0, 0x04, 0x00, 0x13, 0xc8, 0x04, 0x00, 0x13, 0xd0, 0x04,
+    0x00, 0x13, 0xd8, 0x04, 0x00, 0x13, 0xe0, 0x04, 0x00, 0x13, 0xe8, 0x04,
+    0x00, 0x13, 0xf0, 0x04, 0x00, 0x13, 0xf8, 0x04, 0x00, 0x22, 0x00, 0x07,
+    0x04, 0x00, 0x13, 0x08, 0x04, 0x00, 0x13, 0x10, 0x04, 0x00, 0x13, 0x18,
+    0x04, 0x00, 0x13, 0x20, 0x04, 0x00, 0x13, 0x28, 0x04, 0x00, 0x13, 0x30,
+    0x04, 0x00, 0x13, 0x38, 0x04, 0x00, 0x13, 0x40, 0x04, 0x00, 0x13, 0x48,
+    0x04, 0x00, 0x13, 0x50, 0x04, 0x00, 0x13, 0x58, 0x04, 0x00, 0x13, 0x60,
+    0x04, 0x00, 0x13, 0x68, 0x04, 0x00, 0x13, 0x70, 0x04, 0x00, 0x13, 0x78,
+    0x04, 0x00, 0x13, 0x80, 0x04, 0x00, 0x13, 0x88, 0x04, 0x00, 0x13, 0x90,
+    0x04, 0x00, 0x13, 0x98, 0x04, 0x00, 0x13, 0xa0, 0x04, 0x00, 0x13, 0xa8,
+    0x04, 0x00, 0x13, 0xb0, 0x04, 0x00, 0x13, 0xb8, 0x04, 0x00, 0x13, 0xc0,
+    0x04, 0x00, 0x13, 0xc8, 0x04, 0x00, 0x13, 0xd0, 0x04, 0x00, 0x13, 0xd8,
+    0x04, 0x00, 0x13, 0xe0, 0x04, 0x00, 0x13, 0xe8, 0x04, 0x00, 0x13, 0xf0,
+    0x04, 0x00, 0x13, 0xf8, 0x04, 0x00, 0x22, 0x00, 0x08, 0x04, 0x00, 0x13,
+    0x08, 0x04, 0x00, 0x13, 0x10, 0x04, 0x00, 0x13, 0x18, 0x04, 0x00, 0x13,
+    0x20, 0x04, 0x00, 0x13, 0x28, 0x04, 0x00, 0x13, 0x30, 0x04, 0x00, 0x13,
+    0x38, 0x04, 0x00, 0x13, 0x40, 0x04, 0x00, 0x13, 0x48, 0x04, 0x00, 0x13,
+    0x50, 0x04, 0x00, 0x13, 0x58, 0x04, 0x00, 0x13, 0x60, 0x04, 0x00, 0x13,
+    0x68, 0x04, 0x00, 0x13, 0x70, 0x04, 0x00, 0x13, 0x78, 0x04, 0x00, 0x13,
+    0x80, 0x04, 0x00, 0x13, 0x88, 0x04, 0x00, 0x13, 0x90, 0x04, 0x00, 0x13,
+    0x98, 0x04, 0x00, 0x13, 0xa0, 0x04, 0x00, 0x13, 0xa8, 0x04, 0x00, 0x13,
+    0xb0, 0x04, 0x00, 0x13, 0xb8, 0x04, 0x00, 0x13, 0xc0, 0x04, 0x00, 0x13,
+    0xc8, 0x04, 0x00, 0x13, 0xd0, 0x04, 0x00, 0x13, 0xd8, 0x04, 0x00, 0x13,
+    0xe0, 0x04, 0x00, 0x13, 0xe8, 0x04, 0x00, 0x13, 0xf0, 0x04, 0x00, 0x13,
+    0xf8, 0x04, 0x00, 0x22, 0x00, 0x09, 0x04, 0x00, 0x13, 0x08, 0x04, 0x00,
+    0x13, 0x10, 0x04, 0x00, 0x13, 0x18, 0x04, 0x00, 0x13, 0x20, 0x04, 0x00,
+    0x13, 0x28, 0x04, 0x00, 0x13, 0x30, 0x04, 0x00, 0x13, 0x38, 0x04, 0x00,
+    0x13, 0x40, 0x04, 0x00, 0x13, 0x48, 0x04, 0x00, 0x13, 0x50, 0x04, 0x00,
+    0x13, 0x58, 0x04, 0x00, 0x13, 0x60, 0x04, 0x00, 0x13, 0x68, 0x04, 0x00,
+    0x13, 0x70, 0x04, 0x00, 0x13, 0x78, 0x04, 0x00, 0x13, 0x80, 0x04, 0x00,
+    0x13, 0x88, 0x04, 0x00, 0x13, 0x90, 0x04, 0x00, 0x13, 0x98, 0x04, 0x00,
+    0x13, 0xa0, 0x04, 0x00, 0x13, 0xa8, 0x04, 0x00, 0x13, 0xb0, 0x04, 0x00,
+    0x13, 0xb8, 0x04, 0x00, 0x13, 0xc0, 0x04, 0x00, 0x13, 0xc8, 0x04, 0x00,
+    0x13, 0xd0, 0x04, 0x00, 0x13, 0xd8, 0x04, 0x00, 0x13, 0xe0, 0x04, 0x00,
+    0x13, 0xe8, 0x04, 0x00, 0x13, 0xf0, 0x04, 0x00, 0x13, 0xf8, 0x04, 0x00,
+    0x22, 0x00, 0x0a, 0x04, 0x00, 0x13, 0x08, 0x04, 0x00, 0x13, 0x10, 0x04,
+    0x00, 0x13, 0x18, 0x04, 0x00, 0x13, 0x20, 0x04, 0x00, 0x13, 0x28, 0x04,
+    0x00, 0x13, 0x30, 0x04, 0x00, 0x13, 0x38, 0x04, 0x00, 0x13, 0x40, 0x04,
+    0x00, 0x13, 0x48, 0x04, 0x00, 0x13, 0x50, 0x04, 0x00, 0x13, 0x58, 0x04,
+    0x00, 0x13, 0x60, 0x04, 0x00, 0x13, 0x68, 0x04, 0x00, 0x13, 0x70, 0x04,
+    0x00, 0x13, 0x78, 0x04, 0x00, 0x13, 0x80, 0x04, 0x00, 0x13, 0x88, 0x04,
+    0x00, 0x13, 0x90, 0x04, 0x00, 0x00, 0x9e, 0x05, 0x1f, 0x43, 0x34, 0x04,
+    0x0c, 0x0f, 0x20, 0x00, 0xad, 0x62, 0xe5, 0xf6, 0x00, 0x10, 0xb5, 0xe0,
+    0x47, 0x06, 0x44, 0x28, 0x02, 0x01, 0x10, 0x58, 0x0c, 0x0f, 0x04, 0x00,
+    0x0d, 0x01, 0xc2, 0x26, 0x05, 0x01, 0x00, 0x00, 0xee, 0x06, 0x5f, 0x41,
+    0x53, 0x43, 0x49, 0x49, 0x6a, 0x00, 0x08, 0x0f, 0x20, 0x00, 0x0d, 0x0f,
+    0x01, 0x00, 0x0f, 0x04, 0x52, 0x07, 0x08, 0x5a, 0x07, 0x0f, 0x18, 0x00,
+    0x01, 0x04, 0x08, 0x00, 0xf0, 0x15, 0xe1, 0x74, 0x00, 0x10, 0xdd, 0x63,
+    0x00, 0x10, 0xf1, 0x6d, 0x00, 0x10, 0x8d, 0xfb, 0x00, 0x10, 0x09, 0x42,
+    0x00, 0x10, 0xc1, 0x45, 0x00, 0x10, 0x9d, 0x48, 0x00, 0x10, 0xad, 0x4b,
+    0x00, 0x10, 0xed, 0x63, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00
+};
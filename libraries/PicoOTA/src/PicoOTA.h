@@ -20,38 +20,35 @@
 #pragma once
 
 #include <LittleFS.h>
+#include <Checksum.h>
+#include <FlashProgram.h>
 #include <pico_base/pico/ota_command.h>
 #include <hardware/resets.h>
+#include <hardware/flash.h>
 
 extern uint8_t _FS_start;
 extern uint8_t _FS_end;
 
-// Simple and low code CRC calculation for the OTA page
+// The bootloader image, from lib/ota.o
+extern "C" const uint8_t _binary_ota_bin_start[];
+extern "C" const uint8_t _binary_ota_bin_end[];
+
+// CRC32 for the OTA page and slot images, matching the bootloader's
 class OTACRC32 {
 public:
     OTACRC32() {
-        crc = 0xffffffff;
+        crc = 0;
     }
 
     ~OTACRC32() {
     }
 
     void add(const void *d, uint32_t len) {
-        const uint8_t *data = (const uint8_t *)d;
-        for (uint32_t i = 0; i < len; i++) {
-            crc ^= data[i];
-            for (int j = 0; j < 8; j++) {
-                if (crc & 1) {
-                    crc = (crc >> 1) ^ 0xedb88320;
-                } else {
-                    crc >>= 1;
-                }
-            }
-        }
+        crc = checksumCRC32(crc, d, len);
     }
 
     uint32_t get() {
-        return ~crc;
+        return crc;
     }
 
 private:
@@ -83,10 +80,17 @@ public:
         if (!f) {
             return false;
         }
+        uint8_t magic[19];
+        size_t magicLen = f.read(magic, sizeof(magic));
+        if (!bootloaderCanApply(magic, magicLen)) {
+            f.close();
+            return false;
+        }
+        f.seek(0);
         if (!len) {
-            // Check for GZIP header, and if so read real length from file
-            uint8_t hdr[4];
-            if (2 != f.read(hdr, 2)) {
+            // Check for GZIP or LZ4 header, and if so read real length from file
+            uint8_t hdr[8];
+            if (4 != f.read(hdr, 4)) {
                 // Error, this can't be valid
                 f.close();
                 return false;
@@ -102,6 +106,16 @@ public:
                 len += hdr[1] << 8;
                 len += hdr[2] << 16;
                 len += hdr[3] << 24;
+            } else if ((hdr[0] == 0x04) && (hdr[1] == 0x22) && (hdr[2] == 0x4d) && (hdr[3] == 0x18)) {
+                // LZ4 frame.  The size is only known if the frame descriptor includes it
+                if ((2 != f.read(hdr, 2)) || !(hdr[0] & 0x08) || (8 != f.read(hdr, 8))) {
+                    f.close();
+                    return false;
+                }
+                len = hdr[0];
+                len += hdr[1] << 8;
+                len += hdr[2] << 16;
+                len += hdr[3] << 24;
             } else {
                 len = f.size();
             }
@@ -117,6 +131,25 @@ public:
         return true;
     }
 
+    // Adds an image already written to flash above the running app (A/B slot
+    // mode), which the bootloader copies into place.  The slot must stay as-is
+    // until the update is complete.  Older bootloaders would skip the command,
+    // so this fails unless the linked one supports it.
+    bool addSlot(uint32_t slotaddr, uint32_t len, uint32_t flashaddr = XIP_BASE) {
+        if (!_page  || _page->count == 8 || !(bootloaderFeatures() & _OTA_FEATURE_COPY)) {
+            return false;
+        }
+        OTACRC32 crc;
+        crc.add((const void *)slotaddr, len);
+        _page->cmd[_page->count].command = _OTA_COPY;
+        _page->cmd[_page->count].copy.slotAddress = slotaddr;
+        _page->cmd[_page->count].copy.length = len;
+        _page->cmd[_page->count].copy.flashAddress = flashaddr;
+        _page->cmd[_page->count].copy.crc32 = crc.get();
+        _page->count++;
+        return true;
+    }
+
     bool commit() {
         if (!_page) {
             return false;
@@ -126,6 +159,15 @@ public:
         crc.add(_page, offsetof(OTACmdPage, crc32));
         _page->crc32 = crc.get();
 
+        // Slot copies don't need the filesystem, so write their page to raw flash
+        bool slotOnly = _page->count > 0;
+        for (uint32_t i = 0; i < _page->count; i++) {
+            slotOnly = slotOnly && (_page->cmd[i].command == _OTA_COPY);
+        }
+        if (slotOnly) {
+            return _commitSector();
+        }
+
         File f = LittleFS.open(_OTA_COMMAND_FILE, "w");
         if (!f) {
             return false;
@@ -136,7 +178,42 @@ public:
         return len == sizeof(*_page);
     }
 
+    // The _OTA_FEATURE_xxx bits of the bootloader linked into this sketch
+    static uint32_t bootloaderFeatures() {
+        const size_t signLen = sizeof(((OTAFeatures *)nullptr)->sign);
+        for (const uint8_t *p = _binary_ota_bin_start; p + sizeof(OTAFeatures) <= _binary_ota_bin_end; p += 4) {
+            if (!memcmp(p, _OTA_FEATURES_SIGN, signLen)) {
+                uint32_t features;
+                memcpy(&features, p + signLen, sizeof(features));
+                return features;
+            }
+        }
+        return 0;
+    }
+
+    // False for images starting with hdr that the bootloader would write to
+    // flash verbatim instead of expanding, leaving the board unbootable
+    static bool bootloaderCanApply(const uint8_t *hdr, size_t len) {
+        uint32_t features = bootloaderFeatures();
+        // otadelta.py names the GZIP stream of a compressed patch after the patch signature
+        bool patch = ((len >= 8) && !memcmp(hdr, "Pico DLT", 8)) ||
+                     ((len >= 19) && (hdr[0] == 0x1f) && (hdr[1] == 0x8b) && (hdr[3] == 0x08) && !memcmp(hdr + 10, "Pico DLT", 9));
+        if (patch && !(features & _OTA_FEATURE_PATCH)) {
+            return false;
+        }
+        if ((len >= 4) && !memcmp(hdr, "\x04\x22\x4d\x18", 4) && !(features & _OTA_FEATURE_LZ4)) {
+            return false;
+        }
+        return true;
+    }
+
 private:
+    bool _commitSector() {
+        const uint8_t *sector = &_FS_start - _OTA_COMMAND_SECTOR;
+        flashProgram(sector, _page, sizeof(*_page), true);
+        return !memcmp(sector, _page, sizeof(*_page));
+    }
+
     OTACmdPage *_page = nullptr;
 };
 
@@ -0,0 +1,57 @@
+// Released to the public domain
+//
+// Uses RAMFS as a scratch filesystem and compares the time to write and read
+// back a file against LittleFS.  Anything written to RAMFS is lost on reset.
+
+#include <LittleFS.h>
+#include <RAMFS.h>
+
+uint8_t buff[512];
+
+void timeFS(FS &fs, const char *name) {
+  uint32_t start = millis();
+  File f = fs.open("/tmp/scratch.bin", "w");
+  for (int i = 0; i < 128; i++) {
+    f.write(buff, sizeof(buff));
+  }
+  f.close();
+  uint32_t wrote = millis();
+  f = fs.open("/tmp/scratch.bin", "r");
+  while (f.read(buff, sizeof(buff)) > 0) {
+    /* Read it all back */
+  }
+  f.close();
+  uint32_t done = millis();
+  fs.remove("/tmp/scratch.bin");
+  Serial.printf("%s: write 64KB in %lu ms, read in %lu ms\n", name, wrote - start, done - wrote);
+}
+
+void setup() {
+  Serial.begin(115200);
+  delay(5000);
+
+  memset(buff, 0xa5, sizeof(buff));
+
+  RAMFS.setConfig(RAMFSConfig().setMaxBytes(96 * 1024));
+  RAMFS.begin();
+  timeFS(RAMFS, "RAMFS");
+
+  if (LittleFS.begin()) {
+    timeFS(LittleFS, "LittleFS");
+  }
+
+  // Files in RAM can be used in place
+  File f = RAMFS.open("/hello.txt", "w");
+  f.print("Hello from RAM\n");
+  f.close();
+  f = RAMFS.open("/hello.txt", "r");
+  Serial.write(f.mmap(), f.size());
+  f.close();
+
+  FSInfo i;
+  RAMFS.info(i);
+  Serial.printf("RAMFS: %u of %u bytes used\n", i.usedBytes, i.totalBytes);
+}
+
+void loop() {
+}
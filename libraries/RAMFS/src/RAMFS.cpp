@@ -0,0 +1,415 @@
+/*
+    RAMFS.cpp - Volatile filesystem held in RAM
+    Copyright (c) 2024 Earle F. Philhower, III.  All rights reserved.
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include <Arduino.h>
+#include "RAMFS.h"
+#include <algorithm>
+
+#ifdef USE_TINYUSB
+// For Serial when selecting TinyUSB.  Can't include in the core because Arduino IDE
+// will not link in libraries called from the core.  Instead, add the header to all
+// the standard libraries in the hope it will still catch some user cases where they
+// use these libraries.
+// See https://github.com/earlephilhower/arduino-pico/issues/167#issuecomment-848622174
+#include <Adafruit_TinyUSB.h>
+#endif
+
+namespace ramfs_impl {
+
+RAMFSNode::RAMFSNode(std::shared_ptr<RAMFSPool> pool, const char *name, size_t nameLen, bool dir, RAMFSNode *parent, time_t now) :
+    dir(dir), data(nullptr), size(0), cap(0), ctime(now), mtime(now), parent(parent), pool(pool) {
+    this->name.concat(name, nameLen);
+}
+
+RAMFSNode::~RAMFSNode() {
+    if (data) {
+        pool->free(data);
+        pool->used -= cap;
+    }
+}
+
+bool RAMFSNode::reserve(size_t n) {
+    if (n <= cap) {
+        return true;
+    }
+    // Grow geometrically so a file written in small pieces is not copied on every write
+    size_t want = std::max(n, std::max(cap + cap / 2, (size_t)64));
+    if (pool->limit && (pool->used - cap + want > pool->limit)) {
+        want = n;
+        if (pool->used - cap + want > pool->limit) {
+            DEBUGV("RAMFS: full, want %zu used %zu\n", want, pool->used);
+            return false;
+        }
+    }
+    uint8_t *p = (uint8_t *)pool->realloc(data, want);
+    if (!p && (want > n)) {
+        want = n;
+        p = (uint8_t *)pool->realloc(data, want);
+    }
+    if (!p) {
+        DEBUGV("RAMFS: out of memory, want %zu\n", want);
+        return false;
+    }
+    pool->used += want - cap;
+    data = p;
+    cap = want;
+    return true;
+}
+
+bool RAMFSNode::resize(size_t n) {
+    if (n > size) {
+        if (!reserve(n)) {
+            return false;
+        }
+        memset(data + size, 0, n - size);
+    } else if (n == 0 && data) {
+        // Give the memory back when a file is emptied, e.g. opened for writing
+        pool->free(data);
+        pool->used -= cap;
+        data = nullptr;
+        cap = 0;
+    }
+    size = n;
+    return true;
+}
+
+std::shared_ptr<RAMFSNode> RAMFSNode::child(const char *name, size_t len) const {
+    for (auto &c : children) {
+        if ((c->name.length() == len) && !memcmp(c->name.c_str(), name, len)) {
+            return c;
+        }
+    }
+    return nullptr;
+}
+
+void RAMFSNode::unlink(RAMFSNode *node) {
+    for (auto it = children.begin(); it != children.end(); it++) {
+        if (it->get() == node) {
+            node->parent = nullptr;
+            children.erase(it);
+            return;
+        }
+    }
+}
+
+bool RAMFSImpl::begin() {
+    if (_mounted) {
+        return true;
+    }
+    _pool = std::make_shared<RAMFSPool>();
+    _pool->realloc = _cfg._realloc;
+    _pool->free = _cfg._free;
+    _pool->used = 0;
+    _pool->limit = _cfg._maxBytes;
+    _root = std::make_shared<RAMFSNode>(_pool, "", 0, true, nullptr, _now());
+    _mounted = true;
+    return true;
+}
+
+void RAMFSImpl::end() {
+    if (!_mounted) {
+        return;
+    }
+    // Files still open keep their own node (and the pool) alive until closed
+    _root.reset();
+    _pool.reset();
+    _mounted = false;
+}
+
+bool RAMFSImpl::format() {
+    if (!_mounted) {
+        return begin();
+    }
+    _root->children.clear();
+    return true;
+}
+
+bool RAMFSImpl::info(FSInfo& info) {
+    if (!_mounted) {
+        return false;
+    }
+    info.maxOpenFiles = 255; // Only limited by the heap
+    info.blockSize = 1;
+    info.pageSize = 1;
+    info.maxPathLength = 255;
+    info.usedBytes = _pool->used;
+    info.totalBytes = _pool->limit ? _pool->limit : _pool->used + rp2040.getFreeHeap();
+    return true;
+}
+
+std::shared_ptr<RAMFSNode> RAMFSImpl::_lookup(const char *path, std::shared_ptr<RAMFSNode> *parent, const char **leaf) {
+    std::shared_ptr<RAMFSNode> node = _root;
+    std::shared_ptr<RAMFSNode> up;
+    const char *last = path;
+    while (*path == '/') {
+        path++;
+    }
+    while (*path && node) {
+        const char *slash = strchr(path, '/');
+        size_t len = slash ? slash - path : strlen(path);
+        up = node;
+        last = path;
+        node = node->dir ? node->child(path, len) : nullptr;
+        path += len;
+        while (*path == '/') {
+            path++;
+        }
+        if (!node && *path) {
+            // A directory along the way is missing, so there is no parent either
+            up.reset();
+        }
+    }
+    if (parent) {
+        *parent = up;
+    }
+    if (leaf) {
+        *leaf = last;
+    }
+    return node;
+}
+
+std::shared_ptr<RAMFSNode> RAMFSImpl::_makeParents(const char *path, const char **leaf) {
+    std::shared_ptr<RAMFSNode> dir = _root;
+    while (*path == '/') {
+        path++;
+    }
+    while (true) {
+        const char *slash = strchr(path, '/');
+        if (!slash) {
+            break;
+        }
+        auto next = dir->child(path, slash - path);
+        if (!next) {
+            next = std::make_shared<RAMFSNode>(_pool, path, slash - path, true, dir.get(), _now());
+            dir->children.push_back(next);
+        } else if (!next->dir) {
+            return nullptr;
+        }
+        dir = next;
+        path = slash;
+        while (*path == '/') {
+            path++;
+        }
+    }
+    *leaf = path;
+    return dir;
+}
+
+FileImplPtr RAMFSImpl::open(const char* path, OpenMode openMode, AccessMode accessMode) {
+    if (!_mounted || !path) {
+        DEBUGV("RAMFSImpl::open() called on unmounted FS\n");
+        return FileImplPtr();
+    }
+    auto node = _lookup(path);
+    if (!node && (openMode & OM_CREATE)) {
+        // For file creation, silently make subdirs as needed
+        const char *leaf;
+        auto dir = _makeParents(path, &leaf);
+        if (!dir || !leaf[0]) {
+            DEBUGV("RAMFSImpl::open: can't create `%s`\n", path);
+            return FileImplPtr();
+        }
+        node = std::make_shared<RAMFSNode>(_pool, leaf, strlen(leaf), false, dir.get(), _now());
+        dir->children.push_back(node);
+    }
+    if (!node) {
+        DEBUGV("RAMFSImpl::open: `%s` not found\n", path);
+        return FileImplPtr();
+    }
+    if (node->dir) {
+        // To support openNextFile a directory is returned as a File which can't be read or written
+        return std::make_shared<RAMFSFileImpl>(this, path, node, AM_READ, false);
+    }
+    if ((openMode & OM_TRUNCATE) && (accessMode & AM_WRITE)) {
+        node->resize(0);
+        node->mtime = _now();
+    }
+    return std::make_shared<RAMFSFileImpl>(this, path, node, accessMode, openMode & OM_APPEND);
+}
+
+DirImplPtr RAMFSImpl::openDir(const char *path) {
+    if (!_mounted || !path) {
+        return DirImplPtr();
+    }
+    String p = path;
+    while (p.length() && (p[p.length() - 1] == '/')) {
+        p.remove(p.length() - 1);
+    }
+    while (p.length() && (p[0] == '/')) {
+        p.remove(0, 1);
+    }
+    String filter;
+    auto node = _lookup(p.c_str());
+    if (!node || !node->dir) {
+        // Name is a file or doesn't exist, so list the matching entries of the containing dir
+        int slash = p.lastIndexOf('/');
+        filter = p.substring(slash + 1);
+        p = (slash < 0) ? String() : p.substring(0, slash);
+        node = _lookup(p.c_str());
+        if (!node || !node->dir) {
+            DEBUGV("RAMFSImpl::openDir: path=`%s` not found\n", path);
+            return DirImplPtr();
+        }
+    }
+    if (p.length()) {
+        p += '/';
+    }
+    return std::make_shared<RAMFSDirImpl>(this, p, node, filter);
+}
+
+bool RAMFSImpl::rename(const char* pathFrom, const char* pathTo) {
+    if (!_mounted || !pathFrom || !pathFrom[0] || !pathTo || !pathTo[0]) {
+        return false;
+    }
+    auto node = _lookup(pathFrom);
+    std::shared_ptr<RAMFSNode> dir;
+    const char *leaf;
+    auto dest = _lookup(pathTo, &dir, &leaf);
+    if (!node || !node->parent || !dir || !dir->dir || !leaf[0] || (node == dest)) {
+        return false;
+    }
+    // A directory can't be moved inside itself
+    for (RAMFSNode *p = dir.get(); p; p = p->parent) {
+        if (p == node.get()) {
+            return false;
+        }
+    }
+    if (dest) {
+        // Like LittleFS, a file replaces a file and a directory only an empty directory
+        if ((dest->dir != node->dir) || (dest->dir && dest->children.size())) {
+            return false;
+        }
+        dir->unlink(dest.get());
+    }
+    String name = leaf;
+    while (name.length() && (name[name.length() - 1] == '/')) {
+        name.remove(name.length() - 1);
+    }
+    node->parent->unlink(node.get());
+    node->name = name;
+    node->parent = dir.get();
+    dir->children.push_back(node);
+    return true;
+}
+
+bool RAMFSImpl::remove(const char* path) {
+    if (!_mounted || !path || !path[0]) {
+        return false;
+    }
+    auto node = _lookup(path);
+    if (!node || !node->parent || (node->dir && node->children.size())) {
+        return false;
+    }
+    // An open file keeps its contents until closed
+    node->parent->unlink(node.get());
+    return true;
+}
+
+bool RAMFSImpl::mkdir(const char* path) {
+    if (!_mounted || !path || !path[0]) {
+        return false;
+    }
+    std::shared_ptr<RAMFSNode> dir;
+    const char *leaf;
+    if (_lookup(path, &dir, &leaf) || !dir || !dir->dir || !leaf[0]) {
+        return false;
+    }
+    String name = leaf;
+    while (name.length() && (name[name.length() - 1] == '/')) {
+        name.remove(name.length() - 1);
+    }
+    dir->children.push_back(std::make_shared<RAMFSNode>(_pool, name.c_str(), name.length(), true, dir.get(), _now()));
+    return true;
+}
+
+bool RAMFSImpl::rmdir(const char* path) {
+    auto node = _mounted && path ? _lookup(path) : nullptr;
+    if (!node || !node->dir) {
+        return false;
+    }
+    return remove(path);
+}
+
+
+size_t RAMFSFileImpl::write(const uint8_t *buf, size_t size) {
+    if (!_node || _node->dir || !(_access & AM_WRITE) || !buf || !size) {
+        return 0;
+    }
+    if (_append) {
+        _pos = _node->size;
+    }
+    if (!_node->reserve(_pos + size)) {
+        return 0;
+    }
+    memcpy(_node->data + _pos, buf, size);
+    _pos += size;
+    if (_pos > _node->size) {
+        _node->size = _pos;
+    }
+    _node->mtime = _fs->_now();
+    return size;
+}
+
+int RAMFSFileImpl::read(uint8_t* buf, size_t size) {
+    if (!_node || _node->dir || !(_access & AM_READ) || !buf) {
+        return -1;
+    }
+    if (_pos >= _node->size) {
+        return 0;
+    }
+    size = std::min(size, _node->size - _pos);
+    memcpy(buf, _node->data + _pos, size);
+    _pos += size;
+    return size;
+}
+
+bool RAMFSFileImpl::seek(uint32_t pos, SeekMode mode) {
+    if (!_node || _node->dir) {
+        return false;
+    }
+    int64_t newPos;
+    switch (mode) {
+    case SeekSet: newPos = pos; break;
+    case SeekCur: newPos = (int64_t)_pos + (int32_t)pos; break;
+    case SeekEnd: newPos = (int64_t)_node->size - pos; break; // Matches LittleFS semantics
+    default: return false;
+    }
+    if ((newPos < 0) || (newPos > (int64_t)_node->size)) {
+        return false;
+    }
+    _pos = (uint32_t)newPos;
+    return true;
+}
+
+bool RAMFSFileImpl::truncate(uint32_t size) {
+    if (!_node || _node->dir || !(_access & AM_WRITE)) {
+        return false;
+    }
+    if (!_node->resize(size)) {
+        return false;
+    }
+    _node->mtime = _fs->_now();
+    return true;
+}
+
+}; // namespace ramfs_impl
+
+#if !defined(NO_GLOBAL_INSTANCES) && !defined(NO_GLOBAL_RAMFS)
+FS RAMFS = FS(FSImplPtr(new ramfs_impl::RAMFSImpl()));
+#endif
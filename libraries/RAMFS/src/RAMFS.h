@@ -0,0 +1,301 @@
+/*
+    RAMFS.h - Volatile filesystem held in RAM
+    Copyright (c) 2024 Earle F. Philhower, III.  All rights reserved.
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#pragma once
+
+#include <FS.h>
+#include <FSImpl.h>
+#include <memory>
+#include <vector>
+
+using namespace fs;
+
+namespace ramfs_impl {
+
+class RAMFSFileImpl;
+class RAMFSDirImpl;
+
+class RAMFSConfig : public FSConfig {
+public:
+    static constexpr uint32_t FSId = 0x52414d46;
+    // There is never anything on a new RAMFS to format, so autoformat is off
+    RAMFSConfig(size_t maxBytes = 0) : FSConfig(FSId, false), _maxBytes(maxBytes), _realloc(::realloc), _free(::free) { }
+
+    // Limit on the total size of file contents, 0 for as much as the heap allows
+    RAMFSConfig setMaxBytes(size_t maxBytes) {
+        _maxBytes = maxBytes;
+        return *this;
+    }
+
+    // Where file contents are stored, for example an external PSRAM heap.  The
+    // directory tree itself always lives on the normal heap.
+    RAMFSConfig setAllocator(void *(*reallocFn)(void *, size_t), void (*freeFn)(void *)) {
+        _realloc = reallocFn;
+        _free = freeFn;
+        return *this;
+    }
+
+    size_t _maxBytes;
+    void *(*_realloc)(void *, size_t);
+    void (*_free)(void *);
+};
+
+// Allocator and accounting shared by all nodes, kept alive by any file still open
+// after the filesystem has been formatted or ended
+typedef struct {
+    void *(*realloc)(void *, size_t);
+    void (*free)(void *);
+    size_t used;
+    size_t limit;
+} RAMFSPool;
+
+class RAMFSNode {
+public:
+    RAMFSNode(std::shared_ptr<RAMFSPool> pool, const char *name, size_t nameLen, bool dir, RAMFSNode *parent, time_t now);
+    ~RAMFSNode();
+
+    // Makes room for at least n bytes of contents
+    bool reserve(size_t n);
+    // Truncates or zero-extends the contents
+    bool resize(size_t n);
+    std::shared_ptr<RAMFSNode> child(const char *name, size_t len) const;
+    void unlink(RAMFSNode *node);
+
+    String     name;
+    bool       dir;
+    uint8_t   *data;
+    size_t     size;
+    size_t     cap;
+    time_t     ctime;
+    time_t     mtime;
+    RAMFSNode *parent;  // nullptr for the root and removed nodes
+    std::vector<std::shared_ptr<RAMFSNode>> children;
+    std::shared_ptr<RAMFSPool> pool;
+};
+
+class RAMFSImpl : public FSImpl {
+public:
+    RAMFSImpl() : _mounted(false) { }
+    ~RAMFSImpl() override { }
+
+    FileImplPtr open(const char* path, OpenMode openMode, AccessMode accessMode) override;
+    DirImplPtr openDir(const char *path) override;
+    bool exists(const char* path) override {
+        return _mounted && path && path[0] && _lookup(path);
+    }
+    bool rename(const char* pathFrom, const char* pathTo) override;
+    bool remove(const char* path) override;
+    bool mkdir(const char* path) override;
+    bool rmdir(const char* path) override;
+    bool format() override;
+    bool info(FSInfo& info) override;
+
+    bool info64(FSInfo64& info64) override {
+        FSInfo i;
+        if (!info(i)) {
+            return false;
+        }
+        info64.blockSize     = i.blockSize;
+        info64.pageSize      = i.pageSize;
+        info64.maxOpenFiles  = i.maxOpenFiles;
+        info64.maxPathLength = i.maxPathLength;
+        info64.totalBytes    = i.totalBytes;
+        info64.usedBytes     = i.usedBytes;
+        return true;
+    }
+
+    bool setConfig(const FSConfig &cfg) override {
+        if ((cfg._type != RAMFSConfig::FSId) || _mounted) {
+            return false;
+        }
+        _cfg = *static_cast<const RAMFSConfig *>(&cfg);
+        return true;
+    }
+
+    bool begin() override;
+    // All files are freed
+    void end() override;
+
+protected:
+    friend class RAMFSFileImpl;
+    friend class RAMFSDirImpl;
+
+    time_t _now() {
+        return _timeCallback ? _timeCallback() : 0;
+    }
+    // Node for path, or nullptr.  With parent set, also returns the directory that
+    // would hold the last path component and where that component starts.
+    std::shared_ptr<RAMFSNode> _lookup(const char *path, std::shared_ptr<RAMFSNode> *parent = nullptr, const char **leaf = nullptr);
+    // Creates any missing directories leading up to the last path component
+    std::shared_ptr<RAMFSNode> _makeParents(const char *path, const char **leaf);
+
+    std::shared_ptr<RAMFSNode> _root;
+    std::shared_ptr<RAMFSPool> _pool;
+    RAMFSConfig _cfg;
+    bool        _mounted;
+};
+
+
+class RAMFSFileImpl : public FileImpl {
+public:
+    RAMFSFileImpl(RAMFSImpl *fs, const String &path, std::shared_ptr<RAMFSNode> node, AccessMode access, bool append) :
+        _fs(fs), _path(path), _node(node), _access(access), _append(append), _pos(0) { }
+
+    ~RAMFSFileImpl() override { }
+
+    size_t write(const uint8_t *buf, size_t size) override;
+    int read(uint8_t* buf, size_t size) override;
+
+    void flush() override {
+        /* NOOP, everything is already in RAM */
+    }
+
+    bool seek(uint32_t pos, SeekMode mode) override;
+
+    size_t position() const override {
+        return _node ? _pos : 0;
+    }
+
+    size_t size() const override {
+        return (_node && !_node->dir) ? _node->size : 0;
+    }
+
+    bool truncate(uint32_t size) override;
+
+    void close() override {
+        _node.reset();
+    }
+
+    // Only valid until the next write() or truncate() of this file
+    const uint8_t *mmap() override {
+        return (_node && !_node->dir) ? _node->data : nullptr;
+    }
+
+    time_t getLastWrite() override {
+        return _node ? _node->mtime : 0;
+    }
+
+    time_t getCreationTime() override {
+        return _node ? _node->ctime : 0;
+    }
+
+    const char* name() const override {
+        if (!_node) {
+            return nullptr;
+        }
+        const char *p = _path.c_str();
+        const char *slash = strrchr(p, '/');
+        return (slash && slash[1]) ? slash + 1 : p;
+    }
+
+    const char* fullName() const override {
+        return _node ? _path.c_str() : nullptr;
+    }
+
+    bool isFile() const override {
+        return _node && !_node->dir;
+    }
+
+    bool isDirectory() const override {
+        return _node && _node->dir;
+    }
+
+protected:
+    RAMFSImpl                 *_fs;
+    String                     _path;
+    std::shared_ptr<RAMFSNode> _node;
+    AccessMode                 _access;
+    bool                       _append;
+    uint32_t                   _pos;
+};
+
+
+class RAMFSDirImpl : public DirImpl {
+public:
+    // prefix is the directory path with trailing '/' ("" for root), filter an optional name prefix
+    RAMFSDirImpl(RAMFSImpl *fs, const String &prefix, std::shared_ptr<RAMFSNode> dir, const String &filter) :
+        _fs(fs), _prefix(prefix), _dir(dir), _filter(filter), _idx(-1) { }
+
+    ~RAMFSDirImpl() override { }
+
+    FileImplPtr openFile(OpenMode openMode, AccessMode accessMode) override {
+        if (!_cur) {
+            return FileImplPtr();
+        }
+        String path = _prefix + _cur->name;
+        return _fs->open(path.c_str(), openMode, accessMode);
+    }
+
+    const char* fileName() override {
+        return _cur ? _cur->name.c_str() : nullptr;
+    }
+
+    size_t fileSize() override {
+        return (_cur && !_cur->dir) ? _cur->size : 0;
+    }
+
+    time_t fileTime() override {
+        return _cur ? _cur->mtime : 0;
+    }
+
+    time_t fileCreationTime() override {
+        return _cur ? _cur->ctime : 0;
+    }
+
+    bool isFile() const override {
+        return _cur && !_cur->dir;
+    }
+
+    bool isDirectory() const override {
+        return _cur && _cur->dir;
+    }
+
+    bool rewind() override {
+        _idx = -1;
+        _cur.reset();
+        return true;
+    }
+
+    bool next() override {
+        while (++_idx < (int)_dir->children.size()) {
+            auto &c = _dir->children[_idx];
+            if (!_filter.length() || c->name.startsWith(_filter)) {
+                _cur = c;
+                return true;
+            }
+        }
+        _cur.reset();
+        return false;
+    }
+
+protected:
+    RAMFSImpl                 *_fs;
+    String                     _prefix;
+    std::shared_ptr<RAMFSNode> _dir;
+    String                     _filter;
+    std::shared_ptr<RAMFSNode> _cur;
+    int                        _idx;
+};
+
+}; // namespace ramfs_impl
+
+#if !defined(NO_GLOBAL_INSTANCES) && !defined(NO_GLOBAL_RAMFS)
+extern FS RAMFS;
+using ramfs_impl::RAMFSConfig;
+#endif
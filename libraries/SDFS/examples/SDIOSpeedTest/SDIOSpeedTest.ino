@@ -0,0 +1,65 @@
+// Sequential throughput of an SD card on the 4-bit SDIO bus
+// Released to the public domain by Earle F. Philhower, III
+
+#include <SDFS.h>
+
+// CLK, CMD, and DAT0.  DAT1-DAT3 must be the 3 GPIOs after DAT0.
+#define PIN_CLK  18
+#define PIN_CMD  19
+#define PIN_DAT0 20
+
+// How large of a file to test
+#define TESTSIZEMB 16
+
+// Large, word-aligned chunks let the driver use multi-block DMA transfers directly
+static uint32_t buff[32 * 1024 / 4];
+
+void setup() {
+  Serial.begin(115200);
+  delay(5000);
+
+  SDFSConfig cfg;
+  cfg.setSDIO(PIN_CLK, PIN_CMD, PIN_DAT0);
+  SDFS.setConfig(cfg);
+  if (!SDFS.begin()) {
+    Serial.printf("Unable to mount SD card, aborting\n");
+    return;
+  }
+
+  for (size_t i = 0; i < sizeof(buff) / 4; i++) {
+    buff[i] = i;
+  }
+
+  Serial.printf("Writing %dMB in %zuKB chunks\n", TESTSIZEMB, sizeof(buff) / 1024);
+  File f = SDFS.open("/sdiotest.bin", "w");
+  unsigned long start = millis();
+  for (size_t i = 0; i < TESTSIZEMB * 1024 * 1024 / sizeof(buff); i++) {
+    if (f.write((uint8_t *)buff, sizeof(buff)) != sizeof(buff)) {
+      Serial.printf("Write failed, aborting\n");
+      f.close();
+      return;
+    }
+  }
+  f.close();
+  unsigned long stop = millis();
+  Serial.printf("==> %0.2f MB/s\n", (float)TESTSIZEMB * 1024 * 1024 / 1000.0 / (float)(stop - start));
+
+  Serial.printf("Reading %dMB in %zuKB chunks\n", TESTSIZEMB, sizeof(buff) / 1024);
+  f = SDFS.open("/sdiotest.bin", "r");
+  start = millis();
+  for (size_t i = 0; i < TESTSIZEMB * 1024 * 1024 / sizeof(buff); i++) {
+    if (f.read((uint8_t *)buff, sizeof(buff)) != sizeof(buff)) {
+      Serial.printf("Read failed, aborting\n");
+      f.close();
+      return;
+    }
+  }
+  f.close();
+  stop = millis();
+  Serial.printf("==> %0.2f MB/s\n", (float)TESTSIZEMB * 1024 * 1024 / 1000.0 / (float)(stop - start));
+
+  SDFS.remove("/sdiotest.bin");
+}
+
+void loop() {
+}
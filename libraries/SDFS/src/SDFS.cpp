@@ -139,14 +139,44 @@ DirImplPtr SDFSImpl::openDir(const char* path) {
     return ret;
 }
 
+// SdFat only builds its own SPI cards, so mount the FAT volume directly on our SDIO card
+bool SDFSImpl::_beginSDIO() {
+    if (!_sdio) {
+        _sdio = new SDIOCard(_cfg._clkPin, _cfg._cmdPin, _cfg._dat0Pin);
+    }
+    if (!_sdio->begin(_cfg._sdioSpeed)) {
+        DEBUGV("SDFS::begin: SDIO card init failed, error %d\n", _sdio->errorCode());
+        return false;
+    }
+    _mounted = _fs.FatVolume::begin(_sdio);
+    if (!_mounted && _cfg._autoFormat) {
+        format();
+        _mounted = _fs.FatVolume::begin(_sdio);
+    }
+    FsDateTime::setCallback(dateTimeCB);
+    return _mounted;
+}
+
 bool SDFSImpl::format() {
     if (_mounted) {
         return false;
     }
-    SdCardFactory cardFactory;
-    SdCard* card = cardFactory.newCard(SdSpiConfig(_cfg._csPin, DEDICATED_SPI, _cfg._spiSettings));
-    if (!card || card->errorCode()) {
-        return false;
+    FsBlockDevice *card;
+    if (_cfg._sdio) {
+        if (!_sdio) {
+            _sdio = new SDIOCard(_cfg._clkPin, _cfg._cmdPin, _cfg._dat0Pin);
+        }
+        if (!_sdio->type() && !_sdio->begin(_cfg._sdioSpeed)) {
+            return false;
+        }
+        card = _sdio;
+    } else {
+        SdCardFactory cardFactory;
+        SdCard *spiCard = cardFactory.newCard(SdSpiConfig(_cfg._csPin, DEDICATED_SPI, _cfg._spiSettings));
+        if (!spiCard || spiCard->errorCode()) {
+            return false;
+        }
+        card = spiCard;
     }
     FatFormatter fatFormatter;
     uint8_t *sectorBuffer = new uint8_t[512];
@@ -34,6 +34,7 @@
 #include <SPI.h>
 #include <SdFat.h>
 #include <FS.h>
+#include "SDIOCard.h"
 
 using namespace fs;
 
@@ -45,7 +46,7 @@ class SDFSConfig : public FSConfig {
 public:
     static constexpr uint32_t FSId = 0x53444653;
 
-    SDFSConfig(uint8_t csPin = 4, uint32_t spi = SD_SCK_MHZ(10), HardwareSPI &port = SPI) : FSConfig(FSId, false), _csPin(csPin), _part(0), _spiSettings(spi), _spi(&port)  { }
+    SDFSConfig(uint8_t csPin = 4, uint32_t spi = SD_SCK_MHZ(10), HardwareSPI &port = SPI) : FSConfig(FSId, false), _csPin(csPin), _part(0), _spiSettings(spi), _spi(&port), _sdio(false), _clkPin(0), _cmdPin(0), _dat0Pin(0), _sdioSpeed(25000000)  { }
 
     SDFSConfig setAutoFormat(bool val = true) {
         _autoFormat = val;
@@ -67,17 +68,35 @@ public:
         _part = part;
         return *this;
     }
+    // Use a 4-bit SDIO bus instead of SPI.  DAT1-DAT3 must be the 3 GPIOs after DAT0.
+    SDFSConfig setSDIO(uint8_t clk, uint8_t cmd, uint8_t dat0, uint32_t maxHz = 25000000) {
+        _sdio = true;
+        _clkPin = clk;
+        _cmdPin = cmd;
+        _dat0Pin = dat0;
+        _sdioSpeed = maxHz;
+        return *this;
+    }
 
     // Inherit _type and _autoFormat
     uint8_t   _csPin;
     uint8_t   _part;
     uint32_t  _spiSettings;
     HardwareSPI *_spi;
+    bool      _sdio;
+    uint8_t   _clkPin;
+    uint8_t   _cmdPin;
+    uint8_t   _dat0Pin;
+    uint32_t  _sdioSpeed;
 };
 
 class SDFSImpl : public FSImpl {
 public:
-    SDFSImpl() : _mounted(false) {
+    SDFSImpl() : _mounted(false), _sdio(nullptr) {
+    }
+
+    ~SDFSImpl() {
+        delete _sdio;
     }
 
     FileImplPtr open(const char* path, OpenMode openMode, AccessMode accessMode) override;
@@ -151,6 +170,9 @@ public:
         if (_mounted) {
             return true;
         }
+        if (_cfg._sdio) {
+            return _beginSDIO();
+        }
         SdSpiConfig ssc(_cfg._csPin, SHARED_SPI, _cfg._spiSettings, _cfg._spi);
         _mounted = _fs.begin(ssc);
         if (!_mounted && _cfg._autoFormat) {
@@ -163,6 +185,9 @@ public:
 
     void end() override {
         _mounted = false;
+        if (_sdio) {
+            _sdio->end();
+        }
         // TODO
     }
 
@@ -171,7 +196,7 @@ public:
     // The following are not common FS interfaces, but are needed only to
     // support the older SD.h exports
     uint8_t type() {
-        return _fs.card()->type();
+        return (_cfg._sdio && _sdio) ? _sdio->type() : _fs.card()->type();
     }
     uint8_t fatType() {
         return _fs.vol()->fatType();
@@ -234,6 +259,7 @@ protected:
         return &_fs;
     }
 
+    bool _beginSDIO();
 
     static int _getFlags(OpenMode openMode, AccessMode accessMode) {
         int mode = 0;
@@ -259,6 +285,7 @@ protected:
     SdFat _fs;
     SDFSConfig   _cfg;
     bool         _mounted;
+    SDIOCard    *_sdio;
 };
 
 
@@ -0,0 +1,668 @@
+/*
+    SDIOCard.cpp - PIO+DMA 4-bit SDIO host for SdFat
+    Copyright (c) 2024 Earle F. Philhower, III.  All rights reserved.
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include "SDIOCard.h"
+#include <algorithm>
+#include <hardware/clocks.h>
+#include <hardware/dma.h>
+#include <hardware/gpio.h>
+#include "sdio.pio.h"
+
+namespace sdfs {
+
+// Response length handed to the PIO, in bits after the start bit less one
+#define SDIO_RESP_NONE 0
+#define SDIO_RESP_48   46
+#define SDIO_RESP_136  134
+
+// Data plus CRC16 nibbles in one 512 byte block, less one, for the PIO loop counters
+#define SDIO_BLOCK_NIBBLES (512 * 2 + 16 - 1)
+
+#define SDIO_CMD_TIMEOUT_US   10000
+#define SDIO_READ_TIMEOUT_MS  100
+#define SDIO_WRITE_TIMEOUT_MS 500
+#define SDIO_ERASE_TIMEOUT_MS 10000
+#define SDIO_INIT_TIMEOUT_MS  1000
+
+// R1 card status bits which indicate a failed command
+#define SDIO_R1_ERRORS 0xfdf98008
+
+// Per-block start token for the TX PIO, byte swapped because the data DMA swaps everything
+static uint32_t _txToken = __builtin_bswap32(SDIO_BLOCK_NIBBLES);
+
+static uint8_t _crc7(uint64_t v, int bits) {
+    uint8_t crc = 0;
+    for (int i = bits - 1; i >= 0; i--) {
+        uint8_t fb = ((v >> i) & 1) ^ (crc >> 6);
+        crc = (crc << 1) & 0x7f;
+        if (fb) {
+            crc ^= 0x09;
+        }
+    }
+    return crc;
+}
+
+// CRC16 of each of the 4 data lines in parallel.  Bit n of line L is kept at bit
+// 4*n+L of the accumulator, which turns the usual byte-wise CCITT update into a
+// word-wise one with every shift multiplied by 4.  The result is the 64 CRC bits
+// in the order they go over the bus.  The DMA sniffer can't help here because it
+// only knows how to CRC the whole byte stream, not each line on its own.
+static uint64_t __not_in_flash_func(_crc16x4)(const uint32_t *buf, int words) {
+    uint64_t crc = 0;
+    for (int i = 0; i < words; i++) {
+        uint32_t x = (uint32_t)(crc >> 32) ^ __builtin_bswap32(buf[i]);
+        x ^= x >> 16;
+        crc = (crc << 32) ^ ((uint64_t)x << 48) ^ ((uint64_t)x << 20) ^ x;
+    }
+    return crc;
+}
+
+SDIOCard::SDIOCard(uint8_t clk, uint8_t cmd, uint8_t dat0) {
+    _clk = clk;
+    _cmdPin = cmd;
+    _d0 = dat0;
+    _type = 0;
+    _err = SDIO_OK;
+    _errData = 0;
+    _hz = 0;
+    _rca = 0;
+    _ocr = 0;
+    memset(_cid, 0, sizeof(_cid));
+    memset(_csd, 0, sizeof(_csd));
+    _pio = nullptr;
+    _pioRx = nullptr;
+    _smCmd = _smTx = _smRx = -1;
+    _offCmd = _offTx = _offRx = -1;
+    _dmaData = _dmaCtrl = -1;
+}
+
+SDIOCard::~SDIOCard() {
+    end();
+}
+
+bool SDIOCard::_error(uint8_t err, uint32_t data) {
+    DEBUGV("SDIO: error %d, data 0x%08lx\n", err, data);
+    _err = err;
+    _errData = data;
+    return false;
+}
+
+bool SDIOCard::_loadPrograms() {
+    // The data programs need the CLK GPIO baked into their WAITs
+    memcpy(_txInsn, sdio_data_tx_program_instructions, sizeof(_txInsn));
+    _txInsn[1] = pio_encode_wait_gpio(true, _clk);
+    _txInsn[2] = pio_encode_wait_gpio(false, _clk);
+    _txPgm = sdio_data_tx_program;
+    _txPgm.instructions = _txInsn;
+    memcpy(_rxInsn, sdio_data_rx_program_instructions, sizeof(_rxInsn));
+    _rxInsn[1] = _rxInsn[4] = pio_encode_wait_gpio(false, _clk);
+    _rxInsn[2] = _rxInsn[5] = pio_encode_wait_gpio(true, _clk);
+    _rxPgm = sdio_data_rx_program;
+    _rxPgm.instructions = _rxInsn;
+
+    PIO pi[2] = { pio0, pio1 };
+    for (int i = 0; (i < 2) && !_pio; i++) {
+        if (!pio_can_add_program(pi[i], &sdio_cmd_clk_program)) {
+            continue;
+        }
+        int smc = pio_claim_unused_sm(pi[i], false);
+        if (smc < 0) {
+            continue;
+        }
+        int smt = pio_claim_unused_sm(pi[i], false);
+        if (smt < 0) {
+            pio_sm_unclaim(pi[i], smc);
+            continue;
+        }
+        int off = pio_add_program(pi[i], &sdio_cmd_clk_program);
+        if (!pio_can_add_program(pi[i], &_txPgm)) {
+            pio_remove_program(pi[i], &sdio_cmd_clk_program, off);
+            pio_sm_unclaim(pi[i], smc);
+            pio_sm_unclaim(pi[i], smt);
+            continue;
+        }
+        _offCmd = off;
+        _offTx = pio_add_program(pi[i], &_txPgm);
+        _smCmd = smc;
+        _smTx = smt;
+        _pio = pi[i];
+    }
+    if (!_pio) {
+        return false;
+    }
+    for (int i = 0; (i < 2) && !_pioRx; i++) {
+        if (!pio_can_add_program(pi[i], &_rxPgm)) {
+            continue;
+        }
+        int sm = pio_claim_unused_sm(pi[i], false);
+        if (sm >= 0) {
+            _offRx = pio_add_program(pi[i], &_rxPgm);
+            _smRx = sm;
+            _pioRx = pi[i];
+        }
+    }
+    _dmaData = dma_claim_unused_channel(false);
+    _dmaCtrl = dma_claim_unused_channel(false);
+    if (!_pioRx || (_dmaData < 0) || (_dmaCtrl < 0)) {
+        _unloadPrograms();
+        return false;
+    }
+    return true;
+}
+
+void SDIOCard::_unloadPrograms() {
+    if (_pio) {
+        pio_set_sm_mask_enabled(_pio, (1u << _smCmd) | (1u << _smTx), false);
+        pio_remove_program(_pio, &sdio_cmd_clk_program, _offCmd);
+        pio_remove_program(_pio, &_txPgm, _offTx);
+        pio_sm_unclaim(_pio, _smCmd);
+        pio_sm_unclaim(_pio, _smTx);
+        _pio = nullptr;
+    }
+    if (_pioRx) {
+        pio_sm_set_enabled(_pioRx, _smRx, false);
+        pio_remove_program(_pioRx, &_rxPgm, _offRx);
+        pio_sm_unclaim(_pioRx, _smRx);
+        _pioRx = nullptr;
+    }
+    if (_dmaData >= 0) {
+        dma_channel_unclaim(_dmaData);
+        _dmaData = -1;
+    }
+    if (_dmaCtrl >= 0) {
+        dma_channel_unclaim(_dmaCtrl);
+        _dmaCtrl = -1;
+    }
+}
+
+// Put CMD/CLK and TX back at their start, lines released, with clock dividers in phase
+void SDIOCard::_resetCmd() {
+    uint32_t mask = (1u << _smCmd) | (1u << _smTx);
+    pio_set_sm_mask_enabled(_pio, mask, false);
+    pio_sm_clear_fifos(_pio, _smCmd);
+    pio_sm_restart(_pio, _smCmd);
+    pio_sm_exec(_pio, _smCmd, pio_encode_set(pio_pindirs, 0));
+    pio_sm_exec(_pio, _smCmd, pio_encode_jmp(_offCmd));
+    pio_sm_clear_fifos(_pio, _smTx);
+    pio_sm_restart(_pio, _smTx);
+    pio_sm_exec(_pio, _smTx, pio_encode_set(pio_pindirs, 0));
+    pio_sm_exec(_pio, _smTx, pio_encode_set(pio_pins, 0xf));
+    pio_sm_exec(_pio, _smTx, pio_encode_jmp(_offTx));
+    pio_enable_sm_mask_in_sync(_pio, mask);
+}
+
+void SDIOCard::_setClock(uint32_t hz) {
+    // Each PIO cycle is half an SD clock.  The TX program needs at least 3 system
+    // clocks per PIO cycle so its CLK WAITs see the edge before the next cycle.
+    uint32_t sys = clock_get_hz(clk_sys);
+    uint32_t div = (sys + 2 * hz - 1) / (2 * hz);
+    div = std::max(div, (uint32_t)3);
+    div = std::min(div, (uint32_t)0xffff);
+    _hz = sys / (2 * div);
+    pio_sm_set_clkdiv_int_frac(_pio, _smCmd, div, 0);
+    pio_sm_set_clkdiv_int_frac(_pio, _smTx, div, 0);
+    _resetCmd();
+}
+
+bool SDIOCard::_cmd(uint8_t idx, uint32_t arg, uint8_t respBits, uint32_t *resp) {
+    uint64_t c = (1ULL << 46) | ((uint64_t)(idx & 0x3f) << 40) | ((uint64_t)arg << 8);
+    c |= (_crc7(c >> 8, 40) << 1) | 1;
+    pio_sm_put(_pio, _smCmd, (47u << 24) | (uint32_t)(c >> 24));
+    pio_sm_put(_pio, _smCmd, ((uint32_t)c << 8) | respBits);
+    if (respBits == SDIO_RESP_NONE) {
+        // Nothing comes back, so just give the PIO time to clock it all out
+        busy_wait_us_32(1 + (80 * 1000000) / _hz);
+        return true;
+    }
+
+    uint32_t w[5];
+    int words = (respBits == SDIO_RESP_136) ? 5 : 2;
+    uint32_t start = time_us_32();
+    for (int i = 0; i < words; i++) {
+        while (pio_sm_is_rx_fifo_empty(_pio, _smCmd)) {
+            if (time_us_32() - start > SDIO_CMD_TIMEOUT_US) {
+                _resetCmd(); // PIO is stuck waiting for a start bit
+                return _error(SDIO_ERR_CMD_TIMEOUT, idx);
+            }
+        }
+        w[i] = pio_sm_get(_pio, _smCmd);
+    }
+
+    if (respBits == SDIO_RESP_136) {
+        // R2, return register bits 127..0.  The register carries its own CRC7 we don't check.
+        if (resp) {
+            for (int i = 0; i < 4; i++) {
+                resp[i] = (w[i] << 7) | ((i < 3) ? (w[i + 1] >> 25) : (w[4] & 0x7f));
+            }
+        }
+        return true;
+    }
+
+    // 47 bits from the transmission bit to the end bit, the final 15 right justified
+    uint64_t r = ((uint64_t)w[0] << 15) | (w[1] & 0x7fff);
+    // R3 (ACMD41) has neither an index nor a CRC
+    if ((idx != 41) && ((((r >> 40) & 0x3f) != idx) || (((r >> 1) & 0x7f) != _crc7(r >> 8, 40)))) {
+        return _error(SDIO_ERR_CMD_CRC, idx);
+    }
+    if (resp) {
+        *resp = (uint32_t)(r >> 8);
+    }
+    return true;
+}
+
+bool SDIOCard::_acmd(uint8_t idx, uint32_t arg, uint8_t respBits, uint32_t *resp) {
+    return _cmd(55, _rca << 16, SDIO_RESP_48) && _cmd(idx, arg, respBits, resp);
+}
+
+bool SDIOCard::_waitBusy(uint32_t ms) {
+    uint32_t start = millis();
+    while (!gpio_get(_d0)) {
+        if (millis() - start > ms) {
+            return _error(SDIO_ERR_BUSY_TIMEOUT, 0);
+        }
+    }
+    return true;
+}
+
+bool SDIOCard::begin(uint32_t maxHz) {
+    end();
+    _err = SDIO_OK;
+    _errData = 0;
+    _type = 0;
+    _rca = 0;
+    if (!_loadPrograms()) {
+        return _error(SDIO_ERR_RESOURCES, 0);
+    }
+
+    pio_gpio_init(_pio, _clk);
+    pio_gpio_init(_pio, _cmdPin);
+    gpio_pull_up(_cmdPin);
+    for (int i = 0; i < 4; i++) {
+        pio_gpio_init(_pio, _d0 + i);
+        gpio_pull_up(_d0 + i);
+    }
+
+    pio_sm_config c = sdio_cmd_clk_program_get_default_config(_offCmd);
+    sm_config_set_sideset_pins(&c, _clk);
+    sm_config_set_out_pins(&c, _cmdPin, 1);
+    sm_config_set_set_pins(&c, _cmdPin, 1);
+    sm_config_set_in_pins(&c, _cmdPin);
+    sm_config_set_jmp_pin(&c, _cmdPin);
+    sm_config_set_out_shift(&c, false, true, 32);
+    sm_config_set_in_shift(&c, false, true, 32);
+    sm_config_set_mov_status(&c, STATUS_TX_LESSTHAN, 1);
+    pio_sm_init(_pio, _smCmd, _offCmd, &c);
+    pio_sm_set_pins_with_mask(_pio, _smCmd, 1u << _cmdPin, (1u << _cmdPin) | (1u << _clk));
+    pio_sm_set_pindirs_with_mask(_pio, _smCmd, 1u << _clk, (1u << _cmdPin) | (1u << _clk));
+
+    c = sdio_data_tx_program_get_default_config(_offTx);
+    sm_config_set_out_pins(&c, _d0, 4);
+    sm_config_set_set_pins(&c, _d0, 4);
+    sm_config_set_in_pins(&c, _d0);
+    sm_config_set_jmp_pin(&c, _d0);
+    sm_config_set_out_shift(&c, false, true, 32);
+    sm_config_set_in_shift(&c, false, false, 32);
+    pio_sm_init(_pio, _smTx, _offTx, &c);
+
+    c = sdio_data_rx_program_get_default_config(_offRx);
+    sm_config_set_in_pins(&c, _d0);
+    sm_config_set_jmp_pin(&c, _d0);
+    sm_config_set_in_shift(&c, false, true, 32);
+    pio_sm_init(_pioRx, _smRx, _offRx, &c);
+
+    _setClock(400000);
+    delay(1); // At least 74 clocks before the first command
+
+    if (!_identify()) {
+        end();
+        return false;
+    }
+    _setClock(maxHz);
+    return true;
+}
+
+// Card identification and switch to 4-bit transfer mode, all at 400KHz
+bool SDIOCard::_identify() {
+    uint32_t r;
+    uint32_t reg[4];
+
+    _cmd(0, 0, SDIO_RESP_NONE);
+    // SD v1 cards don't answer CMD8 at all
+    bool v2 = _cmd(8, 0x1aa, SDIO_RESP_48, &r) && ((r & 0xfff) == 0x1aa);
+    _err = SDIO_OK;
+    uint32_t start = millis();
+    do {
+        if (millis() - start > SDIO_INIT_TIMEOUT_MS) {
+            return _error(SDIO_ERR_INIT, _ocr);
+        }
+        if (!_acmd(41, (v2 ? 0x40000000 : 0) | 0x00ff8000, SDIO_RESP_48, &_ocr)) {
+            return false;
+        }
+    } while (!(_ocr & 0x80000000));
+    if (!v2) {
+        _type = SD_CARD_TYPE_SD1;
+    } else {
+        _type = (_ocr & 0x40000000) ? SD_CARD_TYPE_SDHC : SD_CARD_TYPE_SD2;
+    }
+
+    if (!_cmd(2, 0, SDIO_RESP_136, reg)) {
+        return false;
+    }
+    for (int i = 0; i < 16; i++) {
+        _cid[i] = reg[i / 4] >> (24 - 8 * (i % 4));
+    }
+    if (!_cmd(3, 0, SDIO_RESP_48, &r)) {
+        return false;
+    }
+    _rca = r >> 16;
+    if (!_cmd(9, _rca << 16, SDIO_RESP_136, reg)) {
+        return false;
+    }
+    for (int i = 0; i < 16; i++) {
+        _csd[i] = reg[i / 4] >> (24 - 8 * (i % 4));
+    }
+    if (!_cmd(7, _rca << 16, SDIO_RESP_48) || !_waitBusy(SDIO_WRITE_TIMEOUT_MS)) {
+        return false;
+    }
+    if (!_acmd(6, 2, SDIO_RESP_48)) { // 4-bit bus
+        return false;
+    }
+    if ((_type != SD_CARD_TYPE_SDHC) && !_cmd(16, 512, SDIO_RESP_48)) {
+        return false;
+    }
+    return true;
+}
+
+void SDIOCard::end() {
+    if (_pio) {
+        pio_sm_set_pindirs_with_mask(_pio, _smCmd, 0, (1u << _cmdPin) | (1u << _clk));
+        pio_sm_set_pindirs_with_mask(_pio, _smTx, 0, 0xfu << _d0);
+    }
+    if (_dmaData >= 0) {
+        dma_channel_abort(_dmaCtrl);
+        dma_channel_abort(_dmaData);
+    }
+    _unloadPrograms();
+    _type = 0;
+}
+
+uint32_t SDIOCard::_csdBits(int hi, int lo) const {
+    uint32_t v = 0;
+    for (int b = hi; b >= lo; b--) {
+        v = (v << 1) | ((_csd[15 - b / 8] >> (b % 8)) & 1);
+    }
+    return v;
+}
+
+uint32_t SDIOCard::sectorCount() {
+    if ((_csd[0] >> 6) == 1) {
+        // CSD v2, SDHC/SDXC
+        return (_csdBits(69, 48) + 1) << 10;
+    }
+    uint32_t size = _csdBits(73, 62);
+    uint32_t mult = _csdBits(49, 47);
+    uint32_t blockLen = _csdBits(83, 80);
+    return (size + 1) << (mult + 2 + blockLen - 9);
+}
+
+bool SDIOCard::readCID(cid_t *cid) {
+    memcpy(cid, _cid, sizeof(_cid));
+    return true;
+}
+
+bool SDIOCard::readCSD(csd_t *csd) {
+    memcpy(csd, _csd, sizeof(_csd));
+    return true;
+}
+
+bool SDIOCard::readOCR(uint32_t *ocr) {
+    *ocr = _ocr;
+    return true;
+}
+
+bool SDIOCard::isBusy() {
+    return _pio && !gpio_get(_d0);
+}
+
+uint32_t SDIOCard::status() {
+    uint32_t st;
+    return (_pio && _cmd(13, _rca << 16, SDIO_RESP_48, &st)) ? st : 0xffffffff;
+}
+
+bool SDIOCard::syncDevice() {
+    return _pio && _waitBusy(SDIO_WRITE_TIMEOUT_MS);
+}
+
+bool SDIOCard::erase(uint32_t firstSector, uint32_t lastSector) {
+    if (!_pio || !_waitBusy(SDIO_WRITE_TIMEOUT_MS)) {
+        return false;
+    }
+    uint32_t st;
+    if (!_cmd(32, _addr(firstSector), SDIO_RESP_48) || !_cmd(33, _addr(lastSector), SDIO_RESP_48) ||
+            !_cmd(38, 0, SDIO_RESP_48, &st)) {
+        return false;
+    }
+    if (st & SDIO_R1_ERRORS) {
+        return _error(SDIO_ERR_CMD_STATUS, st);
+    }
+    return _waitBusy(SDIO_ERASE_TIMEOUT_MS);
+}
+
+bool SDIOCard::readSectors(uint32_t sector, uint8_t *dst, size_t ns) {
+    if (!_pio) {
+        return false;
+    }
+    if ((uint32_t)dst & 3) {
+        // DMA needs whole words, so bounce unaligned buffers a sector at a time
+        for (size_t i = 0; i < ns; i++) {
+            if (!_readBlocks(sector + i, _bounce, 1)) {
+                return false;
+            }
+            memcpy(dst + i * 512, _bounce, 512);
+        }
+        return true;
+    }
+    while (ns) {
+        size_t n = std::min(ns, (size_t)SDIO_MAX_BLOCKS);
+        if (!_readBlocks(sector, (uint32_t *)dst, n)) {
+            return false;
+        }
+        sector += n;
+        dst += n * 512;
+        ns -= n;
+    }
+    return true;
+}
+
+bool SDIOCard::writeSectors(uint32_t sector, const uint8_t *src, size_t ns) {
+    if (!_pio) {
+        return false;
+    }
+    if ((uint32_t)src & 3) {
+        for (size_t i = 0; i < ns; i++) {
+            memcpy(_bounce, src + i * 512, 512);
+            if (!_writeBlocks(sector + i, _bounce, 1)) {
+                return false;
+            }
+        }
+        return true;
+    }
+    while (ns) {
+        size_t n = std::min(ns, (size_t)SDIO_MAX_BLOCKS);
+        if (!_writeBlocks(sector, (const uint32_t *)src, n)) {
+            return false;
+        }
+        sector += n;
+        src += n * 512;
+        ns -= n;
+    }
+    return true;
+}
+
+// The data channel moves one run of words between the PIO and memory.  The control
+// channel feeds it {address, count} pairs from _ctrl through a 2-register write ring,
+// and the data channel chains back to it after every run.  A zero pair ends the chain.
+bool SDIOCard::_readBlocks(uint32_t sector, uint32_t *dst, size_t n) {
+    if (!_waitBusy(SDIO_WRITE_TIMEOUT_MS)) {
+        return false;
+    }
+    uint32_t *cb = _ctrl;
+    for (size_t i = 0; i < n; i++) {
+        *cb++ = (uint32_t)(dst + i * 128);
+        *cb++ = 128;
+        *cb++ = (uint32_t)&_crc[2 * i];
+        *cb++ = 2;
+    }
+    *cb++ = 0;
+    *cb++ = 0;
+
+    // Arm the receiver before the command goes out so the first start bit can't be missed
+    pio_sm_set_enabled(_pioRx, _smRx, false);
+    pio_sm_clear_fifos(_pioRx, _smRx);
+    pio_sm_restart(_pioRx, _smRx);
+    pio_sm_put(_pioRx, _smRx, SDIO_BLOCK_NIBBLES);
+    pio_sm_exec(_pioRx, _smRx, pio_encode_pull(false, true));
+    pio_sm_exec(_pioRx, _smRx, pio_encode_mov(pio_y, pio_osr));
+    pio_sm_exec(_pioRx, _smRx, pio_encode_jmp(_offRx));
+
+    dma_channel_config c = dma_channel_get_default_config(_dmaData);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_32);
+    channel_config_set_read_increment(&c, false);
+    channel_config_set_write_increment(&c, true);
+    channel_config_set_dreq(&c, pio_get_dreq(_pioRx, _smRx, false));
+    channel_config_set_bswap(&c, true);
+    channel_config_set_chain_to(&c, _dmaCtrl);
+    dma_channel_configure(_dmaData, &c, nullptr, &_pioRx->rxf[_smRx], 0, false);
+
+    c = dma_channel_get_default_config(_dmaCtrl);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_32);
+    channel_config_set_read_increment(&c, true);
+    channel_config_set_write_increment(&c, true);
+    channel_config_set_ring(&c, true, 3);
+    dma_channel_configure(_dmaCtrl, &c, &dma_hw->ch[_dmaData].al1_write_addr, _ctrl, 2, true);
+
+    pio_sm_set_enabled(_pioRx, _smRx, true);
+    uint32_t st;
+    bool ok = _cmd((n == 1) ? 17 : 18, _addr(sector), SDIO_RESP_48, &st);
+    if (ok && (st & SDIO_R1_ERRORS)) {
+        ok = _error(SDIO_ERR_CMD_STATUS, st);
+    }
+
+    // Check each sector's CRC as soon as it lands, overlapping the next one's transfer.
+    // The control channel only fetches pair N+1 once run N is done.
+    size_t checked = 0;
+    uint32_t last = millis();
+    while (ok && (checked < n)) {
+        int runs = (int)(((uint32_t *)dma_hw->ch[_dmaCtrl].read_addr - _ctrl) / 2) - 1;
+        while ((runs > 0) && (checked < (size_t)runs / 2)) {
+            uint64_t want = ((uint64_t)__builtin_bswap32(_crc[2 * checked]) << 32) | __builtin_bswap32(_crc[2 * checked + 1]);
+            if (_crc16x4(dst + checked * 128, 128) != want) {
+                ok = _error(SDIO_ERR_READ_CRC, sector + checked);
+                break;
+            }
+            checked++;
+            last = millis();
+        }
+        if (ok && (checked < n) && (millis() - last > SDIO_READ_TIMEOUT_MS)) {
+            ok = _error(SDIO_ERR_READ_TIMEOUT, sector + checked);
+        }
+    }
+
+    pio_sm_set_enabled(_pioRx, _smRx, false);
+    dma_channel_abort(_dmaCtrl);
+    dma_channel_abort(_dmaData);
+    // CMD12 may flag OUT_OF_RANGE after reading the last sector, so ignore its status
+    if ((n > 1) && !_cmd(12, 0, SDIO_RESP_48)) {
+        ok = false;
+    }
+    return _waitBusy(SDIO_WRITE_TIMEOUT_MS) && ok;
+}
+
+bool SDIOCard::_writeBlocks(uint32_t sector, const uint32_t *src, size_t n) {
+    if (!_waitBusy(SDIO_WRITE_TIMEOUT_MS)) {
+        return false;
+    }
+    uint32_t *cb = _ctrl;
+    for (size_t i = 0; i < n; i++) {
+        uint64_t crc = _crc16x4(src + i * 128, 128);
+        _crc[2 * i] = __builtin_bswap32((uint32_t)(crc >> 32));
+        _crc[2 * i + 1] = __builtin_bswap32((uint32_t)crc);
+        *cb++ = 1;
+        *cb++ = (uint32_t)&_txToken;
+        *cb++ = 128;
+        *cb++ = (uint32_t)(src + i * 128);
+        *cb++ = 2;
+        *cb++ = (uint32_t)&_crc[2 * i];
+    }
+    *cb++ = 0;
+    *cb++ = 0;
+
+    uint32_t st;
+    if (!_cmd((n == 1) ? 24 : 25, _addr(sector), SDIO_RESP_48, &st)) {
+        return false;
+    }
+    if (st & SDIO_R1_ERRORS) {
+        return _error(SDIO_ERR_CMD_STATUS, st);
+    }
+
+    dma_channel_config c = dma_channel_get_default_config(_dmaData);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_32);
+    channel_config_set_read_increment(&c, true);
+    channel_config_set_write_increment(&c, false);
+    channel_config_set_dreq(&c, pio_get_dreq(_pio, _smTx, true));
+    channel_config_set_bswap(&c, true);
+    channel_config_set_chain_to(&c, _dmaCtrl);
+    dma_channel_configure(_dmaData, &c, &_pio->txf[_smTx], nullptr, 0, false);
+
+    c = dma_channel_get_default_config(_dmaCtrl);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_32);
+    channel_config_set_read_increment(&c, true);
+    channel_config_set_write_increment(&c, true);
+    channel_config_set_ring(&c, true, 3);
+    dma_channel_configure(_dmaCtrl, &c, &dma_hw->ch[_dmaData].al3_transfer_count, _ctrl, 2, true);
+
+    // The TX PIO reports each block's CRC status token only after the card's busy ends
+    bool ok = true;
+    for (size_t i = 0; ok && (i < n); i++) {
+        uint32_t start = millis();
+        while (ok && pio_sm_is_rx_fifo_empty(_pio, _smTx)) {
+            if (millis() - start > SDIO_WRITE_TIMEOUT_MS) {
+                ok = _error(SDIO_ERR_WRITE_TIMEOUT, sector + i);
+            }
+        }
+        if (ok) {
+            uint32_t token = pio_sm_get(_pio, _smTx) & 7;
+            if (token != 2) {
+                ok = _error(SDIO_ERR_WRITE_CRC, token);
+            }
+        }
+    }
+
+    dma_channel_abort(_dmaCtrl);
+    dma_channel_abort(_dmaData);
+    if (!ok) {
+        _resetCmd(); // TX may have stopped mid-block
+    }
+    if ((n > 1) && !_cmd(12, 0, SDIO_RESP_48)) {
+        ok = false;
+    }
+    return _waitBusy(SDIO_WRITE_TIMEOUT_MS) && ok;
+}
+
+}; // namespace sdfs
@@ -0,0 +1,142 @@
+/*
+    SDIOCard.h - PIO+DMA 4-bit SDIO host for SdFat
+    Copyright (c) 2024 Earle F. Philhower, III.  All rights reserved.
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#pragma once
+
+#include <Arduino.h>
+#include <SdFat.h>
+#include <hardware/pio.h>
+
+namespace sdfs {
+
+// Largest run of sectors handled by one CMD18/CMD25.  Longer requests are split.
+#define SDIO_MAX_BLOCKS 32
+
+// SD card block device using a 4-bit SDIO bus generated by PIO.  CLK, CMD and
+// DAT0 may be any GPIOs, DAT1-DAT3 must follow DAT0.  Data moves by DMA with the
+// per-line CRC16 checked/generated on the CPU.  Two PIO state machines and the
+// instruction memory for CMD/CLK and data transmit (31 instructions) must be
+// free in one PIO, plus one more SM and 8 instructions in either PIO.
+class SDIOCard : public SdCardInterface {
+public:
+    SDIOCard(uint8_t clk, uint8_t cmd, uint8_t dat0);
+    ~SDIOCard();
+
+    bool begin(uint32_t maxHz = 25000000);
+    void end() override;
+
+    bool erase(uint32_t firstSector, uint32_t lastSector) override;
+    uint8_t errorCode() const override {
+        return _err;
+    }
+    uint32_t errorData() const override {
+        return _errData;
+    }
+    bool isBusy() override;
+    bool readCID(cid_t *cid) override;
+    bool readCSD(csd_t *csd) override;
+    bool readOCR(uint32_t *ocr) override;
+    bool readSector(uint32_t sector, uint8_t *dst) override {
+        return readSectors(sector, dst, 1);
+    }
+    bool readSectors(uint32_t sector, uint8_t *dst, size_t ns) override;
+    uint32_t sectorCount() override;
+    uint32_t status() override;
+    bool syncDevice() override;
+    uint8_t type() const override {
+        return _type;
+    }
+    bool writeSector(uint32_t sector, const uint8_t *src) override {
+        return writeSectors(sector, src, 1);
+    }
+    bool writeSectors(uint32_t sector, const uint8_t *src, size_t ns) override;
+
+    // Actual SD clock after begin()
+    uint32_t clock() const {
+        return _hz;
+    }
+
+    // errorCode() values
+    enum {
+        SDIO_OK = 0,
+        SDIO_ERR_RESOURCES,   // No free PIO SMs, instruction memory, or DMA channels
+        SDIO_ERR_CMD_TIMEOUT, // errorData() = command index
+        SDIO_ERR_CMD_CRC,     // errorData() = command index
+        SDIO_ERR_CMD_STATUS,  // errorData() = R1 card status
+        SDIO_ERR_INIT,        // Card never left the idle state
+        SDIO_ERR_READ_TIMEOUT,
+        SDIO_ERR_READ_CRC,    // errorData() = sector
+        SDIO_ERR_WRITE_TIMEOUT,
+        SDIO_ERR_WRITE_CRC,   // errorData() = CRC status token
+        SDIO_ERR_BUSY_TIMEOUT,
+    };
+
+private:
+    bool _cmd(uint8_t idx, uint32_t arg, uint8_t respBits, uint32_t *resp = nullptr);
+    bool _acmd(uint8_t idx, uint32_t arg, uint8_t respBits, uint32_t *resp = nullptr);
+    bool _waitBusy(uint32_t ms);
+    bool _readBlocks(uint32_t sector, uint32_t *dst, size_t n);
+    bool _writeBlocks(uint32_t sector, const uint32_t *src, size_t n);
+    bool _loadPrograms();
+    void _unloadPrograms();
+    void _resetCmd();
+    void _setClock(uint32_t hz);
+    bool _identify();
+    bool _error(uint8_t err, uint32_t data);
+    uint32_t _csdBits(int hi, int lo) const;
+    // SDSC cards are byte addressed, SDHC/SDXC are sector addressed
+    uint32_t _addr(uint32_t sector) const {
+        return (_type == SD_CARD_TYPE_SDHC) ? sector : sector << 9;
+    }
+
+    uint8_t  _clk;
+    uint8_t  _cmdPin;
+    uint8_t  _d0;
+    uint8_t  _type;
+    uint8_t  _err;
+    uint32_t _errData;
+    uint32_t _hz;
+    uint32_t _rca;
+    uint32_t _ocr;
+    uint8_t  _cid[16];
+    uint8_t  _csd[16];
+
+    // CMD/CLK and TX share _pio so they can run in lock-step, RX may be elsewhere
+    PIO      _pio;
+    PIO      _pioRx;
+    int      _smCmd;
+    int      _smTx;
+    int      _smRx;
+    int      _offCmd;
+    int      _offTx;
+    int      _offRx;
+    int      _dmaData;
+    int      _dmaCtrl;
+    uint16_t _txInsn[15];
+    uint16_t _rxInsn[8];
+    pio_program_t _txPgm;
+    pio_program_t _rxPgm;
+
+    // DMA control blocks, one {addr/count} pair per transfer plus a null terminator
+    uint32_t _ctrl[2 * (3 * SDIO_MAX_BLOCKS + 1)];
+    uint32_t _crc[2 * SDIO_MAX_BLOCKS];
+    uint32_t _bounce[128];
+};
+
+}; // namespace sdfs
@@ -0,0 +1,128 @@
+// -------------------------------------------------- //
+// This file is autogenerated by pioasm; do not edit! //
+// -------------------------------------------------- //
+
+#pragma once
+
+#if !PICO_NO_HARDWARE
+#include "hardware/pio.h"
+#endif
+
+// ------------ //
+// sdio_cmd_clk //
+// ------------ //
+
+#define sdio_cmd_clk_wrap_target 0
+#define sdio_cmd_clk_wrap 15
+
+static const uint16_t sdio_cmd_clk_program_instructions[] = {
+    //     .wrap_target
+    0xb04d, //  0: mov    y, !status      side 1
+    0x0060, //  1: jmp    !y, 0           side 0
+    0x7028, //  2: out    x, 8            side 1
+    0xe081, //  3: set    pindirs, 1      side 0
+    0xb042, //  4: nop                    side 1
+    0x6001, //  5: out    pins, 1         side 0
+    0x1045, //  6: jmp    x--, 5          side 1
+    0xe080, //  7: set    pindirs, 0      side 0
+    0x7028, //  8: out    x, 8            side 1
+    0x0020, //  9: jmp    !x, 0           side 0
+    0xb042, // 10: nop                    side 1
+    0x00ca, // 11: jmp    pin, 10         side 0
+    0xb042, // 12: nop                    side 1
+    0x4001, // 13: in     pins, 1         side 0
+    0x104d, // 14: jmp    x--, 13         side 1
+    0x8020, // 15: push   block           side 0
+    //     .wrap
+};
+
+#if !PICO_NO_HARDWARE
+static const struct pio_program sdio_cmd_clk_program = {
+    .instructions = sdio_cmd_clk_program_instructions,
+    .length = 16,
+    .origin = -1,
+};
+
+static inline pio_sm_config sdio_cmd_clk_program_get_default_config(uint offset) {
+    pio_sm_config c = pio_get_default_sm_config();
+    sm_config_set_wrap(&c, offset + sdio_cmd_clk_wrap_target, offset + sdio_cmd_clk_wrap);
+    sm_config_set_sideset(&c, 1, false, false);
+    return c;
+}
+#endif
+
+// ------------ //
+// sdio_data_tx //
+// ------------ //
+
+#define sdio_data_tx_wrap_target 0
+#define sdio_data_tx_wrap 14
+
+static const uint16_t sdio_data_tx_program_instructions[] = {
+    //     .wrap_target
+    0x6020, //  0: out    x, 32
+    0x2080, //  1: wait   1 gpio, 0
+    0x2000, //  2: wait   0 gpio, 0
+    0xe18f, //  3: set    pindirs, 15            [1]
+    0xe100, //  4: set    pins, 0                [1]
+    0x6004, //  5: out    pins, 4
+    0x0045, //  6: jmp    x--, 5
+    0xe10f, //  7: set    pins, 15               [1]
+    0xe180, //  8: set    pindirs, 0             [1]
+    0x01c9, //  9: jmp    pin, 9                 [1]
+    0x4101, // 10: in     pins, 1                [1]
+    0x4101, // 11: in     pins, 1                [1]
+    0x4701, // 12: in     pins, 1                [7]
+    0x20a0, // 13: wait   1 pin, 0
+    0x8020, // 14: push   block
+    //     .wrap
+};
+
+#if !PICO_NO_HARDWARE
+static const struct pio_program sdio_data_tx_program = {
+    .instructions = sdio_data_tx_program_instructions,
+    .length = 15,
+    .origin = -1,
+};
+
+static inline pio_sm_config sdio_data_tx_program_get_default_config(uint offset) {
+    pio_sm_config c = pio_get_default_sm_config();
+    sm_config_set_wrap(&c, offset + sdio_data_tx_wrap_target, offset + sdio_data_tx_wrap);
+    return c;
+}
+#endif
+
+// ------------ //
+// sdio_data_rx //
+// ------------ //
+
+#define sdio_data_rx_wrap_target 0
+#define sdio_data_rx_wrap 7
+
+static const uint16_t sdio_data_rx_program_instructions[] = {
+    //     .wrap_target
+    0xa022, //  0: mov    x, y
+    0x2000, //  1: wait   0 gpio, 0
+    0x2080, //  2: wait   1 gpio, 0
+    0x00c1, //  3: jmp    pin, 1
+    0x2000, //  4: wait   0 gpio, 0
+    0x2080, //  5: wait   1 gpio, 0
+    0x4004, //  6: in     pins, 4
+    0x0044, //  7: jmp    x--, 4
+    //     .wrap
+};
+
+#if !PICO_NO_HARDWARE
+static const struct pio_program sdio_data_rx_program = {
+    .instructions = sdio_data_rx_program_instructions,
+    .length = 8,
+    .origin = -1,
+};
+
+static inline pio_sm_config sdio_data_rx_program_get_default_config(uint offset) {
+    pio_sm_config c = pio_get_default_sm_config();
+    sm_config_set_wrap(&c, offset + sdio_data_rx_wrap_target, offset + sdio_data_rx_wrap);
+    return c;
+}
+#endif
+
@@ -0,0 +1,59 @@
+// Released to the public domain
+//
+// Mounts LittleFS on an external SPI NOR flash chip (W25Q128 or similar) while
+// the onboard LittleFS stays available, and copies a file between them.
+//
+// Wiring (SPI0): MISO=GP16, CS=GP17, SCK=GP18, MOSI=GP19, plus 3.3V and GND.
+// Tie the chip's /WP and /HOLD pins to 3.3V.
+
+#include <LittleFS.h>
+#include <SPIFlash.h>
+
+SPIFlash flash(17, SPI, 30000000);
+FS ExtFS = FS(FSImplPtr(new littlefs_impl::LittleFSImpl(&flash)));
+
+void setup() {
+  Serial.begin(115200);
+  delay(5000);
+
+  SPI.setRX(16);
+  SPI.setSCK(18);
+  SPI.setTX(19);
+  if (!flash.begin()) {
+    Serial.println("No SPI flash chip found");
+    return;
+  }
+  Serial.printf("JEDEC ID %06lx, %lu bytes\n", flash.jedecID(), flash.size());
+
+  if (!ExtFS.begin()) {
+    Serial.println("Unable to mount or format the external flash");
+    return;
+  }
+
+  File f = ExtFS.open("/boot-count.txt", "r");
+  int count = f ? f.parseInt() : 0;
+  f.close();
+  f = ExtFS.open("/boot-count.txt", "w");
+  f.printf("%d\n", ++count);
+  f.close();
+  Serial.printf("Booted %d times\n", count);
+
+  FSInfo i;
+  ExtFS.info(i);
+  Serial.printf("External LittleFS: %u of %u bytes used\n", i.usedBytes, i.totalBytes);
+
+  // The onboard filesystem works at the same time
+  if (LittleFS.begin()) {
+    File src = ExtFS.open("/boot-count.txt", "r");
+    File dst = LittleFS.open("/boot-count-copy.txt", "w");
+    while (src.available()) {
+      dst.write(src.read());
+    }
+    src.close();
+    dst.close();
+    Serial.println("Copied to the onboard LittleFS");
+  }
+}
+
+void loop() {
+}
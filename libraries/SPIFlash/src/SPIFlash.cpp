@@ -0,0 +1,232 @@
+/*
+    SPIFlash.cpp - External SPI NOR flash device for LittleFS and FatFS
+    Copyright (c) 2024 Earle F. Philhower, III.  All rights reserved.
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include <Arduino.h>
+#include "SPIFlash.h"
+#include <algorithm>
+
+#ifdef USE_TINYUSB
+// For Serial when selecting TinyUSB.  Can't include in the core because Arduino IDE
+// will not link in libraries called from the core.  Instead, add the header to all
+// the standard libraries in the hope it will still catch some user cases where they
+// use these libraries.
+// See https://github.com/earlephilhower/arduino-pico/issues/167#issuecomment-848622174
+#include <Adafruit_TinyUSB.h>
+#endif
+
+// JEDEC standard serial NOR commands
+#define SF_WRITE_ENABLE   0x06
+#define SF_READ_STATUS    0x05
+#define SF_JEDEC_ID       0x9f
+#define SF_RELEASE_PD     0xab
+#define SF_RESET_ENABLE   0x66
+#define SF_RESET          0x99
+#define SF_FAST_READ      0x0b
+#define SF_FAST_READ4     0x0c
+#define SF_PAGE_PROG      0x02
+#define SF_PAGE_PROG4     0x12
+#define SF_ERASE_4K       0x20
+#define SF_ERASE_4K4      0x21
+#define SF_ERASE_64K      0xd8
+#define SF_ERASE_64K4     0xdc
+#define SF_ERASE_CHIP     0xc7
+
+#define SF_STATUS_BUSY    0x01
+#define SF_STATUS_WEL     0x02
+
+#define SF_PAGE           256
+
+SPIFlash::SPIFlash(pin_size_t cs, SPIClassRP2040 &spi, uint32_t hz) :
+    _spi(spi), _settings(hz, MSBFIRST, SPI_MODE0), _cs(cs), _jedec(0), _size(0), _addr4(false) {
+}
+
+bool SPIFlash::begin(uint32_t size) {
+    pinMode(_cs, OUTPUT);
+    digitalWrite(_cs, HIGH);
+    _spi.begin();
+
+    // Wake the chip and get it out of any half-finished command from before a reset
+    _command(SF_RELEASE_PD);
+    _end();
+    delayMicroseconds(50);
+    if (!_wait(1000)) {
+        DEBUGV("SPIFlash: chip stuck busy\n");
+        return false;
+    }
+    _command(SF_RESET_ENABLE);
+    _end();
+    _command(SF_RESET);
+    _end();
+    delayMicroseconds(50);
+
+    uint8_t id[3];
+    _command(SF_JEDEC_ID);
+    _xfer(nullptr, id, sizeof(id));
+    _end();
+    _jedec = (id[0] << 16) | (id[1] << 8) | id[2];
+    if (!_jedec || (_jedec == 0xffffff)) {
+        DEBUGV("SPIFlash: no chip found\n");
+        _jedec = 0;
+        return false;
+    }
+
+    if (!size) {
+        // Almost every vendor encodes the capacity as log2(bytes)
+        if ((id[2] < 0x10) || (id[2] > 0x1f)) {
+            DEBUGV("SPIFlash: unknown capacity code %02x, pass the size to begin()\n", id[2]);
+            return false;
+        }
+        size = 1UL << id[2];
+    }
+    _size = size;
+    _addr4 = _size > (16 * 1024 * 1024);
+    return true;
+}
+
+void SPIFlash::end() {
+    _size = 0;
+    _jedec = 0;
+}
+
+bool SPIFlash::read(uint32_t addr, void *dst, size_t len) {
+    if (!_size || (addr + len > _size)) {
+        return false;
+    }
+    // Fast read has one dummy byte after the address, and streams the whole range in one go
+    _command(_addr4 ? SF_FAST_READ4 : SF_FAST_READ, addr, _addr4 ? 4 : 3, 1);
+    _xfer(nullptr, dst, len);
+    _end();
+    return true;
+}
+
+bool SPIFlash::program(uint32_t addr, const void *src, size_t len) {
+    if (!_size || (addr + len > _size)) {
+        return false;
+    }
+    const uint8_t *p = (const uint8_t *)src;
+    while (len) {
+        // A page program wraps around inside its page, so never cross a boundary
+        size_t n = std::min(len, (size_t)(SF_PAGE - (addr % SF_PAGE)));
+        if (!_writeEnable()) {
+            return false;
+        }
+        _command(_addr4 ? SF_PAGE_PROG4 : SF_PAGE_PROG, addr, _addr4 ? 4 : 3);
+        _xfer(p, nullptr, n);
+        _end();
+        if (!_wait(10)) {
+            DEBUGV("SPIFlash: program timeout at %08lx\n", addr);
+            return false;
+        }
+        addr += n;
+        p += n;
+        len -= n;
+    }
+    return true;
+}
+
+bool SPIFlash::erase(uint32_t addr, size_t len) {
+    if (!_size || (addr % 4096) || (len % 4096) || (addr + len > _size)) {
+        return false;
+    }
+    while (len) {
+        // Use the much faster block erase wherever a whole aligned 64K block is covered
+        bool block = !(addr % 65536) && (len >= 65536);
+        if (!_writeEnable()) {
+            return false;
+        }
+        if (block) {
+            _command(_addr4 ? SF_ERASE_64K4 : SF_ERASE_64K, addr, _addr4 ? 4 : 3);
+        } else {
+            _command(_addr4 ? SF_ERASE_4K4 : SF_ERASE_4K, addr, _addr4 ? 4 : 3);
+        }
+        _end();
+        if (!_wait(block ? 3000 : 1000)) {
+            DEBUGV("SPIFlash: erase timeout at %08lx\n", addr);
+            return false;
+        }
+        addr += block ? 65536 : 4096;
+        len -= block ? 65536 : 4096;
+    }
+    return true;
+}
+
+bool SPIFlash::eraseChip() {
+    if (!_size || !_writeEnable()) {
+        return false;
+    }
+    _command(SF_ERASE_CHIP);
+    _end();
+    // Large parts can take several minutes
+    return _wait(400000);
+}
+
+// Asserts CS and sends a command with its (big endian) address and any dummy bytes
+void SPIFlash::_command(uint8_t cmd, uint32_t addr, int addrBytes, int dummyBytes) {
+    uint8_t buff[6];
+    int n = 0;
+    buff[n++] = cmd;
+    for (int i = addrBytes - 1; i >= 0; i--) {
+        buff[n++] = addr >> (8 * i);
+    }
+    for (int i = 0; i < dummyBytes; i++) {
+        buff[n++] = 0xff;
+    }
+    _spi.beginTransaction(_settings);
+    digitalWrite(_cs, LOW);
+    _spi.transfer(buff, nullptr, n);
+}
+
+void SPIFlash::_end() {
+    digitalWrite(_cs, HIGH);
+    _spi.endTransaction();
+}
+
+void SPIFlash::_xfer(const void *tx, void *rx, size_t len) {
+    if ((len >= SPIFLASH_DMA_MIN) && _spi.transferAsync(tx, rx, len)) {
+        while (!_spi.finishedAsync()) {
+            /* Noop, but the other core and IRQs are free to run */
+        }
+    } else {
+        _spi.transfer(tx, rx, len);
+    }
+}
+
+uint8_t SPIFlash::_status() {
+    uint8_t s;
+    _command(SF_READ_STATUS);
+    _xfer(nullptr, &s, 1);
+    _end();
+    return s;
+}
+
+bool SPIFlash::_writeEnable() {
+    _command(SF_WRITE_ENABLE);
+    _end();
+    return _status() & SF_STATUS_WEL;
+}
+
+bool SPIFlash::_wait(uint32_t timeoutMS) {
+    uint32_t start = millis();
+    while (_status() & SF_STATUS_BUSY) {
+        if (millis() - start > timeoutMS) {
+            return false;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,71 @@
+/*
+    SPIFlash.h - External SPI NOR flash device for LittleFS and FatFS
+    Copyright (c) 2024 Earle F. Philhower, III.  All rights reserved.
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#pragma once
+
+#include <Arduino.h>
+#include <SPI.h>
+#include <FlashDevice.h>
+
+// Transfers at least this long are moved by DMA instead of the CPU
+#ifndef SPIFLASH_DMA_MIN
+#define SPIFLASH_DMA_MIN 32
+#endif
+
+// Standard serial NOR flash (Winbond W25Qxx, Macronix MX25Lxx, GigaDevice
+// GD25Qxx, ...) on a hardware SPI port.  Page data is moved by DMA, and as the
+// chip is not on the XIP bus the other core keeps running during writes.
+class SPIFlash : public FlashDevice {
+public:
+    SPIFlash(pin_size_t cs, SPIClassRP2040 &spi = SPI, uint32_t hz = 20000000);
+
+    // Identifies the chip from its JEDEC ID.  Pass the size in bytes for parts whose
+    // ID doesn't encode their capacity.  Parts over 16MB use 4-byte address commands.
+    bool begin(uint32_t size = 0);
+    void end();
+
+    // Manufacturer, memory type, and capacity bytes
+    uint32_t jedecID() const {
+        return _jedec;
+    }
+
+    uint32_t size() override {
+        return _size;
+    }
+
+    bool read(uint32_t addr, void *dst, size_t len) override;
+    bool program(uint32_t addr, const void *src, size_t len) override;
+    bool erase(uint32_t addr, size_t len) override;
+    bool eraseChip();
+
+protected:
+    void _command(uint8_t cmd, uint32_t addr = 0, int addrBytes = 0, int dummyBytes = 0);
+    void _end();
+    void _xfer(const void *tx, void *rx, size_t len);
+    uint8_t _status();
+    bool _writeEnable();
+    bool _wait(uint32_t timeoutMS);
+
+    SPIClassRP2040 &_spi;
+    SPISettings     _settings;
+    pin_size_t      _cs;
+    uint32_t        _jedec;
+    uint32_t        _size;
+    bool            _addr4;
+};
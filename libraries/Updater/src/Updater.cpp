@@ -23,6 +23,7 @@
 #include "StackThunk.h"
 #include "LittleFS.h"
 #include <hardware/flash.h>
+#include <FlashProgram.h>
 #include <PicoOTA.h>
 
 #include <Updater_Signing.h>
@@ -32,7 +33,13 @@
 
 extern uint8_t _FS_start;
 extern uint8_t _FS_end;
+extern uint8_t __flash_binary_end;
 
+// Holds the size and MD5 of the update whose start is saved in firmware.bin
+#define UPDATER_RESUME_FILE "firmware.res"
+// Resumable updates are committed to LittleFS this often, so a power loss only
+// throws away the data received since
+#define UPDATER_RESUME_SYNC (64 * 1024)
 
 #if ARDUINO_SIGNING
 namespace esp8266 {
@@ -65,13 +72,107 @@ void UpdaterClass::_reset() {
     }
     _buffer = 0;
     _bufferLen = 0;
+    if (_sigBuff) {
+        delete[] _sigBuff;
+    }
+    _sigBuff = nullptr;
+    _sigBuffLen = 0;
+    _sigBuffSize = 0;
     _startAddress = 0;
     _currentAddress = 0;
     _size = 0;
     _command = U_FLASH;
+    _inSlot = false;
+    if (_resumable) {
+        // Commits what was received so resume() can continue from it
+        _fp.close();
+    }
+    _resumable = false;
+}
+
+// The slot lies above both the running sketch and where the new one will be
+// copied to, and ends at the sector holding the bootloader's command page
+static uint32_t _slotStart(size_t size) {
+    uint32_t running = ((uint32_t)&__flash_binary_end + 4095) & ~4095;
+    uint32_t copied = XIP_BASE + ((size + 4095) & ~4095);
+    return std::max(running, copied);
+}
+
+size_t UpdaterClass::slotSize() {
+    if (!(PicoOTA::bootloaderFeatures() & _OTA_FEATURE_COPY)) {
+        return 0;
+    }
+    uint32_t end = (uint32_t)&_FS_start - _OTA_COMMAND_SECTOR;
+    uint32_t running = _slotStart(0);
+    if (running >= end) {
+        return 0;
+    }
+    // Images no bigger than the running one can use everything above it, larger
+    // ones are limited to half of the flash below the filesystem
+    if (end - running <= running - XIP_BASE) {
+        return end - running;
+    }
+    return ((end - XIP_BASE) / 2) & ~4095;
 }
 
 bool UpdaterClass::begin(size_t size, int command) {
+    return _begin(size, command, false);
+}
+
+bool UpdaterClass::resume(size_t size, const char *md5, int command) {
+    size_t have = 0;
+    if (!md5) {
+        md5 = "";
+    }
+    bool resumable = (command == U_FLASH) && !_useSlot && (_size == 0) && (strlen(md5) == 32);
+    String id = String(size) + " " + md5;
+    if (resumable) {
+        LittleFS.begin();
+        File rec = LittleFS.open(UPDATER_RESUME_FILE, "r");
+        if (rec && rec.readString().equalsIgnoreCase(id)) {
+            File f = LittleFS.open("firmware.bin", "r");
+            if (f && (f.size() <= size)) {
+                have = f.size();
+            }
+        }
+    }
+
+    if (!_begin(size, command, have > 0)) {
+        return false;
+    }
+    if (*md5) {
+        setMD5(md5);
+    }
+    if (!resumable) {
+        return true;
+    }
+
+    File rec = LittleFS.open(UPDATER_RESUME_FILE, "w");
+    rec.print(id);
+    rec.close();
+    _resumable = true;
+
+    // The hashes need to see everything that's already there
+    while (progress() < have) {
+        size_t n = std::min(have - progress(), _bufferSize);
+        if (_fp.read(_buffer, n) != n) {
+            _setError(UPDATE_ERROR_READ);
+            return false;
+        }
+        if (!_verify) {
+            _md5.add(_buffer, n);
+        } else {
+            _hashAdd(_buffer, n);
+        }
+        _currentAddress += n;
+    }
+#ifdef DEBUG_UPDATER
+    DEBUG_UPDATER.printf_P(PSTR("[resume] continuing from %zu\n"), have);
+#endif
+    return true;
+}
+
+bool UpdaterClass::_begin(size_t size, int command, bool keep) {
     uint32_t updateStartAddress;
     if (_size > 0) {
 #ifdef DEBUG_UPDATER
@@ -96,9 +197,24 @@ bool UpdaterClass::begin(size_t size, int command) {
     _target_md5 = "";
     _md5 = MD5Builder();
 
-    if (command == U_FLASH) {
+    if ((command == U_FLASH) && _useSlot) {
+        if (!(PicoOTA::bootloaderFeatures() & _OTA_FEATURE_COPY)) {
+            // The bootloader would ignore the copy command and keep the old sketch
+            _setError(UPDATE_ERROR_BOOTSTRAP);
+            return false;
+        }
+        updateStartAddress = _slotStart(size);
+        if (updateStartAddress + size > (uint32_t)&_FS_start - _OTA_COMMAND_SECTOR) {
+            _setError(UPDATE_ERROR_SPACE);
+            return false;
+        }
+        _inSlot = true;
+    } else if (command == U_FLASH) {
         LittleFS.begin();
-        _fp = LittleFS.open("firmware.bin", "w+");
+        if (!keep) {
+            LittleFS.remove(UPDATER_RESUME_FILE);
+        }
+        _fp = LittleFS.open("firmware.bin", keep ? "r+" : "w+");
         if (!_fp) {
 #ifdef DEBUG_UPDATER
             DEBUG_UPDATER.println(F("[begin] unable to create file"));
@@ -123,7 +239,7 @@ bool UpdaterClass::begin(size_t size, int command) {
 
     //initialize
     _startAddress = updateStartAddress;
-    _currentAddress = _startAddress; // Only used in the FS upload case
+    _currentAddress = _startAddress; // Only used in the FS and slot upload cases
     _size = size;
     _bufferSize = 4096;
     _buffer = new uint8_t[_bufferSize];
@@ -136,6 +252,10 @@ bool UpdaterClass::begin(size_t size, int command) {
 
     if (!_verify) {
         _md5.begin();
+    } else if (command == U_FLASH) {
+        _sigBuffSize = _verify->length() ? _verify->length() + sizeof(uint32_t) : 0;
+        _sigBuff = _sigBuffSize ? new uint8_t[_sigBuffSize] : nullptr;
+        _hash->begin();
     }
     return true;
 }
@@ -177,6 +297,11 @@ bool UpdaterClass::end(bool evenIfRemaining) {
         _size = progress();
     }
 
+    if (_resumable) {
+        // Everything's here, so whether or not it checks out there's nothing to resume
+        LittleFS.remove(UPDATER_RESUME_FILE);
+    }
+
     if (_verify && (_command == U_FLASH)) {
         const uint32_t expectedSigLen = _verify->length();
         // If expectedSigLen is non-zero, we expect the last four bytes of the buffer to
@@ -184,9 +309,9 @@ bool UpdaterClass::end(bool evenIfRemaining) {
         // But if expectedSigLen is zero, we expect neither a signature nor a length field;
         uint32_t sigLen = 0;
 
-        if (expectedSigLen > 0) {
-            _fp.seek(_size - sizeof(uint32_t));
-            _fp.read((uint8_t *)&sigLen, sizeof(uint32_t));
+        // Everything before them has already been hashed, as it was written
+        if ((expectedSigLen > 0) && (_sigBuffLen == expectedSigLen + sizeof(uint32_t))) {
+            memcpy(&sigLen, _sigBuff + expectedSigLen, sizeof(uint32_t));
         }
 #ifdef DEBUG_UPDATER
         DEBUG_UPDATER.printf_P(PSTR("[Updater] sigLen: %lu\n"), sigLen);
@@ -201,18 +326,9 @@ bool UpdaterClass::end(bool evenIfRemaining) {
         if (expectedSigLen > 0) {
             binSize -= (sigLen + sizeof(uint32_t) /* The siglen word */);
         }
-        _hash->begin();
 #ifdef DEBUG_UPDATER
         DEBUG_UPDATER.printf_P(PSTR("[Updater] Adjusted binsize: %d\n"), binSize);
 #endif
-        // Calculate the MD5 and hash using proper size
-        uint8_t buff[128] __attribute__((aligned(4)));
-        _fp.seek(0);
-        for (int i = 0; i < binSize; i += sizeof(buff)) {
-            _fp.read(buff, sizeof(buff));
-            size_t read = std::min((int)sizeof(buff), binSize - i);
-            _hash->add(buff, read);
-        }
         _hash->end();
 #ifdef DEBUG_UPDATER
         unsigned char *ret = (unsigned char *)_hash->hash();
@@ -223,16 +339,8 @@ bool UpdaterClass::end(bool evenIfRemaining) {
         DEBUG_UPDATER.printf("\n");
 #endif
 
-        uint8_t *sig = nullptr; // Safe to free if we don't actually malloc
+        uint8_t *sig = (expectedSigLen > 0) ? _sigBuff : nullptr;
         if (expectedSigLen > 0) {
-            sig = (uint8_t*)malloc(sigLen);
-            if (!sig) {
-                _setError(UPDATE_ERROR_SIGN);
-                _reset();
-                return false;
-            }
-            _fp.seek(_startAddress + binSize);
-            _fp.read((uint8_t *)sig, sigLen);
 #ifdef DEBUG_UPDATER
             DEBUG_UPDATER.printf_P(PSTR("[Updater] Received Signature:"));
             for (size_t i = 0; i < sigLen; i++) {
@@ -242,12 +350,10 @@ bool UpdaterClass::end(bool evenIfRemaining) {
 #endif
         }
         if (!_verify->verify(_hash, (void *)sig, sigLen)) {
-            free(sig);
             _setError(UPDATE_ERROR_SIGN);
             _reset();
             return false;
         }
-        free(sig);
         _size = binSize; // Adjust size to remove signature, not part of bin payload
 
 #ifdef DEBUG_UPDATER
@@ -271,7 +377,17 @@ bool UpdaterClass::end(bool evenIfRemaining) {
         return false;
     }
 
-    if (_command == U_FLASH) {
+    if (_inSlot) {
+        picoOTA.begin();
+        picoOTA.addSlot(_startAddress, _size);
+        if (!picoOTA.commit()) {
+            _setError(UPDATE_ERROR_WRITE);
+            return false;
+        }
+#ifdef DEBUG_UPDATER
+        DEBUG_UPDATER.printf_P(PSTR("Staged slot: address:0x%08lX, size:0x%08zX\n"), _startAddress, _size);
+#endif
+    } else if (_command == U_FLASH) {
         _fp.close();
         picoOTA.begin();
         picoOTA.addFile("firmware.bin");
@@ -285,21 +401,58 @@ bool UpdaterClass::end(bool evenIfRemaining) {
     return true;
 }
 
+// Hashes the image as it's written, except for the last bytes seen which may
+// turn out to be the signature and its length.  Those are held back in _sigBuff
+// so end() doesn't need to read anything back from flash.
+void UpdaterClass::_hashAdd(const uint8_t *data, size_t len) {
+    if (!_sigBuffSize) {
+        _hash->add(data, len);
+        return;
+    }
+    if (_sigBuffLen + len <= _sigBuffSize) {
+        memcpy(_sigBuff + _sigBuffLen, data, len);
+        _sigBuffLen += len;
+        return;
+    }
+    size_t toHash = _sigBuffLen + len - _sigBuffSize;
+    size_t fromSig = std::min(toHash, _sigBuffLen);
+    _hash->add(_sigBuff, fromSig);
+    _hash->add(data, toHash - fromSig);
+    memmove(_sigBuff, _sigBuff + fromSig, _sigBuffLen - fromSig);
+    memcpy(_sigBuff + _sigBuffLen - fromSig, data + toHash - fromSig, len - (toHash - fromSig));
+    _sigBuffLen = _sigBuffSize;
+}
+
 bool UpdaterClass::_writeBuffer() {
-    if (_command == U_FLASH) {
+    if (_inSlot && (_currentAddress == _startAddress) && (_bufferLen >= 4)) {
+        // The bootloader copies slots verbatim, there's nothing to expand them
+        if (((_buffer[0] == 0x1f) && (_buffer[1] == 0x8b)) || !memcmp(_buffer, "\x04\x22\x4d\x18", 4) ||
+                ((_bufferLen >= 8) && !memcmp(_buffer, "Pico DLT", 8))) {
+            _setError(UPDATE_ERROR_MAGIC_BYTE);
+            return false;
+        }
+    }
+    if ((_command == U_FLASH) && !_inSlot && (_currentAddress == _startAddress) &&
+            !PicoOTA::bootloaderCanApply(_buffer, _bufferLen)) {
+        // Needs a newer lib/ota.o than the one this sketch was built with
+        _setError(UPDATE_ERROR_MAGIC_BYTE);
+        return false;
+    }
+    if ((_command == U_FLASH) && !_inSlot) {
         if (_bufferLen != _fp.write(_buffer, _bufferLen)) {
             return false;
         }
+        if (_resumable && !((_currentAddress + _bufferLen) % UPDATER_RESUME_SYNC)) {
+            _fp.flush();
+        }
     } else {
-        noInterrupts();
-        rp2040.idleOtherCore();
-        flash_range_erase((intptr_t)_currentAddress - (intptr_t)XIP_BASE, 4096);
-        flash_range_program((intptr_t)_currentAddress - (intptr_t)XIP_BASE, _buffer, 4096);
-        rp2040.resumeOtherCore();
-        interrupts();
+        memset(_buffer + _bufferLen, 0xff, _bufferSize - _bufferLen);
+        flashProgram((const void *)_currentAddress, _buffer, 4096, true);
     }
     if (!_verify) {
         _md5.add(_buffer, _bufferLen);
+    } else if (_command == U_FLASH) {
+        _hashAdd(_buffer, _bufferLen);
     }
     _currentAddress += _bufferLen;
     _bufferLen = 0;
@@ -440,6 +593,10 @@ void UpdaterClass::printError(Print &out) {
         err += _md5.toString();
     } else if (_error == UPDATE_ERROR_SIGN) {
         err += "Signature verification failed";
+    } else if (_error == UPDATE_ERROR_MAGIC_BYTE) {
+        err += "Image format not supported by the slot or the bootloader";
+    } else if (_error == UPDATE_ERROR_BOOTSTRAP) {
+        err += "Bootloader too old for slot updates";
     } else {
         err += "UNKNOWN";
     }
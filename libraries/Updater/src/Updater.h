@@ -85,6 +85,14 @@ public:
     */
     bool begin(size_t size, int command = U_FLASH);
 
+    /*
+        Like begin() followed by setMD5(), but if a U_FLASH update with the same
+        size and MD5 was cut off part way the data already saved to LittleFS is
+        kept.  progress() then returns the offset to continue sending from.
+        A null or empty md5 just does a plain begin()
+    */
+    bool resume(size_t size, const char *md5, int command = U_FLASH);
+
     /*
         Run Updater from asynchronous callbacs
     */
@@ -92,6 +100,21 @@ public:
         _async = async;
     }
 
+    /*
+        A/B slot mode: U_FLASH updates are written straight to the free flash
+        between the running sketch and the filesystem instead of to a file in
+        LittleFS, and the OTA bootloader copies them into place.  Only plain
+        (not compressed or delta) images can be used.
+    */
+    void useSlot(bool slot) {
+        _useSlot = slot;
+    }
+
+    /*
+        Largest image which can be written in A/B slot mode
+    */
+    size_t slotSize();
+
     /*
         Writes a buffer to the flash and increments the address
         Returns the amount written
@@ -221,14 +244,19 @@ public:
 
 private:
     void _reset();
+    bool _begin(size_t size, int command, bool keep);
     bool _writeBuffer();
 
     bool _verifyHeader(uint8_t data);
     bool _verifyEnd();
+    void _hashAdd(const uint8_t *data, size_t len);
 
     void _setError(int error);
 
     bool _async = false;
+    bool _useSlot = false;
+    bool _inSlot = false;
+    bool _resumable = false;
     uint8_t _error = 0;
     uint8_t *_buffer = nullptr;
     size_t _bufferLen = 0; // amount of data written into _buffer
@@ -245,6 +273,9 @@ private:
     // Optional signed binary verification
     UpdaterHashClass *_hash = nullptr;
     UpdaterVerifyClass *_verify = nullptr;
+    uint8_t *_sigBuff = nullptr; // Most recent bytes written, not yet hashed
+    size_t _sigBuffLen = 0;
+    size_t _sigBuffSize = 0;
     // Optional progress callback function
     THandlerFunction_Progress _progress_callback = nullptr;
 };
@@ -29,6 +29,9 @@
 #include "detail/RequestHandlersImpl.h"
 #include <MD5Builder.h>
 
+extern uint8_t __flash_binary_end;
+extern uint8_t _FS_end;
+
 #ifndef log_e
 #define log_e(...)
 #define log_w(...)
@@ -385,6 +388,23 @@ void HTTPServer::sendContent(const char* content, size_t contentLength) {
     }
 }
 
+size_t HTTPServer::_currentClientWrite_P(PGM_P b, size_t l) {
+    if (((uintptr_t)b >= XIP_BASE) && ((uintptr_t)b + l <= (uintptr_t)&__flash_binary_end)) {
+        // Part of the sketch in flash so it can't change, lwIP doesn't need its own copy
+        return _currentClient->writeStatic((const uint8_t *)b, l);
+    }
+    return _currentClient->write(b, l);
+}
+
+size_t HTTPServer::_currentClientWriteMapped(const uint8_t *b, size_t l) {
+    if (((uintptr_t)b >= XIP_BASE) && ((uintptr_t)b + l <= (uintptr_t)&_FS_end)) {
+        // The sketch or a read-only image in the filesystem region, nothing will change it
+        return _currentClient->writeStatic(b, l);
+    }
+    // RAM (RAMFS) can change once the file is closed, so wait for the peer to ACK it all
+    return _currentClient->writeNoCopy(b, l);
+}
+
 void HTTPServer::sendContent_P(PGM_P content) {
     sendContent_P(content, strlen_P(content));
 }
@@ -25,6 +25,7 @@
 #include <functional>
 #include <memory>
 #include <WiFi.h>
+#include <FS.h>
 #include "HTTP_Method.h"
 #include "Uri.h"
 
@@ -185,6 +186,19 @@ public:
         return _currentClient->write(file);
     }
 
+    size_t streamFile(File &file, const String& contentType, const int code = 200) {
+        _streamFileCore(file.size(), file.name(), contentType, code);
+        const uint8_t *p = file.mmap();
+        if (p) {
+            // The FS has the contents mapped in memory, so send them directly without a bounce buffer
+            // or a copy in lwIP's heap.  Leave the file where write(file) would have.
+            size_t sent = _currentClientWriteMapped(p + file.position(), file.size() - file.position());
+            file.seek(sent, SeekCur);
+            return sent;
+        }
+        return _currentClient->write(file);
+    }
+
     // Hook
     enum ClientFuture { CLIENT_REQUEST_CAN_CONTINUE, CLIENT_REQUEST_IS_HANDLED, CLIENT_MUST_STOP, CLIENT_IS_GIVEN };
     typedef String(*ContentTypeFunction)(const String&);
@@ -208,9 +222,8 @@ protected:
     virtual size_t _currentClientWrite(const char* b, size_t l) {
         return _currentClient->write(b, l);
     }
-    virtual size_t _currentClientWrite_P(PGM_P b, size_t l) {
-        return _currentClient->write(b, l);
-    }
+    virtual size_t _currentClientWrite_P(PGM_P b, size_t l);
+    size_t _currentClientWriteMapped(const uint8_t *b, size_t l);
     void _addRequestHandler(RequestHandler* handler);
     void _handleRequest();
     void _finalizeResponse();
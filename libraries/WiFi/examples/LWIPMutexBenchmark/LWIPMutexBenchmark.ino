@@ -0,0 +1,61 @@
+/*
+    Shows what holding one LWIPMutex around a group of lwIP calls saves.
+    Each wrapped lwIP call normally masks the Ethernet IRQs and takes the lwIP
+    lock on its own.  With an outer LWIPMutex held the inner ones only count,
+    which is what the WiFiClient and WiFiUDP read and write paths now do.
+
+    Released to the public domain
+*/
+
+#include <WiFi.h>
+#include <LWIPMutex.h>
+#include <lwip/pbuf.h>
+
+#ifndef STASSID
+#define STASSID "your-ssid"
+#define STAPSK "your-password"
+#endif
+
+const char* ssid = STASSID;
+const char* password = STAPSK;
+
+const int loops = 1000;
+
+// A chain of small pbufs, like UDP builds up for a large packet
+static void allocFree() {
+  pbuf *head = pbuf_alloc(PBUF_TRANSPORT, 128, PBUF_RAM);
+  for (int i = 0; i < 7; i++) {
+    pbuf_cat(head, pbuf_alloc(PBUF_RAW, 128, PBUF_RAM));
+  }
+  pbuf_free(head);
+}
+
+void setup() {
+  Serial.begin(115200);
+  WiFi.mode(WIFI_STA);
+  WiFi.begin(ssid, password);
+  while (WiFi.status() != WL_CONNECTED) {
+    delay(500);
+    Serial.print(".");
+  }
+  Serial.println();
+}
+
+void loop() {
+  uint32_t start = rp2040.getCycleCount();
+  for (int i = 0; i < loops; i++) {
+    allocFree();
+  }
+  uint32_t separate = rp2040.getCycleCount() - start;
+
+  start = rp2040.getCycleCount();
+  for (int i = 0; i < loops; i++) {
+    LWIPMutex m;
+    allocFree();
+  }
+  uint32_t batched = rp2040.getCycleCount() - start;
+
+  Serial.printf("Locking each call:  %lu cycles per chain\n", separate / loops);
+  Serial.printf("One lock per chain: %lu cycles per chain\n", batched / loops);
+  delay(5000);
+}
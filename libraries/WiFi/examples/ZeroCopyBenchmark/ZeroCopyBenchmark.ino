@@ -0,0 +1,96 @@
+/*
+    Compares the ways to receive TCP data: one byte at a time with read(), a
+    buffer at a time with read(buf, len), and in place with peekSpans() and
+    consume().  Each test counts the newlines in 4MB sent by a host, so the
+    data is looked at just like a line based parser would.
+
+    On the host run (a new connection is needed for each test):
+        while true; do head -c 4194304 /dev/urandom | nc -l 5001; done
+*/
+
+#include <WiFi.h>
+
+#ifndef STASSID
+#define STASSID "your-ssid"
+#define STAPSK "your-password"
+#endif
+
+const char* ssid = STASSID;
+const char* password = STAPSK;
+
+const char* host = "192.168.1.10";
+const uint16_t port = 5001;
+
+const size_t total = 4 * 1024 * 1024;
+
+WiFiMulti multi;
+
+static uint32_t countLines(const uint8_t *data, size_t len) {
+  uint32_t lines = 0;
+  while (len--) {
+    lines += (*data++ == '\n') ? 1 : 0;
+  }
+  return lines;
+}
+
+void runTest(const char *name, int mode) {
+  WiFiClient client;
+  if (!client.connect(host, port)) {
+    Serial.printf("%s: connection failed\n", name);
+    return;
+  }
+  static uint8_t buff[1460];
+  size_t got = 0;
+  uint32_t lines = 0;
+  uint32_t start = millis();
+  while ((got < total) && (client.connected() || client.available())) {
+    if (mode == 0) {
+      int c = client.read();
+      if (c >= 0) {
+        lines += (c == '\n') ? 1 : 0;
+        got++;
+      }
+    } else if (mode == 1) {
+      int n = client.read(buff, sizeof(buff));
+      if (n > 0) {
+        lines += countLines(buff, n);
+        got += n;
+      }
+    } else {
+      WiFiClient::Span spans[8];
+      size_t count = client.peekSpans(spans, 8);
+      size_t n = 0;
+      for (size_t i = 0; i < count; i++) {
+        lines += countLines(spans[i].data, spans[i].len);
+        n += spans[i].len;
+      }
+      client.consume(n);
+      got += n;
+    }
+  }
+  uint32_t ms = millis() - start;
+  client.stop();
+  Serial.printf("%-12s %7zu bytes, %5lu lines, %5lu ms, %4lu KB/s\n", name, got, lines, ms, (unsigned long)(ms ? got / ms : 0));
+}
+
+void setup() {
+  Serial.begin(115200);
+  delay(5000);
+
+  Serial.printf("Connecting to '%s' with '%s'\n", ssid, password);
+  multi.addAP(ssid, password);
+  while (multi.run() != WL_CONNECTED) {
+    Serial.print(".");
+    delay(100);
+  }
+  Serial.printf("\nConnected, IP address: %s\n", WiFi.localIP().toString().c_str());
+
+  runTest("read()", 0);
+  delay(1000);
+  runTest("read(buf)", 1);
+  delay(1000);
+  runTest("peekSpans()", 2);
+}
+
+void loop() {
+}
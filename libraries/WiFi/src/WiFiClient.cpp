@@ -199,6 +199,22 @@ size_t WiFiClient::write(const uint8_t *buf, size_t size) {
     return _client->write((const char*)buf, size);
 }
 
+size_t WiFiClient::writeStatic(const uint8_t *buf, size_t size) {
+    if (!_client || !size) {
+        return 0;
+    }
+    _client->setTimeout(_timeout);
+    return _client->write_nocopy((const char*)buf, size, false);
+}
+
+size_t WiFiClient::writeNoCopy(const uint8_t *buf, size_t size) {
+    if (!_client || !size) {
+        return 0;
+    }
+    _client->setTimeout(_timeout);
+    return _client->write_nocopy((const char*)buf, size, true);
+}
+
 size_t WiFiClient::write(Stream& stream) {
     if (!_client || !stream.available()) {
         return 0;
@@ -262,6 +278,20 @@ size_t WiFiClient::peekBytes(uint8_t *buffer, size_t length) {
     return _client->peekBytes((char *)buffer, count);
 }
 
+size_t WiFiClient::peekSpans(Span *spans, size_t max) {
+    if (!_client) {
+        return 0;
+    }
+    return _client->peekSpans(spans, max);
+}
+
+void WiFiClient::consume(size_t len) {
+    if (!_client) {
+        return;
+    }
+    _client->consume(len);
+}
+
 bool WiFiClient::flush(unsigned int maxWaitMs) {
     if (!_client) {
         return true;
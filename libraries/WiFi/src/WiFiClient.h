@@ -72,6 +72,13 @@ public:
     virtual size_t write(const uint8_t *buf, size_t size) override;
     size_t write(Stream& stream);
 
+    // Send without copying into lwIP's heap.  writeStatic() is for data which
+    // never changes or goes away, like const tables and strings in flash, and
+    // returns as soon as it's queued.  writeNoCopy() returns once the peer has
+    // acknowledged all of it, after which the buffer can be reused
+    virtual size_t writeStatic(const uint8_t *buf, size_t size);
+    virtual size_t writeNoCopy(const uint8_t *buf, size_t size);
+
     virtual int available() override;
     virtual int read() override;
     virtual int read(uint8_t* buf, size_t size) override;
@@ -82,6 +89,17 @@ public:
     size_t peekBytes(char *buffer, size_t length) {
         return peekBytes((uint8_t *) buffer, length);
     }
+
+    // Zero-copy receive.  What has arrived may be split over several network
+    // buffers, so peekSpans() points up to max spans at it, in order, and returns
+    // how many it filled.  They stay valid until the next read() or consume(),
+    // which drops len bytes from the front as if they'd been read
+    struct Span {
+        const uint8_t *data;
+        size_t len;
+    };
+    virtual size_t peekSpans(Span *spans, size_t max);
+    virtual void consume(size_t len);
     virtual void flush() override {
         (void)flush(0);    // wait for all outgoing characters to be sent, output buffer should be empty after this call
     }
@@ -407,6 +407,25 @@ void WiFiClientSecureCtx::peekConsume(size_t consume) {
     _recvapp_len = 0;
 }
 #endif
+size_t WiFiClientSecureCtx::peekSpans(Span *spans, size_t max) {
+    if (!max || !available()) {
+        return 0;
+    }
+    spans[0].data = _recvapp_buf;
+    spans[0].len = _recvapp_len;
+    return 1;
+}
+
+void WiFiClientSecureCtx::consume(size_t len) {
+    while (len && available()) {
+        size_t n = std::min(len, _recvapp_len);
+        br_ssl_engine_recvapp_ack(_eng, n);
+        _recvapp_buf = nullptr;
+        _recvapp_len = 0;
+        len -= n;
+    }
+}
+
 int WiFiClientSecureCtx::read() {
     uint8_t c;
     if (1 == read(&c, 1)) {
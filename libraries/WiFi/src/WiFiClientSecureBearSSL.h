@@ -55,6 +55,13 @@ public:
     size_t write(const uint8_t *buf, size_t size) override;
     //    size_t write_P(PGM_P buf, size_t size) override;
     size_t write(Stream& stream); // Note this is not virtual
+    // Everything is encrypted into BearSSL's own buffers anyway
+    size_t writeStatic(const uint8_t *buf, size_t size) override {
+        return write(buf, size);
+    }
+    size_t writeNoCopy(const uint8_t *buf, size_t size) override {
+        return write(buf, size);
+    }
     int read(uint8_t *buf, size_t size) override;
     int read(char *buf, size_t size) {
         return read((uint8_t*)buf, size);
@@ -63,6 +70,9 @@ public:
     int read() override;
     int peek() override;
     size_t peekBytes(uint8_t *buffer, size_t length) override;
+    // BearSSL decrypts one record at a time, so there's at most one span
+    size_t peekSpans(Span *spans, size_t max) override;
+    void consume(size_t len) override;
     bool flush(unsigned int maxWaitMs);
     bool stop(unsigned int maxWaitMs);
     void flush() override {
@@ -406,6 +416,12 @@ public:
     size_t write(Stream& stream) { /* Note this is not virtual */
         return _ctx->write(stream);
     }
+    size_t writeStatic(const uint8_t *buf, size_t size) override {
+        return _ctx->write(buf, size);
+    }
+    size_t writeNoCopy(const uint8_t *buf, size_t size) override {
+        return _ctx->write(buf, size);
+    }
     int read(uint8_t *buf, size_t size) override {
         return _ctx->read(buf, size);
     }
@@ -424,6 +440,12 @@ public:
     size_t peekBytes(uint8_t *buffer, size_t length) override {
         return _ctx->peekBytes(buffer, length);
     }
+    size_t peekSpans(Span *spans, size_t max) override {
+        return _ctx->peekSpans(spans, max);
+    }
+    void consume(size_t len) override {
+        _ctx->consume(len);
+    }
     bool flush(unsigned int maxWaitMs) {
         return _ctx->flush(maxWaitMs);
     }
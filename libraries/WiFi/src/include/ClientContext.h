@@ -27,6 +27,7 @@ class WiFiClient;
 typedef void (*discard_cb_t)(void*, ClientContext*);
 
 #include <assert.h>
+#include <LWIPMutex.h>
 #include "lwip/timeouts.h"
 
 //#include <esp_priv.h>
@@ -254,6 +255,7 @@ public:
         size = (size < max_size) ? size : max_size;
 
         DEBUGV(":rd %d, %d, %d\r\n", size, _rx_buf->tot_len, _rx_buf_offset);
+        LWIPMutex m; // One lock for all the pbufs
         size_t size_read = 0;
         while (size) {
             size_t buf_size = _rx_buf->len - _rx_buf_offset;
@@ -292,6 +294,32 @@ public:
         return copy_size;
     }
 
+    size_t peekSpans(WiFiClient::Span *spans, size_t max) const {
+        size_t count = 0;
+        size_t offset = _rx_buf_offset;
+        for (pbuf *p = _rx_buf; p && (count < max); p = p->next) {
+            if (p->len > offset) {
+                spans[count].data = reinterpret_cast<const uint8_t*>(p->payload) + offset;
+                spans[count].len = p->len - offset;
+                count++;
+            }
+            offset = 0;
+        }
+        return count;
+    }
+
+    void consume(size_t size) {
+        size = std::min(size, getSize());
+        DEBUGV(":cs %d\r\n", size);
+        LWIPMutex m;
+        while (size) {
+            size_t buf_size = _rx_buf->len - _rx_buf_offset;
+            size_t consume_size = (size < buf_size) ? size : buf_size;
+            _consume(consume_size);
+            size -= consume_size;
+        }
+    }
+
     void discard_received() {
         DEBUGV(":dsrcv %d\n", _rx_buf ? _rx_buf->tot_len : 0);
         if (!_rx_buf) {
@@ -371,6 +399,27 @@ public:
         return _write_from_source(ds, dl);
     }
 
+    // The data is handed to lwIP by reference instead of being copied into its
+    // heap, so it has to stay put until the peer acks it.  Static data always
+    // does, otherwise wait for the acks here
+    size_t write_nocopy(const char* ds, const size_t dl, bool wait) {
+        if (!_pcb) {
+            return 0;
+        }
+        _nocopy = true;
+        size_t written = _write_from_source(ds, dl);
+        _nocopy = false;
+        if (wait) {
+            wait_until_acked(_timeout_ms);
+            if (_pcb && (tcp_sndbuf(_pcb) != TCP_SND_BUF)) {
+                // lwIP can't be left pointing at a buffer the caller is about to reuse
+                DEBUGV(":wncto\r\n");
+                abort();
+            }
+        }
+        return written;
+    }
+
     size_t write(Stream& stream) {
         if (!_pcb) {
             return 0;
@@ -514,6 +563,7 @@ protected:
 
         DEBUGV(":wr %d %d\r\n", _datalen - _written, _written);
 
+        LWIPMutex m; // Held over every tcp_write and the tcp_output
         bool has_written = false;
         int scale = 0;
 
@@ -548,7 +598,7 @@ protected:
             {
                 flags |= TCP_WRITE_FLAG_MORE;    // do not tcp-PuSH (yet)
             }
-            if (!_sync)
+            if (!_sync && !_nocopy)
                 // user data must be copied when data are sent but not yet acknowledged
                 // (with sync, we wait for acknowledgment before returning to user)
             {
@@ -606,6 +656,7 @@ protected:
     }
 
     void _consume(size_t size) {
+        LWIPMutex m;
         ptrdiff_t left = _rx_buf->len - _rx_buf_offset - size;
         if (left > 0) {
             _rx_buf_offset += size;
@@ -742,6 +793,7 @@ private:
     uint32_t _op_start_time = 0;
     bool _send_waiting = false;
     bool _connect_pending = false;
+    bool _nocopy = false;
 
     int8_t _refcnt;
     ClientContext* _next;
@@ -29,6 +29,7 @@ extern "C" {
 
 #include <AddrList.h>
 #include <Arduino.h>
+#include <LWIPMutex.h>
 #include "lwip/timeouts.h"
 
 //#include <PolledTimeout.h>
@@ -252,6 +253,7 @@ public:
         // _rx_buf is currently addressing a data pbuf,
         // in this function it is going to be discarded.
 
+        LWIPMutex m;
         auto deleteme = _rx_buf;
 
         // forward in the chain until next address-info pbuf or end of chain
@@ -308,6 +310,7 @@ public:
         size_t max_size = _rx_buf_size - _rx_buf_offset;
         size = (size < max_size) ? size : max_size;
         DEBUGV(":urd %d, %d, %d\r\n", size, _rx_buf_size, _rx_buf_offset);
+        LWIPMutex m;
 
         void* buf = pbuf_get_contiguous(_rx_buf, dst, size, size, _rx_buf_offset);
         if (!buf) {
@@ -396,6 +399,7 @@ public:
 private:
 
     err_t trySend(const ip_addr_t* addr, uint16_t port, bool keepBufferOnError) {
+        LWIPMutex m; // Covers the allocation, send, and both frees
         size_t data_size = _tx_buf_offset;
         pbuf* tx_copy = pbuf_alloc(PBUF_TRANSPORT, data_size, PBUF_RAM);
         if (tx_copy) {
@@ -446,6 +450,7 @@ private:
 
     void _reserve(size_t size) {
         const size_t pbuf_unit_size = 128;
+        LWIPMutex m; // Large packets grow by many small pbufs
         if (!_tx_buf_head) {
             _tx_buf_head = pbuf_alloc(PBUF_TRANSPORT, pbuf_unit_size, PBUF_RAM);
             if (!_tx_buf_head) {
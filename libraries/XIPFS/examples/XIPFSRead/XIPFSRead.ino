@@ -0,0 +1,51 @@
+// Released to the public domain
+//
+// Lists the contents of an XIPFS image and prints a file without copying
+// it into RAM, using File::mmap() to get a pointer straight into flash.
+
+// Before running:
+// 1) Select Tools->Flash Size->(some size with a FS/filesystem)
+// 2) Build the image from the sketch data directory on the host:
+//      python3 tools/mkxipfs.py -c data -o xipfs.bin
+// 3) Write xipfs.bin to the start of the filesystem region, for example:
+//      python3 tools/uf2conv.py -f 0xe48bff56 -b <_FS_start address> -c -o xipfs.uf2 xipfs.bin
+//    and copy xipfs.uf2 to the Pico in BOOTSEL mode
+
+#include <XIPFS.h>
+
+void listDir(const char *dirname, int level) {
+  Dir d = XIPFS.openDir(dirname);
+  while (d.next()) {
+    for (int i = 0; i < level; i++) {
+      Serial.print("  ");
+    }
+    if (d.isDirectory()) {
+      Serial.printf("%s/\n", d.fileName().c_str());
+      String sub = String(dirname) + d.fileName() + "/";
+      listDir(sub.c_str(), level + 1);
+    } else {
+      Serial.printf("%s (%d bytes)\n", d.fileName().c_str(), d.fileSize());
+    }
+  }
+}
+
+void setup() {
+  Serial.begin(115200);
+  delay(5000);
+  if (!XIPFS.begin()) {
+    Serial.println("No XIPFS image found, see instructions in the sketch");
+    return;
+  }
+  listDir("/", 0);
+
+  File f = XIPFS.open("/hello.txt", "r");
+  if (f) {
+    const uint8_t *p = f.mmap();
+    Serial.printf("hello.txt lives at %p\n", p);
+    Serial.write(p, f.size());
+    f.close();
+  }
+}
+
+void loop() {
+}
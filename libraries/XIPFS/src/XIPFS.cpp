@@ -0,0 +1,190 @@
+/*
+    XIPFS.cpp - Read-only, execute-in-place flat image filesystem
+    Copyright (c) 2024 Earle F. Philhower, III.  All rights reserved.
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include <Arduino.h>
+#include "XIPFS.h"
+
+#ifdef USE_TINYUSB
+// For Serial when selecting TinyUSB.  Can't include in the core because Arduino IDE
+// will not link in libraries called from the core.  Instead, add the header to all
+// the standard libraries in the hope it will still catch some user cases where they
+// use these libraries.
+// See https://github.com/earlephilhower/arduino-pico/issues/167#issuecomment-848622174
+#include <Adafruit_TinyUSB.h>
+#endif
+
+extern uint8_t _FS_start;
+extern uint8_t _FS_end;
+
+namespace xipfs_impl {
+
+bool XIPFSImpl::begin() {
+    if (_mounted) {
+        return true;
+    }
+    if (_size < sizeof(XIPFSHeader)) {
+        DEBUGV("XIPFS size too small\n");
+        return false;
+    }
+    const XIPFSHeader *hdr = reinterpret_cast<const XIPFSHeader *>(_start);
+    if ((hdr->magic != XIPFS_MAGIC) || (hdr->version != XIPFS_VERSION)) {
+        DEBUGV("XIPFS: no image found at %p\n", _start);
+        return false;
+    }
+    if ((hdr->size > _size) || (sizeof(XIPFSHeader) + hdr->count * sizeof(XIPFSEntry) > hdr->size)) {
+        DEBUGV("XIPFS: image size %lu larger than region %lu\n", hdr->size, _size);
+        return false;
+    }
+    const XIPFSEntry *ent = reinterpret_cast<const XIPFSEntry *>(_start + sizeof(XIPFSHeader));
+    for (int i = 0; i < hdr->count; i++) {
+        if ((ent[i].size > hdr->size) || (ent[i].offset > hdr->size - ent[i].size) || (ent[i].name[XIPFS_NAME_MAX - 1] != 0)) {
+            DEBUGV("XIPFS: corrupt entry %d\n", i);
+            return false;
+        }
+    }
+    _hdr = hdr;
+    _ent = ent;
+    _mounted = true;
+    return true;
+}
+
+int XIPFSImpl::_lowerBound(const char *path) const {
+    int lo = 0;
+    int hi = _hdr->count;
+    while (lo < hi) {
+        int mid = (lo + hi) / 2;
+        if (strncmp(_ent[mid].name, path, XIPFS_NAME_MAX) < 0) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+const XIPFSEntry *XIPFSImpl::_find(const char *path) const {
+    int i = _lowerBound(path);
+    if ((i < _hdr->count) && !strncmp(_ent[i].name, path, XIPFS_NAME_MAX)) {
+        return &_ent[i];
+    }
+    return nullptr;
+}
+
+bool XIPFSImpl::_isDir(const char *path) const {
+    if (!path[0]) {
+        return true; // Root always exists
+    }
+    String prefix = path;
+    if (!prefix.endsWith("/")) {
+        prefix += "/";
+    }
+    int i = _lowerBound(prefix.c_str());
+    return (i < _hdr->count) && !strncmp(_ent[i].name, prefix.c_str(), prefix.length());
+}
+
+bool XIPFSImpl::exists(const char* path) {
+    if (!_mounted || !path || !path[0]) {
+        return false;
+    }
+    path = _skipSlash(path);
+    return _find(path) || _isDir(path);
+}
+
+FileImplPtr XIPFSImpl::open(const char* path, OpenMode openMode, AccessMode accessMode) {
+    if (!_mounted) {
+        DEBUGV("XIPFSImpl::open() called on unmounted FS\n");
+        return FileImplPtr();
+    }
+    if (!path || !path[0]) {
+        DEBUGV("XIPFSImpl::open() called with invalid filename\n");
+        return FileImplPtr();
+    }
+    if ((accessMode & AM_WRITE) || (openMode & (OM_CREATE | OM_TRUNCATE | OM_APPEND))) {
+        DEBUGV("XIPFSImpl::open() write access requested on read-only FS\n");
+        return FileImplPtr();
+    }
+    const char *name = _skipSlash(path);
+    const XIPFSEntry *e = _find(name);
+    if (e) {
+        return std::make_shared<XIPFSFileImpl>(this, e->name, e);
+    } else if (_isDir(name)) {
+        return std::make_shared<XIPFSFileImpl>(this, name, nullptr);
+    }
+    return FileImplPtr();
+}
+
+DirImplPtr XIPFSImpl::openDir(const char *path) {
+    if (!_mounted || !path) {
+        return DirImplPtr();
+    }
+    String p = _skipSlash(path);
+    while (p.endsWith("/")) {
+        p.remove(p.length() - 1);
+    }
+    if (!p.length() || _isDir(p.c_str())) {
+        return std::make_shared<XIPFSDirImpl>(this, p.length() ? p + "/" : String(), String());
+    }
+    // Not a directory, so list the parent filtered on the final name part
+    int slash = p.lastIndexOf('/');
+    if (slash < 0) {
+        return std::make_shared<XIPFSDirImpl>(this, String(), p);
+    }
+    return std::make_shared<XIPFSDirImpl>(this, p.substring(0, slash + 1), p.substring(slash + 1));
+}
+
+bool XIPFSDirImpl::next() {
+    const XIPFSEntry *ent = _fs->_ent;
+    const int count = _fs->_mounted ? _fs->_hdr->count : 0;
+    const size_t plen = _prefix.length();
+    while (_next < count) {
+        const char *n = ent[_next].name;
+        if (strncmp(n, _prefix.c_str(), plen)) {
+            break; // Sorted, so nothing further can match
+        }
+        const char *rel = n + plen;
+        const char *slash = strchr(rel, '/');
+        int i = _next++;
+        if (_filter.length() && strncmp(rel, _filter.c_str(), _filter.length())) {
+            continue;
+        }
+        if (slash) {
+            // Everything under one subdir is contiguous, so report it only the first time
+            String sub = String(rel).substring(0, slash - rel);
+            if (_valid && _isDir && (sub == _name)) {
+                continue;
+            }
+            _name = sub;
+            _isDir = true;
+        } else {
+            _name = rel;
+            _isDir = false;
+        }
+        _idx = i;
+        _valid = true;
+        return true;
+    }
+    _valid = false;
+    return false;
+}
+
+}; // namespace xipfs_impl
+
+#if !defined(NO_GLOBAL_INSTANCES) && !defined(NO_GLOBAL_XIPFS)
+FS XIPFS = FS(FSImplPtr(new xipfs_impl::XIPFSImpl(&_FS_start, &_FS_end - &_FS_start)));
+#endif
@@ -0,0 +1,351 @@
+/*
+    XIPFS.h - Read-only, execute-in-place flat image filesystem
+    Copyright (c) 2024 Earle F. Philhower, III.  All rights reserved.
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#pragma once
+
+#include <FS.h>
+#include <FSImpl.h>
+
+using namespace fs;
+
+namespace xipfs_impl {
+
+// On-flash image layout, generated by tools/mkxipfs.py.  All fields are little-endian.
+//   XIPFSHeader
+//   XIPFSEntry[count], sorted by name so lookups can binary search
+//   File data, each file starting on a 4-byte boundary
+#define XIPFS_MAGIC   0x46504958 // "XIPF"
+#define XIPFS_VERSION 1
+#define XIPFS_NAME_MAX 52
+
+typedef struct {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t count;
+    uint32_t size;     // Total image size, header included
+    uint32_t reserved;
+} XIPFSHeader;
+
+typedef struct {
+    uint32_t offset;   // From start of image
+    uint32_t size;
+    uint32_t mtime;
+    char     name[XIPFS_NAME_MAX]; // Full path, no leading '/', zero terminated
+} XIPFSEntry;
+
+static_assert(sizeof(XIPFSHeader) == 16, "XIPFSHeader must be 16 bytes");
+static_assert(sizeof(XIPFSEntry) == 64, "XIPFSEntry must be 64 bytes");
+
+class XIPFSFileImpl;
+class XIPFSDirImpl;
+
+class XIPFSConfig : public FSConfig {
+public:
+    static constexpr uint32_t FSId = 0x58495046;
+    // There is nothing to format on a read-only image, so autoformat is always off
+    XIPFSConfig() : FSConfig(FSId, false) { }
+};
+
+class XIPFSImpl : public FSImpl {
+public:
+    XIPFSImpl(const uint8_t *start, uint32_t size) : _start(start), _size(size), _hdr(nullptr), _ent(nullptr), _mounted(false) {
+    }
+
+    ~XIPFSImpl() override { }
+
+    FileImplPtr open(const char* path, OpenMode openMode, AccessMode accessMode) override;
+    DirImplPtr openDir(const char *path) override;
+    bool exists(const char* path) override;
+
+    bool rename(const char* pathFrom, const char* pathTo) override {
+        (void) pathFrom;
+        (void) pathTo;
+        return false; // Read-only
+    }
+
+    bool remove(const char* path) override {
+        (void) path;
+        return false; // Read-only
+    }
+
+    bool mkdir(const char* path) override {
+        (void) path;
+        return false; // Read-only
+    }
+
+    bool rmdir(const char* path) override {
+        (void) path;
+        return false; // Read-only
+    }
+
+    bool format() override {
+        return false; // Images are built on the host with mkxipfs.py
+    }
+
+    bool info(FSInfo& info) override {
+        if (!_mounted) {
+            return false;
+        }
+        info.blockSize = 4096;
+        info.pageSize = 256;
+        info.maxOpenFiles = 255; // No per-file state lives in the FS
+        info.maxPathLength = XIPFS_NAME_MAX;
+        info.totalBytes = _size;
+        info.usedBytes = _hdr->size;
+        return true;
+    }
+
+    bool info64(FSInfo64& info64) override {
+        FSInfo i;
+        if (!info(i)) {
+            return false;
+        }
+        info64.blockSize     = i.blockSize;
+        info64.pageSize      = i.pageSize;
+        info64.maxOpenFiles  = i.maxOpenFiles;
+        info64.maxPathLength = i.maxPathLength;
+        info64.totalBytes    = i.totalBytes;
+        info64.usedBytes     = i.usedBytes;
+        return true;
+    }
+
+    bool setConfig(const FSConfig &cfg) override {
+        if ((cfg._type != XIPFSConfig::FSId) || _mounted) {
+            return false;
+        }
+        _cfg = *static_cast<const XIPFSConfig *>(&cfg);
+        return true;
+    }
+
+    bool begin() override;
+
+    void end() override {
+        _mounted = false;
+        _hdr = nullptr;
+        _ent = nullptr;
+    }
+
+protected:
+    friend class XIPFSFileImpl;
+    friend class XIPFSDirImpl;
+
+    static const char *_skipSlash(const char *path) {
+        while (*path == '/') {
+            path++;
+        }
+        return path;
+    }
+
+    // Exact match, or nullptr
+    const XIPFSEntry *_find(const char *path) const;
+    // First entry whose name is >= path (may be one past the end)
+    int _lowerBound(const char *path) const;
+    // True if any file lives under "path/"
+    bool _isDir(const char *path) const;
+
+    const uint8_t *_data(const XIPFSEntry *e) const {
+        return _start + e->offset;
+    }
+
+    const uint8_t     *_start;
+    uint32_t           _size;
+    const XIPFSHeader *_hdr;
+    const XIPFSEntry  *_ent;
+    XIPFSConfig        _cfg;
+    bool               _mounted;
+};
+
+
+class XIPFSFileImpl : public FileImpl {
+public:
+    // A null entry represents a directory, so that File::openNextFile() can walk the tree
+    XIPFSFileImpl(XIPFSImpl *fs, const char *name, const XIPFSEntry *ent) : _fs(fs), _ent(ent), _pos(0), _opened(true) {
+        _name = std::shared_ptr<char>(new char[strlen(name) + 1], std::default_delete<char[]>());
+        strcpy(_name.get(), name);
+    }
+
+    ~XIPFSFileImpl() override { }
+
+    size_t write(const uint8_t *buf, size_t size) override {
+        (void) buf;
+        (void) size;
+        return 0; // Read-only
+    }
+
+    int read(uint8_t* buf, size_t size) override {
+        if (!_opened || !_ent || !buf) {
+            return 0;
+        }
+        size_t left = _ent->size - _pos;
+        if (size > left) {
+            size = left;
+        }
+        memcpy(buf, _fs->_data(_ent) + _pos, size);
+        _pos += size;
+        return size;
+    }
+
+    void flush() override {
+        /* NOOP */
+    }
+
+    bool seek(uint32_t pos, SeekMode mode) override {
+        if (!_opened || !_ent) {
+            return false;
+        }
+        int64_t newPos;
+        switch (mode) {
+        case SeekSet: newPos = pos; break;
+        case SeekCur: newPos = (int64_t)_pos + (int32_t)pos; break;
+        case SeekEnd: newPos = (int64_t)_ent->size - pos; break; // Matches LittleFS semantics
+        default: return false;
+        }
+        if ((newPos < 0) || (newPos > _ent->size)) {
+            return false;
+        }
+        _pos = (uint32_t)newPos;
+        return true;
+    }
+
+    size_t position() const override {
+        return _opened ? _pos : 0;
+    }
+
+    size_t size() const override {
+        return (_opened && _ent) ? _ent->size : 0;
+    }
+
+    bool truncate(uint32_t size) override {
+        (void) size;
+        return false; // Read-only
+    }
+
+    void close() override {
+        _opened = false;
+    }
+
+    const uint8_t *mmap() override {
+        return (_opened && _ent) ? _fs->_data(_ent) : nullptr;
+    }
+
+    time_t getLastWrite() override {
+        return (_opened && _ent) ? (time_t)_ent->mtime : 0;
+    }
+
+    time_t getCreationTime() override {
+        return getLastWrite(); // Only one timestamp is recorded by mkxipfs.py
+    }
+
+    const char* name() const override {
+        if (!_opened) {
+            return nullptr;
+        }
+        const char *p = _name.get();
+        const char *slash = strrchr(p, '/');
+        return (slash && slash[1]) ? slash + 1 : p;
+    }
+
+    const char* fullName() const override {
+        return _opened ? _name.get() : nullptr;
+    }
+
+    bool isFile() const override {
+        return _opened && _ent;
+    }
+
+    bool isDirectory() const override {
+        return _opened && !_ent;
+    }
+
+protected:
+    XIPFSImpl             *_fs;
+    const XIPFSEntry      *_ent;
+    std::shared_ptr<char>  _name;
+    uint32_t               _pos;
+    bool                   _opened;
+};
+
+
+class XIPFSDirImpl : public DirImpl {
+public:
+    // prefix is the directory path with trailing '/' ("" for root), filter an optional name prefix
+    XIPFSDirImpl(XIPFSImpl *fs, const String &prefix, const String &filter) : _fs(fs), _prefix(prefix), _filter(filter) {
+        rewind();
+    }
+
+    ~XIPFSDirImpl() override { }
+
+    FileImplPtr openFile(OpenMode openMode, AccessMode accessMode) override {
+        if (!_valid) {
+            return FileImplPtr();
+        }
+        String path = _prefix + _name;
+        return _fs->open(path.c_str(), openMode, accessMode);
+    }
+
+    const char* fileName() override {
+        return _valid ? _name.c_str() : nullptr;
+    }
+
+    size_t fileSize() override {
+        return (_valid && !_isDir) ? _fs->_ent[_idx].size : 0;
+    }
+
+    time_t fileTime() override {
+        return (_valid && !_isDir) ? (time_t)_fs->_ent[_idx].mtime : 0;
+    }
+
+    time_t fileCreationTime() override {
+        return fileTime();
+    }
+
+    bool isFile() const override {
+        return _valid && !_isDir;
+    }
+
+    bool isDirectory() const override {
+        return _valid && _isDir;
+    }
+
+    bool rewind() override {
+        _valid = false;
+        _idx = -1;
+        _next = _fs->_mounted ? _fs->_lowerBound(_prefix.c_str()) : 0;
+        return _fs->_mounted;
+    }
+
+    bool next() override;
+
+protected:
+    XIPFSImpl *_fs;
+    String     _prefix;
+    String     _filter;
+    String     _name;    // Current entry name, relative to _prefix
+    int        _idx;     // Current index into the entry table
+    int        _next;    // Next index to examine
+    bool       _isDir;
+    bool       _valid;
+};
+
+}; // namespace xipfs_impl
+
+#if !defined(NO_GLOBAL_INSTANCES) && !defined(NO_GLOBAL_XIPFS)
+extern FS XIPFS;
+using xipfs_impl::XIPFSConfig;
+#endif
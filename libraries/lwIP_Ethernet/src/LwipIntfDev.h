@@ -39,6 +39,7 @@
 #include <lwip/timeouts.h>
 #include <lwip/inet_chksum.h>
 #include <lwip/apps/sntp.h>
+#include <utility>
 
 
 #include "SPI.h"
@@ -170,6 +171,18 @@ public:
     // called on a regular basis or on interrupt
     err_t handlePackets();
 protected:
+    // Drivers with readFrameDataAsync()/readFrameDataDone() have the next
+    // frame's DMA running while the last one goes through lwIP
+    template<class U>
+    static constexpr auto _hasAsyncRead(int) -> decltype(std::declval<U&>().readFrameDataAsync((uint8_t*)nullptr, (uint16_t)0), bool()) {
+        return true;
+    }
+    template<class U>
+    static constexpr bool _hasAsyncRead(...) {
+        return false;
+    }
+    err_t _input(pbuf* pbuf, uint16_t tot_len);
+
     // members
     SPIClass& _spiUnit;
     SPISettings _spiSettings = SPISettings(4000000, MSBFIRST, SPI_MODE0);
@@ -538,19 +551,46 @@ void LwipIntfDev<RawDev>::check_route() {
     }
 }
 
+template<class RawDev>
+err_t LwipIntfDev<RawDev>::_input(pbuf* pbuf, uint16_t tot_len) {
+    _packetsReceived++;
+
+    err_t err = _netif.input(pbuf, &_netif);
+
+#if PHY_HAS_CAPTURE
+    if (phy_capture) {
+        phy_capture(_netif.num, (const char*)pbuf->payload, tot_len, /*out*/ 0,
+                    /*success*/ err == ERR_OK);
+    }
+#else
+    (void) tot_len;
+#endif
+
+    if (err != ERR_OK) {
+        pbuf_free(pbuf);
+    }
+    // (else) allocated pbuf is now lwIP's responsibility
+    return err;
+}
+
 template<class RawDev>
 err_t LwipIntfDev<RawDev>::handlePackets() {
+    // The frame already read and waiting to go to lwIP, async drivers only
+    pbuf* ready = nullptr;
+    uint16_t readyLen = 0;
+    err_t ret = ERR_OK;
+
     int pkt = 0;
     while (1) {
         if (++pkt == 10)
             // prevent starvation
         {
-            return ERR_OK;
+            break;
         }
 
         uint16_t tot_len = RawDev::readFrameSize();
         if (!tot_len) {
-            return ERR_OK;
+            break;
         }
 
         // from doc: use PBUF_RAM for TX, PBUF_POOL from RX
@@ -567,35 +607,47 @@ err_t LwipIntfDev<RawDev>::handlePackets() {
                 pbuf_free(pbuf);
             }
             RawDev::discardFrame(tot_len);
-            return ERR_BUF;
-        }
-
-        uint16_t len = RawDev::readFrameData((uint8_t*)pbuf->payload, tot_len);
-        if (len != tot_len) {
-            // tot_len is given by readFrameSize()
-            // and is supposed to be honoured by readFrameData()
-            // todo: ensure this test is unneeded, remove the print
-            pbuf_free(pbuf);
-            return ERR_BUF;
+            ret = ERR_BUF;
+            break;
         }
 
-        _packetsReceived++;
-
-        err_t err = _netif.input(pbuf, &_netif);
+        if constexpr(_hasAsyncRead<LwipIntfDev>(0)) {
+            // Pass the previous frame up while this one comes over the bus.
+            // Anything lwIP sends in the meantime waits for the read to end.
+            RawDev::readFrameDataAsync((uint8_t*)pbuf->payload, tot_len);
+            if (ready) {
+                ret = _input(ready, readyLen);
+            }
+            RawDev::readFrameDataDone();
+            ready = pbuf;
+            readyLen = tot_len;
+            if (ret != ERR_OK) {
+                break;
+            }
+        } else {
+            uint16_t len = RawDev::readFrameData((uint8_t*)pbuf->payload, tot_len);
+            if (len != tot_len) {
+                // tot_len is given by readFrameSize()
+                // and is supposed to be honoured by readFrameData()
+                // todo: ensure this test is unneeded, remove the print
+                pbuf_free(pbuf);
+                return ERR_BUF;
+            }
 
-#if PHY_HAS_CAPTURE
-        if (phy_capture) {
-            phy_capture(_netif.num, (const char*)pbuf->payload, tot_len, /*out*/ 0,
-                        /*success*/ err == ERR_OK);
+            err_t err = _input(pbuf, tot_len);
+            if (err != ERR_OK) {
+                return err;
+            }
         }
-#endif
+    }
 
-        if (err != ERR_OK) {
-            pbuf_free(pbuf);
-            return err;
+    if (ready) {
+        err_t err = _input(ready, readyLen);
+        if (ret == ERR_OK) {
+            ret = err;
         }
-        // (else) allocated pbuf is now lwIP's responsibility
     }
+    return ret;
 }
 
 template<class RawDev>
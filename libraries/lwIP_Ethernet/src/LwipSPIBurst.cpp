@@ -0,0 +1,109 @@
+/*
+    LwipSPIBurst.cpp - DMA SPI block transfers for the wired Ethernet drivers
+
+    Copyright (c) 2024 Earle F. Philhower, III <earlephilhower@yahoo.com>
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include "LwipSPIBurst.h"
+#include <algorithm>
+
+// Below this the FIFO loop is done before the DMA channels could be set up
+#define SPIBURST_DMA_MIN 32
+
+LwipSPIBurst::LwipSPIBurst(SPIClass &spi) : _spi(spi) {
+    // Only the RP2040's own ports can DMA
+    if (&spi == &SPI) {
+        _dma = &SPI;
+    } else if (&spi == &SPI1) {
+        _dma = &SPI1;
+    } else {
+        _dma = nullptr;
+    }
+}
+
+void LwipSPIBurst::_finish() {
+    while (!_dma->finishedAsync()) {
+        /* noop */
+    }
+    digitalWrite(_pendingCS, HIGH);
+    _pendingCS = -1;
+}
+
+void LwipSPIBurst::_send(const uint8_t *data, size_t len) {
+    if (_dma) {
+        _dma->transfer(data, nullptr, len);
+    } else {
+        for (size_t i = 0; i < len; i++) {
+            _spi.transfer(data[i]);
+        }
+    }
+}
+
+void LwipSPIBurst::_recv(uint8_t *data, size_t len) {
+    if (_dma && data) {
+        _dma->transfer(nullptr, data, len);
+    } else if (_dma) {
+        uint8_t sink[SPIBURST_DMA_MIN];
+        while (len) {
+            size_t n = std::min(len, sizeof(sink));
+            _dma->transfer(nullptr, sink, n);
+            len -= n;
+        }
+    } else {
+        for (size_t i = 0; i < len; i++) {
+            uint8_t b = _spi.transfer(0);
+            if (data) {
+                data[i] = b;
+            }
+        }
+    }
+}
+
+void LwipSPIBurst::write(const uint8_t *hdr, size_t hdrLen, const uint8_t *data, size_t len) {
+    wait();
+    _send(hdr, hdrLen);
+    if ((len >= SPIBURST_DMA_MIN) && _dma && _dma->transferAsync(data, nullptr, len)) {
+        while (!_dma->finishedAsync()) {
+            /* noop */
+        }
+    } else {
+        _send(data, len);
+    }
+}
+
+void LwipSPIBurst::read(const uint8_t *hdr, size_t hdrLen, uint8_t *data, size_t len) {
+    wait();
+    _send(hdr, hdrLen);
+    if ((len >= SPIBURST_DMA_MIN) && _dma && data && _dma->transferAsync(nullptr, data, len)) {
+        while (!_dma->finishedAsync()) {
+            /* noop */
+        }
+    } else {
+        _recv(data, len);
+    }
+}
+
+void LwipSPIBurst::readAsync(int8_t cs, const uint8_t *hdr, size_t hdrLen, uint8_t *data, size_t len) {
+    wait();
+    _send(hdr, hdrLen);
+    if ((len >= SPIBURST_DMA_MIN) && _dma && data && _dma->transferAsync(nullptr, data, len)) {
+        _pendingCS = cs;
+    } else {
+        _recv(data, len);
+        digitalWrite(cs, HIGH);
+    }
+}
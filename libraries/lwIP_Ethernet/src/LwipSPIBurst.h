@@ -0,0 +1,73 @@
+/*
+    LwipSPIBurst.h - DMA SPI block transfers for the wired Ethernet drivers
+
+    Copyright (c) 2024 Earle F. Philhower, III <earlephilhower@yahoo.com>
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#pragma once
+
+#include <Arduino.h>
+#include <SPI.h>
+
+// Moves a command header and a block of frame data over SPI in a single chip
+// select.  On the RP2040's own SPI ports the header goes through the FIFO and
+// the data by SPI.transferAsync()'s DMA, any other SPIClass falls back to
+// byte transfers.
+//
+// The caller drives the chip select.  readAsync() is the exception: it
+// returns while the DMA is still running and raises CS itself once wait()
+// sees the transfer finish, so the CPU can hand the previous frame to lwIP
+// in the meantime.  Drivers must call wait() before starting anything else
+// on the bus.
+class LwipSPIBurst {
+public:
+    LwipSPIBurst(SPIClass &spi);
+    ~LwipSPIBurst() {
+        wait();
+    }
+
+    // Sends hdr and then data
+    void write(const uint8_t *hdr, size_t hdrLen, const uint8_t *data, size_t len);
+
+    // Sends hdr and then reads len bytes into data, or discards them if
+    // data is nullptr
+    void read(const uint8_t *hdr, size_t hdrLen, uint8_t *data, size_t len);
+
+    // Starts a read() and returns before the data has arrived.  If the DMA
+    // can't be used this does the whole read() and raises CS at once
+    void readAsync(int8_t cs, const uint8_t *hdr, size_t hdrLen, uint8_t *data, size_t len);
+
+    // Finishes an outstanding readAsync(), if any
+    void wait() {
+        if (_pendingCS >= 0) {
+            _finish();
+        }
+    }
+
+    bool busy() const {
+        return _pendingCS >= 0;
+    }
+
+private:
+    void _finish();
+    void _send(const uint8_t *data, size_t len);
+    void _recv(uint8_t *data, size_t len);
+
+    SPIClass &_spi;
+    SPIClassRP2040 *_dma;
+    int8_t _pendingCS = -1;
+};
@@ -156,10 +156,12 @@
 // The ENC28J60 SPI Interface supports clock speeds up to 20 MHz
 static const SPISettings spiSettings(20000000, MSBFIRST, SPI_MODE0);
 
-ENC28J60::ENC28J60(int8_t cs, SPIClass& spi, int8_t intr) : _bank(ERXTX_BANK), _cs(cs), _intr(intr), _spi(spi) {
+// Bursts go to SPI, like all the other transfers here
+ENC28J60::ENC28J60(int8_t cs, SPIClass& spi, int8_t intr) : _bank(ERXTX_BANK), _cs(cs), _intr(intr), _spi(spi), _burst(SPI) {
 }
 
 void ENC28J60::enc28j60_arch_spi_select(void) {
+    _burst.wait();
     SPI.beginTransaction(spiSettings);
     digitalWrite(_cs, LOW);
 }
@@ -232,13 +234,10 @@ void ENC28J60::setregbank(uint8_t new_bank) {
 }
 /*---------------------------------------------------------------------------*/
 void ENC28J60::writedata(const uint8_t* data, int datalen) {
-    int i;
-    enc28j60_arch_spi_select();
     /* The Write Buffer Memory (WBM) command is 0 1 1 1 1 0 1 0  */
-    SPI.transfer(0x7a);
-    for (i = 0; i < datalen; i++) {
-        SPI.transfer(data[i]);
-    }
+    static const uint8_t wbm = 0x7a;
+    enc28j60_arch_spi_select();
+    _burst.write(&wbm, 1, data, datalen);
     enc28j60_arch_spi_deselect();
 }
 /*---------------------------------------------------------------------------*/
@@ -246,16 +245,14 @@ void ENC28J60::writedatabyte(uint8_t byte) {
     writedata(&byte, 1);
 }
 /*---------------------------------------------------------------------------*/
+/* THe Read Buffer Memory (RBM) command is 0 0 1 1 1 0 1 0 */
+static const uint8_t rbm = 0x3a;
+
 int ENC28J60::readdata(uint8_t* buf, int len) {
-    int i;
     enc28j60_arch_spi_select();
-    /* THe Read Buffer Memory (RBM) command is 0 0 1 1 1 0 1 0 */
-    SPI.transfer(0x3a);
-    for (i = 0; i < len; i++) {
-        buf[i] = SPI.transfer(0);
-    }
+    _burst.read(&rbm, 1, buf, len);
     enc28j60_arch_spi_deselect();
-    return i;
+    return len;
 }
 /*---------------------------------------------------------------------------*/
 uint8_t ENC28J60::readdatabyte(void) {
@@ -527,6 +524,16 @@ uint16_t ENC28J60::sendFrame(const uint8_t* data, uint16_t datalen) {
 
     ethernet_arch_lwip_gpio_mask(); // So we don't fire an IRQ and interrupt the send w/a receive!
 
+    /*  The previous frame shares the transmit buffer, so it has to be out
+        before this one is written.  It normally is by now, while waiting
+        for it right after setting TXRTS would spin for the whole time on
+        the wire. */
+    if (_sendPending) {
+        while ((readreg(ECON1) & ECON1_TXRTS) > 0)
+            ;
+        _sendPending = false;
+    }
+
     /*
         1. Appropriately program the ETXST pointer to point to an unused
          location in memory. It will point to the per packet control
@@ -557,10 +564,12 @@ uint16_t ENC28J60::sendFrame(const uint8_t* data, uint16_t datalen) {
 
     /*  Write the transmission control register as the first byte of the
         output packet. We write 0x00 to indicate that the default
-        configuration (the values in MACON3) will be used.  */
-    writedatabyte(0x00); /* MACON3 */
-
-    writedata(data, datalen);
+        configuration (the values in MACON3) will be used.  It goes
+        in the same WBM command as the frame. */
+    static const uint8_t wbm[2] = { 0x7a, 0x00 /* MACON3 */ };
+    enc28j60_arch_spi_select();
+    _burst.write(wbm, sizeof(wbm), data, datalen);
+    enc28j60_arch_spi_deselect();
 
     /* Write a pointer to the last data byte. */
     dataend = TX_BUF_START + datalen;
@@ -574,10 +583,12 @@ uint16_t ENC28J60::sendFrame(const uint8_t* data, uint16_t datalen) {
 
     /* Send the packet */
     setregbitfield(ECON1, ECON1_TXRTS);
-    while ((readreg(ECON1) & ECON1_TXRTS) > 0)
-        ;
+    _sendPending = true;
 
 #if DEBUG
+    while ((readreg(ECON1) & ECON1_TXRTS) > 0)
+        ;
+    _sendPending = false;
     if ((readreg(ESTAT) & ESTAT_TXABRT) != 0) {
         uint16_t erdpt;
         uint8_t  tsv[7];
@@ -615,9 +626,10 @@ uint16_t ENC28J60::readFrame(uint8_t* buffer, uint16_t bufsize) {
 uint16_t ENC28J60::readFrameSize() {
     uint8_t n;
 
-    uint8_t nxtpkt[2];
-    uint8_t status[2];
-    uint8_t length[2];
+    uint8_t rsv[6];
+    uint8_t *nxtpkt = &rsv[0];
+    uint8_t *length = &rsv[2];
+    uint8_t *status = &rsv[4];
 
     setregbank(EPKTCNT_BANK);
     n = readreg(EPKTCNT);
@@ -629,22 +641,16 @@ uint16_t ENC28J60::readFrameSize() {
     PRINTF("enc28j60: EPKTCNT 0x%02x\n", n);
 
     setregbank(ERXTX_BANK);
-    /* Read the next packet pointer */
-    nxtpkt[0] = readdatabyte();
-    nxtpkt[1] = readdatabyte();
+    /* The next packet pointer, length and status come in one read */
+    readdata(rsv, sizeof(rsv));
     _next     = (nxtpkt[1] << 8) + nxtpkt[0];
 
     PRINTF("enc28j60: nxtpkt 0x%02x%02x\n", _nxtpkt[1], _nxtpkt[0]);
 
-    length[0] = readdatabyte();
-    length[1] = readdatabyte();
     _len      = (length[1] << 8) + length[0];
 
     PRINTF("enc28j60: length 0x%02x%02x\n", length[1], length[0]);
 
-    status[0] = readdatabyte();
-    status[1] = readdatabyte();
-
     /* This statement is just to avoid a compiler warning: */
     (void)status[0];
     PRINTF("enc28j60: status 0x%02x%02x\n", status[1], status[0]);
@@ -660,19 +666,16 @@ void ENC28J60::discardFrame(uint16_t framesize) {
 uint16_t ENC28J60::readFrameData(uint8_t* buffer, uint16_t framesize) {
     if (framesize < _len) {
         buffer = nullptr;
-
-        /* flush rx fifo */
-        for (uint16_t i = 0; i < _len; i++) {
-            readdatabyte();
-        }
-    } else {
-        readdata(buffer, _len);
     }
 
-    /* Read an additional byte at odd lengths, to avoid FIFO corruption */
-    if ((_len % 2) != 0) {
-        readdatabyte();
+    /*  Flush the frame from the rx fifo if there's no room for it.  Read an
+        additional byte at odd lengths, to avoid FIFO corruption */
+    enc28j60_arch_spi_select();
+    _burst.read(&rbm, 1, buffer, buffer ? _len : _len + (_len % 2));
+    if (buffer && ((_len % 2) != 0)) {
+        _burst.read(nullptr, 0, nullptr, 1);
     }
+    enc28j60_arch_spi_deselect();
 
     /* Errata #14 */
     if (_next == RX_BUF_START) {
@@ -699,6 +702,32 @@ uint16_t ENC28J60::readFrameData(uint8_t* buffer, uint16_t framesize) {
     return _len;
 }
 
+void ENC28J60::readFrameDataAsync(uint8_t* buffer, uint16_t framesize) {
+    /* readFrameDataDone() skips any of the frame left unread */
+    enc28j60_arch_spi_select();
+    _burst.readAsync(_cs, &rbm, 1, buffer, (framesize < _len) ? framesize : _len);
+    /* The transaction only covers the GPIO IRQ masks, the bus is held until CS rises */
+    SPI.endTransaction();
+}
+
+void ENC28J60::readFrameDataDone() {
+    /*  lwIP may have sent frames while the data came in.  Point the read
+        pointer at the next frame directly rather than reading the odd
+        length padding byte. */
+    if (_bank != ERXTX_BANK) {
+        setregbank(ERXTX_BANK);
+    }
+    writereg(ERDPTL, _next & 0xff);
+    writereg(ERDPTH, _next >> 8);
+
+    /* Errata #14 */
+    uint16_t rdpt = (_next == RX_BUF_START) ? RX_BUF_END : _next - 1;
+    writereg(ERXRDPTL, rdpt & 0xff);
+    writereg(ERXRDPTH, rdpt >> 8);
+
+    setregbitfield(ECON2, ECON2_PKTDEC);
+}
+
 uint16_t ENC28J60::phyread(uint8_t reg) {
     // ( https://github.com/JAndrassy/EthernetENC/tree/master/src/utility/enc28j60.h )
 
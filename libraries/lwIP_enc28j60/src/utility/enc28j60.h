@@ -40,6 +40,7 @@
 #define ENC28J60_H
 
 #include <SPI.h>
+#include <LwipSPIBurst.h>
 
 /**
     Send and receive Ethernet frames directly using a ENC28J60 controller.
@@ -135,6 +136,22 @@ protected:
     */
     uint16_t readFrameData(uint8_t* frame, uint16_t framesize);
 
+    /**
+        Start reading an Ethernet frame's data by DMA
+           Like readFrameData(), but returns while the data is still
+           arriving.  readFrameDataDone() must be called before the
+           buffer is used
+        @param buffer a pointer to a buffer to write the frame to
+        @param framesize readFrameSize()'s result
+    */
+    void readFrameDataAsync(uint8_t* frame, uint16_t framesize);
+
+    /**
+        Wait for readFrameDataAsync() to finish and release the frame
+        in the chip
+    */
+    void readFrameDataDone();
+
 private:
     uint8_t is_mac_mii_reg(uint8_t reg);
     uint8_t readreg(uint8_t reg);
@@ -165,6 +182,8 @@ private:
     int8_t    _cs;
     int8_t    _intr;
     SPIClass& _spi;
+    LwipSPIBurst _burst;
+    bool _sendPending = false; // TXRTS set, not yet seen to clear
 
     const uint8_t* _localMac;
 
@@ -36,14 +36,14 @@
 #include "w5100.h"
 #include <LwipEthernet.h>
 
+// The W5100 has no burst mode, every byte is its own 4 byte command.  Sending
+// each command as one block at least saves the per-byte round trips.
 uint8_t Wiznet5100::wizchip_read(uint16_t address) {
     uint8_t ret;
+    uint8_t cmd[3] = { 0x0F, (uint8_t)(address >> 8), (uint8_t)address };
 
     wizchip_cs_select();
-    _spi.transfer(0x0F);
-    _spi.transfer((address & 0xFF00) >> 8);
-    _spi.transfer((address & 0x00FF) >> 0);
-    ret = _spi.transfer(0);
+    _burst.read(cmd, sizeof(cmd), &ret, 1);
     wizchip_cs_deselect();
 
     return ret;
@@ -60,11 +60,10 @@ void Wiznet5100::wizchip_read_buf(uint16_t address, uint8_t* pBuf, uint16_t len)
 }
 
 void Wiznet5100::wizchip_write(uint16_t address, uint8_t wb) {
+    uint8_t cmd[4] = { 0xF0, (uint8_t)(address >> 8), (uint8_t)address, wb };
+
     wizchip_cs_select();
-    _spi.transfer(0xF0);
-    _spi.transfer((address & 0xFF00) >> 8);
-    _spi.transfer((address & 0x00FF) >> 0);
-    _spi.transfer(wb);  // Data write (write 1byte data)
+    _burst.write(cmd, sizeof(cmd), nullptr, 0);
     wizchip_cs_deselect();
 }
 
@@ -179,7 +178,7 @@ void Wiznet5100::wizchip_sw_reset() {
     setSHAR(_mac_address);
 }
 
-Wiznet5100::Wiznet5100(int8_t cs, SPIClass& spi, int8_t intr) : _spi(spi), _cs(cs), _intr(intr) {
+Wiznet5100::Wiznet5100(int8_t cs, SPIClass& spi, int8_t intr) : _spi(spi), _cs(cs), _intr(intr), _burst(spi) {
 }
 
 bool Wiznet5100::begin(const uint8_t* mac_address, netif *net) {
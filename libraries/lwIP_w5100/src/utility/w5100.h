@@ -38,6 +38,7 @@
 #include <stdint.h>
 #include <Arduino.h>
 #include <SPI.h>
+#include <LwipSPIBurst.h>
 
 class Wiznet5100 {
 public:
@@ -150,6 +151,7 @@ private:
     int8_t    _cs;
     int8_t    _intr;
     uint8_t   _mac_address[6];
+    LwipSPIBurst _burst;
 
     /**
         Default function to select chip.
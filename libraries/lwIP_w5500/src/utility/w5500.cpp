@@ -39,17 +39,7 @@
 uint8_t Wiznet5500::wizchip_read(uint8_t block, uint16_t address) {
     uint8_t ret;
 
-    wizchip_cs_select();
-
-    block |= AccessModeRead;
-
-    wizchip_spi_write_byte((address & 0xFF00) >> 8);
-    wizchip_spi_write_byte((address & 0x00FF) >> 0);
-    wizchip_spi_write_byte(block);
-
-    ret = wizchip_spi_read_byte();
-
-    wizchip_cs_deselect();
+    wizchip_read_buf(block, address, &ret, 1);
     return ret;
 }
 
@@ -58,33 +48,15 @@ uint16_t Wiznet5500::wizchip_read_word(uint8_t block, uint16_t address) {
 }
 
 void Wiznet5500::wizchip_read_buf(uint8_t block, uint16_t address, uint8_t* pBuf, uint16_t len) {
-    uint16_t i;
+    uint8_t hdr[3] = { (uint8_t)(address >> 8), (uint8_t)address, (uint8_t)(block | AccessModeRead) };
 
     wizchip_cs_select();
-
-    block |= AccessModeRead;
-
-    wizchip_spi_write_byte((address & 0xFF00) >> 8);
-    wizchip_spi_write_byte((address & 0x00FF) >> 0);
-    wizchip_spi_write_byte(block);
-    for (i = 0; i < len; i++) {
-        pBuf[i] = wizchip_spi_read_byte();
-    }
-
+    _burst.read(hdr, sizeof(hdr), pBuf, len);
     wizchip_cs_deselect();
 }
 
 void Wiznet5500::wizchip_write(uint8_t block, uint16_t address, uint8_t wb) {
-    wizchip_cs_select();
-
-    block |= AccessModeWrite;
-
-    wizchip_spi_write_byte((address & 0xFF00) >> 8);
-    wizchip_spi_write_byte((address & 0x00FF) >> 0);
-    wizchip_spi_write_byte(block);
-    wizchip_spi_write_byte(wb);
-
-    wizchip_cs_deselect();
+    wizchip_write_buf(block, address, &wb, 1);
 }
 
 void Wiznet5500::wizchip_write_word(uint8_t block, uint16_t address, uint16_t word) {
@@ -94,19 +66,10 @@ void Wiznet5500::wizchip_write_word(uint8_t block, uint16_t address, uint16_t wo
 
 void Wiznet5500::wizchip_write_buf(uint8_t block, uint16_t address, const uint8_t* pBuf,
                                    uint16_t len) {
-    uint16_t i;
+    uint8_t hdr[3] = { (uint8_t)(address >> 8), (uint8_t)address, (uint8_t)(block | AccessModeWrite) };
 
     wizchip_cs_select();
-
-    block |= AccessModeWrite;
-
-    wizchip_spi_write_byte((address & 0xFF00) >> 8);
-    wizchip_spi_write_byte((address & 0x00FF) >> 0);
-    wizchip_spi_write_byte(block);
-    for (i = 0; i < len; i++) {
-        wizchip_spi_write_byte(pBuf[i]);
-    }
-
+    _burst.write(hdr, sizeof(hdr), pBuf, len);
     wizchip_cs_deselect();
 }
 
@@ -239,12 +202,13 @@ int8_t Wiznet5500::wizphy_setphypmode(uint8_t pmode) {
     return -1;
 }
 
-Wiznet5500::Wiznet5500(int8_t cs, SPIClass& spi, int8_t intr) : _spi(spi), _cs(cs), _intr(intr) {
+Wiznet5500::Wiznet5500(int8_t cs, SPIClass& spi, int8_t intr) : _spi(spi), _cs(cs), _intr(intr), _burst(spi) {
 }
 
 bool Wiznet5500::begin(const uint8_t* mac_address, netif *net) {
     _netif = net;
     memcpy(_mac_address, mac_address, 6);
+    _sendPending = false;
 
     pinMode(_cs, OUTPUT);
     wizchip_cs_deselect();
@@ -268,6 +232,8 @@ bool Wiznet5500::begin(const uint8_t* mac_address, netif *net) {
 
     if (_intr >= 0) {
         setSn_IR(0xff); // Clear everything
+        // SEND_OK is left set until the next send, so only RECV may interrupt
+        setSn_IMR(Sn_IR_RECV);
         setSIMR(1);
     }
 
@@ -314,8 +280,11 @@ uint16_t Wiznet5500::readFrameSize() {
     uint8_t  head[2];
     uint16_t data_len = 0;
 
-    wizchip_recv_data(head, 2);
-    setSn_CR(Sn_CR_RECV);
+    // The read pointer is only written back, with a single RECV, once the
+    // frame after the length header has been read too
+    _rxPtr = getSn_RX_RD();
+    wizchip_read_buf(BlockSelectRxBuf, _rxPtr, head, 2);
+    _rxPtr += 2;
 
     data_len = head[0];
     data_len = (data_len << 8) + head[1];
@@ -325,18 +294,33 @@ uint16_t Wiznet5500::readFrameSize() {
 }
 
 void Wiznet5500::discardFrame(uint16_t framesize) {
-    wizchip_recv_ignore(framesize);
+    setSn_RX_RD(_rxPtr + framesize);
     setSn_CR(Sn_CR_RECV);
 }
 
 uint16_t Wiznet5500::readFrameData(uint8_t* buffer, uint16_t framesize) {
-    wizchip_recv_data(buffer, framesize);
+    wizchip_read_buf(BlockSelectRxBuf, _rxPtr, buffer, framesize);
+    setSn_RX_RD(_rxPtr + framesize);
     setSn_CR(Sn_CR_RECV);
 
     // let lwIP deal with mac address filtering
     return framesize;
 }
 
+void Wiznet5500::readFrameDataAsync(uint8_t* buffer, uint16_t framesize) {
+    uint8_t hdr[3] = { (uint8_t)(_rxPtr >> 8), (uint8_t)_rxPtr, (uint8_t)(BlockSelectRxBuf | AccessModeRead) };
+
+    wizchip_cs_select();
+    _burst.readAsync(_cs, hdr, sizeof(hdr), buffer, framesize);
+    _rxPtr += framesize;
+}
+
+void Wiznet5500::readFrameDataDone() {
+    // Any register access waits for the DMA and raises CS first
+    setSn_RX_RD(_rxPtr);
+    setSn_CR(Sn_CR_RECV);
+}
+
 uint16_t Wiznet5500::sendFrame(const uint8_t* buf, uint16_t len) {
     ethernet_arch_lwip_gpio_mask(); // So we don't fire an IRQ and interrupt the send w/a receive!
 
@@ -352,23 +336,30 @@ uint16_t Wiznet5500::sendFrame(const uint8_t* buf, uint16_t len) {
         }
     };
 
-    wizchip_send_data(buf, len);
-    setSn_CR(Sn_CR_SEND);
+    // Copy the frame in behind the one that may still be going out
+    uint16_t ptr = getSn_TX_WR();
+    wizchip_write_buf(BlockSelectTxBuf, ptr, buf, len);
 
-    while (1) {
+    // Only one SEND can be outstanding.  Rather than spin here while this
+    // frame goes out on the wire, wait for the previous one, which has
+    // normally finished while lwIP built this frame
+    while (_sendPending) {
         uint8_t tmp = getSn_IR();
         if (tmp & Sn_IR_SENDOK) {
             setSn_IR(Sn_IR_SENDOK);
             // Packet sent ok
-            break;
+            _sendPending = false;
         } else if (tmp & Sn_IR_TIMEOUT) {
             setSn_IR(Sn_IR_TIMEOUT);
-            // There was a timeout
-            ethernet_arch_lwip_gpio_unmask();
-            return -1;
+            // There was a timeout, the previous frame was lost
+            _sendPending = false;
         }
     }
 
+    setSn_TX_WR(ptr + len);
+    setSn_CR(Sn_CR_SEND);
+    _sendPending = true;
+
     ethernet_arch_lwip_gpio_unmask();
     return len;
 }
@@ -39,6 +39,7 @@
 #include <Arduino.h>
 #include <SPI.h>
 #include <LwipEthernet.h>
+#include <LwipSPIBurst.h>
 
 class Wiznet5500 {
 public:
@@ -137,6 +138,22 @@ protected:
     */
     uint16_t readFrameData(uint8_t* frame, uint16_t framesize);
 
+    /**
+        Start reading an Ethernet frame's data by DMA
+           Like readFrameData(), but returns while the data is still
+           arriving.  readFrameDataDone() must be called before the
+           buffer is used
+        @param buffer a pointer to a buffer to write the frame to
+        @param framesize readFrameSize()'s result
+    */
+    void readFrameDataAsync(uint8_t* frame, uint16_t framesize);
+
+    /**
+        Wait for readFrameDataAsync() to finish and release the frame
+        in the chip
+    */
+    void readFrameDataDone();
+
 private:
     //< SPI interface Read operation in Control Phase
     static const uint8_t AccessModeRead = (0x00 << 2);
@@ -160,6 +177,9 @@ private:
     int8_t    _cs;
     int8_t    _intr;
     uint8_t   _mac_address[6];
+    LwipSPIBurst _burst;
+    uint16_t  _rxPtr;               // RX buffer offset of the frame being read
+    bool      _sendPending = false; // SEND issued, SEND_OK not yet seen
 
     /**
         Default function to select chip.
@@ -167,6 +187,7 @@ private:
         or register any functions, null function is called.
     */
     inline void wizchip_cs_select() {
+        _burst.wait();
         digitalWrite(_cs, LOW);
     }
 
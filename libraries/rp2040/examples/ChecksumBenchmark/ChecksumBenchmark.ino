@@ -0,0 +1,116 @@
+// Compares the core's DMA sniffer checksums against a plain bitwise CRC32 and
+// the lookup table fallback, on data in RAM and in flash.  Then checks the
+// Internet checksum lwIP uses against a bytewise sum at every alignment, and
+// times it against a plain C loop for packet sized buffers
+//
+// Released to the public domain by Earle F. Philhower, III, 2024
+
+#include <Checksum.h>
+
+uint8_t ram[32768];
+
+uint32_t bitwiseCRC32(uint32_t crc, const void *data, size_t len) {
+  const uint8_t *p = (const uint8_t *)data;
+  crc = ~crc;
+  while (len--) {
+    crc ^= *p++;
+    for (int j = 0; j < 8; j++) {
+      crc = (crc >> 1) ^ ((crc & 1) ? 0xedb88320 : 0);
+    }
+  }
+  return ~crc;
+}
+
+// Calls under 64 bytes always use the tables
+uint32_t tableCRC32(uint32_t crc, const void *data, size_t len) {
+  const uint8_t *p = (const uint8_t *)data;
+  for (size_t i = 0; i < len; i += 32) {
+    crc = checksumCRC32(crc, p + i, std::min((size_t)32, len - i));
+  }
+  return crc;
+}
+
+void bench(const char *name, const void *data, size_t len) {
+  uint32_t t0 = micros();
+  uint32_t a = bitwiseCRC32(0, data, len);
+  uint32_t t1 = micros();
+  uint32_t b = tableCRC32(0, data, len);
+  uint32_t t2 = micros();
+  uint32_t c = checksumCRC32(0, data, len);
+  uint32_t t3 = micros();
+  uint16_t d = checksumCRC16(0, data, len);
+  uint32_t t4 = micros();
+  uint32_t e = checksumSum(0, data, len);
+  uint32_t t5 = micros();
+  Serial.printf("%-6s %6zu bytes: bitwise %6lu us, table %6lu us, DMA %6lu us  %s\n", name, len, t1 - t0, t2 - t1, t3 - t2,
+                (a == b) && (b == c) ? "CRC32 matches" : "CRC32 MISMATCH");
+  Serial.printf("%-6s %6s        CRC16 DMA %6lu us (0x%04x), sum DMA %6lu us (0x%08lx)\n", "", "", t4 - t3, d, t5 - t4, e);
+}
+
+// Byte i is the low half of a host order word when i is even
+uint16_t bytewiseInternet(const void *data, size_t len) {
+  const uint8_t *p = (const uint8_t *)data;
+  uint32_t sum = 0;
+  for (size_t i = 0; i < len; i++) {
+    sum += (uint32_t)p[i] << ((i & 1) * 8);
+  }
+  while (sum >> 16) {
+    sum = (sum & 0xffff) + (sum >> 16);
+  }
+  return sum;
+}
+
+// A 16 bits at a time C loop, for buffers starting on an even address
+uint16_t cInternet(const void *data, size_t len) {
+  const uint16_t *p = (const uint16_t *)data;
+  uint32_t sum = 0;
+  for (; len > 1; len -= 2) {
+    sum += *p++;
+  }
+  if (len) {
+    sum += *(const uint8_t *)p;
+  }
+  sum = (sum & 0xffff) + (sum >> 16);
+  return (sum & 0xffff) + (sum >> 16);
+}
+
+void benchInternet() {
+  bool ok = true;
+  for (size_t off = 0; off < 4; off++) {
+    for (size_t len = 0; len < 2048; len++) {
+      ok &= checksumInternet(0, ram + off, len) == bytewiseInternet(ram + off, len);
+    }
+  }
+  Serial.printf("\nInternet checksum %s at every alignment up to 2K\n", ok ? "matches" : "MISMATCHES");
+  for (size_t len : { 20, 64, 576, 1460, 8192 }) {
+    const int reps = 100;
+    volatile uint16_t a, b;
+    uint32_t t0 = rp2040.getCycleCount();
+    for (int i = 0; i < reps; i++) {
+      a = cInternet(ram, len);
+    }
+    uint32_t t1 = rp2040.getCycleCount();
+    for (int i = 0; i < reps; i++) {
+      b = checksumInternet(0, ram, len);
+    }
+    uint32_t t2 = rp2040.getCycleCount();
+    Serial.printf("%5zu bytes: C loop %6lu cycles, core %6lu cycles  %s\n", len, (t1 - t0) / reps, (t2 - t1) / reps, a == b ? "" : "MISMATCH");
+  }
+}
+
+void setup() {
+  Serial.begin(115200);
+  delay(5000);
+  Serial.printf("CRC32(\"123456789\") = 0x%08lx, expected 0xcbf43926\n", checksumCRC32(0, "123456789", 9));
+  Serial.printf("CRC16(\"123456789\") = 0x%04x, expected 0x31c3\n\n", checksumCRC16(0, "123456789", 9));
+  for (size_t i = 0; i < sizeof(ram); i++) {
+    ram[i] = rand();
+  }
+  bench("RAM", ram, sizeof(ram));
+  // The start of the sketch itself
+  bench("Flash", (const void *)XIP_BASE, 65536);
+  benchInternet();
+}
+
+void loop() {
+}
@@ -29,6 +29,8 @@
 #include <hardware/watchdog.h>
 #include "ota_lfs.h"
 #include "ota_command.h"
+#include "ota_crc.h"
+#include "ota_patch.h"
 
 //#define DEBUG 1
 
@@ -37,6 +39,13 @@
 #define uart_puts(a, b)
 #endif
 
+// Kept in the image by memmap_ota.ld and looked for by PicoOTA::bootloaderFeatures()
+__attribute__((used, section(".ota_features")))
+const OTAFeatures _ota_features = {
+    _OTA_FEATURES_SIGN,
+    _OTA_FEATURE_PATCH | _OTA_FEATURE_LZ4 | _OTA_FEATURE_COPY
+};
+
 uint8_t **__FS_START__ = (uint8_t **)(XIP_BASE + 0x3000 - 0x10 + 0x0);
 uint8_t **__FS_END__   = (uint8_t **)(XIP_BASE + 0x3000 - 0x10 + 0x4);
 
@@ -53,40 +62,64 @@ void dumphex(uint32_t x) {
 #endif
 }
 
-extern OTACmdPage _ota_cmd;
-void do_ota() {
-    if (*__FS_START__ == *__FS_END__) {
-        return;
+// Copies an image the Updater wrote straight to flash (A/B slot mode).  The slot
+// itself is never modified, so after a power failure the copy just runs again,
+// skipping the sectors which were already done
+static bool otaCopy(uint8_t *slot, uint32_t length, uint8_t *dest, uint32_t crc) {
+    uint8_t page[FLASH_PAGE_SIZE]; // XIP is off while programming, so go via RAM
+    if (otaCRC32(0, slot, length) != crc) {
+        return false;
     }
-    if (!lfsMount(*__FS_START__, 4096, *__FS_END__ - *__FS_START__)) {
-        uart_puts(uart0, "mount failed\n");
-        return;
+    for (uint32_t off = 0; off < length; off += 4096) {
+        if (memcmp(slot + off, dest + off, 4096)) {
+            int save = save_and_disable_interrupts();
+            flash_range_erase((intptr_t)dest + off - XIP_BASE, 4096);
+            restore_interrupts(save);
+            for (uint32_t p = 0; p < 4096; p += FLASH_PAGE_SIZE) {
+                memcpy(page, slot + off + p, FLASH_PAGE_SIZE);
+                save = save_and_disable_interrupts();
+                flash_range_program((intptr_t)dest + off + p - XIP_BASE, page, FLASH_PAGE_SIZE);
+                restore_interrupts(save);
+            }
+        }
     }
+    return otaCRC32(0, dest, length) == crc;
+}
 
-    // We are very naughty and record the last block read, since it should be the actual data block of the
-    // OTA structure.  We'll erase it behind the scenes to avoid bringing in all of LittleFS write infra.
-    uint32_t blockToErase;
-    if (!lfsReadOTA(&_ota_cmd, &blockToErase)) {
-        return;
-    }
+extern OTACmdPage _ota_cmd;
+void do_ota() {
+#ifdef DEBUG
+    uint32_t start = time_us_32();
+#endif
+    // Slot updates leave their command page just below the filesystem, which
+    // may even be empty
+    uint8_t *cmdSector = *__FS_START__ - _OTA_COMMAND_SECTOR;
+    uint32_t blockToErase = 0;
+    if (!memcmp(cmdSector, "Pico OTA", 8) &&
+            (otaCRC32(0, cmdSector, offsetof(OTACmdPage, crc32)) == ((OTACmdPage *)cmdSector)->crc32)) {
+        memcpy(&_ota_cmd, cmdSector, sizeof(_ota_cmd));
+    } else {
+        cmdSector = NULL;
+        if (*__FS_START__ == *__FS_END__) {
+            return;
+        }
+        if (!lfsMount(*__FS_START__, 4096, *__FS_END__ - *__FS_START__)) {
+            uart_puts(uart0, "mount failed\n");
+            return;
+        }
 
-    if (memcmp(_ota_cmd.sign, "Pico OTA", 8)) {
-        return; // No signature
-    }
+        // We are very naughty and record the last block read, since it should be the actual data block of the
+        // OTA structure.  We'll erase it behind the scenes to avoid bringing in all of LittleFS write infra.
+        if (!lfsReadOTA(&_ota_cmd, &blockToErase)) {
+            return;
+        }
 
-    uint32_t crc = 0xffffffff;
-    const uint8_t *data = (const uint8_t *)&_ota_cmd;
-    for (uint32_t i = 0; i < offsetof(OTACmdPage, crc32); i++) {
-        crc ^= data[i];
-        for (int j = 0; j < 8; j++) {
-            if (crc & 1) {
-                crc = (crc >> 1) ^ 0xedb88320;
-            } else {
-                crc >>= 1;
-            }
+        if (memcmp(_ota_cmd.sign, "Pico OTA", 8)) {
+            return; // No signature
         }
     }
-    crc = ~crc;
+
+    uint32_t crc = otaCRC32(0, &_ota_cmd, offsetof(OTACmdPage, crc32));
     if (crc != _ota_cmd.crc32) {
         uart_puts(uart0, "\ncrc32 mismatch\n");
         return;
@@ -99,7 +132,19 @@ void do_ota() {
 
     for (uint32_t i = 0; i < _ota_cmd.count; i++) {
         switch (_ota_cmd.cmd[i].command) {
-            case _OTA_WRITE:
+            case _OTA_WRITE: {
+                // Delta patches are recognized by their header and applied in place
+                uart_puts(uart0, "patch: ");
+                int ret = otaPatch(_ota_cmd.cmd[i].write.filename, _ota_cmd.cmd[i].write.fileOffset, _ota_cmd.cmd[i].write.fileLength,
+                                   (uint8_t *)_ota_cmd.cmd[i].write.flashAddress, *__FS_START__ - 4096);
+                if (ret == OTA_PATCH_FAILED) {
+                    uart_puts(uart0, "failed\n");
+                    return;
+                } else if (ret == OTA_PATCH_DONE) {
+                    uart_puts(uart0, "success\n");
+                    break;
+                }
+                uart_puts(uart0, "not a patch\n");
                 uart_puts(uart0, "write: open ");
                 uart_puts(uart0, _ota_cmd.cmd[i].write.filename);
                 uart_puts(uart0, " = ");
@@ -146,16 +191,36 @@ void do_ota() {
                 }
                 lfsClose();
                 break;
+            }
+            case _OTA_COPY:
+                uart_puts(uart0, "copy: ");
+                if (!otaCopy((uint8_t *)_ota_cmd.cmd[i].copy.slotAddress, _ota_cmd.cmd[i].copy.length,
+                             (uint8_t *)_ota_cmd.cmd[i].copy.flashAddress, _ota_cmd.cmd[i].copy.crc32)) {
+                    uart_puts(uart0, "failed\n");
+                    return;
+                }
+                uart_puts(uart0, "success\n");
+                break;
             default:
                 // TODO - verify
                 break;
         }
     }
 
-    uart_puts(uart0, "\nota completed\n");
+    uart_puts(uart0, "\nota completed, us = ");
+#ifdef DEBUG
+    dumphex(time_us_32() - start);
+#endif
+    uart_puts(uart0, "\n");
 
     // Work completed, erase record.
-    lfsEraseBlock(blockToErase);
+    if (cmdSector) {
+        int save = save_and_disable_interrupts();
+        flash_range_erase((intptr_t)cmdSector - XIP_BASE, 4096);
+        restore_interrupts(save);
+    } else {
+        lfsEraseBlock(blockToErase);
+    }
 
     // Do a hard reset just in case the start up sequence is not the same
     watchdog_reboot(0, 0, 100);
@@ -178,6 +243,13 @@ int main(int a, char **b) {
 
     do_ota();
 
+    // Time from reset until the app starts, for comparing compression and patch formats
+    uart_puts(uart0, "boot to app, us = ");
+#ifdef DEBUG
+    dumphex(time_us_32());
+#endif
+    uart_puts(uart0, "\n");
+
     // Reset the interrupt/etc. vectors to the real app.  Will be copied to RAM in app's runtime_init
     scb_hw->vtor = (uint32_t)0x10003000;
 
@@ -23,6 +23,7 @@
 
 #define _OTA_WRITE 1
 #define _OTA_VERIFY 1
+#define _OTA_COPY 2
 
 typedef struct {
     uint32_t command;
@@ -33,6 +34,12 @@ typedef struct {
             uint32_t fileLength;
             uint32_t flashAddress;   // Normally XIP_BASE
         } write;
+        struct {
+            uint32_t slotAddress;    // Image already in flash, above the running app
+            uint32_t length;
+            uint32_t flashAddress;   // Normally XIP_BASE
+            uint32_t crc32;          // CRC32 of the image in the slot
+        } copy;
     };
 } commandEntry;
 
@@ -48,3 +55,20 @@ typedef struct {
 } OTACmdPage;
 
 #define _OTA_COMMAND_FILE "otacommand.bin"
+
+// Pages with only _OTA_COPY commands don't need the filesystem, and are stored
+// raw in the flash sector this many bytes below its start instead
+#define _OTA_COMMAND_SECTOR 4096
+
+// The bootloader image carries this record so a sketch can tell what the
+// ota.o it was linked with can apply.  Bootloaders from before it was added
+// have no record, and only handle plain and GZIP images.
+#define _OTA_FEATURES_SIGN "PicoOTAFeatures"
+#define _OTA_FEATURE_PATCH 0x01     // "Pico DLT" delta images
+#define _OTA_FEATURE_LZ4   0x02     // LZ4 frame compressed images
+#define _OTA_FEATURE_COPY  0x04     // _OTA_COPY slot commands
+
+typedef struct {
+    char sign[16];                  // _OTA_FEATURES_SIGN
+    uint32_t features;              // _OTA_FEATURE_xxx bits
+} OTAFeatures;
@@ -0,0 +1,54 @@
+/*
+    ota_crc.c - CRC32 for OTA operations using the DMA sniffer
+    Copyright (c) 2024 Earle F. Philhower, III.  All rights reserved.
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include <stdint.h>
+#include <hardware/dma.h>
+#include "ota_crc.h"
+
+// Nothing else is running in the bootloader, so any channel will do
+#define OTA_CRC_DMA 0
+
+static uint32_t _bitReverse(uint32_t x) {
+    x = ((x >> 1) & 0x55555555) | ((x & 0x55555555) << 1);
+    x = ((x >> 2) & 0x33333333) | ((x & 0x33333333) << 2);
+    x = ((x >> 4) & 0x0f0f0f0f) | ((x & 0x0f0f0f0f) << 4);
+    return __builtin_bswap32(x);
+}
+
+// The whole image and every patched sector is checked, often more than once,
+// so rather than a slow bitwise loop (there's no room for a table) the data
+// is DMA'd into a dummy byte for the sniffer to CRC.  The sniffer runs the CRC
+// unreflected over bit reversed data, so its register holds the CRC backwards.
+uint32_t otaCRC32(uint32_t crc, const void *data, uint32_t len) {
+    static uint8_t dummy;
+    if (!len) {
+        return crc;
+    }
+    dma_channel_config c = dma_channel_get_default_config(OTA_CRC_DMA);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_8);
+    channel_config_set_write_increment(&c, false);
+    channel_config_set_sniff_enable(&c, true);
+    dma_sniffer_enable(OTA_CRC_DMA, DMA_SNIFF_CTRL_CALC_VALUE_CRC32R, false);
+    dma_hw->sniff_data = _bitReverse(~crc);
+    dma_channel_configure(OTA_CRC_DMA, &c, &dummy, data, len, true);
+    dma_channel_wait_for_finish_blocking(OTA_CRC_DMA);
+    crc = ~_bitReverse(dma_hw->sniff_data);
+    dma_sniffer_disable();
+    return crc;
+}
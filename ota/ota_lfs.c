@@ -1,5 +1,5 @@
 /*
-    ota_lfs.c - LittleFS+GZIP support for OTA operations
+    ota_lfs.c - LittleFS+GZIP+LZ4 support for OTA operations
     Copyright (c) 2022 Earle F. Philhower, III.  All rights reserved.
 
     This library is free software; you can redistribute it and/or
@@ -25,6 +25,7 @@
 #include "../libraries/LittleFS/lib/littlefs/lfs.h"
 #include "../libraries/LittleFS/lib/littlefs/lfs_util.h"
 #include "./uzlib/src/uzlib.h"
+#include "ota_lz4.h"
 
 OTACmdPage __attribute__((section (".globals"))) _ota_cmd;
 
@@ -104,6 +105,7 @@ bool lfsMount(uint8_t *start, uint32_t blockSize, uint32_t size) {
 }
 
 static bool _gzip = false;
+static bool _lz4 = false;
 static lfs_file_t _file;
 
 unsigned char __attribute__((section (".globals"))) uzlib_read_buff[4096];
@@ -139,16 +141,28 @@ static int uzlib_read_cb(struct uzlib_uncomp *m) {
     return *(m->source++);
 }
 
+// LZ4 frames share the GZIP input buffer and dictionary
+static uint32_t lz4_read_cb(const uint8_t **buf) {
+    int len = lfs_file_read(&_lfs, &_file, uzlib_read_buff, sizeof(uzlib_read_buff));
+    *buf = uzlib_read_buff;
+    return (len > 0) ? len : 0;
+}
+
 bool lfsOpen(const char *filename) {
     _gzip = false;
+    _lz4 = false;
     if (lfs_file_opencfg(&_lfs, &_file, filename, LFS_O_RDONLY, &_file_cfg) < 0) {
         return false;
     }
-    char b[2];
+    uint8_t b[4];
     if (sizeof(b) != lfs_file_read(&_lfs, &_file, b, sizeof(b))) {
         return false;
     }
     lfs_file_rewind(&_lfs, &_file);
+    if ((b[0] | (b[1] << 8) | (b[2] << 16) | ((uint32_t)b[3] << 24)) == LZ4_MAGIC) {
+        _lz4 = lz4Begin(lz4_read_cb, gzip_dict, sizeof(gzip_dict));
+        return _lz4;
+    }
     if ((b[0] == 0x1f) && (b[1] == 0x8b)) {
         uzlib_init();
         m_uncomp.source = NULL;
@@ -178,6 +192,9 @@ bool lfsSeek(uint32_t offset) {
 }
 
 uint8_t *lfsRead(uint32_t len) {
+    if (_lz4) {
+        return lz4Read(_flash_buff, len) ? _flash_buff : NULL;
+    }
     if (!_gzip) {
         int ret = lfs_file_read(&_lfs, &_file, _flash_buff, len);
         return (len == ret) ? _flash_buff : NULL;
@@ -0,0 +1,176 @@
+/*
+    ota_lz4.c - Streaming LZ4 frame decoder for OTA operations
+    Copyright (c) 2024 Earle F. Philhower, III.  All rights reserved.
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include <string.h>
+#include "ota_lz4.h"
+
+static lz4_read_cb _cb;
+static const uint8_t *_in;
+static const uint8_t *_inEnd;
+static uint8_t *_ring;
+static uint32_t _mask;
+static uint32_t _pos;      // Bytes decoded so far
+static uint32_t _block;    // Compressed bytes left in the current block
+static uint32_t _lit;      // Literal bytes left in the current sequence
+static uint32_t _match;    // Match bytes left in the current sequence
+static uint32_t _off;
+static uint8_t _token;
+static bool _seq;          // Literals done, match next unless the block ended
+static bool _blockCRC;
+static bool _err;
+
+static bool _fill() {
+    if (_in == _inEnd) {
+        uint32_t n = _cb(&_in);
+        if (!n) {
+            _err = true;
+            return false;
+        }
+        _inEnd = _in + n;
+    }
+    return true;
+}
+
+static uint8_t _byte() {
+    return _fill() ? *_in++ : 0;
+}
+
+// A byte from inside the current block
+static uint8_t _blk() {
+    if (!_block) {
+        _err = true;
+        return 0;
+    }
+    _block--;
+    return _byte();
+}
+
+static uint32_t _u32() {
+    uint32_t v = _byte();
+    v |= (uint32_t)_byte() << 8;
+    v |= (uint32_t)_byte() << 16;
+    v |= (uint32_t)_byte() << 24;
+    return v;
+}
+
+static uint32_t _len(uint32_t n) {
+    if (n == 15) {
+        uint8_t b;
+        do {
+            b = _blk();
+            n += b;
+        } while ((b == 255) && !_err);
+    }
+    return n;
+}
+
+bool lz4Begin(lz4_read_cb cb, uint8_t *ring, uint32_t ringSize) {
+    _cb = cb;
+    _in = _inEnd = NULL;
+    _ring = ring;
+    _mask = ringSize - 1;
+    _pos = 0;
+    _block = 0;
+    _lit = 0;
+    _match = 0;
+    _seq = false;
+    _err = false;
+    if (_u32() != LZ4_MAGIC) {
+        return false;
+    }
+    uint8_t flg = _byte();
+    _byte(); // Block size, the ring doesn't care
+    if (((flg & 0xc0) != 0x40) || (flg & 0x01)) {
+        return false; // Only version 1, and no dictionaries
+    }
+    _blockCRC = flg & 0x10;
+    if (flg & 0x08) {
+        _u32(); // Content size
+        _u32();
+    }
+    _byte(); // Header checksum
+    return !_err;
+}
+
+bool lz4Read(uint8_t *dest, uint32_t len) {
+    while (len && !_err) {
+        if (_match) {
+            // May overlap itself, so byte by byte through the ring
+            uint32_t n = (_match < len) ? _match : len;
+            _match -= n;
+            len -= n;
+            while (n--) {
+                uint8_t c = _ring[(_pos - _off) & _mask];
+                _ring[_pos++ & _mask] = c;
+                *dest++ = c;
+            }
+        } else if (_lit) {
+            // Straight from the input buffer, in runs that don't wrap the ring
+            if (!_fill()) {
+                break;
+            }
+            uint32_t n = (_lit < len) ? _lit : len;
+            if (n > (uint32_t)(_inEnd - _in)) {
+                n = _inEnd - _in;
+            }
+            uint32_t r = _pos & _mask;
+            if (n > _mask + 1 - r) {
+                n = _mask + 1 - r;
+            }
+            memcpy(dest, _in, n);
+            memcpy(_ring + r, _in, n);
+            _in += n;
+            _pos += n;
+            _lit -= n;
+            _block -= n;
+            dest += n;
+            len -= n;
+        } else if (_seq) {
+            _seq = false;
+            if (_block) {
+                _off = _blk();
+                _off |= (uint32_t)_blk() << 8;
+                _match = _len(_token & 15) + 4;
+                if (!_off || (_off > _mask + 1)) {
+                    _err = true; // Reaches back past the ring
+                }
+            }
+        } else if (!_block) {
+            if (_blockCRC && _pos) {
+                _u32();
+            }
+            uint32_t size = _u32();
+            if (!size) {
+                _err = true; // End of frame, but more was wanted
+            }
+            _block = size & 0x7fffffff;
+            if (size & 0x80000000) {
+                _lit = _block; // Stored uncompressed
+            }
+        } else {
+            _token = _blk();
+            _lit = _len(_token >> 4);
+            _seq = true;
+            if (_lit > _block) {
+                _err = true;
+            }
+        }
+    }
+    return !_err;
+}
@@ -0,0 +1,38 @@
+/*
+    ota_lz4.h - Streaming LZ4 frame decoder for OTA operations
+    Copyright (c) 2024 Earle F. Philhower, III.  All rights reserved.
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Matches are copied out of a history ring rather than the whole output, so
+// frames may not reach back further than the ring's size.  tools/otalz4.py
+// limits them to 32K, the same window as GZIP, so the GZIP dictionary can be
+// shared.  Block and content checksums are skipped, not checked.
+
+#define LZ4_MAGIC 0x184d2204
+
+// Points *buf at more of the compressed file and returns how many bytes are
+// there, or 0 at its end
+typedef uint32_t (*lz4_read_cb)(const uint8_t **buf);
+
+// Reads the frame header, ringSize must be a power of 2
+bool lz4Begin(lz4_read_cb cb, uint8_t *ring, uint32_t ringSize);
+bool lz4Read(uint8_t *dest, uint32_t len);
@@ -0,0 +1,249 @@
+/*
+    ota_patch.c - In-place delta patching for OTA operations
+    Copyright (c) 2024 Earle F. Philhower, III.  All rights reserved.
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <hardware/sync.h>
+#include <hardware/flash.h>
+#include "ota_lfs.h"
+#include "ota_crc.h"
+#include "ota_patch.h"
+
+#define SECTOR 4096
+
+// Sectors are built a page at a time straight into flash, there's no room for a
+// whole sector in RAM
+static uint8_t __attribute__((section(".globals"))) _page[FLASH_PAGE_SIZE];
+
+static OTAPatchHeader _hdr;
+
+// Patch stream on top of lfsRead(), which returns up to 4K at a time
+static uint8_t *_in;
+static uint32_t _inLen;
+static uint32_t _left;
+static uint32_t _crc;
+
+// Op being expanded, which may span pages
+static uint8_t _opType;
+static uint32_t _opLen;
+static uint32_t _opSrc;
+
+// Reads len bytes of the patch into dst, or just skips them if dst is NULL
+static bool _get(uint8_t *dst, uint32_t len) {
+    while (len) {
+        if (!_inLen) {
+            uint32_t n = (_left < SECTOR) ? _left : SECTOR;
+            if (!n || !(_in = lfsRead(n))) {
+                return false;
+            }
+            _inLen = n;
+            _left -= n;
+        }
+        uint32_t n = (len < _inLen) ? len : _inLen;
+        if (dst) {
+            memcpy(dst, _in, n);
+            dst += n;
+        }
+        _crc = otaCRC32(_crc, _in, n);
+        _in += n;
+        _inLen -= n;
+        len -= n;
+    }
+    return true;
+}
+
+static bool _varint(uint32_t *v) {
+    *v = 0;
+    for (int shift = 0; shift < 32; shift += 7) {
+        uint8_t b;
+        if (!_get(&b, 1)) {
+            return false;
+        }
+        *v |= (b & 0x7f) << shift;
+        if (!(b & 0x80)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static int _open(const char *filename, uint32_t fileOffset, uint32_t fileLength) {
+    if (!lfsOpen(filename) || !lfsSeek(fileOffset)) {
+        return OTA_PATCH_NONE; // Let the normal copy report the error
+    }
+    _inLen = 0;
+    _left = fileLength;
+    _opLen = 0;
+    if (!_get((uint8_t *)&_hdr, sizeof(_hdr)) || memcmp(_hdr.sign, "Pico DLT", 8)) {
+        lfsClose();
+        return OTA_PATCH_NONE;
+    }
+    if (otaCRC32(0, &_hdr, offsetof(OTAPatchHeader, crc32)) != _hdr.crc32) {
+        return OTA_PATCH_FAILED;
+    }
+    _crc = 0;
+    return OTA_PATCH_DONE;
+}
+
+// Expands the next len bytes of the sector's ops from the current flash contents
+// into out, or just checks them if out is NULL.  Sets *self if they read from
+// the sector itself.
+static bool _expand(const uint8_t *base, uint32_t limit, uint32_t sector, uint8_t *out, uint32_t len, bool *self) {
+    while (len) {
+        if (!_opLen) {
+            if (!_get(&_opType, 1) || !_varint(&_opLen) || !_opLen || (_opType > OTA_PATCH_LIT)) {
+                return false;
+            }
+            _opSrc = 0;
+            if (_opType != OTA_PATCH_LIT) {
+                if (!_varint(&_opSrc) || (_opSrc > limit) || (_opLen > limit - _opSrc)) {
+                    return false;
+                }
+                if ((_opSrc < (sector + 1) * SECTOR) && (_opSrc + _opLen > sector * SECTOR)) {
+                    *self = true;
+                }
+            }
+        }
+        uint32_t n = (len < _opLen) ? len : _opLen;
+        if (_opType == OTA_PATCH_COPY) {
+            if (out) {
+                memcpy(out, base + _opSrc, n);
+            }
+        } else if (!_get(out, n)) {
+            return false;
+        }
+        if (out && (_opType == OTA_PATCH_ADD)) {
+            for (uint32_t i = 0; i < n; i++) {
+                out[i] += base[_opSrc + i];
+            }
+        }
+        if (out) {
+            out += n;
+        }
+        _opSrc += n;
+        _opLen -= n;
+        len -= n;
+    }
+    return true;
+}
+
+static void _erase(uint8_t *dest) {
+    int save = save_and_disable_interrupts();
+    flash_range_erase((intptr_t)dest - XIP_BASE, SECTOR);
+    restore_interrupts(save);
+}
+
+static void _program(uint8_t *dest) {
+    int save = save_and_disable_interrupts();
+    flash_range_program((intptr_t)dest - XIP_BASE, _page, FLASH_PAGE_SIZE);
+    restore_interrupts(save);
+}
+
+// Patches are applied in two passes.  The first reads the whole patch without
+// writing anything, checking it is intact and that every sector of flash holds
+// its old or new contents.  The one exception is a sector whose write was cut
+// short by a power failure, which must not be built from its own old contents
+// unless it was already completed in the swap sector.  The second pass then
+// rewrites each sector which isn't already up to date, building it in the swap
+// sector first if it reads from itself.  A power failure at any point leaves
+// flash in a state that the first pass accepts, so on reboot the update simply
+// continues.
+int otaPatch(const char *filename, uint32_t fileOffset, uint32_t fileLength, uint8_t *base, uint8_t *swap) {
+    int ret = _open(filename, fileOffset, fileLength);
+    if (ret != OTA_PATCH_DONE) {
+        return ret;
+    }
+    uint32_t size = (_hdr.oldSize > _hdr.newSize) ? _hdr.oldSize : _hdr.newSize;
+    uint32_t limit = (size + SECTOR - 1) & ~(SECTOR - 1);
+    uint32_t sectors = (_hdr.newSize + SECTOR - 1) / SECTOR;
+    if (!sectors || (swap < base + limit)) {
+        return OTA_PATCH_FAILED;
+    }
+
+    bool partial = false;
+    for (int pass = 0; pass < 2; pass++) {
+        if (pass && (_open(filename, fileOffset, fileLength) != OTA_PATCH_DONE)) {
+            return OTA_PATCH_FAILED;
+        }
+        for (uint32_t i = 0; i < sectors; i++) {
+            uint32_t sector = (_hdr.flags & OTA_PATCH_DESCENDING) ? sectors - 1 - i : i;
+            uint8_t *dest = base + sector * SECTOR;
+            uint32_t crcs[2]; // New, old
+            uint8_t flags;
+            bool self = false;
+            if (!_get((uint8_t *)crcs, sizeof(crcs)) || !_get(&flags, 1)) {
+                return OTA_PATCH_FAILED;
+            }
+            bool done = otaCRC32(0, dest, SECTOR) == crcs[0];
+            bool swapped = otaCRC32(0, swap, SECTOR) == crcs[0];
+            if (!pass || done || swapped) {
+                if (!_expand(base, limit, sector, NULL, SECTOR, &self)) {
+                    return OTA_PATCH_FAILED;
+                }
+            }
+            if (!pass) {
+                uint32_t oldLen = (_hdr.oldSize > sector * SECTOR) ? _hdr.oldSize - sector * SECTOR : 0;
+                if (self && !(flags & OTA_PATCH_SELF)) {
+                    return OTA_PATCH_FAILED;
+                }
+                if (done || (otaCRC32(0, dest, (oldLen < SECTOR) ? oldLen : SECTOR) == crcs[1])) {
+                    continue; // Written, or not written yet
+                }
+                if (partial || ((flags & OTA_PATCH_SELF) && !swapped)) {
+                    return OTA_PATCH_FAILED; // Not the image this patch was made for
+                }
+                partial = true;
+                continue;
+            }
+            if (done) {
+                continue;
+            }
+            // Build the sector in place, or in swap if it reads from itself
+            uint8_t *build = (swapped || (flags & OTA_PATCH_SELF)) ? swap : dest;
+            if (!swapped) {
+                _erase(build);
+                for (uint32_t p = 0; p < SECTOR; p += FLASH_PAGE_SIZE) {
+                    if (!_expand(base, limit, sector, _page, FLASH_PAGE_SIZE, &self)) {
+                        return OTA_PATCH_FAILED;
+                    }
+                    _program(build + p);
+                }
+            }
+            if (build == swap) {
+                if (otaCRC32(0, swap, SECTOR) != crcs[0]) {
+                    return OTA_PATCH_FAILED;
+                }
+                _erase(dest);
+                for (uint32_t p = 0; p < SECTOR; p += FLASH_PAGE_SIZE) {
+                    memcpy(_page, swap + p, FLASH_PAGE_SIZE);
+                    _program(dest + p);
+                }
+            }
+            if (otaCRC32(0, dest, SECTOR) != crcs[0]) {
+                return OTA_PATCH_FAILED;
+            }
+        }
+        if (_opLen || (_crc != _hdr.patchCRC)) {
+            return OTA_PATCH_FAILED;
+        }
+        lfsClose();
+    }
+    return OTA_PATCH_DONE;
+}
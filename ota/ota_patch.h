@@ -0,0 +1,62 @@
+/*
+    ota_patch.h - In-place delta patching for OTA operations
+    Copyright (c) 2024 Earle F. Philhower, III.  All rights reserved.
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// A patch file (generated by tools/otadelta.py, optionally GZIP compressed) is
+// an OTAPatchHeader followed by one record per 4K sector of the new image, in
+// the order they are to be written:
+//     uint32_t newCRC    CRC32 of the full new sector (padded with 0xff)
+//     uint32_t oldCRC    CRC32 of the old image's bytes in this sector
+//     uint8_t flags      OTA_PATCH_SELF if the ops read from this sector
+//     ops...             Until 4096 bytes have been produced
+// Each op is a type byte and a LEB128 length, followed by:
+//     OTA_PATCH_COPY     LEB128 source offset: copy len bytes from flash
+//     OTA_PATCH_ADD      LEB128 source offset, len bytes: flash + byte (bsdiff)
+//     OTA_PATCH_LIT      len bytes: copy from the patch
+// Source offsets are relative to the start of the image in flash, and may refer
+// to any sector holding its final contents by the time this one is written.
+typedef struct {
+    uint8_t sign[8];     // "Pico DLT"
+    uint32_t oldSize;
+    uint32_t newSize;
+    uint32_t flags;
+    uint32_t patchLen;   // Bytes of sector records following this header
+    uint32_t patchCRC;   // CRC32 over those records
+    uint32_t crc32;      // CRC32 over the header, up until just before this value
+} OTAPatchHeader;
+
+#define OTA_PATCH_DESCENDING 1  // Sectors are written from the end of the image down
+
+#define OTA_PATCH_SELF 1        // Sector must be built in the swap sector
+
+#define OTA_PATCH_COPY 0
+#define OTA_PATCH_ADD  1
+#define OTA_PATCH_LIT  2
+
+#define OTA_PATCH_NONE    0     // Not a patch file, copy it as-is
+#define OTA_PATCH_DONE    1
+#define OTA_PATCH_FAILED  -1
+
+// Applies the patch in filename to the image at flashAddress.  swap is a spare
+// sector above both images, used to make rewriting sectors power fail safe
+int otaPatch(const char *filename, uint32_t fileOffset, uint32_t fileLength, uint8_t *flashAddress, uint8_t *swap);
@@ -0,0 +1,185 @@
+/*
+    chksum - Checks the core's Internet checksum, which lwIP uses for every
+    IP, TCP, UDP and ICMP header and payload, against a bytewise RFC 1071 sum
+    for every length and alignment, through both the CPU loop and the DMA
+    sniffer (run against the model in common/core/hardware/dma.h), and the
+    CRC32 the EEPROM, KVStore and FlashLog libraries keep on flash
+    Copyright (c) 2024 Earle F. Philhower, III.  All rights reserved.
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include <Checksum.h>
+#include <hardware/dma.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <vector>
+
+static uint32_t seed = 1;
+static uint32_t rnd() {
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    return seed;
+}
+
+// Byte i of the buffer is the low half of a host order (little endian) word
+// when i is even and the high half when it's odd, wherever the buffer starts
+static uint16_t reference(const uint8_t *p, size_t len) {
+    uint64_t sum = 0;
+    for (size_t i = 0; i < len; i++) {
+        sum += (uint32_t)p[i] << ((i & 1) * 8);
+    }
+    while (sum >> 16) {
+        sum = (sum & 0xffff) + (sum >> 16);
+    }
+    return sum;
+}
+
+// Plain reflected CRC32 (zlib), one bit at a time
+static uint32_t referenceCRC32(const uint8_t *p, size_t len) {
+    uint32_t crc = 0xffffffff;
+    for (size_t i = 0; i < len; i++) {
+        crc ^= p[i];
+        for (int j = 0; j < 8; j++) {
+            crc = (crc >> 1) ^ (0xedb88320 & -(crc & 1));
+        }
+    }
+    return ~crc;
+}
+
+static int fails;
+
+static void check(const char *what, const uint8_t *p, size_t len) {
+    uint16_t want = reference(p, len);
+    uint16_t got = checksumInternet(0, p, len);
+    if (got != want) {
+        if (fails++ < 10) {
+            printf("%s: %zu bytes at offset %u: got 0x%04x, expected 0x%04x\n", what, len, (unsigned)((uintptr_t)p & 7), got, want);
+        }
+    }
+    // Split at a random even point and chained, as lwIP does over a pbuf chain
+    size_t split = (len ? rnd() % len : 0) & ~1;
+    uint16_t chained = checksumInternet(checksumInternet(0, p, split), p + split, len - split);
+    if (chained != want) {
+        if (fails++ < 10) {
+            printf("%s: %zu bytes split at %zu: got 0x%04x, expected 0x%04x\n", what, len, split, chained, want);
+        }
+    }
+}
+
+static void checkCRC32(const char *what, const uint8_t *p, size_t len) {
+    uint32_t want = referenceCRC32(p, len);
+    uint32_t got = checksumCRC32(0, p, len);
+    size_t split = len ? rnd() % len : 0;
+    uint32_t chained = checksumCRC32(checksumCRC32(0, p, split), p + split, len - split);
+    if ((got != want) || (chained != want)) {
+        if (fails++ < 10) {
+            printf("%s: CRC32 of %zu bytes split at %zu: got 0x%08x/0x%08x, expected 0x%08x\n", what, len, split, got, chained, want);
+        }
+    }
+}
+
+// Every alignment, the short lengths, around each block size, full sized
+// packets, and enough to make the sniffer's sum fold part way
+static void run(const char *what, const std::vector<uint8_t> &buff) {
+    const uint8_t *base = (const uint8_t *)(((uintptr_t)buff.data() + 7) & ~(uintptr_t)7);
+    for (unsigned off = 0; off < 8; off++) {
+        for (size_t len = 0; len <= 2100; len++) {
+            check(what, base + off, len);
+        }
+        for (size_t len : { 1460, 1472, 1480, 65535, 65536, 65537, 131072, 200001 }) {
+            check(what, base + off, len);
+        }
+    }
+}
+
+// Either side of the 64 byte point where the sniffer takes over, and whole
+// flash sectors
+static void runCRC32(const char *what, const std::vector<uint8_t> &buff) {
+    const uint8_t *base = (const uint8_t *)(((uintptr_t)buff.data() + 7) & ~(uintptr_t)7);
+    for (unsigned off = 0; off < 8; off++) {
+        for (size_t len = 0; len <= 300; len++) {
+            checkCRC32(what, base + off, len);
+        }
+        for (size_t len : { 1460, 4096, 65537 }) {
+            checkCRC32(what, base + off, len);
+        }
+    }
+}
+
+static void usage() {
+    printf("Usage: chksum [-r seed]\n");
+    printf("  -r  Random seed for the data and split points\n");
+}
+
+int main(int argc, char **argv) {
+    int c;
+    while ((c = getopt(argc, argv, "r:h")) != -1) {
+        switch (c) {
+        case 'r':
+            seed = strtoul(optarg, nullptr, 0) | 1;
+            break;
+        default:
+            usage();
+            return 1;
+        }
+    }
+
+    // The RFC 1071 worked example, 00 01 f2 03 f4 f5 f6 f7 sums to ddf2 in
+    // network order
+    static const uint8_t rfc[] = { 0x00, 0x01, 0xf2, 0x03, 0xf4, 0xf5, 0xf6, 0xf7 };
+    if (checksumInternet(0, rfc, sizeof(rfc)) != 0xf2dd) {
+        printf("RFC 1071 example: got 0x%04x, expected 0xf2dd\n", checksumInternet(0, rfc, sizeof(rfc)));
+        fails++;
+    }
+
+    std::vector<uint8_t> buff(200001 + 16);
+    for (auto &b : buff) {
+        b = rnd();
+    }
+    dma_hw->calc = 0;
+    run("random, DMA", buff);
+    if (dma_hw->calc != DMA_SNIFF_CTRL_CALC_VALUE_SUM) {
+        printf("The sniffer was never used\n");
+        fails++;
+    }
+    // All ones is the worst case for the carries
+    std::vector<uint8_t> ones(buff.size(), 0xff);
+    run("all 0xff, DMA", ones);
+    dma_hw->calc = 0;
+    runCRC32("random, DMA", buff);
+    if (dma_hw->calc != DMA_SNIFF_CTRL_CALC_VALUE_CRC32R) {
+        printf("The sniffer was never used for CRC32\n");
+        fails++;
+    }
+
+    // With every channel taken it has to fall back to the CPU
+    while (dma_claim_unused_channel(false) >= 0) {
+    }
+    run("random, CPU", buff);
+    run("all 0xff, CPU", ones);
+    runCRC32("random, CPU", buff);
+
+    static const char check9[] = "123456789";
+    if (checksumCRC32(0, check9, 9) != 0xcbf43926) {
+        printf("CRC32 check value: got 0x%08x, expected 0xcbf43926\n", (unsigned)checksumCRC32(0, check9, 9));
+        fails++;
+    }
+
+    printf("%s\n", fails ? "Checksum tests FAILED" : "All checksum tests passed");
+    return fails ? 1 : 0;
+}
@@ -0,0 +1,175 @@
+/*
+    FlashSim.cpp - Simulated NOR flash for running the filesystems on the host
+    Copyright (c) 2024 Earle F. Philhower, III.  All rights reserved.
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include "FlashSim.h"
+#include <hardware/flash.h>
+#include <stdarg.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <chrono>
+
+extern "C" {
+    uint8_t __flashsim[FLASHSIM_SIZE] __attribute__((aligned(4096)));
+}
+
+FlashSimStats FlashSim::stats;
+uint64_t FlashSim::_ops = 0;
+int64_t FlashSim::_failAt = -1;
+uint32_t FlashSim::_seed = 1;
+
+void FlashSim::begin() {
+    // Replace the array's pages with shared memory at the same address, so a child
+    // process that loses power leaves its writes behind for the parent to check
+    void *p = mmap(__flashsim, FLASHSIM_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS | MAP_FIXED, -1, 0);
+    if (p != (void *)__flashsim) {
+        perror("FlashSim: mmap");
+        exit(1);
+    }
+    memset(__flashsim, 0xff, FLASHSIM_SIZE);
+    resetStats();
+    _ops = 0;
+    _failAt = -1;
+}
+
+void FlashSim::read(uint32_t offset, void *dst, size_t len) {
+    memcpy(dst, __flashsim + offset, len);
+    stats.reads++;
+    stats.readBytes += len;
+    stats.stallUs += FLASHSIM_READ_CMD_US + (len * FLASHSIM_READ_KB_US + 1023) / 1024;
+}
+
+void FlashSim::program(uint32_t offset, const uint8_t *src, size_t len) {
+    if (offset + len > FLASHSIM_SIZE) {
+        fprintf(stderr, "FlashSim: program past end of flash, %08x+%zu\n", offset, len);
+        abort();
+    }
+    while (len) {
+        // The chip programs at most one page per operation
+        size_t n = std::min(len, (size_t)(FLASH_PAGE_SIZE - (offset % FLASH_PAGE_SIZE)));
+        _ops++;
+        if (_failAt >= 0 && !_failAt--) {
+            // Lose power with only part of the page programmed
+            size_t part = _seed % (n + 1);
+            for (size_t i = 0; i < part; i++) {
+                __flashsim[offset + i] &= src[i];
+            }
+            _powerFail();
+        }
+        bool over = false;
+        for (size_t i = 0; i < n; i++) {
+            // 0xff pads around partial page writes are fine, they leave the bits alone
+            over |= (src[i] != 0xff) && ((src[i] & ~__flashsim[offset + i]) != 0);
+            __flashsim[offset + i] &= src[i];
+        }
+        if (over) {
+            stats.overprograms++;
+        }
+        stats.programs++;
+        stats.programBytes += n;
+        stats.stallUs += FLASHSIM_PROGRAM_US;
+        offset += n;
+        src += n;
+        len -= n;
+    }
+}
+
+void FlashSim::erase(uint32_t offset, size_t len) {
+    if ((offset % FLASH_SECTOR_SIZE) || (len % FLASH_SECTOR_SIZE) || (offset + len > FLASHSIM_SIZE)) {
+        fprintf(stderr, "FlashSim: bad erase %08x+%zu\n", offset, len);
+        abort();
+    }
+    while (len) {
+        // Like the SDK, use a 64K block erase wherever a whole aligned block is covered
+        size_t n = (!(offset % FLASH_BLOCK_SIZE) && (len >= FLASH_BLOCK_SIZE)) ? FLASH_BLOCK_SIZE : FLASH_SECTOR_SIZE;
+        _ops++;
+        if (_failAt >= 0 && !_failAt--) {
+            // An interrupted erase leaves the sector half erased
+            memset(__flashsim + offset, 0xff, _seed % (n + 1));
+            _powerFail();
+        }
+        memset(__flashsim + offset, 0xff, n);
+        stats.erases++;
+        stats.eraseBytes += n;
+        stats.stallUs += (n == FLASH_BLOCK_SIZE) ? FLASHSIM_ERASE_64K_US : FLASHSIM_ERASE_4K_US;
+        offset += n;
+        len -= n;
+    }
+}
+
+void FlashSim::failAfter(int64_t ops, uint32_t seed) {
+    _failAt = ops;
+    _seed = seed;
+}
+
+void FlashSim::_powerFail() {
+    fflush(stdout);
+    _exit(FLASHSIM_POWERFAIL_EXIT);
+}
+
+
+// pico-sdk flash API, offsets are from the start of the (simulated) XIP window
+extern "C" void flash_range_erase(uint32_t flash_offs, size_t count) {
+    FlashSim::erase(flash_offs, count);
+}
+
+extern "C" void flash_range_program(uint32_t flash_offs, const uint8_t *data, size_t count) {
+    if ((flash_offs % FLASH_PAGE_SIZE) || (count % FLASH_PAGE_SIZE)) {
+        fprintf(stderr, "FlashSim: flash_range_program(%08x, %zu) not page aligned\n", flash_offs, count);
+        abort();
+    }
+    FlashSim::program(flash_offs, data, count);
+}
+
+
+// Remainder of the Arduino core used by the libraries
+RP2040 rp2040;
+
+static auto _t0 = std::chrono::steady_clock::now();
+
+uint64_t time_us_64() {
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - _t0).count();
+}
+
+unsigned long micros() {
+    return (unsigned long)time_us_64();
+}
+
+unsigned long millis() {
+    return (unsigned long)(time_us_64() / 1000);
+}
+
+void delay(unsigned long ms) {
+    usleep(ms * 1000);
+}
+
+void delayMicroseconds(unsigned int us) {
+    usleep(us);
+}
+
+void yield() {
+}
+
+size_t Print::printf(const char *format, ...) {
+    char buff[256];
+    va_list arg;
+    va_start(arg, format);
+    int len = vsnprintf(buff, sizeof(buff), format, arg);
+    va_end(arg);
+    return write((const uint8_t *)buff, std::min(len, (int)sizeof(buff) - 1));
+}
@@ -0,0 +1,124 @@
+/*
+    FlashSim.h - Simulated NOR flash for running the filesystems on the host
+    Copyright (c) 2024 Earle F. Philhower, III.  All rights reserved.
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#pragma once
+
+#include <Arduino.h>
+#include <FlashDevice.h>
+#include <vector>
+
+// Layout of __flashsim, matching the linker symbols set up by the Makefile:
+// a 1MB "sketch", then the filesystem, then the EEPROM sector at the very top
+#define FLASHSIM_FS_OFFSET (1024 * 1024)
+#define FLASHSIM_FS_SIZE   (FLASHSIM_SIZE - FLASHSIM_FS_OFFSET - 4096)
+
+// Typical timings of a 2MB QSPI part like the W25Q16JV on a Pico
+#define FLASHSIM_PROGRAM_US    700     // Per 256 byte page, even if only partly written
+#define FLASHSIM_ERASE_4K_US   45000
+#define FLASHSIM_ERASE_64K_US  150000
+#define FLASHSIM_READ_CMD_US   2       // Command and address overhead of a device read
+#define FLASHSIM_READ_KB_US    410     // 1KB at 20MHz SPI
+
+// Exit code of a process that lost power, see failAfter()
+#define FLASHSIM_POWERFAIL_EXIT 99
+
+typedef struct {
+    uint64_t reads;         // Device reads only, XIP reads are plain memory accesses
+    uint64_t readBytes;
+    uint64_t programs;      // Program operations (one per page touched)
+    uint64_t programBytes;
+    uint64_t erases;        // Erase operations (4K sectors or 64K blocks)
+    uint64_t eraseBytes;
+    uint64_t stallUs;       // Time the flash would have been busy
+    uint64_t overprograms;  // Programs that tried to flip a 0 bit back to 1
+} FlashSimStats;
+
+class FlashSim {
+public:
+    // Remaps __flashsim as memory shared with fork()ed children, and erases it
+    static void begin();
+
+    static void read(uint32_t offset, void *dst, size_t len);
+    static void program(uint32_t offset, const uint8_t *src, size_t len);
+    static void erase(uint32_t offset, size_t len);
+
+    static void resetStats() {
+        memset(&stats, 0, sizeof(stats));
+    }
+    static FlashSimStats stats;
+
+    // Power-fail injection.  After ops more program/erase operations the next one
+    // is cut short part way through and the process _exit()s, leaving the flash
+    // as a real power loss could.  A negative count disables injection.
+    static void failAfter(int64_t ops, uint32_t seed = 1);
+    // Program/erase operations started since begin()
+    static uint64_t ops() {
+        return _ops;
+    }
+
+    static std::vector<uint8_t> snapshot() {
+        return std::vector<uint8_t>(__flashsim, __flashsim + FLASHSIM_SIZE);
+    }
+    static void restore(const std::vector<uint8_t> &image) {
+        memcpy(__flashsim, image.data(), FLASHSIM_SIZE);
+    }
+
+protected:
+    static void _powerFail();
+
+    static uint64_t _ops;
+    static int64_t  _failAt;
+    static uint32_t _seed;
+};
+
+// FlashDevice over part of the simulated flash, so the filesystems' device path
+// can be measured, including reads
+class FlashSimDevice : public FlashDevice {
+public:
+    FlashSimDevice(uint32_t offset = FLASHSIM_FS_OFFSET, uint32_t size = FLASHSIM_FS_SIZE) : _offset(offset), _size(size) { }
+
+    uint32_t size() override {
+        return _size;
+    }
+    bool read(uint32_t addr, void *dst, size_t len) override {
+        if (addr + len > _size) {
+            return false;
+        }
+        FlashSim::read(_offset + addr, dst, len);
+        return true;
+    }
+    bool program(uint32_t addr, const void *src, size_t len) override {
+        if (addr + len > _size) {
+            return false;
+        }
+        FlashSim::program(_offset + addr, (const uint8_t *)src, len);
+        return true;
+    }
+    bool erase(uint32_t addr, size_t len) override {
+        if ((addr % 4096) || (len % 4096) || (addr + len > _size)) {
+            return false;
+        }
+        FlashSim::erase(_offset + addr, len);
+        return true;
+    }
+
+protected:
+    uint32_t _offset;
+    uint32_t _size;
+};
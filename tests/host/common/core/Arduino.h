@@ -0,0 +1,243 @@
+/*
+    Arduino.h - Minimal host-side stand-in for the core, enough to build the
+    filesystem and EEPROM libraries against the flash simulator
+    Copyright (c) 2024 Earle F. Philhower, III.  All rights reserved.
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <strings.h>
+#include <time.h>
+#include <string>
+#include <algorithm>
+
+#ifdef DEBUG_HOST
+#define DEBUGV(...) fprintf(stderr, __VA_ARGS__)
+#else
+#define DEBUGV(...) do { } while (0)
+#endif
+
+#define PROGMEM
+#define PSTR(x) (x)
+#define F(x) (x)
+typedef const char *PGM_P;
+
+// The simulated flash stands in for the XIP window, see FlashSim.h
+#ifndef FLASHSIM_SIZE
+#define FLASHSIM_SIZE (2 * 1024 * 1024)
+#endif
+extern "C" uint8_t __flashsim[];
+#define XIP_BASE  ((uintptr_t)__flashsim)
+#define SRAM_BASE ((uintptr_t)__flashsim + FLASHSIM_SIZE)
+
+unsigned long millis();
+unsigned long micros();
+uint64_t time_us_64();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+void yield();
+static inline void noInterrupts() { }
+static inline void interrupts() { }
+
+class RP2040 {
+public:
+    void idleOtherCore() { }
+    void resumeOtherCore() { }
+    int getFreeHeap() {
+        return 128 * 1024;
+    }
+};
+extern RP2040 rp2040;
+
+class String {
+public:
+    String() { }
+    String(const char *c) : _s(c ? c : "") { }
+    String(const char *c, unsigned int len) : _s(c, len) { }
+    String(const std::string &s) : _s(s) { }
+    String(char c) : _s(1, c) { }
+    String(int v) : _s(std::to_string(v)) { }
+    String(unsigned int v) : _s(std::to_string(v)) { }
+    String(long v) : _s(std::to_string(v)) { }
+    String(unsigned long v) : _s(std::to_string(v)) { }
+
+    const char *c_str() const {
+        return _s.c_str();
+    }
+    unsigned int length() const {
+        return _s.size();
+    }
+    bool reserve(unsigned int n) {
+        _s.reserve(n);
+        return true;
+    }
+    bool concat(const char *p, unsigned int n) {
+        _s.append(p, n);
+        return true;
+    }
+    bool concat(const uint8_t *p, unsigned int n) {
+        return concat((const char *)p, n);
+    }
+    bool concat(const char *p) {
+        _s.append(p);
+        return true;
+    }
+    bool concat(char c) {
+        _s.push_back(c);
+        return true;
+    }
+    bool startsWith(const String &x) const {
+        return _s.compare(0, x._s.size(), x._s) == 0;
+    }
+    bool endsWith(const String &x) const {
+        return (_s.size() >= x._s.size()) && !_s.compare(_s.size() - x._s.size(), x._s.size(), x._s);
+    }
+    int indexOf(char c, unsigned int from = 0) const {
+        auto p = _s.find(c, from);
+        return p == std::string::npos ? -1 : (int)p;
+    }
+    int lastIndexOf(char c) const {
+        auto p = _s.rfind(c);
+        return p == std::string::npos ? -1 : (int)p;
+    }
+    String substring(unsigned int from) const {
+        return from < _s.size() ? String(_s.substr(from)) : String();
+    }
+    String substring(unsigned int from, unsigned int to) const {
+        return from < _s.size() ? String(_s.substr(from, to - from)) : String();
+    }
+    void remove(unsigned int i) {
+        _s.erase(i);
+    }
+    void remove(unsigned int i, unsigned int n) {
+        _s.erase(i, n);
+    }
+    char operator[](unsigned int i) const {
+        return _s[i];
+    }
+    String &operator+=(const String &o) {
+        _s += o._s;
+        return *this;
+    }
+    String &operator+=(const char *o) {
+        _s += o;
+        return *this;
+    }
+    String &operator+=(char c) {
+        _s += c;
+        return *this;
+    }
+    bool operator==(const String &o) const {
+        return _s == o._s;
+    }
+    bool operator==(const char *o) const {
+        return _s == o;
+    }
+    bool operator!=(const String &o) const {
+        return _s != o._s;
+    }
+
+protected:
+    std::string _s;
+};
+
+inline String operator+(const String &a, const String &b) {
+    String r(a);
+    r += b;
+    return r;
+}
+inline String operator+(const String &a, const char *b) {
+    String r(a);
+    r += b;
+    return r;
+}
+inline String operator+(const char *a, const String &b) {
+    String r(a);
+    r += b;
+    return r;
+}
+
+class Print {
+public:
+    virtual ~Print() { }
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t *buffer, size_t size) {
+        size_t n = 0;
+        while (size--) {
+            n += write(*buffer++);
+        }
+        return n;
+    }
+    size_t write(const char *str) {
+        return str ? write((const uint8_t *)str, strlen(str)) : 0;
+    }
+    size_t write(const char *buffer, size_t size) {
+        return write((const uint8_t *)buffer, size);
+    }
+    virtual int availableForWrite() {
+        return 0;
+    }
+    virtual void flush() { }
+    size_t printf(const char *format, ...) __attribute__((format(printf, 2, 3)));
+    size_t print(const char *s) {
+        return write(s);
+    }
+    size_t print(const String &s) {
+        return write(s.c_str(), s.length());
+    }
+    size_t println(const char *s = "") {
+        return write(s) + write("\r\n");
+    }
+};
+
+class Stream : public Print {
+public:
+    virtual int available() = 0;
+    virtual int read() = 0;
+    virtual int peek() = 0;
+    void setTimeout(unsigned long timeout) {
+        _timeout = timeout;
+    }
+    virtual size_t readBytes(char *buffer, size_t length) {
+        size_t n = 0;
+        int c;
+        while ((n < length) && ((c = read()) >= 0)) {
+            buffer[n++] = c;
+        }
+        return n;
+    }
+    size_t readBytes(uint8_t *buffer, size_t length) {
+        return readBytes((char *)buffer, length);
+    }
+    String readString() {
+        String ret;
+        int c;
+        while ((c = read()) >= 0) {
+            ret += (char)c;
+        }
+        return ret;
+    }
+
+protected:
+    unsigned long _timeout = 1000;
+    unsigned long _startMillis = 0;
+};
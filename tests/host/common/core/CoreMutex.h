@@ -0,0 +1,30 @@
+// Host-side CoreMutex, the simulator is single threaded so a mutex that's
+// already held means the caller would deadlock on the device
+#pragma once
+
+#include <pico/mutex.h>
+
+enum {
+    DebugEnable = 1
+};
+
+class CoreMutex {
+public:
+    CoreMutex(mutex_t *mutex, uint8_t option = DebugEnable) : _mutex(mutex) {
+        (void) option;
+        _acquired = mutex_try_enter(_mutex, nullptr);
+    }
+    ~CoreMutex() {
+        if (_acquired) {
+            mutex_exit(_mutex);
+        }
+    }
+
+    operator bool() {
+        return _acquired;
+    }
+
+private:
+    mutex_t *_mutex;
+    bool _acquired;
+};
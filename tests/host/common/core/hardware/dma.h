@@ -0,0 +1,154 @@
+// Host-side pico-sdk DMA API, just enough to run memory to memory transfers
+// through a model of the sniffer as the RP2040 datasheet describes it
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#define DMA_SNIFF_CTRL_CALC_VALUE_CRC32  0x0
+#define DMA_SNIFF_CTRL_CALC_VALUE_CRC32R 0x1
+#define DMA_SNIFF_CTRL_CALC_VALUE_CRC16  0x2
+#define DMA_SNIFF_CTRL_CALC_VALUE_CRC16R 0x3
+#define DMA_SNIFF_CTRL_CALC_VALUE_SUM    0xf
+
+enum dma_channel_transfer_size { DMA_SIZE_8 = 0, DMA_SIZE_16 = 1, DMA_SIZE_32 = 2 };
+
+typedef struct {
+    enum dma_channel_transfer_size size;
+    bool readIncrement;
+    bool writeIncrement;
+    bool sniff;
+} dma_channel_config;
+
+#define NUM_DMA_CHANNELS 12
+
+typedef struct {
+    bool enable;
+    unsigned channel;
+    unsigned calc;
+    bool reverse;
+    bool invert;
+    uint32_t sniff_data;
+    uint32_t claimed;
+} dma_hw_sim_t;
+
+// Shared by every file using the model, like the real registers
+__attribute__((weak)) dma_hw_sim_t __dma_hw_sim;
+#define dma_hw (&__dma_hw_sim)
+
+static inline int dma_claim_unused_channel(bool required) {
+    (void) required;
+    for (int i = 0; i < NUM_DMA_CHANNELS; i++) {
+        if (!(dma_hw->claimed & (1u << i))) {
+            dma_hw->claimed |= 1u << i;
+            return i;
+        }
+    }
+    return -1;
+}
+
+static inline void dma_channel_unclaim(unsigned channel) {
+    dma_hw->claimed &= ~(1u << channel);
+}
+
+static inline dma_channel_config dma_channel_get_default_config(unsigned channel) {
+    (void) channel;
+    dma_channel_config c = { DMA_SIZE_32, true, false, false };
+    return c;
+}
+
+static inline void channel_config_set_transfer_data_size(dma_channel_config *c, enum dma_channel_transfer_size size) {
+    c->size = size;
+}
+
+static inline void channel_config_set_read_increment(dma_channel_config *c, bool incr) {
+    c->readIncrement = incr;
+}
+
+static inline void channel_config_set_write_increment(dma_channel_config *c, bool incr) {
+    c->writeIncrement = incr;
+}
+
+static inline void channel_config_set_sniff_enable(dma_channel_config *c, bool sniff) {
+    c->sniff = sniff;
+}
+
+static inline void dma_sniffer_enable(unsigned channel, unsigned mode, bool force_channel_enable) {
+    (void) force_channel_enable;
+    dma_hw->enable = true;
+    dma_hw->channel = channel;
+    dma_hw->calc = mode;
+}
+
+static inline void dma_sniffer_disable() {
+    dma_hw->enable = false;
+}
+
+// The hardware applies these as SNIFF_DATA is read.  The model keeps the raw
+// value while a transfer runs and stores the result as it would read back,
+// which is the same as long as SNIFF_DATA is written before each transfer.
+static inline void dma_sniffer_set_output_reverse_enabled(bool enable) {
+    dma_hw->reverse = enable;
+}
+
+static inline void dma_sniffer_set_output_invert_enabled(bool enable) {
+    dma_hw->invert = enable;
+}
+
+// The CRCs are only modeled for byte transfers, the sum adds each transfer
+static inline void __dma_sniff(uint32_t b) {
+    uint32_t *acc = &dma_hw->sniff_data;
+    if ((dma_hw->calc == DMA_SNIFF_CTRL_CALC_VALUE_CRC32) || (dma_hw->calc == DMA_SNIFF_CTRL_CALC_VALUE_CRC32R)) {
+        if (dma_hw->calc == DMA_SNIFF_CTRL_CALC_VALUE_CRC32R) {
+            b = (((b * 0x0802u & 0x22110u) | (b * 0x8020u & 0x88440u)) * 0x10101u >> 16) & 0xff;
+        }
+        *acc ^= (uint32_t)b << 24;
+        for (int i = 0; i < 8; i++) {
+            *acc = (*acc << 1) ^ ((*acc & 0x80000000u) ? 0x04c11db7u : 0);
+        }
+    } else if (dma_hw->calc == DMA_SNIFF_CTRL_CALC_VALUE_CRC16) {
+        uint16_t crc = *acc ^ (b << 8);
+        for (int i = 0; i < 8; i++) {
+            crc = (crc << 1) ^ ((crc & 0x8000) ? 0x1021 : 0);
+        }
+        *acc = (*acc & 0xffff0000u) | crc;
+    } else if (dma_hw->calc == DMA_SNIFF_CTRL_CALC_VALUE_SUM) {
+        *acc += b;
+    }
+}
+
+static inline void dma_channel_configure(unsigned channel, const dma_channel_config *config, volatile void *write_addr,
+        const volatile void *read_addr, unsigned transfer_count, bool trigger) {
+    volatile uint8_t *w = (volatile uint8_t *)write_addr;
+    const volatile uint8_t *r = (const volatile uint8_t *)read_addr;
+    unsigned size = 1 << config->size;
+    bool sniff = config->sniff && dma_hw->enable && (dma_hw->channel == channel);
+    if (!trigger) {
+        return;
+    }
+    for (unsigned i = 0; i < transfer_count; i++) {
+        uint32_t v = 0;
+        memcpy((void *)&v, (const void *)r, size); // Little endian, like the RP2040
+        memcpy((void *)w, (const void *)&v, size);
+        if (sniff) {
+            __dma_sniff(v);
+        }
+        r += config->readIncrement ? size : 0;
+        w += config->writeIncrement ? size : 0;
+    }
+    if (sniff && dma_hw->reverse) {
+        uint32_t x = dma_hw->sniff_data, y = 0;
+        for (int i = 0; i < 32; i++) {
+            y = (y << 1) | ((x >> i) & 1);
+        }
+        dma_hw->sniff_data = y;
+    }
+    if (sniff && dma_hw->invert) {
+        dma_hw->sniff_data = ~dma_hw->sniff_data;
+    }
+}
+
+static inline void dma_channel_wait_for_finish_blocking(unsigned channel) {
+    (void) channel;
+}
@@ -0,0 +1,28 @@
+// Host-side pico-sdk flash API, routed to the flash simulator
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+// The simulated flash stands in for the XIP window, as in Arduino.h
+#ifndef XIP_BASE
+#ifdef __cplusplus
+extern "C" uint8_t __flashsim[];
+#else
+extern uint8_t __flashsim[];
+#endif
+#define XIP_BASE  ((uintptr_t)__flashsim)
+#endif
+
+#define FLASH_PAGE_SIZE   (1u << 8)
+#define FLASH_SECTOR_SIZE (1u << 12)
+#define FLASH_BLOCK_SIZE  (1u << 16)
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+void flash_range_erase(uint32_t flash_offs, size_t count);
+void flash_range_program(uint32_t flash_offs, const uint8_t *data, size_t count);
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,12 @@
+// Host-side pico-sdk interrupt helpers, the simulator is single threaded
+#pragma once
+
+#include <stdint.h>
+
+static inline uint32_t save_and_disable_interrupts() {
+    return 0;
+}
+static inline void restore_interrupts(uint32_t status) {
+    (void) status;
+}
+static inline void __dmb() { }
@@ -0,0 +1,28 @@
+// Host-side pico-sdk mutexes, the simulator is single threaded
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+typedef struct {
+    bool owned;
+} mutex_t;
+
+#define auto_init_mutex(name) static mutex_t name = { false }
+
+static inline void mutex_init(mutex_t *mtx) {
+    mtx->owned = false;
+}
+
+static inline bool mutex_try_enter(mutex_t *mtx, uint32_t *owner_out) {
+    (void) owner_out;
+    if (mtx->owned) {
+        return false;
+    }
+    mtx->owned = true;
+    return true;
+}
+
+static inline void mutex_exit(mutex_t *mtx) {
+    mtx->owned = false;
+}
@@ -0,0 +1,2 @@
+// FS.h includes <../include/time.h> to reach the newlib header, use the host's
+#include <time.h>
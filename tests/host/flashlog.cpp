@@ -0,0 +1,198 @@
+/*
+    flashlog - Runs the FlashLog library against the flash simulator and checks
+    that every record comes back from query() and exportTo() with its data,
+    record number, and full 64-bit time, across sector wraps, gaps between
+    records of more than 2^32us, and a remount
+    Copyright (c) 2024 Earle F. Philhower, III.  All rights reserved.
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include "FlashSim.h"
+#include <FlashLog.h>
+#include <unistd.h>
+#include <vector>
+
+static uint32_t seed = 1;
+static uint32_t rnd() {
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    return seed;
+}
+
+typedef struct {
+    uint64_t time;
+    std::vector<uint8_t> data;
+} Record;
+
+static int fails;
+
+#define CHECK(cond, ...) do { if (!(cond)) { if (fails++ < 10) { printf(__VA_ARGS__); printf("\n"); } } } while (0)
+
+// Records older than the oldest still in the log have been overwritten, every
+// later one in [from, to] has to come back
+static uint32_t oldest;
+
+static void verify(const char *what, FlashLog &log, const std::vector<Record> &all, uint64_t from, uint64_t to) {
+    std::vector<size_t> want;
+    for (size_t i = oldest; i < all.size(); i++) {
+        if ((all[i].time >= from) && (all[i].time <= to)) {
+            want.push_back(i);
+        }
+    }
+    std::vector<size_t> got;
+    bool ok = true;
+    log.query(from, to, [&](uint64_t time, uint32_t record, const uint8_t *data, size_t len) {
+        if ((record >= all.size()) || (all[record].time != time) || (all[record].data.size() != len) ||
+                (len && memcmp(all[record].data.data(), data, len))) {
+            if (ok) {
+                CHECK(false, "%s: record %u at %llu doesn't match", what, record, (unsigned long long)time);
+            }
+            ok = false;
+        }
+        got.push_back(record);
+        return true;
+    });
+    CHECK(got == want, "%s: got %zu records, expected %zu", what, got.size(), want.size());
+}
+
+class Capture : public Print {
+public:
+    size_t write(uint8_t c) override {
+        bytes.push_back(c);
+        return 1;
+    }
+    std::vector<uint8_t> bytes;
+};
+
+static void usage() {
+    printf("Usage: flashlog [-r seed]\n");
+    printf("  -r  Random seed for the record sizes and times\n");
+}
+
+int main(int argc, char **argv) {
+    int c;
+    while ((c = getopt(argc, argv, "r:h")) != -1) {
+        switch (c) {
+        case 'r':
+            seed = strtoul(optarg, nullptr, 0) | 1;
+            break;
+        default:
+            usage();
+            return 1;
+        }
+    }
+
+    FlashSim::begin();
+    // 16 sectors of the filesystem region, enough to wrap a few times
+    const uint8_t *region = __flashsim + FLASHSIM_FS_OFFSET;
+    FlashLog log;
+    CHECK(log.begin(region, 16 * 4096), "begin failed");
+
+    std::vector<Record> all;
+    uint64_t now = 1000;
+    for (int i = 0; i < 1500; i++) {
+        // Mostly short gaps, now and then one of 72 minutes to a few hours, which
+        // a real logger would have spent servicing the FIFO
+        if ((rnd() % 16) == 0) {
+            CHECK(log.service(), "service failed");
+            now += 4320000000ULL + (uint64_t)rnd() * 2;
+        } else {
+            now += rnd() % 100000;
+        }
+        Record r;
+        r.time = now;
+        r.data.resize(rnd() % 200);
+        for (auto &b : r.data) {
+            b = rnd();
+        }
+        CHECK(log.append(r.data.data(), r.data.size(), r.time), "append %d failed", i);
+        all.push_back(r);
+        if ((i % 7) == 0) {
+            CHECK(log.service(), "service failed");
+        }
+    }
+    CHECK(log.flush(), "flush failed");
+
+    oldest = all.size();
+    log.query(0, UINT64_MAX, [](uint64_t, uint32_t record, const uint8_t *, size_t) {
+        oldest = std::min(oldest, record);
+        return false;
+    });
+    CHECK(oldest && (oldest < all.size() - 100), "oldest record %u, the log should have wrapped", oldest);
+    verify("everything", log, all, 0, UINT64_MAX);
+    for (int i = 0; i < 20; i++) {
+        uint64_t a = rnd() % (now + 1);
+        uint64_t b = rnd() % (now + 1);
+        verify("range", log, all, std::min(a, b), std::max(a, b));
+    }
+
+    // A single gap of over 72 minutes inside what would otherwise be one sector
+    const uint64_t gap = 72ULL * 60 * 1000000 + 1;
+    Record r1 = { now + 10, { 1, 2, 3 } };
+    Record r2 = { now + 10 + gap, { 4, 5, 6 } };
+    CHECK(log.append(r1.data.data(), r1.data.size(), r1.time) && log.append(r2.data.data(), r2.data.size(), r2.time), "append failed");
+    all.push_back(r1);
+    all.push_back(r2);
+    CHECK(log.flush(), "flush failed");
+    verify("72 minute gap", log, all, r2.time, r2.time);
+    verify("72 minute gap", log, all, r1.time, r2.time - 1);
+
+    // The callback runs unlocked, so it may service the log itself
+    bool serviced = true;
+    log.query(0, UINT64_MAX, [&](uint64_t, uint32_t, const uint8_t *, size_t) {
+        serviced = serviced && log.service();
+        return true;
+    });
+    CHECK(serviced, "service() from a query callback failed");
+
+    // Same records in the export frames
+    Capture cap;
+    size_t n = log.exportTo(cap, 0, UINT64_MAX);
+    size_t pos = 0;
+    uint32_t first = UINT32_MAX;
+    bool ok = true;
+    for (size_t i = 0; i < n && ok; i++) {
+        uint64_t time;
+        uint32_t record;
+        uint16_t len;
+        ok = pos + 14 <= cap.bytes.size();
+        if (ok) {
+            memcpy(&time, &cap.bytes[pos], 8);
+            memcpy(&record, &cap.bytes[pos + 8], 4);
+            memcpy(&len, &cap.bytes[pos + 12], 2);
+            pos += 14;
+            ok = (record < all.size()) && (all[record].time == time) && (all[record].data.size() == len) &&
+                 (pos + len <= cap.bytes.size()) && (!len || !memcmp(all[record].data.data(), &cap.bytes[pos], len));
+            pos += len;
+            first = std::min(first, record);
+        }
+    }
+    CHECK(ok && (pos == cap.bytes.size()) && (first + n == all.size()), "exportTo frames don't match");
+
+    // A remount carries on from the last record and its full time
+    log.end();
+    CHECK(log.begin(region, 16 * 4096), "remount failed");
+    CHECK(log.records() == all.size(), "remounted at record %u, expected %zu", log.records(), all.size());
+    Record r3 = { r2.time + gap + 5, { 7 } };
+    CHECK(log.append(r3.data.data(), r3.data.size(), r3.time) && log.flush(), "append after remount failed");
+    all.push_back(r3);
+    verify("remount", log, all, r2.time, UINT64_MAX);
+    log.end();
+
+    printf("%s\n", fails ? "FlashLog tests FAILED" : "All FlashLog tests passed");
+    return fails ? 1 : 0;
+}
@@ -0,0 +1,602 @@
+/*
+    fsbench.cpp - Flash operation counts and power-fail testing for LittleFS,
+    FatFS, and EEPROM, run on the host against the flash simulator
+    Copyright (c) 2024 Earle F. Philhower, III.  All rights reserved.
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include <Arduino.h>
+#include <LittleFS.h>
+#include <FatFS.h>
+#include <EEPROM.h>
+#include "common/FlashSim.h"
+#include <functional>
+#include <map>
+#include <random>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+
+static FlashSimDevice simDevice;
+static FS LittleFSDev = FS(FSImplPtr(new littlefs_impl::LittleFSImpl(&simDevice)));
+
+// Each filesystem configuration under test.  setup() selects it before begin(),
+// and every run happens in its own process so no state survives between them.
+typedef struct {
+    const char *name;
+    FS *fs;
+    std::function<void(bool autoFormat)> setup;
+    bool powerSafe;  // Closed files are expected to survive power loss intact
+    bool device;     // Uses FlashSimDevice, so reads are counted
+} Backend;
+
+static std::vector<Backend> backends = {
+    {
+        "LittleFS", &LittleFS, [](bool autoFormat) {
+            LittleFSConfig c;
+            c.setAutoFormat(autoFormat);
+            LittleFS.setConfig(c);
+        }, true, false
+    },
+    {
+        "LittleFS/dev", &LittleFSDev, [](bool autoFormat) {
+            LittleFSConfig c;
+            c.setAutoFormat(autoFormat);
+            LittleFSDev.setConfig(c);
+        }, true, true
+    },
+    {
+        "LittleFS/dc", &LittleFSDev, [](bool autoFormat) {
+            LittleFSConfig c;
+            c.setAutoFormat(autoFormat);
+            c.setDirCache(64);
+            LittleFSDev.setConfig(c);
+        }, true, true
+    },
+    {
+        "FatFS/FTL", &FatFS, [](bool autoFormat) {
+            FatFSConfig c;
+            c.setAutoFormat(autoFormat);
+            FatFS.setConfig(c);
+        }, false, false
+    },
+    {
+        "FatFS/raw", &FatFS, [](bool autoFormat) {
+            FatFSConfig c;
+            c.setAutoFormat(autoFormat);
+            c.setUseFTL(false);
+            FatFS.setConfig(c);
+        }, false, false
+    },
+    {
+        "FatFS/dev", &FatFS, [](bool autoFormat) {
+            FatFSConfig c;
+            c.setAutoFormat(autoFormat);
+            c.setFlashDevice(&simDevice);
+            FatFS.setConfig(c);
+        }, false, true
+    },
+};
+
+// Runs fn in a child process and returns its exit status, or -1 if it crashed
+static int isolated(std::function<int()> fn) {
+    fflush(stdout);
+    pid_t pid = fork();
+    if (pid == 0) {
+        int rc = fn();
+        fflush(stdout);
+        _exit(rc);
+    }
+    int status;
+    waitpid(pid, &status, 0);
+    return WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+}
+
+
+// ---- Benchmarks ----
+
+static void header() {
+    printf("%-14s %-12s %9s %8s %9s %8s %9s %7s %10s\n", "backend", "test", "host ms", "reads", "read KB",
+           "progs", "prog KB", "erases", "stall ms");
+}
+
+static void report(const char *backend, const char *test, uint64_t startUs, bool deviceReads) {
+    const FlashSimStats &s = FlashSim::stats;
+    char reads[16], readKB[16];
+    if (deviceReads) {
+        snprintf(reads, sizeof(reads), "%llu", (unsigned long long)s.reads);
+        snprintf(readKB, sizeof(readKB), "%.1f", s.readBytes / 1024.0);
+    } else {
+        // XIP reads are plain memory accesses and can't be counted
+        strcpy(reads, "-");
+        strcpy(readKB, "-");
+    }
+    printf("%-14s %-12s %9.1f %8s %9s %8llu %9.1f %7llu %10.1f\n", backend, test, (time_us_64() - startUs) / 1000.0,
+           reads, readKB, (unsigned long long)s.programs, s.programBytes / 1024.0, (unsigned long long)s.erases,
+           s.stallUs / 1000.0);
+    if (s.overprograms) {
+        printf("%-14s %-12s *** %llu programs over unerased flash\n", backend, test, (unsigned long long)s.overprograms);
+    }
+    FlashSim::resetStats();
+}
+
+static int benchFS(const Backend &b, int scale) {
+    FS &fs = *b.fs;
+    bool dev = b.device;
+    std::mt19937 rng(1);
+    static uint8_t buff[512];
+    for (auto &c : buff) {
+        c = rng();
+    }
+    const size_t fileSize = 128 * 1024 * scale;
+
+    b.setup(true);
+    uint64_t t = time_us_64();
+    FlashSim::resetStats();
+    if (!fs.format() || !fs.begin()) {
+        printf("%-14s unable to format and mount\n", b.name);
+        return 1;
+    }
+    report(b.name, "format+mount", t, dev);
+
+    t = time_us_64();
+    File f = fs.open("/seq.bin", "w");
+    for (size_t i = 0; i < fileSize; i += sizeof(buff)) {
+        f.write(buff, sizeof(buff));
+    }
+    f.close();
+    report(b.name, "seq write", t, dev);
+
+    t = time_us_64();
+    f = fs.open("/seq.bin", "r");
+    while (f.read(buff, sizeof(buff)) > 0) {
+        /* Read it all */
+    }
+    f.close();
+    report(b.name, "seq read", t, dev);
+
+    t = time_us_64();
+    f = fs.open("/seq.bin", "r");
+    for (int i = 0; i < 500 * scale; i++) {
+        f.seek(rng() % (fileSize - 256), SeekSet);
+        f.read(buff, 256);
+    }
+    f.close();
+    report(b.name, "rand read", t, dev);
+
+    t = time_us_64();
+    f = fs.open("/seq.bin", "r+");
+    for (int i = 0; i < 100 * scale; i++) {
+        f.seek(rng() % (fileSize - 256), SeekSet);
+        f.write(buff, 256);
+    }
+    f.close();
+    report(b.name, "rand write", t, dev);
+
+    t = time_us_64();
+    for (int i = 0; i < 50 * scale; i++) {
+        char name[32];
+        sprintf(name, "/small/%d.txt", i);
+        f = fs.open(name, "w");
+        f.write(buff, 100);
+        f.close();
+    }
+    report(b.name, "small create", t, dev);
+
+    t = time_us_64();
+    int entries = 0;
+    for (int i = 0; i < 10; i++) {
+        Dir d = fs.openDir("/small");
+        while (d.next()) {
+            entries++;
+        }
+    }
+    report(b.name, "dir list", t, dev);
+    if (entries != 10 * 50 * scale) {
+        printf("%-14s dir list found %d entries, expected %d\n", b.name, entries, 10 * 50 * scale);
+        return 1;
+    }
+
+    // Half the names exist, like a web server probing for .gz versions
+    t = time_us_64();
+    int found = 0;
+    for (int i = 0; i < 500; i++) {
+        char name[32];
+        sprintf(name, "/small/%d.%s", (i * 7) % 20, (i & 1) ? "txt" : "gz");
+        found += fs.exists(name) ? 1 : 0;
+    }
+    report(b.name, "exists", t, dev);
+    if (found != 250) {
+        printf("%-14s exists found %d files, expected 250\n", b.name, found);
+        return 1;
+    }
+
+    t = time_us_64();
+    for (int i = 0; i < 50 * scale; i++) {
+        char name[32];
+        sprintf(name, "/small/%d.txt", i);
+        fs.remove(name);
+    }
+    report(b.name, "small delete", t, dev);
+
+    fs.end();
+    return 0;
+}
+
+static int benchEEPROM(int sectors, int scale) {
+    char name[32];
+    sprintf(name, "EEPROM/%d", sectors);
+    std::mt19937 rng(2);
+    FlashSim::resetStats();
+    uint64_t t = time_us_64();
+    EEPROM.begin(256, sectors);
+    for (int i = 0; i < 256; i++) {
+        EEPROM.write(i, i);
+    }
+    EEPROM.commit();
+    report(name, "first commit", t, false);
+
+    t = time_us_64();
+    for (int i = 0; i < 200 * scale; i++) {
+        int n = 1 + rng() % 8;
+        for (int j = 0; j < n; j++) {
+            EEPROM.write(rng() % 256, rng());
+        }
+        EEPROM.commit();
+    }
+    report(name, "small commits", t, false);
+    EEPROM.end();
+    return 0;
+}
+
+
+// ---- Power-fail injection ----
+
+// Steps run against the filesystem, and replayed on a model to get the expected contents
+typedef std::map<std::string, std::string> FSModel;
+
+typedef struct {
+    int op;          // 0 = rewrite, 1 = append, 2 = overwrite in place, 3 = remove
+    std::string name;
+    std::string data;
+    uint32_t offset;
+} PFStep;
+
+static std::vector<PFStep> pfSteps(uint32_t seed, int count) {
+    std::mt19937 rng(seed);
+    std::vector<PFStep> steps;
+    FSModel m;
+    for (int i = 0; i < count; i++) {
+        PFStep s;
+        s.name = "/pf/" + std::to_string(rng() % 6);
+        s.op = rng() % 4;
+        s.data = std::string(1 + rng() % 3000, 'A' + rng() % 26);
+        s.offset = 0;
+        if (!m.count(s.name) && (s.op != 0)) {
+            s.op = 0;  // Only rewrites create files
+        }
+        if (s.op == 2) {
+            s.offset = rng() % (m[s.name].size() + 1);
+        }
+        steps.push_back(s);
+        // Track the model so overwrite offsets stay inside the file
+        if (s.op == 0) {
+            m[s.name] = s.data;
+        } else if (s.op == 1) {
+            m[s.name] += s.data;
+        } else if (s.op == 2) {
+            std::string &f = m[s.name];
+            f.replace(s.offset, std::min(s.data.size(), f.size() - s.offset), s.data);
+        } else {
+            m.erase(s.name);
+        }
+    }
+    return steps;
+}
+
+static void pfApply(FSModel &m, const PFStep &s) {
+    if (s.op == 0) {
+        m[s.name] = s.data;
+    } else if (s.op == 1) {
+        m[s.name] += s.data;
+    } else if (s.op == 2) {
+        std::string &f = m[s.name];
+        f.replace(s.offset, std::min(s.data.size(), f.size() - s.offset), s.data);
+    } else {
+        m.erase(s.name);
+    }
+}
+
+static bool pfRun(FS &fs, const PFStep &s) {
+    if (s.op == 3) {
+        return fs.remove(s.name.c_str());
+    }
+    File f = fs.open(s.name.c_str(), s.op == 0 ? "w" : (s.op == 1 ? "a" : "r+"));
+    if (!f) {
+        return false;
+    }
+    if ((s.op == 2) && !f.seek(s.offset, SeekSet)) {
+        return false;
+    }
+    bool ok = f.write((const uint8_t *)s.data.data(), s.data.size()) == s.data.size();
+    f.close();
+    return ok;
+}
+
+// Set by the process that loses power, read by the one that checks what survived
+typedef struct {
+    int done;       // Steps completed (closed) before power was lost
+    uint64_t ops;   // Flash operations of an uninterrupted run
+} PFShared;
+static PFShared *pfShared;
+
+static std::string readAll(FS &fs, const std::string &name, bool &exists) {
+    File f = fs.open(name.c_str(), "r");
+    exists = (bool)f;
+    std::string ret;
+    if (f) {
+        ret.resize(f.size());
+        f.read((uint8_t *)&ret[0], ret.size());
+    }
+    return ret;
+}
+
+// 0 = every file matches, 1 = unmountable, 2 = damaged files
+static int pfVerify(const Backend &b, const std::vector<PFStep> &steps, int done) {
+    FSModel before, after;
+    for (int i = 0; i < done; i++) {
+        pfApply(before, steps[i]);
+    }
+    after = before;
+    if (done < (int)steps.size()) {
+        pfApply(after, steps[done]);
+    }
+    b.setup(false);
+    if (!b.fs->begin()) {
+        return 1;
+    }
+    for (int i = 0; i < 6; i++) {
+        std::string name = "/pf/" + std::to_string(i);
+        bool exists;
+        std::string data = readAll(*b.fs, name, exists);
+        bool okBefore = exists ? (before.count(name) && before[name] == data) : !before.count(name);
+        bool okAfter = exists ? (after.count(name) && after[name] == data) : !after.count(name);
+        // The wrapper opens files with a sync, so a rewrite in progress may leave the file truncated
+        bool okTruncated = (done < (int)steps.size()) && (steps[done].name == name) && (steps[done].op == 0) && exists && data.empty();
+        if (!okBefore && !okAfter && !okTruncated) {
+            return 2;
+        }
+    }
+    return 0;
+}
+
+static int powerFailFS(const Backend &b, int trials, uint32_t seed) {
+    const int stepCount = 40;
+    auto steps = pfSteps(seed, stepCount);
+
+    // Start every trial from the same freshly formatted filesystem
+    FlashSim::begin();
+    int rc = isolated([&]() {
+        b.setup(true);
+        return (b.fs->format() && b.fs->begin()) ? 0 : 1;
+    });
+    if (rc) {
+        printf("%-14s unable to format\n", b.name);
+        return 1;
+    }
+    auto image = FlashSim::snapshot();
+
+    // Count the flash operations of an uninterrupted run to spread the failures over
+    isolated([&]() {
+        b.setup(false);
+        b.fs->begin();
+        uint64_t start = FlashSim::ops();
+        for (auto &s : steps) {
+            pfRun(*b.fs, s);
+        }
+        b.fs->end();
+        pfShared->ops = FlashSim::ops() - start;
+        return 0;
+    });
+
+    std::mt19937 rng(seed);
+    int unmountable = 0, damaged = 0;
+    for (int t = 0; t < trials; t++) {
+        FlashSim::restore(image);
+        int64_t failAt = rng() % (pfShared->ops + 1);
+        uint32_t partial = rng();
+        pfShared->done = 0;
+        isolated([&]() {
+            b.setup(false);
+            if (!b.fs->begin()) {
+                return 1;
+            }
+            FlashSim::failAfter(failAt, partial);
+            for (auto &s : steps) {
+                pfRun(*b.fs, s);
+                pfShared->done++;
+            }
+            b.fs->end();
+            return 0;
+        });
+        int done = pfShared->done;
+        rc = isolated([&]() {
+            return pfVerify(b, steps, done);
+        });
+        if (rc == 1) {
+            unmountable++;
+        } else if (rc) {
+            damaged++;
+        }
+    }
+    bool fail = b.powerSafe && (unmountable || damaged);
+    printf("%-14s %4d power failures: %d unmountable, %d with damaged files%s\n", b.name, trials, unmountable, damaged,
+           fail ? "  *** FAIL" : (b.powerSafe ? "" : "  (not power-fail safe, informational)"));
+    return fail ? 1 : 0;
+}
+
+static int powerFailEEPROM(int sectors, int trials, uint32_t seed) {
+    const int commits = 40;
+    // Each commit changes a few random bytes of the image
+    std::vector<std::vector<uint8_t>> images;
+    std::mt19937 rng(seed);
+    std::vector<uint8_t> img(256, 0);
+    images.push_back(img);
+    for (int i = 0; i < commits; i++) {
+        int n = 1 + rng() % 16;
+        for (int j = 0; j < n; j++) {
+            img[rng() % 256] = rng();
+        }
+        images.push_back(img);
+    }
+
+    FlashSim::begin();
+    isolated([&]() {
+        EEPROM.begin(256, sectors);
+        for (int i = 0; i < 256; i++) {
+            EEPROM.write(i, 0);
+        }
+        EEPROM.commit();
+        EEPROM.end();
+        return 0;
+    });
+    auto image = FlashSim::snapshot();
+
+    auto run = [&]() {
+        EEPROM.begin(256, sectors);
+        for (int i = 1; i <= commits; i++) {
+            for (int j = 0; j < 256; j++) {
+                EEPROM.write(j, images[i][j]);
+            }
+            EEPROM.commit();
+            pfShared->done++;
+        }
+    };
+    isolated([&]() {
+        uint64_t start = FlashSim::ops();
+        run();
+        pfShared->ops = FlashSim::ops() - start;
+        return 0;
+    });
+
+    int bad = 0;
+    for (int t = 0; t < trials; t++) {
+        FlashSim::restore(image);
+        int64_t failAt = rng() % (pfShared->ops + 1);
+        uint32_t partial = rng();
+        pfShared->done = 0;
+        isolated([&]() {
+            FlashSim::failAfter(failAt, partial);
+            run();
+            return 0;
+        });
+        int done = pfShared->done;
+        int rc = isolated([&]() {
+            EEPROM.begin(256, sectors);
+            const uint8_t *p = EEPROM.getConstDataPtr();
+            bool ok = !memcmp(p, images[done].data(), 256) || ((done < commits) && !memcmp(p, images[done + 1].data(), 256));
+            return ok ? 0 : 2;
+        });
+        bad += rc ? 1 : 0;
+    }
+    printf("EEPROM/%-7d %4d power failures: %d with a wrong image%s\n", sectors, trials, bad, bad ? "  *** FAIL" : "");
+    return bad ? 1 : 0;
+}
+
+
+static const int eepromSectors[] = { 1, 4 };
+
+static void usage() {
+    printf("Usage: fsbench [-b] [-p] [-s scale] [-n trials] [-r seed] [-f backend]\n");
+    printf("  -b  Run the benchmarks (default, along with -p)\n");
+    printf("  -p  Run the power-fail tests\n");
+    printf("  -s  Benchmark size multiplier (1)\n");
+    printf("  -n  Power failures per backend (100)\n");
+    printf("  -r  Random seed (1)\n");
+    printf("  -f  Only run backends whose name starts with this\n");
+}
+
+int main(int argc, char **argv) {
+    bool bench = false, pf = false;
+    int scale = 1, trials = 100;
+    uint32_t seed = 1;
+    const char *filter = "";
+    int c;
+    while ((c = getopt(argc, argv, "bps:n:r:f:h")) != -1) {
+        switch (c) {
+        case 'b':
+            bench = true;
+            break;
+        case 'p':
+            pf = true;
+            break;
+        case 's':
+            scale = atoi(optarg);
+            break;
+        case 'n':
+            trials = atoi(optarg);
+            break;
+        case 'r':
+            seed = atoi(optarg);
+            break;
+        case 'f':
+            filter = optarg;
+            break;
+        default:
+            usage();
+            return 1;
+        }
+    }
+    if (!bench && !pf) {
+        bench = pf = true;
+    }
+    pfShared = (PFShared *)mmap(nullptr, sizeof(PFShared), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+
+    int failures = 0;
+    if (bench) {
+        header();
+        for (auto &b : backends) {
+            if (!strncmp(b.name, filter, strlen(filter))) {
+                FlashSim::begin();
+                failures += isolated([&]() {
+                    return benchFS(b, scale);
+                }) ? 1 : 0;
+            }
+        }
+        for (int sectors : eepromSectors) {
+            if (!strncmp("EEPROM", filter, strlen(filter))) {
+                FlashSim::begin();
+                failures += isolated([&]() {
+                    return benchEEPROM(sectors, scale);
+                }) ? 1 : 0;
+            }
+        }
+        printf("\n");
+    }
+    if (pf) {
+        for (auto &b : backends) {
+            if (!strncmp(b.name, filter, strlen(filter))) {
+                failures += powerFailFS(b, trials, seed);
+            }
+        }
+        for (int sectors : eepromSectors) {
+            if (!strncmp("EEPROM", filter, strlen(filter))) {
+                failures += powerFailEEPROM(sectors, trials, seed);
+            }
+        }
+    }
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,209 @@
+/*
+    otacodec - Compares the OTA bootloader's GZIP (uzlib) and LZ4 decoders on
+    a real sketch image, using the same calls and 4K reads as ota_lfs.c, and
+    models the flash time of writing the result with the flash simulator
+    Copyright (c) 2024 Earle F. Philhower, III.  All rights reserved.
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include "FlashSim.h"
+#include <chrono>
+#include <unistd.h>
+#include <sys/stat.h>
+
+extern "C" {
+#include "ota_lz4.h"
+#include "uzlib/src/uzlib.h"
+}
+
+// The blinker from the PicoOTA examples, a complete sketch .bin
+#include "../../libraries/PicoOTA/examples/OTAfromFile/blink_100_1000.h"
+
+#ifndef OTALZ4
+#define OTALZ4 "../../tools/otalz4.py"
+#endif
+#ifndef SCRATCH
+#define SCRATCH "bin"
+#endif
+
+static std::vector<uint8_t> image;
+static uint8_t dict[32768];
+static uint8_t buff[4096];
+
+static std::vector<uint8_t> load(const char *name) {
+    std::vector<uint8_t> data;
+    FILE *f = fopen(name, "rb");
+    if (f) {
+        int c;
+        while ((c = fgetc(f)) != EOF) {
+            data.push_back(c);
+        }
+        fclose(f);
+    }
+    return data;
+}
+
+static bool save(const char *name, const std::vector<uint8_t> &data) {
+    FILE *f = fopen(name, "wb");
+    bool ok = f && (fwrite(data.data(), 1, data.size(), f) == data.size());
+    if (f) {
+        fclose(f);
+    }
+    return ok;
+}
+
+// Decoders, each producing the image 4K at a time into buff like lfsRead()
+// and handing each block to sink
+
+// The bootloader reads the file through a 4K buffer
+static const std::vector<uint8_t> *lz4Src;
+static size_t lz4Pos;
+static uint32_t lz4Fill(const uint8_t **buf) {
+    uint32_t n = std::min((size_t)4096, lz4Src->size() - lz4Pos);
+    *buf = lz4Src->data() + lz4Pos;
+    lz4Pos += n;
+    return n;
+}
+
+static bool lz4(const std::vector<uint8_t> &file, void (*sink)(uint32_t, uint32_t)) {
+    lz4Src = &file;
+    lz4Pos = 0;
+    if (!lz4Begin(lz4Fill, dict, sizeof(dict))) {
+        return false;
+    }
+    for (uint32_t off = 0; off < image.size(); off += sizeof(buff)) {
+        uint32_t len = std::min((uint32_t)sizeof(buff), (uint32_t)image.size() - off);
+        if (!lz4Read(buff, len)) {
+            return false;
+        }
+        sink(off, len);
+    }
+    return true;
+}
+
+static bool gzip(const std::vector<uint8_t> &file, void (*sink)(uint32_t, uint32_t)) {
+    static struct uzlib_uncomp d;
+    uzlib_init();
+    memset(&d, 0, sizeof(d));
+    d.source = file.data();
+    d.source_limit = file.data() + file.size();
+    uzlib_uncompress_init(&d, dict, sizeof(dict));
+    if (uzlib_gzip_parse_header(&d) != TINF_OK) {
+        return false;
+    }
+    for (uint32_t off = 0; off < image.size(); off += sizeof(buff)) {
+        uint32_t len = std::min((uint32_t)sizeof(buff), (uint32_t)image.size() - off);
+        d.dest_start = d.dest = buff;
+        d.dest_limit = buff + len;
+        int res = uzlib_uncompress(&d);
+        if ((res != TINF_OK) && (res != TINF_DONE)) {
+            return false;
+        }
+        sink(off, len);
+    }
+    return true;
+}
+
+static bool raw(const std::vector<uint8_t> &file, void (*sink)(uint32_t, uint32_t)) {
+    for (uint32_t off = 0; off < image.size(); off += sizeof(buff)) {
+        uint32_t len = std::min((uint32_t)sizeof(buff), (uint32_t)image.size() - off);
+        memcpy(buff, file.data() + off, len);
+        sink(off, len);
+    }
+    return true;
+}
+
+static bool matches;
+static void check(uint32_t off, uint32_t len) {
+    matches = matches && !memcmp(buff, image.data() + off, len);
+}
+
+static void discard(uint32_t, uint32_t) {
+}
+
+// The bootloader's copy loop: only sectors which differ are rewritten
+static void write(uint32_t off, uint32_t len) {
+    memset(buff + len, 0xff, sizeof(buff) - len);
+    if (memcmp(buff, __flashsim + off, sizeof(buff))) {
+        FlashSim::erase(off, sizeof(buff));
+        FlashSim::program(off, buff, sizeof(buff));
+    }
+}
+
+static void bench(const char *name, bool (*decode)(const std::vector<uint8_t> &, void (*)(uint32_t, uint32_t)),
+                  const std::vector<uint8_t> &file, int reps) {
+    matches = true;
+    if (file.empty() || !decode(file, check) || !matches) {
+        printf("%-6s %8s  decode FAILED\n", name, "");
+        return;
+    }
+    double best = 1e9;
+    for (int i = 0; i < reps; i++) {
+        auto t0 = std::chrono::steady_clock::now();
+        decode(file, discard);
+        double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - t0).count();
+        best = std::min(best, us);
+    }
+    memset(__flashsim, 0xff, FLASHSIM_FS_OFFSET);
+    FlashSim::resetStats();
+    decode(file, write);
+    printf("%-6s %8zu %7.1f%% %10.0f %9.1f %14.0f\n", name, file.size(), 100.0 * file.size() / image.size(), best,
+           image.size() / best, FlashSim::stats.stallUs / 1000.0);
+}
+
+static void usage() {
+    printf("Usage: otacodec [-i image.bin] [-n reps]\n");
+    printf("  -i  Sketch binary to compress (default is the PicoOTA blinker example)\n");
+    printf("  -n  Decode repetitions to time (default 20)\n");
+}
+
+int main(int argc, char **argv) {
+    int reps = 20;
+    const char *input = nullptr;
+    int c;
+    while ((c = getopt(argc, argv, "i:n:h")) != -1) {
+        switch (c) {
+        case 'i':
+            input = optarg;
+            break;
+        case 'n':
+            reps = atoi(optarg);
+            break;
+        default:
+            usage();
+            return 1;
+        }
+    }
+    FlashSim::begin();
+    image = input ? load(input) : std::vector<uint8_t>(blink, blink + sizeof(blink));
+    mkdir(SCRATCH, 0755);
+    if (image.empty() || (image.size() > FLASHSIM_FS_OFFSET) || !save(SCRATCH "/otacodec.bin", image)) {
+        printf("Can't read the image, or it is too large\n");
+        return 1;
+    }
+    if (system("gzip -9 -n -c " SCRATCH "/otacodec.bin > " SCRATCH "/otacodec.bin.gz") ||
+            system("python3 " OTALZ4 " -i " SCRATCH "/otacodec.bin -o " SCRATCH "/otacodec.bin.lz4 > /dev/null")) {
+        printf("Can't compress the image, are gzip and python3 installed?\n");
+        return 1;
+    }
+
+    printf("%zu byte image, decoded 4K at a time as the OTA bootloader does\n\n", image.size());
+    printf("%-6s %8s %8s %10s %9s %14s\n", "codec", "bytes", "ratio", "host us", "MB/s", "flash stall ms");
+    bench("none", raw, image, reps);
+    bench("gzip", gzip, load(SCRATCH "/otacodec.bin.gz"), reps);
+    bench("lz4", lz4, load(SCRATCH "/otacodec.bin.lz4"), reps);
+    return 0;
+}
@@ -0,0 +1,332 @@
+/*
+    otapatch - Applies delta OTA patches from tools/otadelta.py with the OTA
+    bootloader's patcher (ota/ota_patch.c) against the flash simulator, cutting
+    power at random points and resuming like the bootloader would on reboot
+    Copyright (c) 2024 Earle F. Philhower, III.  All rights reserved.
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include "FlashSim.h"
+#include <functional>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+
+extern "C" {
+#include "ota_lfs.h"
+#include "ota_patch.h"
+}
+
+#ifndef OTADELTA
+#define OTADELTA "../../tools/otadelta.py"
+#endif
+#ifndef SCRATCH
+#define SCRATCH "bin"
+#endif
+
+// The image sits at the start of flash and the swap sector just below the
+// filesystem, as the bootloader sets things up
+static uint8_t *const base = __flashsim;
+static uint8_t *const swapSector = __flashsim + FLASHSIM_FS_OFFSET - 4096;
+
+static uint32_t seed = 1;
+static uint32_t rnd() {
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    return seed;
+}
+
+
+// ---- The bootloader's view of LittleFS, reduced to the one patch file ----
+
+static std::vector<uint8_t> file;
+static size_t filePos;
+static uint8_t fileBuff[4096];
+
+extern "C" bool lfsOpen(const char *filename) {
+    filePos = 0;
+    return !strcmp(filename, "firmware.bin");
+}
+
+extern "C" bool lfsSeek(uint32_t offset) {
+    filePos += offset;
+    return filePos <= file.size();
+}
+
+extern "C" uint8_t *lfsRead(uint32_t len) {
+    if ((len > sizeof(fileBuff)) || (filePos + len > file.size())) {
+        return nullptr;
+    }
+    memcpy(fileBuff, file.data() + filePos, len);
+    filePos += len;
+    return fileBuff;
+}
+
+extern "C" void lfsClose() {
+}
+
+
+// ---- Sketch-like images ----
+
+// Functions built from a small vocabulary of instruction sequences, each followed
+// by a literal pool of addresses of other functions, so inserting or removing a
+// function both shifts the code after it and changes pointers throughout
+typedef std::vector<std::vector<uint8_t>> Funcs;
+
+static std::vector<std::vector<uint8_t>> vocab;
+
+static std::vector<uint8_t> func() {
+    std::vector<uint8_t> f;
+    size_t len = 40 + rnd() % 560;
+    while (f.size() < len) {
+        auto &v = vocab[rnd() % vocab.size()];
+        f.insert(f.end(), v.begin(), v.end());
+    }
+    return f;
+}
+
+static std::vector<uint8_t> link(const Funcs &funcs) {
+    std::vector<uint32_t> addr;
+    uint32_t a = 0;
+    for (auto &f : funcs) {
+        addr.push_back(a);
+        a += f.size() + 16;
+    }
+    std::vector<uint8_t> img;
+    for (auto &f : funcs) {
+        img.insert(img.end(), f.begin(), f.end());
+        for (int i = 0; i < 4; i++) {
+            uint32_t p = 0x10000001 + addr[f[i] % funcs.size()];
+            img.insert(img.end(), (uint8_t *)&p, (uint8_t *)&p + 4);
+        }
+    }
+    return img;
+}
+
+
+// ---- Tests ----
+
+// Runs fn in a child process and returns its exit status, or -1 if it crashed
+static int isolated(std::function<int()> fn) {
+    fflush(stdout);
+    pid_t pid = fork();
+    if (pid == 0) {
+        _exit(fn());
+    }
+    int status;
+    waitpid(pid, &status, 0);
+    return WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+}
+
+static bool save(const char *name, const std::vector<uint8_t> &data) {
+    FILE *f = fopen(name, "wb");
+    bool ok = f && (fwrite(data.data(), 1, data.size(), f) == data.size());
+    if (f) {
+        fclose(f);
+    }
+    return ok;
+}
+
+static bool makePatch(const std::vector<uint8_t> &oldImg, const std::vector<uint8_t> &newImg, const char *dir) {
+    mkdir(SCRATCH, 0755);
+    char cmd[1024];
+    snprintf(cmd, sizeof(cmd), "python3 %s -r -d %s -O " SCRATCH "/ota_old.bin -N " SCRATCH "/ota_new.bin -o " SCRATCH "/ota_patch.bin > /dev/null",
+             OTADELTA, dir);
+    if (!save(SCRATCH "/ota_old.bin", oldImg) || !save(SCRATCH "/ota_new.bin", newImg) || system(cmd)) {
+        return false;
+    }
+    FILE *f = fopen(SCRATCH "/ota_patch.bin", "rb");
+    if (!f) {
+        return false;
+    }
+    file.clear();
+    int c;
+    while ((c = fgetc(f)) != EOF) {
+        file.push_back(c);
+    }
+    fclose(f);
+    return true;
+}
+
+static void install(const std::vector<uint8_t> &img) {
+    memset(__flashsim, 0xff, FLASHSIM_FS_OFFSET);
+    memcpy(base, img.data(), img.size());
+}
+
+static bool installed(const std::vector<uint8_t> &img) {
+    if (memcmp(base, img.data(), img.size())) {
+        return false;
+    }
+    for (size_t i = img.size(); i % 4096; i++) {
+        if (base[i] != 0xff) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static int apply() {
+    return otaPatch("firmware.bin", 0, file.size(), base, swapSector);
+}
+
+static bool check(const char *what, bool ok) {
+    if (!ok) {
+        printf("    FAILED: %s\n", what);
+    }
+    return ok;
+}
+
+// Applies the patch straight through, then again with power cut at random
+// program or erase operations, rebooting (re-running the patcher) each time
+static bool powerFail(const char *name, const std::vector<uint8_t> &oldImg, const std::vector<uint8_t> &newImg,
+                      const char *dir, int trials) {
+    if (!makePatch(oldImg, newImg, dir)) {
+        printf("%-10s %-5s can't build patch, is python3 installed?\n", name, dir);
+        return false;
+    }
+    install(oldImg);
+    FlashSim::resetStats();
+    uint64_t start = FlashSim::ops();
+    bool ok = check("patch", apply() == OTA_PATCH_DONE) && check("image", installed(newImg));
+    uint64_t ops = FlashSim::ops() - start;
+    printf("%-10s %-5s patch %6zu bytes, %3lu sector erases", name, dir, file.size(), (unsigned long)FlashSim::stats.erases);
+    fflush(stdout);
+    ok = ok && check("rerun", (apply() == OTA_PATCH_DONE) && (FlashSim::ops() - start == ops));
+
+    int reboots = 0;
+    for (int t = 0; ok && (t < trials) && ops; t++) {
+        install(oldImg);
+        for (int boot = 0; ; boot++) {
+            // Cut power a few times, then let it finish
+            int64_t cut = (boot < 4) ? (int64_t)(rnd() % ops) : -1;
+            uint32_t s = rnd();
+            int rc = isolated([&] {
+                FlashSim::failAfter(cut, s);
+                return apply() == OTA_PATCH_DONE ? 0 : 1;
+            });
+            if (rc == FLASHSIM_POWERFAIL_EXIT) {
+                reboots++;
+                continue;
+            }
+            ok = check("resume after power failure", rc == 0) && check("image after power failure", installed(newImg));
+            break;
+        }
+    }
+    printf(", %d power failures %s\n", reboots, ok ? "ok" : "");
+    return ok;
+}
+
+// Patches which don't match flash, or are damaged, must be refused before
+// anything is written
+static bool refused(const std::vector<uint8_t> &oldImg, const std::vector<uint8_t> &newImg, const std::vector<uint8_t> &other) {
+    if (!makePatch(oldImg, newImg, "auto")) {
+        printf("%-10s %-5s can't build patch, is python3 installed?\n", "refusals", "");
+        return false;
+    }
+    bool ok = true;
+
+    install(other);
+    auto before = FlashSim::snapshot();
+    ok = ok && check("wrong image", (apply() == OTA_PATCH_FAILED) && (FlashSim::snapshot() == before));
+
+    install(oldImg);
+    before = FlashSim::snapshot();
+    file[file.size() / 2] ^= 0x10;
+    ok = ok && check("corrupt patch", (apply() == OTA_PATCH_FAILED) && (FlashSim::snapshot() == before));
+    file[file.size() / 2] ^= 0x10;
+
+    ok = ok && check("no swap space", (otaPatch("firmware.bin", 0, file.size(), base, base + 4096) == OTA_PATCH_FAILED) &&
+                     (FlashSim::snapshot() == before));
+
+    file = newImg;
+    ok = ok && check("plain image", (apply() == OTA_PATCH_NONE) && (FlashSim::snapshot() == before));
+    printf("%-10s %-5s %s\n", "refusals", "", ok ? "ok" : "");
+    return ok;
+}
+
+static void usage() {
+    printf("Usage: otapatch [-n trials] [-r seed]\n");
+    printf("  -n  Power-fail trials per patch (default 20)\n");
+    printf("  -r  Random seed (default 1)\n");
+}
+
+int main(int argc, char **argv) {
+    int trials = 20;
+    int c;
+    while ((c = getopt(argc, argv, "n:r:h")) != -1) {
+        switch (c) {
+        case 'n':
+            trials = atoi(optarg);
+            break;
+        case 'r':
+            seed = strtoul(optarg, nullptr, 0) | 1;
+            break;
+        default:
+            usage();
+            return 1;
+        }
+    }
+    FlashSim::begin();
+
+    for (int i = 0; i < 300; i++) {
+        std::vector<uint8_t> v(2 + rnd() % 5);
+        for (auto &b : v) {
+            b = rnd();
+        }
+        vocab.push_back(v);
+    }
+    Funcs funcs;
+    for (int i = 0; i < 800; i++) {
+        funcs.push_back(func());
+    }
+    auto oldImg = link(funcs);
+
+    // One function changed in place
+    Funcs edit = funcs;
+    edit[400][10] ^= 0x55;
+    // Functions added, shifting most of the image up
+    Funcs grow = funcs;
+    for (int i = 0; i < 5; i++) {
+        grow.insert(grow.begin() + rnd() % grow.size(), func());
+    }
+    // Functions removed, shifting it down
+    Funcs shrink = funcs;
+    for (int i = 0; i < 5; i++) {
+        shrink.erase(shrink.begin() + rnd() % shrink.size());
+    }
+    // A much larger sketch
+    Funcs big = funcs;
+    for (int i = 0; i < 40; i++) {
+        big.insert(big.begin() + 100 + i, func());
+    }
+
+    bool ok = true;
+    struct {
+        const char *name;
+        const Funcs &to;
+    } cases[] = { { "same", funcs }, { "edit", edit }, { "grow", grow }, { "shrink", shrink }, { "big", big } };
+    for (auto &t : cases) {
+        for (auto dir : { "up", "down" }) {
+            ok &= powerFail(t.name, oldImg, link(t.to), dir, trials);
+        }
+    }
+    ok &= powerFail("downgrade", link(big), oldImg, "auto", trials);
+    ok &= refused(oldImg, link(grow), link(edit));
+
+    printf("%s\n", ok ? "All OTA patch tests passed" : "OTA patch tests FAILED");
+    return ok ? 0 : 1;
+}
@@ -27,6 +27,11 @@
 # 2016-01-03:
 # - Added more options to parser.
 #
+# Changes
+# 2024:
+# - Stream the image instead of waiting for a reply to every packet.
+# - Continue an interrupted upload from where the device left off.
+#
 
 from __future__ import print_function
 import socket
@@ -36,12 +41,16 @@ import optparse
 import logging
 import hashlib
 import random
+import select
+import time
 
 # Commands
 FLASH = 0
 SPIFFS = 100
 AUTH = 200
 PROGRESS = False
+# serve() result when the connection broke but the device kept what it received
+INTERRUPTED = 2
 # update_progress() : Displays or updates a console progress bar
 ## Accepts a float between 0 and 1. Any int will be converted to a float.
 ## A value under 0 represents a 'halt'.
@@ -72,6 +81,7 @@ def update_progress(progress):
 def serve(remoteAddr, localAddr, remotePort, localPort, password, filename, command = FLASH):
   # Create a TCP/IP socket
   sock = socket.socket(socket.AF_INET, socket.SOCK_STREAM)
+  sock.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEADDR, 1)
   server_address = (localAddr, localPort)
   logging.info('Starting on %s:%s', str(server_address[0]), str(server_address[1]))
   try:
@@ -94,7 +104,9 @@ def serve(remoteAddr, localAddr, remotePort, localPort, password, filename, comm
   file_md5 = hashlib.md5(f.read()).hexdigest()
   f.close()
   logging.info('Upload size: %d', content_size)
-  message = '%d %d %d %s\n' % (command, localPort, content_size, file_md5)
+  # Older devices ignore the second line, answer with a bare "OK", and are
+  # happy to be streamed to anyway
+  message = '%d %d %d %s\nresume\n' % (command, localPort, content_size, file_md5)
 
   # Wait for a connection
   logging.info('Sending invitation to: %s', remoteAddr)
@@ -108,7 +120,7 @@ def serve(remoteAddr, localAddr, remotePort, localPort, password, filename, comm
     logging.error('No Answer')
     sock2.close()
     return 1
-  if (data != "OK"):
+  if (data.split()[:1] != ["OK"]):
     if(data.startswith('AUTH')):
       nonce = data.split()[1]
       cnonce_text = '%s%u%s%s' % (filename, content_size, file_md5, remoteAddr)
@@ -128,7 +140,7 @@ def serve(remoteAddr, localAddr, remotePort, localPort, password, filename, comm
         logging.error('No Answer to our Authentication')
         sock2.close()
         return 1
-      if (data != "OK"):
+      if (data.split()[:1] != ["OK"]):
         sys.stderr.write('FAIL\n')
         logging.error('%s', data)
         sock2.close()
@@ -141,6 +153,13 @@ def serve(remoteAddr, localAddr, remotePort, localPort, password, filename, comm
       return 1
   sock2.close()
 
+  # "OK <offset>" when the device already has the start of this image
+  offset = 0
+  if (len(data.split()) > 1):
+    offset = int(data.split()[1])
+    if (offset > 0):
+      logging.info('Resuming from %d', offset)
+
   logging.info('Waiting for device...')
   try:
     sock.settimeout(10)
@@ -161,25 +180,35 @@ def serve(remoteAddr, localAddr, remotePort, localPort, password, filename, comm
     else:
       sys.stderr.write('Uploading')
       sys.stderr.flush()
-    offset = 0
+    f.seek(offset)
+    connection.settimeout(10)
     while True:
-      chunk = f.read(1460)
+      chunk = f.read(8192)
       if not chunk: break
-      offset += len(chunk)
-      update_progress(offset/float(content_size))
-      connection.settimeout(10)
       try:
         connection.sendall(chunk)
-        if connection.recv(32).decode().find('O') >= 0:
-          # connection will receive only digits or 'OK'
-          received_ok = True
+        # Don't wait for them, but pick up any replies so an error is seen early
+        # (older devices send digits for every packet)
+        while select.select([connection], [], [], 0)[0]:
+          reply = connection.recv(64).decode()
+          if not reply:
+            raise IOError('closed')
+          if reply.find('E') >= 0:
+            sys.stderr.write('\n')
+            logging.error('%s', reply)
+            connection.close()
+            f.close()
+            sock.close()
+            return 1
       except Exception:
         sys.stderr.write('\n')
         logging.error('Error Uploading')
         connection.close()
         f.close()
         sock.close()
-        return 1
+        return INTERRUPTED
+      offset += len(chunk)
+      update_progress(offset/float(content_size))
 
     sys.stderr.write('\n')
     logging.info('Waiting for result...')
@@ -214,7 +243,7 @@ def serve(remoteAddr, localAddr, remotePort, localPort, password, filename, comm
       connection.close()
       f.close()
       sock.close()
-      return 1
+      return INTERRUPTED
 
   finally:
     connection.close()
@@ -277,6 +306,12 @@ def parser(unparsed_args):
     metavar="FILE",
     default = None
   )
+  group.add_option("-R", "--retries",
+    dest = "retries",
+    type = "int",
+    help = "Times to try continuing an interrupted upload. Default 3",
+    default = 3
+  )
   group.add_option("-s", "--spiffs",
     dest = "spiffs",
     action = "store_true",
@@ -336,7 +371,14 @@ def main(args):
     command = SPIFFS
   # end if
 
-  return serve(options.esp_ip, options.host_ip, options.esp_port, options.host_port, options.auth, options.image, command)
+  for attempt in range(options.retries + 1):
+    result = serve(options.esp_ip, options.host_ip, options.esp_port, options.host_port, options.auth, options.image, command)
+    if (result != INTERRUPTED):
+      return result
+    # Give the device time to notice the connection is gone
+    logging.warning('Upload interrupted, retrying')
+    time.sleep(2)
+  return 1
 # end main
 
 
@@ -0,0 +1,78 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+#
+# mkxipfs.py - Build a read-only XIPFS image from a directory tree
+# Copyright (c) 2024 Earle F. Philhower, III.  All rights reserved.
+#
+# The generated image is meant to be written to the start of the filesystem
+# region (_FS_start) and is mounted by the XIPFS library.  Files are laid out
+# contiguously so the application can read them directly from XIP flash.
+#
+# Released under the GNU LGPL 2.1 or later
+
+import argparse
+import os
+import struct
+import sys
+
+XIPFS_MAGIC = 0x46504958
+XIPFS_VERSION = 1
+XIPFS_NAME_MAX = 52
+HEADER_FMT = "<IHHII"
+ENTRY_FMT = "<III%ds" % XIPFS_NAME_MAX
+
+def parse_args():
+    parser = argparse.ArgumentParser(description='XIPFS image builder')
+    parser.add_argument('-c', '--create', help='Directory to pack', required=True)
+    parser.add_argument('-o', '--out', help='Output image file', required=True)
+    parser.add_argument('-s', '--size', help='Maximum image size (FS region size) in bytes', type=lambda x: int(x, 0), default=0)
+    parser.add_argument('-a', '--align', help='File data alignment in bytes', type=lambda x: int(x, 0), default=4)
+    return parser.parse_args()
+
+def collect(root):
+    files = []
+    for dirpath, dirnames, filenames in os.walk(root):
+        dirnames.sort()
+        for f in filenames:
+            full = os.path.join(dirpath, f)
+            rel = os.path.relpath(full, root).replace(os.sep, '/')
+            if len(rel.encode('utf-8')) >= XIPFS_NAME_MAX:
+                sys.stderr.write("ERROR: Path '%s' longer than %d characters\n" % (rel, XIPFS_NAME_MAX - 1))
+                sys.exit(1)
+            files.append((rel, full))
+    # The device binary searches the table with strncmp, so sort on the raw bytes
+    files.sort(key=lambda x: x[0].encode('utf-8'))
+    return files
+
+def main():
+    args = parse_args()
+    files = collect(args.create)
+    if len(files) > 0xffff:
+        sys.stderr.write("ERROR: Too many files (%d)\n" % len(files))
+        return 1
+    table = b''
+    data = b''
+    offset = struct.calcsize(HEADER_FMT) + len(files) * struct.calcsize(ENTRY_FMT)
+    for rel, full in files:
+        pad = (-offset) % args.align
+        data += b'\xff' * pad
+        offset += pad
+        with open(full, "rb") as f:
+            contents = f.read()
+        mtime = int(os.path.getmtime(full)) & 0xffffffff
+        table += struct.pack(ENTRY_FMT, offset, len(contents), mtime, rel.encode('utf-8'))
+        data += contents
+        offset += len(contents)
+    if args.size and offset > args.size:
+        sys.stderr.write("ERROR: Image size %d exceeds filesystem size %d\n" % (offset, args.size))
+        return 1
+    hdr = struct.pack(HEADER_FMT, XIPFS_MAGIC, XIPFS_VERSION, len(files), offset, 0)
+    with open(args.out, "wb") as out:
+        out.write(hdr)
+        out.write(table)
+        out.write(data)
+    sys.stderr.write("XIPFS image: %d files, %d bytes\n" % (len(files), offset))
+    return 0
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,303 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+#
+# otadelta.py - Build a delta (binary patch) OTA update between two sketches
+# Copyright (c) 2024 Earle F. Philhower, III.  All rights reserved.
+#
+# The patch is uploaded in place of the usual firmware.bin (via the Updater,
+# ArduinoOTA, HTTPUpdate, or just copied into LittleFS and given to PicoOTA) and
+# applied by the OTA bootloader directly over the running image, one 4K sector
+# at a time.  The format is described in ota/ota_patch.h.
+#
+# Released under the GNU LGPL 2.1 or later
+
+import argparse
+import gzip
+import io
+import struct
+import sys
+import zlib
+
+SECTOR = 4096
+KEY = 8             # Bytes hashed to find candidate matches
+MINMATCH = 12       # Shortest exact match worth a COPY/ADD op
+CANDIDATES = 16     # Positions remembered per hash key
+
+OP_COPY = 0
+OP_ADD = 1
+OP_LIT = 2
+
+SELF = 1            # Record flag, the sector is built from its own old contents
+
+HEADER_FMT = "<8sIIIII"
+DESCENDING = 1
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(description='Delta OTA patch builder')
+    parser.add_argument('-O', '--old', help='Image currently running on the device (.bin, .uf2, or .elf)', required=True)
+    parser.add_argument('-N', '--new', help='Image to update to (.bin, .uf2, or .elf)', required=True)
+    parser.add_argument('-o', '--out', help='Output patch file', required=True)
+    parser.add_argument('-b', '--base', help='Flash address of the image', type=lambda x: int(x, 0), default=0x10000000)
+    parser.add_argument('-r', '--raw', help='Don\'t GZIP compress the patch', action='store_true')
+    parser.add_argument('-d', '--direction', help='Order to write sectors in', choices=['auto', 'up', 'down'], default='auto')
+    return parser.parse_args()
+
+
+def load_elf(data, base):
+    if data[4] != 1 or data[5] != 1:
+        raise ValueError("only 32-bit little endian ELF files are supported")
+    phoff, = struct.unpack_from("<I", data, 0x1c)
+    phentsize, phnum = struct.unpack_from("<HH", data, 0x2a)
+    image = bytearray()
+    for i in range(phnum):
+        ptype, offset, vaddr, paddr, filesz = struct.unpack_from("<IIIII", data, phoff + i * phentsize)
+        if ptype != 1 or not filesz or paddr < base or paddr >= base + 0x1000000:
+            continue
+        addr = paddr - base
+        if len(image) < addr + filesz:
+            image.extend(bytes(addr + filesz - len(image)))  # objcopy -O binary fills gaps with 0
+        image[addr:addr + filesz] = data[offset:offset + filesz]
+    return bytes(image)
+
+
+def load_uf2(data, base):
+    image = bytearray()
+    for off in range(0, len(data) - 511, 512):
+        magic0, magic1, flags, addr, size = struct.unpack_from("<IIIII", data, off)
+        if magic0 != 0x0A324655 or magic1 != 0x9E5D5157 or (flags & 1) or addr < base:
+            continue
+        addr -= base
+        if len(image) < addr + size:
+            image.extend(b'\xff' * (addr + size - len(image)))  # Unwritten flash stays erased
+        image[addr:addr + size] = data[off + 32:off + 32 + size]
+    return bytes(image)
+
+
+def load(name, base):
+    with open(name, "rb") as f:
+        data = f.read()
+    if data[:4] == b'\x7fELF':
+        image = load_elf(data, base)
+    elif data[:4] == b'UF2\n':
+        image = load_uf2(data, base)
+    else:
+        image = data
+    if not image:
+        raise ValueError("%s: no image found" % name)
+    return image
+
+
+def varint(v):
+    out = bytearray()
+    while v >= 0x80:
+        out.append((v & 0x7f) | 0x80)
+        v >>= 7
+    out.append(v)
+    return bytes(out)
+
+
+def prefix(a, ai, b, bi, n):
+    # Length of the common prefix of a[ai:ai+n] and b[bi:bi+n]
+    if a[ai:ai + n] == b[bi:bi + n]:
+        return n
+    lo, hi = 0, n
+    while hi - lo > 1:
+        mid = (lo + hi) // 2
+        if a[ai:ai + mid] == b[bi:bi + mid]:
+            lo = mid
+        else:
+            hi = mid
+    return lo
+
+
+def index(data):
+    idx = {}
+    for i in range(len(data) - KEY + 1):
+        lst = idx.setdefault(data[i:i + KEY], [])
+        if len(lst) < CANDIDATES:
+            lst.append(i)
+    return idx
+
+
+class Delta:
+    def __init__(self, old, new):
+        self.old = old
+        self.sectors = (len(new) + SECTOR - 1) // SECTOR
+        self.new = new + b'\xff' * (self.sectors * SECTOR - len(new))
+        self.oldidx = index(old)
+        self.newidx = index(self.new)
+
+    def regions(self, sector, descending):
+        # Flash contents while this sector is being built: [(start, end, bytes)]
+        end = (sector + 1) * SECTOR
+        if descending:
+            return [(end, len(self.new), self.new), (0, min(len(self.old), end), self.old)]
+        return [(0, sector * SECTOR, self.new), (sector * SECTOR, len(self.old), self.old)]
+
+    def best(self, pos, end, regions, hint):
+        # Longest exact match for new[pos:] in flash, as (src, len, region)
+        key = self.new[pos:pos + KEY]
+        cands = [pos + hint, pos] + self.oldidx.get(key, []) + self.newidx.get(key, [])
+        found = (0, 0, None)
+        for src in cands:
+            for r in regions:
+                if r[0] <= src < r[1]:
+                    n = prefix(self.new, pos, r[2], src, min(end - pos, r[1] - src))
+                    if n > found[1]:
+                        found = (src, n, r)
+        return found
+
+    def sector(self, sector, descending):
+        start = sector * SECTOR
+        end = start + SECTOR
+        regions = self.regions(sector, descending)
+        new = self.new
+        ops = bytearray()
+        lit = start
+        pos = start
+        hint = 0
+        flags = 0
+        while pos < end:
+            src, n, r = self.best(pos, end, regions, hint)
+            if n < MINMATCH:
+                pos += 1
+                continue
+            data = r[2]
+            # Extend backwards over the pending literals and forwards past the
+            # exact match while most bytes still agree, bsdiff style
+            back = 0
+            score = best = 0
+            for k in range(1, min(pos - lit, src - r[0]) + 1):
+                score += 1 if data[src - k] == new[pos - k] else -1
+                if score > best:
+                    best, back = score, k
+            fwd = 0
+            score = best = 0
+            limit = min(end - pos, r[1] - src)
+            for k in range(n, limit):
+                score += 1 if data[src + k] == new[pos + k] else -1
+                if score > best:
+                    best, fwd = score, k + 1 - n
+                elif score < best - 16:
+                    break
+            if lit < pos - back:
+                ops += bytes([OP_LIT]) + varint(pos - back - lit) + new[lit:pos - back]
+            length = back + n + fwd
+            s, p = src - back, pos - back
+            diff = bytes((new[p + k] - data[s + k]) & 0xff for k in range(length))
+            if any(diff):
+                ops += bytes([OP_ADD]) + varint(length) + varint(s) + diff
+            else:
+                ops += bytes([OP_COPY]) + varint(length) + varint(s)
+            if s < end and s + length > start:
+                flags |= SELF
+            hint = src - pos
+            pos = lit = p + length
+        if lit < end:
+            ops += bytes([OP_LIT]) + varint(end - lit) + new[lit:end]
+        oldlen = max(0, min(len(self.old) - start, SECTOR))
+        return struct.pack("<IIB", zlib.crc32(new[start:end]), zlib.crc32(self.old[start:start + oldlen]), flags) + bytes(ops)
+
+    def patch(self, descending):
+        order = range(self.sectors - 1, -1, -1) if descending else range(self.sectors)
+        return b''.join(self.sector(s, descending) for s in order)
+
+
+def header(old, new, flags, body):
+    hdr = struct.pack(HEADER_FMT, b'Pico DLT', len(old), len(new), flags, len(body), zlib.crc32(body))
+    return hdr + struct.pack("<I", zlib.crc32(hdr))
+
+
+def compress(patch):
+    # The GZIP file name marks the stream as a patch, so the Updater can refuse
+    # it when the bootloader on the device is too old to apply it
+    buf = io.BytesIO()
+    with gzip.GzipFile(filename="Pico DLT", mode="wb", compresslevel=9, fileobj=buf, mtime=0) as f:
+        f.write(patch)
+    return buf.getvalue()
+
+
+def apply(flash, patch):
+    # Applies the patch to a bytearray like the bootloader does, returns sectors written
+    sign, oldsize, newsize, flags, plen, pcrc = struct.unpack_from(HEADER_FMT, patch, 0)
+    pos = struct.calcsize(HEADER_FMT) + 4
+    sectors = (newsize + SECTOR - 1) // SECTOR
+    flash.extend(b'\xff' * max(0, sectors * SECTOR - len(flash)))
+    written = 0
+
+    def getvar():
+        nonlocal pos
+        v = shift = 0
+        while True:
+            b = patch[pos]
+            pos += 1
+            v |= (b & 0x7f) << shift
+            shift += 7
+            if not b & 0x80:
+                return v
+    for i in range(sectors):
+        sector = sectors - 1 - i if flags & DESCENDING else i
+        newcrc, oldcrc, sflags = struct.unpack_from("<IIB", patch, pos)
+        pos += 9
+        out = bytearray()
+        while len(out) < SECTOR:
+            op = patch[pos]
+            pos += 1
+            n = getvar()
+            if op == OP_LIT:
+                out += patch[pos:pos + n]
+                pos += n
+                continue
+            src = getvar()
+            if op == OP_ADD:
+                out += bytes((flash[src + k] + patch[pos + k]) & 0xff for k in range(n))
+                pos += n
+            else:
+                out += flash[src:src + n]
+        if zlib.crc32(out) != newcrc:
+            raise ValueError("sector %d does not match after patching" % sector)
+        if flash[sector * SECTOR:(sector + 1) * SECTOR] != out:
+            flash[sector * SECTOR:(sector + 1) * SECTOR] = out
+            written += 1
+    return written
+
+
+def main():
+    args = parse_args()
+    try:
+        old = load(args.old, args.base)
+        new = load(args.new, args.base)
+    except (OSError, ValueError, struct.error) as e:
+        sys.stderr.write("ERROR: %s\n" % e)
+        return 1
+
+    delta = Delta(old, new)
+    best = None
+    dirs = {'auto': [False, True], 'up': [False], 'down': [True]}[args.direction]
+    for descending in dirs:
+        body = delta.patch(descending)
+        patch = header(old, new, DESCENDING if descending else 0, body) + body
+        out = patch if args.raw else compress(patch)
+        if best is None or len(out) < len(best[1]):
+            best = (patch, out, descending)
+    patch, out, descending = best
+
+    # Make sure the patch reproduces the new image before handing it out
+    flash = bytearray(old)
+    written = apply(flash, patch)
+    if bytes(flash[:len(new)]) != new:
+        sys.stderr.write("ERROR: Patch verification failed\n")
+        return 1
+
+    with open(args.out, "wb") as f:
+        f.write(out)
+    print("Old image %d bytes, new image %d bytes, %d of %d sectors changed" % (len(old), len(new), written, delta.sectors))
+    print("Patch %d bytes (%s, sectors written %s), %.1f%% of the %s new image" %
+          (len(out), "raw" if args.raw else "gzip", "downwards" if descending else "upwards",
+           100.0 * len(out) / (len(new) if args.raw else len(gzip.compress(new, 9))), "raw" if args.raw else "gzipped"))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,151 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+#
+# otalz4.py - Compress an OTA image into an LZ4 frame for the OTA bootloader
+# Copyright (c) 2024 Earle F. Philhower, III.  All rights reserved.
+#
+# LZ4 decompresses several times faster than GZIP on the RP2040, shortening the
+# time the device spends in the bootloader, at the cost of a larger file.  The
+# output is a standard LZ4 frame (so "lz4 -d" can check it) whose matches never
+# reach back more than 32K, the most the bootloader keeps.
+#
+# Released under the GNU LGPL 2.1 or later
+
+import argparse
+import struct
+import sys
+
+MAGIC = 0x184D2204
+BLOCK = 64 * 1024
+MINMATCH = 4
+LASTLITERALS = 5    # The format requires blocks to end in at least 5 literals
+MFLIMIT = 12        # and the last match to start 12 bytes before the end
+
+P1, P2, P3, P4, P5 = 2654435761, 2246822519, 3266489917, 668265263, 374761393
+M32 = 0xffffffff
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(description='LZ4 OTA image compressor')
+    parser.add_argument('-i', '--input', help='Binary to compress', required=True)
+    parser.add_argument('-o', '--out', help='Output .lz4 file', required=True)
+    parser.add_argument('-w', '--window', help='Maximum match distance', type=int, default=32768)
+    parser.add_argument('-d', '--depth', help='Match candidates to search at each position', type=int, default=64)
+    return parser.parse_args()
+
+
+def xxh32(data, seed=0):
+    # Only used on the frame descriptor, which is always under 16 bytes
+    def rotl(x, r):
+        return ((x << r) | (x >> (32 - r))) & M32
+    h = (seed + P5 + len(data)) & M32
+    i = 0
+    while i + 4 <= len(data):
+        h = (h + struct.unpack_from("<I", data, i)[0] * P3) & M32
+        h = (rotl(h, 17) * P4) & M32
+        i += 4
+    for b in data[i:]:
+        h = (h + b * P5) & M32
+        h = (rotl(h, 11) * P1) & M32
+    h ^= h >> 15
+    h = (h * P2) & M32
+    h ^= h >> 13
+    h = (h * P3) & M32
+    h ^= h >> 16
+    return h
+
+
+def prefix(data, a, b, n):
+    # Length of the common prefix of data[a:a+n] and data[b:b+n]
+    if data[a:a + n] == data[b:b + n]:
+        return n
+    lo, hi = 0, n
+    while hi - lo > 1:
+        mid = (lo + hi) // 2
+        if data[a:a + mid] == data[b:b + mid]:
+            lo = mid
+        else:
+            hi = mid
+    return lo
+
+
+def length(n):
+    out = bytearray()
+    while n >= 255:
+        out.append(255)
+        n -= 255
+    out.append(n)
+    return out
+
+
+def sequence(lits, match, off):
+    ml = match - MINMATCH if match else 0
+    out = bytearray([(min(len(lits), 15) << 4) | min(ml, 15)])
+    if len(lits) >= 15:
+        out += length(len(lits) - 15)
+    out += lits
+    if match:
+        out += struct.pack("<H", off)
+        if ml >= 15:
+            out += length(ml - 15)
+    return out
+
+
+def compress(data, window, depth):
+    head = {}
+    prev = [-1] * len(data)
+
+    def insert(i):
+        key = data[i:i + MINMATCH]
+        prev[i] = head.get(key, -1)
+        head[key] = i
+
+    out = bytearray()
+    for start in range(0, len(data), BLOCK):
+        end = min(start + BLOCK, len(data))
+        block = bytearray()
+        lit = pos = start
+        while pos < end - MFLIMIT:
+            best, boff = 0, 0
+            cand = head.get(data[pos:pos + MINMATCH], -1)
+            tries = depth
+            while cand >= 0 and pos - cand <= window and tries:
+                n = prefix(data, cand, pos, end - LASTLITERALS - pos)
+                if n > best:
+                    best, boff = n, pos - cand
+                cand = prev[cand]
+                tries -= 1
+            if best < MINMATCH:
+                insert(pos)
+                pos += 1
+                continue
+            block += sequence(data[lit:pos], best, boff)
+            for i in range(pos, pos + best):
+                insert(i)
+            pos = lit = pos + best
+        block += sequence(data[lit:end], 0, 0)
+        if len(block) < end - start:
+            out += struct.pack("<I", len(block)) + block
+        else:
+            out += struct.pack("<I", 0x80000000 | (end - start)) + data[start:end]
+    # Independent blocks off, no checksums, content size present, 64K blocks
+    desc = struct.pack("<BBQ", 0x48, 0x40, len(data))
+    return struct.pack("<I", MAGIC) + desc + bytes([(xxh32(desc) >> 8) & 0xff]) + out + struct.pack("<I", 0)
+
+
+def main():
+    args = parse_args()
+    if args.window < 1 or args.window > 65535:
+        sys.stderr.write("ERROR: Window must be between 1 and 65535\n")
+        return 1
+    with open(args.input, "rb") as f:
+        data = f.read()
+    out = compress(data, args.window, args.depth)
+    with open(args.out, "wb") as f:
+        f.write(out)
+    print("Compressed %d bytes to %d (%.1f%%)" % (len(data), len(out), 100.0 * len(out) / max(1, len(data))))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())